@@ -18,7 +18,7 @@
 #include "miner.h"
 
 typedef union {
-  unsigned long hash[8];
+  uint32_t hash[8];
   unsigned char bytes[32];
 } miner_sha256_hash;
 
@@ -14,7 +14,6 @@
  */
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
 #include <CustomJWT.h>
 
 #include "miner.h"
@@ -25,6 +24,14 @@
 #include "nvs_handler.h"
 #include "MyWiFi.h"
 #include "utils.h"
+#include "metrics.h"
+#include "PlainWebServer.h"
+#include "web_templates.h"
+#include "settings_diff.h"
+#include "journal.h"
+#include "eventTask.h"
+#include "cluster.h"
+#include "stratumCapture.h"
 
 
 #include "PlainWebSocket.h"
@@ -37,11 +44,11 @@ void handleStatus();
 extern MonitorData monitorData;
 extern SetupData settings;
 extern QueueHandle_t stratumMessageQueueHandle;
-extern QueueHandle_t appMessageQueueHandle;
+extern const char* infoMessageColor;
 
 #define TEMP_BUFFER_SIZE 2048
 
-WebServer server(80);
+PlainWebServer server(80);
 PlainWebSocket webSocket(81);
 
 static char temp[TEMP_BUFFER_SIZE];
@@ -49,7 +56,7 @@ static char temp[TEMP_BUFFER_SIZE];
 static const char trueString[] = "true";
 static const char falseString[] = "false";
 
-#define SEND_PAGE_HEADER server.sendContent_P(pageHeader);sprintf(temp, PSTR(pageHeader1), (settings.webTheme == 1 ? "dark-mode" : ""), MINING_HARDWARE_VERSION_HEX, (settings.enableLogViewer ? "" : " noshow"));server.sendContent(temp);
+#define SEND_PAGE_HEADER server.sendContent_P(pageHeader);sprintf(temp, PSTR(pageHeader1), (settings.webTheme == 1 ? "dark-mode" : ""), (settings.enableLogViewer ? "" : " noshow"));server.sendContent(temp);
 #define SEND_PAGE_FOOTER server.sendContent_P(pageFooter);
 
 
@@ -61,7 +68,7 @@ char jwtKey[32];
 
 CustomJWT jwt(jwtKey, jwtHeader, sizeof(jwtHeader), jwtPayload, sizeof(jwtPayload), jwtSignature, sizeof(jwtSignature), jwtOut, sizeof(jwtOut));
 
-const char* headersToCollect[] = { "Cookie" };
+const char* headersToCollect[] = { "Cookie", "If-None-Match", "Accept-Encoding" };
 
 void addToWebLog(const char* logMessage, size_t length) {
   webSocket.broadcast(logMessage, length);
@@ -79,6 +86,11 @@ void addToWebLog(String& logMessage) {
   webSocket.broadcast(logMessage);
 }
 
+// Let status channel subscribers know a new snapshot is ready
+void notifyStatusSubscribers() {
+  webSocket.statusPublished();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Clear out miner statistics
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +113,7 @@ void submitJob(const char* jobId, uint32_t timestamp, uint32_t nonce, const char
   
   //submit(jobId, extraNonce2, hb->timestamp, hb->nonce);
   jobSubmitQueueEntry qe;
+  memset(&qe, 0, sizeof(qe));
 
   strncpy(qe.jobId, jobId, MAX_JOB_ID_LENGTH);
   strncpy(qe.extraNonce2, extraNonce2, 20);
@@ -120,92 +133,6 @@ void generateRandomJWTKey() {
   jwtKey[sizeof(jwtKey) - 1] = '\0';
 }
 
-char* escape_html_safe(const char* input, size_t max_len) {
-  // Handle NULL input
-  if (input == NULL) {
-    char* empty = (char*)malloc(1);
-    if (empty != NULL) {
-      empty[0] = '\0';
-    }
-    return empty;
-  }
-
-  // Calculate the length of the output string
-  size_t length = 0;
-  const char* ptr = input;
-  size_t current_len = 0;
-  while (*ptr && current_len < max_len) {
-    switch (*ptr) {
-      case '&':
-        length += 5;  // &amp;
-        break;
-      case '<':
-        length += 4;  // &lt;
-        break;
-      case '>':
-        length += 4;  // &gt;
-        break;
-      case '"':
-        length += 6;  // &quot;
-        break;
-      case '\'':
-        length += 5;  // &#39;
-        break;
-      default:
-        length += 1;
-        break;
-    }
-    ptr++;
-    current_len++;
-  }
-
-  // Allocate memory for the escaped string
-  char* escaped = (char*)malloc(length + 1);
-  if (escaped == NULL) {
-    return NULL;  // Memory allocation failed
-  }
-
-  // Fill the escaped string
-  char* dest = escaped;
-  ptr = input;
-  current_len = 0;
-  while (*ptr && current_len < max_len) {
-    switch (*ptr) {
-      case '&':
-        strcpy(dest, "&amp;");
-        dest += 5;
-        break;
-      case '<':
-        strcpy(dest, "&lt;");
-        dest += 4;
-        break;
-      case '>':
-        strcpy(dest, "&gt;");
-        dest += 4;
-        break;
-      case '"':
-        strcpy(dest, "&quot;");
-        dest += 6;
-        break;
-      case '\'':
-        strcpy(dest, "&#39;");
-        dest += 5;
-        break;
-      default:
-        *dest = *ptr;
-        dest += 1;
-        break;
-    }
-    ptr++;
-    current_len++;
-  }
-
-  // Null-terminate the escaped string
-  *dest = '\0';
-
-  return escaped;
-}
-
 String getCookie(const char* cookieName) {
   String cookieValue = "";
   if (server.hasHeader("Cookie")) {  // Check if the "Cookie" header is present in the request
@@ -282,637 +209,82 @@ void handleRoot() {
   }
 }
 
-void showConfigScreen(const char* messages) {
-
-  char versionString[20];
-  char fgColor[9];
-  char bgColor[9];
+static const char* configMessages;
+
+// Values for the placeholders in web/config.tmpl
+bool configTemplateValue(uint8_t field, TemplateValue& v) {
+  switch( field ) {
+    case CONFIG_FIELD_MESSAGES:           v.str = configMessages; break;
+    case CONFIG_FIELD_USERNAME:           v.str = settings.htaccessUser; v.maxLength = sizeof(settings.htaccessUser); break;
+    case CONFIG_FIELD_PASSWORD_SET:       v.num = strlen(settings.htaccessPassword) >= MIN_PASSWORD_LENGTH; break;
+    case CONFIG_FIELD_SSID:               v.str = settings.ssid; v.maxLength = sizeof(settings.ssid); break;
+    case CONFIG_FIELD_STATIC_IP:          v.num = settings.staticIp ? 1 : 0; break;
+    case CONFIG_FIELD_IP_ADDRESS:         v.num = settings.ipAddress; break;
+    case CONFIG_FIELD_GATEWAY:            v.num = settings.gateway; break;
+    case CONFIG_FIELD_SUBNET:             v.num = settings.subnet; break;
+    case CONFIG_FIELD_PRIMARY_DNS:        v.num = settings.primaryDNS; break;
+    case CONFIG_FIELD_SECONDARY_DNS:      v.num = settings.secondaryDNS; break;
+    case CONFIG_FIELD_POOL_URL:           v.str = settings.poolUrl; v.maxLength = sizeof(settings.poolUrl); break;
+    case CONFIG_FIELD_POOL_PORT:          v.num = settings.poolPort; break;
+    case CONFIG_FIELD_POOL_TLS:           v.num = settings.poolTls ? 1 : 0; break;
+    case CONFIG_FIELD_POOL_PIN:           v.str = settings.poolPin; v.maxLength = sizeof(settings.poolPin); break;
+    case CONFIG_FIELD_POOL_PASSWORD:      v.str = settings.poolPassword; v.maxLength = sizeof(settings.poolPassword); break;
+    case CONFIG_FIELD_WALLET:             v.str = settings.wallet; v.maxLength = sizeof(settings.wallet); break;
+    case CONFIG_FIELD_BACKUP_POOL_URL:    v.str = settings.backupPoolUrl; v.maxLength = sizeof(settings.backupPoolUrl); break;
+    case CONFIG_FIELD_BACKUP_POOL_PORT:   v.num = settings.backupPoolPort; break;
+    case CONFIG_FIELD_BACKUP_POOL_TLS:    v.num = settings.backupPoolTls ? 1 : 0; break;
+    case CONFIG_FIELD_BACKUP_POOL_PIN:    v.str = settings.backupPoolPin; v.maxLength = sizeof(settings.backupPoolPin); break;
+    case CONFIG_FIELD_BACKUP_POOL_PASSWORD: v.str = settings.backupPoolPassword; v.maxLength = sizeof(settings.backupPoolPassword); break;
+    case CONFIG_FIELD_BACKUP_WALLET:      v.str = settings.backupWallet; v.maxLength = sizeof(settings.backupWallet); break;
+    case CONFIG_FIELD_RANDOMIZE_TIMESTAMP: v.num = settings.randomizeTimestamp ? 1 : 0; break;
+    case CONFIG_FIELD_STRATUM_REPEATER:   v.num = settings.stratumRepeater ? 1 : 0; break;
+    case CONFIG_FIELD_CLUSTER_ROLE:       v.num = settings.clusterRole; break;
+    case CONFIG_FIELD_CLUSTER_UDP:        v.num = settings.clusterUdp ? 1 : 0; break;
+    case CONFIG_FIELD_CLUSTER_KEY:        v.str = settings.clusterKey; v.maxLength = sizeof(settings.clusterKey); break;
+    case CONFIG_FIELD_SCREEN_ROTATION:    v.num = settings.screenRotation; break;
+    case CONFIG_FIELD_SCREEN_BRIGHTNESS:  v.num = settings.screenBrightness; break;
+    case CONFIG_FIELD_INACTIVITY_TIMER:   v.num = settings.inactivityTimer; break;
+    case CONFIG_FIELD_INACTIVITY_BRIGHTNESS: v.num = settings.inactivityBrightness; break;
+    case CONFIG_FIELD_FOREGROUND_COLOR:   v.num = settings.foregroundColor; break;
+    case CONFIG_FIELD_BACKGROUND_COLOR:   v.num = settings.backgroundColor; break;
+    case CONFIG_FIELD_INVERT_COLORS:      v.num = settings.invertColors ? 1 : 0; break;
+    case CONFIG_FIELD_LED1RED:            v.num = settings.led1red; break;
+    case CONFIG_FIELD_LED1GREEN:          v.num = settings.led1green; break;
+    case CONFIG_FIELD_LED1BLUE:           v.num = settings.led1blue; break;
+    case CONFIG_FIELD_WEB_THEME:          v.num = settings.webTheme; break;
+    case CONFIG_FIELD_NTP_SERVER:         v.str = settings.ntpServer; v.maxLength = sizeof(settings.ntpServer); break;
+    case CONFIG_FIELD_UTC_OFFSET_HOURS:   v.num = settings.utcOffset / 3600; break;
+    case CONFIG_FIELD_UTC_OFFSET_MINUTES: v.num = abs((settings.utcOffset % 3600) / 60); break;
+    case CONFIG_FIELD_CLOCK24:            v.num = settings.clock24 ? 1 : 0; break;
+    case CONFIG_FIELD_CORE_ZERO_DISABLED: v.num = settings.coreZeroDisabled ? 1 : 0; break;
+    case CONFIG_FIELD_ENABLE_LOG_VIEWER:  v.num = settings.enableLogViewer ? 1 : 0; break;
+    case CONFIG_FIELD_STRATUM_CAPTURE:    v.num = settings.stratumCapture ? 1 : 0; break;
+    default:
+      return false;
+  }
+  return true;
+}
 
-  char* sOption = " SELECTED";  // Point option here for selected option
-  char* nsOption = "";          // and here for not selected
+void sendTemplateChunk(const char* data, size_t len) {
+  server.sendContent(data, len);
+}
 
-  char* selOptionPtrs[8];  // and use these pointers in sprintf
+void showConfigScreen(const char* messages) {
 
   server.setContentLength(CONTENT_LENGTH_UNKNOWN);
   server.send(200, "text/html", "");
 
-  char* username = escape_html_safe(settings.htaccessUser, sizeof(settings.htaccessUser));
-  char* ssid = escape_html_safe(settings.ssid, sizeof(settings.ssid));
-  char* wallet = escape_html_safe(settings.wallet, sizeof(settings.wallet));
-  char* poolUrl = escape_html_safe(settings.poolUrl, sizeof(settings.poolUrl));
-  char* poolPassword = escape_html_safe(settings.poolPassword, sizeof(settings.poolPassword));
-  char* ntpServer = escape_html_safe(settings.ntpServer, sizeof(settings.ntpServer));
-  char* backupWallet = escape_html_safe(settings.backupWallet, sizeof(settings.backupWallet));
-  char* backupPoolUrl = escape_html_safe(settings.backupPoolUrl, sizeof(settings.backupPoolUrl));
-  char* backupPoolPassword = escape_html_safe(settings.backupPoolPassword, sizeof(settings.backupPoolPassword));
-
-  // Send header
   SEND_PAGE_HEADER;
-  server.sendContent_P(configPageTitle);
-
-  // Display any messages
-  if (messages) {
-    snprintf(temp, TEMP_BUFFER_SIZE,
-             "<div class=\"c\"><div class=\"row message-area\">%s</div></div>", messages);
-    server.sendContent(temp);
-  }
-
-    // Show User Settings
-  snprintf(temp, TEMP_BUFFER_SIZE,
-           "<div class=\"c nbpad\">\
-  <div class=\"row\">\
-  <button class=\"accordion\">User Settings</button>\
-  <div class=\"panel\">\
-    <form id=\"frmUser\">\
-    <div class=\"row\">\
-      Username\
-      <input class=\"card w-100 lower\" id=\"user\" type=\"text\" name=\"username\" value=\"%s\" autocorrect=\"off\" autocapitalize=\"none\">\
-    </div>\
-    <div class=\"row\" style=\"position:relative\">\
-      Password\
-      <input class=\"card w-100 capsWatch\" id=\"password\" type=\"password\" name=\"password\" placeholder=\"Never shown\" data-caps-indicator=\"capsInd1\">\
-      <div id=\"capsInd1\" style=\"position:absolute;right:30px;top:-6px;color:red;display:none\">Caps Lock</div>\
-    </div>\
-    <div class=\"row hint\">\
-      Password must be between eight and 32 characters long and contain at least one number, one lowercase character, one uppercase character, and one special character.\
-    </div>\
-    <div class=\"row\" style=\"position:relative\">\
-      Confirm Password\
-      <input class=\"card w-100 capsWatch\" id=\"confirmPassword\" type=\"password\" name=\"confirmPassword\" data-caps-indicator=\"capsInd3\">\
-      <div id=\"capsInd3\" style=\"position:absolute;right:30px;top:-6px;color:red;display:none\">Caps Lock</div>\
-    </div>\
-    <div class=\"row\">\
-      <input id=\"btnUserUpdate\" class=\"btn\" type=\"button\" value=\"Update User\">\
-    </div>\
-    </form>\
-  </div><!--End panel//-->\
-  </div><!--End row//-->\
-  </div><!--End c//-->",
-           username);
-  server.sendContent(temp);
-
-  if( strlen(settings.htaccessPassword) >= MIN_PASSWORD_LENGTH ) {
-    // Network settings
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">Network Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmNetwork\">\
-    <div class=\"row\">\
-      WiFi SSID\
-      <div class=\"rel\">\
-        <input class=\"card w-100\" id=\"ssid\" type=\"text\" name=\"ssid\" value=\"%s\" autocorrect=\"off\" autocapitalize=\"none\">\
-        <input type=\"button\" id=\"btnScanNetworks\" class=\"btn inside-button\" value=\"Scan\">\
-      </div>\
-    </div>\
-    <div class=\"row\" style=\"position:relative\">\
-      WiFi Password\
-      <input class=\"card w-100 capsWatch\" id=\"ssidPassword\" type=\"password\" name=\"ssidPassword\" autocomplete=\"off\" placeholder=\"Never shown\" data-caps-indicator=\"capsInd2\">\
-      <div id=\"capsInd2\" style=\"position:absolute;right:30px;top:-6px;color:red;display:none\">Caps Lock</div>\
-      <input type=\"checkbox\" id=\"showWifiPassword\">&nbsp;<span style=\"font-size:.8em;margin-left:5px;\">Show Password</span>\
-    </div>", ssid);
-    server.sendContent(temp);
-
-    if (settings.staticIp) {
-      selOptionPtrs[0] = nsOption;
-      selOptionPtrs[1] = sOption;
-    } else {
-      selOptionPtrs[0] = sOption;
-      selOptionPtrs[1] = nsOption;
-    }
-
-    // Use Static IP
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      Static IP Address\
-      <select class=\"card w-100\" name=\"staticIp\" id=\"staticIp\">\
-      <option value=\"false\"%s>No</value>\
-      <option value=\"true\"%s>Yes</value>\
-      </select>\
-    </div>", selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-    
-    IPAddress ip1(settings.ipAddress), ip2(settings.gateway);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div id=\"staticNetworkInfo\"><div class=\"row\">\
-      IP Address\
-      <input class=\"card w-100\" id=\"ipAddress\" type=\"text\" name=\"ipAddress\" value=\"%s\">\
-    </div>\
-    <div class=\"row\">\
-      Gateway\
-      <input class=\"card w-100\" id=\"gateway\" type=\"text\" name=\"gateway\" value=\"%s\">\
-    </div>", ip1.toString().c_str(), ip2.toString().c_str());
-    server.sendContent(temp);
-
-    
-    IPAddress ip3(settings.subnet), ip4(settings.primaryDNS), ip5(settings.secondaryDNS);
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"row\">\
-      Subnet\
-      <input class=\"card w-100\" id=\"subnet\" type=\"text\" name=\"subnet\" value=\"%s\">\
-    </div>\
-    <div class=\"row\">\
-      Primary DNS\
-      <input class=\"card w-100\" id=\"primaryDNS\" type=\"text\" name=\"primaryDNS\" value=\"%s\">\
-    </div>\
-    <div class=\"row\">\
-      Secondary DNS\
-      <input class=\"card w-100\" id=\"secondaryDNS\" type=\"text\" name=\"secondaryDNS\" value=\"%s\">\
-    </div>\
-    </div>\
-    <!--End static network section-->\
-    <div class=\"row\">\
-      <input class=\"btn\" id=\"btnNetworkUpdate\" type=\"button\" value=\"Update Network Settings\">\
-    </div>\
-    </form>\
-    </div><!--End panel//-->\
-    </div><!--End row//-->\
-    </div><!--End c//-->", ip3.toString().c_str(), ip4.toString().c_str(), ip5.toString().c_str());
-    
-    server.sendContent(temp);
-
-
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">Mining Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmMining\">\
-    <div class=\"tabs\">\
-    <input type=\"radio\" id=\"tab1\" name=\"tabs\" checked>\
-    <label for=\"tab1\">Primary</label>\
-    <input type=\"radio\" id=\"tab2\" name=\"tabs\">\
-    <label for=\"tab2\">Backup</label>\
-    <div class=\"tab-content content1\">\
-    <div class=\"row tab-header\">Primary Pool Settings</div>\
-    <div class=\"row\">\
-      Mining Pool Server\
-      <input class=\"card w-100\" id=\"poolUrl\" type=\"text\" name=\"poolUrl\" value=\"%s\"> \
-    </div>\
-    <div class=\"row\">\
-      Mining Pool Port\
-      <input class=\"card w-100\" id=\"poolPort\" type=\"text\" name=\"poolPort\" value=\"%d\">\
-    </div>\
-    <div class=\"row\">\
-      Mining Pool Password\
-      <input class=\"card w-100\" id=\"poolPassword\" type=\"text\" name=\"poolPassword\" value=\"%s\">\
-    </div>\
-    <div class=\"row\">\
-      Wallet Address\
-      <div class=\"rel\">\
-        <input class=\"card w-100\" id=\"wallet\" type=\"text\" name=\"wallet\" value=\"%s\">\
-        <input type=\"button\" id=\"btnValidateWallet\" class=\"btn inside-button\" value=\"Validate\">\
-      </div>\
-    </div>\
-    </div><!--End tab 1//-->",
-            poolUrl, settings.poolPort, poolPassword, wallet);
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"tab-content content2\">\
-    <div class=\"row tab-header\">Backup Pool Settings</div>\
-    <div class=\"row\">\
-      Mining Pool Server\
-      <input class=\"card w-100\" id=\"backupPoolUrl\" type=\"text\" name=\"backupPoolUrl\" value=\"%s\"> \
-    </div>\
-    <div class=\"row\">\
-      Mining Pool Port\
-      <input class=\"card w-100\" id=\"backupPoolPort\" type=\"text\" name=\"backupPoolPort\" value=\"%d\">\
-    </div>\
-    <div class=\"row\">\
-      Mining Pool Password\
-      <input class=\"card w-100\" id=\"backupPoolPassword\" type=\"text\" name=\"backupPoolPassword\" value=\"%s\">\
-    </div>\
-    <div class=\"row\">\
-      Wallet Address\
-      <div class=\"rel\">\
-        <input class=\"card w-100\" id=\"backupWallet\" type=\"text\" name=\"backupWallet\" value=\"%s\">\
-        <input type=\"button\" id=\"btnValidateBackupWallet\" class=\"btn inside-button\" value=\"Validate\">\
-      </div>\
-    </div>\
-    </div><!--End tab 2//-->\
-    </div><!--End tabs//-->",
-            backupPoolUrl, settings.backupPoolPort, backupPoolPassword, backupWallet);
-    server.sendContent(temp);    
-
-    if (settings.randomizeTimestamp) {
-      selOptionPtrs[0] = nsOption;
-      selOptionPtrs[1] = sOption;
-    } else {
-      selOptionPtrs[0] = sOption;
-      selOptionPtrs[1] = nsOption;
-    }
-
-    // Randomize Timestamps
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Randomize Block Timestamps\
-      <select class=\"card w-100\" name=\"randomizeTimestamp\" id=\"randomizeTimestamp\">\
-      <option value=\"false\"%s>No</value>\
-      <option value=\"true\"%s>Yes</value>\
-      </select>\
-    </div>",
-            selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      <input class=\"btn\" id=\"btnMiningUpdate\" type=\"button\" value=\"Update Mining Settings\">\
-    </div>\
-    </form>\
-    </div><!--End panel//-->\
-    </div><!--End row//-->\
-    </div><!--End c//-->");
-    server.sendContent(temp);
-
-
-
-    // Items below may depend on device
-
-  #if defined(ESP32_2432S028) || defined(ESP32_2432S024)
-
-    uint8_t srArray[] = { 0, 1, 2, 3 };
-    for (int8_t i = 0; i < 4; i++) {
-      if (settings.screenRotation == srArray[i]) {
-        selOptionPtrs[i] = sOption;
-      } else {
-        selOptionPtrs[i] = nsOption;
-      }
-    }
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">Display Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmDisplay\" onsubmit=\"return false;\">");
-
-    server.sendContent(temp);
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"row\">\
-      Screen Rotation\
-      <select class=\"card w-100\" name=\"screenRotation\" id=\"screenRotation\">\
-      <option value=\"0\"%s>Portrait: Cable at bottom</value>\
-      <option value=\"1\"%s>Landscape: Cable at right</value>\
-      <option value=\"2\"%s>Portrait: Cable at top</value>\
-      <option value=\"3\"%s>Landscape: Cable at left</value>\
-      </select>\
-    </div>",
-            selOptionPtrs[0], selOptionPtrs[1], selOptionPtrs[2], selOptionPtrs[3]);
-    server.sendContent(temp);
-
-    // Then set the selected option
-    uint8_t optArray[] = { 0, 24, 64, 128, 192, 255 };
-    for (int8_t i = 1; i < 6; i++) {
-      if (settings.screenBrightness == optArray[i]) {
-        selOptionPtrs[i] = sOption;
-      } else {
-        selOptionPtrs[i] = nsOption;
-      }
-    }
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Screen Brightness\
-      <select class=\"card w-100\" name=\"screenBrightness\" id=\"screenBrightness\">\
-      <option value=\"24\"%s>10%%</option>\
-      <option value=\"64\"%s>25%%</option>\
-      <option value=\"128\"%s>50%%</option>\
-      <option value=\"192\"%s>75%%</option>\
-      <option value=\"255\"%s>100%</option>\
-      </select>\
-    </div>",
-            selOptionPtrs[1], selOptionPtrs[2], selOptionPtrs[3], selOptionPtrs[4], selOptionPtrs[5]);
-    server.sendContent(temp);
-
-    uint32_t optArray1[] = { 0, 30000, 60000, 120000, 300000, 600000, 1800000 };
-    for (int8_t i = 0; i < 7; i++) {
-      if (settings.inactivityTimer == optArray1[i]) {
-        selOptionPtrs[i] = sOption;
-      } else {
-        selOptionPtrs[i] = nsOption;
-      }
-    }
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Screen Inactivity Timer\
-      <select id=\"inactivityTimer\" class=\"card w-100\" name=\"inactivityTimer\">\
-      <option value=\"0\"%s>No timer</option>\
-      <option value=\"30000\"%s>30 seconds</option>\
-      <option value=\"60000\"%s>1 minute</option>\
-      <option value=\"120000\"%s>2 minutes</option>\
-      <option value=\"300000\"%s>5 minutes</option>\
-      <option value=\"600000\"%s>10 minutes</option>\
-      <option value=\"1800000\"%s>30 minutes</option>\
-      </select>\
-    </div>",
-            selOptionPtrs[0], selOptionPtrs[1], selOptionPtrs[2], selOptionPtrs[3], selOptionPtrs[4], selOptionPtrs[5], selOptionPtrs[6]);
-    server.sendContent(temp);
-
-    for (int8_t i = 0; i < 6; i++) {
-      if (settings.inactivityBrightness == optArray[i]) {
-        selOptionPtrs[i] = sOption;
-      } else {
-        selOptionPtrs[i] = nsOption;
-      }
-    }
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Screen Inactivity Brightness\
-      <select class=\"card w-100\" name=\"inactivityBrightness\" id=\"inactivityBrightness\">\
-      <option value=\"0\"%s>Screen off</option>\
-      <option value=\"24\"%s>10%%</option>\
-      <option value=\"64\"%s>25%%</option>\
-      <option value=\"128\"%s>50%%</option>\
-      <option value=\"192\"%s>75%%</option>\
-      <option value=\"255\"%s>100%</option>\
-      </select>\
-    </div>",
-            selOptionPtrs[0], selOptionPtrs[1], selOptionPtrs[2], selOptionPtrs[3], selOptionPtrs[4], selOptionPtrs[5]);
-    server.sendContent(temp);
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      Foreground Color\
-      <input class=\"w-100 colorbox\" id=\"foregroundColor\" type=\"color\" name=\"foregroundColor\" value=\"%s\">\
-      <a href=\"#\" onclick=\"setDefaultForegroundColor();return false;\">Set default</a>\
-      </div>\
-      <div class=\"row\">\
-      Background Color\
-      <input class=\"w-100 colorbox\" id=\"backgroundColor\" type=\"color\" name=\"backgroundColor\" value=\"%s\">\
-      <a href=\"#\" onclick=\"setDefaultBackgroundColor();return false;\">Set default</a>\
-      </div>",    
-        colorToCode(fgColor, settings.foregroundColor), colorToCode(bgColor, settings.backgroundColor));
-    server.sendContent(temp);      
-
-    if (settings.invertColors) {
-      selOptionPtrs[0] = nsOption;
-      selOptionPtrs[1] = sOption;
-    } else {
-      selOptionPtrs[0] = sOption;
-      selOptionPtrs[1] = nsOption;
-    }
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Invert Colors\
-      <select class=\"card w-100\" name=\"invertColors\" id=\"invertColors\">\
-      <option value=\"false\"%s>No</option>\
-      <option value=\"true\"%s>Yes</option>\
-      </select>\
-    </div>",
-            selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      <input class=\"btn\" id=\"btnDisplayUpdate\" type=\"button\" value=\"Update Display Settings\">\
-    </div>\
-    </form>\
-    </div><!--End panel//-->\
-    </div><!--End row//-->\
-    </div><!--End c//-->");
-    server.sendContent(temp);
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">LED Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmLED\" onsubmit=\"return false;\">");
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE, 
-      "<div class=\"row\">\
-      LED Red Level\
-      <input class=\"w-100\" id=\"led1red\" type=\"range\" name=\"led1red\" min=\"0\" max=\"255\" value=\"%d\">\
-      </div>\
-      <div class=\"row\">\
-      LED Green Level\
-      <input class=\"w-100\" id=\"led1green\" type=\"range\" name=\"led1green\" min=\"0\" max=\"255\" value=\"%d\">\
-      </div>\
-      <div class=\"row\">\
-      LED Blue Level\
-      <input class=\"w-100\" id=\"led1blue\" type=\"range\" name=\"led1blue\" min=\"0\" max=\"255\" value=\"%d\">\
-      </div>"      
-    , settings.led1red, settings.led1green, settings.led1blue);
-
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      <input class=\"btn\" id=\"btnLEDUpdate\" type=\"button\" value=\"Update LED Settings\">\
-    </div>\
-    </form>\
-    </div><!--End panel//-->\
-    </div><!--End row//-->\
-    </div><!--End c//-->");
-    server.sendContent(temp);
-
-  #endif // End of ESP28 settings
-
-
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">General Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmGeneral\" onsubmit=\"return false;\">");
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"row\">Web Theme\
-    <select class=\"card w-100\" name=\"webTheme\" id=\"webTheme\">\
-    <option value=\"0\"%s>Standard</value>\
-    <option value=\"1\"%s>Dark</value>\
-    </select>\
-    </div>", (settings.webTheme == 0 ? sOption : nsOption), (settings.webTheme == 1 ? sOption : nsOption));
-    server.sendContent(temp);
-
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      Time Server (NTP)\
-      <input class=\"card w-100\" id=\"ntpServer\" type=\"text\" name=\"ntpServer\" value=\"%s\" placeholder=\"Time server\">\
-      </div>", ntpServer
-    );
-    server.sendContent(temp);
-
-    int32_t offsetHours = settings.utcOffset / 3600;
-    int32_t offsetMinutes = (settings.utcOffset % 3600) / 60;
-    if( offsetMinutes < 0 ) {
-      offsetMinutes *= -1;
-    }
 
-    //Serial.printf("%d %d\n", offsetHours, offsetMinutes);
+  // Escapes straight into temp; the server packs that into full segments
+  configMessages = messages;
+  TemplateRenderer r(temp, TEMP_BUFFER_SIZE, sendTemplateChunk);
+  r.render(configTemplate, configTemplateLength, configTemplateValue);
+  r.finish();
+  configMessages = NULL;
 
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      <div class=\"w-100\">Timezone Offset</div>\
-      <select class=\"card\" name=\"utcOffsetHours\" id=\"utcOffsetHours\" style=\"margin-right:10px\">");
-    server.sendContent(temp);
-    
-    for(int16_t i = -11; i < 15; i++) {
-      sprintf(temp, "<option value=\"%d\"%s>%d hours</option>", i, (i == offsetHours ? sOption :nsOption), i);
-      server.sendContent(temp);
-    }
-
-    sprintf(temp, "</select><select class=\"card\" name=\"utcOffsetMinutes\" id=\"utcOffsetMinutes\">\
-      <option value=\"0\"%s>0 minutes</option>\
-      <option value=\"30\"%s>30 minutes</option>\
-      <option value=\"45\"%s>45 minutes</option>\
-      </select></div>", (0 == offsetMinutes ? sOption :nsOption), (30 == offsetMinutes ? sOption :nsOption), (45 == offsetMinutes ? sOption :nsOption));
-
-    server.sendContent(temp);
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      Clock Format\
-      <select class=\"card w-100\" id=\"clock24\" name=\"clock24\">\
-      <option value=\"false\"%s>12-hour</option>\
-      <option value=\"true\"%s>24-hour</option>\
-      </select>\
-      </div>", (settings.clock24 ? nsOption : sOption), (settings.clock24 ? sOption : nsOption)
-    );
-    server.sendContent(temp);
-
-    sprintf(temp, 
-      "<div class=\"row\">\
-      <input class=\"btn\" id=\"btnGeneralUpdate\" type=\"button\" value=\"Update General Settings\">\
-      </div>\
-      </form>\
-      </div><!--End panel//-->\
-      </div><!--End row//-->\
-      </div><!--End c//-->"
-    );
-    server.sendContent(temp);
-
-    // Advanced settings
-    snprintf(temp, TEMP_BUFFER_SIZE,
-    "<div class=\"c nbpad\">\
-    <div class=\"row\">\
-    <button class=\"accordion\">Advanced Settings</button>\
-    <div class=\"panel\">\
-    <form id=\"frmAdvanced\" onsubmit=\"return false;\">");
-    server.sendContent(temp);
-
-
-    // Disable Core 0
-  #ifndef SINGLE_CORE
-   if (settings.coreZeroDisabled) {
-      selOptionPtrs[0] = nsOption;
-      selOptionPtrs[1] = sOption;
-    } else {
-      selOptionPtrs[0] = sOption;
-      selOptionPtrs[1] = nsOption;
-    }
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Reduce Mining CPU Load\
-      <select class=\"card w-100\" name=\"coreZeroDisabled\" id=\"coreZeroDisabled\">\
-      <option value=\"false\"%s>No</value>\
-      <option value=\"true\"%s>Yes</value>\
-      </select>\
-    </div>\
-    <div class=\"row hint\">\
-     Reduces mining impact on the CPU, enabling better performance for non-mining tasks at the expense of hash rate.\
-    </div>",  selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-  #endif
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-      "<div class=\"row\">\
-      Clear Statistics\
-      <input type=\"text\" maxlength=\"4\" class=\"card w-100\" name=\"clearStats\" id=\"clearStats\">\
-    </div>\
-    <div class=\"row hint\">\
-     To clear miner statistics, type \"YES\" in the box above and update the advanced settings.\
-    </div>",  selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-
-   if (settings.enableLogViewer) {
-      selOptionPtrs[0] = nsOption;
-      selOptionPtrs[1] = sOption;
-    } else {
-      selOptionPtrs[0] = sOption;
-      selOptionPtrs[1] = nsOption;
-    }
-
-    snprintf(temp, TEMP_BUFFER_SIZE,
-            "<div class=\"row\">\
-      Enable Log Viewer\
-      <select class=\"card w-100\" name=\"enableLogViewer\" id=\"enableLogViewer\">\
-      <option value=\"false\"%s>No</value>\
-      <option value=\"true\"%s>Yes</value>\
-      </select>\
-    </div>\
-    <div class=\"row hint\">\
-     Allows you to see communication logs in in real time. Logs may contain wallets and pool passwords. \
-    </div>",  selOptionPtrs[0], selOptionPtrs[1]);
-    server.sendContent(temp);
-
-
-
-    sprintf(temp, 
-      "<div class=\"row\">\
-      <input class=\"btn\" id=\"btnAdvancedUpdate\" type=\"button\" value=\"Update Advanced Settings\">\
-      </div>\
-      </form>\
-      </div><!--End panel//-->\
-      </div><!--End row//-->\
-      </div><!--End c//-->"
-    );
-    server.sendContent(temp);
-
-
-
-  } // end if good password set
-
-
-  server.sendContent_P(sha256Javascript);
   server.sendContent_P(configPageJavascript);
   SEND_PAGE_FOOTER;
-
-
-  if (username) {
-    free(username);
-  }
-  if (ssid) {
-    free(ssid);
-  }
-  if (poolUrl) {
-    free(poolUrl);
-  }
-  if (poolPassword) {
-    free(poolPassword);
-  }
-  if (wallet) {
-    free(wallet);
-  }
-  if( backupPoolUrl ) {
-    free(backupPoolUrl);
-  }
-  if( backupPoolPassword )  {
-    free(backupPoolPassword);
-  }
-  if( backupWallet ) {
-    free(backupWallet);
-  }
-  if(ntpServer) {
-    free(ntpServer);
-  }
 }
 
 void handleConfigGet() {
@@ -942,6 +314,22 @@ void sendAjaxResponse(bool successful, bool changesApplied, bool loggedIn, const
   server.send(200, "application/json", temp);
 }
 
+// Empty, or the 64 hex digits of a SHA-256
+static bool validPoolPin(const String& pin) {
+  if( pin.length() == 0 ) {
+    return true;
+  }
+  if( pin.length() != MAX_POOL_PIN_LENGTH ) {
+    return false;
+  }
+  for( size_t i = 0; i < pin.length(); i++ ) {
+    if( ! isxdigit(pin[i]) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void handleConfigPost() {
 
   // Make sure the user is logged in
@@ -950,10 +338,6 @@ void handleConfigPost() {
     return;
   }
 
-  // Used to send messages back to main application
-  ApplicationMessage am;
-  uint16_t mainAction = 0;
-
   // Keep them guessing and keep them logged in
   refreshLoginCookie();
 
@@ -962,12 +346,12 @@ void handleConfigPost() {
   memcpy(&newSettings, &settings, sizeof(SetupData));
 
   bool error = false;
-  //bool rebootRequired = false;
-  //bool networkReconnectRequired = false;
-  //bool redrawRequired = false;
-  bool stratumReconnectRequired = false;
   bool changesMade = false;
 
+  // What used to force a reconnect, to report what the diff saved
+  bool poolSettingsChanged = false;
+  bool networkSettingsChanged = false;
+
   char messages[200] = "";
 
   String section = server.arg("section");
@@ -984,6 +368,7 @@ void handleConfigPost() {
     String coreZeroDisabled = server.arg("coreZeroDisabled");
     String clStats = server.arg("clearStats");
     String enableLogViewer = server.arg("enableLogViewer");
+    String stratumCapture = server.arg("stratumCapture");
 
     bool bv = false;
     
@@ -993,6 +378,14 @@ void handleConfigPost() {
       changesMade = true;
     }
 
+    if( stratumCapture.length() ) {
+      bv = strcmp(stratumCapture.c_str(), "true") == 0;
+      if( settings.stratumCapture != bv ) {
+        newSettings.stratumCapture = bv;
+        changesMade = true;
+      }
+    }
+
     if( clStats.equalsIgnoreCase("YES") ) {
       clearMinerStats();
       changesMade = true;
@@ -1048,13 +441,23 @@ void handleConfigPost() {
     String backupPoolPort = server.arg("backupPoolPort");
     String backupWallet = server.arg("backupWallet");
     String backupPoolPassword = server.arg("backupPoolPassword");
+    String poolTls = server.arg("poolTls");
+    String poolPin = server.arg("poolPin");
+    String backupPoolTls = server.arg("backupPoolTls");
+    String backupPoolPin = server.arg("backupPoolPin");
+    String stratumRepeater = server.arg("stratumRepeater");
+    String clusterRole = server.arg("clusterRole");
+    String clusterUdp = server.arg("clusterUdp");
+    String clusterKey = server.arg("clusterKey");
+    poolPin.trim();
+    backupPoolPin.trim();
 
     if (!poolUrl || poolUrl.length() == 0) {
       strcpy(messages, "A valid pool server is required.");
       error = true;
     } else if (strcmp(settings.poolUrl, poolUrl.c_str())) {
       strncpy(newSettings.poolUrl, poolUrl.c_str(), MAX_POOL_URL_LENGTH);
-      stratumReconnectRequired = true;
+      poolSettingsChanged = true;
       changesMade = true;
     }
 
@@ -1069,7 +472,7 @@ void handleConfigPost() {
         error = true;
       } else if (settings.poolPort != port) {
         newSettings.poolPort = port;
-        stratumReconnectRequired = true;
+        poolSettingsChanged = true;
         changesMade = true;
       }
     }
@@ -1080,7 +483,7 @@ void handleConfigPost() {
         error = true;
       } else if (strcmp(settings.wallet, wallet.c_str()) ) {
         strncpy(newSettings.wallet, wallet.c_str(), MAX_WALLET_LENGTH);
-        stratumReconnectRequired = true;
+        poolSettingsChanged = true;
         changesMade = true;
       }
     }
@@ -1092,7 +495,7 @@ void handleConfigPost() {
         error = true;
       } else if( strcmp(settings.poolPassword, poolPassword.c_str()) ) {
         strncpy(newSettings.poolPassword, poolPassword.c_str(), MAX_POOL_PASSWORD_LENGTH);
-        stratumReconnectRequired = true;
+        poolSettingsChanged = true;
         changesMade = true;
       }
     }
@@ -1110,7 +513,7 @@ void handleConfigPost() {
         if( backupPort < 0 || backupPort > 65535 ) {
           strcpy(messages, "Backup mining pool port out of range.");
           error = true;
-        } else {
+        } else if( settings.backupPoolPort != backupPort ) {
           newSettings.backupPoolPort = backupPort;
           changesMade = true;
         }
@@ -1131,6 +534,27 @@ void handleConfigPost() {
       }
     }    
 
+    if( ! error ) {
+      if( ! validPoolPin(poolPin) || ! validPoolPin(backupPoolPin) ) {
+        strcpy(messages, "A TLS key pin must be 64 hex digits, or left empty.");
+        error = true;
+      } else {
+        bool tls = strcmp(poolTls.c_str(), "true") == 0;
+        bool backupTls = strcmp(backupPoolTls.c_str(), "true") == 0;
+        if( settings.poolTls != tls || strcmp(settings.poolPin, poolPin.c_str()) ) {
+          newSettings.poolTls = tls;
+          safeStrnCpy(newSettings.poolPin, poolPin.c_str(), MAX_POOL_PIN_LENGTH + 1);
+          poolSettingsChanged = true;
+          changesMade = true;
+        }
+        if( settings.backupPoolTls != backupTls || strcmp(settings.backupPoolPin, backupPoolPin.c_str()) ) {
+          newSettings.backupPoolTls = backupTls;
+          safeStrnCpy(newSettings.backupPoolPin, backupPoolPin.c_str(), MAX_POOL_PIN_LENGTH + 1);
+          changesMade = true;
+        }
+      }
+    }
+
     if (!error) {
       if (!randomizeTimestamp || randomizeTimestamp.length() == 0) {
         strcpy(messages, "Randomize timestamps setting is missing.");
@@ -1147,6 +571,43 @@ void handleConfigPost() {
       }
     }
 
+    // The server task picks this up on its next pass; the pool connection isn't touched
+    if( ! error && stratumRepeater.length() ) {
+      bool repeater = strcmp(stratumRepeater.c_str(), "true") == 0;
+      if( settings.stratumRepeater != repeater ) {
+        newSettings.stratumRepeater = repeater;
+        changesMade = true;
+      }
+    }
+
+    // Likewise the cluster task; a follower's stratum task lets go of the pool by itself
+    if( ! error && clusterRole.length() ) {
+      int role = clusterRole.toInt();
+      if( role < CLUSTER_ROLE_OFF || role > CLUSTER_ROLE_FOLLOWER ) {
+        strcpy(messages, "Invalid cluster role.");
+        error = true;
+      } else if( settings.clusterRole != role ) {
+        newSettings.clusterRole = role;
+        changesMade = true;
+      }
+    }
+    if( ! error && clusterUdp.length() ) {
+      bool useUdp = strcmp(clusterUdp.c_str(), "true") == 0;
+      if( settings.clusterUdp != useUdp ) {
+        newSettings.clusterUdp = useUdp;
+        changesMade = true;
+      }
+    }
+    if( ! error && server.hasArg("clusterKey") ) {
+      if( clusterKey.length() > MAX_CLUSTER_KEY_LENGTH ) {
+        strcpy(messages, "The cluster key can be at most 32 characters.");
+        error = true;
+      } else if( strcmp(settings.clusterKey, clusterKey.c_str()) ) {
+        safeStrnCpy(newSettings.clusterKey, clusterKey.c_str(), MAX_CLUSTER_KEY_LENGTH + 1);
+        changesMade = true;
+      }
+    }
+
   } else if (strcmp(section.c_str(), "network") == 0) {
 
     String ssid = server.arg("ssid");
@@ -1279,10 +740,7 @@ void handleConfigPost() {
       changesMade = true;
     }
 
-    if(! error && changesMade ) {
-      mainAction |= MAIN_ACTION_NETWORK_CONNECT;
-      mainAction |= MAIN_ACTION_GOTO_MAIN_SCREEN;
-    }
+    networkSettingsChanged = changesMade;
 
   } else if (strcmp(section.c_str(), "display") == 0) {
 
@@ -1306,9 +764,6 @@ void handleConfigPost() {
         }
         if (settings.screenRotation != sr) {
           newSettings.screenRotation = sr;
-          mainAction |= MAIN_ACTION_REDRAW;
-          mainAction |= MAIN_ACTION_SET_ROTATION;
-          //redrawRequired = true;
           changesMade = true;
         }
       }
@@ -1324,7 +779,6 @@ void handleConfigPost() {
         if (sb != settings.screenBrightness) {
           newSettings.screenBrightness = sb;
           changesMade = true;
-          mainAction |= MAIN_ACTION_SET_BRIGHTNESS;
         }
       }
     }
@@ -1365,7 +819,6 @@ void handleConfigPost() {
         if( fc != settings.foregroundColor || bc != settings.backgroundColor ) {
           newSettings.foregroundColor = fc;
           newSettings.backgroundColor = bc;
-          mainAction |= MAIN_ACTION_REDRAW;
           changesMade = true;
         }
       }
@@ -1376,7 +829,6 @@ void handleConfigPost() {
         bool ivc = (bool) (strcmp(invertColors.c_str(), "true") == 0);
         if( ivc != settings.invertColors ) {
           newSettings.invertColors = ivc;
-          mainAction |= MAIN_ACTION_REDRAW;
           changesMade = true;
         }
       }
@@ -1438,7 +890,6 @@ void handleConfigPost() {
         newSettings.led1blue = led1blue.toInt();
         if( newSettings.led1red != settings.led1red || newSettings.led1blue != settings.led1blue || newSettings.led1green != settings.led1green ) {
           changesMade = true;
-          mainAction |= MAIN_ACTION_LED1_SET;
         }
       }
     }
@@ -1450,10 +901,10 @@ void handleConfigPost() {
   if (!error) {
 
     if (changesMade) {
-      // Tell stratum to stop its activities
-      if (stratumReconnectRequired) {
-        requestStratumReconnect();
-      }
+      // Work out the least disruptive way to put the new values into effect
+      SettingsChange change;
+      classifySettingsChange(&settings, &newSettings, &change);
+
       // Copy over the new settings
       memcpy(&settings, &newSettings, sizeof(SetupData));
 
@@ -1461,10 +912,28 @@ void handleConfigPost() {
       settings.currentMode = MODE_INSTALL_COMPLETE;
       saveSettings();
 
-      // If we updated the network settings, then reconnect and go to the main screen
-      if (mainAction) {
-        am.action = mainAction;
-        xQueueSend(appMessageQueueHandle, &am, pdMS_TO_TICKS(10));
+      // Stratum reads the new pool settings when it picks this up
+      if (change.stratumActions) {
+        requestStratumSettingsChange(change.stratumActions);
+      }
+
+      // Display, LED and network changes are applied by the main task
+      if (change.mainActions) {
+        postApplicationActions(change.mainActions);
+      }
+
+      uint32_t avoided = 0;
+      if (networkSettingsChanged && !(change.mainActions & MAIN_ACTION_NETWORK_CONNECT)) {
+        avoided += DOWNTIME_NETWORK_CONNECT_MS;
+      }
+      if (poolSettingsChanged && !(change.stratumActions & STRATUM_ACTION_RECONNECT)) {
+        avoided += DOWNTIME_STRATUM_RECONNECT_MS;
+      }
+      dbg("Settings: %d fields changed, actions %04x/%02x, ~%lu ms of downtime avoided\n", change.fieldsChanged,
+          change.mainActions, change.stratumActions, (unsigned long) avoided);
+      if (avoided) {
+        snprintf(temp, TEMP_BUFFER_SIZE, "Settings applied live, about %lu s of mining downtime avoided.", (unsigned long) (avoided / 1000));
+        addToWebLog(infoMessageColor, temp);
       }
 
       // Send message back to user
@@ -1478,122 +947,113 @@ void handleConfigPost() {
   sendAjaxResponse(!error, changesMade, true, messages);
 }
 
+// Serve the snapshot monitorTask publishes each second. Its version is the ETag, so
+// a dashboard polling faster than the numbers change just gets a 304.
 void handleStatusJson() {
 
-  // Create safe null-terminated copies of all strings with default values
-  char safeHps[21] = "0";
-  char safePoolSub[21] = "0";
-  char safeValidBlocks[21] = "0";
-  char safeBlocks32[21] = "0";
-  char safeBlocks16[21] = "0";
-  char safeBestDiff[21] = "0";
-  char safeTotalHashes[21] = "0";
-  char safeTotalJobs[21] = "0";
-  char safeMac[21] = "00:00:00:00:00:00";
-  char safePool[82] = "";
-  char poolDiffStr[20] = "0";
-  char safeUptime[25] = "0";
-
-  const char* miningStatus = "false";
-  const char* poolStatus = "false";
-
-  // Copy with explicit size limits to ensure null termination
-  if (monitorData.hashesPerSecondStr[0] != '\0') {
-    strncpy(safeHps, monitorData.hashesPerSecondStr, 20);
-    safeHps[20] = '\0';
-  }
-  if (monitorData.poolSubmissionsStr[0] != '\0') {
-    strncpy(safePoolSub, monitorData.poolSubmissionsStr, 20);
-    safePoolSub[20] = '\0';
-  }
-  if (monitorData.validBlocksFoundStr[0] != '\0') {
-    strncpy(safeValidBlocks, monitorData.validBlocksFoundStr, 20);
-    safeValidBlocks[20] = '\0';
-  }
-  if (monitorData.blocks32FoundStr[0] != '\0') {
-    strncpy(safeBlocks32, monitorData.blocks32FoundStr, 20);
-    safeBlocks32[20] = '\0';
-  }
-  if (monitorData.blocks16FoundStr[0] != '\0') {
-    strncpy(safeBlocks16, monitorData.blocks16FoundStr, 20);
-    safeBlocks16[20] = '\0';
-  }
-  if (monitorData.bestDifficultyStr[0] != '\0') {
-    strncpy(safeBestDiff, monitorData.bestDifficultyStr, 20);
-    safeBestDiff[20] = '\0';
-  }
-  if (monitorData.totalHashesStr[0] != '\0') {
-    strncpy(safeTotalHashes, monitorData.totalHashesStr, 20);
-    safeTotalHashes[20] = '\0';
-  }
-  if (monitorData.totalJobsStr[0] != '\0') {
-    strncpy(safeTotalJobs, monitorData.totalJobsStr, 20);
-    safeTotalJobs[20] = '\0';
-  }
-  if (monitorData.macAddress[0] != '\0') {
-    strncpy(safeMac, monitorData.macAddress, 20);
-    safeMac[20] = '\0';
+  char etag[12];
+  const StatusSnapshot* snapshot = acquireStatusSnapshot();
+
+  snprintf(etag, sizeof(etag), "\"%lx\"", (unsigned long) snapshot->version);
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache");
+
+  if( server.hasHeader("If-None-Match") && strstr(server.header("If-None-Match").c_str(), etag) ) {
+    releaseStatusSnapshot(snapshot);
+    server.send(304);
+    return;
   }
-  if (monitorData.currentPool[0] != '\0') {
-    strncpy(safePool, monitorData.currentPool, 80);
-    safePool[81] = '\0';
+
+  server.send_P(200, "application/json", snapshot->json, snapshot->length);
+  releaseStatusSnapshot(snapshot);
+}
+
+// True when an Accept-Encoding value takes gzip, by name or as "*", without
+// a q of zero. Codings are case insensitive and parameters may be spaced out.
+static bool acceptsGzip(const char* accept) {
+  const char* p = accept;
+  while( *p ) {
+    while( *p == ' ' || *p == '\t' || *p == ',' ) {
+      p++;
+    }
+    const char* name = p;
+    while( *p && *p != ',' && *p != ';' && *p != ' ' && *p != '\t' ) {
+      p++;
+    }
+    size_t nameLength = p - name;
+    bool gzip = ( nameLength == 4 && strncasecmp(name, "gzip", 4) == 0 ) ||
+                ( nameLength == 6 && strncasecmp(name, "x-gzip", 6) == 0 ) ||
+                ( nameLength == 1 && *name == '*' );
+
+    // Only q matters; anything at or below zero refuses the coding
+    bool refused = false;
+    while( *p && *p != ',' ) {
+      if( *p == ';' ) {
+        p++;
+        while( *p == ' ' || *p == '\t' ) {
+          p++;
+        }
+        if( ( *p == 'q' || *p == 'Q' ) && p[1] == '=' ) {
+          refused = strtod(p + 2, NULL) <= 0.0;
+        }
+      } else {
+        p++;
+      }
+    }
+    if( gzip && ! refused ) {
+      return true;
+    }
   }
+  return false;
+}
 
-  if (monitorData.isMining) {
-    miningStatus = "true";
+// Straight out of flash, already gzipped. Pages revalidate against their
+// ETag; everything else is fetched by a versioned URL and cached for good.
+// There's only the gzipped copy in flash, so a client that doesn't say it
+// takes gzip (curl without --compressed, say) gets a 406 instead of bytes it
+// can't read.
+void sendWebAsset(const WebAsset* asset) {
+  if( ! asset ) {
+    server.send(404, "text/plain", "Not found");
+    return;
   }
-  if (monitorData.poolConnected) {
-    poolStatus = "true";
+
+  if( asset->gzipped ) {
+    server.sendHeader("Vary", "Accept-Encoding");
+    if( ! server.hasHeader("Accept-Encoding") || ! acceptsGzip(server.header("Accept-Encoding").c_str()) ) {
+      server.send(406, "text/plain", "This file is only served gzipped; send Accept-Encoding: gzip");
+      return;
+    }
   }
 
-  // Format pool difficulty as string to avoid %f varargs issues on ESP32
-  dtostrf(monitorData.poolDifficulty, 1, 2, poolDiffStr);
+  server.sendHeader("ETag", asset->etag);
+  server.sendHeader("Cache-Control", asset->page ? "no-cache" : "public, max-age=31536000, immutable");
 
-  // Format uptime as string to avoid %llu varargs issues on ESP32
-  uint32_t uptimeHigh = (uint32_t)(monitorData.uptime >> 32);
-  uint32_t uptimeLow = (uint32_t)(monitorData.uptime & 0xFFFFFFFF);
-  if (uptimeHigh > 0) {
-    snprintf(safeUptime, sizeof(safeUptime), "%lu%08lu", (unsigned long)uptimeHigh, (unsigned long)uptimeLow);
-  } else {
-    snprintf(safeUptime, sizeof(safeUptime), "%lu", (unsigned long)uptimeLow);
+  if( server.hasHeader("If-None-Match") && strstr(server.header("If-None-Match").c_str(), asset->etag) ) {
+    server.send(304);
+    return;
   }
 
-  // Build JSON incrementally to avoid varargs stack alignment issues
-  int len = 0;
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, "{\"mining\": %s", miningStatus);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"hps\": \"%s\"", safeHps);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"poolSubmissions\": \"%s\"", safePoolSub);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"validBlocks\": \"%s\"", safeValidBlocks);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"poolConnected\": %s", poolStatus);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"blocks32\": \"%s\"", safeBlocks32);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"blocks16\": \"%s\"", safeBlocks16);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"poolHost\": \"%s\"", safePool);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"poolPort\": %d", (int)settings.poolPort);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"uptime\": %s", safeUptime);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"bestDifficulty\": \"%s\"", safeBestDiff);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"totalHashes\": \"%s\"", safeTotalHashes);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"totalJobs\": \"%s\"", safeTotalJobs);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"blockHeight\": %lu", (unsigned long)monitorData.blockHeight);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"mac\": \"%s\"", safeMac);
-  len += snprintf(temp + len, TEMP_BUFFER_SIZE - len, ", \"poolDifficulty\": %s}", poolDiffStr);
-
-  if (len >= TEMP_BUFFER_SIZE) {
-    len = TEMP_BUFFER_SIZE - 1;
+  if( asset->gzipped ) {
+    server.sendHeader("Content-Encoding", "gzip");
   }
-  temp[len] = '\0';
+  server.send_P(200, asset->contentType, (PGM_P) asset->data, asset->length);
+}
 
-  server.send(200, "application/json", temp);
+void handleWebAsset() {
+  sendWebAsset(findWebAsset(server.uri().c_str()));
 }
 
 void handleStatus() {
+  sendWebAsset(findWebAsset("/status.html"));
+}
 
-  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server.send(200, "text/html", "");
-
-  SEND_PAGE_HEADER
-  server.sendContent_P(statusPage);
-  server.sendContent_P(statusPageJavascript);
-  SEND_PAGE_FOOTER;
+// Per device settings the static pages can't carry
+void handleUiJson() {
+  snprintf(temp, TEMP_BUFFER_SIZE, "{\"theme\":\"%s\",\"logViewer\":%s}",
+           (settings.webTheme == 1 ? "dark-mode" : ""), (settings.enableLogViewer ? trueString : falseString));
+  server.sendHeader("Cache-Control", "no-cache");
+  server.send(200, "application/json", temp);
 }
 
 void showLoginPage(bool showError) {
@@ -1628,39 +1088,6 @@ void handleLoginSubmission() {
   showLoginPage(true);
 }
 
-void handleGears() {
-  String header = "Cache-Control";
-  String value = "max-age=86400";
-  server.sendHeader(header, value);
-  server.send_P(200, (PGM_P)pngContentType, (PGM_P)gears, (size_t)sizeof(gears));
-}
-
-void handleLogIcon() {
-  String header = "Cache-Control";
-  String value = "max-age=86400";
-  server.sendHeader(header, value);
-  server.send_P(200, (PGM_P)pngContentType, (PGM_P)log_icon, (size_t)sizeof(log_icon));
-}
-
-void handleLogo() {
-  String header = "Cache-Control";
-  String value = "max-age=86400";
-  server.sendHeader(header, value);
-  server.send_P(200, (PGM_P)pngContentType, (PGM_P)small_logo, (size_t)sizeof(small_logo));
-}
-
-void handleFavicon() {
-  String header = "Cache-Control";
-  String value = "max-age=86400";
-  server.sendHeader(header, value);
-  server.send_P(200, (PGM_P)pngContentType, (PGM_P)favicon_32x32, (size_t)sizeof(favicon_32x32));
-}
-
-
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Scan for WiFi networks and send back results as JSON array
-//////////////////////////////////////////////////////////////////////////////////////////
 void ajaxWiFiScan() {
 
   // Make sure the user is logged in
@@ -1705,10 +1132,74 @@ void handlePing() {
   server.send(200, "application/json", temp);
 }
 
+void sendMetricsChunk(const char* data, size_t len) {
+  server.sendContent(data, len);
+}
+
+// Prometheus scrape target, streamed out of the shared temp buffer
+void handleMetrics() {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, METRICS_CONTENT_TYPE, "");
+
+  MetricsWriter w(temp, TEMP_BUFFER_SIZE, sendMetricsChunk);
+  writeMetrics(w);
+  server.writeMetrics(w);
+  w.finish();
+}
+
 void handleLog() {
-  SEND_PAGE_HEADER
-  server.sendContent_P(logPage);
-  SEND_PAGE_FOOTER
+  sendWebAsset(findWebAsset("/log.html"));
+}
+
+// One CSV line per record, gathered in temp and sent whenever it's nearly full
+static size_t journalCsvLength;
+
+void journalCsvLine(const JournalRecord* r, void* context) {
+  char when[24] = "";
+  if( r->time ) {
+    time_t t = r->time;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    strftime(when, sizeof(when), "%Y-%m-%dT%H:%M:%SZ", &tm);
+  }
+
+  journalCsvLength += snprintf(&temp[journalCsvLength], TEMP_BUFFER_SIZE - journalCsvLength, "%lu,%s,%s,%u,%.10g\n",
+                               (unsigned long) r->seq, when, journalEventName(r->type), r->code, (double) r->value);
+  if( journalCsvLength > TEMP_BUFFER_SIZE - 128 ) {
+    server.sendContent(temp, journalCsvLength);
+    journalCsvLength = 0;
+  }
+}
+
+void handleJournal() {
+  server.sendHeader("Content-Disposition", "attachment; filename=\"journal.csv\"");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/csv", "");
+
+  journalCsvLength = snprintf(temp, TEMP_BUFFER_SIZE, "seq,time,event,code,value\n");
+  journalForEach(journalCsvLine, NULL);
+  if( journalCsvLength ) {
+    server.sendContent(temp, journalCsvLength);
+  }
+}
+
+// Oldest first, in whatever size pieces temp holds
+void handleStratumCapture() {
+  if (!validateJWT()) {
+    redirect("/login");
+    return;
+  }
+
+  server.sendHeader("Content-Disposition", "attachment; filename=\"stratum.cap\"");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain", "");
+
+  uint32_t position = 0;
+  uint32_t end = captureEnd();
+  size_t len;
+  while( (len = captureRead(&position, end, temp, TEMP_BUFFER_SIZE)) > 0 ) {
+    server.sendContent(temp, len);
+  }
 }
 
 
@@ -1726,26 +1217,33 @@ void webTask(void* task_id) {
   server.collectHeaders(headersToCollect, headerkeyssize);
 
   server.on("/wifiScan", ajaxWiFiScan);
-  server.on("/logo.png", handleLogo);
-  server.on("/favicon.png", handleFavicon);
-  server.on("/gears.png", handleGears);
-  server.on("/log_icon.png", handleLogIcon);
   server.on("/login", HTTPMethod::HTTP_GET, handleLoginPage);
   server.on("/login", HTTPMethod::HTTP_POST, handleLoginSubmission);
   server.on("/config", HTTPMethod::HTTP_GET, handleConfigGet);
   server.on("/config", HTTPMethod::HTTP_POST, handleConfigPost);
   server.on("/status", handleStatus);
   server.on("/statusJson", handleStatusJson);
+  server.on("/uiJson", handleUiJson);
   server.on("/ping", handlePing);
+  server.on("/metrics", handleMetrics);
+  server.on("/journal.csv", handleJournal);
+  server.on("/stratum.cap", handleStratumCapture);
   server.on("/logviewer", handleLog);
   server.on("/", handleRoot);
+
+  // CSS, scripts and images from web/. Pages are routed above.
+  for( int i = 0; i < WEB_ASSET_COUNT; i++ ) {
+    if( ! webAssets[i].page ) {
+      server.on(webAssets[i].path, HTTPMethod::HTTP_GET, handleWebAsset);
+    }
+  }
   
   server.begin();  
   webSocket.begin();
   webSocket.onMessage(onWebSocketMessage);
 
+  // handleClient() sleeps in select() until there's something to do
   while (1) {
     server.handleClient();
-    vTaskDelay(100 / portTICK_PERIOD_MS);
   }
 }
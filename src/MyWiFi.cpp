@@ -14,6 +14,10 @@
  */
 #include "MyWiFi.h"
 #include "defines_n_types.h"
+#include "nvs_handler.h"
+#include "monitor.h"
+#include "journal.h"
+#include "bootProfile.h"
 
 
 #define AP_MODE WIFI_AP_STA
@@ -26,6 +30,35 @@ char MyWiFi::apPassword[MAX_PASSWORD_LENGTH] = "";
 MyWiFiEventCallback MyWiFi::ipCallback = NULL;
 static bool everConnected = false;
 
+extern MonitorData monitorData;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Station connects don't block. enterStationMode() starts one and returns;
+// handleWiFiEvent() moves it along as the driver reports back, and
+// checkConnect() on the event task's tick catches the ones that go quiet.
+//
+// If we've been on this network before, the first try goes straight to the
+// cached AP on its channel, which skips the scan. The address still comes
+// from DHCP every time; a lease from last time may have expired and been
+// handed to someone else. Anything wrong with the cached AP and we fall
+// back to a plain scan.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#define CONNECT_OFF 0         // Access point mode, or not started
+#define CONNECT_FAST 1        // Joining the cached AP
+#define CONNECT_FULL 2        // Scanning for the SSID
+#define CONNECT_UP 3          // Have an address
+#define CONNECT_FAILED 4      // Gave up; the event task will call enterStationMode() again
+
+static volatile uint8_t connectState = CONNECT_OFF;
+static volatile uint32_t connectStart = 0;
+static WiFiCache cache;
+static bool cacheValid = false;
+static bool cacheLoaded = false;
+
+// When the link went down, for the downtime to the next pool subscribe; 0 if it's up
+static volatile uint32_t downSince = 0;
+
 
 
 bool MyWiFi::isConnected() {
@@ -33,7 +66,7 @@ bool MyWiFi::isConnected() {
 }
 
 bool MyWiFi::isConnecting() {
-  return (WiFi.status() == WL_IDLE_STATUS);
+  return connectState == CONNECT_FAST || connectState == CONNECT_FULL;
 }
 void MyWiFi::setIPCallback(MyWiFiEventCallback callback) {
   ipCallback = callback;
@@ -64,6 +97,13 @@ void MyWiFi::handleWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
       dbg("Event: ARDUINO_EVENT_WIFI_READY\n");
       break;
     case WiFiEvent_t::ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      dbg("WiFi up in %lu ms%s\n", millis() - connectStart, connectState == CONNECT_FAST ? " from cache" : "");
+      if( connectState == CONNECT_FAST ) {
+        monitorData.wifiFastConnects++;
+      }
+      connectState = CONNECT_UP;
+      bootMark(BOOT_WIFI_UP);
+      saveCache();
       if( ipCallback ) {
         ipCallback();
       }
@@ -73,6 +113,25 @@ void MyWiFi::handleWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
     case WiFiEvent_t::ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
       dbg("WiFi lost connection.\n");
       dbg("Disconnect reason: %d\n", info.wifi_sta_disconnected.reason);
+
+      // Our own disconnect ahead of a new connect
+      if( info.wifi_sta_disconnected.reason == WIFI_REASON_ASSOC_LEAVE && connectState != CONNECT_UP ) {
+        break;
+      }
+
+      if( connectState == CONNECT_UP ) {
+        // Dropped; go straight back rather than waiting for the event task
+        downSince = millis() ? millis() : 1;
+        monitorData.wifiDisconnects++;
+        startConnect(true);
+      } else if( connectState == CONNECT_FAST ) {
+        // The cached AP is gone or has changed; find it again the slow way
+        dbg("Cached AP failed, scanning\n");
+        cacheValid = false;
+        startConnect(false);
+      } else if( connectState == CONNECT_FULL ) {
+        connectState = CONNECT_FAILED;
+      }
       break;
   }
 
@@ -131,6 +190,8 @@ void MyWiFi::configure(uint32_t ipAddress,
 
 void MyWiFi::enterAccessPointMode() {
   int16_t timeout = 20;
+  connectState = CONNECT_OFF;
+  downSince = 0;
   if( WiFi.getMode() == WIFI_MODE_STA ) {
     dbg("Entering access point mode..");
     WiFi.disconnect(true);
@@ -145,25 +206,81 @@ void MyWiFi::enterAccessPointMode() {
 }
 
 
+// Starts a connect and returns; see handleWiFiEvent() for the rest
 void MyWiFi::enterStationMode() {
+  connectState = CONNECT_OFF;
+
   WiFi.persistent(false);
+  WiFi.setAutoReconnect(false);   // Reconnects are ours, so they can use the cache
   WiFi.softAPdisconnect(true);
   WiFi.disconnect(false);
 
   WiFi.mode(WIFI_STA);
   WiFi.setSleep(false);
-  WiFi.begin(theSSID, theSSIDPassword);
 
-  uint32_t start = millis();
-  const uint32_t timeoutMs = 20000; // 20 seconds
+  if( ! cacheLoaded ) {
+    cacheLoaded = true;
+    cacheValid = read_blob(WIFI_CACHE_KEY, &cache, sizeof(cache));
+  }
+
+  startConnect(true);
+}
+
+void MyWiFi::startConnect(bool useCache) {
+  bool fast = useCache && cacheValid && strncmp(cache.ssid, theSSID, MAX_SSID_LENGTH) == 0;
 
-  while (WiFi.status() != WL_CONNECTED && (millis() - start) < timeoutMs) {
-    delay(100);
+  connectStart = millis();
+  connectState = fast ? CONNECT_FAST : CONNECT_FULL;
+  if( fast ) {
+    WiFi.begin(theSSID, theSSIDPassword, cache.channel, cache.bssid);
+  } else {
+    WiFi.begin(theSSID, theSSIDPassword);
   }
+}
+
+// Called on the event task's tick for connects that never report back
+void MyWiFi::checkConnect() {
+  uint32_t elapsed = millis() - connectStart;
 
-  if (WiFi.status() != WL_CONNECTED) {
+  if( connectState == CONNECT_FAST && elapsed > WIFI_FAST_CONNECT_MS ) {
+    dbg("Cached AP not joined in time, scanning\n");
+    cacheValid = false;
+    startConnect(false);
+  } else if( connectState == CONNECT_FULL && elapsed > WIFI_CONNECT_TIMEOUT_MS ) {
     dbg("WiFi connect timeout\n");
+    connectState = CONNECT_FAILED;
+  }
+}
+
+// Remembers the AP we joined. Only written when it changes.
+void MyWiFi::saveCache() {
+  WiFiCache c;
+  memset(&c, 0, sizeof(c));
+  strncpy(c.ssid, theSSID, MAX_SSID_LENGTH - 1);
+  memcpy(c.bssid, WiFi.BSSID(), sizeof(c.bssid));
+  c.channel = WiFi.channel();
+
+  if( cacheValid && memcmp(&c, &cache, sizeof(c)) == 0 ) {
+    return;
   }
+  cache = c;
+  cacheValid = save_blob(WIFI_CACHE_KEY, &cache, sizeof(cache));
+}
+
+// The stratum task has a pool session again. If that ends a WiFi outage,
+// record how long mining was down for.
+void MyWiFi::poolSubscribed() {
+  uint32_t since = downSince;
+  if( ! since ) {
+    return;
+  }
+  downSince = 0;
+
+  uint32_t downtime = millis() - since;
+  monitorData.wifiDowntimeMs += downtime;
+  monitorData.wifiLastDowntimeMs = downtime;
+  journalAdd(JOURNAL_WIFI_RECOVERED, 0, downtime / 1000.0f);
+  dbg("Back mining %lu ms after WiFi dropped\n", downtime);
 }
 
 
@@ -23,8 +23,20 @@
 
 #define INADDR_ANY ((uint32_t)0x0)
 
+#define WIFI_CACHE_KEY "wificache"
+#define WIFI_FAST_CONNECT_MS 4000      // Cached AP not joined by now, so scan for it
+#define WIFI_CONNECT_TIMEOUT_MS 20000  // A full connect gives up here and the event task retries
+
 typedef void (*MyWiFiEventCallback)(void);
 
+// The AP we last got an address from, so a reconnect can skip the scan.
+// Kept in NVS as a blob.
+typedef struct {
+  char ssid[MAX_SSID_LENGTH];
+  uint8_t bssid[6];
+  uint8_t channel;
+} WiFiCache;
+
 class MyWiFi {
 
   public:
@@ -40,6 +52,8 @@ class MyWiFi {
     static void setupEvents();
     static void setIPCallback(MyWiFiEventCallback callback);
     static bool hasEverConnected();
+    static void checkConnect();
+    static void poolSubscribed();
 
     static int16_t apClientCount();
 
@@ -50,6 +64,8 @@ class MyWiFi {
     static char apSSID[MAX_SSID_LENGTH];
     static char apPassword[MAX_PASSWORD_LENGTH];
 
+    static void startConnect(bool useCache);
+    static void saveCache();
 
     static void handleWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info);
 
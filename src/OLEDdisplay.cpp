@@ -18,7 +18,6 @@
 
 #ifdef USE_OLED
 #include <U8g2lib.h>
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
 #ifdef USE_OLED_SPI
   #include <SPI.h>
@@ -29,6 +28,7 @@
 #include "monitor.h"
 #include "utils.h"
 #include "MyWiFi.h"
+#include "fetchTask.h"
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
@@ -54,17 +54,29 @@ U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE, OLED_SCL, OLED_
 #define NAME "QMiner"
 
 ///////////////////////////////////////////////////////////////////////////////////////////
-// API Data Variables
+// API data, fetched in the background by the fetch task
 ///////////////////////////////////////////////////////////////////////////////////////////
-String apiBtcPrice = "--";
-String apiBlockHeight = "--";
-String apiGlobalHashrate = "--";
-String apiDifficulty = "--";
-double apiDifficultyRaw = 0.0;
-String apiMinerMotivation = "";
-unsigned long lastApiCall = 0;
-bool apiDataFetched = false;
-uint8_t lastLoadedScreen = 0; // Track which screen was last loaded for API fetching
+#ifndef KONTINYU_API_URL
+  #define KONTINYU_API_URL "http://miner.kontinyu.com/api.php"
+#endif
+
+typedef struct {
+  double difficultyRaw;
+  char minerMotivation[256];
+} KontinyuApiData;
+
+static bool parseKontinyuApi(const char* body, size_t length, void* value);
+
+static const FetchSource kontinyuApiSource = {
+  KONTINYU_API_URL,
+  30 * 60 * 1000,          // Fresh for 30 minutes
+  24 * 60 * 60 * 1000,     // Network difficulty moves slowly, so a day old copy is still worth showing
+  sizeof(KontinyuApiData),
+  parseKontinyuApi
+};
+
+int8_t kontinyuApi = -1;
+uint8_t lastLoadedScreen = 0; // Track which screen was last loaded
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // Scrolling Text Variables for Screen 4
@@ -77,49 +89,23 @@ const unsigned long SCROLL_START_DELAY = 3000; // 3 second delay before scrollin
 bool scrollDelayActive = false; // Flag to track if we're in delay period
 
 ///////////////////////////////////////////////////////////////////////////////////////////
-// Fetch API data from kontinyu server
+// Parse a reply from the kontinyu server. Runs in the fetch task.
 ///////////////////////////////////////////////////////////////////////////////////////////
-void fetchKontinyuAPI() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  
-  // Only fetch if we don't have fresh data (cache for 30 minutes)
-  if (apiDataFetched && (millis() - lastApiCall < 30 * 60 * 1000)) return;
-  
-  HTTPClient http;
-  http.setTimeout(5000);
-  http.begin("http://miner.kontinyu.com/api.php");
-  
-  int httpCode = http.GET();
-  if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    StaticJsonDocument<512> doc;
-    
-    if (deserializeJson(doc, payload) == DeserializationError::Ok) {
-      if (doc.containsKey("btcPrice")) {
-        apiBtcPrice = doc["btcPrice"].as<String>();
-      }
-      if (doc.containsKey("blockHeight")) {
-        apiBlockHeight = doc["blockHeight"].as<String>();
-      }
-      if (doc.containsKey("globalHashrate")) {
-        apiGlobalHashrate = doc["globalHashrate"].as<String>();
-      }
-      if (doc.containsKey("difficulty")) {
-        apiDifficulty = doc["difficulty"].as<String>();
-      }
-      if (doc.containsKey("difficultyRaw")) {
-        apiDifficultyRaw = doc["difficultyRaw"].as<double>();
-      }
-      if (doc.containsKey("minermotivation")) {
-        apiMinerMotivation = doc["minermotivation"].as<String>();
-      }
-      apiDataFetched = true;
-      lastApiCall = millis(); // Update timestamp on success
-    }
-    doc.clear();
+static bool parseKontinyuApi(const char* body, size_t length, void* value) {
+  KontinyuApiData* api = (KontinyuApiData*) value;
+  StaticJsonDocument<512> doc;
+
+  if (deserializeJson(doc, body, length) != DeserializationError::Ok) {
+    return false;
+  }
+  if (doc.containsKey("difficultyRaw")) {
+    api->difficultyRaw = doc["difficultyRaw"].as<double>();
   }
-  // If fetch fails, don't update lastApiCall - allow retry on next screen load
-  http.end();
+  if (doc.containsKey("minermotivation")) {
+    const char* quote = doc["minermotivation"].as<const char*>();
+    strlcpy(api->minerMotivation, quote ? quote : "", sizeof(api->minerMotivation));
+  }
+  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -154,12 +140,13 @@ String formatLuckOdds(double odds) {
 ///////////////////////////////////////////////////////////////////////////////////////////
 String calculateLuck() {
   String luckNumber = "--";
-  if (apiDataFetched && apiDifficultyRaw > 0) {
+  KontinyuApiData api;
+  if (fetchGet(kontinyuApi, &api) && api.difficultyRaw > 0) {
     // Use bestDifficultyStr from monitor data
     String bestDiffStr = monitorData.bestDifficultyStr;
     double bestDiff = bestDiffStr.toDouble();
     if (bestDiff > 0) {
-      double odds = apiDifficultyRaw / bestDiff;
+      double odds = api.difficultyRaw / bestDiff;
       luckNumber = formatLuckOdds(odds);
     }
   }
@@ -222,6 +209,8 @@ void initializeDisplay(uint8_t rotation, uint8_t brightness) {
   Wire.begin(OLED_SDA, OLED_SCL);
 #endif
   
+  kontinyuApi = fetchRegister(&kontinyuApiSource);
+
   u8g2.begin();
   u8g2.clearBuffer();
   u8g2.setFont(u8g2_font_6x10_tf);
@@ -372,7 +361,8 @@ void refreshOLEDScreen4() {
   u8g2.setFont(u8g2_font_6x10_tf);
   
   // Get motivation quote
-  String quote = apiMinerMotivation;
+  KontinyuApiData api;
+  String quote = fetchGet(kontinyuApi, &api) ? api.minerMotivation : "";
   if (quote.length() == 0) {
     quote = "Keep mining!";
   }
@@ -518,7 +508,7 @@ void refreshOLEDScreen5() {
 ///////////////////////////////////////////////////////////////////////////////////////////
 // Refresh the current screen
 ///////////////////////////////////////////////////////////////////////////////////////////
-void refreshDisplay() {
+bool refreshDisplay() {
   switch (currentScreen) {
     case SCREEN_MINING:
       refreshOLEDMiningScreen();
@@ -542,6 +532,7 @@ void refreshDisplay() {
       refreshOLEDMiningScreen();
       break;
   }
+  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -559,12 +550,7 @@ void setCurrentScreen(uint8_t screen) {
   // Check if this is a new screen load (not just a refresh)
   if (screen != lastLoadedScreen) {
     lastLoadedScreen = screen;
-    
-    // Fetch API data when loading screens 3, 4, or 5
-    if (screen == 3 || screen == 4 || screen == 5) {
-      fetchKontinyuAPI();
-    }
-    
+
     // Reset scroll state when loading screen 5 (which is screen 4 content - scrolling motivation)
     if (screen == 5) {
       screen4LoadTime = 0; // Reset load time to trigger delay on next refresh
@@ -0,0 +1,752 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include "PlainWebServer.h"
+#include <lwip/sockets.h>
+#include <fcntl.h>
+#include "defines_n_types.h"
+
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+#define CHUNK_HEADER_SPACE 6    // "5b4\r\n" at most, since a chunk never exceeds the buffer
+#define CHUNK_TRAILER_SPACE 7   // "\r\n" plus the closing "0\r\n\r\n"
+
+
+static const char* statusText(int code) {
+  switch( code ) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 413: return "Payload Too Large";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+  }
+  return "";
+}
+
+static int hexValue(char c) {
+  if( c >= '0' && c <= '9' ) return c - '0';
+  if( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+  if( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+  return -1;
+}
+
+// Decode a form/query value in place
+static void urlDecode(char* s) {
+  char* out = s;
+  while( *s ) {
+    if( *s == '+' ) {
+      *out++ = ' ';
+      s++;
+    } else if( *s == '%' && hexValue(s[1]) >= 0 && hexValue(s[2]) >= 0 ) {
+      *out++ = (hexValue(s[1]) << 4) | hexValue(s[2]);
+      s += 3;
+    } else {
+      *out++ = *s++;
+    }
+  }
+  *out = '\0';
+}
+
+static char* trimSpaces(char* s) {
+  while( *s == ' ' || *s == '\t' ) {
+    s++;
+  }
+  char* end = s + strlen(s);
+  while( end > s && (end[-1] == ' ' || end[-1] == '\t') ) {
+    *--end = '\0';
+  }
+  return s;
+}
+
+// Look through the header block for Content-Length without modifying it
+static size_t findContentLength(const char* headers, const char* end) {
+  const char* line = strstr(headers, "\r\n");
+  while( line && line < end ) {
+    line += 2;
+    if( strncasecmp(line, "Content-Length:", 15) == 0 ) {
+      return strtoul(line + 15, NULL, 10);
+    }
+    line = strstr(line, "\r\n");
+  }
+  return 0;
+}
+
+
+PlainWebServer::PlainWebServer(uint16_t port) :
+  port(port), listenFd(-1), routeCount(0), headerKeyCount(0), current(NULL), unroutedRequests(0) {
+  for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+    connections[i].fd = -1;
+  }
+}
+
+void PlainWebServer::begin() {
+  listenFd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if( listenFd < 0 ) {
+    dbg("Web server: socket failed\n");
+    return;
+  }
+
+  int yes = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+  if( bind(listenFd, (struct sockaddr*) &addr, sizeof(addr)) < 0 || listen(listenFd, HTTP_MAX_CONNECTIONS) < 0 ) {
+    dbg("Web server: bind/listen failed\n");
+    close(listenFd);
+    listenFd = -1;
+    return;
+  }
+  fcntl(listenFd, F_SETFL, O_NONBLOCK);
+}
+
+void PlainWebServer::on(const char* uri, PlainWebHandler handler) {
+  on(uri, HTTP_ANY, handler);
+}
+
+void PlainWebServer::on(const char* uri, HTTPMethod method, PlainWebHandler handler) {
+  if( routeCount >= HTTP_MAX_ROUTES ) {
+    dbg("Web server: too many routes\n");
+    return;
+  }
+  PlainWebRoute& r = routes[routeCount++];
+  r.uri = uri;
+  r.method = method;
+  r.handler = handler;
+  r.requests = 0;
+  r.cpuMicros = 0;
+  r.maxCpuMicros = 0;
+}
+
+void PlainWebServer::collectHeaders(const char* keys[], const size_t count) {
+  headerKeyCount = 0;
+  for( size_t i = 0; i < count && i < HTTP_MAX_HEADERS; i++ ) {
+    headerKeys[headerKeyCount++] = keys[i];
+  }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Event loop. Sleeps in select() until a connection has data or a new one
+// arrives, so an idle server costs nothing.
+//////////////////////////////////////////////////////////////////////////////////////////
+void PlainWebServer::handleClient() {
+
+  if( listenFd < 0 ) {
+    vTaskDelay(HTTP_IDLE_WAIT / portTICK_PERIOD_MS);
+    return;
+  }
+
+  fd_set readSet;
+  FD_ZERO(&readSet);
+  FD_SET(listenFd, &readSet);
+  int maxFd = listenFd;
+
+  for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+    if( connections[i].fd >= 0 ) {
+      FD_SET(connections[i].fd, &readSet);
+      if( connections[i].fd > maxFd ) {
+        maxFd = connections[i].fd;
+      }
+    }
+  }
+
+  struct timeval tv;
+  tv.tv_sec = HTTP_IDLE_WAIT / 1000;
+  tv.tv_usec = (HTTP_IDLE_WAIT % 1000) * 1000;
+
+  if( select(maxFd + 1, &readSet, NULL, NULL, &tv) > 0 ) {
+    for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+      if( connections[i].fd >= 0 && FD_ISSET(connections[i].fd, &readSet) ) {
+        readConnection(&connections[i]);
+      }
+    }
+    if( FD_ISSET(listenFd, &readSet) ) {
+      acceptConnection();
+    }
+  }
+
+  // Drop keep-alive connections that have gone quiet
+  uint32_t now = millis();
+  for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+    if( connections[i].fd >= 0 && now - connections[i].lastActivity > HTTP_KEEPALIVE_TIMEOUT ) {
+      closeConnection(&connections[i]);
+    }
+  }
+}
+
+void PlainWebServer::acceptConnection() {
+  int fd = accept(listenFd, NULL, NULL);
+  if( fd < 0 ) {
+    return;
+  }
+
+  PlainWebConnection* conn = NULL;
+  for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+    if( connections[i].fd < 0 ) {
+      conn = &connections[i];
+      break;
+    }
+  }
+
+  // Out of slots, so make room by dropping the connection idle the longest
+  if( ! conn ) {
+    conn = &connections[0];
+    for( int i = 1; i < HTTP_MAX_CONNECTIONS; i++ ) {
+      if( connections[i].lastActivity < conn->lastActivity ) {
+        conn = &connections[i];
+      }
+    }
+    closeConnection(conn);
+  }
+
+  int yes = 1;
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+  conn->fd = fd;
+  conn->length = 0;
+  conn->buffer[0] = '\0';
+  conn->lastActivity = millis();
+}
+
+void PlainWebServer::closeConnection(PlainWebConnection* conn) {
+  if( conn->fd >= 0 ) {
+    close(conn->fd);
+  }
+  conn->fd = -1;
+  conn->length = 0;
+}
+
+void PlainWebServer::readConnection(PlainWebConnection* conn) {
+
+  int n = recv(conn->fd, conn->buffer + conn->length, HTTP_REQUEST_BUFFER_SIZE - conn->length, MSG_DONTWAIT);
+  if( n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) ) {
+    closeConnection(conn);
+    return;
+  }
+  if( n < 0 ) {
+    return;
+  }
+
+  conn->length += n;
+  conn->buffer[conn->length] = '\0';
+  conn->lastActivity = millis();
+
+  // Handle every complete request, including pipelined ones
+  while( conn->fd >= 0 && processRequest(conn) ) {
+  }
+
+  if( conn->fd >= 0 && conn->length >= HTTP_REQUEST_BUFFER_SIZE ) {
+    current = conn;
+    method = HTTP_GET;
+    argCount = 0;
+    headerCount = 0;
+    resetResponse();
+    keepAlive = false;
+    send(413);
+    finishResponse();
+    current = NULL;
+    closeConnection(conn);
+  }
+}
+
+// Parse and dispatch one request if the buffer holds all of it. Returns true
+// when there may be another request queued up behind it.
+bool PlainWebServer::processRequest(PlainWebConnection* conn) {
+
+  char* buffer = conn->buffer;
+  char* end = strstr(buffer, "\r\n\r\n");
+  if( ! end ) {
+    return false;
+  }
+
+  size_t headerLength = end + 4 - buffer;
+  size_t bodyLength = findContentLength(buffer, end);
+  size_t total = headerLength + bodyLength;
+
+  if( total > HTTP_REQUEST_BUFFER_SIZE ) {
+    conn->length = HTTP_REQUEST_BUFFER_SIZE;  // Let the caller turn it away
+    return false;
+  }
+  if( conn->length < total ) {
+    return false;
+  }
+
+  // Terminate the header block and the body. The byte after the body belongs
+  // to the next request, so it's put back afterwards.
+  *end = '\0';
+  char* body = buffer + headerLength;
+  char saved = body[bodyLength];
+  body[bodyLength] = '\0';
+
+  argCount = 0;
+  headerCount = 0;
+  keepAlive = false;
+  bool formBody = false;
+
+  // Request line
+  char* line = buffer;
+  char* next = strstr(line, "\r\n");
+  if( next ) {
+    *next = '\0';
+    next += 2;
+  }
+
+  char* methodStr = line;
+  char* uri = strchr(methodStr, ' ');
+  char* version = NULL;
+  if( uri ) {
+    *uri++ = '\0';
+    version = strchr(uri, ' ');
+    if( version ) {
+      *version++ = '\0';
+    }
+  }
+
+  method = HTTP_GET;
+  if( strcmp(methodStr, "POST") == 0 ) {
+    method = HTTP_POST;
+  } else if( strcmp(methodStr, "HEAD") == 0 ) {
+    method = HTTP_HEAD;
+  }
+  http11 = version && strcmp(version, "HTTP/1.1") == 0;
+  keepAlive = http11;
+
+  // Headers
+  while( next && *next ) {
+    line = next;
+    next = strstr(line, "\r\n");
+    if( next ) {
+      *next = '\0';
+      next += 2;
+    }
+    char* colon = strchr(line, ':');
+    if( ! colon ) {
+      continue;
+    }
+    *colon = '\0';
+    char* value = trimSpaces(colon + 1);
+
+    if( strcasecmp(line, "Connection") == 0 ) {
+      if( strcasecmp(value, "close") == 0 ) {
+        keepAlive = false;
+      } else if( strcasecmp(value, "keep-alive") == 0 ) {
+        keepAlive = true;
+      }
+    } else if( strcasecmp(line, "Content-Type") == 0 ) {
+      formBody = strstr(value, "x-www-form-urlencoded") != NULL;
+    }
+
+    for( uint8_t k = 0; k < headerKeyCount && headerCount < HTTP_MAX_HEADERS; k++ ) {
+      if( strcasecmp(line, headerKeys[k]) == 0 ) {
+        headers[headerCount].name = headerKeys[k];
+        headers[headerCount].value = value;
+        headerCount++;
+        break;
+      }
+    }
+  }
+
+  path = uri ? uri : "/";
+  char* query = uri ? strchr(uri, '?') : NULL;
+  if( query ) {
+    *query++ = '\0';
+    parseArgs(query);
+  }
+  if( formBody ) {
+    parseArgs(body);
+  }
+
+  current = conn;
+  dispatch();
+  current = NULL;
+
+  // Shift anything pipelined behind this request to the front
+  body[bodyLength] = saved;
+  if( conn->fd < 0 ) {
+    return false;
+  }
+  conn->length -= total;
+  memmove(buffer, buffer + total, conn->length);
+  buffer[conn->length] = '\0';
+  conn->lastActivity = millis();
+
+  if( ! keepAlive ) {
+    closeConnection(conn);
+    return false;
+  }
+  return conn->length > 0;
+}
+
+void PlainWebServer::parseArgs(char* data) {
+  while( data && *data && argCount < HTTP_MAX_ARGS ) {
+    char* amp = strchr(data, '&');
+    if( amp ) {
+      *amp = '\0';
+    }
+    char* eq = strchr(data, '=');
+    const char* value = "";
+    if( eq ) {
+      *eq = '\0';
+      value = eq + 1;
+      urlDecode(eq + 1);
+    }
+    urlDecode(data);
+    args[argCount].name = data;
+    args[argCount].value = value;
+    argCount++;
+    data = amp ? amp + 1 : NULL;
+  }
+}
+
+
+// Nothing from the last response on this or any other connection carries over
+void PlainWebServer::resetResponse() {
+  contentLength = CONTENT_LENGTH_NOT_SET;
+  headersSent = false;
+  chunked = false;
+  writeFailed = false;
+  extraHeadersLength = 0;
+  outputLength = 0;
+  blockedMicros = 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Run the handler and account for its time. Waiting on a full socket is
+// subtracted so the figure reflects CPU spent building the response.
+//////////////////////////////////////////////////////////////////////////////////////////
+void PlainWebServer::dispatch() {
+
+  resetResponse();
+
+  HTTPMethod match = method == HTTP_HEAD ? HTTP_GET : method;
+  PlainWebRoute* route = NULL;
+  for( uint8_t i = 0; i < routeCount; i++ ) {
+    if( (routes[i].method == HTTP_ANY || routes[i].method == match) && strcmp(routes[i].uri, path) == 0 ) {
+      route = &routes[i];
+      break;
+    }
+  }
+
+  uint32_t start = micros();
+
+  if( route ) {
+    route->handler();
+  } else {
+    unroutedRequests++;
+    send(404, "text/plain", "Not found");
+  }
+  finishResponse();
+
+  uint32_t elapsed = micros() - start;
+  uint32_t cpu = elapsed > blockedMicros ? elapsed - blockedMicros : 0;
+
+  if( route ) {
+    route->requests++;
+    route->cpuMicros += cpu;
+    if( cpu > route->maxCpuMicros ) {
+      route->maxCpuMicros = cpu;
+    }
+  }
+}
+
+String PlainWebServer::arg(const char* name) {
+  for( uint8_t i = 0; i < argCount; i++ ) {
+    if( strcmp(args[i].name, name) == 0 ) {
+      return String(args[i].value);
+    }
+  }
+  return String();
+}
+
+bool PlainWebServer::hasArg(const char* name) {
+  for( uint8_t i = 0; i < argCount; i++ ) {
+    if( strcmp(args[i].name, name) == 0 ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+String PlainWebServer::header(const char* name) {
+  for( uint8_t i = 0; i < headerCount; i++ ) {
+    if( strcasecmp(headers[i].name, name) == 0 ) {
+      return String(headers[i].value);
+    }
+  }
+  return String();
+}
+
+bool PlainWebServer::hasHeader(const char* name) {
+  for( uint8_t i = 0; i < headerCount; i++ ) {
+    if( strcasecmp(headers[i].name, name) == 0 ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Response. Everything goes through one segment sized buffer so a page made of
+// many small sendContent calls still leaves as full packets.
+//////////////////////////////////////////////////////////////////////////////////////////
+void PlainWebServer::setContentLength(size_t length) {
+  contentLength = length;
+}
+
+void PlainWebServer::sendHeader(const char* name, const char* value, bool first) {
+  size_t needed = strlen(name) + strlen(value) + 4;
+  if( extraHeadersLength + needed >= HTTP_EXTRA_HEADER_SIZE ) {
+    dbg("Web server: header %s dropped\n", name);
+    return;
+  }
+  if( first ) {
+    memmove(extraHeaders + needed, extraHeaders, extraHeadersLength);
+    snprintf(extraHeaders, needed + 1, "%s: %s\r", name, value);
+    extraHeaders[needed - 1] = '\n';
+  } else {
+    snprintf(extraHeaders + extraHeadersLength, needed + 1, "%s: %s\r\n", name, value);
+  }
+  extraHeadersLength += needed;
+}
+
+void PlainWebServer::sendResponseHeaders(int code, const char* contentType, size_t length) {
+  if( headersSent || ! current ) {
+    return;
+  }
+  headersSent = true;
+
+  if( length == CONTENT_LENGTH_UNKNOWN ) {
+    if( http11 ) {
+      chunked = true;
+    } else {
+      keepAlive = false;  // HTTP/1.0 ends the body by closing
+    }
+  }
+
+  int n = snprintf(output, HTTP_OUTPUT_BUFFER_SIZE, "HTTP/1.1 %d %s\r\n", code, statusText(code));
+  if( contentType && contentType[0] ) {
+    n += snprintf(output + n, HTTP_OUTPUT_BUFFER_SIZE - n, "Content-Type: %s\r\n", contentType);
+  }
+  if( chunked ) {
+    n += snprintf(output + n, HTTP_OUTPUT_BUFFER_SIZE - n, "Transfer-Encoding: chunked\r\n");
+  } else if( length != CONTENT_LENGTH_UNKNOWN ) {
+    n += snprintf(output + n, HTTP_OUTPUT_BUFFER_SIZE - n, "Content-Length: %u\r\n", (unsigned) length);
+  }
+  n += snprintf(output + n, HTTP_OUTPUT_BUFFER_SIZE - n, "Connection: %s\r\n", keepAlive ? "keep-alive" : "close");
+  if( extraHeadersLength && (size_t) n + extraHeadersLength + 2 < HTTP_OUTPUT_BUFFER_SIZE ) {
+    memcpy(output + n, extraHeaders, extraHeadersLength);
+    n += extraHeadersLength;
+  }
+  output[n++] = '\r';
+  output[n++] = '\n';
+  outputLength = n;
+
+  // Leave room in front of the first chunk for its size line
+  if( chunked ) {
+    outputLength += CHUNK_HEADER_SPACE;
+  }
+  chunkStart = outputLength;
+}
+
+void PlainWebServer::send(int code) {
+  sendResponseHeaders(code, NULL, 0);
+}
+
+void PlainWebServer::send(int code, const char* contentType, const char* content) {
+  size_t length = strlen(content);
+  if( contentLength == CONTENT_LENGTH_NOT_SET ) {
+    sendResponseHeaders(code, contentType, length);
+  } else {
+    sendResponseHeaders(code, contentType, contentLength);
+  }
+  write(content, length);
+}
+
+void PlainWebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t length) {
+  sendResponseHeaders(code, contentType, length);
+  write(content, length);
+}
+
+void PlainWebServer::sendContent(const char* content, size_t length) {
+  // A handler that streams without calling send() first gets a chunked page
+  if( ! headersSent ) {
+    sendResponseHeaders(200, "text/html", CONTENT_LENGTH_UNKNOWN);
+  }
+  write(content, length);
+}
+
+void PlainWebServer::write(const char* data, size_t length) {
+  if( method == HTTP_HEAD ) {
+    return;
+  }
+  while( length && ! writeFailed ) {
+    size_t room = HTTP_OUTPUT_BUFFER_SIZE - CHUNK_TRAILER_SPACE - outputLength;
+    if( room == 0 ) {
+      flushOutput();
+      continue;
+    }
+    if( room > length ) {
+      room = length;
+    }
+    memcpy(output + outputLength, data, room);
+    outputLength += room;
+    data += room;
+    length -= room;
+  }
+}
+
+void PlainWebServer::flushOutput() {
+  if( ! chunked ) {
+    sendAll(output, outputLength);
+    outputLength = 0;
+    chunkStart = 0;
+    return;
+  }
+
+  size_t raw = chunkStart - CHUNK_HEADER_SPACE;   // Response headers not yet sent
+  size_t dataLength = outputLength - chunkStart;
+
+  if( dataLength == 0 ) {
+    sendAll(output, raw);
+  } else {
+    // Write the size line right up against the data and slide any response
+    // headers up behind it so the whole lot goes out in one send
+    char sizeLine[CHUNK_HEADER_SPACE + 1];
+    int h = snprintf(sizeLine, sizeof(sizeLine), "%x\r\n", (unsigned) dataLength);
+    size_t start = chunkStart - h;
+    memcpy(output + start, sizeLine, h);
+    if( raw ) {
+      memmove(output + start - raw, output, raw);
+    }
+    start -= raw;
+    output[outputLength++] = '\r';
+    output[outputLength++] = '\n';
+    sendAll(output + start, outputLength - start);
+  }
+
+  outputLength = CHUNK_HEADER_SPACE;
+  chunkStart = CHUNK_HEADER_SPACE;
+}
+
+void PlainWebServer::finishResponse() {
+  if( ! current || writeFailed ) {
+    keepAlive = false;
+    return;
+  }
+  if( ! headersSent ) {
+    send(500);
+  }
+
+  if( chunked && method != HTTP_HEAD ) {
+    size_t raw = chunkStart - CHUNK_HEADER_SPACE;
+    if( outputLength > chunkStart || raw ) {
+      flushOutput();
+    }
+    sendAll("0\r\n\r\n", 5);
+  } else {
+    if( chunked ) {
+      outputLength = chunkStart - CHUNK_HEADER_SPACE;
+    }
+    sendAll(output, outputLength);
+  }
+  outputLength = 0;
+  chunked = false;
+}
+
+// Non-blocking socket, so wait in select() when it's full and keep track of
+// how long that took
+bool PlainWebServer::sendAll(const char* data, size_t length) {
+  if( ! current || writeFailed ) {
+    return false;
+  }
+
+  uint32_t started = millis();
+  while( length ) {
+    int sent = ::send(current->fd, data, length, MSG_DONTWAIT);
+    if( sent > 0 ) {
+      data += sent;
+      length -= sent;
+      continue;
+    }
+    if( sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK ) {
+      break;
+    }
+    if( millis() - started > HTTP_SEND_TIMEOUT ) {
+      break;
+    }
+
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(current->fd, &writeSet);
+    struct timeval tv = { 0, 100000 };
+    uint32_t waitStart = micros();
+    select(current->fd + 1, NULL, &writeSet, NULL, &tv);
+    blockedMicros += micros() - waitStart;
+  }
+
+  if( length ) {
+    writeFailed = true;
+    keepAlive = false;
+    closeConnection(current);
+    return false;
+  }
+  return true;
+}
+
+
+void PlainWebServer::writeMetrics(MetricsWriter& w) {
+  char labels[64];
+
+  w.describe("bitsy_http_requests_total", "counter", "Requests handled per route.");
+  for( uint8_t i = 0; i < routeCount; i++ ) {
+    snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", routes[i].uri,
+             routes[i].method == HTTP_POST ? "POST" : routes[i].method == HTTP_GET ? "GET" : "ANY");
+    w.value("bitsy_http_requests_total", labels, (uint64_t) routes[i].requests);
+  }
+  w.value("bitsy_http_requests_total", "route=\"unrouted\"", (uint64_t) unroutedRequests);
+
+  w.describe("bitsy_http_cpu_seconds_total", "counter", "Handler time per route, not counting time waiting on the socket.");
+  for( uint8_t i = 0; i < routeCount; i++ ) {
+    snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", routes[i].uri,
+             routes[i].method == HTTP_POST ? "POST" : routes[i].method == HTTP_GET ? "GET" : "ANY");
+    w.value("bitsy_http_cpu_seconds_total", labels, (double) routes[i].cpuMicros / 1000000.0);
+  }
+
+  w.describe("bitsy_http_max_cpu_seconds", "gauge", "Longest single request per route.");
+  for( uint8_t i = 0; i < routeCount; i++ ) {
+    snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", routes[i].uri,
+             routes[i].method == HTTP_POST ? "POST" : routes[i].method == HTTP_GET ? "GET" : "ANY");
+    w.value("bitsy_http_max_cpu_seconds", labels, (double) routes[i].maxCpuMicros / 1000000.0);
+  }
+
+  int open = 0;
+  for( int i = 0; i < HTTP_MAX_CONNECTIONS; i++ ) {
+    if( connections[i].fd >= 0 ) {
+      open++;
+    }
+  }
+  w.describe("bitsy_http_connections", "gauge", "Open HTTP connections.");
+  w.value("bitsy_http_connections", NULL, (uint64_t) open);
+}
@@ -0,0 +1,143 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef PLAINWEBSERVER_H
+#define PLAINWEBSERVER_H
+
+#include <Arduino.h>
+#include <HTTP_Method.h>
+#include "metrics.h"
+
+#ifndef CONTENT_LENGTH_UNKNOWN
+  #define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#endif
+
+#define HTTP_MAX_CONNECTIONS 4
+#define HTTP_REQUEST_BUFFER_SIZE 2048
+#define HTTP_OUTPUT_BUFFER_SIZE 1460    // One TCP segment
+#define HTTP_EXTRA_HEADER_SIZE 768
+#define HTTP_MAX_ROUTES 32
+#define HTTP_MAX_ARGS 32
+#define HTTP_MAX_HEADERS 4
+#define HTTP_KEEPALIVE_TIMEOUT 5000
+#define HTTP_SEND_TIMEOUT 5000
+#define HTTP_IDLE_WAIT 1000
+
+typedef void (*PlainWebHandler)(void);
+
+typedef struct {
+  const char* uri;
+  HTTPMethod method;
+  PlainWebHandler handler;
+  uint32_t requests;
+  uint64_t cpuMicros;     // Handler time less time spent waiting on the socket
+  uint32_t maxCpuMicros;
+} PlainWebRoute;
+
+typedef struct {
+  int fd;
+  uint32_t lastActivity;
+  uint16_t length;
+  char buffer[HTTP_REQUEST_BUFFER_SIZE + 1];
+} PlainWebConnection;
+
+typedef struct {
+  const char* name;
+  const char* value;
+} PlainWebPair;
+
+// A small HTTP/1.1 server on a select() loop. Connections are read without
+// blocking and kept alive; complete requests are handed to the routed handler
+// one at a time. The call surface matches the parts of the Arduino WebServer
+// the handlers already use.
+class PlainWebServer {
+  public:
+    PlainWebServer(uint16_t port = 80);
+
+    void begin();
+    void handleClient();
+    void on(const char* uri, PlainWebHandler handler);
+    void on(const char* uri, HTTPMethod method, PlainWebHandler handler);
+    void collectHeaders(const char* headerKeys[], const size_t count);
+
+    String uri() { return String(path); }
+    String arg(const char* name);
+    String arg(const String& name) { return arg(name.c_str()); }
+    bool hasArg(const char* name);
+    String header(const char* name);
+    bool hasHeader(const char* name);
+
+    void setContentLength(size_t length);
+    void sendHeader(const char* name, const char* value, bool first = false);
+    void sendHeader(const String& name, const String& value, bool first = false) { sendHeader(name.c_str(), value.c_str(), first); }
+    void send(int code);
+    void send(int code, const char* contentType, const char* content);
+    void send(int code, const char* contentType, const String& content) { send(code, contentType, content.c_str()); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t length);
+    void sendContent(const char* content, size_t length);
+    void sendContent(const char* content) { sendContent(content, strlen(content)); }
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent_P(PGM_P content) { sendContent(content, strlen_P(content)); }
+    void sendContent_P(PGM_P content, size_t length) { sendContent(content, length); }
+
+    void writeMetrics(MetricsWriter& w);
+
+  private:
+    uint16_t port;
+    int listenFd;
+    PlainWebRoute routes[HTTP_MAX_ROUTES];
+    uint8_t routeCount;
+    PlainWebConnection connections[HTTP_MAX_CONNECTIONS];
+    const char* headerKeys[HTTP_MAX_HEADERS];
+    uint8_t headerKeyCount;
+
+    // Per request state
+    PlainWebConnection* current;
+    HTTPMethod method;
+    const char* path;
+    bool http11;
+    bool keepAlive;
+    PlainWebPair args[HTTP_MAX_ARGS];
+    uint8_t argCount;
+    PlainWebPair headers[HTTP_MAX_HEADERS];
+    uint8_t headerCount;
+
+    // Response state
+    size_t contentLength;
+    bool headersSent;
+    bool chunked;
+    bool writeFailed;
+    char extraHeaders[HTTP_EXTRA_HEADER_SIZE];
+    size_t extraHeadersLength;
+    char output[HTTP_OUTPUT_BUFFER_SIZE];
+    size_t outputLength;
+    size_t chunkStart;
+    uint32_t blockedMicros;
+    uint32_t unroutedRequests;
+
+    void acceptConnection();
+    void readConnection(PlainWebConnection* conn);
+    void closeConnection(PlainWebConnection* conn);
+    bool processRequest(PlainWebConnection* conn);
+    void parseArgs(char* data);
+    void resetResponse();
+    void dispatch();
+    void sendResponseHeaders(int code, const char* contentType, size_t length);
+    void write(const char* data, size_t length);
+    void flushOutput();
+    bool sendAll(const char* data, size_t length);
+    void finishResponse();
+};
+
+#endif
@@ -13,10 +13,15 @@
  * GNU General Public License for more details.
  */
 #include "PlainWebSocket.h"
+#include <lwip/sockets.h>
 #include "sha1.h"
 #include "defines_n_types.h"
 
 extern SetupData settings;
+extern MonitorData monitorData;
+
+// Log lines come from any task that calls addToWebLog()
+static portMUX_TYPE logWriteMux = portMUX_INITIALIZER_UNLOCKED;
 
 PlainWebSocket::PlainWebSocket(uint16_t port) : server(port) {}
 
@@ -30,110 +35,282 @@ void PlainWebSocket::begin() {
         6000,                // Stack size
         this,                 // Task parameters
         1,                    // Priority
-        NULL,                  // Task handle
+        &taskHandle,          // Task handle
         0                     // Pinned to core 0
     );
 }
 
+// Called by the monitor when a new status snapshot is out
+void PlainWebSocket::statusPublished() {
+    if( taskHandle ) {
+      xTaskNotifyGive(taskHandle);
+    }
+}
+
 void PlainWebSocket::onMessage(void (*callback)(String)) {
     messageCallback = callback;
 }
 
+void PlainWebSocket::acceptClient(WiFiClient& newClient) {
+
+  // Add new client to the list
+  int i = 0;
+  for (; i < MAX_CLIENTS; ++i) {
+    if (!clients[i].client || !clients[i].client.connected()) {
+      WebSocketClient& c = clients[i];
+      c.client = newClient;
+      c.channels = 0;
+      c.statusPrimed = false;
+      c.sendLength = 0;
+      c.sendOffset = 0;
+
+      // Read header
+      int16_t wp = 200;               
+      while(! c.client.available() && wp-- > 0 ) {
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+      }
+      String key;
+      bool requestingUpgrade = false;
+      bool gotKey = false;
+      while( c.client.available() ) {
+        String line = c.client.readStringUntil('\n');
+
+        // See if this is a websocket client
+        if( line.indexOf("Upgrade: websocket") != -1 ) {
+          requestingUpgrade = true;                        
+        }
+        // Look for Websocket key to perform handshake
+        if( requestingUpgrade && line.indexOf("Sec-WebSocket-Key") != - 1 ) {
+          int start = line.indexOf("Sec-WebSocket-Key: ");
+          if (start >= 0) {
+              start += 19;
+              int end = line.indexOf("\r\n", start);
+              key = line.substring(start, end);
+              key.trim();
+              gotKey = true;
+          }
+        }
+        // See if the headers are done
+        if( line.length() == 0 || (line.length() == 1 && line.c_str()[0] == '\r') ) {
+          if( requestingUpgrade && gotKey ) {
+            performHandshake(c.client, key);
+            handleCommand(i, "subscribe log");
+          }
+          break;
+        }
+      }
+      break;
+    }
+  }
+  if( i >= MAX_CLIENTS ) {
+    newClient.stop();
+  }
+}
+
 void PlainWebSocket::websocketTask(void* pvParameters) {
   PlainWebSocket* ws = reinterpret_cast<PlainWebSocket*>(pvParameters);
 
   while (true) {
     WiFiClient newClient = ws->server.available();
     if (newClient) {
-      
-      // If log viewing isn't turned on, then shut down this client
-      if( ! settings.enableLogViewer ) {
-        newClient.stop();
-        vTaskDelay(50 / portTICK_PERIOD_MS); 
-        continue;
+      ws->acceptClient(newClient);
+    }
+
+    // Handle existing clients
+    for (int i = 0; i < MAX_CLIENTS; ++i) {
+      if (ws->clients[i].client && ws->clients[i].client.connected()) {
+        ws->handleClient(i);
       }
+    }
 
-      // Add new client to the list
-      int i = 0;
-      for (; i < MAX_CLIENTS; ++i) {
-        if (!ws->clients[i] || !ws->clients[i].connected()) {
-          ws->clients[i] = newClient;
+    ws->pushStatus();
 
-          // Read header
-          int16_t wp = 200;               
-          while(! ws->clients[i].available() && wp-- > 0 ) {
-            vTaskDelay(10 / portTICK_PERIOD_MS);
-          }
-          String key;
-          bool requestingUpgrade = false;
-          bool gotKey = false;
-          while( ws->clients[i].available() ) {
-            String line = ws->clients[i].readStringUntil('\n');
-
-            // See if this is a websocket client
-            if( line.indexOf("Upgrade: websocket") != -1 ) {
-              requestingUpgrade = true;                        
-            }
-            // Look for Websocket key to perform handshake
-            if( requestingUpgrade && line.indexOf("Sec-WebSocket-Key") != - 1 ) {
-              int start = line.indexOf("Sec-WebSocket-Key: ");
-              if (start >= 0) {
-                  start += 19;
-                  int end = line.indexOf("\r\n", start);
-                  key = line.substring(start, end);
-                  key.trim();
-                  gotKey = true;
-              }
-            }
-            // See if the headers are done
-            if( line.length() == 0 || (line.length() == 1 && line.c_str()[0] == '\r') ) {
-              if( requestingUpgrade && gotKey ) {
-                performHandshake(ws->clients[i], key);
-              }
-              break;
-            }
-          }
-          break;
-        }
+    bool pending = false;
+    for (int i = 0; i < MAX_CLIENTS; ++i) {
+      if (ws->clients[i].channels && ws->clients[i].client.connected()) {
+        ws->pumpLog(i);
+        pending |= ! ws->flushClient(i);
+      }
+    }
+
+    // Sleep until there is a log line or status to send. A client whose socket
+    // was full gets another try shortly.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(pending ? 10 : 100));
+  }
+}
+
+// Read whole frames from a client. Browsers mask everything they send and
+// our commands are short, so anything past a single small frame is dropped.
+void PlainWebSocket::handleClient(int index) {
+    WiFiClient& client = clients[index].client;
+
+    while (client.available() >= 2) {
+
+      uint8_t header[2];
+      client.readBytes(header, 2);
+
+      uint8_t opcode = header[0] & 0x0f;
+      size_t len = header[1] & 0x7f;
+
+      if( len == 126 ) {
+        uint8_t ext[2];
+        client.readBytes(ext, 2);
+        len = (ext[0] << 8) | ext[1];
+      } else if( len == 127 ) {
+        closeClient(index);
+        return;
+      }
+
+      uint8_t mask[4] = {0, 0, 0, 0};
+      if( header[1] & 0x80 ) {
+        client.readBytes(mask, 4);
+      }
+
+      if( len > WS_MAX_INCOMING ) {
+        closeClient(index);
+        return;
       }
-      if( i >= MAX_CLIENTS ) {
-        newClient.stop();
+
+      char data[WS_MAX_INCOMING + 1];
+      if( client.readBytes(data, len) != len ) {
+        closeClient(index);
+        return;
+      }
+      for( size_t i = 0; i < len; i++ ) {
+        data[i] ^= mask[i & 3];
+      }
+      data[len] = '\0';
+
+      if( opcode == 0x01 ) {
+        handleCommand(index, data);
+      } else if( opcode == 0x08 ) {
+        queueFrame(index, 0x08, NULL, NULL, 0);
+        flushClient(index);
+        closeClient(index);
+        return;
+      } else if( opcode == 0x09 ) {
+        queueFrame(index, 0x0a, NULL, data, len);
       }
     }
+}
 
-    // Handle existing clients
-    for (int i = 0; i < MAX_CLIENTS; ++i) {
-      if (ws->clients[i] && ws->clients[i].connected()) {
-        ws->handleClient(ws->clients[i]);
+void PlainWebSocket::closeClient(int index) {
+    clients[index].client.stop();
+    clients[index].channels = 0;
+    clients[index].sendLength = 0;
+    clients[index].sendOffset = 0;
+}
+
+void PlainWebSocket::handleCommand(int index, const char* command) {
+    WebSocketClient& c = clients[index];
+
+    if( strcmp(command, "subscribe status") == 0 ) {
+      c.channels |= WS_CHANNEL_STATUS;
+      c.statusPrimed = false;  // Gets the full snapshot on the next push
+      xTaskNotifyGive(taskHandle);
+    } else if( strcmp(command, "unsubscribe status") == 0 ) {
+      c.channels &= ~WS_CHANNEL_STATUS;
+    } else if( strcmp(command, "subscribe log") == 0 ) {
+      // The log channel is only open when log viewing is turned on. Joining
+      // replays the last few lines so the page doesn't start out empty.
+      if( settings.enableLogViewer && ! (c.channels & WS_CHANNEL_LOG) ) {
+        uint32_t head = __atomic_load_n(&logRecordHead, __ATOMIC_ACQUIRE);
+        c.logCursor = head > WS_LOG_BACKLOG ? head - WS_LOG_BACKLOG : 0;
+        c.channels |= WS_CHANNEL_LOG;
       }
+    } else if( strcmp(command, "unsubscribe log") == 0 ) {
+      c.channels &= ~WS_CHANNEL_LOG;
+    } else if( messageCallback ) {
+      messageCallback(String(command));
     }
+}
 
-    vTaskDelay(100 / portTICK_PERIOD_MS);  // Yield CPU
-  }
+// Write "{"status": {...}}" holding either every field of the snapshot or only
+// the ones that differ from what was last pushed
+size_t PlainWebSocket::buildStatusMessage(const StatusSnapshot* snapshot, bool full) {
+    static const char prefix[] = "{\"status\": {";
+    size_t len = sizeof(prefix) - 1;
+    bool first = true;
+
+    memcpy(statusMessage, prefix, len);
+
+    for( uint8_t f = 0; f < snapshot->fieldCount; f++ ) {
+      const char* field = snapshot->json + snapshot->fieldStart[f];
+      uint16_t fieldLen = snapshot->fieldLength[f];
+
+      if( ! full && f < lastStatusFieldCount && lastStatusFieldLength[f] == fieldLen &&
+          memcmp(&lastStatusFields[lastStatusFieldStart[f]], field, fieldLen) == 0 ) {
+        continue;
+      }
+      if( len + fieldLen + 4 >= WS_STATUS_MESSAGE_SIZE ) {
+        break;
+      }
+      if( ! first ) {
+        statusMessage[len++] = ',';
+      }
+      memcpy(statusMessage + len, field, fieldLen);
+      len += fieldLen;
+      first = false;
+    }
+
+    if( first && ! full ) {
+      return 0;  // Nothing changed
+    }
+
+    statusMessage[len++] = '}';
+    statusMessage[len++] = '}';
+    return len;
 }
 
-void PlainWebSocket::handleClient(WiFiClient& client) {
-    if (!client.connected()) {
-      client.stop();
+// Send a delta to primed subscribers and a full snapshot to new ones
+void PlainWebSocket::pushStatus() {
+    bool anySubscribers = false;
+    bool needFull = false;
+
+    for( int i = 0; i < MAX_CLIENTS; i++ ) {
+      if( (clients[i].channels & WS_CHANNEL_STATUS) && clients[i].client.connected() ) {
+        anySubscribers = true;
+        needFull |= ! clients[i].statusPrimed;
+      }
+    }
+    if( ! anySubscribers ) {
+      lastStatusVersion = 0;
       return;
     }
 
-    if (client.available()) {
-
-      // Read and process WebSocket data
-      uint8_t data[256];
-      size_t len = client.read(data, sizeof(data));
+    const StatusSnapshot* snapshot = acquireStatusSnapshot();
 
-      if (len > 0 && len < 256) {
-        data[len] = 0;  // Null-terminate the message
-        String message = String((char*)data);
+    if( snapshot->version != lastStatusVersion && lastStatusVersion ) {
+      size_t len = buildStatusMessage(snapshot, false);
+      if( len ) {
+        for( int i = 0; i < MAX_CLIENTS; i++ ) {
+          if( (clients[i].channels & WS_CHANNEL_STATUS) && clients[i].statusPrimed && clients[i].client.connected() ) {
+            // A client too far behind to take the delta gets a full snapshot later
+            if( ! queueFrame(i, 0x01, NULL, statusMessage, len) ) {
+              clients[i].statusPrimed = false;
+            }
+          }
+        }
+      }
+    }
 
-        // Trigger callback with received message
-        if (messageCallback) {
-          messageCallback(message);
+    if( needFull || ! lastStatusVersion ) {
+      size_t len = buildStatusMessage(snapshot, true);
+      for( int i = 0; i < MAX_CLIENTS; i++ ) {
+        if( (clients[i].channels & WS_CHANNEL_STATUS) && ! clients[i].statusPrimed && clients[i].client.connected() ) {
+          clients[i].statusPrimed = queueFrame(i, 0x01, NULL, statusMessage, len);
         }
       }
     }
+
+    // Remember what subscribers now have
+    lastStatusVersion = snapshot->version;
+    lastStatusFieldCount = snapshot->fieldCount;
+    memcpy(lastStatusFieldStart, snapshot->fieldStart, sizeof(lastStatusFieldStart));
+    memcpy(lastStatusFieldLength, snapshot->fieldLength, sizeof(lastStatusFieldLength));
+    memcpy(lastStatusFields, snapshot->json, snapshot->length);
+
+    releaseStatusSnapshot(snapshot);
 }
 
 void PlainWebSocket::performHandshake(WiFiClient& client, const String& request) {
@@ -161,74 +338,184 @@ void PlainWebSocket::performHandshake(WiFiClient& client, const String& request)
   client.println();
 }
 
-void PlainWebSocket::broadcast(const String& message) {
-  for (int i = 0; i < MAX_CLIENTS; ++i) {
-    if (clients[i] && clients[i].connected()) {
-      sendMessage(clients[i], message);
+//////////////////////////////////////////////////////////////////////////////////////////
+// Outgoing frames. Everything for a client goes through its send buffer as
+// whole frames and is written without blocking, so a slow browser only ever
+// holds up itself.
+//////////////////////////////////////////////////////////////////////////////////////////
+bool PlainWebSocket::queueFrame(int index, uint8_t opcode, const char* prefix, const char* payload, size_t length) {
+    WebSocketClient& c = clients[index];
+    size_t prefixLength = prefix ? strlen(prefix) : 0;
+    size_t payloadLength = prefixLength + length;
+    size_t headerLength = payloadLength < 126 ? 2 : 4;
+    size_t total = headerLength + payloadLength;
+
+    if( c.sendLength + total > WS_CLIENT_BUFFER_SIZE && c.sendOffset ) {
+      memmove(c.sendBuffer, c.sendBuffer + c.sendOffset, c.sendLength - c.sendOffset);
+      c.sendLength -= c.sendOffset;
+      c.sendOffset = 0;
     }
-  }
+    if( c.sendLength + total > WS_CLIENT_BUFFER_SIZE ) {
+      return false;
+    }
+
+    uint8_t* frame = c.sendBuffer + c.sendLength;
+    frame[0] = 0x80 | opcode;
+    if( headerLength == 2 ) {
+      frame[1] = payloadLength;
+    } else {
+      frame[1] = 126;
+      frame[2] = payloadLength >> 8;
+      frame[3] = payloadLength & 0xff;
+    }
+    if( prefixLength ) {
+      memcpy(frame + headerLength, prefix, prefixLength);
+    }
+    if( length ) {
+      memcpy(frame + headerLength + prefixLength, payload, length);
+    }
+    c.sendLength += total;
+    return true;
 }
 
+// Returns true once everything queued for the client has gone out
+bool PlainWebSocket::flushClient(int index) {
+    WebSocketClient& c = clients[index];
 
-void PlainWebSocket::broadcast(const char* message, size_t length) {
-  for (int i = 0; i < MAX_CLIENTS; ++i) {
-    if (clients[i] && clients[i].connected()) {
-      sendMessage(clients[i], message, length);
+    while( c.sendOffset < c.sendLength ) {
+      int sent = send(c.client.fd(), c.sendBuffer + c.sendOffset, c.sendLength - c.sendOffset, MSG_DONTWAIT);
+      if( sent < 0 ) {
+        if( errno == EAGAIN || errno == EWOULDBLOCK ) {
+          return false;
+        }
+        closeClient(index);
+        return true;
+      }
+      c.sendOffset += sent;
     }
-  }
+    c.sendOffset = 0;
+    c.sendLength = 0;
+    return true;
 }
 
-void PlainWebSocket::broadcast(const char* color, const char* message, size_t length) {
-  for (int i = 0; i < MAX_CLIENTS; ++i) {
-    if (clients[i] && clients[i].connected()) {
-      sendMessage(clients[i], color, message, length);
+// Copy whatever log lines the client hasn't seen into its send buffer. If the
+// ring has lapped the client, the oldest lines are skipped and counted.
+void PlainWebSocket::pumpLog(int index) {
+    WebSocketClient& c = clients[index];
+    uint32_t head = __atomic_load_n(&logRecordHead, __ATOMIC_ACQUIRE);
+
+    if( ! (c.channels & WS_CHANNEL_LOG) ) {
+      c.logCursor = head;
+      return;
     }
-  }
-}
 
-void PlainWebSocket::sendMessage(WiFiClient& client, const String& message) {
-  sendMessage(client, message.c_str(), message.length());
-}
+    if( head - c.logCursor > WS_LOG_RECORDS ) {
+      monitorData.webLogDrops += head - c.logCursor - WS_LOG_RECORDS;
+      c.logCursor = head - WS_LOG_RECORDS;
+    }
 
-void PlainWebSocket::sendMessage(WiFiClient& client, const char* color, const char* message, size_t length) {
+    while( c.logCursor != head ) {
+      WebLogRecord rec = logRecords[c.logCursor & (WS_LOG_RECORDS - 1)];
 
-  size_t len = length;
-  size_t pos = 0;
-  
-  const size_t maxFrameSize = 125;  // Max payload size for single-byte length encoding
-  
-  char colorBuf[30];
+      // The slot is only trustworthy if the writer hadn't started reusing it
+      if( __atomic_load_n(&logRecordHead, __ATOMIC_ACQUIRE) - c.logCursor >= WS_LOG_RECORDS ) {
+        monitorData.webLogDrops++;
+        c.logCursor++;
+        continue;
+      }
 
-  bool isFirstFrame = true;
+      char prefix[30] = "";
+      if( rec.color && strlen(rec.color) < sizeof(prefix) - 3 ) {
+        sprintf(prefix, "[%s]", rec.color);
+      }
 
-  while (pos < len) {
+      size_t prefixLength = strlen(prefix);
+      size_t payloadLength = prefixLength + rec.length;
+      size_t headerLength = payloadLength < 126 ? 2 : 4;
+      size_t total = headerLength + payloadLength;
 
-    uint8_t header[2];
-    if( isFirstFrame && len && color && strlen(color) < sizeof(colorBuf) - 3 ) {
-      sprintf(colorBuf, "[%s]", color);
-      header[0] = 0x01;
-      header[1] = strlen(colorBuf);
-      client.write(header, 2);
-      client.write(colorBuf, strlen(colorBuf));
-      isFirstFrame = false;
-    } 
+      if( c.sendLength + total > WS_CLIENT_BUFFER_SIZE && c.sendOffset ) {
+        memmove(c.sendBuffer, c.sendBuffer + c.sendOffset, c.sendLength - c.sendOffset);
+        c.sendLength -= c.sendOffset;
+        c.sendOffset = 0;
+      }
+      if( c.sendLength + total > WS_CLIENT_BUFFER_SIZE ) {
+        return;  // Try again once the socket drains
+      }
 
-    size_t chunkSize = (len - pos > maxFrameSize) ? maxFrameSize : (len - pos);
-  
-    header[0] = isFirstFrame ? 0x01 : 0x00;  // 0x01 = text, 0x00 = continuation
-    if (pos + chunkSize >= len) {
-      header[0] |= 0x80;  // Set FIN bit on the last frame
+      // Copy the text straight out of the ring behind room for the header
+      uint8_t* frame = c.sendBuffer + c.sendLength;
+      memcpy(frame + headerLength, prefix, prefixLength);
+      uint8_t* dest = frame + headerLength + prefixLength;
+      uint32_t offset = rec.start & (WS_LOG_RING_SIZE - 1);
+      size_t first = rec.length;
+      if( first > WS_LOG_RING_SIZE - offset ) {
+        first = WS_LOG_RING_SIZE - offset;
+      }
+      memcpy(dest, &logData[offset], first);
+      memcpy(dest + first, logData, rec.length - first);
+
+      // If the writer has since reserved space over these bytes, they're junk
+      if( __atomic_load_n(&logDataHead, __ATOMIC_ACQUIRE) - rec.start > WS_LOG_RING_SIZE ) {
+        monitorData.webLogDrops++;
+        c.logCursor++;
+        continue;
+      }
+
+      frame[0] = 0x81;
+      if( headerLength == 2 ) {
+        frame[1] = payloadLength;
+      } else {
+        frame[1] = 126;
+        frame[2] = payloadLength >> 8;
+        frame[3] = payloadLength & 0xff;
+      }
+      c.sendLength += total;
+      c.logCursor++;
     }
+}
 
-    header[1] = chunkSize;  // Payload length
-    client.write(header, 2);
-    client.write((uint8_t*)(message + pos), chunkSize);
 
-    pos += chunkSize;
-    isFirstFrame = false;
+//////////////////////////////////////////////////////////////////////////////////////////
+// Producer side, called from the stratum task and anything else that logs.
+// Reserve the bytes first so a reader can tell if a line it is copying got
+// overwritten, then fill them in and publish the record. Writers take the
+// lock for all three, so two lines never share bytes or a record slot.
+//////////////////////////////////////////////////////////////////////////////////////////
+void PlainWebSocket::broadcast(const char* color, const char* message, size_t length) {
+  if( length > WS_MAX_LOG_LINE ) {
+    length = WS_MAX_LOG_LINE;
+  }
+
+  portENTER_CRITICAL(&logWriteMux);
+  uint32_t start = logDataHead;
+  __atomic_store_n(&logDataHead, start + length, __ATOMIC_RELEASE);
+
+  uint32_t offset = start & (WS_LOG_RING_SIZE - 1);
+  size_t first = length;
+  if( first > WS_LOG_RING_SIZE - offset ) {
+    first = WS_LOG_RING_SIZE - offset;
+  }
+  memcpy(&logData[offset], message, first);
+  memcpy(logData, message + first, length - first);
+
+  uint32_t record = logRecordHead;
+  WebLogRecord& rec = logRecords[record & (WS_LOG_RECORDS - 1)];
+  rec.start = start;
+  rec.length = length;
+  rec.color = color;
+  __atomic_store_n(&logRecordHead, record + 1, __ATOMIC_RELEASE);
+  portEXIT_CRITICAL(&logWriteMux);
+
+  if( taskHandle ) {
+    xTaskNotifyGive(taskHandle);
   }
 }
 
-void PlainWebSocket::sendMessage(WiFiClient& client, const char* message, size_t length) {
-  sendMessage(client, NULL, message, length);
-}
\ No newline at end of file
+void PlainWebSocket::broadcast(const char* message, size_t length) {
+  broadcast(NULL, message, length);
+}
+
+void PlainWebSocket::broadcast(const String& message) {
+  broadcast(NULL, message.c_str(), message.length());
+}
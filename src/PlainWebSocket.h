@@ -16,9 +16,42 @@
 #define PLAINWEBSOCKET_H
 
 #include <WiFi.h>
+#include "monitor.h"
 
 #define MAX_CLIENTS 5
 
+// Channels a client can subscribe to by sending "subscribe <name>" or
+// "unsubscribe <name>". New clients start on the log channel.
+#define WS_CHANNEL_LOG 1
+#define WS_CHANNEL_STATUS 2
+
+#define WS_MAX_INCOMING 125
+#define WS_STATUS_MESSAGE_SIZE 800
+
+// Log lines are appended to a ring by whichever task logs them and copied
+// out to each client's send buffer by the websocket task. Sizes must be powers of two.
+#define WS_LOG_RING_SIZE 8192
+#define WS_LOG_RECORDS 64
+#define WS_LOG_BACKLOG 20
+#define WS_MAX_LOG_LINE 1400
+#define WS_CLIENT_BUFFER_SIZE 1536
+
+typedef struct {
+    uint32_t start;          // Absolute position in the data ring
+    uint16_t length;
+    const char* color;       // Static string or NULL
+} WebLogRecord;
+
+typedef struct {
+    WiFiClient client;
+    uint8_t channels;
+    bool statusPrimed;
+    uint32_t logCursor;      // Next log record to send
+    uint16_t sendLength;
+    uint16_t sendOffset;
+    uint8_t sendBuffer[WS_CLIENT_BUFFER_SIZE];
+} WebSocketClient;
+
 
 class PlainWebSocket {
 public:
@@ -28,18 +61,40 @@ public:
     void broadcast(const String& message);
     void broadcast(const char* message, size_t length);
     void broadcast(const char* color, const char* message, size_t length);
+    void statusPublished();
 
 private:
     WiFiServer server;
-    WiFiClient clients[MAX_CLIENTS];
+    WebSocketClient clients[MAX_CLIENTS];
     void (*messageCallback)(String) = nullptr;
+    TaskHandle_t taskHandle = NULL;
+
+    // Writers move the heads one at a time, under a lock; readers don't
+    // take it, and check afterwards that what they copied was not overwritten.
+    char logData[WS_LOG_RING_SIZE];
+    WebLogRecord logRecords[WS_LOG_RECORDS];
+    volatile uint32_t logDataHead = 0;
+    volatile uint32_t logRecordHead = 0;
+
+    // Last snapshot pushed on the status channel, used to work out deltas
+    uint32_t lastStatusVersion = 0;
+    uint8_t lastStatusFieldCount = 0;
+    uint16_t lastStatusFieldStart[STATUS_FIELD_COUNT];
+    uint16_t lastStatusFieldLength[STATUS_FIELD_COUNT];
+    char lastStatusFields[STATUS_SNAPSHOT_SIZE];
+    char statusMessage[WS_STATUS_MESSAGE_SIZE];
 
     static void websocketTask(void* pvParameters);
-    void handleClient(WiFiClient& client);
+    void acceptClient(WiFiClient& newClient);
+    void handleClient(int index);
+    void handleCommand(int index, const char* command);
+    void pushStatus();
+    void pumpLog(int index);
+    bool flushClient(int index);
+    void closeClient(int index);
+    size_t buildStatusMessage(const StatusSnapshot* snapshot, bool full);
+    bool queueFrame(int index, uint8_t opcode, const char* prefix, const char* payload, size_t length);
     static void performHandshake(WiFiClient& client, const String& request);
-    void sendMessage(WiFiClient& client, const String& message);
-    void sendMessage(WiFiClient& client, const char* message, size_t length);
-    void sendMessage(WiFiClient& client, const char* color, const char* message, size_t length);
 
     static void base64_encode(String& output, const char* input, size_t len) {
       const char* base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
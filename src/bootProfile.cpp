@@ -0,0 +1,72 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "defines_n_types.h"
+#include "bootProfile.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Boot profile.
+//
+// When each stage of getting from power on to the first accepted share
+// finished, in ms since the app started. Only the first time counts, so a
+// later reconnect doesn't move anything. Read back on the serial port with
+// "list boot", in /statusJson and on /metrics.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// 0 until the phase is reached
+static volatile uint32_t phaseMs[BOOT_PHASE_COUNT];
+
+static const char* phaseNames[BOOT_PHASE_COUNT] = {
+  "setup", "settings", "wifi_started", "tasks", "display",
+  "self_test", "wifi_up", "pool", "first_job", "first_share"
+};
+
+
+// Safe from any task
+void bootMark(uint8_t phase) {
+  if( phase >= BOOT_PHASE_COUNT || phaseMs[phase] ) {
+    return;
+  }
+  uint32_t ms = (uint32_t) (esp_timer_get_time() / 1000);
+  uint32_t expected = 0;
+  if( __atomic_compare_exchange_n(&phaseMs[phase], &expected, ms ? ms : 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) ) {
+    dbg("Boot: %s at %lu ms\n", phaseNames[phase], (unsigned long) ms);
+  }
+}
+
+uint32_t bootPhaseMs(uint8_t phase) {
+  return phase < BOOT_PHASE_COUNT ? phaseMs[phase] : 0;
+}
+
+const char* bootPhaseName(uint8_t phase) {
+  return phase < BOOT_PHASE_COUNT ? phaseNames[phase] : "unknown";
+}
+
+// {"setup": 12, "settings": 48, ...} with only the phases reached so far
+size_t bootPhasesJson(char* dest, size_t size) {
+  size_t len = snprintf(dest, size, "{");
+  bool first = true;
+  for( uint8_t i = 0; i < BOOT_PHASE_COUNT && len < size; i++ ) {
+    if( phaseMs[i] ) {
+      len += snprintf(dest + len, size - len, "%s\"%s\": %lu", first ? "" : ", ", phaseNames[i], (unsigned long) phaseMs[i]);
+      first = false;
+    }
+  }
+  if( len < size ) {
+    len += snprintf(dest + len, size - len, "}");
+  }
+  return len < size ? len : size - 1;
+}
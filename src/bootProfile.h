@@ -0,0 +1,39 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <Arduino.h>
+
+// Boot phases, in the order they usually finish. Not all of them happen on
+// every boot; access point mode never gets past the tasks, for one.
+#define BOOT_SETUP 0            // setup() entered
+#define BOOT_SETTINGS 1         // NVS and SD card settings loaded
+#define BOOT_WIFI_STARTED 2     // Station connect under way
+#define BOOT_TASKS 3            // Every task created
+#define BOOT_DISPLAY 4          // Display up and the first screen drawn
+#define BOOT_SELF_TEST 5        // Miners checked against the genesis block
+#define BOOT_WIFI_UP 6          // Got an address
+#define BOOT_POOL 7             // Subscribed to a pool
+#define BOOT_FIRST_JOB 8        // Hashing the pool's first job
+#define BOOT_FIRST_SHARE 9      // Pool accepted the first share
+#define BOOT_PHASE_COUNT 10
+
+void bootMark(uint8_t phase);
+uint32_t bootPhaseMs(uint8_t phase);
+const char* bootPhaseName(uint8_t phase);
+size_t bootPhasesJson(char* dest, size_t size);
+
+#endif
@@ -0,0 +1,66 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "chunkWriter.h"
+
+
+ChunkWriter::ChunkWriter(char* buffer, size_t size, ChunkFlushCallback flush) :
+  flushes(0), buffer(buffer), size(size), len(0), flush(flush) {
+}
+
+void ChunkWriter::append(const char* s, size_t n) {
+  while( n ) {
+    if( len == size ) {
+      flush(buffer, len);
+      flushes++;
+      len = 0;
+    }
+    size_t chunk = size - len;
+    if( chunk > n ) {
+      chunk = n;
+    }
+    memcpy(buffer + len, s, chunk);
+    len += chunk;
+    s += chunk;
+    n -= chunk;
+  }
+}
+
+void ChunkWriter::append(char c) {
+  if( len == size ) {
+    flush(buffer, len);
+    flushes++;
+    len = 0;
+  }
+  buffer[len++] = c;
+}
+
+void ChunkWriter::appendUnsigned(uint64_t v) {
+  char digits[21];
+  int pos = sizeof(digits);
+  do {
+    digits[--pos] = '0' + (v % 10);
+    v /= 10;
+  } while( v );
+  append(&digits[pos], sizeof(digits) - pos);
+}
+
+void ChunkWriter::finish() {
+  if( len ) {
+    flush(buffer, len);
+    flushes++;
+    len = 0;
+  }
+}
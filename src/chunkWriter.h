@@ -0,0 +1,43 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef CHUNK_WRITER_H
+#define CHUNK_WRITER_H
+
+#include <Arduino.h>
+
+typedef void (*ChunkFlushCallback)(const char* data, size_t len);
+
+// Fills a caller supplied buffer and hands it to the flush callback whenever
+// it's full, and once more from finish(). Nothing is allocated. The metrics
+// writer and the page template renderer both build on it.
+class ChunkWriter {
+  public:
+    ChunkWriter(char* buffer, size_t size, ChunkFlushCallback flush);
+
+    void append(const char* s, size_t n);
+    void append(char c);
+    void appendUnsigned(uint64_t v);
+    void finish();
+
+    uint32_t flushes;
+
+  private:
+    char* buffer;
+    size_t size;
+    size_t len;
+    ChunkFlushCallback flush;
+};
+
+#endif
@@ -0,0 +1,443 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "MinerSha256.h"
+#include "cluster.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Mining cluster.
+//
+// One miner, the leader, holds the pool session. Followers on the same
+// network find it by broadcasting a hello, and from then on it sends each
+// of them a block header of their own: the pool's job with the follower's
+// byte at the front of extranonce2, so no two of them ever hash the same
+// thing. Followers send back nonces that beat the difficulty they were
+// given, the leader checks each one and passes it up to the pool.
+//
+// Every packet carries an HMAC of itself under the cluster key, so a miner
+// only listens to its own cluster. A follower stays with the leader it
+// found until that leader goes quiet.
+//
+// Nothing in here knows about tasks, settings or the radio, so a leader
+// and its followers can be run against each other on a PC.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static void fillHeader(ClusterHeader* h, uint8_t type) {
+  h->magic = CLUSTER_MAGIC;
+  h->version = CLUSTER_PROTOCOL_VERSION;
+  h->type = type;
+}
+
+// HMAC-SHA256 of a message under the cluster key, cut to CLUSTER_TAG_SIZE
+static void packetTag(const uint8_t* key, const uint8_t* data, size_t len, uint8_t* tag) {
+  uint8_t buf[64 + CLUSTER_PACKET_SIZE];
+  miner_sha256_hash inner, outer;
+
+  for( uint8_t i = 0; i < 64; i++ ) {
+    buf[i] = (i < CLUSTER_KEY_SIZE ? key[i] : 0) ^ 0x36;
+  }
+  memcpy(&buf[64], data, len);
+  sha256(&inner, buf, 64 + len);
+
+  for( uint8_t i = 0; i < 64; i++ ) {
+    buf[i] = (i < CLUSTER_KEY_SIZE ? key[i] : 0) ^ 0x5c;
+  }
+  memcpy(&buf[64], inner.bytes, 32);
+  sha256(&outer, buf, 96);
+  memcpy(tag, outer.bytes, CLUSTER_TAG_SIZE);
+}
+
+// To one peer, or to everyone when to is NULL
+static bool sendPacket(ClusterTransport* t, const uint8_t* key, const ClusterPeer* to, const void* msg, size_t len) {
+  uint8_t data[CLUSTER_PACKET_SIZE];
+  if( len + CLUSTER_TAG_SIZE > sizeof(data) ) {
+    return false;
+  }
+  memcpy(data, msg, len);
+  packetTag(key, data, len, &data[len]);
+  len += CLUSTER_TAG_SIZE;
+  return to ? t->send(*to, data, len) : t->broadcast(data, len);
+}
+
+// Type of a packet we understand from our own cluster, 0 otherwise. A good
+// packet has its length cut to the message, without the tag.
+static uint8_t packetType(const uint8_t* key, const uint8_t* data, size_t& len) {
+  const ClusterHeader* h = (const ClusterHeader*) data;
+  if( len < sizeof(ClusterHeader) + CLUSTER_TAG_SIZE || h->magic != CLUSTER_MAGIC || h->version != CLUSTER_PROTOCOL_VERSION ) {
+    return 0;
+  }
+  len -= CLUSTER_TAG_SIZE;
+  uint8_t tag[CLUSTER_TAG_SIZE];
+  uint8_t differs = 0;
+  packetTag(key, data, len, tag);
+  for( uint8_t i = 0; i < CLUSTER_TAG_SIZE; i++ ) {
+    differs |= tag[i] ^ data[len + i];
+  }
+  if( differs ) {
+    return 0;
+  }
+  switch( h->type ) {
+    case CLUSTER_MSG_HELLO: return len == sizeof(ClusterHeader) ? h->type : 0;
+    case CLUSTER_MSG_JOB:   return len == sizeof(ClusterJobMsg) ? h->type : 0;
+    case CLUSTER_MSG_SHARE: return len == sizeof(ClusterShareMsg) ? h->type : 0;
+    case CLUSTER_MSG_STATS: return len == sizeof(ClusterStatsMsg) ? h->type : 0;
+  }
+  return 0;
+}
+
+static bool samePeer(const ClusterPeer& a, const ClusterPeer& b) {
+  return memcmp(a.addr, b.addr, sizeof(a.addr)) == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Leader
+//////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterLeader::begin(ClusterTransport* t, const uint8_t* k) {
+  transport = t;
+  memcpy(key, k, CLUSTER_KEY_SIZE);
+  memset(members, 0, sizeof(members));
+  clearJobs();
+  shareCount = 0;
+}
+
+void ClusterLeader::end() {
+  transport = NULL;
+  memset(members, 0, sizeof(members));
+  clearJobs();
+  shareCount = 0;
+}
+
+void ClusterLeader::setDifficulty(double d) {
+  difficulty = d;
+}
+
+ClusterLeaderJob* ClusterLeader::currentJob() {
+  ClusterLeaderJob* j = &jobs[(nextJob + CLUSTER_LEADER_JOBS - 1) % CLUSTER_LEADER_JOBS];
+  return j->seq ? j : NULL;
+}
+
+// Shares already checked stay queued; they go up with the next poll
+void ClusterLeader::clearJobs() {
+  for( uint8_t i = 0; i < CLUSTER_LEADER_JOBS; i++ ) {
+    jobs[i].seq = 0;
+  }
+}
+
+void ClusterLeader::setJob(const JobTemplate* job, const char* extraNonce1, uint8_t extraNonce2Size, bool clean) {
+  if( clean ) {
+    clearJobs();
+  }
+  if( extraNonce2Size < 2 || extraNonce2Size > 8 || strlen(extraNonce1) >= STRATUM_EXTRANONCE1_LENGTH ) {
+    return;
+  }
+
+  ClusterLeaderJob* j = &jobs[nextJob];
+  nextJob = (nextJob + 1) % CLUSTER_LEADER_JOBS;
+  memcpy(&j->job, job, sizeof(JobTemplate));
+  safeStrnCpy(j->extraNonce1, extraNonce1, sizeof(j->extraNonce1));
+  j->extraNonce2Size = extraNonce2Size;
+  j->difficulty = difficulty;
+  j->clean = clean;
+  if( ! ++seq ) {
+    seq++;                            // 0 means no job
+  }
+  j->seq = seq;
+
+  for( uint8_t i = 0; i < CLUSTER_MAX_FOLLOWERS; i++ ) {
+    if( members[i].active ) {
+      sendJob(&members[i]);
+    }
+  }
+}
+
+void ClusterLeader::sendJob(ClusterMember* m) {
+  ClusterLeaderJob* j = currentJob();
+  if( ! j || ! transport ) {
+    return;
+  }
+
+  uint8_t prefix = CLUSTER_PREFIX_BASE + (m - members);
+  uint8_t extraNonce2[8] = { prefix };
+
+  ClusterJobMsg msg;
+  fillHeader(&msg.h, CLUSTER_MSG_JOB);
+  msg.seq = j->seq;
+  msg.clean = j->clean || m->sentSeq == 0;
+  msg.prefix = prefix;
+  msg.difficulty = j->difficulty;
+  if( ! jobTemplateHeader(&j->job, j->extraNonce1, extraNonce2, j->extraNonce2Size, j->job.ntime, 0, msg.header) ) {
+    return;
+  }
+
+  if( sendPacket(transport, key, &m->peer, &msg, sizeof(msg)) ) {
+    m->sentSeq = j->seq;
+    jobsSent++;
+  }
+}
+
+ClusterMember* ClusterLeader::findMember(const ClusterPeer& peer, bool add, uint32_t now) {
+  ClusterMember* free = NULL;
+  for( uint8_t i = 0; i < CLUSTER_MAX_FOLLOWERS; i++ ) {
+    ClusterMember* m = &members[i];
+    if( m->active && samePeer(m->peer, peer) ) {
+      m->lastHeard = now;
+      return m;
+    }
+    if( ! m->active && ! free ) {
+      free = m;
+    }
+  }
+  if( ! add || ! free ) {
+    return NULL;
+  }
+
+  memcpy(&free->peer, &peer, sizeof(peer));
+  free->active = true;
+  free->lastHeard = now;
+  free->sentSeq = 0;
+  free->hashRate = NAN;
+  dbg("Cluster: follower %u joined\n", (unsigned) (free - members));
+  return free;
+}
+
+void ClusterLeader::handleShare(ClusterMember* m, const ClusterShareMsg* msg) {
+  ClusterLeaderJob* j = NULL;
+  for( uint8_t i = 0; i < CLUSTER_LEADER_JOBS && ! j; i++ ) {
+    if( jobs[i].seq && jobs[i].seq == msg->seq ) {
+      j = &jobs[i];
+    }
+  }
+  if( ! j ) {
+    sharesStale++;
+    return;
+  }
+
+  uint8_t extraNonce2[8] = { (uint8_t) (CLUSTER_PREFIX_BASE + (m - members)) };
+  uint8_t header[80];
+  uint8_t hash[32];
+  if( ! jobTemplateHeader(&j->job, j->extraNonce1, extraNonce2, j->extraNonce2Size, msg->ntime, msg->nonce, header) ) {
+    sharesInvalid++;
+    return;
+  }
+  double d = jobTemplateHash(header, hash);
+  if( d < j->difficulty ) {
+    sharesInvalid++;
+    return;
+  }
+  for( uint8_t i = 0; i < CLUSTER_RECENT_SHARES; i++ ) {
+    if( memcmp(recent[i], hash, 8) == 0 ) {
+      sharesInvalid++;
+      return;
+    }
+  }
+  memcpy(recent[nextRecent], hash, 8);
+  nextRecent = (nextRecent + 1) % CLUSTER_RECENT_SHARES;
+
+  if( shareCount >= CLUSTER_SHARE_QUEUE ) {
+    sharesStale++;
+    return;
+  }
+  ClusterShare* s = &shares[(shareHead + shareCount++) % CLUSTER_SHARE_QUEUE];
+  safeStrnCpy(s->jobId, j->job.jobId, sizeof(s->jobId));
+  bin2hex(s->extraNonce2, extraNonce2, j->extraNonce2Size);
+  s->ntime = msg->ntime;
+  s->nonce = msg->nonce;
+  s->difficulty = d;
+  s->flags = 0;
+  if( ! hash[31] && ! hash[30] && ! hash[29] && ! hash[28] ) {
+    s->flags |= SUBMIT_FLAG_32BIT;
+  }
+  if( d >= jobTemplateNetworkDifficulty(&j->job) ) {
+    s->flags |= SUBMIT_FLAG_BLOCK_SOLUTION;
+  }
+  sharesValid++;
+}
+
+void ClusterLeader::poll(uint32_t now) {
+  if( ! transport ) {
+    return;
+  }
+
+  uint8_t data[CLUSTER_PACKET_SIZE];
+  ClusterPeer from;
+  size_t len;
+  while( (len = transport->receive(from, data, sizeof(data))) > 0 ) {
+    uint8_t type = packetType(key, data, len);
+    if( ! type ) {
+      packetsRejected++;
+    } else if( type == CLUSTER_MSG_HELLO ) {
+      // A follower that restarted says hello again and needs its job again
+      ClusterMember* m = findMember(from, true, now);
+      if( m ) {
+        sendJob(m);
+      }
+    } else if( type == CLUSTER_MSG_SHARE ) {
+      ClusterMember* m = findMember(from, false, now);
+      if( m ) {
+        handleShare(m, (const ClusterShareMsg*) data);
+      }
+    } else if( type == CLUSTER_MSG_STATS ) {
+      ClusterMember* m = findMember(from, true, now);
+      const ClusterStatsMsg* msg = (const ClusterStatsMsg*) data;
+      if( m && msg->elapsedMs ) {
+        double rate = (double) msg->hashes / msg->elapsedMs;
+        m->hashRate = isnan(m->hashRate) ? rate : m->hashRate + (rate - m->hashRate) / CLUSTER_RATE_WEIGHT;
+        ClusterLeaderJob* j = currentJob();
+        if( j && m->sentSeq != j->seq ) {
+          sendJob(m);
+        }
+      }
+    }
+  }
+
+  for( uint8_t i = 0; i < CLUSTER_MAX_FOLLOWERS; i++ ) {
+    if( members[i].active && now - members[i].lastHeard > CLUSTER_FOLLOWER_TIMEOUT_MS ) {
+      dbg("Cluster: follower %u went quiet\n", i);
+      members[i].active = false;
+      transport->forget(members[i].peer);
+    }
+  }
+}
+
+bool ClusterLeader::nextShare(ClusterShare& share) {
+  if( ! shareCount ) {
+    return false;
+  }
+  memcpy(&share, &shares[shareHead], sizeof(share));
+  shareHead = (shareHead + 1) % CLUSTER_SHARE_QUEUE;
+  shareCount--;
+  return true;
+}
+
+uint8_t ClusterLeader::followers() {
+  uint8_t count = 0;
+  for( uint8_t i = 0; i < CLUSTER_MAX_FOLLOWERS; i++ ) {
+    count += members[i].active;
+  }
+  return count;
+}
+
+double ClusterLeader::hashRate() {
+  double total = 0;
+  for( uint8_t i = 0; i < CLUSTER_MAX_FOLLOWERS; i++ ) {
+    if( members[i].active && ! isnan(members[i].hashRate) ) {
+      total += members[i].hashRate;
+    }
+  }
+  return total;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Follower
+//////////////////////////////////////////////////////////////////////////////////////////
+
+void ClusterFollower::begin(ClusterTransport* t, const uint8_t* k) {
+  transport = t;
+  memcpy(key, k, CLUSTER_KEY_SIZE);
+  hasJob = false;
+  lastHelloAt = 0;
+  lastStatsAt = 0;
+}
+
+void ClusterFollower::end() {
+  transport = NULL;
+  hasJob = false;
+}
+
+const ClusterJob* ClusterFollower::job() {
+  return hasJob ? &current : NULL;
+}
+
+bool ClusterFollower::poll(uint32_t now, uint64_t hashes) {
+  if( ! transport ) {
+    return false;
+  }
+  bool changed = false;
+
+  uint8_t data[CLUSTER_PACKET_SIZE];
+  ClusterPeer from;
+  size_t len;
+  while( (len = transport->receive(from, data, sizeof(data))) > 0 ) {
+    if( packetType(key, data, len) != CLUSTER_MSG_JOB ) {
+      continue;
+    }
+    // Once we have a leader, nobody else's work until it goes quiet
+    if( hasJob && ! samePeer(from, leader) ) {
+      jobsIgnored++;
+      continue;
+    }
+    const ClusterJobMsg* msg = (const ClusterJobMsg*) data;
+    lastHeardAt = now;
+    if( hasJob && msg->seq == current.seq ) {
+      continue;
+    }
+    memcpy(&leader, &from, sizeof(leader));
+    current.seq = msg->seq;
+    current.clean = msg->clean;
+    current.prefix = msg->prefix;
+    current.difficulty = msg->difficulty;
+    memcpy(current.header, msg->header, sizeof(current.header));
+    hasJob = true;
+    jobsReceived++;
+    changed = true;
+  }
+
+  if( hasJob && now - lastHeardAt > CLUSTER_LEADER_TIMEOUT_MS ) {
+    dbg("Cluster: nothing from the leader, looking again\n");
+    transport->forget(leader);
+    hasJob = false;
+    changed = true;
+  }
+
+  if( ! hasJob ) {
+    if( ! lastHelloAt || now - lastHelloAt >= CLUSTER_HELLO_MS ) {
+      ClusterHeader hello;
+      fillHeader(&hello, CLUSTER_MSG_HELLO);
+      sendPacket(transport, key, NULL, &hello, sizeof(hello));
+      lastHelloAt = now;
+    }
+    lastStatsAt = now;
+    lastHashes = hashes;
+  } else if( now - lastStatsAt >= CLUSTER_STATS_MS ) {
+    ClusterStatsMsg msg;
+    fillHeader(&msg.h, CLUSTER_MSG_STATS);
+    msg.hashes = (uint32_t) (hashes - lastHashes);
+    msg.elapsedMs = now - lastStatsAt;
+    sendPacket(transport, key, &leader, &msg, sizeof(msg));
+    lastStatsAt = now;
+    lastHashes = hashes;
+  }
+
+  return changed;
+}
+
+bool ClusterFollower::submit(uint32_t seq, uint32_t ntime, uint32_t nonce) {
+  if( ! transport || ! hasJob ) {
+    return false;
+  }
+  ClusterShareMsg msg;
+  fillHeader(&msg.h, CLUSTER_MSG_SHARE);
+  msg.seq = seq;
+  msg.ntime = ntime;
+  msg.nonce = nonce;
+  if( ! sendPacket(transport, key, &leader, &msg, sizeof(msg)) ) {
+    return false;
+  }
+  sharesSent++;
+  return true;
+}
@@ -0,0 +1,180 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include <Arduino.h>
+#include "stratum.h"
+#include "jobTemplate.h"
+#include "clusterTransport.h"
+
+#define CLUSTER_ROLE_OFF 0
+#define CLUSTER_ROLE_LEADER 1             // Holds the pool session and hands out work
+#define CLUSTER_ROLE_FOLLOWER 2           // Mines what the leader sends, no pool of its own
+
+#define CLUSTER_MAGIC 0x4342
+#define CLUSTER_PROTOCOL_VERSION 2
+#define CLUSTER_KEY_SIZE 32               // From the cluster key setting; every member has to have the same one
+#define CLUSTER_TAG_SIZE 8                // HMAC-SHA256 of the packet, cut short, after the message
+
+#define CLUSTER_MSG_HELLO 1               // Follower, broadcast: looking for work
+#define CLUSTER_MSG_JOB 2                 // Leader to follower
+#define CLUSTER_MSG_SHARE 3               // Follower to leader
+#define CLUSTER_MSG_STATS 4               // Follower to leader; also says it's still there
+
+#define CLUSTER_MAX_FOLLOWERS 16
+#define CLUSTER_PREFIX_BASE 0x80          // First extranonce2 byte of follower 0; the stratum server has 1 and up
+#define CLUSTER_LEADER_JOBS 4             // Recent jobs kept for checking shares
+#define CLUSTER_SHARE_QUEUE 8
+#define CLUSTER_RECENT_SHARES 16
+#define CLUSTER_HELLO_MS 2000
+#define CLUSTER_STATS_MS 10000
+#define CLUSTER_FOLLOWER_TIMEOUT_MS 35000 // Three missed reports
+#define CLUSTER_LEADER_TIMEOUT_MS 180000  // Nothing from the leader for this long and the follower stops and looks again
+#define CLUSTER_RATE_WEIGHT 4
+
+// On the wire, little-endian, one per packet, each followed by its tag
+typedef struct __attribute__((packed)) {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t type;
+} ClusterHeader;
+
+// The whole header rather than a midstate: the ESP32's SHA hardware
+// hashes from the block itself, and it still fits an ESP-NOW frame
+typedef struct __attribute__((packed)) {
+  ClusterHeader h;
+  uint32_t seq;
+  uint8_t clean;
+  uint8_t prefix;                 // The follower's share of the extranonce2 space
+  double difficulty;              // Shares below this aren't worth sending
+  uint8_t header[80];             // Nonce left at 0; the follower owns all 2^32
+} ClusterJobMsg;
+
+typedef struct __attribute__((packed)) {
+  ClusterHeader h;
+  uint32_t seq;
+  uint32_t ntime;
+  uint32_t nonce;
+} ClusterShareMsg;
+
+typedef struct __attribute__((packed)) {
+  ClusterHeader h;
+  uint32_t hashes;                // Since the last report
+  uint32_t elapsedMs;
+} ClusterStatsMsg;
+
+// A follower's share that checked out, ready to go to the pool
+typedef struct {
+  char jobId[MAX_JOB_ID_LENGTH];
+  char extraNonce2[20];
+  uint32_t ntime;
+  uint32_t nonce;
+  uint32_t flags;                 // SUBMIT_FLAG_*
+  double difficulty;
+} ClusterShare;
+
+// The work a follower has from its leader
+typedef struct {
+  uint32_t seq;
+  bool clean;
+  uint8_t prefix;
+  double difficulty;
+  uint8_t header[80];
+} ClusterJob;
+
+typedef struct {
+  ClusterPeer peer;
+  bool active;
+  uint32_t lastHeard;
+  uint32_t sentSeq;
+  double hashRate;                // Hashes per ms, from its reports
+} ClusterMember;
+
+typedef struct {
+  uint32_t seq;
+  bool clean;
+  JobTemplate job;
+  char extraNonce1[STRATUM_EXTRANONCE1_LENGTH];
+  uint8_t extraNonce2Size;
+  double difficulty;
+} ClusterLeaderJob;
+
+class ClusterLeader {
+public:
+    void begin(ClusterTransport* transport, const uint8_t* key);
+    void end();
+    void setDifficulty(double difficulty);
+    // extraNonce2Size has to be 2 or more; followers get the first byte
+    void setJob(const JobTemplate* job, const char* extraNonce1, uint8_t extraNonce2Size, bool clean);
+    void clearJobs();
+    void poll(uint32_t now);
+    bool nextShare(ClusterShare& share);
+    uint8_t followers();
+    double hashRate();
+
+    uint32_t jobsSent = 0;
+    uint32_t sharesValid = 0;
+    uint32_t sharesInvalid = 0;
+    uint32_t sharesStale = 0;
+    uint32_t packetsRejected = 0;   // Bad tag: another cluster, or not a cluster at all
+
+private:
+    ClusterLeaderJob* currentJob();
+    ClusterMember* findMember(const ClusterPeer& peer, bool add, uint32_t now);
+    void sendJob(ClusterMember* m);
+    void handleShare(ClusterMember* m, const ClusterShareMsg* msg);
+
+    ClusterTransport* transport = NULL;
+    uint8_t key[CLUSTER_KEY_SIZE];
+    ClusterMember members[CLUSTER_MAX_FOLLOWERS];
+    ClusterLeaderJob jobs[CLUSTER_LEADER_JOBS];
+    uint8_t nextJob = 0;
+    uint32_t seq = 0;
+    double difficulty = 1.0;
+    ClusterShare shares[CLUSTER_SHARE_QUEUE];
+    uint8_t shareHead = 0;
+    uint8_t shareCount = 0;
+    uint8_t recent[CLUSTER_RECENT_SHARES][8];
+    uint8_t nextRecent = 0;
+};
+
+class ClusterFollower {
+public:
+    void begin(ClusterTransport* transport, const uint8_t* key);
+    void end();
+    // True when the job changed: a new one came in, or the leader went quiet
+    bool poll(uint32_t now, uint64_t hashes);
+    // NULL when there's nothing to mine
+    const ClusterJob* job();
+    bool submit(uint32_t seq, uint32_t ntime, uint32_t nonce);
+
+    uint32_t jobsReceived = 0;
+    uint32_t jobsIgnored = 0;       // From a leader other than ours
+    uint32_t sharesSent = 0;
+
+private:
+    ClusterTransport* transport = NULL;
+    uint8_t key[CLUSTER_KEY_SIZE];
+    ClusterPeer leader;
+    bool hasJob = false;
+    ClusterJob current;
+    uint32_t lastHeardAt = 0;       // From our leader
+    uint32_t lastHelloAt = 0;
+    uint32_t lastStatsAt = 0;
+    uint64_t lastHashes = 0;
+};
+
+#endif
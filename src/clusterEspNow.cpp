@@ -0,0 +1,132 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_now.h>
+#include "defines_n_types.h"
+#include "clusterTransport.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Cluster over ESP-NOW.
+//
+// Packets arrive on the WiFi task's callback, which only queues them; the
+// cluster task takes them off the queue when it polls. Peers are added the
+// first time we send to them and deleted when they go quiet, since the
+// radio only has room for 20.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  ClusterPeer from;
+  uint8_t length;
+  uint8_t data[CLUSTER_PACKET_SIZE];
+} EspNowPacket;
+
+static const uint8_t broadcastMac[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+static StaticQueue_t packetQueueBuffer;
+static uint8_t packetQueueStorage[CLUSTER_RECEIVE_QUEUE * sizeof(EspNowPacket)];
+static QueueHandle_t packetQueue = NULL;
+
+
+static void queuePacket(const uint8_t* mac, const uint8_t* data, int len) {
+  if( ! packetQueue || len <= 0 || len > CLUSTER_PACKET_SIZE ) {
+    return;
+  }
+  EspNowPacket p;
+  memcpy(p.from.addr, mac, 6);
+  p.length = len;
+  memcpy(p.data, data, len);
+  xQueueSend(packetQueue, &p, 0);
+}
+
+#if ESP_ARDUINO_VERSION < ESP_ARDUINO_VERSION_VAL(3, 0, 0)
+static void received(const uint8_t* mac, const uint8_t* data, int len) {
+  queuePacket(mac, data, len);
+}
+#else
+static void received(const esp_now_recv_info_t* info, const uint8_t* data, int len) {
+  queuePacket(info->src_addr, data, len);
+}
+#endif
+
+static bool addPeer(const uint8_t* mac) {
+  if( esp_now_is_peer_exist(mac) ) {
+    return true;
+  }
+  esp_now_peer_info_t peer;
+  memset(&peer, 0, sizeof(peer));
+  memcpy(peer.peer_addr, mac, 6);
+  peer.channel = 0;           // Whatever channel the access point has us on
+  peer.ifidx = WIFI_IF_STA;
+  peer.encrypt = false;
+  return esp_now_add_peer(&peer) == ESP_OK;
+}
+
+bool EspNowTransport::begin() {
+  if( started ) {
+    return true;
+  }
+  if( ! packetQueue ) {
+    packetQueue = xQueueCreateStatic(CLUSTER_RECEIVE_QUEUE, sizeof(EspNowPacket), packetQueueStorage, &packetQueueBuffer);
+  }
+  if( esp_now_init() != ESP_OK ) {
+    dbg("Cluster: ESP-NOW didn't start\n");
+    return false;
+  }
+  esp_now_register_recv_cb(received);
+  addPeer(broadcastMac);
+  started = true;
+  return true;
+}
+
+void EspNowTransport::end() {
+  if( started ) {
+    esp_now_unregister_recv_cb();
+    esp_now_deinit();
+    xQueueReset(packetQueue);
+    started = false;
+  }
+}
+
+bool EspNowTransport::send(const ClusterPeer& to, const uint8_t* data, size_t len) {
+  if( ! started || len > CLUSTER_PACKET_SIZE || ! addPeer(to.addr) ) {
+    return false;
+  }
+  return esp_now_send(to.addr, data, len) == ESP_OK;
+}
+
+bool EspNowTransport::broadcast(const uint8_t* data, size_t len) {
+  if( ! started || len > CLUSTER_PACKET_SIZE ) {
+    return false;
+  }
+  return esp_now_send(broadcastMac, data, len) == ESP_OK;
+}
+
+void EspNowTransport::forget(const ClusterPeer& peer) {
+  if( started && memcmp(peer.addr, broadcastMac, 6) != 0 && esp_now_is_peer_exist(peer.addr) ) {
+    esp_now_del_peer(peer.addr);
+  }
+}
+
+size_t EspNowTransport::receive(ClusterPeer& from, uint8_t* data, size_t size) {
+  EspNowPacket p;
+  if( ! started || xQueueReceive(packetQueue, &p, 0) != pdTRUE ) {
+    return 0;
+  }
+  size_t len = p.length < size ? p.length : size;
+  memcpy(&from, &p.from, sizeof(ClusterPeer));
+  memcpy(data, p.data, len);
+  return len;
+}
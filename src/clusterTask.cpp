@@ -0,0 +1,262 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "miner.h"
+#include "MinerSha256.h"
+#include "MyWiFi.h"
+#include "MyWebServer.h"
+#include "cluster.h"
+#include "clusterTask.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Cluster task.
+//
+// Runs this miner's side of the cluster in cluster.cpp, as leader or
+// follower, over ESP-NOW or UDP as the settings say. A leader gets its jobs
+// from the stratum task and puts followers' shares on the submit queue like
+// any other. A follower never talks to a pool: it mines what the leader
+// sends and its miners' shares come through here on their way back.
+//
+// The leader is shared with the stratum task, so it's only touched under
+// the mutex. Follower shares come in through a queue, since the miners
+// mustn't wait on a radio.
+//
+// Packets are tagged with a key hashed from the cluster key setting. A
+// change to the setting restarts the role with the new key.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern SetupData settings;
+extern MonitorData monitorData;
+extern QueueHandle_t stratumMessageQueueHandle;
+extern TaskHandle_t clusterTaskHandle;
+extern const char* infoMessageColor;
+
+typedef struct {
+  uint32_t seq;
+  uint32_t timestamp;
+  uint32_t nonce;
+} FollowerShare;
+
+static StaticSemaphore_t clusterMutexBuffer;
+static SemaphoreHandle_t clusterMutex = NULL;
+
+static StaticQueue_t submitQueueBuffer;
+static uint8_t submitQueueStorage[CLUSTER_SUBMIT_QUEUE * sizeof(FollowerShare)];
+static QueueHandle_t submitQueue = NULL;
+
+static ClusterLeader leader;
+static ClusterFollower follower;
+static EspNowTransport espNow;
+static UdpTransport udp;
+
+// What's running, only changed by the cluster task
+static volatile uint8_t role = CLUSTER_ROLE_OFF;
+static ClusterTransport* transport = NULL;
+static char runningKey[MAX_CLUSTER_KEY_LENGTH + 1];
+
+
+void clusterBegin() {
+  clusterMutex = xSemaphoreCreateMutexStatic(&clusterMutexBuffer);
+  submitQueue = xQueueCreateStatic(CLUSTER_SUBMIT_QUEUE, sizeof(FollowerShare), submitQueueStorage, &submitQueueBuffer);
+}
+
+void clusterJob(const JobTemplate* job, const char* extraNonce1, int extraNonce2Size, bool cleanJobs) {
+  if( role != CLUSTER_ROLE_LEADER ) {
+    return;
+  }
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  leader.setJob(job, extraNonce1, extraNonce2Size, cleanJobs);
+  xSemaphoreGive(clusterMutex);
+}
+
+void clusterDifficulty(double difficulty) {
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  leader.setDifficulty(difficulty);
+  xSemaphoreGive(clusterMutex);
+}
+
+// The pool session's work is gone, so no more follower shares for it are
+// taken. Ones the leader has already checked still go on the submit queue.
+void clusterStop() {
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  leader.clearJobs();
+  xSemaphoreGive(clusterMutex);
+}
+
+// Goes by the setting rather than what's running, so the stratum task lets
+// go of the pool as soon as it's changed
+bool clusterFollowing() {
+  return settings.clusterRole == CLUSTER_ROLE_FOLLOWER;
+}
+
+void clusterSubmit(const char* jobId, uint32_t timestamp, uint32_t nonce) {
+  FollowerShare share;
+  share.seq = strtoul(jobId, NULL, 10);
+  share.timestamp = timestamp;
+  share.nonce = nonce;
+  if( xQueueSend(submitQueue, &share, 0) != pdTRUE ) {
+    monitorData.submitQueueDrops++;
+    return;
+  }
+  if( clusterTaskHandle ) {
+    xTaskNotifyGive(clusterTaskHandle);
+  }
+}
+
+static void stopRole() {
+  if( role == CLUSTER_ROLE_OFF ) {
+    return;
+  }
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  if( role == CLUSTER_ROLE_LEADER ) {
+    leader.end();
+  } else {
+    // Whatever the miners found on the way out still goes to the leader
+    FollowerShare share;
+    while( xQueueReceive(submitQueue, &share, 0) == pdTRUE ) {
+      follower.submit(share.seq, share.timestamp, share.nonce);
+    }
+    follower.end();
+    if( isMiningClusterJob() ) {
+      stopMiningJob();
+    }
+  }
+  transport->end();
+  transport = NULL;
+  role = CLUSTER_ROLE_OFF;
+  xSemaphoreGive(clusterMutex);
+
+  monitorData.clusterFollowers = 0;
+  monitorData.clusterHashesPerSecond = NAN;
+  dbg("Cluster stopped\n");
+}
+
+static void startRole(uint8_t wanted, bool useUdp) {
+  ClusterTransport* t = useUdp ? (ClusterTransport*) &udp : &espNow;
+  if( ! t->begin() ) {
+    dbg("Cluster: couldn't start the transport\n");
+    return;
+  }
+
+  // An empty setting still gets a key, so clusters that never set one
+  // only hear each other
+  char text[MAX_CLUSTER_KEY_LENGTH + 16];
+  miner_sha256_hash key;
+  safeStrnCpy(runningKey, settings.clusterKey, sizeof(runningKey));
+  snprintf(text, sizeof(text), "BitsyCluster:%s", runningKey);
+  sha256(&key, (unsigned char*) text, strlen(text));
+
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  transport = t;
+  if( wanted == CLUSTER_ROLE_LEADER ) {
+    leader.begin(transport, key.bytes);
+    leader.setDifficulty(monitorData.poolDifficulty > 0 ? monitorData.poolDifficulty : 1.0);
+  } else {
+    follower.begin(transport, key.bytes);
+  }
+  role = wanted;
+  xSemaphoreGive(clusterMutex);
+
+  char msg[80];
+  snprintf(msg, sizeof(msg), "Cluster started as %s over %s.", wanted == CLUSTER_ROLE_LEADER ? "leader" : "follower",
+      useUdp ? "UDP" : "ESP-NOW");
+  addToWebLog(infoMessageColor, msg);
+}
+
+// Checked shares from followers go up with everyone else's
+static void leaderPass(uint32_t now) {
+  ClusterShare share;
+
+  xSemaphoreTake(clusterMutex, portMAX_DELAY);
+  leader.poll(now);
+  while( leader.nextShare(share) ) {
+    jobSubmitQueueEntry qe;
+    memset(&qe, 0, sizeof(qe));
+    safeStrnCpy(qe.jobId, share.jobId, MAX_JOB_ID_LENGTH);
+    safeStrnCpy(qe.extraNonce2, share.extraNonce2, sizeof(qe.extraNonce2));
+    qe.timestamp = share.ntime;
+    qe.nonce = share.nonce;
+    qe.submitflags = share.flags;
+    qe.difficulty = share.difficulty;
+    if( xQueueSend(stratumMessageQueueHandle, &qe, 0) != pdTRUE ) {
+      monitorData.submitQueueDrops++;
+    }
+    if( share.flags & SUBMIT_FLAG_BLOCK_SOLUTION ) {
+      addToWebLog(infoMessageColor, "Cluster: a follower found a block!");
+    }
+  }
+  monitorData.clusterFollowers = leader.followers();
+  monitorData.clusterJobsSent = leader.jobsSent;
+  monitorData.clusterSharesValid = leader.sharesValid;
+  monitorData.clusterSharesInvalid = leader.sharesInvalid;
+  monitorData.clusterSharesStale = leader.sharesStale;
+  monitorData.clusterPacketsRejected = leader.packetsRejected;
+  monitorData.clusterHashesPerSecond = leader.hashRate();
+  xSemaphoreGive(clusterMutex);
+}
+
+static void followerPass(uint32_t now) {
+  FollowerShare share;
+  while( xQueueReceive(submitQueue, &share, 0) == pdTRUE ) {
+    follower.submit(share.seq, share.timestamp, share.nonce);
+  }
+
+  bool changed = follower.poll(now, monitorData.internalHashes);
+  const ClusterJob* job = follower.job();
+
+  // The stratum task may have stopped the miners while it let go of the pool
+  if( job && (changed || ! isMiningPoolJob()) ) {
+    startClusterJob(job->header, job->seq, job->difficulty, job->clean);
+  } else if( ! job && changed ) {
+    stopMiningJob();
+  }
+  monitorData.clusterJobsReceived = follower.jobsReceived;
+  monitorData.clusterJobsIgnored = follower.jobsIgnored;
+  monitorData.clusterSharesSent = follower.sharesSent;
+}
+
+void clusterTask(void *task_id) {
+
+  // The miners may have a share for us before xTaskCreate hands the handle back
+  clusterTaskHandle = xTaskGetCurrentTaskHandle();
+  bool runningUdp = false;
+
+  while(1) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CLUSTER_POLL_MS));
+
+    // Everyone has to be on the same network, and on ESP-NOW the same channel
+    uint8_t wanted = WiFi.status() == WL_CONNECTED && ! MyWiFi::isAccessPoint() ? settings.clusterRole : CLUSTER_ROLE_OFF;
+    if( wanted != role || (role != CLUSTER_ROLE_OFF && (runningUdp != settings.clusterUdp || strcmp(runningKey, settings.clusterKey))) ) {
+      stopRole();
+      if( wanted != CLUSTER_ROLE_OFF ) {
+        runningUdp = settings.clusterUdp;
+        startRole(wanted, runningUdp);
+      }
+    }
+
+    uint32_t now = millis();
+    if( role == CLUSTER_ROLE_LEADER ) {
+      leaderPass(now);
+    } else if( role == CLUSTER_ROLE_FOLLOWER ) {
+      followerPass(now);
+    } else {
+      vTaskDelay(500 / portTICK_PERIOD_MS);
+    }
+  }
+}
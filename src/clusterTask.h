@@ -0,0 +1,37 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef CLUSTER_TASK_H
+#define CLUSTER_TASK_H
+
+#include <Arduino.h>
+#include "jobTemplate.h"
+
+#define CLUSTER_POLL_MS 20
+#define CLUSTER_SUBMIT_QUEUE 8            // Follower shares waiting to go to the leader
+
+void clusterBegin();
+void clusterTask(void *task_id);
+
+// From the stratum task, on a leader
+void clusterJob(const JobTemplate* job, const char* extraNonce1, int extraNonce2Size, bool cleanJobs);
+void clusterDifficulty(double difficulty);
+void clusterStop();
+
+// True when this miner takes its work from a leader instead of a pool
+bool clusterFollowing();
+// From the miners, for a share of a job the leader sent
+void clusterSubmit(const char* jobId, uint32_t timestamp, uint32_t nonce);
+
+#endif
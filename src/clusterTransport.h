@@ -0,0 +1,79 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef CLUSTER_TRANSPORT_H
+#define CLUSTER_TRANSPORT_H
+
+#include <Arduino.h>
+
+#define CLUSTER_PACKET_SIZE 250           // ESP-NOW's limit, which UDP keeps to as well
+#define CLUSTER_UDP_PORT 3335
+#define CLUSTER_RECEIVE_QUEUE 8
+
+// Who a packet came from or goes to: a MAC for ESP-NOW, an IPv4 address
+// and port for UDP. Either way it's only ever compared and handed back.
+typedef struct {
+  uint8_t addr[6];
+} ClusterPeer;
+
+// Moves cluster packets between miners. Nothing here knows what's in them.
+class ClusterTransport {
+public:
+    virtual ~ClusterTransport() {}
+    virtual bool begin() = 0;
+    virtual void end() = 0;
+    virtual bool send(const ClusterPeer& to, const uint8_t* data, size_t len) = 0;
+    virtual bool broadcast(const uint8_t* data, size_t len) = 0;
+    // Length of the next packet waiting, 0 if there's none. Never blocks.
+    virtual size_t receive(ClusterPeer& from, uint8_t* data, size_t size) = 0;
+    // Done with a peer that's gone quiet
+    virtual void forget(const ClusterPeer&) {}
+};
+
+#ifndef CLUSTER_HOST
+// Straight between radios, no access point involved. Everyone has to be on
+// the same channel, which they are while they share an access point.
+class EspNowTransport : public ClusterTransport {
+public:
+    bool begin();
+    void end();
+    bool send(const ClusterPeer& to, const uint8_t* data, size_t len);
+    bool broadcast(const uint8_t* data, size_t len);
+    size_t receive(ClusterPeer& from, uint8_t* data, size_t size);
+    void forget(const ClusterPeer& peer);
+
+private:
+    bool started = false;
+};
+#endif
+
+// Datagrams over the LAN. Built on plain sockets, so it runs on Linux too.
+// By default everyone binds CLUSTER_UDP_PORT and broadcasts to it.
+class UdpTransport : public ClusterTransport {
+public:
+    UdpTransport(uint16_t port = CLUSTER_UDP_PORT, uint32_t broadcastIp = 0xffffffff, uint16_t broadcastPort = CLUSTER_UDP_PORT);
+    bool begin();
+    void end();
+    bool send(const ClusterPeer& to, const uint8_t* data, size_t len);
+    bool broadcast(const uint8_t* data, size_t len);
+    size_t receive(ClusterPeer& from, uint8_t* data, size_t size);
+
+private:
+    int sock = -1;
+    uint16_t port;
+    uint32_t broadcastIp;     // Host order
+    uint16_t broadcastPort;
+};
+
+#endif
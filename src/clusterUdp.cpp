@@ -0,0 +1,117 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include "defines_n_types.h"
+#include "clusterTransport.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Cluster over UDP.
+//
+// lwIP's socket API is the BSD one, so the same code talks to the LAN on
+// the miner and to loopback on a PC, where tools/cluster_sim runs a leader
+// and its followers against each other.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static void toPeer(ClusterPeer& peer, const struct sockaddr_in& sa) {
+  memcpy(peer.addr, &sa.sin_addr.s_addr, 4);
+  memcpy(&peer.addr[4], &sa.sin_port, 2);
+}
+
+static void fromPeer(struct sockaddr_in& sa, const ClusterPeer& peer) {
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  memcpy(&sa.sin_addr.s_addr, peer.addr, 4);
+  memcpy(&sa.sin_port, &peer.addr[4], 2);
+}
+
+UdpTransport::UdpTransport(uint16_t port, uint32_t broadcastIp, uint16_t broadcastPort) :
+  port(port), broadcastIp(broadcastIp), broadcastPort(broadcastPort) {
+}
+
+bool UdpTransport::begin() {
+  if( sock >= 0 ) {
+    return true;
+  }
+
+  sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if( sock < 0 ) {
+    dbg("Cluster: no UDP socket (%d)\n", errno);
+    return false;
+  }
+
+  int yes = 1;
+  setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &yes, sizeof(yes));
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+
+  struct sockaddr_in sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(INADDR_ANY);
+  sa.sin_port = htons(port);
+  if( bind(sock, (struct sockaddr*) &sa, sizeof(sa)) < 0 ) {
+    dbg("Cluster: can't bind UDP port %u (%d)\n", port, errno);
+    end();
+    return false;
+  }
+  return true;
+}
+
+void UdpTransport::end() {
+  if( sock >= 0 ) {
+    close(sock);
+    sock = -1;
+  }
+}
+
+bool UdpTransport::send(const ClusterPeer& to, const uint8_t* data, size_t len) {
+  if( sock < 0 || len > CLUSTER_PACKET_SIZE ) {
+    return false;
+  }
+  struct sockaddr_in sa;
+  fromPeer(sa, to);
+  return sendto(sock, data, len, 0, (struct sockaddr*) &sa, sizeof(sa)) == (ssize_t) len;
+}
+
+bool UdpTransport::broadcast(const uint8_t* data, size_t len) {
+  if( sock < 0 || len > CLUSTER_PACKET_SIZE ) {
+    return false;
+  }
+  struct sockaddr_in sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(broadcastIp);
+  sa.sin_port = htons(broadcastPort);
+  return sendto(sock, data, len, 0, (struct sockaddr*) &sa, sizeof(sa)) == (ssize_t) len;
+}
+
+size_t UdpTransport::receive(ClusterPeer& from, uint8_t* data, size_t size) {
+  if( sock < 0 ) {
+    return 0;
+  }
+  struct sockaddr_in sa;
+  socklen_t saLen = sizeof(sa);
+  ssize_t len = recvfrom(sock, data, size, 0, (struct sockaddr*) &sa, &saLen);
+  if( len <= 0 ) {
+    return 0;
+  }
+  toPeer(from, sa);
+  return len;
+}
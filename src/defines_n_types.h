@@ -124,6 +124,8 @@
 #define MAX_POOL_URL_LENGTH 80
 #define MAX_WALLET_LENGTH 120
 #define MAX_POOL_PASSWORD_LENGTH 80
+#define MAX_POOL_PIN_LENGTH 64          // SHA-256 of the pool's TLS public key, in hex
+#define MAX_CLUSTER_KEY_LENGTH 32       // Shared by every miner in a cluster
 
 #define SETUP_EEPROM_DATA_ADDRESS 0
 
@@ -135,7 +137,7 @@
 
 #define STRATUM_TASK_PRIORITY 2
 #define STRATUM_CORE 0
-#define STRATUM_STACK_SIZE 7000
+#define STRATUM_STACK_SIZE 10000  // Room for a TLS handshake
 
 #define MONITOR_TASK_PRIORITY 1
 #define MONITOR_CORE 0
@@ -153,10 +155,22 @@
 #define EVENT_HANDLER_TASK_PRIORITY 1
 #define EVENT_HANDLER_STACK_SIZE 8000
 
+#define DISPLAY_CORE 0
+#define DISPLAY_TASK_PRIORITY 1
+#define DISPLAY_STACK_SIZE 6000
+
+#define FETCH_CORE 0
+#define FETCH_TASK_PRIORITY 1
+#define FETCH_STACK_SIZE 6000
+
 #define STRATUM_SERVER_CORE 0
 #define STRATUM_SERVER_TASK_PRIORITY 1
 #define STRATUM_SERVER_STACK_SIZE 6000
 
+#define CLUSTER_CORE 0
+#define CLUSTER_TASK_PRIORITY 1
+#define CLUSTER_STACK_SIZE 5000
+
 #define CORE_0_YIELD_COUNT 1000 // How many hash cycles to go through before yielding to other tasks
 
 #define MINER_NAME_LENGTH 60
@@ -186,6 +200,8 @@
 
 
 #define STRATUM_ACTION_RECONNECT 1
+#define STRATUM_ACTION_REAUTHORIZE 2      // Same pool and wallet, new password
+#define STRATUM_ACTION_BACKUP_CHANGED 4   // Only matters while on the backup
 
 #define MAX_JOB_ID_LENGTH 64
 
@@ -204,6 +220,10 @@ typedef struct {
   char backupWallet[MAX_WALLET_LENGTH + 1];
   char poolPassword[MAX_POOL_PASSWORD_LENGTH + 1];
   char backupPoolPassword[MAX_POOL_PASSWORD_LENGTH + 1];
+  bool poolTls;
+  bool backupPoolTls;
+  char poolPin[MAX_POOL_PIN_LENGTH + 1];
+  char backupPoolPin[MAX_POOL_PIN_LENGTH + 1];
   uint8_t screenRotation;
   bool randomizeTimestamp;
   uint8_t screenBrightness;
@@ -221,11 +241,15 @@ typedef struct {
   bool saveMonitorData; 
   bool clock24;
   bool stratumRepeater;
+  uint8_t clusterRole;
+  bool clusterUdp;
+  char clusterKey[MAX_CLUSTER_KEY_LENGTH + 1];
   bool reportIP;
   bool supportAsicBoost;
   bool coreZeroDisabled;
   bool invertColors;
   bool enableLogViewer;
+  bool stratumCapture;
   uint8_t led1red;
   uint8_t led1green;
   uint8_t led1blue;
@@ -233,10 +257,9 @@ typedef struct {
 } SetupData;
 
 
+// What the event task took from the pending actions in one wakeup
 typedef struct {
   uint16_t  action;
-  void*     data;
-  uint32_t  len;
 } ApplicationMessage;
 
 
@@ -26,13 +26,14 @@
 #if defined(ESP32_2432S028) || defined(ESP32_2432S024)
   #include <XPT2046_Touchscreen.h>
 #endif
-#include <PNGdec.h>
 #include "my_fonts.h"
-#include "display_graphics.h"
+#include "display_images.h"
 
 #include "esp32-hal-ledc.h"
 #include "qrcode.h"
 #include "MyWiFi.h"
+#include "eventTask.h"
+#include "displayTask.h"
 
 //<a href="https://www.flaticon.com/free-icons/wifi" title="wifi icons">Wifi icons created by Uniconlabs - Flaticon</a>
 //https://www.flaticon.com/free-icon/settings_675780?term=configure&related_id=675780
@@ -100,7 +101,6 @@
 #define SEG7_FONT_WIDTH 30
 #define SEG7_FONT_HEIGHT 48
 
-#define MAX_IMAGE_WIDTH 240            // Adjust for your images
 #define BACKGROUND_COLOR 0x108         //getColor(0x04, 0x20, 0x45)
 #define BACKGROUND_COLOR_32B 0x452004  // BGR
 
@@ -134,7 +134,7 @@ TFT_eSPI tft = TFT_eSPI();
 
 // Sprites
 TFT_eSprite img = TFT_eSprite(&tft);
-TFT_eSprite db1 = TFT_eSprite(&tft);
+TFT_eSprite fieldSprites[2] = { TFT_eSprite(&tft), TFT_eSprite(&tft) };
 
 TFT_eSprite portraitText = TFT_eSprite(&tft);
 TFT_eSprite landscapeText = TFT_eSprite(&tft);
@@ -148,16 +148,15 @@ SPIClass touchscreenSPI = SPIClass(HSPI); //SPIClass(VSPI);
 XPT2046_Touchscreen touchscreen(XPT2046_CS, XPT2046_IRQ);
 #endif
 
-IPAddress lastIPAddress;
-
-typedef struct {
-  int16_t x;
-  int16_t y;
-  uint32_t bgColor;
-  TFT_eSPI *tftPtr;
-} PNGDrawInfo;
+#if defined(ESP32_2432S028) || defined(ESP32_2432S024)
+// Takes the pin over from the library's own handler, so do its job too
+void IRAM_ATTR touchIsr() {
+  touchscreen.isrWake = true;
+  notifyEventTaskFromISR(EVENT_NOTIFY_TOUCH);
+}
+#endif
 
-PNG png;  // PNG decoder instance
+IPAddress lastIPAddress;
 
 
 typedef struct {
@@ -166,20 +165,62 @@ typedef struct {
 } MonoFontSprite;
 
 bool spritesCreated = false;
+bool dmaReady = false;
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// What's on screen.
+//
+// The value fields remember the text they last showed, so a refresh only
+// draws the ones that changed. Each goes out by DMA from one of two sprites
+// while the next is drawn into the other.
+///////////////////////////////////////////////////////////////////////////////////////////
+#define SHOWN_HASHRATE 6
+#define SHOWN_FIELDS 7
+
+static char shownText[SHOWN_FIELDS][20];
+static uint8_t nextFieldSprite = 0;
+
+static bool fieldChanged(uint8_t field, const char* text) {
+  return strncmp(shownText[field], text, sizeof(shownText[field])) != 0;
+}
+
+static void setShown(uint8_t field, const char* text) {
+  strlcpy(shownText[field], text, sizeof(shownText[field]));
+}
+
+// Sprites have to be in internal RAM for DMA, so keep them out of PSRAM
+static void createSprites() {
+  if( spritesCreated ) {
+    return;
+  }
+  img.setAttribute(PSRAM_ENABLE, false);
+  img.createSprite(tft.textWidth("888.88", 7), SEG7_FONT_HEIGHT);
+  for( uint8_t i = 0; i < 2; i++ ) {
+    fieldSprites[i].setAttribute(PSRAM_ENABLE, false);
+    fieldSprites[i].createSprite(DATA_CHAR_WIDTH * DATA_CHARS, LINE_HEIGHT);
+  }
+  spritesCreated = true;
+}
+
+static void beginPushes() {
+  tft.startWrite();
+}
 
-//=========================================v==========================================
-//                                      pngDraw
-//====================================================================================
-// This next function will be called during decoding of the png file to
-// render each image line to the TFT.  If you use a different TFT library
-// you will need to adapt this function to suit.
-// Callback function to draw pixels to the display
-int pngDraw(PNGDRAW *pDraw) {
-  PNGDrawInfo *p = (PNGDrawInfo *)pDraw->pUser;
-  uint16_t lineBuffer[MAX_IMAGE_WIDTH];
-  png.getLineAsRGB565(pDraw, lineBuffer, PNG_RGB565_BIG_ENDIAN, p->bgColor);
-  p->tftPtr->pushImage(p->x, p->y + pDraw->y, pDraw->iWidth, 1, lineBuffer);
-  return 1;
+// The transfer runs on after this returns; the next push waits for it
+static void pushSpriteAsync(TFT_eSprite& s, int32_t x, int32_t y) {
+  if( dmaReady ) {
+    tft.pushImageDMA(x, y, s.width(), s.height(), (uint16_t*) s.getPointer());
+  } else {
+    s.pushSprite(x, y);
+  }
+}
+
+// Anything drawn straight to the tft has to wait for this first
+static void finishPushes() {
+  if( dmaReady ) {
+    tft.dmaWait();
+  }
+  tft.endWrite();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +249,77 @@ uint32_t getColor32(uint32_t color) {
   return ((color << 24) >> 8) | (color & 0xff00) | (color >> 16);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////
+// Images
+//
+// Built from graphics/ by tools/build_display_images.py as runs of ready to
+// send RGB565. A band of rows is unpacked into one buffer while the band
+// before it goes out by DMA from the other.
+///////////////////////////////////////////////////////////////////////////////////////////
+#define IMAGE_BAND_PIXELS 2048         // 4 KB a buffer; a whole icon, or 17 rows of the logo
+
+static uint16_t imageBands[2][IMAGE_BAND_PIXELS];
+
+// bgColor is 0x00BBGGRR, as from getColor32()
+static void drawImage(const DisplayImage& image, int16_t x, int16_t y, uint32_t bgColor) {
+  uint16_t bgR = bgColor & 0xff, bgG = (bgColor >> 8) & 0xff, bgB = (bgColor >> 16) & 0xff;
+  uint16_t bgPixel = getColor(bgR, bgG, bgB);
+  bgPixel = (bgPixel >> 8) | (bgPixel << 8);
+  uint16_t rowsPerBand = IMAGE_BAND_PIXELS / image.width;
+  const uint8_t* run = image.data;
+  uint8_t band = 0;
+
+  tft.startWrite();
+  for( uint16_t row = 0; row < image.height; row += rowsPerBand ) {
+    uint16_t rows = image.height - row < rowsPerBand ? image.height - row : rowsPerBand;
+    uint16_t* out = imageBands[band];
+    uint16_t* end = out + rows * image.width;
+
+    while( out < end ) {
+      uint8_t count = (*run & 0x3f) + 1;
+      switch( *run++ & 0xc0 ) {
+        case IMAGE_RUN_CLEAR:
+          while( count-- ) {
+            *out++ = bgPixel;
+          }
+          break;
+        case IMAGE_RUN_PIXELS:
+          // Stored high byte first, which is the order the panel takes them out of memory
+          while( count-- ) {
+            *out++ = run[0] | (run[1] << 8);
+            run += 2;
+          }
+          break;
+        case IMAGE_RUN_REPEAT:
+          while( count-- ) {
+            *out++ = run[0] | (run[1] << 8);
+          }
+          run += 2;
+          break;
+        case IMAGE_RUN_BLEND:
+          while( count-- ) {
+            uint16_t a = run[3];
+            uint16_t c = getColor((run[0] * a + bgR * (255 - a)) / 255, (run[1] * a + bgG * (255 - a)) / 255, (run[2] * a + bgB * (255 - a)) / 255);
+            *out++ = (c >> 8) | (c << 8);
+            run += 4;
+          }
+          break;
+      }
+    }
+
+    if( dmaReady ) {
+      tft.pushImageDMA(x, y + row, image.width, rows, imageBands[band]);
+    } else {
+      tft.pushImage(x, y + row, image.width, rows, imageBands[band]);
+    }
+    band ^= 1;
+  }
+  if( dmaReady ) {
+    tft.dmaWait();
+  }
+  tft.endWrite();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 //
 //
@@ -320,8 +432,6 @@ void showAccessPointPage() {
   int16_t scrWidth = isLandscape ? SCREEN_WIDTH : SCREEN_HEIGHT;
   int16_t scrHeight = isLandscape ? SCREEN_HEIGHT : SCREEN_WIDTH;
 
-  PNGDrawInfo p;
-
   tft.setRotation(1);
   setBrightness(200);
 
@@ -331,16 +441,7 @@ void showAccessPointPage() {
   versionToString(version, MINING_HARDWARE_VERSION_HEX);
 
   tft.fillScreen(BACKGROUND_COLOR);
-  int rc = png.openFLASH((unsigned char *)transparent_small_logo, sizeof(transparent_small_logo), pngDraw);
-  if (rc == PNG_SUCCESS) {
-    tft.startWrite();
-    p.tftPtr = &tft;
-    p.bgColor = BACKGROUND_COLOR_32B;
-    p.x = 0;
-    p.y = 10;
-    rc = png.decode(&p, 0);
-    tft.endWrite();
-  }
+  drawImage(imageLogo, 0, 10, BACKGROUND_COLOR_32B);
 
   tft.setTextColor(TFT_WHITE, BACKGROUND_COLOR);
 
@@ -456,19 +557,12 @@ void showMiningPage() {
   uint16_t fg16 = getColor16(fgOriginal);
   uint32_t fg32 = getColor32(fgOriginal);
 
-  PNGDrawInfo p;
-
   // Make sure we are how we need to be, just in case they came from an access point page
   tft.setRotation(currentScreenOrientation);
 
   // Create the sprites we need on the first pass through
-  if (!spritesCreated) {
-    img.createSprite(tft.textWidth("888.88", 7), SEG7_FONT_HEIGHT);
-    db1.createSprite(DATA_CHAR_WIDTH * DATA_CHARS, LINE_HEIGHT);
-    spritesCreated = true;
-  }
+  createSprites();
   tft.fillScreen(bg16);
-  int rc;
 
   if (isLandscape) {
 
@@ -529,16 +623,7 @@ void showMiningPage() {
 
   }
  
-  rc = png.openFLASH((unsigned char *)transparent_small_logo, sizeof(transparent_small_logo), pngDraw);
-  if (rc == PNG_SUCCESS) {
-    tft.startWrite();
-    p.tftPtr = &tft;
-    p.bgColor = bg32;
-    p.x = 0;
-    p.y = 5;
-    rc = png.decode(&p, 0);
-    tft.endWrite();
-  }
+  drawImage(imageLogo, 0, 5, bg32);
 
   if (isLandscape) {
     tft.setTextColor(fg16, bg16);
@@ -581,29 +666,11 @@ void drawIconSet(bool resetFlags) {
   uint16_t fg16 = getColor16(fgOriginal);
   uint32_t fg32 = getColor32(fgOriginal);
 
-  PNGDrawInfo p;
-
-  int16_t tw = tft.textWidth(monitorData.hashesPerSecondStr, 7);
-  img.fillSprite(bg16);
-  img.setCursor(img.width() - tw, 0, 7);
-  img.setTextColor(fg16, bg16);
-
-  int16_t hashRateX = isLandscape ? 70 : 4;
-  img.print(monitorData.hashesPerSecondStr);
-  img.pushSprite(hashRateX, scrHeight - 52);
-
   // Decide whether to draw mining status
   if (resetFlags || miningStatus != lastMiningStatus) {
 
     if (miningStatus) {
-      int rc = png.openFLASH((unsigned char *)pickaxe_one, sizeof(pickaxe_one), pngDraw);
-      if (rc == PNG_SUCCESS) {
-        p.tftPtr = &tft;
-        p.bgColor = bg32;
-        p.x = scrWidth - 120;
-        p.y = 5;
-        rc = png.decode(&p, 0);
-      }
+      drawImage(imagePickaxe, scrWidth - 120, 5, bg32);
     } else {
       tft.fillRect(scrWidth - 120, 5, 32, 32, bg16);
     }
@@ -611,54 +678,35 @@ void drawIconSet(bool resetFlags) {
   }
 
   if (resetFlags || !haveDrawnPoolStatus || poolStatus != lastPoolConnectedStatus) {
-    unsigned char *poolConnectionImage;
-    size_t imgSize;
-
-    if (poolStatus) {
-      poolConnectionImage = (byte *)pool_connected;
-      imgSize = sizeof(pool_connected);
-    } else {
-      poolConnectionImage = (byte *)pool_disconnected;
-      imgSize = sizeof(pool_disconnected);
-    }
-    int rc = png.openFLASH(poolConnectionImage, imgSize, pngDraw);
-    if (rc == PNG_SUCCESS) {
-      p.tftPtr = &tft;
-      p.bgColor = bg32;
-      p.x = scrWidth - 80;
-      p.y = 5;
-      rc = png.decode(&p, 0);
-    }
+    drawImage(poolStatus ? imagePoolConnected : imagePoolDisconnected, scrWidth - 80, 5, bg32);
     lastPoolConnectedStatus = poolStatus;
     haveDrawnPoolStatus = true;
   }
 
   if (resetFlags || !haveDrawnWifiStatus || wifiStatus != lastWifiStatus) {
-    unsigned char *wifiImage;
-    size_t imgSize;
-
-    if (wifiStatus) {
-      wifiImage = (byte *)wifi;
-      imgSize = sizeof(wifi);
-    } else {
-      wifiImage = (byte *)wifi_slash;
-      imgSize = sizeof(wifi_slash);
-    }
-
-    int rc = png.openFLASH(wifiImage, imgSize, pngDraw);
-    if (rc == PNG_SUCCESS) {
-      p.tftPtr = &tft;
-      p.bgColor = bg32;
-      p.x = scrWidth - 40;
-      p.y = 5;
-      tft.startWrite();
-      rc = png.decode(&p, 0);
-      tft.endWrite();
-    }
+    drawImage(wifiStatus ? imageWifi : imageWifiSlash, scrWidth - 40, 5, bg32);
 
     lastWifiStatus = wifiStatus;
     haveDrawnWifiStatus = true;
   }  
+
+  // Icons are drawn straight to the screen, so the hash rate goes after them.
+  // The caller finishes the pushes.
+  beginPushes();
+
+  char rate[sizeof(shownText[0])];
+  strlcpy(rate, monitorData.hashesPerSecondStr, sizeof(rate));   // The monitor may be rewriting it
+  if( resetFlags || fieldChanged(SHOWN_HASHRATE, rate) ) {
+    int16_t tw = tft.textWidth(rate, 7);
+    img.fillSprite(bg16);
+    img.setCursor(img.width() - tw, 0, 7);
+    img.setTextColor(fg16, bg16);
+
+    int16_t hashRateX = isLandscape ? 70 : 4;
+    img.print(rate);
+    pushSpriteAsync(img, hashRateX, scrHeight - 52);
+    setShown(SHOWN_HASHRATE, rate);
+  }
 }
 
 
@@ -750,6 +798,7 @@ void refreshClockPage(bool resetFlags) {
   const int16_t textFontHeight = 20;
 
   drawIconSet(resetFlags);
+  finishPushes();
 
   Date d;
   dateFromEpoch(&d, monitorData.currentTime + settings.utcOffset);
@@ -871,20 +920,13 @@ void showClockPage() {
   uint16_t fg16 = getColor16(fgOriginal);
   uint32_t fg32 = getColor32(fgOriginal);
 
-  PNGDrawInfo p;
-
   // Make sure we are how we need to be, just in case they came from an access point page
   tft.setRotation(currentScreenOrientation);
 
   // Create the sprites we need on the first pass through
-  if (!spritesCreated) {
-    img.createSprite(tft.textWidth("888.88", 7), SEG7_FONT_HEIGHT);
-    db1.createSprite(DATA_CHAR_WIDTH * DATA_CHARS, LINE_HEIGHT);
-    spritesCreated = true;
-  }
+  createSprites();
 
   tft.fillScreen(bg16);
-  int rc;
 
   if (isLandscape) {
     tft.drawFastHLine(0, 172, scrWidth, fg16);
@@ -892,16 +934,7 @@ void showClockPage() {
     tft.drawFastHLine(0, 252, scrWidth, fg16);
   }
  
-  rc = png.openFLASH((unsigned char *)transparent_small_logo, sizeof(transparent_small_logo), pngDraw);
-  if (rc == PNG_SUCCESS) {
-    tft.startWrite();
-    p.tftPtr = &tft;
-    p.bgColor = bg32;
-    p.x = 0;
-    p.y = 5;
-    rc = png.decode(&p, 0);
-    tft.endWrite();
-  }
+  drawImage(imageLogo, 0, 5, bg32);
 
   if (isLandscape) {
     tft.setTextColor(fg16, bg16);
@@ -937,93 +970,53 @@ int16_t periodLoc(char *str) {
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////
-void refreshMiningScreen(bool resetFlags) {
-
-  static uint32_t lastTotalJobs = 0xffffffff;
-  static uint32_t lastPoolSubs = 0xffffffff;
-  static uint32_t last32 = 0xffffffff;
-  static uint32_t lastvb = 0xffffffff;
-  static double lastbd = -2.0;
+// Returns false if it ran out of frame budget with fields still to draw
+bool refreshMiningScreen(bool resetFlags) {
 
   bool isLandscape = (currentScreenOrientation % 2);
-  int16_t scrWidth = isLandscape ? SCREEN_WIDTH : SCREEN_HEIGHT;
-  int16_t scrHeight = isLandscape ? SCREEN_HEIGHT : SCREEN_WIDTH;
 
   static int32_t lColPos[6][2]= {{53 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 102}, {159 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 102}, {265 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 102}, 
     {53 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 152}, {159 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 152}, {265 - ((DATA_CHAR_WIDTH * DATA_CHARS) / 2), 152} };
   static int32_t pColPos[6][2]= {{10, 105}, {130, 105}, {10, 165}, {130, 165}, {10, 225}, {130, 225} };
 
-  uint32_t bgOriginal = settings.backgroundColor;
-  uint16_t bg16 = getColor16(bgOriginal);
-  uint32_t bg32 = getColor32(bgOriginal);
-  uint32_t fgOriginal = settings.foregroundColor;
-  uint16_t fg16 = getColor16(fgOriginal);
-  uint32_t fg32 = getColor32(fgOriginal);
-
-  drawIconSet(resetFlags);
-
-  const GFXfont *theFont = &WhiteRabbit_Regular10pt7b;
-  db1.setFreeFont(theFont);
-  db1.setTextColor(fg16, bg16);
+  uint16_t bg16 = getColor16(settings.backgroundColor);
+  uint16_t fg16 = getColor16(settings.foregroundColor);
 
-  // Put sprites on the screen
-  int16_t dataX = isLandscape ? scrWidth - 110 : scrWidth - 95;
-  int16_t gap = isLandscape ? 0 : PORTRAIT_LINE_GAP;
-  int16_t ls = isLandscape ? LINE_START_Y : LINE_START_Y + 15;
+  // In the same order as dataTitles
+  const char *values[6] = { monitorData.totalHashesStr, monitorData.bestDifficultyStr, monitorData.totalJobsStr,
+                            monitorData.poolSubmissionsStr, monitorData.blocks32FoundStr, monitorData.validBlocksFoundStr };
 
-  int16_t hw = (db1.width() / 2);
-  
+  drawIconSet(resetFlags);
 
   int32_t (*colPos)[6][2] = isLandscape ? &lColPos : &pColPos;
-  db1.fillSprite(bg16);
-  db1.drawString(monitorData.totalHashesStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.totalHashesStr) * DATA_CHAR_WIDTH), 0);
-  db1.pushSprite((*colPos)[0][0], (*colPos)[0][1]);
-  
+  bool complete = true;
 
-  if( resetFlags || (monitorData.bestDifficultyStr[0] && lastbd != monitorData.bestDifficulty) ) {
-    db1.fillSprite(bg16);
-    db1.drawString(monitorData.bestDifficultyStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.bestDifficultyStr) * DATA_CHAR_WIDTH), 0);
-    db1.pushSprite((*colPos)[1][0], (*colPos)[1][1]);
-    if( monitorData.bestDifficultyStr[0] ) {
-      lastbd = monitorData.bestDifficulty;
-    }
-  }
-  if( resetFlags || (monitorData.poolSubmissionsStr[0] && lastPoolSubs != monitorData.poolSubmissions) ) {
-    db1.fillSprite(bg16);
-    db1.drawString(monitorData.poolSubmissionsStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.poolSubmissionsStr) * DATA_CHAR_WIDTH), 0);
-    db1.pushSprite((*colPos)[3][0], (*colPos)[3][1]);
-    if(monitorData.poolSubmissionsStr[0]) {
-      lastPoolSubs = monitorData.poolSubmissions;
+  for( uint8_t i = 0; i < 6; i++ ) {
+    char text[sizeof(shownText[0])];
+    strlcpy(text, values[i], sizeof(text));
+
+    if( ! resetFlags && (! text[0] || ! fieldChanged(i, text)) ) {
+      continue;
     }
-  }
-      
-  if( resetFlags || (monitorData.totalJobsStr[0] && lastTotalJobs != monitorData.totalJobs) ) {
-    db1.fillSprite(bg16);
-    db1.drawString(monitorData.totalJobsStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.totalJobsStr) * DATA_CHAR_WIDTH), 0);
-    db1.pushSprite((*colPos)[2][0], (*colPos)[2][1]);
-    if( monitorData.totalJobsStr[0] ) {
-      lastTotalJobs = monitorData.totalJobs;
+    // Whatever's left stays stale until the next pass; a redraw always finishes
+    if( ! resetFlags && micros() - displayFrameStart() > DISPLAY_FRAME_BUDGET_US ) {
+      complete = false;
+      break;
     }
-  }
 
-  if( resetFlags || (monitorData.blocks32FoundStr[0] && last32 != monitorData.blocks32Found) ) {
-    db1.fillSprite(bg16);
-    db1.drawString(monitorData.blocks32FoundStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.blocks32FoundStr) * DATA_CHAR_WIDTH), 0);
-    db1.pushSprite((*colPos)[4][0], (*colPos)[4][1]);
-    if(monitorData.blocks32FoundStr[0]) {
-      last32 = monitorData.blocks32Found;
-    }
-  }
-  if( resetFlags || (monitorData.validBlocksFoundStr[0] && lastvb != monitorData.validBlocksFound) ) {
-    db1.fillSprite(bg16);
-    db1.drawString(monitorData.validBlocksFoundStr, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(monitorData.validBlocksFoundStr) * DATA_CHAR_WIDTH), 0);
-    db1.pushSprite((*colPos)[5][0], (*colPos)[5][1]); 
-    if( monitorData.validBlocksFoundStr[0] ) {
-      lastvb = monitorData.validBlocksFound;   
-    }    
-  }
+    TFT_eSprite &s = fieldSprites[nextFieldSprite];
+    nextFieldSprite ^= 1;
 
+    s.setFreeFont(&WhiteRabbit_Regular10pt7b);
+    s.setTextColor(fg16, bg16);
+    s.fillSprite(bg16);
+    s.drawString(text, (DATA_CHAR_WIDTH * DATA_SIG_CHARS) - (periodLoc(text) * DATA_CHAR_WIDTH), 0);
+    pushSpriteAsync(s, (*colPos)[i][0], (*colPos)[i][1]);
+    setShown(i, text);
+  }
 
+  finishPushes();
+  return complete;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -1067,12 +1060,11 @@ bool screenTouched() {
 //
 //
 ///////////////////////////////////////////////////////////////////////////////////////////
-// Redraws whatever the current screen is
-void refreshDisplay() {
+// Redraws whatever the current screen is. False if there's more to do.
+bool refreshDisplay() {
   switch (currentScreen) {
     case SCREEN_MINING:
-      refreshMiningScreen(false);
-      break;
+      return refreshMiningScreen(false);
     case SCREEN_ACCESS_POINT:
       // No need to refresh that page currently
       refreshAccessPointPage();
@@ -1085,7 +1077,7 @@ void refreshDisplay() {
       break;
 
   }
-
+  return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -1173,6 +1165,7 @@ void initializeDisplay(uint8_t rotation, uint8_t brightness) {
     touchscreenSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
     touchscreen.begin(touchscreenSPI);
     touchscreen.setRotation(rotation);
+    attachInterrupt(digitalPinToInterrupt(XPT2046_IRQ), touchIsr, FALLING);
   #elif defined(ESP32_ST7789_135X240)
     // No touchscreen on this board
   #else
@@ -1182,6 +1175,10 @@ void initializeDisplay(uint8_t rotation, uint8_t brightness) {
   // Start the tft display
   tft.init();
 
+  // Value fields go out by DMA; without it they're pushed the blocking way
+  dmaReady = tft.initDMA();
+  dbg("Display DMA %s\n", dmaReady ? "enabled" : "unavailable");
+
   tft.setRotation(rotation);
 
   // Invert colors for some reason
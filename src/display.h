@@ -27,7 +27,7 @@
 #define SCREEN_FIRMWARE 99
 
 void initializeDisplay(uint8_t rotation, uint8_t brightness);
-void refreshDisplay();
+bool refreshDisplay();
 bool screenTouched();
 void setBrightness(unsigned long brightness);
 void setCurrentScreen(uint8_t screen);
@@ -0,0 +1,130 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include "defines_n_types.h"
+
+#ifdef USE_DISPLAY
+
+#include "monitor.h"
+#include "displayTask.h"
+#include "MyWiFi.h"
+#include "bootProfile.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Display task.
+//
+// Everything that draws on the screen runs here, at the lowest priority in
+// use, so a slow SPI or I2C transfer holds up nothing but the screen. Other
+// tasks ask for a refresh or a screen change by notification and carry on.
+//
+// While the backlight is dimmed for inactivity nobody is looking, so the
+// periodic refreshes are skipped; the screen catches up as soon as it's lit.
+//
+// Bringing the panel up is the task's first job, so setup() and the miners
+// don't wait on it. Anything asked for meanwhile waits in the notification.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern MonitorData monitorData;
+extern SetupData settings;
+extern TaskHandle_t displayTaskHandle;
+
+static volatile bool dimmed = false;
+static uint32_t frameStart = 0;
+
+void notifyDisplayTask(uint32_t bits) {
+  if( displayTaskHandle ) {
+    xTaskNotify(displayTaskHandle, bits, eSetBits);
+  }
+}
+
+// Called by the event task when it changes the backlight
+void setDisplayDimmed(bool dim) {
+  if( dimmed && ! dim ) {
+    notifyDisplayTask(DISPLAY_NOTIFY_UNDIM);
+  }
+  dimmed = dim;
+}
+
+// When the frame being drawn started, for the drawing code's budget check
+uint32_t displayFrameStart() {
+  return frameStart;
+}
+
+void displayTask(void *task_id) {
+
+  // Producers may run before xTaskCreate hands the handle back to setup()
+  displayTaskHandle = xTaskGetCurrentTaskHandle();
+
+  initializeDisplay(settings.screenRotation, settings.screenBrightness);
+  setCurrentScreen(MyWiFi::isAccessPoint() ? SCREEN_ACCESS_POINT : SCREEN_MINING);
+  bootMark(BOOT_DISPLAY);
+
+  bool behind = false;
+
+  while(1) {
+    uint32_t events = 0;
+    xTaskNotifyWait(0, 0xffffffff, &events, behind ? 0 : portMAX_DELAY);
+    if( behind ) {
+      events |= DISPLAY_NOTIFY_REFRESH;
+    }
+
+    if( events & DISPLAY_NOTIFY_UNDIM ) {
+      events |= DISPLAY_NOTIFY_REFRESH;
+    }
+    if( dimmed && ! (events & ~(DISPLAY_NOTIFY_REFRESH | DISPLAY_NOTIFY_UNDIM)) ) {
+      monitorData.displayFramesSkipped++;
+      behind = false;
+      continue;
+    }
+
+    frameStart = micros();
+
+    if( events & DISPLAY_NOTIFY_ROTATION ) {
+      setRotation(settings.screenRotation);
+      events |= DISPLAY_NOTIFY_REDRAW;
+    }
+    if( events & DISPLAY_NOTIFY_ACCESS_POINT ) {
+      setCurrentScreen(SCREEN_ACCESS_POINT);
+    } else if( events & DISPLAY_NOTIFY_FIRMWARE_SCREEN ) {
+      setCurrentScreen(SCREEN_FIRMWARE);
+    } else if( events & DISPLAY_NOTIFY_MAIN_SCREEN ) {
+      setCurrentScreen(SCREEN_MINING);
+    } else if( events & DISPLAY_NOTIFY_NEXT_SCREEN ) {
+      handleScreenTouch();
+    } else if( events & DISPLAY_NOTIFY_REDRAW ) {
+      redraw();
+    }
+
+    // A refresh that ran out of time comes straight back for the rest,
+    // after letting anything else at this priority have a turn
+    behind = false;
+    if( events & (DISPLAY_NOTIFY_REFRESH | DISPLAY_NOTIFY_UNDIM) ) {
+      behind = ! refreshDisplay();
+      updateScreenCycle();
+    }
+
+    uint32_t cost = micros() - frameStart;
+    monitorData.displayFrames++;
+    monitorData.displayFrameUs = cost;
+    if( cost > monitorData.displayFrameMaxUs ) {
+      monitorData.displayFrameMaxUs = cost;
+    }
+
+    if( behind ) {
+      vTaskDelay(1);
+    }
+  }
+}
+
+#endif
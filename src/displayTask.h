@@ -0,0 +1,38 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef DISPLAY_TASK_INCLUDED_H
+#define DISPLAY_TASK_INCLUDED_H
+
+#include <Arduino.h>
+#include "defines_n_types.h"
+
+// What the display task has been asked to do, delivered as task notification bits
+#define DISPLAY_NOTIFY_REFRESH 1          // Bring changed values up to date
+#define DISPLAY_NOTIFY_REDRAW 2           // Draw the whole current screen again
+#define DISPLAY_NOTIFY_ROTATION 4         // settings.screenRotation changed
+#define DISPLAY_NOTIFY_MAIN_SCREEN 8
+#define DISPLAY_NOTIFY_FIRMWARE_SCREEN 16
+#define DISPLAY_NOTIFY_ACCESS_POINT 32
+#define DISPLAY_NOTIFY_NEXT_SCREEN 64     // Screen was tapped
+#define DISPLAY_NOTIFY_UNDIM 128
+
+#define DISPLAY_FRAME_BUDGET_US 15000     // A refresh stops here and finishes on the next pass
+
+void displayTask(void *task_id);
+void notifyDisplayTask(uint32_t bits);
+void setDisplayDimmed(bool dimmed);
+uint32_t displayFrameStart();
+
+#endif
@@ -1,1220 +0,0 @@
-/* 
- * BitsyMiner Open Source
- * Copyright (c) 2025 Justin Williams
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- */
-// array size is 10845
-static const byte transparent_small_logo[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x3c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x58, 0x53, 0xf5, 
-  0x18, 0x00, 0x00, 0x01, 0x85, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 
-  0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x40, 0x1c, 0xc5, 
-  0x5f, 0x5b, 0xa5, 0xa2, 0x15, 0x07, 0x8b, 0x14, 0x71, 0xc8, 0x50, 0x5d, 0xb4, 0x8b, 0x8a, 0x88, 
-  0x53, 0xa9, 0x62, 0x11, 0x2c, 0x94, 0xb6, 0x42, 0xab, 0x0e, 0x26, 0x97, 0x7e, 0x41, 0x93, 0x86, 
-  0x24, 0xc5, 0xc5, 0x51, 0x70, 0x2d, 0x38, 0xf8, 0xb1, 0x58, 0x75, 0x70, 0x71, 0xd6, 0xd5, 0xc1, 
-  0x55, 0x10, 0x04, 0x3f, 0x40, 0xdc, 0x05, 0x27, 0x45, 0x17, 0x29, 0xf1, 0x7f, 0x49, 0xa1, 0x45, 
-  0x8c, 0x07, 0xc7, 0xfd, 0x78, 0x77, 0xef, 0x71, 0xf7, 0x0e, 0xf0, 0x36, 0x2a, 0x4c, 0x31, 0xba, 
-  0xa2, 0x80, 0xa2, 0x9a, 0x7a, 0x2a, 0x1e, 0x13, 0xb2, 0xb9, 0x55, 0xc1, 0xff, 0x8a, 0x3e, 0x84, 
-  0x30, 0x84, 0x39, 0x8c, 0x8b, 0xcc, 0xd0, 0x12, 0xe9, 0xc5, 0x0c, 0x5c, 0xc7, 0xd7, 0x3d, 0x3c, 
-  0x7c, 0xbd, 0x8b, 0xf0, 0x2c, 0xf7, 0x73, 0x7f, 0x8e, 0x7e, 0x39, 0x6f, 0x30, 0xc0, 0x23, 0x10, 
-  0x47, 0x99, 0xa6, 0x9b, 0xc4, 0x1b, 0xc4, 0x33, 0x9b, 0xa6, 0xc6, 0x79, 0x9f, 0x38, 0xc8, 0x4a, 
-  0xa2, 0x4c, 0x7c, 0x4e, 0x3c, 0xa1, 0xd3, 0x05, 0x89, 0x1f, 0xb9, 0x2e, 0x39, 0xfc, 0xc6, 0xb9, 
-  0x68, 0xb3, 0x97, 0x67, 0x06, 0xf5, 0x4c, 0x6a, 0x9e, 0x38, 0x48, 0x2c, 0x14, 0x3b, 0x58, 0xea, 
-  0x60, 0x56, 0xd2, 0x15, 0xe2, 0x69, 0xe2, 0xb0, 0xac, 0xa8, 0x94, 0xef, 0xcd, 0x3a, 0x2c, 0x73, 
-  0xde, 0xe2, 0xac, 0x54, 0x6a, 0xac, 0x75, 0x4f, 0xfe, 0xc2, 0x40, 0x5e, 0x5d, 0x49, 0x73, 0x9d, 
-  0xe6, 0x08, 0xe2, 0x58, 0x42, 0x02, 0x49, 0x08, 0x90, 0x50, 0x43, 0x19, 0x15, 0x98, 0x88, 0xd0, 
-  0xaa, 0x92, 0x62, 0x20, 0x45, 0xfb, 0x31, 0x17, 0xff, 0xb0, 0xed, 0x4f, 0x92, 0x4b, 0x22, 0x57, 
-  0x19, 0x8c, 0x1c, 0x0b, 0xa8, 0x42, 0x81, 0x68, 0xfb, 0xc1, 0xff, 0xe0, 0x77, 0xb7, 0x46, 0x61, 
-  0x6a, 0xd2, 0x49, 0x0a, 0xc4, 0x80, 0xee, 0x17, 0xcb, 0xfa, 0x18, 0x05, 0xfc, 0xbb, 0x40, 0xb3, 
-  0x6e, 0x59, 0xdf, 0xc7, 0x96, 0xd5, 0x3c, 0x01, 0x7c, 0xcf, 0xc0, 0x95, 0xda, 0xf6, 0x57, 0x1b, 
-  0xc0, 0xec, 0x27, 0xe9, 0xf5, 0xb6, 0x16, 0x3e, 0x02, 0x06, 0xb6, 0x81, 0x8b, 0xeb, 0xb6, 0x26, 
-  0xed, 0x01, 0x97, 0x3b, 0x40, 0xe8, 0x49, 0x13, 0x75, 0xd1, 0x96, 0x7c, 0x34, 0xbd, 0x85, 0x02, 
-  0xf0, 0x7e, 0x46, 0xdf, 0x94, 0x03, 0x06, 0x6f, 0x81, 0xde, 0x35, 0xa7, 0xb7, 0xd6, 0x3e, 0x4e, 
-  0x1f, 0x80, 0x0c, 0x75, 0xb5, 0x7c, 0x03, 0x1c, 0x1c, 0x02, 0x63, 0x45, 0xca, 0x5e, 0x77, 0x79, 
-  0x77, 0x4f, 0x67, 0x6f, 0xff, 0x9e, 0x69, 0xf5, 0xf7, 0x03, 0x4b, 0x2c, 0x72, 0xfd, 0x26, 0xd3, 
-  0x95, 0x74, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
-  0xa0, 0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 
-  0x00, 0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 
-  0x45, 0x07, 0xe9, 0x0b, 0x18, 0x16, 0x3b, 0x36, 0xf4, 0x41, 0x0b, 0xe8, 0x00, 0x00, 0x00, 0x19, 
-  0x74, 0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 
-  0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 
-  0x17, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x7d, 0x79, 0x98, 0x15, 
-  0xd5, 0xb5, 0xef, 0x6f, 0xd5, 0x74, 0x86, 0x9e, 0x1b, 0xba, 0x9b, 0xa6, 0x69, 0xa6, 0x86, 0x30, 
-  0x23, 0x28, 0x20, 0x22, 0x22, 0xf8, 0xae, 0xc8, 0x4c, 0x22, 0x5e, 0x70, 0x56, 0xd0, 0x44, 0xf3, 
-  0xde, 0x35, 0x0e, 0x31, 0xc1, 0x97, 0x98, 0x1b, 0x35, 0x38, 0x25, 0x51, 0xbc, 0x80, 0xb3, 0x08, 
-  0x28, 0x33, 0x08, 0x42, 0x04, 0x81, 0x08, 0x28, 0x32, 0x23, 0xf3, 0x2c, 0x3d, 0x77, 0xd3, 0x34, 
-  0xd0, 0xf3, 0x70, 0xfa, 0x0c, 0x55, 0xb5, 0xee, 0x1f, 0x75, 0x4e, 0x9d, 0xaa, 0x73, 0xaa, 0x1b, 
-  0xf2, 0xbd, 0xbf, 0xee, 0xfb, 0xac, 0xef, 0x2b, 0xba, 0x7b, 0x57, 0xd5, 0x1e, 0xd6, 0x5a, 0x7b, 
-  0xcd, 0x6b, 0x03, 0xfc, 0x74, 0xfd, 0x7f, 0x77, 0x91, 0x53, 0x63, 0x5e, 0x5e, 0xf7, 0x8e, 0xf5, 
-  0xf5, 0x0d, 0x23, 0x35, 0x4d, 0x4b, 0x26, 0x51, 0x80, 0x00, 0x80, 0x19, 0xd0, 0x58, 0xe7, 0x04, 
-  0xaf, 0xf7, 0xaa, 0xd7, 0xe3, 0xd9, 0x7f, 0xe1, 0x42, 0xfe, 0x15, 0x00, 0x98, 0x30, 0x71, 0x82, 
-  0x74, 0xe2, 0xc4, 0x89, 0xdb, 0x9a, 0x9a, 0x9a, 0xba, 0x03, 0x20, 0x81, 0x04, 0x96, 0x65, 0xa9, 
-  0x31, 0x39, 0x39, 0x79, 0x57, 0x30, 0x18, 0xca, 0x6e, 0x6e, 0x6e, 0x1a, 0xc0, 0x0c, 0x99, 0x99, 
-  0x41, 0x44, 0x00, 0x40, 0xcc, 0x3a, 0xeb, 0x3a, 0x43, 0x92, 0x24, 0x7f, 0x52, 0x52, 0xd2, 0xde, 
-  0xa2, 0xa2, 0xa2, 0x22, 0x00, 0xc8, 0xcd, 0xed, 0x34, 0xa2, 0xb1, 0xb1, 0x69, 0xbc, 0x24, 0x4b, 
-  0x79, 0xcd, 0x4d, 0x4d, 0x1d, 0x12, 0x12, 0x93, 0x1a, 0x82, 0xc1, 0xe0, 0x49, 0xaf, 0xdb, 0xbd, 
-  0x36, 0x35, 0x2d, 0xfd, 0xf2, 0xd5, 0xaa, 0x2b, 0xa3, 0x59, 0xe7, 0x24, 0x81, 0x88, 0x41, 0xa4, 
-  0xba, 0xdd, 0xae, 0x73, 0xbd, 0x7a, 0xf5, 0x3e, 0x50, 0x54, 0x54, 0x94, 0x52, 0x5b, 0x57, 0x3b, 
-  0x46, 0xd3, 0xf4, 0x74, 0x51, 0x14, 0x41, 0x04, 0xa4, 0xa7, 0xa7, 0xff, 0xe0, 0x6b, 0x6e, 0x4e, 
-  0xf3, 0xfb, 0x03, 0xdd, 0x04, 0x41, 0x10, 0x35, 0x4d, 0x63, 0x5d, 0xd7, 0xc9, 0xe5, 0x52, 0xea, 
-  0xd3, 0xd3, 0xdb, 0x7d, 0x73, 0xee, 0xdc, 0xb9, 0x5a, 0x00, 0xc8, 0xed, 0xdc, 0xb9, 0x5d, 0x4b, 
-  0x8b, 0x6f, 0x8c, 0xaa, 0xaa, 0xa9, 0x92, 0x28, 0x91, 0xc6, 0xba, 0xee, 0x92, 0x95, 0xa2, 0xb4, 
-  0xd4, 0xd4, 0xf3, 0x55, 0x35, 0xd5, 0xc3, 0x83, 0x81, 0x60, 0x9a, 0x24, 0x8a, 0x04, 0x40, 0x4f, 
-  0x49, 0x4b, 0x3d, 0xd6, 0xd2, 0xd2, 0x92, 0x18, 0x0a, 0x04, 0xf3, 0x04, 0x49, 0x14, 0x34, 0x55, 
-  0x83, 0x28, 0x89, 0x8d, 0x29, 0xc9, 0x29, 0x7b, 0x25, 0x49, 0xd4, 0xeb, 0xeb, 0xeb, 0x47, 0x84, 
-  0x42, 0x6a, 0x8a, 0xa6, 0x6b, 0x10, 0x48, 0xd0, 0x93, 0x53, 0x92, 0x2f, 0x08, 0x44, 0xa5, 0x4d, 
-  0x4d, 0xcd, 0x43, 0x55, 0x4d, 0x4b, 0x05, 0x33, 0x18, 0x60, 0x4d, 0x53, 0x21, 0x08, 0x02, 0x0c, 
-  0x90, 0x90, 0x9e, 0x94, 0x94, 0x78, 0x56, 0x24, 0xa1, 0xa2, 0xd9, 0xe7, 0x1b, 0x16, 0x0c, 0x06, 
-  0x53, 0x04, 0x81, 0xa0, 0xeb, 0x0c, 0x10, 0x18, 0xcc, 0x24, 0x88, 0x52, 0x40, 0x96, 0xa5, 0xf3, 
-  0x03, 0x06, 0x0c, 0x3c, 0xf4, 0xcf, 0x6d, 0xdb, 0xf8, 0x5f, 0x42, 0xea, 0xaf, 0x7f, 0xfd, 0x6b, 
-  0x5a, 0xb6, 0x7c, 0xd9, 0xeb, 0x7e, 0xbf, 0xff, 0xb7, 0xcc, 0x90, 0xcc, 0x57, 0x88, 0x01, 0x7b, 
-  0x57, 0x5a, 0x42, 0x82, 0x77, 0xa5, 0x24, 0x49, 0xeb, 0x7d, 0xcd, 0xbe, 0xb7, 0x43, 0xaa, 0x9a, 
-  0x1b, 0xdb, 0x17, 0x01, 0x1a, 0x03, 0x22, 0x08, 0xc6, 0xb7, 0x91, 0x9f, 0xe6, 0x6b, 0x1c, 0x79, 
-  0x8f, 0x5d, 0x6e, 0xd7, 0x3a, 0x22, 0x21, 0xa1, 0xa5, 0xa5, 0xe5, 0xae, 0xf0, 0x80, 0x96, 0x8e, 
-  0x18, 0x60, 0x30, 0x19, 0x74, 0x25, 0x44, 0xa7, 0x6d, 0x7c, 0xef, 0x52, 0x94, 0x33, 0x3a, 0xeb, 
-  0x19, 0x21, 0x55, 0xcd, 0x00, 0x93, 0xf5, 0x9b, 0xf0, 0xef, 0x04, 0x62, 0x06, 0x47, 0xba, 0x65, 
-  0x86, 0x20, 0x50, 0x83, 0xd7, 0xe3, 0xfd, 0x35, 0x08, 0x5e, 0x9f, 0xcf, 0x37, 0x8f, 0x75, 0xf6, 
-  0xc0, 0x20, 0x38, 0x18, 0x60, 0x07, 0x88, 0x48, 0x67, 0xe6, 0xb8, 0xf1, 0x5a, 0xb9, 0x74, 0x22, 
-  0x62, 0x66, 0x16, 0xe3, 0x5f, 0x67, 0xcb, 0x9a, 0xe3, 0x80, 0x11, 0x5d, 0x26, 0x91, 0xce, 0x0c, 
-  0xa1, 0xad, 0x71, 0x14, 0x45, 0xce, 0x77, 0xbb, 0x5c, 0xaf, 0x54, 0x57, 0xd7, 0x7c, 0x7e, 0xdd, 
-  0x48, 0x4d, 0x4f, 0x4f, 0xff, 0x75, 0x53, 0x53, 0xd3, 0x7b, 0x6c, 0x1d, 0xdc, 0xfc, 0x95, 0xad, 
-  0xb8, 0xb0, 0x4e, 0xc6, 0x68, 0x62, 0xbe, 0x8e, 0x21, 0x38, 0xa6, 0x8d, 0xc3, 0xfd, 0x3b, 0xbd, 
-  0x63, 0x1b, 0x24, 0x8c, 0x8f, 0x98, 0xef, 0xc9, 0x3e, 0x0a, 0x33, 0x22, 0xb8, 0xb1, 0x81, 0xd2, 
-  0xec, 0x35, 0xca, 0x2d, 0x00, 0x40, 0x05, 0x58, 0x64, 0x0e, 0x77, 0x1e, 0xa1, 0x85, 0x48, 0x47, 
-  0xb1, 0x8d, 0x8e, 0x53, 0x64, 0x73, 0x7e, 0xad, 0xe3, 0x22, 0x16, 0x8e, 0xd6, 0xc9, 0x85, 0x7f, 
-  0x61, 0xcb, 0x03, 0x1b, 0xbe, 0x9d, 0x89, 0xc9, 0xed, 0x72, 0xad, 0xca, 0xc9, 0xce, 0x7e, 0xf8, 
-  0xdc, 0x8f, 0x3f, 0x06, 0x9d, 0x46, 0x94, 0x6c, 0xdb, 0x4f, 0xd3, 0x1e, 0x8d, 0x4c, 0xe4, 0xf6, 
-  0x51, 0xa3, 0x90, 0x96, 0x96, 0x6a, 0x5b, 0x50, 0x20, 0x10, 0xe0, 0xed, 0x3b, 0x76, 0x52, 0x20, 
-  0xe8, 0x47, 0x04, 0x12, 0x06, 0x9c, 0x19, 0x13, 0x26, 0x4c, 0x80, 0x22, 0xcb, 0x00, 0x80, 0xda, 
-  0xda, 0x5a, 0x7c, 0xb7, 0x6b, 0x17, 0xc6, 0xdd, 0x75, 0x17, 0x3c, 0x1e, 0x2f, 0xc8, 0x81, 0xc9, 
-  0x47, 0x10, 0x74, 0xe4, 0xe8, 0x51, 0x94, 0x94, 0x94, 0x00, 0x00, 0x64, 0x59, 0xc6, 0xef, 0x9e, 
-  0x7f, 0x1e, 0x7d, 0x7a, 0xf7, 0x81, 0xac, 0xc8, 0x68, 0x6e, 0x6e, 0xc6, 0xf6, 0xed, 0xdb, 0xb1, 
-  0x6c, 0xf9, 0x72, 0x80, 0x08, 0x5d, 0xbb, 0x74, 0xc1, 0x0d, 0x03, 0x07, 0x1a, 0x5b, 0x83, 0x19, 
-  0x25, 0x25, 0x25, 0x38, 0x71, 0xea, 0x24, 0xc2, 0x9b, 0x0b, 0xe3, 0xc7, 0x8d, 0x83, 0x22, 0xcb, 
-  0xd0, 0x99, 0x51, 0x55, 0x5d, 0x8d, 0x92, 0xe2, 0x62, 0x0c, 0x19, 0x32, 0x04, 0x44, 0x80, 0xa6, 
-  0xe9, 0x20, 0x22, 0x54, 0x55, 0x55, 0x61, 0xdf, 0xfe, 0xfd, 0x00, 0x48, 0x32, 0x26, 0xc6, 0x18, 
-  0x35, 0xf2, 0x36, 0xa4, 0xa6, 0xa6, 0x9a, 0x08, 0x6f, 0x68, 0x68, 0xc0, 0xce, 0x6f, 0xbf, 0x45, 
-  0xff, 0xfe, 0xfd, 0xd1, 0xbd, 0x6b, 0xb7, 0x30, 0xdc, 0x19, 0x47, 0x8e, 0x1e, 0xc5, 0xc5, 0x8b, 
-  0x17, 0x8d, 0x71, 0x14, 0x19, 0xcc, 0x40, 0x4d, 0x4d, 0x0d, 0x76, 0xef, 0xd9, 0x63, 0xa2, 0x6f, 
-  0xe2, 0xf8, 0xf1, 0x90, 0x65, 0x19, 0xcc, 0x8c, 0xe2, 0xe2, 0x62, 0x9c, 0x38, 0x79, 0x12, 0xb7, 
-  0x8e, 0xb8, 0x05, 0x59, 0x59, 0x59, 0x06, 0xcc, 0xc2, 0x7d, 0x51, 0x98, 0x18, 0x98, 0x19, 0x97, 
-  0x2f, 0x5f, 0xc6, 0x9e, 0xbd, 0x7b, 0x71, 0xd3, 0x8d, 0x37, 0xa2, 0x53, 0xa7, 0x4e, 0xe6, 0x3c, 
-  0x98, 0x19, 0x9a, 0xa6, 0x99, 0xfd, 0x08, 0x82, 0xc1, 0x38, 0xfc, 0x81, 0xc0, 0x8c, 0x8b, 0x97, 
-  0x2e, 0x69, 0x00, 0x1e, 0xb8, 0xa6, 0x80, 0x55, 0x5c, 0xae, 0x2b, 0xb2, 0xa2, 0xb0, 0x24, 0x2b, 
-  0x9c, 0x9f, 0x9f, 0xcf, 0xaa, 0xaa, 0xda, 0x6e, 0x4d, 0x53, 0xb9, 0xd9, 0xd7, 0xac, 0x1f, 0x3e, 
-  0x7c, 0x58, 0xbf, 0xf7, 0xde, 0x7b, 0x59, 0x56, 0x14, 0x96, 0x15, 0x85, 0x89, 0x88, 0x03, 0x81, 
-  0x00, 0x6b, 0x9a, 0xc6, 0xaa, 0xaa, 0x72, 0x45, 0x45, 0x05, 0x4b, 0x92, 0xcc, 0x4d, 0xcd, 0xcd, 
-  0xc6, 0xb7, 0x9a, 0x1a, 0xd7, 0x57, 0xe4, 0x5e, 0xb4, 0x68, 0x11, 0xcb, 0x8a, 0xc2, 0xb3, 0x66, 
-  0xcd, 0xe2, 0xb2, 0xb2, 0x32, 0xd6, 0x34, 0x4d, 0xd7, 0x34, 0x8d, 0xad, 0xf7, 0xde, 0xbd, 0x7b, 
-  0xb9, 0x43, 0x76, 0x36, 0xff, 0xf6, 0xb9, 0xe7, 0x8c, 0xbe, 0x34, 0x8d, 0x55, 0x4d, 0xe5, 0xc3, 
-  0x87, 0x0f, 0x9b, 0x73, 0x18, 0x3e, 0xfc, 0x16, 0x0e, 0x85, 0x42, 0xe6, 0x37, 0xbb, 0xf7, 0xec, 
-  0xe1, 0x97, 0x5e, 0x7a, 0x99, 0x63, 0xfb, 0xfa, 0xf1, 0xc7, 0x1f, 0xcd, 0x6f, 0x64, 0x97, 0x8b, 
-  0x45, 0x49, 0xe2, 0x2b, 0x57, 0xae, 0xd8, 0xc6, 0xac, 0xb8, 0x74, 0x89, 0x25, 0x59, 0xe6, 0x8d, 
-  0x1b, 0xff, 0x61, 0xb6, 0xa9, 0x9a, 0xca, 0x73, 0xe6, 0xcc, 0x61, 0x41, 0x92, 0xb8, 0xa6, 0xb6, 
-  0x96, 0xd5, 0x70, 0xfb, 0xa5, 0x4a, 0xe3, 0x5d, 0x59, 0x51, 0xd8, 0x9b, 0x90, 0x68, 0x7b, 0x7f, 
-  0xe7, 0xb7, 0xdf, 0xb2, 0x24, 0xcb, 0x7c, 0xe4, 0xf0, 0xe1, 0x56, 0xd7, 0xaf, 0xaa, 0x2a, 0x9f, 
-  0x3c, 0x79, 0x92, 0x25, 0x59, 0xe6, 0x03, 0x07, 0x0e, 0x84, 0xe1, 0xa5, 0x59, 0x60, 0xae, 0xb1, 
-  0xaa, 0x69, 0x5c, 0x56, 0x56, 0xa6, 0x7f, 0xf8, 0xe1, 0x87, 0x2c, 0x4a, 0x92, 0x39, 0xff, 0xf6, 
-  0xed, 0xdb, 0xcf, 0x74, 0xc2, 0xa3, 0xe0, 0xf8, 0x37, 0x45, 0x59, 0xab, 0xf5, 0x06, 0x08, 0x6e, 
-  0x97, 0x9b, 0x06, 0x0d, 0x1a, 0x44, 0xef, 0xbf, 0xff, 0x3e, 0x26, 0x4e, 0x98, 0x10, 0x65, 0x30, 
-  0x64, 0xf0, 0xe7, 0x28, 0x7b, 0xe3, 0xe8, 0xb7, 0xa0, 0xb8, 0xbe, 0xa2, 0xb7, 0x80, 0x6e, 0x5d, 
-  0xbb, 0xe2, 0x8d, 0x37, 0xde, 0x40, 0xc7, 0x8e, 0x39, 0x8e, 0xca, 0xdb, 0xcd, 0x37, 0xdf, 0x8c, 
-  0x0f, 0x3f, 0xf8, 0x90, 0xe7, 0x2f, 0x58, 0x80, 0x16, 0x5f, 0x0b, 0x8c, 0x99, 0x10, 0x3a, 0xe5, 
-  0x76, 0x02, 0xb3, 0x0e, 0x00, 0x98, 0x3a, 0x75, 0x0a, 0x47, 0x28, 0x19, 0x00, 0x8e, 0x1f, 0x3d, 
-  0x66, 0x17, 0x65, 0x64, 0x70, 0xc9, 0x9c, 0x9c, 0x8e, 0x30, 0x95, 0x36, 0x06, 0xee, 0x18, 0x33, 
-  0x06, 0xed, 0xda, 0xb5, 0x23, 0x27, 0x81, 0x41, 0x36, 0xf6, 0x4e, 0x10, 0x04, 0x01, 0xc4, 0x66, 
-  0x77, 0x00, 0x80, 0xcc, 0x8c, 0x4c, 0xdc, 0x33, 0x6d, 0x9a, 0x29, 0x9b, 0x22, 0x1c, 0x88, 0x4c, 
-  0x5e, 0x16, 0x16, 0x1f, 0x6d, 0xdc, 0x82, 0x28, 0xd8, 0xdf, 0xb3, 0xc0, 0x3e, 0x32, 0x9f, 0x8e, 
-  0x1d, 0x3b, 0xd2, 0xe3, 0x8f, 0x3f, 0x8e, 0xd5, 0xab, 0x56, 0x99, 0x73, 0x6a, 0x6c, 0x6a, 0x7c, 
-  0x7d, 0xe0, 0x80, 0x01, 0x9e, 0x36, 0x91, 0x4a, 0xb0, 0x4f, 0xb8, 0xad, 0x2b, 0x39, 0x39, 0x19, 
-  0xbf, 0xfd, 0xed, 0x6f, 0xaf, 0xa1, 0x3f, 0x5c, 0xdf, 0xf5, 0xd2, 0x4b, 0x2f, 0xa3, 0x5d, 0xbb, 
-  0x76, 0x31, 0x32, 0xd7, 0x3e, 0x8b, 0x31, 0x63, 0x46, 0x23, 0x2d, 0x3d, 0x1d, 0x85, 0x85, 0x05, 
-  0xe6, 0x88, 0xed, 0xdb, 0xb5, 0xc7, 0x6d, 0x23, 0x6f, 0x63, 0x00, 0x18, 0x30, 0x60, 0x40, 0x54, 
-  0x8c, 0xe8, 0x3a, 0x56, 0xad, 0x5e, 0x15, 0x95, 0xf3, 0x96, 0x1f, 0x6e, 0xb7, 0x07, 0x33, 0x1f, 
-  0x7d, 0xd4, 0x00, 0x3e, 0x01, 0x63, 0xc7, 0x8e, 0x6d, 0x55, 0x0d, 0x88, 0xe8, 0x75, 0xd7, 0x82, 
-  0xc7, 0x84, 0x09, 0x13, 0xc8, 0x10, 0x5f, 0x2a, 0x42, 0xa1, 0xd0, 0x35, 0x6c, 0x0b, 0x07, 0xbd, 
-  0x21, 0xac, 0x0b, 0x5c, 0x0f, 0xdc, 0x27, 0x4e, 0x9a, 0x84, 0xb1, 0x77, 0xde, 0x19, 0x61, 0xcf, 
-  0x99, 0x97, 0x2e, 0x5d, 0x9a, 0x7e, 0xad, 0x9d, 0x8a, 0x18, 0x01, 0xc8, 0x80, 0x21, 0x37, 0x96, 
-  0x2e, 0x5b, 0x86, 0x0d, 0x1b, 0x36, 0x20, 0x10, 0x08, 0x98, 0x0f, 0x07, 0xde, 0x30, 0xd0, 0xba, 
-  0x08, 0x8a, 0x85, 0xcc, 0x96, 0xaf, 0xbf, 0xc6, 0x96, 0x2d, 0x5b, 0xb0, 0x73, 0xe7, 0x4e, 0xdb, 
-  0x3a, 0x2e, 0x5d, 0xba, 0x84, 0x4d, 0x9b, 0x36, 0xe3, 0xab, 0xaf, 0x36, 0x61, 0xff, 0xfe, 0x7d, 
-  0x18, 0x3c, 0x68, 0x90, 0x6d, 0x95, 0x6b, 0x56, 0xaf, 0xc6, 0xaf, 0x7e, 0xf5, 0x4b, 0x14, 0x16, 
-  0x16, 0x9a, 0xdd, 0x26, 0x24, 0x24, 0xd0, 0xbf, 0xdf, 0x73, 0x0f, 0x0e, 0xff, 0x70, 0xd8, 0x36, 
-  0xce, 0xf8, 0xf1, 0xe3, 0x01, 0x00, 0xdd, 0xba, 0x75, 0x33, 0xb7, 0x46, 0x49, 0x71, 0x71, 0x58, 
-  0x6e, 0xc6, 0xac, 0x24, 0x3c, 0xca, 0x90, 0x21, 0x43, 0x4c, 0xcd, 0xaa, 0x4f, 0xef, 0x3e, 0x88, 
-  0xd5, 0xcb, 0x6d, 0x30, 0x8f, 0x55, 0xfc, 0x1d, 0x20, 0x7f, 0xc3, 0x0d, 0x37, 0xb0, 0x21, 0xff, 
-  0x74, 0xa8, 0xaa, 0x6a, 0xf9, 0x96, 0xd8, 0xe1, 0x7d, 0xde, 0xb3, 0x77, 0x2f, 0x36, 0x6c, 0xd8, 
-  0xc0, 0x1b, 0x36, 0x6c, 0xc0, 0x86, 0x0d, 0x1b, 0xf0, 0xd5, 0x57, 0x5f, 0xc5, 0xab, 0xd3, 0xcc, 
-  0xd8, 0xb8, 0x71, 0x23, 0xb6, 0x6c, 0xd9, 0x82, 0xba, 0xba, 0x3a, 0xb3, 0x5d, 0x96, 0x25, 0xdc, 
-  0x77, 0xdf, 0x7d, 0xa6, 0xde, 0xe7, 0x0f, 0x04, 0x26, 0xb5, 0xa9, 0x28, 0x99, 0x8a, 0x58, 0xcc, 
-  0x12, 0x7c, 0x3e, 0x1f, 0x1e, 0x7b, 0xec, 0x31, 0x10, 0x80, 0x2d, 0x5b, 0xb6, 0xf0, 0xe8, 0xd1, 
-  0xa3, 0x09, 0x00, 0x12, 0x13, 0x12, 0x31, 0x7d, 0xfa, 0x74, 0xac, 0x59, 0xb3, 0xda, 0x91, 0xda, 
-  0xef, 0xbd, 0xef, 0x3e, 0x00, 0xc0, 0xe4, 0x49, 0x93, 0x31, 0x7a, 0xcc, 0x18, 0x73, 0x03, 0x5c, 
-  0xaa, 0xac, 0xa4, 0xbb, 0xa7, 0xdd, 0x6d, 0xb2, 0x97, 0x97, 0x5e, 0x7a, 0xc9, 0xe4, 0xd9, 0x4d, 
-  0x4d, 0x4d, 0xf4, 0xd0, 0x23, 0x0f, 0x03, 0x00, 0xfa, 0xf7, 0xef, 0x8f, 0xdf, 0xfc, 0xe6, 0x37, 
-  0x66, 0x97, 0x3f, 0xeb, 0xd5, 0x0b, 0x1b, 0x36, 0xfe, 0x03, 0x0f, 0x3f, 0xf2, 0x88, 0xf9, 0x6d, 
-  0x9f, 0x3e, 0x7d, 0x48, 0xd3, 0x54, 0xe4, 0xe4, 0xe4, 0x98, 0x3a, 0xe5, 0xe9, 0xd3, 0xa7, 0x9d, 
-  0xf5, 0xf0, 0xb0, 0x92, 0xda, 0xb3, 0x67, 0x4f, 0x13, 0x53, 0x5d, 0xbb, 0x75, 0x6d, 0x55, 0xef, 
-  0xa6, 0xeb, 0xe4, 0x34, 0x79, 0x79, 0x79, 0x94, 0x98, 0x98, 0x88, 0xa6, 0xc6, 0xc6, 0x98, 0x0e, 
-  0x38, 0x62, 0x1a, 0xd8, 0x5a, 0xb7, 0x7f, 0xb3, 0x1d, 0xaf, 0xbd, 0xfe, 0x7a, 0xdc, 0x26, 0x60, 
-  0xab, 0xd2, 0xce, 0x8c, 0x67, 0x9e, 0x79, 0x06, 0x15, 0x15, 0x97, 0xf0, 0xe4, 0x93, 0x4f, 0xe0, 
-  0x9d, 0x77, 0xde, 0x31, 0x27, 0xd9, 0xab, 0x57, 0x2f, 0x0b, 0x67, 0xa7, 0xa1, 0x6d, 0xef, 0xd4, 
-  0x88, 0xbd, 0xeb, 0x80, 0x21, 0x22, 0x43, 0x28, 0x95, 0x94, 0x94, 0xd8, 0x08, 0xba, 0x43, 0x87, 
-  0x2c, 0xb4, 0x62, 0xec, 0x58, 0xe6, 0xa7, 0x5b, 0x9f, 0x52, 0xd4, 0xb4, 0x30, 0x9e, 0x8b, 0xa2, 
-  0x68, 0x3e, 0x53, 0x35, 0xcd, 0x94, 0x4b, 0x56, 0x0a, 0x05, 0x00, 0x49, 0x14, 0xb1, 0x69, 0xf3, 
-  0x26, 0x54, 0x56, 0x56, 0x9a, 0x6d, 0xdd, 0xba, 0x75, 0xc3, 0xbd, 0x33, 0xee, 0xe5, 0xa4, 0xa4, 
-  0x24, 0x93, 0xc7, 0x6c, 0xdb, 0xb6, 0xcd, 0x11, 0x2d, 0x11, 0xf8, 0x76, 0xee, 0xdc, 0xd9, 0x6c, 
-  0xcb, 0xc9, 0xb1, 0xc8, 0x71, 0x72, 0x60, 0x92, 0x14, 0xaf, 0xb1, 0xc7, 0xc2, 0xc7, 0xe3, 0xf1, 
-  0xe0, 0xd9, 0x67, 0x9e, 0x41, 0xbc, 0x9a, 0x1f, 0xb1, 0x03, 0xed, 0xdc, 0xcf, 0x64, 0xeb, 0x64, 
-  0xe7, 0x8c, 0x8e, 0x1c, 0x98, 0x80, 0xf9, 0xf3, 0xe7, 0xa3, 0xb9, 0xb9, 0xd9, 0x6c, 0x4a, 0x48, 
-  0x48, 0x30, 0x9f, 0xb5, 0xf8, 0xfd, 0x9d, 0x9e, 0xff, 0xdd, 0xf3, 0x42, 0xeb, 0x3b, 0x35, 0x62, 
-  0xeb, 0x71, 0xeb, 0x1c, 0xd9, 0xc6, 0x5e, 0xec, 0x7f, 0x53, 0xfc, 0x7a, 0x28, 0xc6, 0xd9, 0x40, 
-  0x71, 0x68, 0x67, 0x00, 0x6a, 0x28, 0xda, 0x67, 0x6a, 0x4a, 0x2a, 0x7e, 0xf3, 0xd4, 0x53, 0x98, 
-  0xbf, 0x60, 0x01, 0xbe, 0xf9, 0xe6, 0x1b, 0x74, 0xcc, 0xc9, 0x89, 0xf8, 0x1f, 0xb0, 0x6e, 0xdd, 
-  0x3a, 0x10, 0x11, 0xce, 0x9f, 0x3f, 0x8f, 0xec, 0xec, 0x6c, 0x18, 0x5e, 0xa8, 0x5c, 0x8c, 0x1a, 
-  0x35, 0xca, 0x1c, 0xa1, 0xb6, 0xb6, 0x16, 0x1f, 0x7f, 0xf2, 0xb1, 0xdd, 0xc6, 0x23, 0x3b, 0xfb, 
-  0xed, 0x98, 0x9d, 0x8d, 0x84, 0x84, 0x04, 0xdc, 0xf9, 0x6f, 0xff, 0x86, 0xe4, 0xe4, 0x64, 0x67, 
-  0x33, 0x9a, 0x1c, 0x26, 0x4a, 0xd4, 0xaa, 0x29, 0x3e, 0xfc, 0x96, 0x5b, 0x22, 0xae, 0x8b, 0x18, 
-  0x60, 0xb6, 0x22, 0xe0, 0x4c, 0xb6, 0xce, 0xd7, 0x74, 0x6e, 0xc8, 0x8a, 0x02, 0x5f, 0x4b, 0x8b, 
-  0x89, 0x4c, 0xb7, 0xdb, 0x1d, 0xb6, 0xb9, 0x05, 0xe8, 0xac, 0x09, 0x05, 0x85, 0x45, 0x49, 0x00, 
-  0xea, 0x1d, 0x91, 0x1a, 0xe9, 0x5e, 0x27, 0x86, 0x23, 0xb2, 0x09, 0x48, 0x4a, 0x4a, 0xb2, 0x39, 
-  0x9a, 0x22, 0x36, 0xa6, 0xc3, 0xde, 0xb6, 0x4f, 0x94, 0x1c, 0x76, 0x4d, 0xf8, 0xdf, 0xb2, 0xf2, 
-  0x72, 0x64, 0x66, 0x65, 0x9a, 0x4f, 0x9e, 0x7b, 0xee, 0xb7, 0xd8, 0xb3, 0x67, 0x0f, 0x0e, 0x1e, 
-  0x3a, 0x84, 0x43, 0x87, 0x7e, 0x08, 0x83, 0x2a, 0xda, 0xdf, 0xbe, 0x7d, 0xfb, 0x30, 0x7a, 0xf4, 
-  0x68, 0x80, 0x80, 0xc4, 0xc4, 0x44, 0x8c, 0x18, 0x31, 0xc2, 0xec, 0xf7, 0xfc, 0xf9, 0xf3, 0x8e, 
-  0xf4, 0x15, 0xc1, 0x09, 0x33, 0xe0, 0x72, 0xbb, 0x30, 0x63, 0xfa, 0x74, 0xf4, 0xee, 0xdd, 0x3b, 
-  0xd6, 0xc1, 0x15, 0x27, 0x7f, 0x6d, 0x3e, 0x06, 0x27, 0x85, 0x2a, 0xfc, 0xac, 0x4f, 0xef, 0xde, 
-  0x60, 0x86, 0xa9, 0x8d, 0x87, 0x59, 0x23, 0x39, 0xe3, 0x8a, 0xe3, 0xfe, 0xbe, 0x96, 0xbe, 0x69, 
-  0xf3, 0x7d, 0xe8, 0x3a, 0xac, 0xfe, 0x1e, 0x35, 0xa8, 0x52, 0x9b, 0xda, 0xaf, 0xe1, 0x6b, 0xa0, 
-  0x38, 0x47, 0x01, 0x81, 0x31, 0x74, 0xc8, 0x90, 0x28, 0x00, 0xc3, 0x86, 0xf7, 0xe6, 0xaf, 0xbf, 
-  0x8e, 0xce, 0xcc, 0x62, 0x42, 0xb0, 0x0d, 0x12, 0x31, 0xc2, 0x9a, 0xec, 0x9b, 0x61, 0xf3, 0xe6, 
-  0x4d, 0xb6, 0x45, 0x65, 0x67, 0x77, 0xc0, 0xd2, 0xa5, 0x4b, 0x31, 0x6c, 0xe8, 0x50, 0xc7, 0xe5, 
-  0x2e, 0x5a, 0xb4, 0x08, 0x81, 0x60, 0xc0, 0x84, 0x4d, 0xbf, 0x7e, 0xfd, 0x22, 0x3e, 0x3e, 0xfc, 
-  0xf0, 0xc3, 0x0f, 0x71, 0x74, 0x14, 0x71, 0x58, 0x35, 0x37, 0xfb, 0xcc, 0x09, 0x0c, 0x1d, 0x3a, 
-  0x14, 0x7d, 0xfa, 0xf4, 0xe1, 0x08, 0x02, 0x75, 0x5d, 0x77, 0x26, 0x40, 0xb6, 0x6a, 0xc3, 0x6c, 
-  0x5b, 0xa6, 0x39, 0x35, 0x06, 0x3a, 0x76, 0xec, 0x88, 0xb1, 0x77, 0xde, 0x89, 0x60, 0x20, 0xd8, 
-  0x96, 0x6f, 0x0c, 0x00, 0x30, 0x68, 0xd0, 0x20, 0xbc, 0xf9, 0xc6, 0x1b, 0x78, 0xf3, 0x8d, 0x37, 
-  0xf0, 0xdc, 0xb3, 0xcf, 0xb6, 0x2a, 0xbf, 0x23, 0x34, 0x91, 0x9b, 0x9b, 0x8b, 0xd4, 0xd4, 0x54, 
-  0xb3, 0x3d, 0x10, 0x0c, 0x1a, 0x6b, 0x22, 0x86, 0x40, 0x02, 0x77, 0xea, 0x92, 0xdb, 0xd8, 0x96, 
-  0xf6, 0xeb, 0xc8, 0x60, 0x72, 0x72, 0x72, 0xd0, 0xdc, 0xdc, 0x8c, 0xef, 0x76, 0x7d, 0x87, 0x4e, 
-  0x9d, 0x3a, 0x99, 0xed, 0x5f, 0x7f, 0xfd, 0x35, 0x24, 0x49, 0xb2, 0x49, 0x7a, 0x67, 0xbb, 0x20, 
-  0x56, 0x76, 0x90, 0xcd, 0xfb, 0x3b, 0xe7, 0xd5, 0x57, 0x71, 0xe4, 0xc8, 0x11, 0xdb, 0xd7, 0xdd, 
-  0xbb, 0x77, 0xc7, 0xaa, 0xd5, 0xab, 0xf1, 0x8b, 0x9f, 0xff, 0x3c, 0x6e, 0xbb, 0x94, 0x94, 0x95, 
-  0xa1, 0xb8, 0xb8, 0x38, 0x0e, 0x66, 0xaa, 0xaa, 0xe2, 0xb3, 0xcf, 0x3e, 0xb7, 0x10, 0xa3, 0xdd, 
-  0x67, 0x78, 0xee, 0xdc, 0x39, 0xf3, 0x59, 0xcf, 0x9e, 0x3d, 0xd1, 0xb5, 0x6b, 0x57, 0x02, 0x80, 
-  0x50, 0x28, 0x84, 0x8b, 0x17, 0x2f, 0xb6, 0xbe, 0x59, 0xd8, 0x41, 0xc8, 0x92, 0x1d, 0x68, 0x44, 
-  0x84, 0x69, 0xd3, 0xa6, 0x19, 0xd6, 0x00, 0xd9, 0x11, 0x13, 0x7b, 0x4d, 0x99, 0x32, 0x15, 0x4f, 
-  0x3f, 0xfd, 0x34, 0x9e, 0x7e, 0xfa, 0x69, 0x3c, 0xf9, 0xe4, 0x93, 0x6d, 0xee, 0x50, 0x49, 0x14, 
-  0xf1, 0xb7, 0xbf, 0xfe, 0xd5, 0x0a, 0x67, 0xd4, 0xd7, 0xd7, 0x1b, 0x30, 0x64, 0x82, 0xcb, 0xe5, 
-  0x2a, 0x7a, 0x7f, 0xc1, 0x02, 0xad, 0x55, 0xa4, 0x32, 0xc0, 0xcc, 0xe4, 0x48, 0x31, 0xa2, 0x28, 
-  0x42, 0xa0, 0xe8, 0xeb, 0x27, 0x4e, 0x9c, 0xc0, 0xa3, 0x33, 0x67, 0xa2, 0x6d, 0x40, 0x90, 0x65, 
-  0x61, 0xad, 0xc3, 0x8c, 0x88, 0xf0, 0x7f, 0x7e, 0xfd, 0xbf, 0xa9, 0xa4, 0xa4, 0x94, 0xad, 0x42, 
-  0x2d, 0xbb, 0x43, 0x36, 0x7f, 0xf4, 0xd1, 0x47, 0x98, 0xf9, 0xe8, 0xa3, 0x71, 0x8c, 0xfd, 0xc4, 
-  0xf1, 0x13, 0x14, 0x4b, 0x3f, 0x65, 0x65, 0x65, 0x38, 0x71, 0xf2, 0x84, 0x45, 0x28, 0xb2, 0xd5, 
-  0xbc, 0x40, 0x79, 0x79, 0x39, 0x34, 0xcd, 0x58, 0x7f, 0xe7, 0xce, 0x9d, 0x91, 0x93, 0x63, 0x10, 
-  0x68, 0x79, 0x79, 0x79, 0xd8, 0x6e, 0x25, 0xc4, 0xf1, 0x29, 0x6a, 0x5b, 0x07, 0x2e, 0x2d, 0x2d, 
-  0xe5, 0x88, 0xeb, 0x76, 0xc8, 0x90, 0x21, 0xcc, 0x76, 0x77, 0x2f, 0x5f, 0x8b, 0xad, 0x5a, 0x1d, 
-  0x26, 0xb1, 0xed, 0xa7, 0x4e, 0x9f, 0x42, 0x6d, 0x4d, 0x0d, 0x7e, 0x6e, 0x12, 0x76, 0xd8, 0xb1, 
-  0x72, 0xfc, 0xb8, 0x39, 0x35, 0x41, 0x14, 0xf7, 0x5e, 0xdb, 0x4e, 0xc5, 0x35, 0xfd, 0x09, 0x0c, 
-  0x00, 0x03, 0x07, 0x0e, 0xc4, 0xe2, 0xc5, 0x8b, 0x9d, 0xd7, 0xcd, 0x56, 0xc1, 0x44, 0x66, 0xe4, 
-  0xc3, 0x21, 0x34, 0x61, 0x62, 0xe5, 0xd8, 0x89, 0xe3, 0x98, 0x31, 0x63, 0x3a, 0x9d, 0x39, 0x73, 
-  0xc6, 0x46, 0x15, 0x49, 0x49, 0x49, 0xf8, 0xeb, 0x5f, 0xff, 0x8a, 0xbb, 0xef, 0xbe, 0xdb, 0xf6, 
-  0xe9, 0x96, 0xad, 0x5b, 0x8c, 0x40, 0x96, 0x05, 0x77, 0xa7, 0x4e, 0x9d, 0x6a, 0xcd, 0x77, 0x01, 
-  0x10, 0x23, 0x18, 0x0c, 0xa2, 0xba, 0xba, 0xda, 0x54, 0xb0, 0xbc, 0x5e, 0xc3, 0x19, 0x53, 0x50, 
-  0x50, 0xc8, 0x56, 0x61, 0x6a, 0xf6, 0x6b, 0x0d, 0x3a, 0x38, 0x2d, 0x0f, 0x40, 0x43, 0x43, 0x3d, 
-  0x5d, 0xbe, 0x72, 0x05, 0x00, 0xd0, 0xa3, 0x67, 0x8f, 0x28, 0x1e, 0xc3, 0xca, 0xdd, 0x35, 0xcd, 
-  0xa2, 0x36, 0x5e, 0xf0, 0xb8, 0x3d, 0x50, 0x14, 0xc5, 0xd6, 0x56, 0x5d, 0x5d, 0x8d, 0xb7, 0xdf, 
-  0x7e, 0xdb, 0x9c, 0x8a, 0x4b, 0x96, 0x97, 0x5f, 0xd3, 0xa3, 0xe4, 0x34, 0x4e, 0x6d, 0x5d, 0x2d, 
-  0x56, 0xac, 0x5c, 0x81, 0x75, 0xeb, 0xd6, 0xa1, 0xa6, 0xb6, 0xc6, 0x7c, 0x3c, 0xed, 0xee, 0xbb, 
-  0x31, 0x30, 0xea, 0xc9, 0x61, 0x9b, 0xcc, 0x8c, 0x95, 0x4b, 0x96, 0xae, 0xb9, 0x95, 0xa0, 0xcd, 
-  0xb1, 0xe3, 0xc7, 0x71, 0xcb, 0x88, 0x11, 0xd8, 0xb1, 0x63, 0xbb, 0x0d, 0xa0, 0x49, 0x49, 0x49, 
-  0xf8, 0xcb, 0x2b, 0xaf, 0x98, 0x0a, 0x02, 0x88, 0xb0, 0x6c, 0xd9, 0x32, 0xaa, 0xba, 0x5a, 0x65, 
-  0x23, 0x93, 0x9d, 0x3b, 0x76, 0xb4, 0xa5, 0x6c, 0x03, 0x00, 0x2e, 0x5e, 0x2c, 0x8f, 0x63, 0x8b, 
-  0x67, 0xce, 0x9c, 0xb6, 0x2f, 0xdb, 0xea, 0x0a, 0xe4, 0xb6, 0xa9, 0x9c, 0x01, 0x9c, 0x0d, 0x13, 
-  0xa2, 0xc7, 0xed, 0x41, 0x56, 0x66, 0x16, 0x45, 0xf5, 0x06, 0xe7, 0x6d, 0xfe, 0xed, 0xb7, 0xdf, 
-  0x62, 0xe5, 0xca, 0x95, 0xc6, 0xbd, 0x62, 0xe5, 0x75, 0x7b, 0xde, 0x2a, 0x2b, 0x2b, 0xf1, 0xfb, 
-  0xd9, 0xb3, 0x51, 0x54, 0x5c, 0x0c, 0x22, 0x82, 0x2c, 0x49, 0xbb, 0x6f, 0x1b, 0x33, 0x66, 0xeb, 
-  0x75, 0xec, 0xd4, 0xf8, 0x15, 0xf8, 0x9a, 0x7d, 0x98, 0x39, 0x73, 0x16, 0xee, 0x7f, 0xe0, 0x01, 
-  0x7c, 0xf2, 0xc9, 0x27, 0xd1, 0x10, 0x90, 0xdb, 0x8d, 0x7b, 0xef, 0xbd, 0x17, 0xa6, 0xbb, 0xd3, 
-  0xe6, 0x85, 0xe1, 0x56, 0x29, 0x9d, 0x62, 0x50, 0x4c, 0x16, 0x26, 0x15, 0x08, 0x04, 0x30, 0x7e, 
-  0xc2, 0x04, 0x23, 0x32, 0x63, 0x99, 0x4e, 0x5e, 0x5e, 0x1e, 0x66, 0xcf, 0x7e, 0x21, 0xbc, 0x11, 
-  0x0c, 0x8c, 0x99, 0x76, 0x6c, 0x38, 0xf2, 0xb1, 0xe1, 0x1f, 0xff, 0x00, 0x98, 0xe2, 0x15, 0x19, 
-  0xcb, 0xf8, 0xf9, 0xf9, 0x05, 0x76, 0x91, 0xcf, 0x8c, 0x4d, 0x9b, 0x36, 0x91, 0x9d, 0x10, 0x28, 
-  0x56, 0xaf, 0x6b, 0x7d, 0xfe, 0x0c, 0xec, 0xd9, 0xbb, 0xd7, 0x12, 0x85, 0x23, 0x67, 0x4f, 0x94, 
-  0xe5, 0xda, 0xb5, 0x6b, 0x17, 0x1e, 0x9d, 0x39, 0x13, 0x8f, 0xce, 0x9c, 0x89, 0x17, 0xff, 0xf4, 
-  0x27, 0x67, 0x62, 0x61, 0x46, 0x45, 0xc5, 0x25, 0xf8, 0xfd, 0x7e, 0xb3, 0xad, 0xa1, 0xb1, 0x11, 
-  0xcb, 0x96, 0x2d, 0x0b, 0xb3, 0x67, 0x6a, 0xf2, 0x26, 0x78, 0x1f, 0xfc, 0x62, 0xf5, 0x6a, 0xfe, 
-  0x57, 0xdd, 0x84, 0x71, 0xd7, 0xfe, 0x7d, 0x76, 0xf7, 0x5b, 0x97, 0x2e, 0x5d, 0xae, 0xed, 0xde, 
-  0x6c, 0x65, 0xd7, 0x80, 0x0d, 0xe5, 0x66, 0xd5, 0xaa, 0x55, 0x58, 0xb7, 0xf6, 0x0b, 0x7c, 0xb1, 
-  0x76, 0x2d, 0x1e, 0x9b, 0x35, 0x0b, 0x44, 0x84, 0x59, 0xb3, 0x66, 0xd9, 0x3d, 0x43, 0x04, 0x8c, 
-  0xba, 0xfd, 0xb6, 0xd6, 0x2c, 0x02, 0x70, 0x44, 0x3e, 0x39, 0x85, 0x36, 0x2d, 0x0d, 0x26, 0x7b, 
-  0x0f, 0xb7, 0x5d, 0xb9, 0x72, 0x15, 0xdf, 0x7e, 0xf7, 0x9d, 0x63, 0xf8, 0x92, 0x4d, 0x4d, 0xbe, 
-  0x15, 0x03, 0x24, 0xfc, 0xc2, 0xc2, 0x85, 0x0b, 0xe1, 0x8f, 0xb8, 0x4f, 0xad, 0x0e, 0x74, 0xe6, 
-  0x6b, 0x6d, 0xf4, 0xd6, 0x39, 0x00, 0x33, 0x6e, 0xbb, 0x6d, 0x24, 0x0e, 0x1f, 0x3e, 0x6c, 0xb6, 
-  0xf5, 0xc8, 0xcb, 0xc3, 0xb8, 0xbb, 0xee, 0x0a, 0x87, 0x49, 0xf5, 0x04, 0x51, 0x14, 0xbb, 0x5d, 
-  0x33, 0x4a, 0xc3, 0x6d, 0x0e, 0x62, 0xfc, 0x0c, 0x85, 0x82, 0x36, 0x72, 0x15, 0x04, 0xd1, 0x91, 
-  0xa4, 0xed, 0x5a, 0x1f, 0xb7, 0x2a, 0x4f, 0x58, 0xd7, 0x31, 0x79, 0xca, 0x14, 0x4c, 0x98, 0x38, 
-  0x01, 0x13, 0x27, 0x4e, 0xc4, 0xb0, 0x61, 0xc3, 0xcc, 0xef, 0x0d, 0x85, 0x20, 0x4a, 0xf9, 0xed, 
-  0xda, 0xb5, 0x8f, 0xdf, 0x3a, 0xd7, 0xe3, 0xcb, 0xb3, 0xbc, 0xb3, 0x75, 0xdb, 0x56, 0x4b, 0xb0, 
-  0x1d, 0x28, 0x2d, 0x2d, 0xb1, 0xcf, 0x35, 0x6c, 0x2a, 0xd8, 0x94, 0x3b, 0x72, 0xb2, 0xc1, 0xa3, 
-  0x2a, 0xff, 0xc5, 0x8b, 0x17, 0x51, 0x90, 0x9f, 0x1f, 0x6f, 0xe3, 0x12, 0xb5, 0x3e, 0x45, 0xa2, 
-  0x6b, 0xce, 0x9f, 0x88, 0x70, 0xd8, 0x62, 0xa2, 0x09, 0x82, 0x80, 0x87, 0x1e, 0x7e, 0xd8, 0x7c, 
-  0xdc, 0xdc, 0xd4, 0xf4, 0x1f, 0xd7, 0x13, 0x7a, 0x73, 0xf6, 0x6d, 0x50, 0x54, 0x3a, 0xe4, 0xe5, 
-  0xf5, 0xb0, 0xd9, 0x8e, 0x44, 0x0e, 0x1f, 0x3a, 0xaa, 0x7d, 0xd4, 0x6a, 0xfe, 0x83, 0x66, 0xf1, 
-  0x52, 0x79, 0x3c, 0x1e, 0x9b, 0x53, 0xdb, 0x51, 0x4e, 0x33, 0xc5, 0x29, 0x2c, 0xd7, 0x54, 0x40, 
-  0xc2, 0xef, 0x1d, 0x3e, 0x7c, 0x04, 0x57, 0xaf, 0x5e, 0x8d, 0xee, 0xdc, 0xb3, 0x67, 0x1d, 0x1d, 
-  0xff, 0x86, 0x92, 0x43, 0x6d, 0x53, 0xbb, 0x65, 0x57, 0x1e, 0x3b, 0x76, 0x8c, 0x9d, 0x80, 0x48, 
-  0xd7, 0xb2, 0x93, 0xd8, 0xd9, 0xdf, 0x11, 0x01, 0xee, 0x67, 0x9f, 0x7f, 0x6e, 0xf3, 0xe2, 0x0d, 
-  0x1b, 0x3a, 0xd4, 0x24, 0xca, 0x60, 0x28, 0x34, 0xb9, 0x6b, 0xd7, 0xce, 0x19, 0xd7, 0x25, 0x53, 
-  0x9d, 0x64, 0x48, 0x7a, 0x5a, 0x3a, 0x26, 0x8c, 0x9f, 0x80, 0x59, 0xb3, 0x66, 0x86, 0x6d, 0x24, 
-  0x98, 0xfe, 0x59, 0x72, 0x60, 0xb7, 0x56, 0xa3, 0x95, 0x9d, 0xb4, 0xa5, 0x70, 0x8b, 0xac, 0x28, 
-  0xa8, 0xad, 0x8d, 0xfa, 0x78, 0x47, 0x8e, 0x1c, 0x89, 0x9b, 0x87, 0x0d, 0x43, 0x8f, 0x1e, 0x3d, 
-  0x30, 0x74, 0xc8, 0x10, 0x5b, 0x9f, 0x0d, 0xf5, 0xf5, 0xb6, 0x18, 0x15, 0x5d, 0xd7, 0xe6, 0xb4, 
-  0xab, 0x7f, 0x44, 0x84, 0xb2, 0xb2, 0x32, 0xb3, 0x79, 0xe7, 0xce, 0x1d, 0x31, 0x5c, 0x95, 0x62, 
-  0xd2, 0x53, 0xda, 0x88, 0x89, 0x71, 0x14, 0x5a, 0x1b, 0x37, 0x6e, 0x24, 0xe6, 0x38, 0x2f, 0xb8, 
-  0x23, 0x39, 0x8c, 0xba, 0x7d, 0x14, 0x96, 0x2c, 0x5a, 0x8c, 0x25, 0x8b, 0x17, 0x63, 0xf1, 0xe2, 
-  0xc5, 0x78, 0xe1, 0x85, 0x17, 0x9c, 0x43, 0x9e, 0xcc, 0x38, 0x75, 0xfa, 0x34, 0x8a, 0x8b, 0x8b, 
-  0xcd, 0xa6, 0x4e, 0xb9, 0xb9, 0x98, 0x36, 0xed, 0x6e, 0x36, 0xb8, 0x1c, 0x2b, 0xf5, 0x0d, 0x4d, 
-  0xd3, 0xda, 0x8c, 0xd2, 0x10, 0x01, 0x3a, 0xc7, 0xbb, 0xf4, 0x3b, 0x76, 0xec, 0x88, 0x8b, 0x15, 
-  0x17, 0x0d, 0x85, 0x26, 0x46, 0xe6, 0x7e, 0xf7, 0xdd, 0x77, 0x8e, 0x14, 0x66, 0x66, 0xc1, 0x50, 
-  0x2b, 0xde, 0x72, 0x0b, 0x4f, 0x2f, 0x2b, 0x2f, 0x43, 0x46, 0x46, 0x06, 0x00, 0x46, 0xc7, 0x8e, 
-  0x1d, 0xb1, 0x7d, 0xc7, 0x0e, 0xb0, 0xae, 0x43, 0x96, 0x15, 0xdb, 0xbe, 0x3e, 0x78, 0xf0, 0xa0, 
-  0x3d, 0x11, 0xc9, 0xe2, 0xaf, 0x24, 0x06, 0x04, 0x81, 0x62, 0xdd, 0xbc, 0x96, 0x2d, 0x13, 0x6d, 
-  0x39, 0x74, 0xe8, 0x07, 0xce, 0xce, 0xce, 0xa6, 0x86, 0x86, 0x06, 0x5e, 0xba, 0x74, 0x19, 0x85, 
-  0x0d, 0x7b, 0x32, 0x91, 0xc9, 0xec, 0xbc, 0xa9, 0x22, 0xd6, 0x0a, 0x5b, 0xdc, 0x6f, 0x61, 0x42, 
-  0xf8, 0x72, 0xc3, 0x06, 0x5c, 0xbe, 0x7c, 0x19, 0x1d, 0x3a, 0x74, 0xb0, 0x51, 0x94, 0x13, 0x56, 
-  0x47, 0xdf, 0x3e, 0xda, 0xf6, 0xf7, 0xf9, 0xf3, 0xe7, 0xf1, 0xfa, 0x1b, 0x6f, 0xc4, 0x51, 0xa5, 
-  0x28, 0x19, 0xa2, 0xed, 0xf4, 0xe9, 0x33, 0xdc, 0xa3, 0x47, 0x8f, 0x08, 0x38, 0x31, 0x63, 0xfa, 
-  0x74, 0xac, 0x5b, 0xb7, 0x1e, 0x4c, 0x44, 0xa1, 0x50, 0x68, 0x02, 0x80, 0x0f, 0xfe, 0x65, 0xed, 
-  0x37, 0xea, 0xed, 0xb3, 0xcb, 0x9e, 0x93, 0x27, 0x4f, 0x62, 0xf9, 0x8a, 0x15, 0x4e, 0x81, 0x08, 
-  0x8b, 0x17, 0x26, 0xde, 0x11, 0x60, 0x02, 0x3d, 0xdc, 0xdf, 0x9a, 0xd5, 0xab, 0x6d, 0x6e, 0x3a, 
-  0x49, 0x14, 0x21, 0xcb, 0xb2, 0xed, 0x9b, 0xd2, 0xd2, 0x52, 0xbc, 0xf6, 0xfa, 0xeb, 0xce, 0x46, 
-  0x31, 0xdb, 0x9d, 0x5a, 0x84, 0xd6, 0x11, 0x03, 0x00, 0xcf, 0x3c, 0xfb, 0x0c, 0x75, 0xef, 0x91, 
-  0x87, 0x41, 0x83, 0x07, 0x93, 0xd5, 0x53, 0x83, 0xeb, 0x55, 0x6b, 0x28, 0x86, 0xf7, 0x87, 0xa3, 
-  0x4e, 0xa6, 0xc7, 0x8a, 0xaf, 0x87, 0xfd, 0x3a, 0x71, 0x16, 0xe7, 0xb1, 0xbf, 0xfd, 0x6e, 0xa7, 
-  0xad, 0x9b, 0x21, 0x43, 0x86, 0x86, 0xb9, 0x02, 0x43, 0xd3, 0xd4, 0x51, 0x2f, 0xfe, 0xf9, 0xcf, 
-  0xd4, 0x06, 0x52, 0x49, 0xb7, 0x52, 0x5f, 0xdc, 0xb0, 0x96, 0x84, 0xa8, 0xe3, 0xc7, 0x4f, 0xe0, 
-  0x89, 0x27, 0x9e, 0x88, 0x51, 0x88, 0x22, 0xac, 0xcb, 0x2e, 0x68, 0x05, 0x21, 0xdc, 0x46, 0x14, 
-  0xf5, 0xaa, 0x5b, 0xd6, 0x30, 0xf7, 0x9d, 0x77, 0xf0, 0xc5, 0x17, 0x6b, 0xc3, 0x88, 0xa5, 0x38, 
-  0x81, 0x55, 0x79, 0xf9, 0x32, 0xfe, 0xf3, 0x3f, 0xff, 0x04, 0x9f, 0xcf, 0x67, 0xc3, 0x23, 0x47, 
-  0x7d, 0x74, 0xd1, 0x9d, 0xcf, 0x96, 0xe4, 0x53, 0x6b, 0x3f, 0x14, 0xe3, 0xd7, 0x63, 0x33, 0xf6, 
-  0x65, 0x21, 0x30, 0x8a, 0xf7, 0x76, 0x5a, 0x94, 0x3e, 0x5d, 0xd7, 0x2d, 0x56, 0x8f, 0xa5, 0xcf, 
-  0xf0, 0xcf, 0x7d, 0xfb, 0xf6, 0x5a, 0xfd, 0x86, 0x76, 0x34, 0x91, 0x93, 0xc6, 0x45, 0x31, 0x1a, 
-  0x35, 0xd9, 0xec, 0x25, 0x5d, 0x33, 0x08, 0x7d, 0xfe, 0xfc, 0x05, 0xa8, 0xaf, 0xaf, 0x37, 0xdb, 
-  0x3b, 0xe6, 0xe4, 0xe0, 0xc1, 0x07, 0x1e, 0x00, 0x98, 0x10, 0x0a, 0xa9, 0xc9, 0xcb, 0x97, 0x2e, 
-  0xcd, 0x6d, 0x95, 0xfd, 0xba, 0x5c, 0xae, 0x8a, 0x96, 0x96, 0x96, 0x0c, 0x10, 0xb0, 0x70, 0xe1, 
-  0x27, 0xc8, 0xcc, 0xcc, 0x8c, 0x71, 0x2e, 0x33, 0xd4, 0x90, 0x8a, 0x43, 0x87, 0x0e, 0x61, 0xdd, 
-  0xfa, 0xf5, 0x20, 0x41, 0x00, 0x88, 0x20, 0x49, 0x12, 0xe6, 0xbe, 0x3d, 0x17, 0x8a, 0xa2, 0x80, 
-  0x88, 0x50, 0x5b, 0x5b, 0x6b, 0xd3, 0x1e, 0x0f, 0x1f, 0x39, 0x82, 0xf9, 0xf3, 0xff, 0xcb, 0x8c, 
-  0xcb, 0x16, 0x14, 0x14, 0x58, 0xf2, 0x80, 0x8c, 0x8c, 0xba, 0x87, 0x1e, 0x7e, 0x18, 0x5b, 0xb7, 
-  0x6d, 0xc3, 0x8c, 0xe9, 0xd3, 0x91, 0x99, 0x99, 0x09, 0x49, 0x92, 0xd0, 0xd4, 0xd4, 0x84, 0x53, 
-  0xa7, 0x4e, 0xe1, 0x4f, 0x7f, 0xfa, 0x13, 0x6a, 0xea, 0xea, 0xa2, 0xde, 0x80, 0x70, 0x84, 0x68, 
-  0xf1, 0xa2, 0x45, 0x66, 0x08, 0x4e, 0xd3, 0x75, 0x94, 0x96, 0x95, 0xd9, 0x76, 0xdd, 0xf7, 0xbb, 
-  0x77, 0x63, 0xde, 0xbc, 0xff, 0x32, 0xc7, 0x39, 0x70, 0xe0, 0x80, 0x4d, 0x42, 0x44, 0x52, 0x13, 
-  0x08, 0xc0, 0xc7, 0x1f, 0x7d, 0x8c, 0xcc, 0x4c, 0x43, 0xe7, 0xa8, 0xa9, 0xa9, 0x01, 0x88, 0xb0, 
-  0x6e, 0xdd, 0x3a, 0x14, 0x14, 0x14, 0x98, 0x88, 0xf9, 0xe7, 0x3f, 0xff, 0x09, 0x41, 0x10, 0xf0, 
-  0xde, 0x7b, 0xef, 0xc1, 0xe3, 0xf5, 0x42, 0x20, 0x42, 0x71, 0x71, 0x89, 0xb9, 0x96, 0x57, 0x5f, 
-  0x7b, 0x1d, 0x5e, 0x6f, 0xa2, 0x41, 0xc4, 0x61, 0xf3, 0x89, 0x00, 0x2c, 0x5d, 0xba, 0x14, 0xdf, 
-  0xed, 0xfa, 0x2e, 0x1c, 0x18, 0x89, 0x6e, 0x0c, 0x0a, 0xeb, 0x07, 0x65, 0x65, 0xe5, 0x20, 0x10, 
-  0x3e, 0xfb, 0xec, 0x33, 0xec, 0xde, 0xbd, 0xdb, 0x98, 0x9c, 0xae, 0xa3, 0xbc, 0xa2, 0xc2, 0x88, 
-  0x37, 0x4b, 0x12, 0x5e, 0x7d, 0xed, 0x55, 0x74, 0x0a, 0xbb, 0x35, 0x89, 0x08, 0x17, 0x2b, 0x2a, 
-  0x60, 0xc9, 0x7d, 0x0e, 0xb4, 0xaa, 0x23, 0x26, 0x25, 0x25, 0xbe, 0xe9, 0x0f, 0x06, 0x7f, 0xef, 
-  0xe4, 0x84, 0x8f, 0xda, 0x9b, 0xd1, 0x38, 0x56, 0x34, 0x45, 0x36, 0xc6, 0xb8, 0xb3, 0xee, 0x9c, 
-  0x88, 0x9c, 0xb2, 0xe5, 0x0f, 0xdb, 0x22, 0xcf, 0x8e, 0xb9, 0xc3, 0xb6, 0xb7, 0x22, 0x63, 0x81, 
-  0x59, 0x91, 0x95, 0x13, 0xa1, 0x50, 0xe8, 0x06, 0x76, 0xd4, 0xd8, 0x1d, 0x72, 0x74, 0xcd, 0xe7, 
-  0x6c, 0x9b, 0x9b, 0x4b, 0x96, 0x17, 0x69, 0x9a, 0x36, 0x48, 0xd5, 0xf5, 0xc1, 0x8e, 0x12, 0x88, 
-  0xae, 0x65, 0x64, 0xc7, 0xc6, 0x4b, 0xc9, 0x02, 0x1f, 0x8a, 0x4f, 0x44, 0x8e, 0xf5, 0x31, 0x5a, 
-  0x4d, 0x26, 0x26, 0x4b, 0xd2, 0xb1, 0x55, 0xdb, 0xa4, 0xb6, 0x55, 0x7c, 0x22, 0xb8, 0x5d, 0xae, 
-  0x43, 0x8d, 0x0d, 0x0d, 0xc3, 0x5a, 0x65, 0xbf, 0xed, 0x33, 0x32, 0xfe, 0x22, 0x09, 0xe2, 0x7e, 
-  0x9b, 0xc2, 0xca, 0x0e, 0x81, 0x6f, 0x23, 0xeb, 0x9d, 0x65, 0x49, 0xda, 0x4d, 0x04, 0x1f, 0x81, 
-  0x62, 0xf9, 0x4c, 0x24, 0x23, 0x4e, 0x13, 0x08, 0x9a, 0xdd, 0xec, 0x89, 0x4e, 0x5c, 0x14, 0x84, 
-  0xaa, 0xd4, 0xe4, 0xe4, 0xbb, 0x3c, 0x6e, 0xf7, 0xdb, 0x02, 0x91, 0x0a, 0x8a, 0xb2, 0xae, 0x68, 
-  0x86, 0xb5, 0xf9, 0x5b, 0x6d, 0x82, 0xc7, 0xf3, 0x40, 0x4e, 0x76, 0x87, 0x91, 0xb2, 0x2c, 0xef, 
-  0x22, 0x9b, 0xb7, 0x91, 0x6d, 0x9a, 0xaa, 0x24, 0x0a, 0x45, 0x04, 0x84, 0x62, 0x6d, 0xec, 0x48, 
-  0x5f, 0x2e, 0x59, 0x3a, 0x90, 0x95, 0x95, 0xf5, 0x6c, 0x72, 0x72, 0xd2, 0x0c, 0x49, 0x14, 0x2e, 
-  0x92, 0x45, 0xf2, 0x47, 0x03, 0xb0, 0xad, 0xc8, 0x57, 0x66, 0x93, 0xcd, 0x03, 0x96, 0x2f, 0x99, 
-  0x99, 0x9c, 0x24, 0x96, 0x23, 0x7d, 0x50, 0xb4, 0x0f, 0x8e, 0xa9, 0x46, 0x88, 0x25, 0x24, 0x6b, 
-  0xf2, 0x84, 0xd5, 0xb6, 0x25, 0x40, 0x24, 0xaa, 0xf4, 0x7a, 0xdc, 0x8f, 0x5f, 0xd3, 0x9d, 0x3c, 
-  0x72, 0xe4, 0x48, 0xe9, 0xec, 0xb9, 0x73, 0x93, 0x54, 0x35, 0x34, 0x22, 0x10, 0x08, 0x26, 0x33, 
-  0x33, 0x48, 0x10, 0xc8, 0x28, 0x57, 0x10, 0xa0, 0xeb, 0x1a, 0x7b, 0xdc, 0x9e, 0x5a, 0x97, 0xdb, 
-  0xf5, 0x4d, 0xe5, 0xa5, 0xca, 0xed, 0x39, 0x39, 0x1d, 0xbb, 0xfa, 0xfd, 0x81, 0xfb, 0x7d, 0x2d, 
-  0xbe, 0xce, 0x44, 0x44, 0xba, 0x6e, 0xcc, 0xd6, 0xe3, 0xf1, 0x54, 0xba, 0x14, 0xf7, 0x46, 0x59, 
-  0x16, 0x5b, 0x9a, 0x9a, 0x9b, 0xa7, 0xfb, 0xfd, 0x81, 0x6c, 0x22, 0x82, 0xa6, 0x69, 0xec, 0x71, 
-  0xbb, 0x34, 0x41, 0x14, 0x4f, 0x25, 0x25, 0x25, 0xaf, 0x2c, 0x29, 0x2e, 0xae, 0x03, 0x80, 0xce, 
-  0x5d, 0xba, 0xf4, 0x6b, 0x68, 0x68, 0x78, 0x4c, 0x55, 0xd5, 0x11, 0x9a, 0xa6, 0xf5, 0x01, 0x58, 
-  0x11, 0x45, 0xb1, 0x99, 0x48, 0x38, 0x24, 0x89, 0xe2, 0xb6, 0x84, 0x84, 0xc4, 0xcf, 0xca, 0xcb, 
-  0xcb, 0xaa, 0x01, 0x60, 0xdc, 0xb8, 0x71, 0xc2, 0xe1, 0xc3, 0x87, 0x7f, 0x11, 0x0c, 0x05, 0x47, 
-  0x69, 0x9a, 0xee, 0x06, 0x1b, 0xa9, 0x99, 0x82, 0x20, 0x84, 0x24, 0x49, 0x3a, 0xda, 0x21, 0x2b, 
-  0x6b, 0x79, 0xa3, 0xcf, 0xd7, 0xa5, 0xb9, 0xa9, 0x71, 0x7a, 0x30, 0x18, 0xca, 0x21, 0x02, 0x34, 
-  0x55, 0x67, 0x41, 0x14, 0x54, 0x45, 0x51, 0x7e, 0x48, 0x4e, 0x4d, 0x5d, 0x51, 0x52, 0x58, 0x18, 
-  0x00, 0x80, 0xdc, 0xce, 0xb9, 0xa9, 0x2d, 0xbe, 0x96, 0xfb, 0x02, 0xc1, 0xe0, 0x00, 0x4d, 0xd3, 
-  0x88, 0xc1, 0x70, 0x2b, 0x4a, 0xb5, 0x28, 0x49, 0x05, 0xa1, 0x50, 0xa8, 0x9f, 0xaa, 0x6a, 0x89, 
-  0xa2, 0x28, 0x92, 0xae, 0xeb, 0x20, 0xa0, 0x5e, 0x56, 0xe4, 0x8a, 0x50, 0x48, 0xed, 0x45, 0x44, 
-  0xa2, 0xae, 0x6b, 0xac, 0x6b, 0xba, 0xee, 0x72, 0xbb, 0xf2, 0xbb, 0xe4, 0x76, 0x5e, 0x5b, 0x5a, 
-  0x5e, 0x36, 0x54, 0xd3, 0xb4, 0x91, 0xc1, 0x60, 0xc8, 0x05, 0x80, 0x14, 0x59, 0xf2, 0xc9, 0xb2, 
-  0xbc, 0x4b, 0x55, 0xb5, 0x6c, 0x06, 0xf7, 0x09, 0x06, 0x43, 0x8a, 0x20, 0x08, 0x44, 0x04, 0x26, 
-  0x22, 0xd2, 0x74, 0x1d, 0xba, 0xa6, 0xb1, 0xcb, 0xe5, 0x2a, 0xf4, 0x7a, 0x12, 0x2e, 0x37, 0xfb, 
-  0x9a, 0x6e, 0xd0, 0x34, 0x2d, 0x41, 0xd7, 0x99, 0xc3, 0xec, 0x99, 0x13, 0x13, 0x12, 0x2e, 0xa8, 
-  0x9a, 0xd6, 0xa0, 0x6b, 0x5a, 0x7f, 0x55, 0xd3, 0x3c, 0xba, 0xae, 0x33, 0x11, 0x74, 0xb7, 0xcb, 
-  0x7d, 0xda, 0xed, 0xf6, 0xac, 0xac, 0xa8, 0xb8, 0x58, 0x8d, 0xff, 0x29, 0xd7, 0x9f, 0x5f, 0xfa, 
-  0x4f, 0xc2, 0x4f, 0xd7, 0x4f, 0xd7, 0x4f, 0xd7, 0x35, 0xcc, 0xa8, 0x17, 0x5f, 0x7c, 0x91, 0x16, 
-  0x2d, 0x5a, 0x34, 0xdc, 0xd7, 0xe2, 0x1b, 0xad, 0xeb, 0x7a, 0x17, 0x02, 0xc9, 0x24, 0x50, 0x93, 
-  0x24, 0x4a, 0x47, 0xbc, 0x5e, 0xef, 0x86, 0x92, 0x92, 0x92, 0xba, 0x31, 0x77, 0x8c, 0x11, 0x2e, 
-  0xfc, 0x78, 0x61, 0x50, 0x63, 0x63, 0x63, 0x17, 0x51, 0x14, 0x29, 0xa2, 0xfa, 0x6b, 0xba, 0xce, 
-  0x8a, 0x2c, 0xab, 0xc9, 0xc9, 0xc9, 0xa7, 0xf2, 0xf3, 0xf3, 0x8b, 0x00, 0x20, 0xaf, 0x47, 0x5e, 
-  0x5a, 0xc0, 0xef, 0x1f, 0x12, 0x08, 0x04, 0x12, 0x2d, 0x72, 0x8e, 0x74, 0x5d, 0x63, 0x59, 0x51, 
-  0x02, 0x29, 0xc9, 0x29, 0x07, 0x01, 0x24, 0xd7, 0xd4, 0xd6, 0xf4, 0x17, 0x04, 0x41, 0x22, 0x10, 
-  0x49, 0x92, 0xd4, 0x94, 0x94, 0x9c, 0x7c, 0x30, 0xe0, 0x6f, 0xf1, 0x36, 0x35, 0x35, 0x0f, 0xd6, 
-  0x75, 0xdd, 0xc5, 0x3a, 0x6b, 0x89, 0xc9, 0x89, 0x25, 0x3d, 0xf2, 0xba, 0x1f, 0xdf, 0xb1, 0xe3, 
-  0x5b, 0x3d, 0x76, 0xde, 0xc3, 0x47, 0xdc, 0x22, 0xe4, 0xff, 0x78, 0xe1, 0x76, 0x7f, 0x20, 0x70, 
-  0xbb, 0x24, 0x8a, 0xd9, 0xcc, 0xba, 0x20, 0xcb, 0x4a, 0x95, 0x28, 0x8a, 0x7b, 0x73, 0x72, 0xb2, 
-  0xb7, 0x1d, 0x39, 0x72, 0xcc, 0xd4, 0x14, 0x7b, 0xf7, 0xfc, 0x99, 0x54, 0x53, 0x5f, 0xf7, 0xbf, 
-  0x00, 0x0c, 0x0a, 0x06, 0x83, 0x39, 0x9a, 0xae, 0xe9, 0x6e, 0x97, 0xfb, 0x82, 0xcb, 0xe5, 0xda, 
-  0x59, 0x5e, 0x5e, 0x7e, 0x06, 0x00, 0xba, 0x76, 0xeb, 0xda, 0xbf, 0xbe, 0xbe, 0xbe, 0xa7, 0x24, 
-  0x8a, 0x44, 0x82, 0x00, 0x22, 0x0a, 0x65, 0x66, 0x64, 0x1c, 0x09, 0x85, 0xd4, 0xc4, 0x2b, 0x57, 
-  0xaf, 0xf4, 0x11, 0x05, 0x51, 0xd4, 0x34, 0x95, 0x93, 0x53, 0x52, 0x4a, 0x3b, 0x64, 0x66, 0x9d, 
-  0x2d, 0x2d, 0x2f, 0x1d, 0x16, 0xf0, 0x07, 0x53, 0x23, 0x1a, 0x30, 0x11, 0x41, 0xd7, 0x75, 0x3d, 
-  0x35, 0x35, 0xb5, 0x34, 0xbd, 0x5d, 0xfa, 0x89, 0x83, 0x07, 0x0e, 0x99, 0x59, 0x0a, 0x43, 0x86, 
-  0x0d, 0x75, 0x17, 0x16, 0x14, 0xdc, 0x09, 0xd0, 0x4d, 0xc1, 0x60, 0x20, 0x5d, 0xd7, 0xf5, 0xa0, 
-  0xd7, 0xe3, 0x3d, 0x93, 0x9a, 0x9a, 0xb2, 0x35, 0x3f, 0xbf, 0xe0, 0xa2, 0xe1, 0x96, 0xed, 0xde, 
-  0xa3, 0xb1, 0xa9, 0xa9, 0x8f, 0xa6, 0x69, 0x32, 0xeb, 0xcc, 0x61, 0x51, 0xc8, 0xb2, 0x2c, 0x85, 
-  0x3c, 0x1e, 0xef, 0xe9, 0x48, 0x19, 0xe8, 0x35, 0x91, 0xda, 0xa9, 0x53, 0xa7, 0x9b, 0x6a, 0xeb, 
-  0xea, 0x3e, 0x08, 0x06, 0x83, 0x43, 0x9c, 0xca, 0xbd, 0x04, 0x41, 0x68, 0xf2, 0x7a, 0x3d, 0xef, 
-  0xaa, 0xaa, 0x36, 0xc9, 0xef, 0xf7, 0xf7, 0x6b, 0xab, 0x62, 0xcb, 0xa5, 0x28, 0x7b, 0x15, 0x45, 
-  0x3e, 0xe7, 0x6b, 0xf1, 0x3f, 0xac, 0xe9, 0xba, 0x64, 0xd7, 0x8a, 0x39, 0xd6, 0x92, 0x27, 0x58, 
-  0x4a, 0x0e, 0xc3, 0x40, 0xd1, 0x8d, 0x74, 0x0c, 0x22, 0x6b, 0x89, 0xa2, 0xdb, 0xe5, 0x3a, 0xef, 
-  0x72, 0xb9, 0x66, 0x56, 0x55, 0x55, 0xed, 0x8b, 0x8c, 0xd8, 0xa1, 0x43, 0x87, 0x91, 0x0d, 0x0d, 
-  0x0d, 0xef, 0x87, 0x54, 0xb5, 0x3f, 0x81, 0xc2, 0x15, 0x6c, 0xd1, 0x79, 0xcb, 0xb2, 0x54, 0xe9, 
-  0xf5, 0x78, 0x9f, 0xab, 0xaa, 0xaa, 0x5a, 0x91, 0x96, 0x96, 0xf6, 0x40, 0x20, 0x10, 0x78, 0x2d, 
-  0xa4, 0x6a, 0x9d, 0x6d, 0xfa, 0x5b, 0x58, 0x0d, 0x4f, 0xf0, 0x7a, 0xbf, 0xd6, 0x75, 0x2d, 0xbd, 
-  0xc5, 0x1f, 0x18, 0x6e, 0x2b, 0xa5, 0x8b, 0x9d, 0xab, 0xdd, 0x0f, 0xae, 0x03, 0x24, 0x38, 0x66, 
-  0x09, 0x32, 0x20, 0x8a, 0xe2, 0x15, 0x45, 0x96, 0xe6, 0xb7, 0x6b, 0xd7, 0xfe, 0x6f, 0x8d, 0x4d, 
-  0x4d, 0x8f, 0x36, 0x35, 0x35, 0xfe, 0x45, 0xd3, 0x39, 0x03, 0x31, 0xdd, 0x0a, 0x02, 0xa9, 0x2e, 
-  0x97, 0xb2, 0x4c, 0x53, 0xb5, 0xbc, 0x90, 0xaa, 0xde, 0x6a, 0x7a, 0x5d, 0xe3, 0x4b, 0x4a, 0xd9, 
-  0xa5, 0x28, 0x3b, 0x13, 0x12, 0xbc, 0x8f, 0x5f, 0xbe, 0x7c, 0xa5, 0xa8, 0x55, 0xa4, 0xb6, 0x6f, 
-  0xdf, 0x7e, 0x6c, 0x63, 0x53, 0xd3, 0x97, 0xba, 0xae, 0x7b, 0x9c, 0x3c, 0x41, 0xe4, 0xe8, 0xc1, 
-  0x6d, 0x25, 0x0a, 0xc1, 0xb1, 0xb5, 0x7b, 0x76, 0x2d, 0xd5, 0x66, 0x12, 0xb4, 0x55, 0xbe, 0x47, 
-  0x0e, 0x11, 0x02, 0x22, 0x88, 0x44, 0xf5, 0xa9, 0xa9, 0x29, 0x37, 0x54, 0x56, 0x5e, 0x2e, 0x49, 
-  0x4b, 0x4b, 0x9b, 0xda, 0xec, 0xf3, 0xad, 0x01, 0x20, 0xdb, 0x72, 0x4a, 0xec, 0xea, 0x3b, 0x08, 
-  0x60, 0x6f, 0x82, 0x77, 0x9f, 0xcf, 0xe7, 0xbb, 0x05, 0x00, 0x31, 0x73, 0x1b, 0x5e, 0xa3, 0xb6, 
-  0xd6, 0xe8, 0xf4, 0x8c, 0xe0, 0x5c, 0xae, 0x49, 0x16, 0x73, 0x8b, 0xa1, 0xc8, 0xca, 0xc5, 0x60, 
-  0x30, 0x98, 0xd3, 0x36, 0x0c, 0x2d, 0x9a, 0x2e, 0x73, 0xab, 0x21, 0x97, 0x70, 0x7e, 0x54, 0x45, 
-  0xbb, 0xf4, 0x76, 0x83, 0x2a, 0x2a, 0x2a, 0xae, 0xc6, 0x21, 0xb5, 0x53, 0x6e, 0xa7, 0xdc, 0xab, 
-  0x57, 0xaa, 0x4e, 0xea, 0xac, 0xa7, 0x44, 0x7c, 0xbe, 0xbf, 0x7b, 0xfe, 0x79, 0xf4, 0xeb, 0xd7, 
-  0x1f, 0x1e, 0x8f, 0x1b, 0xd5, 0xd5, 0xd5, 0xd8, 0xb5, 0x6b, 0x17, 0xde, 0x7a, 0xfb, 0x6d, 0x10, 
-  0x09, 0x00, 0x18, 0xd9, 0x1d, 0xb2, 0x71, 0xcf, 0x3d, 0xd3, 0xcc, 0x5c, 0x1b, 0x66, 0x86, 0xaa, 
-  0xaa, 0x28, 0x2e, 0x2e, 0xc6, 0x57, 0x9b, 0x36, 0x81, 0x04, 0xc1, 0x1c, 0xe4, 0xde, 0x19, 0x33, 
-  0x2c, 0x0e, 0x0d, 0xb2, 0xe0, 0xcb, 0x28, 0xe7, 0x5b, 0xb9, 0x7a, 0x35, 0xa6, 0xdf, 0x73, 0x0f, 
-  0xb2, 0xb3, 0x3b, 0x86, 0x1d, 0xef, 0xa5, 0x58, 0xb7, 0x7e, 0x3d, 0x00, 0x60, 0xc2, 0xf8, 0xf1, 
-  0xe8, 0xd9, 0xa3, 0x27, 0x18, 0x8c, 0xea, 0x9a, 0x6a, 0x2c, 0x5b, 0xb6, 0x1c, 0x44, 0xc4, 0x6e, 
-  0x97, 0xeb, 0x8d, 0x84, 0x04, 0xef, 0x87, 0xd5, 0x35, 0xb5, 0x27, 0x19, 0x48, 0x02, 0x33, 0x6e, 
-  0xbb, 0x75, 0x24, 0x66, 0x3d, 0x36, 0x0b, 0x79, 0xdd, 0xf3, 0xa0, 0xe9, 0x1a, 0xca, 0xca, 0xca, 
-  0xb0, 0x7a, 0xf5, 0x6a, 0x7c, 0xb5, 0x69, 0x53, 0x4c, 0xa6, 0x20, 0x63, 0xda, 0xb4, 0x69, 0x98, 
-  0x76, 0xf7, 0xdd, 0xe8, 0xd4, 0x29, 0x17, 0xaa, 0x1a, 0x42, 0x61, 0x61, 0x21, 0x3e, 0xfb, 0xec, 
-  0x33, 0x7c, 0xf7, 0xfd, 0xf7, 0xe6, 0xbc, 0x27, 0x4e, 0x9c, 0x88, 0xee, 0xdd, 0xba, 0x81, 0x88, 
-  0x50, 0x59, 0x59, 0x89, 0xd5, 0x6b, 0xd6, 0x00, 0x00, 0x7e, 0x3e, 0x75, 0x2a, 0x3a, 0x77, 0xee, 
-  0x02, 0x66, 0x1d, 0x65, 0xe5, 0xe5, 0xf8, 0xf2, 0xcb, 0x2f, 0xf1, 0xf8, 0x63, 0x8f, 0x21, 0x21, 
-  0x21, 0xc1, 0x74, 0xaa, 0x00, 0x46, 0xa2, 0xd8, 0xea, 0x35, 0x6b, 0xa2, 0x1e, 0x31, 0x0b, 0x5e, 
-  0xc6, 0x8f, 0x1b, 0x87, 0xfb, 0xef, 0xbb, 0x1f, 0x9d, 0xbb, 0x76, 0x41, 0x30, 0x18, 0x44, 0x41, 
-  0x7e, 0x3e, 0xde, 0x79, 0xe7, 0x1d, 0x9c, 0x3b, 0x7f, 0x1e, 0x80, 0x51, 0xa5, 0x30, 0x66, 0xf4, 
-  0x18, 0x08, 0x22, 0x59, 0x33, 0x84, 0xc0, 0x60, 0xd4, 0xd5, 0xd6, 0xe1, 0xb3, 0xcf, 0x3f, 0x07, 
-  0x88, 0xe0, 0x75, 0xbb, 0x5f, 0xab, 0xaf, 0xaf, 0xff, 0x63, 0x1c, 0x6d, 0x24, 0xa7, 0x24, 0x7f, 
-  0xa8, 0x84, 0xcb, 0xe4, 0xc6, 0x8d, 0x1b, 0xc7, 0x25, 0x25, 0xa5, 0x66, 0xc9, 0x9e, 0xf5, 0xde, 
-  0xb5, 0x6b, 0x17, 0xbb, 0xdc, 0x6e, 0x96, 0x15, 0x85, 0xff, 0xf8, 0xc7, 0x17, 0xc3, 0x65, 0x77, 
-  0x5a, 0x5c, 0x09, 0x5e, 0x49, 0x49, 0x09, 0x3f, 0xfb, 0xec, 0xb3, 0x6c, 0x94, 0x47, 0xca, 0x7c, 
-  0xe6, 0xcc, 0x19, 0xdb, 0x3b, 0xd6, 0xbb, 0xa8, 0xa8, 0x88, 0x25, 0x59, 0xe6, 0xd3, 0x91, 0x77, 
-  0x34, 0x8d, 0xcf, 0x9f, 0xff, 0x91, 0x25, 0xd9, 0x98, 0xcf, 0xd6, 0xad, 0x5b, 0xcd, 0xb2, 0xbe, 
-  0x73, 0xe7, 0xce, 0xb1, 0xac, 0x28, 0xac, 0xb8, 0x5c, 0x9c, 0x94, 0x94, 0xb4, 0xd9, 0x9b, 0x90, 
-  0xb0, 0x54, 0x76, 0xb9, 0x58, 0x56, 0x14, 0x7e, 0x61, 0xf6, 0x0b, 0x5c, 0xdf, 0xd0, 0x10, 0x37, 
-  0x67, 0x9f, 0xcf, 0xc7, 0xaf, 0xbc, 0xf2, 0x4a, 0xb4, 0x8c, 0x51, 0x51, 0xf8, 0xd3, 0x45, 0x8b, 
-  0xcc, 0x12, 0x4c, 0xe3, 0xd6, 0x59, 0xd3, 0x34, 0xae, 0xab, 0xab, 0xe3, 0xe7, 0x9f, 0x7f, 0xde, 
-  0x7c, 0x6f, 0xf7, 0xf7, 0xbb, 0xcd, 0x35, 0x1e, 0x3b, 0x76, 0x8c, 0x23, 0xe5, 0x9e, 0x07, 0x0e, 
-  0x1c, 0x30, 0xe7, 0x7a, 0xf0, 0xe0, 0x21, 0x96, 0x24, 0x99, 0x1b, 0x1a, 0x1a, 0xcc, 0x52, 0x4b, 
-  0x73, 0x7d, 0x9a, 0xc6, 0x8d, 0x8d, 0x4d, 0xbc, 0x7a, 0xd5, 0x6a, 0x5d, 0x10, 0x45, 0xb3, 0xdf, 
-  0x37, 0xdf, 0x7c, 0x93, 0x7d, 0xbe, 0x96, 0x38, 0x18, 0x57, 0x56, 0x56, 0xf2, 0xe4, 0x29, 0x53, 
-  0x58, 0x56, 0x14, 0x5e, 0xb2, 0x64, 0x49, 0x14, 0xbe, 0x31, 0x30, 0xbb, 0x14, 0x2e, 0xb9, 0x94, 
-  0x5d, 0x0a, 0xbb, 0xdd, 0x9e, 0x5d, 0x71, 0x08, 0xed, 0xdb, 0xaf, 0xaf, 0xc7, 0xe3, 0xf1, 0x34, 
-  0xca, 0x8a, 0xc2, 0x92, 0xa2, 0xf0, 0x91, 0x23, 0x47, 0xe2, 0x00, 0x63, 0xde, 0xba, 0xc6, 0x1f, 
-  0x7e, 0xf8, 0xa1, 0x89, 0xd4, 0x48, 0x9b, 0x79, 0x5b, 0xde, 0x6d, 0x68, 0x6c, 0xe4, 0x29, 0x53, 
-  0xa7, 0xb2, 0x24, 0xcb, 0x7c, 0xf6, 0xcc, 0xd9, 0x56, 0xfb, 0x2c, 0x2e, 0x2e, 0x36, 0xde, 0x39, 
-  0x7b, 0x96, 0x35, 0x5d, 0x67, 0x5d, 0xd3, 0x39, 0x10, 0x08, 0xf0, 0xa0, 0xc1, 0x83, 0x58, 0x56, 
-  0x14, 0xde, 0xb6, 0x6d, 0x1b, 0xeb, 0xba, 0xce, 0xba, 0xae, 0xf3, 0xf9, 0xf3, 0xe7, 0x4d, 0xa4, 
-  0xba, 0x3d, 0x9e, 0x72, 0xc5, 0xe5, 0x0a, 0xc8, 0x2e, 0x85, 0x07, 0x0d, 0x1a, 0xc4, 0x35, 0x35, 
-  0x35, 0x61, 0xe4, 0xe8, 0x36, 0x44, 0x69, 0xba, 0xce, 0x75, 0x75, 0x75, 0xdc, 0xb7, 0x6f, 0x5f, 
-  0x96, 0x15, 0x85, 0x9f, 0x7c, 0xf2, 0x49, 0x0e, 0x04, 0x83, 0x31, 0xf3, 0xd0, 0xa3, 0x80, 0xbd, 
-  0x5c, 0xc9, 0xd9, 0xd9, 0xd9, 0x06, 0x52, 0x77, 0xef, 0x36, 0xd7, 0x78, 0xec, 0xf8, 0x71, 0x13, 
-  0x29, 0x07, 0x0e, 0x1e, 0x34, 0xdf, 0x3f, 0x78, 0xe8, 0x10, 0x4b, 0xb2, 0xcc, 0x8d, 0x8d, 0x8d, 
-  0xac, 0x9b, 0x63, 0x1a, 0xe3, 0x5a, 0xc7, 0x58, 0xb8, 0x70, 0xa1, 0x2e, 0xcb, 0x0a, 0x0f, 0x1f, 
-  0x3e, 0x9c, 0x1b, 0x1a, 0x1b, 0x1d, 0xc7, 0xd6, 0x34, 0x8d, 0x0f, 0x1e, 0x3c, 0xc8, 0x92, 0x6c, 
-  0x20, 0x55, 0xd3, 0xf5, 0x28, 0x5c, 0x2d, 0xf0, 0xbd, 0x7c, 0xf9, 0xb2, 0xa5, 0x36, 0x36, 0xe1, 
-  0x68, 0x9c, 0x47, 0xe9, 0xea, 0x95, 0xab, 0x23, 0x35, 0x4d, 0x4f, 0x00, 0x80, 0xa9, 0x53, 0xa6, 
-  0x60, 0x60, 0xb8, 0x62, 0x3b, 0x72, 0x69, 0x9a, 0x5d, 0xd1, 0xbc, 0x73, 0xec, 0x9d, 0x11, 0x99, 
-  0x68, 0x97, 0x4a, 0x31, 0xe2, 0x21, 0x21, 0xc1, 0x8b, 0x27, 0x9e, 0x78, 0xc2, 0x1a, 0xdb, 0x76, 
-  0x8c, 0x51, 0xea, 0x96, 0xa4, 0xb2, 0xc8, 0x2b, 0x92, 0x2c, 0xe1, 0xa1, 0x07, 0x1f, 0x6a, 0x55, 
-  0xea, 0xb0, 0xf1, 0x5d, 0x0e, 0x03, 0x0a, 0x18, 0x78, 0xe2, 0xc9, 0x27, 0x39, 0x25, 0x25, 0x25, 
-  0x26, 0x07, 0x49, 0x37, 0xfb, 0x4c, 0x4a, 0x4a, 0x32, 0xf3, 0x6c, 0xef, 0xbf, 0xff, 0x7e, 0x48, 
-  0xa2, 0x14, 0x8d, 0xee, 0x58, 0x72, 0x9f, 0x00, 0x20, 0xa3, 0x7d, 0x06, 0x7e, 0xf7, 0xbb, 0xdf, 
-  0x81, 0x9d, 0x5c, 0x7c, 0x71, 0x6e, 0x4c, 0xa7, 0x80, 0x90, 0x35, 0x8c, 0x17, 0x5d, 0xd3, 0x84, 
-  0x09, 0x13, 0x88, 0xc1, 0x98, 0x39, 0x73, 0x26, 0x12, 0xbc, 0x5e, 0x67, 0xc0, 0x11, 0xa1, 0x7f, 
-  0xff, 0xfe, 0xc8, 0xcc, 0x68, 0x1f, 0x1f, 0x3c, 0x62, 0x5b, 0xca, 0x0b, 0x3b, 0xfd, 0x6e, 0x3a, 
-  0xf4, 0x43, 0x6a, 0xe8, 0x06, 0x0e, 0x57, 0x69, 0xdd, 0x35, 0x76, 0xac, 0x19, 0x99, 0xd0, 0x34, 
-  0x0d, 0xb3, 0x67, 0xcf, 0xc6, 0xfb, 0xef, 0x7f, 0x80, 0x9d, 0x3b, 0x77, 0x60, 0xd8, 0xcd, 0x86, 
-  0x9b, 0x31, 0x37, 0x37, 0x17, 0xfd, 0xfb, 0xf7, 0x8b, 0x49, 0xda, 0x60, 0xac, 0x58, 0xb1, 0x02, 
-  0x45, 0x45, 0x45, 0x98, 0x35, 0x6b, 0x96, 0x11, 0x5b, 0x64, 0xa0, 0x77, 0xef, 0x5e, 0x31, 0xe9, 
-  0x92, 0x8c, 0xe2, 0xa2, 0x22, 0x2c, 0xfc, 0x74, 0x91, 0x29, 0xdb, 0xca, 0x22, 0xce, 0x78, 0x6b, 
-  0x11, 0x12, 0xc3, 0x4c, 0x6f, 0xb9, 0x56, 0xba, 0x0d, 0x00, 0xe4, 0x75, 0xcf, 0x33, 0xd5, 0xd4, 
-  0x50, 0x30, 0x84, 0x5f, 0xfe, 0xf2, 0x57, 0x7c, 0xe5, 0xca, 0x65, 0x5a, 0xb3, 0x66, 0x2d, 0x12, 
-  0x12, 0xbd, 0x00, 0x08, 0xdd, 0xbb, 0x77, 0x07, 0x18, 0xe8, 0xde, 0x3d, 0xcf, 0xd4, 0xd8, 0x8b, 
-  0x8b, 0x8a, 0x31, 0x79, 0xf2, 0x24, 0xf4, 0xec, 0xd9, 0x13, 0x4b, 0x96, 0x2c, 0x31, 0x4b, 0x4b, 
-  0x06, 0xdf, 0x38, 0xb8, 0xd5, 0x10, 0x1e, 0xb5, 0x12, 0x1b, 0xb6, 0xfe, 0xfb, 0xd5, 0xa6, 0xaf, 
-  0xf0, 0xd5, 0x3f, 0xbe, 0xc2, 0xac, 0x59, 0xb3, 0xcc, 0x75, 0x64, 0x66, 0x66, 0xe2, 0xb6, 0x91, 
-  0xb7, 0xa1, 0x57, 0xaf, 0x5e, 0xe6, 0xa7, 0x55, 0xd5, 0x55, 0x98, 0x32, 0x79, 0x0a, 0xa6, 0x4e, 
-  0x9d, 0x8a, 0xd9, 0xb3, 0x67, 0x47, 0x82, 0x2b, 0x18, 0x1b, 0xce, 0x47, 0x8a, 0xc8, 0xe0, 0xe6, 
-  0xe6, 0x66, 0xbc, 0xf9, 0xe6, 0x9b, 0xe6, 0x88, 0xb5, 0xb5, 0xb5, 0x66, 0x4a, 0x8a, 0x20, 0x50, 
-  0x69, 0x1c, 0x52, 0xd5, 0x90, 0x9a, 0x1b, 0x99, 0x70, 0x6e, 0x6e, 0x34, 0x92, 0x53, 0x71, 0xe9, 
-  0x12, 0x16, 0xbc, 0xfb, 0x2e, 0x00, 0x60, 0xfd, 0xfa, 0xf5, 0xc6, 0xe4, 0x08, 0x20, 0x12, 0x70, 
-  0xcb, 0x88, 0x11, 0x71, 0x49, 0x2a, 0x05, 0x05, 0xf9, 0x98, 0xf3, 0xea, 0x6b, 0xe8, 0xdb, 0xb7, 
-  0xaf, 0x99, 0x84, 0x9c, 0x9e, 0x96, 0x1e, 0x87, 0x91, 0x96, 0x16, 0x3f, 0xfe, 0xf6, 0xb7, 0xbf, 
-  0xc5, 0x07, 0xd7, 0x63, 0x74, 0xed, 0x5e, 0xbd, 0x7a, 0x99, 0x7e, 0x58, 0x72, 0xcc, 0x9f, 0x88, 
-  0x8e, 0x9d, 0x92, 0x12, 0x2d, 0x76, 0xaa, 0xad, 0xad, 0xc5, 0xca, 0x95, 0x2b, 0x89, 0xc1, 0x28, 
-  0x2e, 0x2e, 0x42, 0xbf, 0x7e, 0xfd, 0x01, 0x30, 0xda, 0xb5, 0x6b, 0x87, 0x50, 0x28, 0x18, 0x2d, 
-  0x63, 0x60, 0xc2, 0xe1, 0xc3, 0x3f, 0xe0, 0x42, 0x7e, 0x3e, 0x2e, 0x5c, 0xc8, 0x47, 0x7e, 0x7e, 
-  0x01, 0x06, 0x0f, 0x1e, 0x64, 0xe8, 0x18, 0xc9, 0x29, 0xff, 0x4f, 0xe6, 0xbe, 0xbf, 0xc5, 0x8f, 
-  0x45, 0x4b, 0x96, 0x20, 0x14, 0x0a, 0x19, 0x70, 0x8b, 0x94, 0x89, 0xf4, 0xef, 0x8b, 0xc4, 0xc4, 
-  0xc4, 0x68, 0xac, 0xb8, 0xa4, 0x14, 0x47, 0x8e, 0x1e, 0xc5, 0xf9, 0x1f, 0xcf, 0x1b, 0x48, 0x0d, 
-  0x13, 0x48, 0x87, 0x0e, 0x59, 0x36, 0x82, 0x51, 0x35, 0x15, 0xaf, 0xbd, 0xfe, 0x3a, 0xcc, 0xa0, 
-  0xbe, 0x85, 0x21, 0xc9, 0x92, 0xbc, 0x2a, 0x1e, 0xa9, 0x9a, 0xea, 0xb6, 0x84, 0xe0, 0xcc, 0x01, 
-  0x9b, 0x9b, 0x9a, 0xcc, 0xdf, 0xeb, 0x22, 0x31, 0xbd, 0xb0, 0x25, 0x92, 0x96, 0x9a, 0x16, 0x9f, 
-  0xc3, 0x1b, 0x1e, 0xa6, 0xcc, 0x12, 0x06, 0xf3, 0x7a, 0xbd, 0x60, 0xb6, 0xe7, 0x53, 0x30, 0x3b, 
-  0xc5, 0x3f, 0x38, 0x1a, 0x2c, 0x0e, 0x6f, 0xd5, 0x76, 0xed, 0xda, 0x61, 0xd6, 0xcc, 0x99, 0xd6, 
-  0x26, 0x1b, 0xd2, 0xd9, 0x42, 0xca, 0x0d, 0x0d, 0x0d, 0xe6, 0x1c, 0xd2, 0xd2, 0xd2, 0x30, 0xe2, 
-  0xd6, 0x11, 0xd8, 0xb3, 0x67, 0x0f, 0x8e, 0x1e, 0x3d, 0x0a, 0xbf, 0xdf, 0x0f, 0xe6, 0x68, 0x76, 
-  0xbb, 0xcb, 0xa5, 0x98, 0xfd, 0x84, 0x42, 0x41, 0x8e, 0xd8, 0x3b, 0xaa, 0x1a, 0xad, 0x85, 0xf1, 
-  0xba, 0x3d, 0x6d, 0x66, 0x18, 0xb1, 0x03, 0x4f, 0x74, 0x62, 0xc9, 0x67, 0xce, 0x9c, 0xb5, 0x05, 
-  0x6c, 0x52, 0x53, 0x53, 0xe1, 0xf1, 0x78, 0xe3, 0x44, 0x8f, 0xdf, 0x1f, 0xc0, 0xe6, 0xcd, 0x9b, 
-  0xcd, 0xd2, 0xce, 0x13, 0xc7, 0x4f, 0x44, 0x8a, 0xa2, 0x4d, 0x83, 0xcc, 0x7e, 0x42, 0x8d, 0x11, 
-  0xe1, 0x92, 0x44, 0xf1, 0xab, 0x61, 0xc3, 0x86, 0xad, 0x8c, 0x94, 0x70, 0x4a, 0xd1, 0x4c, 0x35, 
-  0x31, 0x4e, 0x6e, 0x3a, 0x4d, 0x97, 0xc1, 0x4c, 0x0e, 0xe5, 0xe6, 0xb1, 0xb4, 0x1a, 0x0c, 0x3a, 
-  0x14, 0x0a, 0xc5, 0x0a, 0xa8, 0xd8, 0xd0, 0x14, 0x93, 0xa3, 0x2d, 0x36, 0x6e, 0xfc, 0x78, 0x33, 
-  0x68, 0x66, 0x95, 0xcb, 0x14, 0x13, 0x85, 0x39, 0x7b, 0xf6, 0x2c, 0xdf, 0x71, 0xc7, 0x1d, 0x04, 
-  0x30, 0x64, 0x59, 0xc6, 0xdf, 0xff, 0xf6, 0x77, 0xdc, 0x32, 0xe2, 0x16, 0x3c, 0xfe, 0xcb, 0x5f, 
-  0xb6, 0xb9, 0xcf, 0xec, 0x82, 0x21, 0xfa, 0xbb, 0x79, 0x16, 0x43, 0x6b, 0x7b, 0x93, 0x63, 0xce, 
-  0x11, 0x70, 0x58, 0x2b, 0x01, 0x08, 0x86, 0xec, 0x27, 0xe3, 0x08, 0x24, 0x40, 0x92, 0xc4, 0xb8, 
-  0x3e, 0x35, 0x4d, 0xc3, 0x2f, 0xa6, 0x4d, 0xb3, 0xc1, 0x72, 0xc6, 0x8c, 0x19, 0x6d, 0x26, 0xae, 
-  0x85, 0x53, 0x63, 0x95, 0x6d, 0x96, 0x43, 0xb3, 0x04, 0x4b, 0x10, 0xbc, 0xb5, 0x9a, 0xd7, 0x98, 
-  0xe5, 0x52, 0x9b, 0x5c, 0x28, 0x42, 0xbd, 0x59, 0x99, 0x59, 0xf1, 0xc6, 0xb3, 0x25, 0x7c, 0xd4, 
-  0xbe, 0x7d, 0x3b, 0xac, 0x5d, 0xb3, 0x16, 0x6b, 0x56, 0xaf, 0xc6, 0xea, 0x55, 0xab, 0x90, 0xdd, 
-  0xa1, 0x83, 0xdd, 0x61, 0x40, 0xd1, 0x42, 0xe7, 0xfe, 0xfd, 0x07, 0x10, 0xc7, 0x26, 0xb0, 0x51, 
-  0x7c, 0xb6, 0xf5, 0xdf, 0xdf, 0x7a, 0x8b, 0x22, 0x01, 0x6e, 0x80, 0x70, 0xe3, 0x4d, 0x37, 0x62, 
-  0xf7, 0xf7, 0xbb, 0xd1, 0x39, 0xb7, 0xf3, 0x35, 0xd8, 0x27, 0xff, 0x0b, 0x89, 0x27, 0x4e, 0xc0, 
-  0xa1, 0x36, 0x77, 0xea, 0xe0, 0x41, 0x83, 0x6c, 0xb4, 0x6b, 0x66, 0x31, 0xd0, 0xf5, 0x30, 0xf2, 
-  0x68, 0x16, 0x85, 0xcb, 0xa5, 0x60, 0xc3, 0xfa, 0x2f, 0xb1, 0x76, 0xcd, 0x1a, 0xac, 0x5d, 0xb3, 
-  0x06, 0xf7, 0xce, 0x98, 0x01, 0x30, 0x10, 0x0c, 0x05, 0xef, 0x1c, 0x30, 0x60, 0x60, 0xba, 0x03, 
-  0x52, 0x41, 0x6d, 0xab, 0x22, 0x14, 0x1f, 0x30, 0x8d, 0xcd, 0xd4, 0x60, 0x63, 0xff, 0x68, 0x9a, 
-  0x86, 0x7e, 0xfd, 0xfb, 0x99, 0x9d, 0xd5, 0xd4, 0xd4, 0x40, 0x88, 0xc4, 0x45, 0xc3, 0x08, 0xce, 
-  0xcc, 0xcc, 0xc2, 0xe4, 0xc9, 0x93, 0x30, 0x79, 0xf2, 0x64, 0x4c, 0x99, 0x32, 0x25, 0x5c, 0xdd, 
-  0x4d, 0x36, 0x35, 0xaf, 0xa5, 0xa5, 0x05, 0x00, 0xd0, 0xb5, 0x6b, 0x17, 0x78, 0xdc, 0x2e, 0xa6, 
-  0xb8, 0x34, 0x15, 0x40, 0x10, 0x84, 0x2a, 0x30, 0x6b, 0x80, 0x71, 0x96, 0xc4, 0x7b, 0xef, 0xbf, 
-  0x1f, 0x4e, 0xa9, 0x34, 0x38, 0xc1, 0xd0, 0xa1, 0x43, 0xb1, 0x79, 0xf3, 0x26, 0x0c, 0x1b, 0x3a, 
-  0xb4, 0x8d, 0x95, 0x5d, 0xf3, 0x44, 0x33, 0xc7, 0x9a, 0x14, 0x5b, 0xfc, 0xd5, 0xe1, 0xfb, 0xf6, 
-  0xed, 0xdb, 0x63, 0xf6, 0xef, 0x7f, 0x8f, 0xa7, 0x9f, 0x7e, 0xda, 0x26, 0x76, 0x0e, 0x1d, 0x3a, 
-  0xe4, 0x58, 0x0d, 0xd7, 0x36, 0xd1, 0x01, 0x2e, 0x97, 0x1b, 0x93, 0x26, 0x4f, 0xc2, 0xa4, 0x49, 
-  0xc6, 0x7d, 0xe3, 0x8d, 0x37, 0x86, 0x79, 0x27, 0xe8, 0xca, 0xd5, 0x2b, 0x39, 0xf1, 0x41, 0x72, 
-  0x06, 0xb7, 0x4d, 0xad, 0xdc, 0x36, 0xaa, 0xc3, 0x20, 0x7f, 0xea, 0xa9, 0xa7, 0x50, 0x75, 0xf5, 
-  0x2a, 0x06, 0x0f, 0x1e, 0x6c, 0x3e, 0x2a, 0x2f, 0x2f, 0x77, 0xc8, 0x00, 0xb4, 0xab, 0x58, 0x9a, 
-  0xa6, 0xc7, 0xd0, 0x0d, 0xe1, 0xc2, 0x85, 0x0b, 0xc6, 0xb1, 0x73, 0xa2, 0x80, 0x5e, 0xbd, 0x7a, 
-  0xdb, 0xa7, 0x11, 0x26, 0x0e, 0x5d, 0xd3, 0x0a, 0x24, 0x51, 0xfc, 0x38, 0xf2, 0xe5, 0x9c, 0x39, 
-  0x73, 0x30, 0x6f, 0xde, 0x3c, 0x84, 0x42, 0xaa, 0x39, 0xbb, 0x1e, 0x3d, 0x7a, 0x60, 0xf9, 0xf2, 
-  0xe5, 0xb8, 0x79, 0xd8, 0xb0, 0x56, 0x12, 0x18, 0x18, 0xad, 0xe6, 0x3c, 0x52, 0xab, 0x1e, 0x3a, 
-  0x8b, 0x62, 0x1c, 0x9b, 0x93, 0x64, 0xec, 0x8f, 0xd1, 0xa3, 0x47, 0xe3, 0xe5, 0x97, 0x5f, 0x8e, 
-  0x9e, 0x1c, 0x43, 0x40, 0x59, 0x59, 0x29, 0x0e, 0x1e, 0x3a, 0x04, 0x5c, 0x6b, 0x0f, 0xc5, 0xee, 
-  0x98, 0x36, 0x0e, 0x18, 0x03, 0x00, 0xaf, 0xc7, 0x23, 0xc4, 0x29, 0x4a, 0xdc, 0x5a, 0x72, 0x14, 
-  0xda, 0x48, 0x6d, 0x81, 0xbd, 0xb6, 0xcd, 0xd0, 0x40, 0xed, 0x1a, 0x23, 0xeb, 0x46, 0x59, 0x7f, 
-  0xec, 0xc7, 0xf5, 0x75, 0xf5, 0x28, 0x28, 0x28, 0x60, 0x86, 0x61, 0x46, 0x55, 0x56, 0x5e, 0xb2, 
-  0x65, 0xe7, 0x81, 0x80, 0x2b, 0x57, 0xae, 0xa0, 0xae, 0xae, 0x0e, 0xa9, 0xa9, 0xa9, 0xc8, 0xc8, 
-  0xcc, 0x20, 0x5b, 0x3e, 0x5c, 0x24, 0x19, 0x8c, 0x99, 0x92, 0xbc, 0x9e, 0xf7, 0x1b, 0x1a, 0x9b, 
-  0x9e, 0x8c, 0xf8, 0x88, 0xff, 0xf0, 0x87, 0x3f, 0xa0, 0xba, 0xaa, 0x0a, 0xb3, 0x5f, 0x78, 0x01, 
-  0xc9, 0x49, 0xc9, 0x61, 0x17, 0x68, 0x2e, 0xe6, 0xcd, 0x9b, 0x87, 0x61, 0x37, 0xdf, 0xec, 0xb4, 
-  0x36, 0x23, 0x03, 0xcb, 0xc9, 0xc5, 0xdc, 0x46, 0x42, 0x37, 0x11, 0xdb, 0xb3, 0x21, 0xd0, 0x76, 
-  0xb5, 0xb9, 0xbf, 0xc5, 0x8f, 0x0f, 0x3e, 0xf8, 0x20, 0x9e, 0xc0, 0x5b, 0xa5, 0x22, 0xb6, 0xd9, 
-  0xa7, 0xc1, 0x50, 0x10, 0x27, 0x4f, 0x9e, 0x32, 0x35, 0xa5, 0xc8, 0xe9, 0x35, 0xcc, 0x3a, 0x24, 
-  0x51, 0x6a, 0x88, 0x47, 0x2a, 0xc7, 0xa6, 0x52, 0xd0, 0x75, 0x2b, 0xef, 0x14, 0xa7, 0x60, 0x1b, 
-  0xff, 0xf8, 0x03, 0x01, 0xac, 0x58, 0xb1, 0x1c, 0x7f, 0x8f, 0x96, 0xde, 0x85, 0xd3, 0x6e, 0x8c, 
-  0xc4, 0xa9, 0x11, 0xb7, 0xde, 0xea, 0x90, 0x4d, 0x64, 0xdf, 0xc5, 0xe7, 0xce, 0x9f, 0xc7, 0xf0, 
-  0xe1, 0xc3, 0xe3, 0x37, 0x4d, 0x78, 0x9a, 0xb2, 0x2c, 0xa7, 0x34, 0x36, 0x35, 0x2f, 0x36, 0x7c, 
-  0xad, 0xd1, 0x7e, 0xde, 0x7a, 0xfb, 0x6d, 0x94, 0x94, 0x96, 0x62, 0xfe, 0xbc, 0x79, 0x48, 0x4b, 
-  0x4b, 0x07, 0xc0, 0x18, 0x34, 0x68, 0x10, 0x9e, 0xfa, 0x8f, 0xff, 0xc0, 0xdc, 0xb9, 0x73, 0x2d, 
-  0x4b, 0xa4, 0x28, 0xa3, 0xe1, 0x78, 0x27, 0x80, 0xb9, 0xf7, 0x1c, 0x93, 0x2c, 0xad, 0xc9, 0xcd, 
-  0xf1, 0xf9, 0x45, 0x0d, 0xf5, 0xf5, 0x50, 0x14, 0xc5, 0x38, 0xa3, 0x01, 0xc0, 0xd6, 0xad, 0x5b, 
-  0xf1, 0xd6, 0xdc, 0xb9, 0xb0, 0x55, 0x63, 0x51, 0x2c, 0x6f, 0x8f, 0xa5, 0xaa, 0xa8, 0x3e, 0xe2, 
-  0xf7, 0x07, 0x30, 0x6c, 0xd8, 0x30, 0x92, 0xc3, 0xc7, 0x05, 0x46, 0x42, 0x7b, 0x92, 0x28, 0x15, 
-  0xe6, 0xf5, 0xc8, 0x2b, 0xbe, 0x90, 0x7f, 0xc1, 0x8e, 0x54, 0x38, 0xd6, 0x69, 0xd9, 0x79, 0x0d, 
-  0x47, 0x12, 0x19, 0x5b, 0x13, 0x41, 0xcc, 0xd8, 0xb9, 0x73, 0x27, 0x2a, 0x2a, 0x2a, 0x50, 0x71, 
-  0xa9, 0x82, 0xd7, 0xaf, 0x5b, 0x4f, 0x47, 0x8e, 0x1e, 0x0f, 0x26, 0x04, 0xa3, 0x00, 0x00, 0x08, 
-  0x28, 0x49, 0x44, 0x41, 0x54, 0x8d, 0x91, 0x94, 0x64, 0xa3, 0x6c, 0xe7, 0xf1, 0x8c, 0xa9, 0x08, 
-  0x24, 0xe0, 0xf0, 0x0f, 0x3f, 0x60, 0xf8, 0xcd, 0xc3, 0x4d, 0x2c, 0xc6, 0xda, 0xb1, 0xaa, 0xa6, 
-  0xf5, 0x8a, 0xfc, 0x3d, 0xee, 0xae, 0xbb, 0x4c, 0xfb, 0xef, 0xe8, 0xb1, 0x63, 0x58, 0xbb, 0x76, 
-  0x2d, 0xb2, 0x32, 0x33, 0xf1, 0xd6, 0x5b, 0x6f, 0x99, 0xc9, 0x60, 0x63, 0xc6, 0x8c, 0xc1, 0xdc, 
-  0xb9, 0x73, 0x63, 0x53, 0x90, 0x1c, 0x4b, 0x49, 0x29, 0xd6, 0xb7, 0x10, 0xc7, 0x7e, 0x2d, 0xb6, 
-  0xb3, 0x43, 0x24, 0x65, 0xdb, 0xb6, 0x6d, 0x48, 0x49, 0x49, 0x09, 0x7b, 0xdf, 0x8c, 0xf3, 0x96, 
-  0x22, 0xc6, 0x83, 0xa6, 0xeb, 0x51, 0x90, 0x13, 0x9b, 0x93, 0x78, 0x77, 0xfe, 0x7c, 0xb8, 0x5c, 
-  0x6e, 0x30, 0x18, 0x5f, 0x7c, 0xf1, 0x85, 0x8d, 0xd0, 0x84, 0xb8, 0x71, 0x8c, 0x27, 0x2e, 0xb7, 
-  0x6b, 0xc5, 0x96, 0x2d, 0x5b, 0xe2, 0x3d, 0x4a, 0x1e, 0xb7, 0x2b, 0x10, 0x6a, 0x0c, 0x85, 0x83, 
-  0xdc, 0xd1, 0x6a, 0x73, 0x49, 0x8a, 0x52, 0x85, 0x2c, 0xc9, 0xb6, 0x12, 0x8b, 0x40, 0x20, 0x60, 
-  0x52, 0x61, 0x24, 0x6f, 0x73, 0xdf, 0xbe, 0x7d, 0x78, 0xe5, 0x2f, 0x73, 0x2c, 0x67, 0x08, 0xc5, 
-  0x12, 0x5e, 0xdb, 0x87, 0x56, 0x50, 0xf4, 0xe0, 0x09, 0x90, 0x40, 0xf8, 0xfc, 0xf3, 0xa5, 0xf8, 
-  0xd5, 0x13, 0x4f, 0xc0, 0x4a, 0x9d, 0x88, 0x09, 0x70, 0x71, 0x98, 0xcd, 0x2f, 0x5a, 0xb4, 0x08, 
-  0x69, 0x69, 0x69, 0x00, 0x08, 0xab, 0x57, 0xaf, 0xc2, 0xc3, 0x8f, 0x3c, 0x8a, 0xf9, 0x0b, 0x16, 
-  0xe0, 0xc5, 0x17, 0x5f, 0x44, 0x5a, 0x5a, 0x1a, 0x98, 0x81, 0x8c, 0x8c, 0x0c, 0x06, 0x11, 0x05, 
-  0x02, 0x7e, 0x78, 0x3d, 0xde, 0x78, 0x83, 0xc6, 0xb2, 0xe3, 0x02, 0x81, 0x40, 0x1c, 0xfd, 0x59, 
-  0x0f, 0x83, 0x74, 0xe2, 0xca, 0xb1, 0xbb, 0x79, 0xcf, 0x9e, 0x3d, 0xb8, 0x33, 0x7c, 0x42, 0x59, 
-  0xd7, 0xae, 0x5d, 0x68, 0xea, 0xd4, 0xa9, 0xd8, 0xb0, 0x71, 0x23, 0x82, 0x81, 0x80, 0x25, 0x24, 
-  0x17, 0x2e, 0x41, 0x11, 0x25, 0x3c, 0xfc, 0xf0, 0x23, 0x50, 0x14, 0x63, 0xad, 0x45, 0x85, 0x85, 
-  0x96, 0x3c, 0x6a, 0x46, 0x2b, 0x27, 0x77, 0xa2, 0xc5, 0xd7, 0xf2, 0x4c, 0x46, 0x46, 0xc6, 0xb2, 
-  0xab, 0x57, 0xaf, 0x9e, 0x8b, 0xd1, 0x7e, 0x85, 0x8b, 0xa6, 0xdb, 0xaa, 0xaa, 0xca, 0x9c, 0x6e, 
-  0x87, 0x0e, 0x59, 0x48, 0x4f, 0x37, 0xb4, 0xe5, 0xbe, 0x7d, 0xfb, 0xda, 0xfa, 0x3b, 0x72, 0xe4, 
-  0x88, 0xc5, 0x2e, 0x63, 0xbb, 0x91, 0xc6, 0x56, 0x56, 0x4a, 0x70, 0x12, 0x4d, 0xba, 0xae, 0x83, 
-  0x99, 0xa1, 0x87, 0x6f, 0xb0, 0x15, 0x28, 0x1c, 0xde, 0x71, 0x47, 0x51, 0x56, 0x5a, 0xda, 0xaa, 
-  0xee, 0x16, 0xcd, 0xb8, 0x24, 0xb3, 0xf4, 0x1f, 0x88, 0x14, 0x5a, 0x31, 0xb2, 0xb2, 0xb2, 0xa0, 
-  0x28, 0x2e, 0xeb, 0xee, 0x22, 0x59, 0x96, 0x2d, 0x8e, 0x0a, 0x20, 0x27, 0x27, 0x87, 0x22, 0x66, 
-  0x73, 0xfb, 0x8c, 0x68, 0xbd, 0x51, 0x73, 0x73, 0x33, 0x40, 0x61, 0x13, 0x24, 0x3c, 0xff, 0x8c, 
-  0x8c, 0x0c, 0xe3, 0x80, 0x65, 0x00, 0x49, 0x61, 0x79, 0x0d, 0x86, 0x19, 0x56, 0x8b, 0xad, 0x2b, 
-  0x5a, 0xf0, 0xee, 0xbb, 0x68, 0xf1, 0xb7, 0x98, 0x24, 0x78, 0xff, 0xfd, 0xf7, 0x19, 0x9a, 0xbd, 
-  0xdf, 0x6f, 0x2e, 0x20, 0x29, 0x29, 0x09, 0x60, 0xc6, 0xad, 0xb7, 0x8e, 0x80, 0xac, 0x44, 0x89, 
-  0xd7, 0x3c, 0x4d, 0x8e, 0xec, 0x22, 0x52, 0x67, 0x3d, 0x0a, 0x33, 0x43, 0xaf, 0x48, 0x6c, 0x69, 
-  0x69, 0xf9, 0x43, 0xbc, 0xf6, 0x4b, 0x30, 0xcb, 0xbf, 0x4e, 0x9e, 0x38, 0x61, 0x4e, 0x2b, 0x31, 
-  0x31, 0x11, 0x3b, 0x77, 0xec, 0xc4, 0x97, 0xeb, 0xd7, 0xe1, 0xc1, 0x87, 0x1e, 0xb2, 0xb9, 0xe1, 
-  0x76, 0xec, 0xdc, 0x19, 0x87, 0x28, 0x8e, 0xda, 0xa4, 0xec, 0x71, 0xbb, 0xfe, 0xaf, 0x24, 0x0a, 
-  0xdf, 0x3b, 0x49, 0xe3, 0x5e, 0xbd, 0x7a, 0xa1, 0xa1, 0xbe, 0x1e, 0x75, 0xb5, 0xb5, 0xa8, 0xaf, 
-  0xad, 0xc5, 0x89, 0x63, 0xc7, 0x62, 0xdd, 0x35, 0xe6, 0x75, 0xe2, 0xe4, 0x49, 0x76, 0x64, 0xd7, 
-  0x31, 0x22, 0x29, 0x7a, 0x98, 0x16, 0x63, 0xf4, 0xe8, 0xd1, 0x58, 0xb2, 0x78, 0x31, 0x36, 0x6c, 
-  0xf8, 0xd2, 0x76, 0x98, 0x54, 0x24, 0xfb, 0xa3, 0xb2, 0xf2, 0xb2, 0xd9, 0xcd, 0x88, 0x11, 0x23, 
-  0xb0, 0x65, 0xcb, 0xd7, 0xd8, 0xbf, 0x6f, 0x1f, 0xba, 0x75, 0xed, 0x6a, 0xb6, 0x5f, 0xb8, 0x70, 
-  0x01, 0x04, 0x42, 0x59, 0x59, 0xa9, 0x59, 0x68, 0x9a, 0x95, 0x95, 0x85, 0xbd, 0x7b, 0x76, 0xe3, 
-  0x9f, 0xdb, 0xb6, 0xe1, 0x67, 0x3f, 0xeb, 0x69, 0xb2, 0xcf, 0x48, 0xbf, 0xd6, 0xfc, 0x63, 0x06, 
-  0xd0, 0xd8, 0xd4, 0x84, 0xc2, 0x82, 0x42, 0xb3, 0xcf, 0x9b, 0x6e, 0xba, 0x09, 0x60, 0xa0, 0xf2, 
-  0xd2, 0x25, 0x73, 0x8d, 0x3d, 0x7b, 0xf6, 0xc4, 0xd7, 0x9b, 0x37, 0x63, 0xee, 0xdc, 0xb9, 0xd1, 
-  0xb0, 0x3c, 0x1b, 0x5c, 0xcf, 0xba, 0xd6, 0xc4, 0xc4, 0x44, 0x34, 0x35, 0x37, 0xa3, 0xbe, 0xae, 
-  0x0e, 0xf5, 0x75, 0x75, 0x28, 0x2a, 0x28, 0x34, 0xbc, 0x51, 0x86, 0x4d, 0x7f, 0x7b, 0x1c, 0x52, 
-  0x33, 0xda, 0x67, 0xec, 0x26, 0xa2, 0x20, 0x40, 0x78, 0xf7, 0xbd, 0xf7, 0xe8, 0x6a, 0x55, 0x95, 
-  0x05, 0x01, 0x3f, 0xc3, 0xb8, 0x71, 0xe3, 0x91, 0x98, 0x90, 0x60, 0x3a, 0x10, 0xf6, 0xee, 0xdd, 
-  0x6b, 0xb2, 0xc4, 0xd6, 0x94, 0x66, 0xc5, 0xa5, 0x6c, 0x67, 0x46, 0xa9, 0x43, 0x02, 0x31, 0x44, 
-  0x51, 0x82, 0xdb, 0xed, 0x86, 0xc7, 0xe3, 0x81, 0xc7, 0xe3, 0x81, 0x37, 0xc1, 0x1b, 0xa7, 0x79, 
-  0x45, 0x9c, 0x0f, 0x3b, 0xb6, 0x6f, 0xbf, 0xae, 0xa3, 0x1b, 0x0f, 0x1d, 0x3a, 0x64, 0xfe, 0x99, 
-  0x94, 0x9c, 0x8c, 0x19, 0x33, 0xee, 0xc5, 0x8d, 0x83, 0x6f, 0x32, 0x3b, 0x0d, 0x06, 0x43, 0x66, 
-  0xed, 0xcf, 0x8e, 0xed, 0xdb, 0xcd, 0xef, 0x44, 0x51, 0xc4, 0xe8, 0xd1, 0xa3, 0x31, 0x78, 0xf0, 
-  0x8d, 0x51, 0xbf, 0xad, 0xdf, 0x8f, 0x85, 0x9f, 0x7e, 0x0a, 0x00, 0x58, 0xbe, 0x62, 0x05, 0x05, 
-  0x82, 0xd1, 0xa2, 0xe2, 0x21, 0x43, 0x86, 0x60, 0xd4, 0xa8, 0xdb, 0xcd, 0xf9, 0x05, 0x03, 0x41, 
-  0xac, 0x88, 0xd4, 0x14, 0x19, 0x3c, 0xdc, 0x94, 0x93, 0x04, 0xe0, 0x84, 0x65, 0x93, 0xe4, 0x76, 
-  0xea, 0x84, 0x19, 0xd3, 0xa7, 0x63, 0xf3, 0xe6, 0xaf, 0x4d, 0x47, 0x8d, 0x20, 0x08, 0xb8, 0xe3, 
-  0x8e, 0x3b, 0xd0, 0xb7, 0x6f, 0x3f, 0x33, 0x9c, 0x53, 0x5a, 0x5a, 0x6a, 0x9c, 0x23, 0xcc, 0x66, 
-  0x6d, 0x25, 0x88, 0x08, 0x1e, 0xb7, 0x1b, 0x1e, 0xb7, 0x07, 0x1e, 0xb7, 0xdb, 0x3c, 0xb3, 0x82, 
-  0x00, 0xf8, 0x03, 0x81, 0xf6, 0x71, 0x48, 0x3d, 0x7b, 0xf6, 0x6c, 0x8d, 0xdb, 0xe5, 0xda, 0x08, 
-  0x30, 0x7c, 0x3e, 0x1f, 0xde, 0x5d, 0xb0, 0x80, 0x83, 0xd6, 0x13, 0x31, 0x2d, 0x50, 0x2c, 0x2e, 
-  0x2e, 0xc6, 0x8b, 0x2f, 0xbe, 0xe8, 0x08, 0x58, 0xb3, 0x1e, 0x86, 0x01, 0x5d, 0x0b, 0x27, 0xb0, 
-  0x86, 0x0f, 0x4a, 0xe5, 0xd6, 0xb6, 0x62, 0x6c, 0xf6, 0x89, 0xa5, 0xd4, 0x9e, 0x00, 0x7c, 0xf8, 
-  0xd1, 0x47, 0xa8, 0xad, 0xad, 0x75, 0x3c, 0x28, 0x4f, 0x14, 0x84, 0x1a, 0x02, 0x54, 0x00, 0x78, 
-  0xea, 0x37, 0xbf, 0xa1, 0xf3, 0xe7, 0xcf, 0xdb, 0xc3, 0x3c, 0xe1, 0x5b, 0xd7, 0x35, 0x2c, 0x5f, 
-  0xbe, 0xdc, 0x3c, 0xe2, 0xee, 0x0f, 0x7f, 0xfc, 0x23, 0xbe, 0xff, 0xfe, 0x7b, 0xc7, 0x10, 0x8c, 
-  0xa6, 0x69, 0x58, 0xbc, 0x64, 0x09, 0xef, 0xd9, 0xb3, 0x07, 0x00, 0x61, 0xff, 0xfe, 0xfd, 0xf8, 
-  0xf2, 0xcb, 0x0d, 0x56, 0x2e, 0x14, 0xdd, 0x93, 0xba, 0x8e, 0x35, 0x6b, 0xd7, 0x62, 0xc7, 0xb7, 
-  0xdf, 0x46, 0xe6, 0x6b, 0xa8, 0xe1, 0x16, 0x67, 0xea, 0xfa, 0x2f, 0xd7, 0x93, 0xd5, 0xdd, 0x7a, 
-  0xcf, 0xbf, 0xff, 0x3b, 0x3e, 0x5d, 0xf4, 0x29, 0xb6, 0x6f, 0xdf, 0xe1, 0xa8, 0x5e, 0x04, 0x82, 
-  0x01, 0x7c, 0xf0, 0xc1, 0x07, 0x4c, 0x14, 0x2f, 0xbe, 0x62, 0xed, 0x54, 0x32, 0xa3, 0x34, 0x82, 
-  0x1e, 0xa7, 0x28, 0x85, 0xe5, 0xd0, 0x9c, 0x40, 0x20, 0x38, 0x55, 0x07, 0xcb, 0x6f, 0xbc, 0xf9, 
-  0x26, 0x15, 0x14, 0x16, 0x62, 0xd6, 0xcc, 0x99, 0xe8, 0xd2, 0xb5, 0x2b, 0x14, 0x59, 0x41, 0x4d, 
-  0x6d, 0x0d, 0x9f, 0x3c, 0x79, 0x92, 0x66, 0xcf, 0x7e, 0xc1, 0x90, 0xbb, 0x44, 0xf8, 0x76, 0xe7, 
-  0x4e, 0xcc, 0x4b, 0x4f, 0x47, 0xe4, 0x14, 0x16, 0x23, 0x65, 0xc4, 0x90, 0xb1, 0xb2, 0x2c, 0x57, 
-  0x01, 0x08, 0x46, 0x26, 0xf4, 0xd1, 0x87, 0x1f, 0xc6, 0x7b, 0x8e, 0xc2, 0xca, 0x42, 0xa4, 0x9e, 
-  0xe4, 0x93, 0x4f, 0x3e, 0x8e, 0x9c, 0x17, 0x88, 0x23, 0x47, 0x8e, 0x98, 0xc8, 0x7d, 0xf9, 0xe5, 
-  0x97, 0xd1, 0xad, 0x5b, 0x77, 0x00, 0x8c, 0xf2, 0x8b, 0x17, 0x4d, 0xa5, 0x41, 0x92, 0xc4, 0x3d, 
-  0x60, 0xf1, 0x42, 0x30, 0x14, 0x7a, 0xae, 0xa9, 0xb9, 0x19, 0xb7, 0xdc, 0x32, 0x82, 0xde, 0x7e, 
-  0xfb, 0x2d, 0x1e, 0x3a, 0x74, 0x28, 0xa5, 0xa4, 0xa6, 0xb2, 0xa6, 0x69, 0x54, 0x56, 0x56, 0xc6, 
-  0x1b, 0x37, 0x6c, 0xc0, 0xbc, 0xf9, 0xf3, 0x6d, 0x87, 0x90, 0xdd, 0x39, 0x76, 0x2c, 0xbd, 0x3a, 
-  0x67, 0x0e, 0x46, 0xdd, 0x7e, 0x3b, 0x77, 0xc8, 0xea, 0x00, 0x5d, 0xd7, 0xa8, 0xa4, 0xb4, 0x94, 
-  0x57, 0xad, 0x5c, 0x45, 0x0b, 0x3f, 0x5d, 0x48, 0xd1, 0x72, 0x0f, 0xc2, 0x23, 0x8f, 0x3c, 0x82, 
-  0x53, 0xa7, 0x4e, 0x61, 0xd2, 0xc4, 0x49, 0xc8, 0xee, 0x98, 0xcd, 0x00, 0x70, 0xb1, 0xfc, 0x22, 
-  0x6d, 0xda, 0xf4, 0x15, 0xfe, 0xfe, 0xd6, 0x5b, 0xe1, 0x53, 0xb7, 0x19, 0xf3, 0x17, 0xcc, 0x87, 
-  0xdb, 0xe5, 0x36, 0x88, 0xe1, 0xc0, 0x7e, 0x00, 0x84, 0x0d, 0x1b, 0x36, 0x62, 0xce, 0x9c, 0x39, 
-  0xc6, 0x91, 0x79, 0x0c, 0x14, 0x16, 0x16, 0x80, 0x88, 0x30, 0x69, 0xd2, 0x44, 0x7a, 0x75, 0xce, 
-  0x6b, 0xb8, 0xe3, 0x8e, 0x3b, 0x90, 0x91, 0x99, 0xc1, 0xa1, 0x50, 0x08, 0x25, 0xc5, 0xc5, 0xb4, 
-  0x70, 0xe1, 0xa7, 0x58, 0xb3, 0x76, 0x0d, 0x01, 0x84, 0x75, 0x5f, 0x7c, 0x81, 0xea, 0x30, 0xac, 
-  0xed, 0x65, 0x2b, 0x8c, 0x86, 0xfa, 0x06, 0x13, 0xa9, 0x8a, 0xa2, 0x1c, 0x0d, 0x84, 0xcf, 0x87, 
-  0x88, 0xc3, 0x7f, 0x6a, 0x6a, 0xea, 0xec, 0x66, 0x9f, 0xef, 0x75, 0x5b, 0xb6, 0x9c, 0xb5, 0x36, 
-  0x26, 0xb6, 0xe2, 0x37, 0xd6, 0x49, 0x1f, 0x66, 0x9d, 0x92, 0x28, 0x9c, 0x6d, 0xf1, 0xb5, 0xf4, 
-  0x4d, 0x4f, 0x4f, 0xbb, 0xbf, 0xa9, 0xd9, 0xb7, 0x94, 0x63, 0x8b, 0x5c, 0x62, 0x73, 0xd0, 0x6c, 
-  0x6d, 0x96, 0xba, 0x92, 0x36, 0x8e, 0xe0, 0x27, 0x23, 0x9b, 0xee, 0x89, 0xac, 0xcc, 0x8c, 0xcf, 
-  0x2f, 0x56, 0x5c, 0xda, 0xae, 0xe9, 0xfa, 0x08, 0xb6, 0xce, 0x93, 0xe2, 0xd5, 0x64, 0x22, 0xb0, 
-  0xa2, 0xc8, 0x47, 0x82, 0xc1, 0xd0, 0x8d, 0xd1, 0xc4, 0x33, 0x7b, 0xbe, 0x54, 0x34, 0xa9, 0x91, 
-  0x59, 0x91, 0xe5, 0xfc, 0x60, 0x48, 0xed, 0x19, 0x9f, 0xcb, 0x16, 0x73, 0x7e, 0x3e, 0x39, 0x69, 
-  0x71, 0xd4, 0x7a, 0x0d, 0x91, 0xc5, 0xc9, 0x62, 0x4f, 0x70, 0x8b, 0xf9, 0xff, 0x0b, 0xec, 0x47, 
-  0xae, 0xb5, 0xa2, 0x57, 0x30, 0x27, 0x25, 0x26, 0xdd, 0x5f, 0x5d, 0x5d, 0xbd, 0xd2, 0xae, 0x28, 
-  0xc1, 0x54, 0x36, 0xde, 0x4c, 0x4a, 0x4c, 0x78, 0x52, 0x14, 0x84, 0x46, 0x22, 0x8e, 0x2f, 0x01, 
-  0x24, 0x80, 0x88, 0x59, 0x96, 0xa4, 0x0a, 0x02, 0x74, 0xb2, 0x54, 0x28, 0x1a, 0x59, 0x9c, 0x04, 
-  0x81, 0xd0, 0xe0, 0xf5, 0x78, 0x1f, 0x03, 0x80, 0xf6, 0xed, 0xda, 0xaf, 0x12, 0x05, 0x61, 0x6b, 
-  0xec, 0x89, 0xd6, 0x11, 0xc5, 0xd8, 0x56, 0x70, 0x68, 0xb6, 0x51, 0x4c, 0x8c, 0x8e, 0xa3, 0x72, 
-  0x9b, 0xa2, 0xb9, 0x0a, 0x2e, 0x45, 0xf9, 0x47, 0x4a, 0x6a, 0xca, 0xa7, 0xf9, 0x05, 0x85, 0xfe, 
-  0xdc, 0x4e, 0x1d, 0xc7, 0x2b, 0xb2, 0xbc, 0x96, 0x00, 0x8e, 0x3d, 0xc3, 0x21, 0x32, 0x8e, 0x28, 
-  0x50, 0x7d, 0x62, 0x82, 0x77, 0x66, 0x62, 0x42, 0xc2, 0xad, 0x1e, 0xb7, 0xfb, 0x03, 0x10, 0x74, 
-  0x8a, 0x1c, 0x7d, 0x60, 0x3b, 0x8d, 0x9c, 0x21, 0x00, 0xc1, 0x04, 0x6f, 0xc2, 0x4b, 0xbd, 0x7b, 
-  0xf7, 0xe9, 0xef, 0xf5, 0x7a, 0x3e, 0x32, 0xfa, 0xb5, 0xfa, 0x2c, 0xc2, 0xa7, 0x68, 0x33, 0x43, 
-  0x14, 0x28, 0x28, 0x0a, 0x42, 0x20, 0x3e, 0xf0, 0x11, 0x9e, 0x7b, 0xb8, 0xb6, 0xce, 0x76, 0x48, 
-  0x76, 0x38, 0xd5, 0xc2, 0x8c, 0x71, 0x90, 0x15, 0xbe, 0x04, 0x49, 0x12, 0x7c, 0xb2, 0x24, 0x56, 
-  0xdb, 0x77, 0x8f, 0xed, 0xec, 0x30, 0xa3, 0xd8, 0x1a, 0x60, 0x97, 0xe2, 0x7a, 0x27, 0x82, 0xd0, 
-  0x36, 0x43, 0x2e, 0x1d, 0xb3, 0xb3, 0x33, 0x9b, 0x7d, 0xbe, 0x99, 0xaa, 0xa6, 0xdd, 0xae, 0xaa, 
-  0x6a, 0x26, 0x11, 0x44, 0x51, 0x10, 0xfd, 0x92, 0x2c, 0xe5, 0x0b, 0xa0, 0xcd, 0x99, 0xd9, 0xd9, 
-  0xeb, 0xaa, 0xab, 0xaa, 0x6e, 0x56, 0x55, 0xf5, 0xc1, 0x40, 0xc0, 0xdf, 0x31, 0x1c, 0x87, 0x55, 
-  0x75, 0x4d, 0x3f, 0x95, 0x94, 0x98, 0xf8, 0xd1, 0xc5, 0x8a, 0x0a, 0xd3, 0x0e, 0x19, 0x75, 0xfb, 
-  0x28, 0xf1, 0xf4, 0xe9, 0x33, 0x0f, 0x31, 0xf3, 0xd8, 0x50, 0x28, 0x98, 0x44, 0x46, 0x6a, 0x2c, 
-  0x5b, 0x37, 0x90, 0x40, 0x28, 0x23, 0xa2, 0xcb, 0x82, 0x28, 0x0e, 0xd0, 0x34, 0xcd, 0x45, 0x24, 
-  0xb0, 0x40, 0x54, 0xa3, 0x6b, 0xda, 0x2e, 0x08, 0x74, 0x45, 0xd7, 0xf9, 0x17, 0x44, 0x94, 0x15, 
-  0x0a, 0x05, 0x21, 0x49, 0xf2, 0x55, 0x02, 0x36, 0x0d, 0xb9, 0xf9, 0xc6, 0x75, 0xdf, 0x6c, 0xb5, 
-  0xcb, 0xa5, 0xac, 0xac, 0xac, 0x11, 0x81, 0x60, 0xe0, 0xfe, 0x80, 0x3f, 0x30, 0x10, 0x84, 0x24, 
-  0x5d, 0x67, 0x76, 0xb9, 0x5c, 0x97, 0x25, 0x49, 0xdc, 0xa1, 0xc8, 0xca, 0xa2, 0xca, 0xca, 0x4a, 
-  0x53, 0x03, 0xcc, 0xce, 0xce, 0x1e, 0xe0, 0xf3, 0xf9, 0x1e, 0x54, 0x55, 0x75, 0x58, 0x48, 0x0d, 
-  0xa5, 0x00, 0x60, 0x45, 0x51, 0xae, 0x0a, 0x44, 0x7b, 0xdb, 0xb7, 0xcf, 0x58, 0x52, 0x58, 0x58, 
-  0x58, 0x62, 0x79, 0x77, 0x88, 0xaf, 0xa5, 0xe5, 0xc1, 0x50, 0x28, 0x38, 0x48, 0x0d, 0xa9, 0x49, 
-  0x20, 0x82, 0xcb, 0xa5, 0x54, 0x0b, 0x44, 0xfb, 0x93, 0x92, 0x92, 0x97, 0xb4, 0xb4, 0xb4, 0xb8, 
-  0x42, 0x6a, 0xe8, 0x31, 0x59, 0x96, 0xbb, 0x6b, 0x9a, 0x16, 0x29, 0x74, 0x2d, 0x74, 0xb9, 0x5c, 
-  0xdb, 0x5b, 0xfc, 0xfe, 0x3c, 0x59, 0x96, 0x86, 0x69, 0x9a, 0x96, 0x10, 0x76, 0x4a, 0x56, 0xb1, 
-  0xce, 0xdf, 0x24, 0x25, 0x25, 0x16, 0x35, 0x34, 0x36, 0xde, 0x1f, 0x0c, 0x06, 0x07, 0x81, 0x91, 
-  0xc4, 0x60, 0x96, 0x44, 0xa9, 0x5e, 0x14, 0x85, 0xdd, 0x19, 0xed, 0x32, 0x3e, 0x6e, 0x09, 0xb4, 
-  0x04, 0x1b, 0x1a, 0x1a, 0x1e, 0x13, 0x25, 0x69, 0xa0, 0xa6, 0x69, 0x1e, 0x12, 0x04, 0xb3, 0x94, 
-  0x5d, 0xd7, 0x99, 0x44, 0x41, 0x28, 0x94, 0x24, 0x69, 0x75, 0x75, 0x75, 0xf5, 0x5e, 0xfc, 0x74, 
-  0xfd, 0x74, 0xfd, 0x74, 0xfd, 0x0f, 0xbb, 0xfe, 0x1b, 0x72, 0x77, 0x1a, 0x62, 0xfe, 0xb5, 0x04, 
-  0xec, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-
-
-// array size is 1231
-static const byte wifi[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 
-  0xf4, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64, 
-  0x88, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 
-  0xec, 0x01, 0x79, 0x28, 0x71, 0xbd, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f, 
-  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x77, 0x77, 0x77, 0x2e, 0x69, 0x6e, 0x6b, 0x73, 0x63, 
-  0x61, 0x70, 0x65, 0x2e, 0x6f, 0x72, 0x67, 0x9b, 0xee, 0x3c, 0x1a, 0x00, 0x00, 0x04, 0x4c, 0x49, 
-  0x44, 0x41, 0x54, 0x58, 0x85, 0xed, 0x96, 0x5b, 0x6c, 0x94, 0x55, 0x14, 0x85, 0xbf, 0x7d, 0xfe, 
-  0xb9, 0x31, 0xa5, 0xb5, 0x33, 0x2d, 0x90, 0x80, 0x9a, 0x46, 0x03, 0x62, 0x30, 0xf8, 0x20, 0x46, 
-  0x14, 0x49, 0x6d, 0x42, 0x40, 0xc0, 0x4b, 0x34, 0x52, 0x1f, 0x0a, 0x14, 0xd4, 0x80, 0x89, 0x44, 
-  0x42, 0x42, 0x4c, 0x4c, 0x34, 0x16, 0x34, 0xbe, 0x9a, 0x18, 0xa3, 0x56, 0x30, 0xb5, 0x60, 0xbd, 
-  0xa0, 0x51, 0x2e, 0x5e, 0xe8, 0x94, 0x4b, 0x88, 0x2f, 0x02, 0x6f, 0xbc, 0x34, 0x40, 0x20, 0x51, 
-  0x23, 0x37, 0x6b, 0xa7, 0xf4, 0x36, 0x97, 0xce, 0x39, 0xdb, 0x87, 0xd2, 0x61, 0x6e, 0x74, 0x0a, 
-  0x44, 0x5f, 0x64, 0xbd, 0xcd, 0xfa, 0xd7, 0x5e, 0x7b, 0x9d, 0xfd, 0xef, 0xf3, 0x67, 0xe0, 0x16, 
-  0xfe, 0xef, 0x90, 0x89, 0x88, 0x74, 0x17, 0x1e, 0x55, 0x35, 0x0f, 0x38, 0xe3, 0x1a, 0x40, 0xee, 
-  0x47, 0xf4, 0x1e, 0x54, 0x6a, 0x80, 0x2a, 0x73, 0x2a, 0x5e, 0x8d, 0x88, 0xc5, 0x93, 0x34, 0x3e, 
-  0x73, 0x09, 0x9f, 0x74, 0xe3, 0x33, 0x5f, 0x13, 0x48, 0x7e, 0x29, 0x8d, 0xa4, 0x6f, 0x2a, 0x80, 
-  0x76, 0x46, 0xee, 0x73, 0x22, 0x2f, 0x01, 0x4d, 0x40, 0x6d, 0x29, 0x8d, 0xe9, 0xee, 0x2d, 0x5d, 
-  0xec, 0x89, 0xd3, 0xb0, 0xef, 0x84, 0xf8, 0x65, 0x8b, 0xac, 0x4a, 0xef, 0xbe, 0xae, 0x00, 0x7a, 
-  0x20, 0x32, 0x57, 0x2d, 0x5b, 0x55, 0xe4, 0xa9, 0x72, 0x21, 0xaf, 0x19, 0x20, 0x17, 0x61, 0xdf, 
-  0x79, 0xc2, 0x66, 0x83, 0x34, 0xa5, 0xbf, 0x1b, 0x37, 0x80, 0xee, 0x9b, 0x1e, 0x76, 0x81, 0xe4, 
-  0x16, 0x84, 0x4d, 0x80, 0x57, 0xc2, 0xea, 0x34, 0xc2, 0x2f, 0x40, 0xb7, 0xc2, 0xef, 0x2a, 0xf4, 
-  0x9b, 0x73, 0xc3, 0xf3, 0x40, 0x6b, 0x8c, 0xd3, 0x99, 0x58, 0x9d, 0x45, 0xda, 0xd6, 0x91, 0x76, 
-  0xfe, 0xa2, 0x4a, 0x01, 0x2a, 0x02, 0xc7, 0xa8, 0x0c, 0x2d, 0x95, 0xc6, 0xfe, 0xde, 0x5c, 0x7a, 
-  0xb4, 0x79, 0x6c, 0xca, 0x4c, 0x87, 0xfd, 0x1e, 0x98, 0x53, 0x50, 0xfa, 0x27, 0xca, 0x76, 0xe3, 
-  0xd9, 0x1d, 0xb2, 0xe8, 0xf2, 0xd9, 0xf2, 0xc7, 0x05, 0xed, 0x08, 0x35, 0x68, 0xd2, 0xb6, 0x48, 
-  0xca, 0x2e, 0x60, 0xc4, 0xe5, 0x1f, 0x24, 0xe8, 0x25, 0x09, 0x85, 0x9e, 0x90, 0x35, 0x43, 0x07, 
-  0xb3, 0x01, 0x74, 0x7f, 0x64, 0xa1, 0x33, 0xb2, 0x17, 0xa8, 0xce, 0x91, 0xf6, 0xa0, 0xfa, 0x96, 
-  0xb1, 0xf1, 0x4f, 0x65, 0x19, 0xa9, 0x89, 0x34, 0x2e, 0x0a, 0xf2, 0x39, 0x55, 0x64, 0x42, 0xdb, 
-  0x74, 0x30, 0xb5, 0x42, 0xac, 0x5e, 0x9d, 0xb6, 0x27, 0x4a, 0x75, 0x60, 0x83, 0xac, 0x4c, 0x7d, 
-  0x28, 0x1a, 0xab, 0xae, 0x77, 0x98, 0x1f, 0x81, 0x8a, 0x9c, 0xda, 0x5d, 0xc6, 0x3f, 0xf2, 0x8a, 
-  0x34, 0x0c, 0xf4, 0xe4, 0x19, 0x76, 0x46, 0xef, 0xb0, 0x86, 0x45, 0x82, 0xcc, 0x13, 0xa7, 0x77, 
-  0x39, 0x21, 0xe2, 0x9d, 0xbd, 0x3c, 0x07, 0x23, 0x09, 0x3c, 0xb9, 0xe0, 0xfc, 0xe6, 0x98, 0x31, 
-  0x5e, 0xab, 0xac, 0x1c, 0x3e, 0x9e, 0x57, 0xf7, 0x45, 0x60, 0x36, 0x43, 0xae, 0x8b, 0xe1, 0xcc, 
-  0xed, 0x59, 0xce, 0x08, 0x12, 0x0d, 0x6c, 0x14, 0x1b, 0x8b, 0xfe, 0x06, 0xdc, 0x79, 0x85, 0x77, 
-  0x28, 0x9b, 0xbd, 0x25, 0xbd, 0xef, 0x65, 0x85, 0x8a, 0xd8, 0x58, 0xcd, 0xd3, 0x88, 0xdb, 0x28, 
-  0x48, 0x3d, 0x05, 0x7b, 0x53, 0x72, 0x09, 0x43, 0x5e, 0xdc, 0x4d, 0xf2, 0x7f, 0x6c, 0x56, 0x25, 
-  0xdf, 0x10, 0xc1, 0x65, 0xbd, 0xda, 0x02, 0x7b, 0xe9, 0x4f, 0x3f, 0x99, 0xd5, 0xf9, 0x4c, 0x46, 
-  0x6c, 0x2c, 0x7a, 0x12, 0x98, 0x05, 0x58, 0x45, 0xd6, 0xfa, 0x16, 0xff, 0xbd, 0x33, 0x5b, 0x70, 
-  0x20, 0x32, 0xd7, 0x3a, 0xd9, 0x2e, 0xf0, 0xe0, 0xb5, 0xc6, 0x3c, 0xee, 0x2d, 0x08, 0x7a, 0x83, 
-  0x54, 0x7a, 0xcd, 0xb9, 0xdb, 0xaf, 0x3b, 0x82, 0xad, 0xc4, 0x53, 0xeb, 0x00, 0x08, 0x98, 0xb4, 
-  0x5c, 0x59, 0xbe, 0x55, 0x06, 0x77, 0x50, 0x16, 0xf7, 0x1d, 0x19, 0x13, 0xda, 0x58, 0x64, 0x3d, 
-  0xc8, 0xfb, 0x40, 0xa0, 0xc0, 0x36, 0x21, 0x70, 0x48, 0xe1, 0x0c, 0xe8, 0x39, 0x73, 0x6e, 0xa8, 
-  0x5e, 0xad, 0x4e, 0xc7, 0xea, 0x74, 0x49, 0xda, 0x29, 0xa8, 0xe6, 0xab, 0x05, 0xdc, 0x6d, 0x81, 
-  0x9d, 0x5e, 0x73, 0x7a, 0x75, 0x36, 0x44, 0x47, 0xf0, 0x55, 0x4d, 0xbb, 0xe7, 0xc4, 0x17, 0x78, 
-  0xbb, 0xe4, 0x1d, 0xb7, 0xb1, 0xe8, 0x56, 0xe0, 0xcd, 0x3c, 0x52, 0x39, 0xa1, 0xf0, 0xae, 0x87, 
-  0xff, 0x07, 0x59, 0x72, 0x71, 0xa8, 0x54, 0x9d, 0xee, 0xa9, 0x98, 0x46, 0x5f, 0xe6, 0x75, 0x86, 
-  0x33, 0xeb, 0x49, 0xdb, 0x50, 0xde, 0xb3, 0x4a, 0xff, 0x11, 0xf3, 0xc2, 0xc8, 0x63, 0x85, 0x35, 
-  0x45, 0x01, 0x32, 0x5d, 0x35, 0xab, 0x45, 0xb5, 0x3d, 0x87, 0x1a, 0x44, 0xf4, 0x35, 0x13, 0x8f, 
-  0x7f, 0x22, 0x8d, 0xd8, 0x52, 0x8d, 0x8b, 0x82, 0xb4, 0x11, 0x42, 0x42, 0xed, 0x3a, 0x90, 0x6a, 
-  0x14, 0x77, 0x75, 0x22, 0xae, 0x3a, 0xd8, 0xea, 0x35, 0xa7, 0x5e, 0xce, 0xd5, 0xfa, 0x4a, 0x24, 
-  0x7a, 0x28, 0xe7, 0x67, 0x8f, 0x71, 0xb2, 0x5c, 0x1e, 0xef, 0x3d, 0x96, 0x35, 0x6f, 0xc1, 0x64, 
-  0xe6, 0xd7, 0xd6, 0x1b, 0xe3, 0x1e, 0x05, 0x66, 0x98, 0x3f, 0x06, 0x16, 0xaa, 0x98, 0x0b, 0xea, 
-  0x33, 0xfb, 0xcc, 0xd9, 0xc4, 0x07, 0xd2, 0x42, 0x46, 0xd6, 0x92, 0x84, 0xe4, 0xf3, 0xda, 0x1e, 
-  0xea, 0x64, 0x20, 0xb5, 0x0d, 0xab, 0x06, 0xc0, 0x64, 0xdc, 0x23, 0x65, 0x27, 0xa0, 0x9d, 0x35, 
-  0xb3, 0x9d, 0x71, 0x1d, 0xaa, 0x92, 0xf0, 0xac, 0x79, 0x51, 0x96, 0xf6, 0x9c, 0x84, 0x2b, 0xb7, 
-  0xa1, 0xab, 0xa6, 0x59, 0xd0, 0x77, 0x80, 0x19, 0x63, 0xfa, 0xbc, 0x25, 0xf4, 0x1b, 0xeb, 0xc2, 
-  0xfe, 0x36, 0xd3, 0x9c, 0x5a, 0x3f, 0xb6, 0xfd, 0xba, 0x23, 0xbc, 0x8c, 0x44, 0xea, 0x2b, 0x14, 
-  0x43, 0x38, 0xd8, 0x28, 0xab, 0x87, 0x7f, 0x1a, 0x37, 0x40, 0x29, 0xe8, 0xe1, 0xba, 0x90, 0x8e, 
-  0xf4, 0x7f, 0xab, 0xb0, 0xbc, 0xf0, 0x59, 0xc9, 0x5b, 0x10, 0xf6, 0x5d, 0xa4, 0x76, 0xf2, 0x6c, 
-  0x79, 0xa6, 0xaf, 0xaf, 0x9c, 0xb7, 0x29, 0xdb, 0xbc, 0x05, 0xa3, 0x23, 0xfd, 0xbb, 0x0b, 0x9b, 
-  0x2b, 0x1c, 0x07, 0xda, 0xb5, 0xc2, 0x7f, 0x86, 0xa0, 0x97, 0xbf, 0x94, 0xc3, 0x99, 0x69, 0xfc, 
-  0x35, 0x78, 0x5a, 0x5b, 0x8a, 0x5f, 0x71, 0x21, 0xca, 0x0a, 0x78, 0x38, 0x3a, 0x5f, 0x61, 0x49, 
-  0x4e, 0xe3, 0xa3, 0x9e, 0xd1, 0x75, 0xb2, 0x28, 0x7e, 0x22, 0x2f, 0x50, 0x47, 0x60, 0x85, 0x0e, 
-  0xd8, 0x36, 0x49, 0xd9, 0xd1, 0x2f, 0x6a, 0x22, 0x53, 0xcb, 0xdd, 0xa1, 0x35, 0x90, 0xdc, 0x3e, 
-  0x9e, 0x7d, 0xd9, 0x09, 0xe0, 0x8d, 0x9c, 0x04, 0x2e, 0x01, 0x08, 0xc4, 0xbc, 0xc9, 0xe1, 0x86, 
-  0xc2, 0xe6, 0x00, 0xd2, 0x94, 0xfe, 0x46, 0xaa, 0xc2, 0x75, 0x4c, 0xf2, 0x8d, 0x7e, 0xbe, 0x3d, 
-  0x71, 0x58, 0x3d, 0x5c, 0xce, 0x7e, 0x62, 0x3b, 0xb0, 0xbf, 0x2a, 0x8a, 0xf1, 0xee, 0xc5, 0x1f, 
-  0x3f, 0x2a, 0x0d, 0x64, 0x00, 0xf4, 0x70, 0x65, 0xad, 0x4b, 0xfb, 0x9f, 0x35, 0xe7, 0x07, 0x17, 
-  0xe2, 0x97, 0xad, 0xd2, 0x94, 0x3a, 0x0d, 0xa0, 0xbb, 0x08, 0x90, 0x08, 0xae, 0xc5, 0xc7, 0xa1, 
-  0x31, 0xee, 0xa6, 0x03, 0x14, 0x05, 0xfa, 0xb9, 0xba, 0xce, 0x79, 0xe6, 0x28, 0x30, 0xd5, 0x74, 
-  0xf7, 0x8e, 0x9e, 0xb6, 0x3a, 0xb4, 0x40, 0x56, 0x26, 0x7e, 0xbd, 0x5e, 0xaf, 0xf2, 0xaf, 0xa0, 
-  0x04, 0x9c, 0x27, 0x9b, 0x81, 0xa9, 0x59, 0xc2, 0xaa, 0x21, 0x95, 0x69, 0xbd, 0x11, 0xaf, 0x1b, 
-  0x0a, 0x20, 0xc8, 0xd4, 0x22, 0xd2, 0x11, 0xf9, 0xcf, 0x02, 0x38, 0xd5, 0x3d, 0x45, 0x5c, 0xc0, 
-  0x14, 0x71, 0xff, 0x2a, 0x6c, 0x67, 0x74, 0x93, 0x8d, 0x45, 0x4f, 0xe9, 0x47, 0x26, 0xe5, 0x3e, 
-  0x0b, 0x16, 0xfd, 0xd9, 0xbc, 0x85, 0x5b, 0x98, 0x28, 0xfe, 0x01, 0xbc, 0xe4, 0xbd, 0x7d, 0x80, 
-  0xdc, 0x39, 0x25, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-
-
-// array size is 1118
-static const byte wifi_slash[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 
-  0xf4, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x13, 0xaf, 0x00, 0x00, 0x13, 
-  0xaf, 0x01, 0x63, 0xe6, 0x8e, 0xc3, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f, 
-  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x77, 0x77, 0x77, 0x2e, 0x69, 0x6e, 0x6b, 0x73, 0x63, 
-  0x61, 0x70, 0x65, 0x2e, 0x6f, 0x72, 0x67, 0x9b, 0xee, 0x3c, 0x1a, 0x00, 0x00, 0x03, 0xeb, 0x49, 
-  0x44, 0x41, 0x54, 0x58, 0x85, 0xed, 0x97, 0x5d, 0x68, 0x1c, 0x55, 0x14, 0xc7, 0x7f, 0x67, 0x76, 
-  0x13, 0xe2, 0xcc, 0x26, 0x7d, 0x08, 0xa8, 0xc1, 0x3e, 0x08, 0x7e, 0x80, 0xd1, 0x24, 0x7d, 0xb0, 
-  0x6d, 0xac, 0xb5, 0x82, 0x14, 0x8a, 0x15, 0x24, 0x0f, 0xf6, 0xc9, 0x2a, 0xd8, 0x24, 0x86, 0xfa, 
-  0xd1, 0x9a, 0x74, 0x67, 0x2d, 0x8a, 0xb0, 0xf1, 0xa1, 0x96, 0x9d, 0xcd, 0x26, 0x29, 0x26, 0x25, 
-  0xd9, 0xb6, 0x42, 0xd4, 0x27, 0xa9, 0xda, 0xa0, 0x60, 0xc5, 0x16, 0x94, 0x58, 0x4b, 0xa0, 0x09, 
-  0x94, 0x14, 0xa9, 0xe2, 0x4b, 0x04, 0x0b, 0x85, 0x88, 0xd4, 0x74, 0x2d, 0xe9, 0xee, 0x1e, 0x1f, 
-  0x76, 0x76, 0x32, 0x9b, 0xdd, 0x7c, 0x2d, 0x21, 0xf5, 0xc1, 0xff, 0xcb, 0x70, 0xcf, 0xbd, 0xdc, 
-  0xf3, 0xbb, 0xe7, 0xfe, 0xcf, 0x30, 0x03, 0xff, 0xcb, 0x27, 0xb5, 0xac, 0x4d, 0x6a, 0x59, 0x9b, 
-  0xee, 0x64, 0xf2, 0x8c, 0x5a, 0x56, 0x46, 0x4d, 0xb3, 0x75, 0xbd, 0xf2, 0x1a, 0x7e, 0x06, 0x2f, 
-  0x26, 0x32, 0xbc, 0x5e, 0x10, 0xe2, 0x1f, 0xa8, 0x69, 0xee, 0x43, 0x24, 0xe9, 0x82, 0x29, 0x22, 
-  0xaf, 0xcb, 0xec, 0xec, 0x71, 0x6f, 0xbe, 0xaf, 0xef, 0x1e, 0xe6, 0xe6, 0x76, 0x20, 0x52, 0x8f, 
-  0xea, 0xbd, 0x40, 0x35, 0x22, 0x82, 0xea, 0x2c, 0x22, 0x7f, 0x00, 0x57, 0x51, 0xbd, 0x24, 0x91, 
-  0xc8, 0xaf, 0x65, 0x01, 0x94, 0x84, 0xa8, 0xad, 0x7d, 0x57, 0xa6, 0xa7, 0x3f, 0x00, 0xd0, 0xa3, 
-  0x47, 0x37, 0x10, 0x08, 0x9c, 0x05, 0xb6, 0x2e, 0xb3, 0xef, 0xef, 0xc0, 0x17, 0x88, 0x8c, 0x48, 
-  0x38, 0x7c, 0x69, 0x55, 0x00, 0x3e, 0x88, 0x13, 0x80, 0x20, 0x02, 0x8d, 0x8d, 0x9f, 0xca, 0x85, 
-  0x0b, 0x7b, 0x57, 0x09, 0x91, 0xd7, 0xf7, 0xc0, 0xfb, 0x62, 0xdb, 0xe7, 0x57, 0x04, 0xa0, 0xbd, 
-  0xbd, 0x75, 0xa4, 0xd3, 0xc7, 0x98, 0x9c, 0x7c, 0x81, 0xd1, 0x51, 0x50, 0x05, 0x11, 0xa8, 0xaf, 
-  0x3f, 0x29, 0xe3, 0xe3, 0x6d, 0x00, 0x9a, 0x48, 0xdc, 0x45, 0x3a, 0xbd, 0x81, 0x54, 0xea, 0x2f, 
-  0xea, 0xea, 0x32, 0xcc, 0xcc, 0xd4, 0x50, 0x59, 0x79, 0x3f, 0x50, 0x4f, 0x36, 0xbb, 0x03, 0x91, 
-  0x67, 0x81, 0xfb, 0x0a, 0x33, 0xc9, 0x67, 0x04, 0x02, 0x07, 0xa5, 0xb3, 0xf3, 0xda, 0xa2, 0x00, 
-  0x1a, 0x8f, 0xef, 0x42, 0x75, 0x04, 0xb8, 0x1b, 0x80, 0xc9, 0x49, 0x18, 0x1d, 0x55, 0x54, 0x85, 
-  0x12, 0x9e, 0x58, 0x4c, 0x1a, 0x8d, 0x1a, 0x98, 0xe6, 0x4e, 0x44, 0xba, 0x80, 0x5d, 0xbe, 0xa9, 
-  0xeb, 0xa8, 0xbe, 0x24, 0x91, 0xc8, 0xb7, 0x45, 0x00, 0xea, 0x38, 0xed, 0xc0, 0x71, 0x20, 0xe0, 
-  0x86, 0xa6, 0x50, 0x7d, 0x83, 0x68, 0xf4, 0x81, 0x25, 0x8d, 0x99, 0x48, 0x3c, 0x48, 0x3a, 0x1d, 
-  0x22, 0x18, 0x9c, 0x96, 0xae, 0xae, 0x3f, 0x8b, 0x60, 0x62, 0xb1, 0xa7, 0x80, 0x01, 0x44, 0x1a, 
-  0xdc, 0x50, 0x06, 0xd8, 0x2f, 0xb6, 0x9d, 0xf4, 0x00, 0x34, 0x1e, 0x6f, 0x41, 0xf5, 0x73, 0x0f, 
-  0x48, 0xb5, 0x97, 0x54, 0xea, 0x1d, 0x89, 0x46, 0x6f, 0x41, 0x91, 0x31, 0xa1, 0xa9, 0x69, 0x31, 
-  0x4f, 0x4c, 0xa3, 0x7a, 0x1a, 0x38, 0x2d, 0x91, 0xc8, 0x8f, 0xbe, 0x8a, 0x54, 0x62, 0x9a, 0x31, 
-  0x44, 0x0e, 0xf8, 0x0e, 0xdd, 0x22, 0xb6, 0x7d, 0x46, 0xdc, 0xd3, 0x1f, 0x00, 0xfa, 0x81, 0x0c, 
-  0x22, 0xaf, 0x49, 0x38, 0x3c, 0xec, 0x3b, 0xc1, 0xd3, 0x18, 0x46, 0x8c, 0x89, 0x89, 0x2d, 0x05, 
-  0x9e, 0x58, 0x68, 0x4c, 0xc3, 0xf8, 0x06, 0x91, 0xe6, 0xf9, 0xa3, 0xeb, 0x45, 0x0c, 0xc3, 0x96, 
-  0x70, 0x78, 0xcc, 0x57, 0xe5, 0x56, 0x60, 0xc8, 0xad, 0xf2, 0x9b, 0x62, 0xdb, 0x1f, 0xe6, 0x00, 
-  0x86, 0x86, 0x2a, 0xb8, 0x71, 0x63, 0x2f, 0x86, 0xf1, 0xb3, 0x1c, 0x3a, 0x74, 0xd1, 0xa5, 0xae, 
-  0xc2, 0x34, 0xfb, 0x11, 0x69, 0xf7, 0xa8, 0x73, 0x9e, 0xc8, 0x41, 0x80, 0x52, 0x55, 0xf5, 0x96, 
-  0xcc, 0xcc, 0x1c, 0xf3, 0x55, 0xe2, 0x2b, 0x60, 0xbb, 0xff, 0x06, 0x10, 0x19, 0xa4, 0xba, 0xba, 
-  0x53, 0x3a, 0x3a, 0x6e, 0x03, 0x68, 0x4f, 0x4f, 0x33, 0xd9, 0xec, 0x23, 0xd4, 0xd4, 0x7c, 0x22, 
-  0x1d, 0x1d, 0xb7, 0x4b, 0xb7, 0xe1, 0x91, 0x23, 0xb5, 0x54, 0x54, 0x9c, 0x01, 0x9e, 0xf4, 0x85, 
-  0xbf, 0x46, 0x24, 0x46, 0x77, 0xf7, 0x43, 0x64, 0xb3, 0xc3, 0x2c, 0xe6, 0x09, 0xc7, 0x79, 0x02, 
-  0x78, 0x1b, 0x78, 0xde, 0x57, 0xee, 0xf3, 0x04, 0x02, 0x7b, 0x4a, 0x79, 0x24, 0x58, 0x0a, 0x80, 
-  0x60, 0xb0, 0xdf, 0x97, 0xfc, 0x1a, 0x22, 0xaf, 0x48, 0x38, 0x7c, 0xd6, 0x1d, 0xff, 0xa0, 0xa6, 
-  0xa9, 0x9e, 0x27, 0x54, 0x07, 0x34, 0x14, 0x22, 0x0f, 0x21, 0xb6, 0xfd, 0x13, 0xd0, 0xa2, 0x8e, 
-  0xb3, 0x13, 0xf8, 0x08, 0xd8, 0x08, 0x3c, 0x43, 0x26, 0xd3, 0x07, 0xbc, 0xbc, 0x30, 0x95, 0xb1, 
-  0x30, 0x00, 0xe0, 0xbe, 0x56, 0x01, 0x26, 0x31, 0x8c, 0xad, 0xf9, 0xe4, 0xaa, 0x2a, 0xea, 0x38, 
-  0xcf, 0xd1, 0xdd, 0xbd, 0x9d, 0xdd, 0xbb, 0xaf, 0x23, 0x02, 0x20, 0xa8, 0x0e, 0x6a, 0x73, 0xf3, 
-  0xc7, 0x05, 0x5b, 0xd8, 0xf6, 0x77, 0x04, 0x83, 0x5b, 0x80, 0x09, 0x77, 0xcf, 0x82, 0xfe, 0xf7, 
-  0xd6, 0x95, 0x0a, 0xaa, 0xaa, 0x10, 0x8f, 0x3f, 0xca, 0xcd, 0x9b, 0xbf, 0x48, 0x34, 0x3a, 0x07, 
-  0xa0, 0xf1, 0xf8, 0x66, 0x54, 0x07, 0x81, 0xc7, 0xbd, 0x85, 0x7e, 0x4f, 0x2c, 0x30, 0xa6, 0xb7, 
-  0x57, 0x34, 0x5a, 0x89, 0x65, 0x3d, 0x4c, 0x38, 0x7c, 0x45, 0x44, 0x94, 0x05, 0x2a, 0x09, 0x50, 
-  0x04, 0x14, 0x8b, 0xed, 0x41, 0x64, 0x04, 0xa8, 0xf2, 0x85, 0x7f, 0x03, 0xae, 0x32, 0x36, 0xb6, 
-  0x91, 0x73, 0xe7, 0x1a, 0x97, 0x82, 0x58, 0x4a, 0xa5, 0x3d, 0x50, 0x84, 0x29, 0x49, 0x2f, 0xb9, 
-  0xea, 0x97, 0x88, 0xbc, 0x27, 0xb6, 0x3d, 0xe5, 0x01, 0xe6, 0xdf, 0x13, 0xaa, 0x06, 0x97, 0x2f, 
-  0xbf, 0xa8, 0xdb, 0xb6, 0xb1, 0x1a, 0x88, 0x65, 0xa5, 0x8e, 0x73, 0x4a, 0x1d, 0xe7, 0x6f, 0x8d, 
-  0xc7, 0x0f, 0x2e, 0xba, 0xc6, 0x34, 0xf7, 0xb9, 0x1f, 0x34, 0xaa, 0xa1, 0x90, 0x6a, 0x43, 0x43, 
-  0xcf, 0x4a, 0xf6, 0x5e, 0xd1, 0x15, 0x94, 0x4c, 0x98, 0x48, 0x34, 0x90, 0xc9, 0xb4, 0xb9, 0xc3, 
-  0xa4, 0xd8, 0xf6, 0xd4, 0x72, 0xdf, 0x13, 0x6b, 0x06, 0xe0, 0x26, 0x1f, 0x67, 0xde, 0x13, 0xb7, 
-  0x80, 0xcd, 0xe5, 0x40, 0x94, 0x6e, 0xc3, 0xe5, 0x94, 0xcd, 0xb6, 0x53, 0x68, 0xc8, 0x2a, 0x54, 
-  0xdb, 0x00, 0x24, 0x95, 0x3a, 0x85, 0x6a, 0x3b, 0x90, 0x25, 0xd7, 0xa2, 0x03, 0x1a, 0x0a, 0xed, 
-  0x5f, 0x5b, 0x00, 0xd5, 0xa2, 0x76, 0xc2, 0xd7, 0x62, 0xab, 0x81, 0x28, 0x0f, 0x00, 0x92, 0xe4, 
-  0xca, 0x9e, 0xd7, 0x3f, 0x64, 0x32, 0x27, 0x0a, 0x78, 0x56, 0x08, 0x51, 0xbe, 0x09, 0x1d, 0xe7, 
-  0xb1, 0x7c, 0xd9, 0xc9, 0x66, 0x93, 0x72, 0xf8, 0xf0, 0x95, 0x92, 0xeb, 0xca, 0x30, 0xe6, 0x9a, 
-  0x4b, 0x4d, 0xb3, 0xd5, 0x6b, 0xd1, 0xdc, 0xb3, 0x29, 0x3f, 0x57, 0xee, 0x15, 0xac, 0x4a, 0x92, 
-  0x4a, 0x9d, 0x44, 0xf5, 0x55, 0x72, 0xd7, 0x01, 0xf3, 0xff, 0x20, 0xeb, 0x2b, 0xb5, 0xac, 0x26, 
-  0xb5, 0xac, 0xc6, 0x3b, 0x92, 0xfc, 0x3f, 0xab, 0x7f, 0x01, 0x3f, 0x4c, 0xd2, 0x6a, 0x35, 0xd9, 
-  0x48, 0x25, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-
-
-// array size is 1942
-static const byte pool_connected[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 
-  0xf4, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x19, 
-  0x96, 0x52, 0x61, 0x00, 0x00, 0x07, 0x4b, 0x49, 0x44, 0x41, 0x54, 0x58, 0xc3, 0xc5, 0x97, 0x7b, 
-  0x54, 0x94, 0x65, 0x1e, 0xc7, 0xbf, 0xef, 0x65, 0xee, 0x37, 0x46, 0xe6, 0x0a, 0x0c, 0x0d, 0x97, 
-  0xb2, 0x14, 0xd6, 0x55, 0x41, 0xed, 0xa8, 0x28, 0x5a, 0xd8, 0x02, 0xd9, 0x69, 0x2d, 0x59, 0xf1, 
-  0x6c, 0x14, 0x9d, 0xb3, 0x45, 0x50, 0xd8, 0xee, 0xfe, 0xa1, 0xe5, 0x92, 0x4a, 0xbb, 0x96, 0xa7, 
-  0xdd, 0x32, 0x4b, 0xb7, 0xd8, 0xf0, 0x02, 0x6a, 0xa1, 0x80, 0xbb, 0x58, 0x4a, 0xe6, 0xa2, 0xe5, 
-  0xde, 0x54, 0x46, 0x33, 0xd7, 0x3d, 0xa2, 0x80, 0x0c, 0x97, 0x86, 0xe1, 0x36, 0x33, 0xef, 0xbc, 
-  0x33, 0xc3, 0x30, 0xef, 0xbc, 0xfb, 0x07, 0x82, 0xc3, 0x08, 0x09, 0x5b, 0xc7, 0xfd, 0xfd, 0xf9, 
-  0xbc, 0xcf, 0xf3, 0xfb, 0x7e, 0xde, 0xdf, 0xf3, 0xfb, 0x3d, 0xcf, 0xef, 0x01, 0xee, 0xbe, 0xd1, 
-  0x7a, 0xbd, 0x7e, 0x3d, 0xfe, 0x5f, 0x36, 0x73, 0xe6, 0xcc, 0x3f, 0x95, 0x96, 0x96, 0xfa, 0x6a, 
-  0x6b, 0x6b, 0x8b, 0x00, 0x80, 0xbe, 0x9b, 0xe2, 0xd9, 0xd9, 0xd9, 0x1b, 0xf2, 0xf3, 0xf3, 0xd7, 
-  0x12, 0x04, 0x21, 0x6a, 0x6c, 0x6c, 0xdc, 0xa6, 0xd3, 0xe9, 0xc4, 0x77, 0x0b, 0x80, 0x36, 0x99, 
-  0x4c, 0x35, 0xb9, 0xb9, 0xb9, 0x0f, 0x13, 0x04, 0x21, 0xb6, 0x58, 0x2c, 0xbe, 0xf2, 0xf2, 0xf2, 
-  0x93, 0x76, 0xbb, 0xfd, 0x0f, 0x3f, 0x24, 0x00, 0x09, 0x60, 0x3a, 0x00, 0x16, 0x40, 0x3b, 0x00, 
-  0x5e, 0x24, 0x42, 0x62, 0x9c, 0x51, 0x50, 0xc7, 0xb0, 0xa4, 0x72, 0xf5, 0xea, 0xd5, 0x5a, 0x89, 
-  0x44, 0x22, 0xb0, 0x58, 0x2c, 0xde, 0xb2, 0xb2, 0xb2, 0x13, 0x36, 0x9b, 0xed, 0x71, 0x00, 0xc1, 
-  0x1f, 0x02, 0x80, 0x48, 0x54, 0x48, 0xb6, 0x46, 0x4b, 0x85, 0x4f, 0x2e, 0xd2, 0x2b, 0x15, 0x2e, 
-  0x7f, 0x30, 0x70, 0xba, 0xdb, 0xe9, 0xe9, 0xf6, 0x0d, 0xbe, 0x1f, 0x63, 0x26, 0x0b, 0xab, 0xb7, 
-  0xe9, 0x13, 0x7c, 0x7e, 0x1e, 0x79, 0x5b, 0x76, 0xf7, 0xfa, 0xfd, 0x7e, 0x45, 0x75, 0x75, 0xf5, 
-  0xc9, 0x11, 0x71, 0x00, 0x20, 0xbe, 0xaf, 0x78, 0x82, 0x52, 0xf2, 0xc9, 0xe6, 0xb9, 0x09, 0x59, 
-  0xb9, 0x6b, 0xd6, 0x4a, 0x21, 0x96, 0x02, 0x24, 0x09, 0x7f, 0x57, 0x3b, 0x8a, 0xf7, 0x55, 0x0c, 
-  0xc4, 0x2c, 0xf6, 0x09, 0x5e, 0xcc, 0x51, 0xc9, 0x01, 0xc0, 0xd6, 0xc7, 0xe1, 0xe1, 0x42, 0xbb, 
-  0xb5, 0xdd, 0x36, 0x18, 0x37, 0x22, 0x3e, 0x12, 0xb6, 0x09, 0x2d, 0x4a, 0x4b, 0x23, 0x5a, 0x3b, 
-  0x61, 0x90, 0x08, 0xb3, 0x5c, 0x7c, 0x70, 0xeb, 0xdc, 0x84, 0xcc, 0xdc, 0x5f, 0x14, 0x49, 0xf9, 
-  0xff, 0x58, 0x10, 0x3c, 0x71, 0x18, 0xc1, 0xfa, 0x2a, 0x08, 0x7c, 0x6e, 0xec, 0x5a, 0xf7, 0xb2, 
-  0xda, 0x71, 0x4e, 0x12, 0xd8, 0x5d, 0xe7, 0x66, 0x00, 0x80, 0xa6, 0x00, 0x95, 0x9c, 0xef, 0x0f, 
-  0x15, 0xbf, 0x63, 0x04, 0x4c, 0x06, 0x1a, 0x04, 0x00, 0xab, 0x2d, 0x10, 0x3a, 0x3c, 0x07, 0x80, 
-  0x33, 0x4e, 0x2e, 0xfe, 0xed, 0x9b, 0xf3, 0xef, 0xcb, 0x5e, 0x35, 0x6f, 0xb6, 0x8c, 0x1f, 0xe8, 
-  0x01, 0x58, 0x66, 0x2c, 0x5d, 0xfc, 0x03, 0x20, 0x4c, 0x89, 0xf8, 0xf5, 0xae, 0xed, 0x0e, 0xd5, 
-  0x1c, 0x2f, 0x55, 0x7b, 0x9a, 0xed, 0xbe, 0xd8, 0x34, 0xb8, 0x1c, 0x80, 0x35, 0x74, 0x1e, 0xf5, 
-  0x5d, 0x00, 0x2e, 0x77, 0x10, 0x4e, 0xf7, 0x2d, 0x60, 0xb3, 0x51, 0x50, 0xfc, 0x68, 0x9a, 0xf4, 
-  0x03, 0x85, 0x88, 0x7a, 0x26, 0x55, 0xa5, 0x49, 0x7d, 0xe9, 0x47, 0x09, 0x22, 0x9a, 0x0b, 0x00, 
-  0x8c, 0x73, 0x74, 0xce, 0x89, 0x6e, 0x17, 0x1c, 0xfe, 0x00, 0x8c, 0x3e, 0x27, 0x40, 0x51, 0x58, 
-  0xb1, 0x3c, 0x53, 0xfc, 0xf1, 0xa1, 0x73, 0xec, 0xd9, 0x56, 0x76, 0xab, 0x87, 0x0b, 0x7e, 0x11, 
-  0xae, 0x41, 0x4d, 0x61, 0xbf, 0x53, 0x97, 0xcc, 0x95, 0xec, 0xf8, 0x70, 0xa3, 0xd6, 0xb0, 0x3a, 
-  0x43, 0x26, 0xaf, 0x38, 0xee, 0x72, 0xbb, 0xbc, 0xbc, 0x30, 0x49, 0x08, 0x42, 0x40, 0x0c, 0x07, 
-  0x72, 0x6f, 0x27, 0x03, 0x4b, 0x72, 0x3a, 0xea, 0x1d, 0x43, 0x88, 0xf7, 0xf6, 0xc3, 0xe0, 0x73, 
-  0x02, 0xc1, 0x00, 0x1e, 0x8a, 0x10, 0x4a, 0xaa, 0x5a, 0xba, 0xef, 0xed, 0xf6, 0xfa, 0x77, 0x8c, 
-  0x57, 0x3a, 0x77, 0x34, 0xb3, 0x5e, 0xb0, 0x2e, 0x7b, 0xb1, 0xf4, 0x88, 0x7d, 0x80, 0xa3, 0xed, 
-  0x03, 0x1c, 0x04, 0x34, 0x81, 0xbd, 0xdb, 0x23, 0x94, 0xf5, 0xbd, 0x5d, 0xcc, 0xee, 0x8e, 0x7e, 
-  0xde, 0x13, 0xe4, 0x01, 0x00, 0x0c, 0xc7, 0x23, 0xc6, 0x6c, 0x86, 0xce, 0x60, 0x80, 0x3b, 0x30, 
-  0x1c, 0x39, 0xbe, 0xbd, 0x05, 0xc2, 0xa1, 0x21, 0xcc, 0xd7, 0xc8, 0x65, 0x00, 0xf4, 0x53, 0x06, 
-  0x10, 0x08, 0x90, 0xba, 0x24, 0x55, 0xfc, 0x4a, 0x65, 0xa9, 0x2e, 0xaa, 0xbc, 0x44, 0xab, 0xcb, 
-  0xdf, 0xdc, 0xd3, 0x7b, 0x0b, 0x42, 0xa5, 0xac, 0xef, 0xeb, 0x1c, 0x85, 0x78, 0x2e, 0x46, 0x01, 
-  0xbe, 0xb6, 0x1c, 0x0f, 0xb6, 0x9c, 0xc7, 0x22, 0xad, 0x62, 0x8c, 0x1f, 0x19, 0x4d, 0x51, 0x00, 
-  0xa4, 0x53, 0x06, 0x18, 0x1a, 0x02, 0xd3, 0x6a, 0x43, 0x90, 0x0b, 0x02, 0x46, 0x0d, 0x85, 0xb2, 
-  0x8d, 0x5a, 0xcd, 0x18, 0x88, 0x77, 0x22, 0x46, 0x21, 0x86, 0x00, 0x14, 0x98, 0x54, 0x78, 0xc2, 
-  0xa8, 0xb8, 0xcd, 0xcf, 0xf9, 0x5e, 0x37, 0x03, 0xe0, 0xc6, 0x54, 0x01, 0x08, 0x55, 0x94, 0x79, 
-  0xb3, 0xdd, 0xbc, 0x46, 0x93, 0x55, 0xaa, 0x70, 0x85, 0x42, 0x3c, 0xbb, 0x65, 0x7c, 0x88, 0x91, 
-  0xed, 0x08, 0xb5, 0xf2, 0xeb, 0x36, 0xa6, 0xcb, 0x33, 0xb8, 0x07, 0x00, 0x3f, 0x95, 0x24, 0x24, 
-  0x54, 0x51, 0xb1, 0x07, 0x97, 0xbc, 0xf0, 0x5a, 0xd6, 0x9c, 0x9f, 0x3e, 0x2b, 0xb6, 0xf3, 0x11, 
-  0xc2, 0xca, 0x8a, 0xaf, 0x99, 0x35, 0x69, 0x7e, 0x91, 0x52, 0x46, 0x22, 0x3d, 0x45, 0x22, 0xdd, 
-  0xf7, 0x29, 0x73, 0x6d, 0xe1, 0x2c, 0x71, 0x24, 0x45, 0x12, 0x58, 0x99, 0x21, 0x16, 0xbd, 0x55, 
-  0xdb, 0xcb, 0x30, 0x01, 0x5a, 0x98, 0xa4, 0x90, 0x8c, 0x26, 0xe6, 0x81, 0xd6, 0x1e, 0xf6, 0x8d, 
-  0xcb, 0x1d, 0x35, 0xd7, 0x19, 0xef, 0x2f, 0xc7, 0x13, 0xa1, 0xbe, 0x5b, 0x7c, 0x53, 0x56, 0x62, 
-  0x5a, 0x96, 0x9c, 0x22, 0x49, 0xe8, 0x62, 0x13, 0x89, 0x70, 0x88, 0x85, 0xb3, 0xc4, 0x91, 0x47, 
-  0x1a, 0xd8, 0x4b, 0x71, 0x31, 0x02, 0xbd, 0x50, 0x40, 0x60, 0x65, 0x86, 0x68, 0x0c, 0xc4, 0xa1, 
-  0x1b, 0xbd, 0xec, 0x96, 0x4b, 0x6d, 0x35, 0xd7, 0x5c, 0xde, 0xbc, 0x09, 0xff, 0x72, 0xbc, 0xc1, 
-  0x88, 0xe8, 0xb8, 0xb7, 0x16, 0xe4, 0xbd, 0x5c, 0x30, 0xe3, 0x91, 0x9c, 0x31, 0x49, 0x33, 0x14, 
-  0x08, 0xe0, 0xc2, 0xa9, 0xa3, 0x7c, 0xe0, 0xab, 0xf7, 0x98, 0x4f, 0x7f, 0xc3, 0x28, 0x29, 0x12, 
-  0xf0, 0x0d, 0xf2, 0x78, 0x72, 0x7d, 0x77, 0xef, 0x47, 0x25, 0x5a, 0x8d, 0x4e, 0x4d, 0x61, 0x28, 
-  0xc0, 0x23, 0xaf, 0xd8, 0xc1, 0x68, 0x38, 0x99, 0xf4, 0x9f, 0x5d, 0x03, 0x07, 0x9a, 0x5c, 0xde, 
-  0xa7, 0xee, 0x74, 0x83, 0xdd, 0x16, 0x15, 0x99, 0xc6, 0xf0, 0x44, 0xb8, 0x38, 0x00, 0x08, 0x68, 
-  0x1a, 0xb3, 0x97, 0x66, 0x13, 0xf4, 0xe2, 0x22, 0xc5, 0x48, 0x4e, 0x88, 0x45, 0x04, 0xca, 0x5e, 
-  0x0d, 0xcb, 0x89, 0xed, 0x11, 0x8a, 0x6b, 0xf4, 0x40, 0x4f, 0x93, 0xcb, 0x5b, 0x32, 0x99, 0x2b, 
-  0x34, 0xdc, 0x66, 0x98, 0xe6, 0x2e, 0x92, 0x85, 0x0f, 0x36, 0x7f, 0x71, 0x18, 0x57, 0x8f, 0xee, 
-  0x03, 0x45, 0xe0, 0x36, 0x08, 0x83, 0x86, 0xba, 0x0d, 0x22, 0x5a, 0x4f, 0x62, 0xbc, 0xb2, 0x9b, 
-  0x0c, 0x00, 0x1b, 0xf0, 0x78, 0xb8, 0xd0, 0x01, 0xeb, 0xbf, 0xfe, 0x8a, 0x04, 0xaf, 0x15, 0x4b, 
-  0xf5, 0x14, 0x9a, 0x3f, 0xaf, 0x1a, 0x37, 0x12, 0x23, 0x10, 0x4f, 0x95, 0xf4, 0xd8, 0x7f, 0xb6, 
-  0xc1, 0xde, 0x79, 0xf6, 0xb2, 0xaf, 0x04, 0xc0, 0x95, 0xff, 0x05, 0xa0, 0xcd, 0xda, 0xf8, 0xa5, 
-  0x47, 0x40, 0xf0, 0xd0, 0x48, 0x04, 0x00, 0x00, 0xa1, 0x5c, 0x89, 0xf6, 0xce, 0x4e, 0xb4, 0xb4, 
-  0xb6, 0x41, 0x20, 0x57, 0x4e, 0xb8, 0x1d, 0x06, 0x0d, 0x05, 0xa5, 0x8c, 0xf0, 0x1f, 0xff, 0x87, 
-  0xe7, 0x11, 0x6b, 0x37, 0xd7, 0x00, 0x40, 0x17, 0xe2, 0xd7, 0x08, 0x40, 0x31, 0x99, 0x2a, 0xe0, 
-  0x41, 0x70, 0xa2, 0xc1, 0x3e, 0x6b, 0x4a, 0xfc, 0x82, 0x15, 0x12, 0x31, 0x45, 0x82, 0x8e, 0x34, 
-  0xc0, 0x27, 0xd3, 0x81, 0x8d, 0x88, 0x41, 0xec, 0xfc, 0xe5, 0xa3, 0x13, 0xc5, 0x34, 0x05, 0x8d, 
-  0x29, 0x91, 0xf8, 0xf7, 0xa5, 0xab, 0x74, 0x5d, 0xf5, 0x39, 0xfb, 0xa9, 0xb3, 0x2c, 0x7b, 0xf1, 
-  0xea, 0xe0, 0x26, 0x27, 0xcb, 0xb7, 0xd0, 0x3f, 0x8e, 0x6e, 0xa0, 0xa6, 0xc9, 0xf2, 0x09, 0x8a, 
-  0x7c, 0x90, 0x8e, 0xd7, 0xbc, 0x21, 0x4c, 0x31, 0x15, 0x52, 0x31, 0xea, 0x02, 0x82, 0x26, 0x7f, 
-  0x4e, 0x82, 0x68, 0x0d, 0x7a, 0x87, 0x9a, 0xc7, 0x6d, 0x4a, 0x45, 0x22, 0x24, 0x4e, 0xd7, 0xba, 
-  0x9f, 0x5b, 0x26, 0xaf, 0x13, 0x9e, 0xde, 0x49, 0x38, 0x9e, 0x5e, 0xff, 0x7e, 0xc4, 0xb7, 0xac, 
-  0x1f, 0x78, 0x60, 0xf6, 0x98, 0x79, 0x2a, 0x21, 0x8d, 0xfb, 0xd5, 0x12, 0xec, 0xad, 0xdc, 0xc3, 
-  0x74, 0x9f, 0x6d, 0xa8, 0xb9, 0xda, 0xe9, 0x7e, 0x1d, 0x80, 0x04, 0xc0, 0x37, 0x00, 0x8c, 0x44, 
-  0x90, 0x0f, 0x28, 0xb6, 0x3d, 0x66, 0x0e, 0xba, 0xbc, 0x66, 0xca, 0xa8, 0xba, 0xb5, 0x30, 0xc0, 
-  0x99, 0xd8, 0x1d, 0x5f, 0x55, 0xf2, 0xe7, 0xac, 0xaf, 0x72, 0xdf, 0x3a, 0xcb, 0xc2, 0x23, 0x40, 
-  0xde, 0x17, 0x2b, 0xfc, 0x5b, 0xdd, 0xdb, 0x86, 0x7b, 0x97, 0xa5, 0x8a, 0x85, 0xfd, 0x2d, 0xdf, 
-  0xf8, 0x6b, 0x4e, 0xb6, 0xb0, 0x8b, 0x97, 0x3d, 0x2a, 0x21, 0x09, 0x02, 0xcc, 0xd0, 0x70, 0x6a, 
-  0xa8, 0x45, 0x34, 0xa6, 0x4f, 0x93, 0xa2, 0x62, 0xff, 0x1e, 0xcf, 0xdf, 0x77, 0xff, 0xbe, 0xd6, 
-  0xd1, 0xd9, 0x92, 0x07, 0xa0, 0x1f, 0x80, 0xfd, 0xa6, 0x1f, 0x37, 0x41, 0x92, 0x0b, 0x45, 0xe9, 
-  0x89, 0x33, 0x42, 0xc5, 0xb9, 0x0e, 0x07, 0x04, 0xc7, 0x9b, 0x41, 0xe5, 0xcc, 0x92, 0x05, 0x2e, 
-  0x76, 0xce, 0xe2, 0xba, 0x9c, 0x07, 0xc2, 0x73, 0x80, 0x74, 0x7b, 0x08, 0x79, 0x80, 0x1b, 0x3e, 
-  0x31, 0x0b, 0x56, 0x29, 0x94, 0xf3, 0xa9, 0x23, 0x82, 0x9d, 0x9b, 0x8a, 0xfa, 0x65, 0x14, 0x81, 
-  0x14, 0xbd, 0x02, 0x29, 0x3a, 0x05, 0xa2, 0xe5, 0x22, 0x94, 0x97, 0xff, 0xd1, 0x7d, 0xe6, 0xa3, 
-  0x6d, 0x87, 0x06, 0x3a, 0x9a, 0xc7, 0xab, 0x73, 0x92, 0x34, 0x28, 0x66, 0x93, 0x7a, 0x25, 0x84, 
-  0x9f, 0x5c, 0x01, 0x5d, 0xd7, 0x04, 0xfe, 0xc6, 0x00, 0x12, 0x0f, 0x58, 0xf1, 0x6e, 0xfa, 0xf3, 
-  0x10, 0xff, 0xb9, 0x09, 0x92, 0xa7, 0xe7, 0x99, 0x48, 0x83, 0xf2, 0xf9, 0xd0, 0x2d, 0xa0, 0x8d, 
-  0x46, 0xe3, 0xd1, 0x55, 0x39, 0x39, 0xda, 0xb5, 0xaf, 0x55, 0xf6, 0xee, 0xdf, 0x2c, 0xd1, 0x00, 
-  0xc0, 0x67, 0x67, 0x58, 0xfb, 0xf5, 0xbe, 0x63, 0xef, 0x6c, 0xfa, 0xda, 0xf2, 0x52, 0xe2, 0xa2, 
-  0x4c, 0x71, 0x6c, 0x4a, 0x9a, 0x3f, 0xe0, 0xf5, 0x5c, 0x38, 0xbb, 0xff, 0xdd, 0x0b, 0x8e, 0xce, 
-  0x1b, 0xbf, 0x9b, 0x20, 0xb9, 0x8d, 0x54, 0xac, 0x5a, 0xc2, 0xb5, 0xf5, 0x23, 0x9d, 0x34, 0x63, 
-  0x4e, 0x7c, 0x32, 0xaa, 0x3e, 0xae, 0x45, 0xd5, 0x07, 0x7b, 0xf1, 0xcc, 0xaf, 0x5e, 0x80, 0x6f, 
-  0x45, 0x14, 0xa8, 0xd8, 0x08, 0x82, 0x10, 0x52, 0xa9, 0xa1, 0xe2, 0xc7, 0x6f, 0xbe, 0x58, 0xf8, 
-  0xc2, 0xc2, 0x42, 0x9f, 0xc9, 0x20, 0x6c, 0xbf, 0xdf, 0x2c, 0xb8, 0x0c, 0x20, 0x36, 0xc4, 0x71, 
-  0x0c, 0x00, 0xd9, 0x24, 0x9a, 0x59, 0xb5, 0x28, 0x63, 0x7a, 0x7b, 0xe4, 0xc9, 0x22, 0xfe, 0x9e, 
-  0xcc, 0x54, 0xfe, 0xd8, 0xe7, 0xf5, 0xbc, 0xdd, 0x6e, 0xe7, 0xd3, 0x57, 0x65, 0xf2, 0x91, 0xef, 
-  0xe5, 0xf0, 0x91, 0x0d, 0x2f, 0xf2, 0xea, 0xc3, 0xf9, 0x3c, 0x15, 0xab, 0xae, 0xa0, 0x01, 0x50, 
-  0x46, 0xa3, 0xf1, 0x2f, 0x05, 0x05, 0x05, 0x4b, 0x93, 0x92, 0x92, 0x44, 0x16, 0x8b, 0x65, 0xb0, 
-  0xba, 0xba, 0xba, 0xc1, 0x66, 0xf3, 0x67, 0x03, 0xe0, 0xc2, 0x1c, 0x77, 0x4c, 0xb2, 0x7b, 0x1a, 
-  0xe0, 0x5a, 0xfb, 0xfb, 0xc0, 0xf3, 0x31, 0xcc, 0xba, 0x54, 0x14, 0x7c, 0xb8, 0x05, 0x12, 0x47, 
-  0x00, 0xf6, 0xc7, 0xcd, 0xc0, 0x8c, 0xe1, 0xca, 0xf4, 0x37, 0x5c, 0x63, 0xb8, 0x3e, 0xa6, 0x92, 
-  0x32, 0x18, 0x0c, 0x1b, 0x0b, 0x0b, 0x0b, 0xf3, 0x92, 0x93, 0x93, 0x45, 0x16, 0x8b, 0xc5, 0x77, 
-  0xf3, 0xd1, 0xb0, 0x32, 0xbc, 0x7b, 0x9d, 0x72, 0xbf, 0x4e, 0x52, 0x1d, 0xc1, 0x5e, 0x77, 0x86, 
-  0x70, 0x81, 0x59, 0xea, 0x9f, 0x67, 0x04, 0x9b, 0x16, 0x0d, 0x68, 0x87, 0x0f, 0x58, 0xae, 0xcb, 
-  0x09, 0xcf, 0xae, 0x33, 0x8d, 0x7c, 0x8f, 0xe7, 0x15, 0xca, 0xed, 0x76, 0x7f, 0x59, 0x5c, 0x5c, 
-  0xcc, 0x5a, 0x2c, 0x96, 0x25, 0x65, 0x65, 0x65, 0xa7, 0x6c, 0x36, 0xdb, 0x63, 0xdf, 0x57, 0x1c, 
-  0x00, 0x78, 0x8f, 0xbf, 0x29, 0xe8, 0xf0, 0xf8, 0x02, 0x96, 0x8e, 0x24, 0x2a, 0x56, 0xad, 0x22, 
-  0x55, 0x12, 0x04, 0x5d, 0x3e, 0xf8, 0x3e, 0xbb, 0xe2, 0xf6, 0xec, 0x3c, 0x73, 0x9e, 0x6b, 0x1b, 
-  0xc8, 0x06, 0xe0, 0x1b, 0x5d, 0xa0, 0xd7, 0xeb, 0x37, 0x4c, 0xb6, 0x47, 0x9c, 0xa2, 0x19, 0x49, 
-  0xa3, 0xea, 0x75, 0xca, 0x3c, 0xed, 0x18, 0x75, 0x8f, 0xfa, 0x20, 0xa4, 0xa2, 0x9f, 0x84, 0x7e, 
-  0xfc, 0x2f, 0xbf, 0xa8, 0x34, 0x9c, 0xd8, 0x63, 0xca, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 
-  0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-
-// array size is 2089
-static const byte pool_disconnected[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 
-  0xf4, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x19, 
-  0x96, 0x52, 0x61, 0x00, 0x00, 0x07, 0xde, 0x49, 0x44, 0x41, 0x54, 0x58, 0xc3, 0xc5, 0x57, 0x69, 
-  0x50, 0x54, 0x57, 0x1a, 0x3d, 0xef, 0xf5, 0x0a, 0x4d, 0x77, 0xd3, 0xd0, 0xac, 0xdd, 0x4d, 0x2f, 
-  0x2c, 0x2a, 0x2a, 0x8a, 0x2d, 0x49, 0x04, 0x11, 0x94, 0xe0, 0x32, 0x11, 0x13, 0xc7, 0x8a, 0x8a, 
-  0x31, 0x13, 0x93, 0x31, 0x26, 0x33, 0x2e, 0xa5, 0x46, 0x31, 0x56, 0xd0, 0x14, 0x71, 0x19, 0x48, 
-  0x4d, 0x8c, 0x4a, 0x25, 0xd1, 0x29, 0xc7, 0xc4, 0x71, 0x0a, 0x26, 0x32, 0xda, 0xa5, 0x0e, 0x82, 
-  0x0a, 0xa2, 0xa8, 0x63, 0x1c, 0x89, 0x0b, 0x2a, 0x86, 0x45, 0x9b, 0x58, 0x20, 0x62, 0xd3, 0xf6, 
-  0xc2, 0xd2, 0xdb, 0xeb, 0x77, 0xe7, 0x07, 0xb4, 0x69, 0x8d, 0x99, 0x09, 0x94, 0x99, 0xb9, 0x55, 
-  0xef, 0xd7, 0x7b, 0xf7, 0x3b, 0xe7, 0x3b, 0xdf, 0x77, 0xbe, 0xfb, 0x2e, 0xf0, 0xbf, 0x5f, 0x62, 
-  0x85, 0x42, 0xb1, 0xfe, 0xff, 0x80, 0x8b, 0x00, 0x00, 0x61, 0x4a, 0xa5, 0xb2, 0xae, 0xb8, 0xb8, 
-  0xd8, 0x63, 0x30, 0x18, 0x72, 0x7f, 0x31, 0x24, 0x7e, 0x50, 0xd0, 0xa8, 0x84, 0x09, 0x53, 0x14, 
-  0x00, 0xe2, 0x01, 0x40, 0x24, 0xc2, 0x18, 0x7d, 0xa2, 0xa0, 0x25, 0x5e, 0x2d, 0xe8, 0xcc, 0x5b, 
-  0xbb, 0x86, 0x31, 0x18, 0x0c, 0x64, 0xda, 0xb4, 0x69, 0x1d, 0x5c, 0x2e, 0x37, 0xed, 0x99, 0x02, 
-  0x07, 0xab, 0x74, 0x6f, 0x0d, 0xcb, 0x7a, 0xa5, 0x71, 0xc5, 0x91, 0xeb, 0x3d, 0x6b, 0x2b, 0x5b, 
-  0x98, 0xe4, 0x5f, 0xbf, 0xd5, 0x21, 0x8b, 0x8e, 0x39, 0x9e, 0x3a, 0x46, 0xd8, 0xda, 0x51, 0xa9, 
-  0x26, 0x1d, 0x95, 0x6a, 0x32, 0x39, 0x45, 0xda, 0x95, 0x96, 0x96, 0x6a, 0x8a, 0x88, 0x88, 0xf8, 
-  0xed, 0xb3, 0x2d, 0x6c, 0xb8, 0xea, 0xbd, 0x94, 0xdc, 0xa5, 0x0f, 0xbe, 0xba, 0xd9, 0x43, 0xf6, 
-  0xdd, 0xec, 0x21, 0xbb, 0xaf, 0x77, 0x93, 0xb2, 0x46, 0x07, 0x59, 0xb2, 0xb7, 0xd2, 0x3b, 0xf9, 
-  0x85, 0x90, 0xae, 0xfb, 0x27, 0xd4, 0xc4, 0x7a, 0x5a, 0x43, 0x3a, 0x2a, 0xd5, 0x64, 0x54, 0x2c, 
-  0xbf, 0xde, 0xb7, 0x8f, 0x3b, 0x48, 0x1c, 0x0a, 0x00, 0x79, 0x1a, 0xf8, 0x88, 0xa9, 0xb3, 0xd7, 
-  0xad, 0xca, 0x2f, 0x0c, 0xbb, 0x63, 0x77, 0xc2, 0xec, 0xf4, 0xf4, 0x07, 0xa7, 0x29, 0xbc, 0x38, 
-  0x31, 0x83, 0xa6, 0xa8, 0xbf, 0xc9, 0x72, 0x37, 0xce, 0x37, 0x97, 0x7e, 0x24, 0x0e, 0xad, 0xba, 
-  0xe4, 0xe8, 0x73, 0x7b, 0xc8, 0x05, 0xff, 0x80, 0x43, 0x5a, 0x41, 0x41, 0x48, 0x0c, 0x97, 0x72, 
-  0xb7, 0x5b, 0x68, 0x65, 0x47, 0x5c, 0x7a, 0xce, 0xcc, 0xdc, 0x35, 0x9b, 0x43, 0x1c, 0x8c, 0xf7, 
-  0x11, 0xf8, 0xa3, 0x0c, 0x69, 0x0a, 0x63, 0xc3, 0x82, 0x50, 0x71, 0xf6, 0x0c, 0x53, 0xbf, 0x6d, 
-  0x9e, 0xdd, 0x6e, 0x73, 0x54, 0x1b, 0xdb, 0x3d, 0xf3, 0x7c, 0x89, 0x70, 0x86, 0x88, 0x1f, 0x3a, 
-  0x2e, 0x41, 0x58, 0x7b, 0xe4, 0xd3, 0xc8, 0x71, 0x27, 0xea, 0x03, 0xb4, 0xa2, 0x09, 0x73, 0x24, 
-  0xc2, 0x08, 0x35, 0xe5, 0x62, 0xfb, 0xc5, 0x21, 0x2c, 0x8b, 0x6f, 0x8a, 0xd7, 0xa3, 0xb9, 0xa2, 
-  0x04, 0x21, 0x23, 0xc6, 0xc3, 0x0c, 0x01, 0x46, 0x6b, 0x75, 0xb4, 0x33, 0x2c, 0x89, 0xd7, 0xf0, 
-  0xaf, 0xcb, 0xe7, 0x1c, 0x56, 0x73, 0xb9, 0x2f, 0x10, 0x3d, 0x24, 0xf4, 0x60, 0xfa, 0xb5, 0xe5, 
-  0xf3, 0xc4, 0x0a, 0x99, 0x84, 0xc6, 0xf1, 0x4d, 0x0e, 0x49, 0xdf, 0xc9, 0xed, 0x3d, 0x57, 0xcf, 
-  0x56, 0xb0, 0x8c, 0xd7, 0x0b, 0x00, 0xe8, 0xba, 0xdd, 0x00, 0x25, 0x9f, 0xc1, 0x6f, 0x66, 0x66, 
-  0xa1, 0xa9, 0x7c, 0x3f, 0x00, 0xc0, 0xd8, 0xed, 0x40, 0xf4, 0xd8, 0x34, 0x6e, 0x60, 0xb0, 0x7c, 
-  0x9a, 0xbf, 0xf2, 0x43, 0x22, 0x60, 0xb6, 0xb2, 0xbb, 0xf3, 0x77, 0x59, 0xce, 0x7d, 0xfb, 0x9d, 
-  0xdb, 0xcd, 0xe3, 0x52, 0xa8, 0xf8, 0xd0, 0x2e, 0xe9, 0x3b, 0xb9, 0xbd, 0xd7, 0x47, 0x42, 0xa6, 
-  0x8e, 0x47, 0x63, 0xdb, 0x03, 0x7c, 0x79, 0xc0, 0x80, 0x98, 0xb4, 0x5f, 0xf5, 0xab, 0x42, 0xfa, 
-  0x35, 0x0f, 0xd1, 0x24, 0x08, 0x01, 0x44, 0x0c, 0xb5, 0x07, 0xfc, 0x9b, 0x50, 0xa0, 0x55, 0x70, 
-  0x2b, 0xf7, 0x6c, 0x08, 0x4f, 0xd5, 0x0f, 0xe7, 0xf3, 0x3d, 0x0c, 0xc1, 0x8c, 0x02, 0x49, 0x77, 
-  0x60, 0xf6, 0x4a, 0xd1, 0xd8, 0xf4, 0x19, 0x34, 0x97, 0xf3, 0xf4, 0xea, 0x1e, 0x5a, 0xbb, 0xe0, 
-  0x4e, 0xeb, 0xc5, 0xea, 0x04, 0x00, 0xde, 0xa1, 0x28, 0xe0, 0xef, 0x00, 0x97, 0xb1, 0x9d, 0x99, 
-  0xbe, 0x78, 0xd3, 0x83, 0x7f, 0xfa, 0x29, 0x21, 0xf6, 0x57, 0xe2, 0xc9, 0x65, 0xba, 0xdd, 0x40, 
-  0x6c, 0xed, 0xc6, 0x5b, 0x3e, 0xf0, 0xa1, 0x36, 0x21, 0x47, 0xa7, 0xd3, 0x7d, 0x2a, 0x93, 0xc9, 
-  0x72, 0x2c, 0x16, 0x4b, 0xb9, 0xb5, 0x9b, 0x2d, 0x39, 0x7b, 0xc5, 0x91, 0x91, 0x32, 0x52, 0x18, 
-  0xad, 0x0c, 0xe7, 0x72, 0x72, 0x27, 0xb9, 0x04, 0x5f, 0xed, 0xbd, 0xd2, 0x63, 0xe6, 0xca, 0x79, 
-  0xe1, 0xaa, 0x58, 0x8a, 0xa6, 0xfb, 0x73, 0xb4, 0xdf, 0x6f, 0xc3, 0xd1, 0x0d, 0x6f, 0xde, 0x78, 
-  0x78, 0xb7, 0x65, 0x26, 0x00, 0xd7, 0xcf, 0x05, 0xd3, 0x49, 0xc5, 0x9c, 0xb7, 0xfd, 0xe6, 0x05, 
-  0x47, 0xab, 0xd5, 0x56, 0x94, 0x95, 0x95, 0xb9, 0x0a, 0x0a, 0x0a, 0xfa, 0x00, 0x64, 0xf9, 0xa6, 
-  0x6f, 0xac, 0x82, 0x5b, 0x7d, 0xf2, 0xf3, 0x48, 0xb7, 0xf5, 0xb4, 0x86, 0x98, 0x4f, 0x69, 0xc8, 
-  0xf3, 0x93, 0xc7, 0xd8, 0xd2, 0x37, 0xfe, 0x89, 0x5d, 0x51, 0x73, 0x8f, 0xbc, 0x5d, 0x76, 0x99, 
-  0xc8, 0x63, 0x13, 0x6f, 0x00, 0x90, 0x0f, 0xca, 0xe7, 0xcf, 0x8f, 0x16, 0x1a, 0xf7, 0xe4, 0xcb, 
-  0x5d, 0x3a, 0x05, 0xf7, 0x24, 0x00, 0xa1, 0x56, 0xab, 0xad, 0x38, 0x7c, 0xf8, 0xb0, 0xb3, 0xb5, 
-  0xb5, 0x95, 0x24, 0x27, 0x27, 0xb7, 0x00, 0x08, 0xf1, 0xdb, 0x22, 0xd0, 0x2a, 0xb8, 0x35, 0xd5, 
-  0xbb, 0xa2, 0x5d, 0xd6, 0xd3, 0x1a, 0x62, 0xaa, 0x52, 0x93, 0xf1, 0xe9, 0xa3, 0xec, 0x29, 0x2b, 
-  0xb6, 0xb2, 0xf2, 0xd8, 0xc4, 0x06, 0x00, 0xa1, 0x83, 0xd2, 0x39, 0x56, 0xc1, 0xab, 0xb9, 0x5b, 
-  0x1e, 0x43, 0xac, 0xa7, 0x35, 0xe4, 0x1f, 0x3b, 0xa2, 0x5c, 0x32, 0x69, 0xc0, 0x83, 0xb2, 0xb2, 
-  0x32, 0x47, 0x6b, 0x6b, 0x2b, 0x49, 0x49, 0x49, 0x31, 0x0a, 0x04, 0x82, 0xb8, 0xa7, 0x6c, 0x13, 
-  0xc4, 0xaa, 0x78, 0xb5, 0xd5, 0x5f, 0x44, 0x79, 0x7c, 0x24, 0x52, 0xf4, 0x11, 0x66, 0x2e, 0x17, 
-  0x99, 0x83, 0x2e, 0x74, 0x88, 0x52, 0x55, 0x92, 0x9a, 0x31, 0xdc, 0x66, 0x3e, 0xa5, 0x21, 0xd6, 
-  0xd3, 0x1a, 0x72, 0xac, 0x58, 0xc1, 0xcc, 0x9f, 0x93, 0x45, 0xf4, 0x7a, 0xfd, 0xed, 0x27, 0xc1, 
-  0xb5, 0x5a, 0xed, 0x72, 0x9d, 0x4e, 0xf7, 0x87, 0x81, 0x52, 0x3d, 0x46, 0xe2, 0x8f, 0x2b, 0x43, 
-  0x7b, 0x64, 0x12, 0xce, 0xc2, 0xc1, 0x1e, 0x2c, 0xab, 0xf5, 0x0b, 0x96, 0x75, 0xa5, 0x7d, 0xf0, 
-  0x39, 0x9b, 0x9a, 0x35, 0xe6, 0x07, 0x12, 0x3b, 0xa3, 0x18, 0x6d, 0x34, 0xaf, 0x16, 0x00, 0xcf, 
-  0xf7, 0xad, 0x46, 0xa3, 0xd9, 0x55, 0x54, 0x54, 0x64, 0x2f, 0x2c, 0x2c, 0x74, 0x49, 0xa5, 0xd2, 
-  0x79, 0x3e, 0x25, 0xe2, 0x94, 0xbc, 0x33, 0x6f, 0xe6, 0x04, 0x75, 0xe8, 0x14, 0xbc, 0xfd, 0x83, 
-  0xb2, 0xbb, 0x38, 0x5c, 0xb5, 0x7a, 0xfc, 0x82, 0x65, 0x0f, 0x56, 0xd7, 0x76, 0x92, 0xe5, 0x35, 
-  0xed, 0xe4, 0x47, 0x24, 0x76, 0x44, 0xba, 0xe3, 0x62, 0x78, 0xd5, 0x00, 0x78, 0x1a, 0x8d, 0x66, 
-  0xf7, 0xce, 0x9d, 0x3b, 0x6d, 0x9d, 0x9d, 0x9d, 0x24, 0x33, 0x33, 0xb3, 0x0d, 0x40, 0xac, 0xbf, 
-  0x5b, 0x00, 0x0c, 0x1b, 0x54, 0xe6, 0xd2, 0x48, 0xd5, 0xef, 0x52, 0x72, 0x97, 0x9a, 0x56, 0xd7, 
-  0x76, 0x12, 0xdf, 0xf3, 0x03, 0x89, 0x24, 0xab, 0x3f, 0x89, 0xb0, 0x10, 0xe1, 0xdd, 0x6d, 0xdb, 
-  0xb6, 0x59, 0x3b, 0x3b, 0x3b, 0x49, 0x76, 0x76, 0x76, 0xbb, 0x5c, 0x2e, 0xcf, 0x18, 0xca, 0x54, 
-  0xa5, 0x1e, 0x2b, 0xfb, 0xd8, 0x09, 0xf5, 0x73, 0x77, 0x18, 0x14, 0xa0, 0x1e, 0x57, 0xcc, 0xe3, 
-  0x65, 0x70, 0xb9, 0xea, 0x30, 0x21, 0xdf, 0xec, 0xb2, 0x1f, 0xfd, 0xc0, 0x2e, 0xe5, 0xd0, 0xc0, 
-  0xf9, 0x7a, 0x37, 0xfb, 0xd7, 0xda, 0xe1, 0xb4, 0xc9, 0x4a, 0xb7, 0x5f, 0xbb, 0x76, 0x6d, 0x81, 
-  0xc9, 0x64, 0xaa, 0x1d, 0x0a, 0x81, 0x47, 0x93, 0x90, 0xc3, 0xe1, 0x4f, 0x4d, 0x9a, 0xf5, 0x86, 
-  0xfc, 0x31, 0x70, 0x42, 0x60, 0x36, 0x36, 0x82, 0x66, 0x09, 0xc6, 0xbd, 0xf8, 0x32, 0x45, 0xbd, 
-  0xf0, 0xae, 0x24, 0x67, 0x8b, 0xd4, 0xee, 0x65, 0x81, 0xb4, 0x24, 0x3e, 0xfd, 0xfa, 0xa4, 0x5b, 
-  0xde, 0xe6, 0x86, 0x33, 0x6d, 0x26, 0x93, 0xe9, 0xc2, 0x93, 0x95, 0x8c, 0x14, 0xf2, 0x37, 0x00, 
-  0x48, 0xf0, 0x77, 0x36, 0x00, 0xc1, 0x4f, 0x12, 0x10, 0x04, 0x49, 0xc4, 0x01, 0xc1, 0x21, 0x7c, 
-  0xff, 0x97, 0x17, 0x8a, 0xd7, 0xc3, 0x7e, 0x6c, 0x17, 0xce, 0x6c, 0x7d, 0x17, 0x3c, 0x0e, 0x77, 
-  0x80, 0xc4, 0x3b, 0xe2, 0x59, 0x5b, 0xc4, 0x76, 0x2f, 0x0b, 0xa4, 0x26, 0x09, 0x38, 0x9f, 0xad, 
-  0x93, 0x27, 0xeb, 0x14, 0xdc, 0x72, 0x7f, 0x35, 0x15, 0x81, 0xfc, 0xf7, 0x3f, 0x19, 0xaf, 0x2b, 
-  0xc8, 0x8c, 0x90, 0x9e, 0x50, 0x8b, 0x84, 0x7f, 0x4e, 0x0d, 0x93, 0x34, 0xbe, 0xa6, 0x0b, 0xbb, 
-  0x35, 0x4b, 0x19, 0xda, 0x94, 0x14, 0x22, 0xba, 0x14, 0x21, 0x14, 0x4e, 0xf9, 0xd1, 0x28, 0xf6, 
-  0xb8, 0xfa, 0x9c, 0x81, 0x52, 0xf9, 0xdc, 0xc4, 0xd4, 0x2c, 0x91, 0x77, 0xe0, 0xe4, 0x6a, 0x2e, 
-  0xdf, 0x8f, 0x39, 0xd3, 0xa7, 0xa0, 0xee, 0xdb, 0x2b, 0x88, 0xcd, 0x9e, 0x0b, 0x0e, 0x4d, 0x23, 
-  0x42, 0x9b, 0x40, 0x75, 0xb8, 0xc5, 0xfc, 0xd2, 0xd2, 0xfa, 0xee, 0xf9, 0xe9, 0x6e, 0x81, 0x26, 
-  0x8a, 0xcb, 0xa9, 0x6f, 0x76, 0x07, 0x5e, 0x6f, 0x71, 0x1b, 0x00, 0x58, 0x00, 0xc0, 0xe5, 0xf1, 
-  0x76, 0xd9, 0x18, 0x6f, 0xce, 0xd7, 0x19, 0x23, 0x62, 0x66, 0x2a, 0x43, 0x92, 0xd7, 0x8d, 0x52, 
-  0x85, 0xce, 0x8e, 0x91, 0x4b, 0xe6, 0x69, 0xc3, 0xa4, 0x8b, 0x62, 0x23, 0xa2, 0x8d, 0x3d, 0xce, 
-  0x19, 0x16, 0x0f, 0x63, 0xb5, 0xba, 0x99, 0xcb, 0xfe, 0x67, 0x81, 0xc9, 0x6d, 0x7b, 0x38, 0x3d, 
-  0x56, 0x9f, 0xaa, 0x0e, 0x0b, 0x8f, 0xa2, 0x5c, 0x5e, 0x82, 0x90, 0x61, 0xc9, 0xa8, 0xad, 0xa9, 
-  0xc6, 0xb0, 0xd9, 0x4b, 0x20, 0x92, 0x47, 0xf6, 0x33, 0x1e, 0x20, 0x71, 0xe7, 0x7e, 0x2f, 0xdf, 
-  0x50, 0x7a, 0xd1, 0xe2, 0xe8, 0x71, 0xb0, 0x87, 0x6a, 0xfa, 0x8e, 0x59, 0xba, 0xd9, 0xbd, 0xbe, 
-  0x40, 0x5e, 0xa0, 0x93, 0x61, 0xa1, 0x7f, 0x25, 0x46, 0x9e, 0xe4, 0x01, 0x8d, 0xfc, 0xdb, 0x16, 
-  0xe8, 0x84, 0x1c, 0xec, 0xbb, 0xd7, 0x83, 0x1a, 0x8b, 0x13, 0x1f, 0x27, 0x29, 0x44, 0xc7, 0xdb, 
-  0x2d, 0xc9, 0xb7, 0xbb, 0x9d, 0xa5, 0x8f, 0x08, 0x88, 0x44, 0x18, 0x33, 0x52, 0xe9, 0xf8, 0xbd, 
-  0xa9, 0xee, 0x20, 0x1b, 0x18, 0x3f, 0x59, 0x38, 0x21, 0x41, 0x4b, 0x59, 0x38, 0x81, 0x88, 0xd2, 
-  0x67, 0x3c, 0x02, 0xa7, 0x28, 0x40, 0x1f, 0x2e, 0x46, 0xdb, 0xdd, 0xef, 0x71, 0xfe, 0x8b, 0x2d, 
-  0x8d, 0xcd, 0x0d, 0xc6, 0xc5, 0x17, 0x1b, 0xdc, 0xe7, 0xef, 0x99, 0x98, 0x0f, 0x9f, 0xac, 0xed, 
-  0x68, 0x59, 0x60, 0xe1, 0x9a, 0x91, 0xca, 0xd0, 0xf7, 0x5b, 0xac, 0x58, 0xf3, 0x97, 0x32, 0x7c, 
-  0x74, 0xa4, 0x0a, 0x29, 0x0b, 0x17, 0xa3, 0xb5, 0xd7, 0x0d, 0x8d, 0xad, 0x03, 0x69, 0xe1, 0x52, 
-  0x69, 0x75, 0x87, 0xd5, 0xe9, 0xeb, 0x01, 0xd1, 0x08, 0xb5, 0xe0, 0xd0, 0xc1, 0xa2, 0x08, 0xf5, 
-  0xd7, 0x9b, 0x24, 0xa1, 0xf5, 0xdb, 0x67, 0x3f, 0x3c, 0x57, 0x57, 0xc7, 0xea, 0xc3, 0x83, 0xc0, 
-  0xa3, 0xfb, 0x4b, 0xcb, 0xa1, 0x28, 0x8c, 0x0b, 0x13, 0xe3, 0x6a, 0x63, 0x33, 0x4a, 0xf3, 0x16, 
-  0x36, 0x74, 0xdd, 0xb9, 0x39, 0x91, 0x61, 0x70, 0xe2, 0xa1, 0xd5, 0xbb, 0xf7, 0x29, 0x3f, 0xaa, 
-  0xf2, 0x38, 0x49, 0x40, 0x20, 0x00, 0x2c, 0x53, 0x88, 0xb0, 0x25, 0xef, 0x3d, 0xec, 0xf9, 0xbb, 
-  0x01, 0xf1, 0xa3, 0x46, 0xa3, 0xfd, 0xf2, 0x45, 0x24, 0x48, 0x02, 0x90, 0x24, 0x13, 0x41, 0xc0, 
-  0xa1, 0x9f, 0xf3, 0x9d, 0x72, 0x12, 0xa7, 0x8b, 0x12, 0xd1, 0x1c, 0x40, 0xc0, 0xa3, 0x70, 0x60, 
-  0xb3, 0x44, 0x3e, 0x6d, 0xd5, 0xac, 0x87, 0xae, 0xb5, 0x07, 0x82, 0x27, 0xa7, 0x4d, 0xa4, 0x41, 
-  0xfa, 0xbb, 0xf5, 0xfc, 0xd5, 0x6b, 0xa4, 0x64, 0xfd, 0xa2, 0x9b, 0x66, 0x63, 0x63, 0x26, 0x00, 
-  0xf3, 0x7f, 0x70, 0x97, 0xab, 0x8f, 0xf1, 0xb2, 0x00, 0x50, 0x65, 0x75, 0xe1, 0xa5, 0x45, 0xaf, 
-  0xa2, 0xa9, 0xa9, 0x09, 0x51, 0x51, 0x51, 0x70, 0x07, 0x49, 0x61, 0x75, 0x33, 0x20, 0xfd, 0x94, 
-  0xed, 0x5c, 0x00, 0x62, 0xa5, 0x52, 0x79, 0x34, 0x3b, 0x67, 0x8e, 0x7c, 0x41, 0xfe, 0xbe, 0xae, 
-  0x92, 0xcd, 0x52, 0x79, 0xf5, 0x25, 0x47, 0x5f, 0x8f, 0xad, 0xb7, 0xfa, 0x60, 0xc1, 0x52, 0xef, 
-  0x29, 0xa5, 0x6e, 0xfc, 0xa4, 0x77, 0xf2, 0xdd, 0x6e, 0xb7, 0xe3, 0xfb, 0xca, 0xad, 0x2b, 0x9c, 
-  0x66, 0x63, 0xe3, 0x1b, 0x00, 0xba, 0xff, 0x8b, 0xbd, 0xbb, 0x9b, 0x6c, 0x4e, 0xb3, 0x87, 0x25, 
-  0x2a, 0x1b, 0xc3, 0xa2, 0xfe, 0xd2, 0x45, 0x1c, 0xdc, 0x5e, 0x04, 0xc8, 0xc2, 0xc0, 0xb0, 0x2c, 
-  0x5c, 0x5e, 0x16, 0xc7, 0xda, 0x2c, 0xbd, 0x26, 0x87, 0xab, 0x94, 0x52, 0xa9, 0x54, 0x1b, 0xf2, 
-  0xf2, 0xf2, 0x36, 0x2a, 0x95, 0x4a, 0xee, 0xc7, 0x45, 0x85, 0xe6, 0xde, 0xae, 0x2b, 0xf7, 0xfb, 
-  0xdc, 0xe4, 0x42, 0xcb, 0x5d, 0xcf, 0x92, 0x01, 0x69, 0x79, 0x03, 0x76, 0x65, 0x01, 0x78, 0x7e, 
-  0xee, 0x80, 0x51, 0x04, 0x0a, 0x66, 0xbe, 0xaa, 0x96, 0x7f, 0x59, 0xa4, 0xd7, 0xca, 0xbf, 0xb3, 
-  0xf5, 0x21, 0x31, 0x58, 0x04, 0x93, 0xd3, 0x03, 0x86, 0x10, 0xb0, 0x84, 0xe0, 0xa5, 0xaa, 0x1b, 
-  0x75, 0x37, 0x6d, 0x7d, 0xcf, 0x01, 0x00, 0x0c, 0x06, 0xc3, 0xdc, 0xa9, 0x53, 0xa7, 0x76, 0x3c, 
-  0xeb, 0xeb, 0x52, 0x9c, 0x24, 0x60, 0xe5, 0xcb, 0xaa, 0xd0, 0xb6, 0xab, 0x39, 0xe3, 0x08, 0xf3, 
-  0x7a, 0x3a, 0xb1, 0xe6, 0xa6, 0x92, 0x3d, 0x13, 0xe2, 0x7b, 0x47, 0x06, 0x07, 0xd6, 0x01, 0x08, 
-  0xf7, 0x1f, 0xc5, 0x94, 0x50, 0x28, 0x9c, 0xe8, 0x74, 0x3a, 0xcf, 0xfe, 0x02, 0x77, 0x55, 0x55, 
-  0x9c, 0x38, 0x60, 0x15, 0x97, 0xc6, 0x58, 0x10, 0xaa, 0xdb, 0xec, 0x71, 0x95, 0x98, 0x1c, 0xde, 
-  0xb2, 0x01, 0x45, 0xf1, 0x6f, 0x50, 0x20, 0x78, 0x9d, 0x88, 0x76, 0xb8, 0x21, 0x00, 0x00, 0x00, 
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-// array size is 1563
-static const byte pickaxe_one[] PROGMEM  = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a, 
-  0xf4, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x37, 
-  0xf7, 0x41, 0xb1, 0x00, 0x00, 0x05, 0xd0, 0x49, 0x44, 0x41, 0x54, 0x58, 0xc3, 0xcd, 0x97, 0x7d, 
-  0x6c, 0x55, 0x77, 0x19, 0xc7, 0xbf, 0xe7, 0xdc, 0x7b, 0xdb, 0x73, 0x39, 0xb7, 0x74, 0xda, 0xa1, 
-  0x6c, 0x93, 0x2d, 0x66, 0x4e, 0xf7, 0x12, 0x15, 0x1c, 0x2c, 0xcc, 0x2d, 0x0b, 0x52, 0xd7, 0x69, 
-  0x10, 0xfe, 0x18, 0xae, 0xb3, 0xd4, 0x81, 0x43, 0x48, 0x11, 0xb0, 0xd1, 0x45, 0x82, 0xfb, 0xaf, 
-  0x26, 0x33, 0xbe, 0x0c, 0x65, 0x86, 0xe0, 0x1f, 0x0e, 0xf6, 0xdf, 0xb2, 0x8d, 0x44, 0x9d, 0xb8, 
-  0x05, 0xca, 0x96, 0x69, 0xb7, 0x22, 0xdb, 0x12, 0x2a, 0xdd, 0x90, 0x42, 0x6f, 0x0b, 0xac, 0x94, 
-  0xb5, 0xf4, 0xf6, 0xbe, 0x9d, 0xb7, 0xdf, 0xf9, 0xbd, 0x3e, 0xfe, 0x71, 0xa1, 0x59, 0xa5, 0x9d, 
-  0x7d, 0x23, 0xfa, 0x24, 0xbf, 0x9c, 0x9c, 0x97, 0xdf, 0xf9, 0x7e, 0xf2, 0x3c, 0xcf, 0x79, 0x9e, 
-  0xe7, 0x00, 0xff, 0x63, 0xb3, 0x66, 0xb3, 0x79, 0x70, 0x70, 0xf8, 0x5b, 0x8c, 0xf3, 0x65, 0x4c, 
-  0xc8, 0xdb, 0xb8, 0x50, 0x37, 0x73, 0x2e, 0x6c, 0x29, 0x15, 0x38, 0x17, 0x1f, 0xb2, 0x58, 0xf6, 
-  0x07, 0x8c, 0x5e, 0x7a, 0x6c, 0xed, 0x03, 0x5d, 0x73, 0x0a, 0x30, 0x52, 0x2c, 0x2e, 0x66, 0x1e, 
-  0x7b, 0x82, 0x4b, 0x51, 0xcf, 0xa5, 0xba, 0x51, 0x4a, 0x05, 0xa9, 0x34, 0xd4, 0xe5, 0x25, 0x95, 
-  0x86, 0xd2, 0x95, 0xa3, 0x10, 0xca, 0xb0, 0x58, 0x74, 0x7c, 0x77, 0xed, 0xd7, 0x57, 0x4e, 0xf6, 
-  0xbe, 0xe4, 0x54, 0x44, 0x1b, 0x1a, 0x1a, 0xdc, 0x54, 0xaa, 0x6a, 0xf7, 0xd6, 0xed, 0xdb, 0xef, 
-  0xf2, 0x4b, 0xfe, 0x32, 0x21, 0x55, 0x4a, 0x7e, 0x54, 0x70, 0x62, 0x71, 0x8a, 0x63, 0xc1, 0x39, 
-  0x17, 0x2b, 0x88, 0xc8, 0xb2, 0x2c, 0x8b, 0xa6, 0x05, 0xf0, 0xc1, 0x2f, 0xd6, 0x7d, 0x22, 0x51, 
-  0x3b, 0xef, 0xd8, 0x89, 0xe1, 0xc8, 0x7d, 0xfa, 0xef, 0x83, 0xe9, 0x4b, 0x97, 0x2e, 0xd5, 0xed, 
-  0xdd, 0xb3, 0x07, 0x3b, 0x76, 0x3e, 0x89, 0xba, 0x05, 0x9f, 0x9e, 0x50, 0x3c, 0xe6, 0x1c, 0xe5, 
-  0x20, 0x06, 0xe7, 0x1c, 0x5c, 0xea, 0x9c, 0x21, 0xf3, 0x9a, 0x4d, 0xd6, 0x8b, 0x93, 0x89, 0x4f, 
-  0x1a, 0x82, 0x77, 0x9e, 0xac, 0xaf, 0xab, 0x71, 0x6a, 0x5e, 0x7f, 0xb7, 0x60, 0x2d, 0xfe, 0x5d, 
-  0xc7, 0x39, 0x08, 0x29, 0xe1, 0xba, 0x2e, 0x5c, 0xd7, 0xc5, 0xcd, 0xb7, 0xdc, 0x82, 0x0d, 0x1b, 
-  0xb7, 0xc0, 0xcd, 0xd4, 0x8c, 0x89, 0x87, 0x51, 0x8c, 0x7c, 0xd9, 0x47, 0x10, 0x71, 0x6d, 0xc8, 
-  0xbc, 0x68, 0xc1, 0x7a, 0x76, 0xe4, 0x6c, 0xd7, 0x5b, 0x6d, 0x6d, 0x6d, 0x66, 0xda, 0x49, 0xf8, 
-  0xce, 0xfa, 0x7b, 0xea, 0x30, 0xdf, 0x79, 0xfd, 0x68, 0x34, 0x6f, 0xf1, 0xfe, 0xb7, 0x07, 0xa0, 
-  0xb4, 0x86, 0xeb, 0xba, 0xc8, 0x64, 0x32, 0x63, 0x10, 0x0b, 0x6f, 0xb8, 0x11, 0x6b, 0x1e, 0x7e, 
-  0x14, 0xc9, 0xa4, 0x83, 0xe1, 0xd1, 0x12, 0x4a, 0x5e, 0xa4, 0x00, 0x3c, 0x6f, 0x1b, 0xfc, 0x7c, 
-  0xcb, 0xe3, 0xab, 0xb3, 0xd3, 0xc9, 0xa9, 0xab, 0x42, 0xe0, 0x41, 0xfd, 0x21, 0x3b, 0xaa, 0x16, 
-  0x3f, 0x77, 0x72, 0x10, 0x52, 0x29, 0xa4, 0xd3, 0x69, 0x38, 0x8e, 0x83, 0xea, 0xea, 0xea, 0xb1, 
-  0x25, 0x05, 0xc7, 0xb1, 0xce, 0x37, 0x71, 0xc3, 0x67, 0xbf, 0x04, 0xad, 0xf5, 0x9b, 0xb6, 0xb1, 
-  0x36, 0x4d, 0x57, 0xf8, 0x8a, 0xd9, 0xff, 0x79, 0xa1, 0xab, 0x60, 0xec, 0xe7, 0x7a, 0x63, 0x08, 
-  0x21, 0x90, 0x4a, 0xa5, 0xc6, 0x09, 0x3b, 0x8e, 0x03, 0xc7, 0x71, 0x00, 0xcb, 0x42, 0x47, 0x47, 
-  0x87, 0x51, 0x46, 0xff, 0xf8, 0xd2, 0xb9, 0xae, 0xaf, 0xcd, 0x54, 0x7c, 0x22, 0x0f, 0xd8, 0x6f, 
-  0xc4, 0x75, 0xcb, 0xbd, 0xe0, 0x02, 0x2c, 0xcb, 0xba, 0x4a, 0xb8, 0xba, 0xba, 0x1a, 0xcb, 0x6f, 
-  0x4a, 0x23, 0x55, 0xfc, 0x00, 0xef, 0x16, 0x46, 0x0f, 0x6c, 0x5d, 0xbf, 0xe6, 0x99, 0xd9, 0x16, 
-  0xa2, 0x71, 0x1e, 0x68, 0x6a, 0x6a, 0x5a, 0x77, 0xfe, 0xc2, 0xe0, 0x42, 0x00, 0x57, 0x09, 0x3b, 
-  0x8e, 0x83, 0x07, 0x6f, 0x4a, 0x62, 0xe5, 0xfc, 0x02, 0xee, 0x5f, 0xe4, 0xe2, 0xe5, 0xf5, 0x77, 
-  0x95, 0xe6, 0xa2, 0x12, 0x26, 0x3e, 0x7a, 0xf2, 0x97, 0xbf, 0xbe, 0xf2, 0x23, 0xdb, 0x4e, 0x2e, 
-  0x39, 0x7d, 0xba, 0x07, 0xe9, 0x74, 0x7a, 0xdc, 0xba, 0x6f, 0x81, 0x8d, 0xa5, 0x89, 0x61, 0x24, 
-  0x92, 0x49, 0xd8, 0x09, 0x0b, 0x5a, 0xaa, 0xa5, 0x3b, 0x56, 0x2f, 0x4d, 0xed, 0x3e, 0xdc, 0xfd, 
-  0xc6, 0x9c, 0x00, 0x14, 0x0a, 0x85, 0xda, 0x88, 0x89, 0xfd, 0xb7, 0xdf, 0x71, 0x67, 0x55, 0x26, 
-  0x53, 0x83, 0xbe, 0xbe, 0x2c, 0xd2, 0x69, 0x07, 0xe9, 0x74, 0x1a, 0x77, 0x5c, 0x97, 0xc2, 0xbd, 
-  0x32, 0x0b, 0x80, 0x40, 0x44, 0x48, 0x56, 0x55, 0x01, 0x20, 0x48, 0x29, 0x1e, 0xf8, 0xc9, 0xaa, 
-  0xbb, 0x83, 0x67, 0xda, 0xdf, 0x3b, 0x36, 0xeb, 0x10, 0x44, 0x9c, 0xb7, 0x2a, 0xad, 0x33, 0x52, 
-  0x69, 0xac, 0xa8, 0x6f, 0xc0, 0xba, 0xc7, 0xbe, 0x07, 0xd7, 0x75, 0x91, 0x4a, 0xa5, 0x90, 0x39, 
-  0xd7, 0x85, 0x88, 0x2b, 0x08, 0x16, 0x83, 0x87, 0x11, 0x58, 0xd9, 0x07, 0x11, 0x00, 0x43, 0xe0, 
-  0x71, 0xf8, 0x74, 0xff, 0xee, 0xe6, 0x8d, 0xb3, 0x06, 0x08, 0x83, 0x78, 0x95, 0x54, 0x1a, 0x5a, 
-  0x1b, 0x48, 0xa5, 0xf1, 0xc5, 0x2f, 0xdf, 0x8d, 0x95, 0x0d, 0xab, 0x70, 0xea, 0xd4, 0x29, 0x74, 
-  0x06, 0xa9, 0x9d, 0xe7, 0x72, 0xe1, 0x59, 0x8f, 0x55, 0x20, 0xe2, 0x30, 0x04, 0x0f, 0x43, 0x10, 
-  0x01, 0x46, 0x93, 0x25, 0x82, 0x68, 0x5f, 0x76, 0x77, 0xf3, 0xb7, 0x67, 0x0c, 0x30, 0x32, 0x32, 
-  0x92, 0x51, 0x86, 0xbe, 0xe2, 0x54, 0x57, 0xe3, 0x53, 0x0b, 0x3e, 0x89, 0xaa, 0x54, 0x0a, 0x42, 
-  0x2a, 0xe4, 0x8b, 0x8c, 0x91, 0x65, 0x3f, 0x7f, 0xf0, 0xed, 0xf7, 0x7f, 0x2d, 0x2d, 0xb3, 0x7c, 
-  0x60, 0xd4, 0x3f, 0xee, 0x31, 0x09, 0xc1, 0x62, 0x30, 0xcf, 0x87, 0xe2, 0x1c, 0x20, 0x80, 0x8c, 
-  0xb1, 0xa4, 0x17, 0xbe, 0xd4, 0xff, 0x9b, 0xe6, 0xfa, 0x19, 0x01, 0x30, 0x61, 0x56, 0x08, 0x21, 
-  0x52, 0x76, 0x22, 0x81, 0x79, 0x69, 0x07, 0x96, 0x65, 0x21, 0x97, 0xf7, 0xe0, 0xce, 0xaf, 0xdd, 
-  0xf1, 0x7e, 0xf7, 0x89, 0x0d, 0x00, 0xd0, 0x7a, 0xa8, 0x2f, 0x27, 0x6d, 0xac, 0x3c, 0x3f, 0x1a, 
-  0xfd, 0xad, 0x18, 0x09, 0x08, 0x16, 0x23, 0x2c, 0x97, 0xa1, 0x95, 0x02, 0x11, 0xc1, 0x68, 0x6d, 
-  0xc7, 0x9e, 0x7f, 0xb8, 0x7f, 0x57, 0xf3, 0xb2, 0x69, 0x03, 0xf8, 0x9e, 0x7f, 0xbf, 0x90, 0x1a, 
-  0xb9, 0xd1, 0x02, 0x7a, 0xfb, 0x07, 0x30, 0x92, 0x2f, 0xa2, 0xe8, 0x07, 0x9d, 0x4f, 0xfc, 0xa0, 
-  0xf9, 0xf7, 0x00, 0xf4, 0x95, 0x87, 0x5b, 0x0f, 0xf5, 0x79, 0xda, 0x36, 0xdf, 0xbc, 0x90, 0x8f, 
-  0xfe, 0x94, 0xf7, 0x05, 0x44, 0x14, 0x23, 0x2a, 0x95, 0x41, 0x86, 0x00, 0x10, 0x8c, 0xd6, 0x49, 
-  0xe6, 0x7b, 0x9d, 0x67, 0x76, 0x35, 0xdd, 0x3e, 0x2d, 0x80, 0x72, 0x10, 0x7f, 0x4e, 0x55, 0x5a, 
-  0x28, 0xfc, 0x80, 0xc1, 0xf3, 0x23, 0x82, 0xa0, 0xcd, 0x13, 0x75, 0xb1, 0xd6, 0x43, 0x7d, 0x3c, 
-  0x77, 0x6f, 0xf6, 0x91, 0xc1, 0x62, 0xb4, 0x27, 0xe7, 0xc5, 0xe0, 0x11, 0x03, 0xf3, 0x7c, 0x10, 
-  0x55, 0xbe, 0x10, 0x2d, 0x55, 0x15, 0x2f, 0xf9, 0x5d, 0x7d, 0x4f, 0x7d, 0x67, 0xd1, 0x94, 0x01, 
-  0xb8, 0x94, 0xd7, 0x5d, 0x69, 0xa9, 0x52, 0x2b, 0x94, 0x3d, 0x76, 0xac, 0xe5, 0xf1, 0xd5, 0xa7, 
-  0x27, 0xdb, 0xd4, 0xd6, 0x06, 0xb3, 0xfd, 0x48, 0xb6, 0x75, 0xa8, 0xc4, 0x7f, 0x36, 0x54, 0x64, 
-  0x14, 0x07, 0x21, 0x44, 0xc8, 0x2a, 0x37, 0x89, 0x60, 0x94, 0x4c, 0xb3, 0x38, 0x38, 0x79, 0x66, 
-  0x57, 0xd3, 0xf5, 0x53, 0x03, 0xe0, 0x7c, 0x6c, 0x98, 0x08, 0x43, 0x8e, 0x58, 0xa9, 0x9d, 0x53, 
-  0xa1, 0xdf, 0x76, 0xa4, 0xb7, 0x2d, 0x17, 0x88, 0x96, 0x0b, 0x85, 0xc8, 0x44, 0x9e, 0x07, 0xc9, 
-  0x05, 0x88, 0x00, 0x22, 0x82, 0xe4, 0x7c, 0xbe, 0x28, 0x95, 0x7b, 0x46, 0xf6, 0x6e, 0xcd, 0xfc, 
-  0xf7, 0x24, 0xe4, 0x72, 0xe8, 0xca, 0x24, 0xc3, 0x98, 0x18, 0xdd, 0xb6, 0x7e, 0x75, 0xe7, 0x54, 
-  0x63, 0xb8, 0xad, 0xbd, 0xf7, 0xd9, 0x7c, 0x28, 0x1a, 0x07, 0xf2, 0x4c, 0x86, 0x65, 0x0f, 0xa4, 
-  0x35, 0x40, 0x00, 0x40, 0x10, 0x8c, 0x5f, 0x3f, 0x7c, 0xf1, 0x7c, 0xcf, 0xbf, 0xda, 0x1e, 0xa9, 
-  0xfa, 0x58, 0x80, 0x20, 0x92, 0x47, 0x62, 0x2e, 0x2b, 0xa3, 0x94, 0x94, 0xff, 0x98, 0xee, 0xa7, 
-  0xf4, 0xc3, 0xf6, 0xec, 0x1f, 0xcb, 0x91, 0xac, 0x1f, 0xc8, 0x05, 0x61, 0x50, 0xf2, 0x60, 0x0c, 
-  0x8d, 0xe5, 0x04, 0x67, 0xec, 0x33, 0x8a, 0x07, 0xa7, 0xe8, 0xc0, 0xf8, 0xb2, 0x3f, 0xde, 0x03, 
-  0xa3, 0xf9, 0x83, 0x41, 0xc8, 0x4c, 0x1c, 0x0b, 0x84, 0xb1, 0xfa, 0xed, 0x4c, 0x0a, 0xca, 0xd6, 
-  0xf6, 0xde, 0xb7, 0x0a, 0x4c, 0xdd, 0x77, 0x76, 0xd8, 0x2b, 0x30, 0xcf, 0x07, 0x4c, 0xc5, 0x0b, 
-  0x20, 0x02, 0x8f, 0xa2, 0x5b, 0xbb, 0xff, 0xf9, 0x8d, 0xf7, 0xa8, 0xed, 0xea, 0xf6, 0x6f, 0x03, 
-  0x40, 0x4b, 0x4b, 0x63, 0x39, 0xe2, 0xe2, 0x68, 0x14, 0xf1, 0x68, 0x61, 0x26, 0xee, 0x9c, 0x69, 
-  0x59, 0x6d, 0x6d, 0xef, 0xed, 0x2e, 0x2b, 0x79, 0x4f, 0xdf, 0x50, 0xe9, 0x22, 0x8b, 0xa2, 0xb1, 
-  0x7c, 0x20, 0x22, 0xc4, 0x7e, 0x78, 0x67, 0x77, 0xdc, 0x70, 0x74, 0xd2, 0x52, 0xcc, 0x95, 0xde, 
-  0xc0, 0xa5, 0xda, 0xd4, 0xd8, 0xd8, 0xa8, 0x67, 0xd3, 0xdd, 0x5a, 0x0f, 0xf5, 0xf5, 0x7b, 0x4a, 
-  0x2d, 0xe9, 0x1d, 0x2c, 0x9e, 0x14, 0x2c, 0xae, 0xe4, 0x03, 0x55, 0xea, 0x04, 0xf3, 0xc2, 0xe5, 
-  0x27, 0x76, 0x3e, 0x74, 0x64, 0xce, 0x7e, 0x4c, 0x3e, 0xce, 0xf6, 0xaf, 0xf9, 0x42, 0x8d, 0x6d, 
-  0x70, 0xf8, 0xf3, 0x8b, 0xea, 0xbe, 0x9a, 0x48, 0x24, 0x40, 0x64, 0x40, 0x86, 0x40, 0x64, 0x30, 
-  0xaf, 0xb6, 0xf6, 0xc0, 0x92, 0x5f, 0xb5, 0x3f, 0x3a, 0xe1, 0x48, 0x36, 0x57, 0xf6, 0xfd, 0x83, 
-  0x67, 0x7c, 0x31, 0x94, 0x59, 0x71, 0x7a, 0xa0, 0xf8, 0x67, 0x25, 0x15, 0x2e, 0xc7, 0x03, 0x20, 
-  0x20, 0x2c, 0x94, 0x1a, 0xbb, 0x7e, 0xfa, 0xd0, 0x96, 0x6b, 0x0a, 0x00, 0x00, 0x2d, 0xc7, 0x8f, 
-  0xcb, 0x8d, 0xaf, 0xf6, 0xac, 0xed, 0xb9, 0x58, 0xd8, 0xa7, 0x94, 0x01, 0x5d, 0x9e, 0x27, 0x08, 
-  0x84, 0x52, 0xc9, 0x5b, 0x7b, 0xcd, 0x01, 0x2e, 0xc7, 0x98, 0x36, 0xbf, 0x72, 0x66, 0x73, 0xff, 
-  0x87, 0xc5, 0xa7, 0x94, 0x32, 0x00, 0x11, 0x34, 0xd9, 0x18, 0x18, 0x2c, 0xff, 0xf2, 0x9a, 0xe6, 
-  0xc0, 0x44, 0xb6, 0xf7, 0xc1, 0xdb, 0x9a, 0x9c, 0x94, 0xbd, 0x29, 0x96, 0x66, 0xdf, 0xb6, 0xd7, 
-  0xb2, 0x2f, 0xe0, 0xff, 0xc1, 0xfe, 0x0d, 0xa3, 0x66, 0xc0, 0x45, 0x4b, 0x5f, 0xa1, 0x4a, 0x00, 
-  0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
\ No newline at end of file
@@ -0,0 +1,1195 @@
+// Generated by tools/build_display_images.py from graphics/. Do not edit.
+#include "display_images.h"
+
+// logo.png: 117x60, 10845 bytes as PNG, 11108 as runs
+static const uint8_t imageLogoData[] PROGMEM = {
+  0x3f, 0x34, 0x04, 0xc8, 0x23, 0x23, 0x22, 0x1a, 0x14, 0x14, 0x14, 0x56, 0x11, 0x11, 0x11, 0x64,
+  0x12, 0x14, 0x13, 0x64, 0x14, 0x14, 0x13, 0x64, 0x13, 0x13, 0x13, 0x64, 0x10, 0x12, 0x11, 0x63,
+  0x1b, 0x1c, 0x1b, 0x4e, 0x25, 0x25, 0x24, 0x16, 0x01, 0xd0, 0x4a, 0x4b, 0x4a, 0x04, 0x1c, 0x1d,
+  0x1c, 0x41, 0x10, 0x11, 0x10, 0x63, 0x10, 0x11, 0x10, 0x64, 0x12, 0x12, 0x12, 0x63, 0x17, 0x17,
+  0x16, 0x56, 0x25, 0x25, 0x24, 0x18, 0x1f, 0x1f, 0x1f, 0x31, 0x14, 0x14, 0x13, 0x5e, 0x13, 0x13,
+  0x13, 0x63, 0x12, 0x12, 0x12, 0x63, 0x13, 0x13, 0x13, 0x63, 0x13, 0x13, 0x13, 0x64, 0x12, 0x12,
+  0x11, 0x63, 0x10, 0x10, 0x10, 0x63, 0x14, 0x14, 0x14, 0x5b, 0x21, 0x21, 0x21, 0x21, 0x01, 0xda,
+  0x1d, 0x1d, 0x1c, 0x3a, 0x10, 0x10, 0x10, 0x83, 0x14, 0x15, 0x14, 0xa6, 0x09, 0x09, 0x08, 0xbe,
+  0x14, 0x15, 0x15, 0xb0, 0x0e, 0x0f, 0x0f, 0x83, 0x18, 0x17, 0x17, 0x2f, 0x28, 0x28, 0x29, 0x18,
+  0x13, 0x14, 0x13, 0x58, 0x12, 0x12, 0x12, 0x65, 0x14, 0x13, 0x13, 0x64, 0x14, 0x14, 0x14, 0x60,
+  0x1c, 0x1c, 0x1b, 0x38, 0x43, 0x43, 0x43, 0x01, 0x22, 0x22, 0x22, 0x10, 0x11, 0x12, 0x11, 0x51,
+  0x0e, 0x0f, 0x0f, 0x63, 0x11, 0x12, 0x12, 0x63, 0x12, 0x13, 0x12, 0x63, 0x24, 0x25, 0x24, 0x2f,
+  0x1a, 0x1a, 0x19, 0x40, 0x12, 0x12, 0x12, 0x61, 0x14, 0x14, 0x14, 0x64, 0x11, 0x11, 0x11, 0x63,
+  0x0f, 0x0f, 0x0f, 0x64, 0x16, 0x16, 0x15, 0x55, 0x28, 0x28, 0x28, 0x11, 0x01, 0xeb, 0x1d, 0x1e,
+  0x1e, 0x13, 0x14, 0x15, 0x14, 0x54, 0x10, 0x11, 0x10, 0x64, 0x14, 0x14, 0x14, 0x65, 0x11, 0x13,
+  0x12, 0x63, 0x18, 0x18, 0x18, 0x42, 0x29, 0x28, 0x28, 0x1b, 0x15, 0x16, 0x15, 0x53, 0x0f, 0x0f,
+  0x0f, 0x64, 0x13, 0x12, 0x12, 0x65, 0x13, 0x12, 0x12, 0x63, 0x22, 0x23, 0x22, 0x33, 0x19, 0x1a,
+  0x19, 0x3f, 0x14, 0x13, 0x13, 0x62, 0x16, 0x17, 0x16, 0x64, 0x13, 0x13, 0x13, 0x64, 0x16, 0x17,
+  0x16, 0x57, 0x25, 0x25, 0x25, 0x1d, 0x29, 0x29, 0x28, 0x1b, 0x1a, 0x1a, 0x19, 0x55, 0x15, 0x15,
+  0x15, 0x64, 0x12, 0x13, 0x12, 0x64, 0x14, 0x14, 0x14, 0x62, 0x22, 0x23, 0x22, 0x3d, 0x24, 0x24,
+  0x23, 0x1f, 0x18, 0x18, 0x18, 0x54, 0x14, 0x15, 0x15, 0x64, 0x14, 0x14, 0x14, 0x64, 0x13, 0x14,
+  0x14, 0x63, 0x10, 0x11, 0x10, 0x63, 0x12, 0x13, 0x12, 0x63, 0x11, 0x12, 0x12, 0x64, 0x12, 0x13,
+  0x13, 0x62, 0x1f, 0x20, 0x1f, 0x39, 0x22, 0x21, 0x21, 0x1f, 0x17, 0x17, 0x17, 0x55, 0x11, 0x11,
+  0x11, 0x64, 0x13, 0x13, 0x12, 0x64, 0x11, 0x11, 0x11, 0x64, 0x11, 0x12, 0x11, 0x63, 0x11, 0x11,
+  0x10, 0x64, 0x13, 0x14, 0x14, 0x5d, 0x18, 0x19, 0x18, 0x36, 0x45, 0x46, 0x46, 0x01, 0x08, 0x02,
+  0xc2, 0x69, 0x69, 0x69, 0x01, 0x0e, 0x0f, 0x0e, 0x88, 0x06, 0x07, 0x06, 0xfb, 0x86, 0x00, 0x20,
+  0xc4, 0x05, 0x06, 0x06, 0xfc, 0x10, 0x11, 0x10, 0xa4, 0x14, 0x15, 0x14, 0x53, 0x0a, 0x0a, 0x0a,
+  0xe1, 0x05, 0x06, 0x06, 0xfe, 0x83, 0x00, 0x20, 0xc0, 0x06, 0x06, 0x06, 0xfc, 0x88, 0x00, 0x20,
+  0xc3, 0x06, 0x06, 0x06, 0xfe, 0x0d, 0x0e, 0x0d, 0xac, 0x0e, 0x0f, 0x0f, 0xb7, 0x05, 0x06, 0x06,
+  0xfe, 0x84, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfe, 0x06, 0x06, 0x06, 0xfd, 0x84, 0x00, 0x20,
+  0xc1, 0x0c, 0x0c, 0x0c, 0xd5, 0x0a, 0x0b, 0x0a, 0xea, 0x8a, 0x00, 0x20, 0xc3, 0x07, 0x08, 0x07,
+  0xf1, 0x11, 0x11, 0x11, 0x5a, 0x11, 0x12, 0x11, 0x64, 0x07, 0x08, 0x07, 0xf6, 0x84, 0x00, 0x20,
+  0xc0, 0x06, 0x07, 0x07, 0xfd, 0x89, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfd, 0x06, 0x07, 0x07,
+  0xfc, 0x8e, 0x00, 0x20, 0xc0, 0x06, 0x07, 0x07, 0xfd, 0x87, 0x00, 0x20, 0xc1, 0x0b, 0x0c, 0x0b,
+  0xdb, 0x13, 0x13, 0x12, 0x5d, 0x07, 0x02, 0xc0, 0x12, 0x12, 0x12, 0x69, 0xb9, 0x00, 0x20, 0xc1,
+  0x06, 0x07, 0x07, 0xfb, 0x06, 0x07, 0x06, 0xfe, 0xac, 0x00, 0x20, 0xc1, 0x0d, 0x0d, 0x0d, 0xa8,
+  0x28, 0x26, 0x26, 0x06, 0x05, 0x02, 0xc0, 0x0f, 0x0f, 0x0f, 0xc9, 0x42, 0x00, 0x20, 0x00, 0x20,
+  0x42, 0x28, 0x83, 0x52, 0xaa, 0xc0, 0x4e, 0x4e, 0x4e, 0xfe, 0x40, 0x08, 0x61, 0x84, 0x00, 0x20,
+  0x45, 0x4a, 0x8a, 0x52, 0xaa, 0x52, 0xaa, 0x42, 0x28, 0x00, 0x20, 0x4a, 0x69, 0x87, 0x52, 0xaa,
+  0x4b, 0x21, 0x24, 0x00, 0x20, 0x00, 0x20, 0x08, 0x41, 0x7b, 0xef, 0xad, 0x35, 0xad, 0x75, 0xa5,
+  0x14, 0x5a, 0xeb, 0x00, 0x20, 0x00, 0x20, 0x21, 0x24, 0x82, 0x52, 0x8a, 0x40, 0x31, 0x86, 0x82,
+  0x00, 0x20, 0x49, 0x4a, 0x69, 0x52, 0x8a, 0x52, 0x8a, 0x39, 0xe7, 0x18, 0xe3, 0x52, 0x8a, 0x52,
+  0xaa, 0x52, 0x8a, 0x52, 0x8a, 0x39, 0xe7, 0x83, 0x00, 0x20, 0x46, 0x42, 0x08, 0x52, 0x8a, 0x52,
+  0xaa, 0x52, 0xaa, 0x42, 0x28, 0x00, 0x20, 0x31, 0x86, 0x82, 0x52, 0x8a, 0x45, 0x21, 0x04, 0x00,
+  0x20, 0x4a, 0x69, 0x52, 0xaa, 0x52, 0x8a, 0x42, 0x08, 0x82, 0x00, 0x20, 0x4f, 0x4a, 0x69, 0x52,
+  0xaa, 0x52, 0x8a, 0x31, 0x86, 0x00, 0x20, 0x42, 0x08, 0x52, 0xaa, 0x5a, 0xab, 0x5a, 0xcb, 0x52,
+  0xaa, 0x5a, 0xaa, 0x5a, 0xcb, 0x52, 0xaa, 0x42, 0x08, 0x00, 0x20, 0x39, 0xc7, 0x83, 0x52, 0xaa,
+  0x41, 0x52, 0x8a, 0x31, 0x86, 0x83, 0x00, 0x20, 0xc0, 0x0d, 0x0d, 0x0d, 0xa5, 0x05, 0x02, 0xc0,
+  0x06, 0x07, 0x07, 0xea, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x84, 0xff, 0xff, 0xc1, 0xf5,
+  0xf6, 0xf5, 0xfe, 0xcd, 0xcd, 0xcd, 0xfe, 0x49, 0x5a, 0xcb, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xf7, 0xbe, 0x87, 0xff, 0xff, 0x43,
+  0x9c, 0xf3, 0x00, 0x20, 0x63, 0x0c, 0xe7, 0x1c, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x83, 0xff, 0xff,
+  0x42, 0xc6, 0x38, 0x18, 0xc3, 0x73, 0x8e, 0x82, 0xff, 0xff, 0x48, 0xce, 0x79, 0x00, 0x20, 0x00,
+  0x20, 0x39, 0xc7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x84, 0x10, 0x83, 0xff, 0xff,
+  0x40, 0xde, 0xdb, 0x83, 0x00, 0x20, 0xc0, 0xea, 0xea, 0xea, 0xfe, 0x82, 0xff, 0xff, 0x42, 0xe7,
+  0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x48, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x5c, 0x00, 0x20, 0x00, 0x20, 0x08, 0x41, 0x82, 0xff, 0xff, 0x42, 0xbe,
+  0x18, 0x00, 0x20, 0xce, 0x79, 0x86, 0xff, 0xff, 0x42, 0xd6, 0x9a, 0x00, 0x20, 0xce, 0x59, 0x85,
+  0xff, 0xff, 0xc0, 0xe3, 0xe3, 0xe3, 0xfe, 0x40, 0x9c, 0xd3, 0x82, 0x00, 0x20, 0xc0, 0x14, 0x14,
+  0x14, 0x61, 0x04, 0x02, 0xc0, 0x06, 0x07, 0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb,
+  0x86, 0xff, 0xff, 0x43, 0xef, 0x7d, 0x52, 0x8a, 0x00, 0x20, 0x00, 0x00, 0xc0, 0xfa, 0xfa, 0xfa,
+  0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xf7, 0xbe, 0x87, 0xff, 0xff, 0x42,
+  0xa5, 0x14, 0x21, 0x24, 0xef, 0x5d, 0x86, 0xff, 0xff, 0xc0, 0xb1, 0xb1, 0xb2, 0xfe, 0x46, 0x00,
+  0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x87, 0x87,
+  0x87, 0xfe, 0x82, 0xff, 0xff, 0x41, 0x94, 0xb2, 0x84, 0x10, 0x83, 0xff, 0xff, 0x40, 0xf7, 0xbe,
+  0x82, 0x00, 0x20, 0x40, 0x42, 0x28, 0x83, 0xff, 0xff, 0x42, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96,
+  0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x00, 0xef, 0x7d, 0x82, 0xff, 0xff, 0xc0, 0x58, 0x58,
+  0x58, 0xfe, 0x41, 0x00, 0x20, 0x08, 0x41, 0x82, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20, 0xce,
+  0x79, 0x86, 0xff, 0xff, 0x42, 0xd6, 0xba, 0x00, 0x20, 0xce, 0x59, 0x87, 0xff, 0xff, 0x42, 0xad,
+  0x75, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x07, 0x08, 0x07, 0xe8, 0x2e, 0x2d, 0x2d, 0x09, 0x03, 0x02,
+  0xc0, 0x07, 0x07, 0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x87, 0xff, 0xff, 0x42,
+  0xc6, 0x18, 0x00, 0x20, 0x00, 0x00, 0xc0, 0xfa, 0xfa, 0xfa, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x3c, 0x00, 0x20, 0xf7, 0xbe, 0x87, 0xff, 0xff, 0x41, 0xa5, 0x14, 0xa5, 0x34, 0x87, 0xff,
+  0xff, 0xc0, 0xf2, 0xf2, 0xf2, 0xfe, 0x40, 0x10, 0xc3, 0xc0, 0xd1, 0xd1, 0xd0, 0xfe, 0x82, 0xff,
+  0xff, 0xc0, 0x41, 0x41, 0x41, 0xfe, 0x40, 0x00, 0x20, 0xc0, 0xb4, 0xb4, 0xb4, 0xfe, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0x39, 0xe7, 0x84, 0x10, 0x84, 0xff, 0xff, 0x43, 0x63, 0x2c, 0x00,
+  0x20, 0x00, 0x20, 0x8c, 0x51, 0x83, 0xff, 0xff, 0x42, 0xe7, 0x5c, 0x00, 0x20, 0xb5, 0x96, 0x82,
+  0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x00, 0xef, 0x7d, 0x82, 0xff, 0xff, 0x48, 0xa5, 0x14, 0x00,
+  0x20, 0x00, 0x40, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x86,
+  0xff, 0xff, 0x42, 0xd6, 0xba, 0x00, 0x20, 0xce, 0x59, 0x87, 0xff, 0xff, 0x42, 0xff, 0xdf, 0x4a,
+  0x49, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x06, 0xfe, 0x15, 0x14, 0x14, 0x5f, 0x03, 0x02, 0xc0, 0x07,
+  0x07, 0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x51,
+  0xff, 0xff, 0xef, 0x5d, 0xa5, 0x14, 0xad, 0x75, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xad, 0x75,
+  0xb5, 0xb6, 0xbd, 0xf7, 0x82, 0xff, 0xff, 0x43, 0xe7, 0x3c, 0xb5, 0x96, 0xb5, 0x96, 0x6b, 0x4d,
+  0xc0, 0xd7, 0xd6, 0xd7, 0xfe, 0x82, 0xff, 0xff, 0x42, 0xad, 0x35, 0x63, 0x0c, 0xde, 0xdb, 0x82,
+  0xff, 0xff, 0x41, 0x6b, 0x6d, 0x9c, 0xf3, 0x82, 0xff, 0xff, 0xc0, 0x8a, 0x8a, 0x8a, 0xfe, 0x46,
+  0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x84, 0x10, 0x84, 0xff,
+  0xff, 0x43, 0x9c, 0xd3, 0x00, 0x20, 0x00, 0x20, 0xb5, 0x96, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x82,
+  0xff, 0xff, 0x42, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00,
+  0x20, 0xef, 0x7d, 0x82, 0xff, 0xff, 0xc0, 0xd1, 0xd1, 0xd1, 0xfe, 0x44, 0x00, 0x20, 0x00, 0x20,
+  0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc1, 0xfe, 0x43, 0x00, 0x20, 0xce, 0x79,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x40, 0xc6, 0x18, 0xc0, 0xae, 0xae, 0xae,
+  0xfe, 0x44, 0xad, 0x75, 0xad, 0x75, 0x8c, 0x51, 0x00, 0x20, 0xce, 0x59, 0x82, 0xff, 0xff, 0x42,
+  0xad, 0x75, 0xb5, 0xb6, 0xef, 0x7d, 0x82, 0xff, 0xff, 0xc0, 0xa4, 0xa4, 0xa4, 0xfe, 0x41, 0x00,
+  0x20, 0x00, 0x20, 0xc0, 0x0d, 0x0d, 0x0d, 0xab, 0x03, 0x02, 0xc0, 0x07, 0x08, 0x07, 0xec, 0x47,
+  0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20,
+  0xc0, 0xbd, 0xbd, 0xbd, 0xfe, 0x82, 0xff, 0xff, 0x45, 0x52, 0xaa, 0x00, 0x00, 0xff, 0xdf, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x42, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0xfd, 0xfd, 0xfd, 0xfe, 0x40, 0xce, 0x79, 0x82, 0x00, 0x20, 0x41, 0xef, 0x5d, 0xff, 0xff, 0xc0,
+  0xfd, 0xfd, 0xfd, 0xfe, 0x43, 0xf7, 0x9e, 0x00, 0x20, 0x00, 0x20, 0x8c, 0x71, 0x82, 0xff, 0xff,
+  0x41, 0x94, 0x92, 0x4a, 0x6a, 0x82, 0xff, 0xff, 0x41, 0xb5, 0x96, 0x00, 0x00, 0xc0, 0xf0, 0xf0,
+  0xf0, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x20, 0x84, 0x10, 0x84, 0xff, 0xff,
+  0x43, 0xbd, 0xf7, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x82, 0xff,
+  0xff, 0x42, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20,
+  0xef, 0x7d, 0x82, 0xff, 0xff, 0x48, 0xf7, 0xbe, 0x10, 0x82, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff,
+  0xff, 0xff, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00,
+  0x20, 0xc0, 0xc9, 0xca, 0xca, 0xfe, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xe3, 0x00,
+  0x20, 0x6b, 0x6d, 0x82, 0xff, 0xff, 0x42, 0xce, 0x59, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0e, 0x0e,
+  0x0e, 0xe0, 0x03, 0x02, 0xc0, 0x07, 0x07, 0x07, 0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0x9c, 0xf3, 0x82, 0xff, 0xff, 0x41,
+  0x6b, 0x6d, 0x00, 0x00, 0xc0, 0xfa, 0xfa, 0xfa, 0xfe, 0x42, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c,
+  0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x59, 0x82, 0x00, 0x20, 0x46,
+  0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00, 0x20, 0x00, 0x20, 0x7b, 0xef, 0x82, 0xff,
+  0xff, 0x45, 0x94, 0xb2, 0x00, 0x20, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0xc0, 0x5a,
+  0x5a, 0x5a, 0xfe, 0x82, 0xff, 0xff, 0x42, 0x6b, 0x4d, 0x00, 0x20, 0x84, 0x10, 0x84, 0xff, 0xff,
+  0x43, 0xde, 0xfb, 0x00, 0x20, 0x00, 0x20, 0xef, 0x7d, 0x83, 0xff, 0xff, 0x42, 0xe7, 0x3c, 0x00,
+  0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0x83, 0xff, 0xff,
+  0x44, 0x84, 0x10, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc1, 0xc1, 0xfe,
+  0x43, 0x00, 0x20, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x40, 0x7b,
+  0xef, 0x84, 0x00, 0x20, 0x4c, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xe3, 0x00,
+  0x20, 0x00, 0x00, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0xc1,
+  0x05, 0x06, 0x06, 0xfc, 0x74, 0x75, 0x74, 0x02, 0x02, 0x02, 0xc0, 0x07, 0x07, 0x07, 0xec, 0x48,
+  0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20,
+  0x9c, 0xd3, 0x82, 0xff, 0xff, 0x45, 0x6b, 0x4d, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x59, 0x82, 0x00,
+  0x20, 0x40, 0xe7, 0x3c, 0x82, 0xff, 0xff, 0x42, 0x73, 0x8e, 0x00, 0x20, 0x39, 0xc7, 0x82, 0x9c,
+  0xd3, 0x45, 0x42, 0x28, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xc0, 0x98,
+  0x98, 0x98, 0xfe, 0x45, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00, 0x20, 0x00, 0x20, 0x84, 0x10,
+  0x84, 0xff, 0xff, 0x42, 0xf7, 0xbe, 0x10, 0x82, 0x52, 0xaa, 0x84, 0xff, 0xff, 0x42, 0xe7, 0x5c,
+  0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0x83, 0xff,
+  0xff, 0x44, 0xbd, 0xd7, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xfe, 0x41, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00, 0x20, 0x4c,
+  0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xe3, 0x00, 0x20, 0x00, 0x20, 0xef, 0x5d,
+  0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x04, 0xfe, 0x51,
+  0x53, 0x53, 0x0f, 0x02, 0x02, 0xc0, 0x06, 0x07, 0x07, 0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0xa5, 0x34, 0x82, 0xff, 0xff,
+  0x45, 0x4a, 0x49, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20,
+  0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x59, 0x82, 0x00, 0x20, 0x40, 0xce, 0x59, 0x82,
+  0xff, 0xff, 0x41, 0xe7, 0x3c, 0x31, 0xa6, 0x85, 0x00, 0x20, 0x40, 0x84, 0x30, 0x82, 0xff, 0xff,
+  0xc0, 0xd2, 0xd2, 0xd2, 0xfe, 0x45, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x00, 0x20, 0x00, 0x20,
+  0x84, 0x10, 0x85, 0xff, 0xff, 0x41, 0x63, 0x2c, 0x8c, 0x71, 0x84, 0xff, 0xff, 0x42, 0xe7, 0x3c,
+  0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0x83, 0xff,
+  0xff, 0x47, 0xe7, 0x1c, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x20,
+  0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00, 0x20, 0x4c, 0xce, 0x59, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xdf, 0x18, 0xe3, 0x00, 0x20, 0x00, 0x20, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff,
+  0xde, 0xfb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x04, 0xfe, 0x4d, 0x4d, 0x4f, 0x10, 0x02,
+  0x02, 0xc0, 0x07, 0x07, 0x07, 0xec, 0x4d, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x1c, 0x00, 0x20, 0x39, 0xc7, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0xfa, 0xfa, 0xfa, 0xfe, 0x42, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82,
+  0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x82, 0x00, 0x20, 0x40, 0x84,
+  0x10, 0x83, 0xff, 0xff, 0x41, 0xde, 0xdb, 0x39, 0xc7, 0x84, 0x00, 0x20, 0x41, 0x21, 0x04, 0xf7,
+  0xbe, 0x84, 0xff, 0xff, 0x43, 0x94, 0x92, 0x00, 0x20, 0x00, 0x20, 0x84, 0x10, 0x82, 0xff, 0xff,
+  0x43, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xc0, 0xb8, 0xb8, 0xb8, 0xfe, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5d, 0x00, 0x20, 0xb5, 0x96, 0x82,
+  0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0x84, 0xff, 0xff, 0x46, 0x4a, 0x49, 0xef,
+  0x5d, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x52, 0xad,
+  0x75, 0x8c, 0x71, 0x8c, 0x71, 0x73, 0xae, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0x21, 0x04, 0x00, 0x20, 0x21, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd6,
+  0xba, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x06, 0x06, 0x06, 0xfd, 0x69, 0x6c, 0x6c, 0x03, 0x02, 0x02,
+  0xc0, 0x07, 0x07, 0x07, 0xed, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x82, 0xff, 0xff, 0x40,
+  0xff, 0xdf, 0x83, 0xff, 0xff, 0x46, 0xa5, 0x14, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79,
+  0x83, 0x00, 0x20, 0xc0, 0xca, 0xcb, 0xcb, 0xfe, 0x83, 0xff, 0xff, 0x41, 0xe7, 0x3c, 0x52, 0xaa,
+  0x84, 0x00, 0x20, 0xc0, 0xd6, 0xd7, 0xd6, 0xfe, 0x83, 0xff, 0xff, 0x44, 0xff, 0xdf, 0x31, 0x86,
+  0x00, 0x20, 0x00, 0x20, 0x84, 0x10, 0x82, 0xff, 0xff, 0x46, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xc6, 0x18, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xc0, 0xe0, 0xe0, 0xe0, 0xfe, 0x44, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x5d, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x42, 0x84, 0x30, 0x00, 0x20,
+  0xef, 0x7d, 0x84, 0xff, 0xff, 0x46, 0x9c, 0xf3, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18,
+  0x00, 0x20, 0xce, 0x79, 0x85, 0xff, 0xff, 0x49, 0xde, 0xfb, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x21, 0x04, 0x08, 0x41, 0xad, 0x75, 0x82, 0xff, 0xff, 0x42,
+  0xc6, 0x38, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0d, 0x0d, 0x0d, 0xdc, 0x03, 0x02, 0xc0, 0x06, 0x07,
+  0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x86, 0xff, 0xff, 0x47, 0xce, 0x79, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20,
+  0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x83, 0x00, 0x20, 0x40, 0x31, 0xa6, 0xc0,
+  0xde, 0xde, 0xdf, 0xfe, 0x82, 0xff, 0xff, 0xc0, 0xfd, 0xfd, 0xfe, 0xfe, 0x41, 0xf7, 0x9e, 0x63,
+  0x2c, 0x83, 0x00, 0x20, 0x40, 0xad, 0x55, 0x83, 0xff, 0xff, 0x40, 0xde, 0xfb, 0x82, 0x00, 0x20,
+  0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x46, 0xad, 0x75, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0xf7,
+  0x9e, 0xff, 0xff, 0xde, 0xfb, 0xc0, 0xdf, 0xdf, 0xdf, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x5d, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x44, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0xdf, 0xdf, 0xdf, 0xfe, 0x41, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xd0, 0xd0,
+  0xd0, 0xfe, 0x42, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc1, 0xc1, 0xc1, 0xfe, 0x41, 0x00,
+  0x20, 0xce, 0x79, 0x85, 0xff, 0xff, 0x43, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0x82,
+  0xff, 0xff, 0x41, 0xf7, 0xbe, 0xf7, 0xbe, 0x83, 0xff, 0xff, 0x42, 0x9c, 0xd3, 0x00, 0x20, 0x00,
+  0x20, 0xc0, 0x0f, 0x10, 0x10, 0xa2, 0x03, 0x02, 0xc0, 0x06, 0x07, 0x07, 0xec, 0x42, 0x00, 0x20,
+  0x00, 0x20, 0xde, 0xfb, 0x84, 0xff, 0xff, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x48, 0xff, 0xff, 0xff,
+  0xff, 0xa5, 0x14, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82,
+  0x00, 0x20, 0x41, 0x52, 0x8a, 0xff, 0xff, 0xc0, 0xfd, 0xfd, 0xfd, 0xfe, 0x41, 0xff, 0xff, 0xce,
+  0x79, 0x84, 0x00, 0x20, 0x41, 0x31, 0xa6, 0xd6, 0x9a, 0x83, 0xff, 0xff, 0x41, 0xf7, 0x9e, 0x52,
+  0xcb, 0x82, 0x00, 0x20, 0xc0, 0x60, 0x61, 0x60, 0xfe, 0x83, 0xff, 0xff, 0x40, 0xb5, 0x96, 0x82,
+  0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x41, 0xad, 0x55, 0xe7, 0x3c, 0x83, 0xff, 0xff,
+  0xc1, 0xb9, 0xb9, 0xba, 0xfe, 0xdf, 0xdf, 0xdf, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5c,
+  0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x48, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff,
+  0xff, 0xff, 0xd6, 0x9a, 0xe7, 0x3c, 0xff, 0xff, 0xf7, 0xbe, 0xc0, 0xe5, 0xe6, 0xe5, 0xfe, 0x41,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc1, 0xc0, 0xfe, 0x41, 0x00, 0x20, 0xce, 0x79, 0x85, 0xff,
+  0xff, 0x43, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0x87, 0xff, 0xff, 0x42, 0xef, 0x5d,
+  0x21, 0x24, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x07, 0xfe, 0x16, 0x15, 0x15, 0x48, 0x03, 0x02, 0xc0,
+  0x07, 0x07, 0x07, 0xec, 0x4d, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x7d, 0xa5, 0x34, 0xad, 0x55, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x31, 0x86, 0x00,
+  0x00, 0xc0, 0xfa, 0xfa, 0xfa, 0xfe, 0x42, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20,
+  0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x85, 0x00, 0x20, 0x41, 0x08, 0x61, 0xbd,
+  0xd7, 0x83, 0xff, 0xff, 0x40, 0xde, 0xdb, 0x83, 0x00, 0x20, 0x40, 0xef, 0x5d, 0x82, 0xff, 0xff,
+  0x40, 0x6b, 0x6d, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x41, 0xad, 0x55, 0xce,
+  0x79, 0x83, 0xff, 0xff, 0xc0, 0x8f, 0x8f, 0x8f, 0xfe, 0x45, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x46, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0xbd, 0xf7, 0x84, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20,
+  0xce, 0x79, 0x82, 0xff, 0xff, 0x46, 0xbd, 0xf7, 0xa5, 0x34, 0xa5, 0x34, 0x8c, 0x51, 0x00, 0x20,
+  0x00, 0x20, 0xce, 0x59, 0x86, 0xff, 0xff, 0x43, 0xe7, 0x3c, 0x63, 0x0c, 0x00, 0x20, 0x00, 0x20,
+  0xc1, 0x0b, 0x0b, 0x0b, 0xc2, 0x53, 0x56, 0x56, 0x01, 0x03, 0x02, 0xc0, 0x07, 0x07, 0x07, 0xec,
+  0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00,
+  0x20, 0x84, 0x50, 0x82, 0xff, 0xff, 0x45, 0x8c, 0x51, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x87,
+  0x00, 0x20, 0x40, 0xa5, 0x14, 0x83, 0xff, 0xff, 0x40, 0x7b, 0xcf, 0x82, 0x00, 0x20, 0x40, 0xde,
+  0xdb, 0x82, 0xff, 0xff, 0x40, 0x21, 0x04, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff,
+  0x41, 0xad, 0x55, 0xad, 0x55, 0x83, 0xff, 0xff, 0x46, 0x42, 0x28, 0xde, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x3d, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x46, 0x84, 0x30, 0x00, 0x20, 0xef,
+  0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x84, 0x10, 0x84, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00,
+  0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00, 0x20, 0x40, 0xce, 0x59, 0x82,
+  0xff, 0xff, 0x46, 0xe7, 0x1c, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xdb, 0x00, 0x20, 0x00,
+  0x20, 0xc1, 0x08, 0x09, 0x08, 0xf3, 0x15, 0x16, 0x15, 0x1e, 0x04, 0x02, 0xc0, 0x07, 0x07, 0x07,
+  0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20,
+  0x00, 0x20, 0x4a, 0x69, 0x82, 0xff, 0xff, 0x45, 0xad, 0x55, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x4a, 0xce, 0x79,
+  0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0xad, 0x75, 0xb5, 0x96, 0xb5, 0x96, 0x6b, 0x4d, 0x00, 0x20,
+  0x00, 0x20, 0xd6, 0x9a, 0x82, 0xff, 0xff, 0x40, 0xbd, 0xd7, 0x82, 0x00, 0x20, 0x40, 0xde, 0xdb,
+  0x82, 0xff, 0xff, 0x40, 0x21, 0x04, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x41,
+  0xad, 0x55, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x47, 0xe7, 0x3c, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x3d, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x47, 0x84, 0x30, 0x00, 0x20,
+  0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x19, 0x04, 0xf7, 0xbe, 0x83, 0xff, 0xff, 0x42,
+  0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00, 0x20, 0x4a,
+  0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x21, 0x04, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xdf, 0x4a, 0x69, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfe, 0x18, 0x19, 0x18, 0x3f, 0x04,
+  0x02, 0xc0, 0x06, 0x07, 0x07, 0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0x4a, 0x49, 0x82, 0xff, 0xff, 0x45, 0xad, 0x75, 0x00,
+  0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82,
+  0xff, 0xff, 0x43, 0xce, 0x79, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x82, 0xff, 0xff, 0x43, 0x9c,
+  0xf3, 0x00, 0x20, 0x00, 0x20, 0xa5, 0x14, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x82, 0x00, 0x20,
+  0x40, 0xde, 0xdb, 0x82, 0xff, 0xff, 0x40, 0x21, 0x04, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82,
+  0xff, 0xff, 0x41, 0xad, 0x55, 0x31, 0xc6, 0x82, 0xff, 0xff, 0x47, 0xce, 0x59, 0x00, 0x20, 0xde,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x47, 0x84,
+  0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0xd6, 0x9a, 0x83,
+  0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff, 0x40, 0x7b, 0xef, 0x84,
+  0x00, 0x20, 0x45, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x21, 0x04, 0x8c, 0x71, 0x82,
+  0xff, 0xff, 0x42, 0xad, 0x55, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0d, 0x0d, 0x0c, 0xab, 0x04, 0x02,
+  0xc0, 0x06, 0x07, 0x07, 0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0x6b, 0x6d, 0x82, 0xff, 0xff, 0x45, 0xad, 0x75, 0x00, 0x00,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff,
+  0xff, 0x4a, 0xce, 0x79, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+  0xa5, 0x34, 0x00, 0x20, 0x00, 0x20, 0xa5, 0x14, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x82, 0x00,
+  0x20, 0x40, 0xd6, 0xdb, 0x82, 0xff, 0xff, 0x40, 0x21, 0x04, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10,
+  0x82, 0xff, 0xff, 0x4c, 0xad, 0x55, 0x00, 0x20, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3,
+  0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff,
+  0xff, 0x46, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20,
+  0xc0, 0xa2, 0xa2, 0xa2, 0xfe, 0x83, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x82,
+  0xff, 0xff, 0x40, 0x7b, 0xef, 0x84, 0x00, 0x20, 0x4b, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xdf, 0x21, 0x04, 0x31, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00,
+  0x20, 0xc1, 0x07, 0x08, 0x07, 0xf8, 0x20, 0x20, 0x1e, 0x15, 0x03, 0x02, 0xc0, 0x06, 0x07, 0x07,
+  0xec, 0x48, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x10, 0xa3,
+  0x4a, 0x6a, 0xce, 0x79, 0x82, 0xff, 0xff, 0x45, 0x9c, 0xf3, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79,
+  0x82, 0x00, 0x20, 0x46, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x39, 0xe7, 0x29, 0x45,
+  0xd6, 0xba, 0x82, 0xff, 0xff, 0x40, 0xbd, 0xf7, 0x82, 0x00, 0x20, 0x40, 0xde, 0xdb, 0x82, 0xff,
+  0xff, 0x40, 0x21, 0x04, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x46, 0xad, 0x55,
+  0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xeb, 0x00, 0x20, 0xc0, 0xdf, 0xdf, 0xdf,
+  0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5d, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x47,
+  0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x52, 0xaa,
+  0x83, 0xff, 0xff, 0xc0, 0xc0, 0xc1, 0xc1, 0xfe, 0x41, 0x00, 0x20, 0xce, 0x79, 0x82, 0xff, 0xff,
+  0x40, 0xbd, 0xf7, 0x82, 0xa5, 0x34, 0x48, 0x7b, 0xef, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0x21, 0x04, 0x00, 0x20, 0xde, 0xdb, 0x82, 0xff, 0xff, 0xc0, 0x57, 0x58, 0x57,
+  0xfe, 0x40, 0x00, 0x20, 0xc1, 0x06, 0x06, 0x06, 0xfe, 0x11, 0x12, 0x12, 0x68, 0x03, 0x02, 0xc0,
+  0x07, 0x08, 0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x88, 0xff, 0xff, 0x45, 0x5a,
+  0xeb, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52,
+  0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x82, 0x00, 0x20, 0x40, 0xce, 0x79, 0x82, 0xff, 0xff,
+  0x41, 0xff, 0xdf, 0xff, 0xdf, 0x83, 0xff, 0xff, 0x40, 0x8c, 0x51, 0x82, 0x00, 0x20, 0x40, 0xde,
+  0xdb, 0x82, 0xff, 0xff, 0x40, 0x21, 0x24, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff,
+  0x41, 0xad, 0x55, 0x00, 0x20, 0xc0, 0x95, 0x95, 0x96, 0xfe, 0x40, 0xe7, 0x1c, 0xc0, 0xd5, 0xd5,
+  0xd5, 0xfe, 0x47, 0x00, 0x00, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00,
+  0x20, 0xb5, 0x96, 0x82, 0xff, 0xff, 0x48, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff,
+  0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xe7, 0x3c, 0x82, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00,
+  0x20, 0xce, 0x79, 0x86, 0xff, 0xff, 0x42, 0xd6, 0xba, 0x00, 0x20, 0xce, 0x59, 0x82, 0xff, 0xff,
+  0x41, 0x21, 0x24, 0x00, 0x20, 0xc0, 0xae, 0xae, 0xaf, 0xfe, 0x82, 0xff, 0xff, 0xc0, 0xae, 0xae,
+  0xad, 0xfe, 0x41, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0c, 0x0d, 0x0d, 0xb2, 0x03, 0x02, 0xc0, 0x07,
+  0x08, 0x07, 0xec, 0x42, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0x87, 0xff, 0xff, 0x46, 0xd6, 0x9a,
+  0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40,
+  0x52, 0x8a, 0x82, 0xff, 0xff, 0x40, 0xce, 0x79, 0x82, 0x00, 0x20, 0x41, 0x73, 0xae, 0xff, 0xdf,
+  0x86, 0xff, 0xff, 0x41, 0xde, 0xfc, 0x08, 0x82, 0x82, 0x00, 0x20, 0x40, 0xde, 0xdb, 0x82, 0xff,
+  0xff, 0x40, 0x21, 0x24, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x40, 0xad, 0x55,
+  0x85, 0x00, 0x20, 0x45, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96,
+  0x82, 0xff, 0xff, 0x48, 0x84, 0x30, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a,
+  0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0x82, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79,
+  0x86, 0xff, 0xff, 0x42, 0xd6, 0xba, 0x00, 0x20, 0xce, 0x59, 0x82, 0xff, 0xff, 0x42, 0x21, 0x24,
+  0x00, 0x20, 0x6b, 0x6d, 0x82, 0xff, 0xff, 0x42, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x09,
+  0x0a, 0x09, 0xf0, 0x7c, 0x7f, 0x7f, 0x01, 0x02, 0x02, 0xc0, 0x07, 0x08, 0x08, 0xea, 0x42, 0x00,
+  0x20, 0x00, 0x20, 0xde, 0xfb, 0x86, 0xff, 0xff, 0x47, 0xce, 0x79, 0x31, 0xa6, 0x00, 0x20, 0x00,
+  0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x82, 0x00, 0x20, 0x40, 0x52, 0x8a, 0x82,
+  0xff, 0xff, 0x40, 0xce, 0x59, 0x83, 0x00, 0x20, 0x41, 0xad, 0x55, 0xff, 0xdf, 0x84, 0xff, 0xff,
+  0x41, 0xe7, 0x3c, 0x5a, 0xeb, 0x83, 0x00, 0x20, 0x40, 0xd6, 0xdb, 0x82, 0xff, 0xff, 0x40, 0x21,
+  0x24, 0x82, 0x00, 0x20, 0x40, 0x84, 0x10, 0x82, 0xff, 0xff, 0x40, 0xad, 0x55, 0x85, 0x00, 0x20,
+  0x45, 0xdf, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xb5, 0x96, 0x82, 0xff, 0xff,
+  0x48, 0x84, 0x10, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00,
+  0x20, 0x84, 0x30, 0x82, 0xff, 0xff, 0x42, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x79, 0x86, 0xff, 0xff,
+  0x42, 0xd6, 0xba, 0x00, 0x20, 0xce, 0x59, 0x82, 0xff, 0xff, 0x43, 0x21, 0x04, 0x00, 0x20, 0x00,
+  0x00, 0xef, 0x7d, 0x82, 0xff, 0xff, 0x41, 0x63, 0x0c, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x05, 0xfe,
+  0x22, 0x23, 0x23, 0x1e, 0x02, 0x02, 0xc0, 0x0e, 0x0f, 0x0f, 0xd0, 0x42, 0x00, 0x20, 0x00, 0x20,
+  0x7b, 0xcf, 0x82, 0x8c, 0x71, 0x43, 0x94, 0x92, 0x8c, 0x91, 0x8c, 0x51, 0x52, 0xaa, 0x83, 0x00,
+  0x20, 0x43, 0x8c, 0x51, 0x8c, 0x71, 0x94, 0x92, 0x7b, 0xef, 0x82, 0x00, 0x20, 0x44, 0x21, 0x04,
+  0x8c, 0x71, 0x8c, 0x71, 0x94, 0x92, 0x6b, 0x6d, 0x84, 0x00, 0x20, 0x46, 0x63, 0x0c, 0xbd, 0xd7,
+  0xce, 0x79, 0xd6, 0x9a, 0xc6, 0x38, 0x9c, 0xd3, 0x10, 0xa2, 0x84, 0x00, 0x20, 0x43, 0x73, 0xae,
+  0x94, 0x92, 0x94, 0x92, 0x8c, 0x71, 0x83, 0x00, 0x20, 0x46, 0x42, 0x28, 0x8c, 0x71, 0x8c, 0x71,
+  0x94, 0x92, 0x5a, 0xcb, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x06, 0x07, 0x07, 0xfe, 0x82, 0x00, 0x20,
+  0x58, 0x7b, 0xcf, 0x94, 0x92, 0x94, 0x92, 0x7b, 0xef, 0x00, 0x20, 0x63, 0x0c, 0x94, 0x92, 0x8c,
+  0x92, 0x8c, 0x92, 0x39, 0xe7, 0x00, 0x20, 0x84, 0x30, 0x8c, 0x71, 0x94, 0x92, 0x73, 0x8e, 0x00,
+  0x20, 0x00, 0x20, 0x08, 0x41, 0x8c, 0x71, 0x94, 0x92, 0x94, 0x92, 0x63, 0x2c, 0x00, 0x20, 0x73,
+  0x8e, 0x8c, 0x91, 0x84, 0x8c, 0x71, 0x43, 0x8c, 0x91, 0x73, 0x8e, 0x00, 0x20, 0x6b, 0x6d, 0x82,
+  0x8c, 0x71, 0x48, 0x00, 0x41, 0x00, 0x20, 0x00, 0x20, 0x73, 0xae, 0x8c, 0x71, 0x8c, 0x71, 0x94,
+  0x92, 0x42, 0x28, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x05, 0xfe, 0x29, 0x29, 0x29, 0x17, 0x02, 0x02,
+  0xc0, 0x0d, 0x0d, 0x0c, 0x89, 0xa6, 0x00, 0x20, 0xc1, 0x05, 0x07, 0x06, 0xfe, 0x0b, 0x0c, 0x0c,
+  0xd0, 0x90, 0x00, 0x20, 0xc1, 0x0c, 0x0c, 0x0c, 0x9e, 0x09, 0x09, 0x09, 0xce, 0xaf, 0x00, 0x20,
+  0xc0, 0x0d, 0x0e, 0x0e, 0xca, 0x03, 0x02, 0xc2, 0x21, 0x22, 0x21, 0x0c, 0x09, 0x09, 0x09, 0xc7,
+  0x05, 0x06, 0x06, 0xfe, 0x87, 0x00, 0x20, 0xc2, 0x06, 0x06, 0x06, 0xfe, 0x0b, 0x0b, 0x0b, 0xc3,
+  0x06, 0x07, 0x07, 0xf5, 0x85, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x07, 0xfc, 0x07, 0x08, 0x07, 0xfc,
+  0x85, 0x00, 0x20, 0xc3, 0x08, 0x09, 0x09, 0xeb, 0x15, 0x14, 0x14, 0x46, 0x0f, 0x0f, 0x0f, 0x8d,
+  0x07, 0x08, 0x08, 0xfb, 0x86, 0x00, 0x20, 0xc4, 0x06, 0x07, 0x07, 0xee, 0x10, 0x10, 0x0f, 0x59,
+  0x26, 0x25, 0x24, 0x0c, 0x0b, 0x0c, 0x0c, 0xc1, 0x06, 0x07, 0x07, 0xfe, 0x85, 0x00, 0x20, 0xc1,
+  0x09, 0x0a, 0x09, 0xde, 0x06, 0x07, 0x07, 0xfa, 0x85, 0x00, 0x20, 0xc4, 0x0c, 0x0c, 0x0b, 0xc8,
+  0x23, 0x23, 0x23, 0x0f, 0x17, 0x17, 0x16, 0x25, 0x09, 0x0a, 0x09, 0xe4, 0x06, 0x07, 0x07, 0xfe,
+  0x8f, 0x00, 0x20, 0xc0, 0x05, 0x06, 0x06, 0xfe, 0x9b, 0x00, 0x20, 0xc1, 0x08, 0x08, 0x08, 0xe7,
+  0x17, 0x17, 0x16, 0x2e, 0x03, 0x03, 0xca, 0x3c, 0x3c, 0x3c, 0x04, 0x13, 0x14, 0x14, 0x50, 0x0f,
+  0x10, 0x0f, 0x8a, 0x08, 0x09, 0x09, 0x98, 0x07, 0x08, 0x08, 0x98, 0x08, 0x0a, 0x0a, 0x99, 0x08,
+  0x09, 0x09, 0x99, 0x0a, 0x0b, 0x0b, 0x99, 0x08, 0x09, 0x08, 0x98, 0x11, 0x11, 0x11, 0x87, 0x18,
+  0x19, 0x18, 0x43, 0x00, 0xcf, 0x1b, 0x1b, 0x1a, 0x20, 0x13, 0x13, 0x13, 0x7a, 0x09, 0x0a, 0x09,
+  0x98, 0x0a, 0x0b, 0x0a, 0x99, 0x08, 0x09, 0x09, 0x98, 0x08, 0x09, 0x08, 0x98, 0x11, 0x12, 0x11,
+  0x80, 0x18, 0x18, 0x19, 0x32, 0x1d, 0x1d, 0x1c, 0x29, 0x11, 0x12, 0x11, 0x7f, 0x09, 0x0a, 0x0a,
+  0x98, 0x0a, 0x0b, 0x0b, 0x98, 0x07, 0x08, 0x08, 0x97, 0x10, 0x10, 0x0f, 0x94, 0x12, 0x13, 0x12,
+  0x68, 0x1f, 0x20, 0x20, 0x10, 0x01, 0xc8, 0x1e, 0x1f, 0x1f, 0x2b, 0x10, 0x11, 0x11, 0x8e, 0x0c,
+  0x0d, 0x0d, 0xc8, 0x09, 0x0a, 0x0a, 0xf1, 0x09, 0x0a, 0x09, 0xf7, 0x0c, 0x0d, 0x0c, 0xec, 0x0d,
+  0x0e, 0x0e, 0xb7, 0x11, 0x11, 0x11, 0x71, 0x1c, 0x1c, 0x1d, 0x13, 0x01, 0xd0, 0x48, 0x48, 0x48,
+  0x02, 0x15, 0x15, 0x15, 0x53, 0x0f, 0x10, 0x0f, 0x91, 0x0c, 0x0d, 0x0d, 0x99, 0x0c, 0x0c, 0x0c,
+  0x99, 0x0b, 0x0b, 0x0b, 0x99, 0x0d, 0x0d, 0x0d, 0x94, 0x11, 0x11, 0x11, 0x63, 0x29, 0x28, 0x28,
+  0x09, 0x1c, 0x1e, 0x1e, 0x28, 0x11, 0x12, 0x11, 0x7e, 0x0b, 0x0c, 0x0c, 0x99, 0x0c, 0x0d, 0x0c,
+  0x99, 0x09, 0x09, 0x0a, 0x98, 0x0b, 0x0c, 0x0c, 0x94, 0x11, 0x12, 0x12, 0x60, 0x1f, 0x22, 0x22,
+  0x07, 0x01, 0xef, 0x1d, 0x1e, 0x1d, 0x10, 0x14, 0x14, 0x14, 0x69, 0x0d, 0x0e, 0x0e, 0x96, 0x0a,
+  0x0b, 0x0b, 0x97, 0x09, 0x0b, 0x0a, 0x97, 0x11, 0x11, 0x10, 0x84, 0x14, 0x15, 0x14, 0x61, 0x0f,
+  0x10, 0x0f, 0x8c, 0x0b, 0x0c, 0x0c, 0x98, 0x0e, 0x0f, 0x0f, 0x99, 0x0c, 0x0d, 0x0d, 0x99, 0x0d,
+  0x0d, 0x0d, 0x8a, 0x12, 0x13, 0x12, 0x70, 0x0d, 0x0e, 0x0e, 0x97, 0x0e, 0x0f, 0x0f, 0x9a, 0x0c,
+  0x0d, 0x0c, 0x99, 0x0a, 0x0a, 0x0a, 0x97, 0x11, 0x12, 0x11, 0x73, 0x30, 0x2f, 0x2f, 0x1f, 0x12,
+  0x13, 0x12, 0x54, 0x0f, 0x10, 0x0f, 0x90, 0x09, 0x0a, 0x0a, 0x97, 0x09, 0x0a, 0x0a, 0x98, 0x0f,
+  0x0f, 0x0e, 0x8e, 0x14, 0x14, 0x13, 0x50, 0x10, 0x10, 0x10, 0x69, 0x0f, 0x10, 0x0f, 0x92, 0x09,
+  0x0a, 0x0a, 0x98, 0x0b, 0x0c, 0x0c, 0x99, 0x0c, 0x0d, 0x0c, 0x98, 0x0d, 0x0e, 0x0d, 0x99, 0x0a,
+  0x0c, 0x0b, 0x99, 0x08, 0x09, 0x08, 0x98, 0x0f, 0x10, 0x0f, 0x76, 0x19, 0x19, 0x1a, 0x5f, 0x0e,
+  0x0f, 0x0e, 0x8e, 0x0b, 0x0c, 0x0b, 0x99, 0x09, 0x0a, 0x0a, 0x98, 0x08, 0x09, 0x09, 0x98, 0x09,
+  0x0a, 0x0a, 0x97, 0x15, 0x15, 0x15, 0x72, 0x11, 0x12, 0x12, 0x64, 0x0f, 0x0f, 0x0f, 0x90, 0x0b,
+  0x0c, 0x0c, 0x99, 0x09, 0x0a, 0x0a, 0x98, 0x0a, 0x0b, 0x0a, 0x96, 0x12, 0x12, 0x12, 0x6b, 0x1a,
+  0x1a, 0x1b, 0x13, 0x04, 0x25, 0xc0, 0x7f, 0x80, 0x7e, 0x01, 0x3f, 0x0d, 0x3f, 0x34, 0x05, 0xc7,
+  0x7c, 0x7c, 0x7c, 0x01, 0x1b, 0x1b, 0x1b, 0x39, 0x11, 0x12, 0x11, 0x79, 0x0f, 0x10, 0x0f, 0x98,
+  0x10, 0x10, 0x10, 0x9d, 0x11, 0x12, 0x11, 0x91, 0x15, 0x15, 0x15, 0x5f, 0x1f, 0x1f, 0x1f, 0x10,
+  0x00, 0xc8, 0x41, 0x42, 0x41, 0x02, 0x1c, 0x1c, 0x1c, 0x32, 0x0f, 0x0f, 0x0f, 0x51, 0x12, 0x12,
+  0x12, 0x52, 0x13, 0x13, 0x13, 0x52, 0x13, 0x13, 0x13, 0x52, 0x10, 0x11, 0x11, 0x51, 0x16, 0x16,
+  0x16, 0x4d, 0x24, 0x24, 0x24, 0x21, 0x01, 0xd4, 0x23, 0x24, 0x23, 0x11, 0x1c, 0x1c, 0x1b, 0x45,
+  0x15, 0x15, 0x14, 0x51, 0x15, 0x15, 0x14, 0x51, 0x14, 0x14, 0x14, 0x51, 0x14, 0x14, 0x14, 0x52,
+  0x12, 0x12, 0x11, 0x51, 0x17, 0x18, 0x17, 0x4a, 0x26, 0x26, 0x26, 0x14, 0x26, 0x26, 0x26, 0x22,
+  0x14, 0x15, 0x14, 0x4e, 0x16, 0x17, 0x16, 0x52, 0x17, 0x17, 0x17, 0x53, 0x1b, 0x1b, 0x1b, 0x47,
+  0x28, 0x29, 0x29, 0x11, 0x21, 0x21, 0x20, 0x1b, 0x15, 0x15, 0x15, 0x4c, 0x13, 0x13, 0x13, 0x53,
+  0x12, 0x11, 0x12, 0x50, 0x1e, 0x1f, 0x1e, 0x31, 0x42, 0x42, 0x40, 0x02, 0x04, 0xc7, 0x38, 0x3a,
+  0x39, 0x02, 0x14, 0x14, 0x14, 0x41, 0x0c, 0x0d, 0x0d, 0x80, 0x10, 0x10, 0x10, 0x99, 0x0f, 0x0f,
+  0x0e, 0x9b, 0x14, 0x14, 0x14, 0x87, 0x17, 0x17, 0x17, 0x4d, 0x32, 0x32, 0x30, 0x07, 0x02, 0xc6,
+  0x28, 0x25, 0x26, 0x04, 0x16, 0x16, 0x16, 0x47, 0x16, 0x16, 0x16, 0x77, 0x10, 0x10, 0x10, 0x92,
+  0x0d, 0x0e, 0x0d, 0x90, 0x15, 0x15, 0x15, 0x6b, 0x1c, 0x1c, 0x1c, 0x2a, 0x01, 0xd3, 0x20, 0x21,
+  0x20, 0x2c, 0x11, 0x12, 0x11, 0x51, 0x15, 0x15, 0x14, 0x52, 0x16, 0x17, 0x16, 0x52, 0x17, 0x18,
+  0x17, 0x4d, 0x2d, 0x2d, 0x2c, 0x1b, 0x28, 0x28, 0x28, 0x27, 0x12, 0x13, 0x12, 0x50, 0x15, 0x15,
+  0x15, 0x53, 0x12, 0x12, 0x11, 0x52, 0x20, 0x21, 0x20, 0x34, 0x38, 0x37, 0x37, 0x0b, 0x1a, 0x1b,
+  0x19, 0x41, 0x13, 0x13, 0x13, 0x51, 0x15, 0x15, 0x14, 0x51, 0x15, 0x15, 0x14, 0x51, 0x16, 0x16,
+  0x15, 0x51, 0x14, 0x14, 0x13, 0x4f, 0x24, 0x24, 0x23, 0x31, 0x36, 0x37, 0x35, 0x03, 0x02, 0xc6,
+  0x34, 0x36, 0x35, 0x08, 0x12, 0x13, 0x12, 0x4d, 0x12, 0x13, 0x13, 0x80, 0x0c, 0x0d, 0x0c, 0x92,
+  0x0a, 0x0b, 0x0a, 0x8c, 0x14, 0x14, 0x14, 0x62, 0x24, 0x24, 0x23, 0x1b, 0x01, 0xc7, 0x23, 0x23,
+  0x22, 0x24, 0x16, 0x17, 0x16, 0x4d, 0x13, 0x14, 0x13, 0x52, 0x12, 0x12, 0x12, 0x51, 0x13, 0x14,
+  0x14, 0x52, 0x13, 0x13, 0x13, 0x51, 0x18, 0x18, 0x17, 0x4c, 0x21, 0x21, 0x21, 0x21, 0x04, 0x04,
+  0xc1, 0x1c, 0x1c, 0x1c, 0x33, 0x0b, 0x0c, 0x0c, 0xcb, 0x85, 0x00, 0x20, 0xc2, 0x07, 0x08, 0x08,
+  0xf3, 0x11, 0x12, 0x11, 0x88, 0x0d, 0x0e, 0x0e, 0xd4, 0x87, 0x00, 0x20, 0xc2, 0x0c, 0x0c, 0x0c,
+  0xc5, 0x12, 0x12, 0x11, 0x9d, 0x08, 0x09, 0x09, 0xfb, 0x86, 0x00, 0x20, 0xc0, 0x05, 0x06, 0x06,
+  0xfe, 0x84, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x07, 0xfd, 0x05, 0x06, 0x06, 0xfe, 0x83, 0x00, 0x20,
+  0xc1, 0x0d, 0x0d, 0x0d, 0xd8, 0x14, 0x14, 0x14, 0x39, 0x02, 0xc1, 0x18, 0x18, 0x18, 0x3c, 0x0a,
+  0x0a, 0x0a, 0xd3, 0x85, 0x00, 0x20, 0xc1, 0x0a, 0x0b, 0x0a, 0xe7, 0x14, 0x14, 0x14, 0x59, 0x00,
+  0xc1, 0x11, 0x11, 0x11, 0x5b, 0x0a, 0x0a, 0x0a, 0xe1, 0x84, 0x00, 0x20, 0xc2, 0x05, 0x06, 0x06,
+  0xfe, 0x10, 0x10, 0x10, 0xb5, 0x0e, 0x0e, 0x0d, 0xc7, 0x84, 0x00, 0x20, 0xc0, 0x05, 0x06, 0x06,
+  0xfe, 0x84, 0x00, 0x20, 0xc0, 0x06, 0x07, 0x06, 0xfd, 0x86, 0x00, 0x20, 0xc4, 0x08, 0x09, 0x09,
+  0xe9, 0x0e, 0x0e, 0x0d, 0x7c, 0x21, 0x21, 0x21, 0x07, 0x14, 0x15, 0x15, 0x67, 0x08, 0x09, 0x08,
+  0xea, 0x84, 0x00, 0x20, 0xc3, 0x07, 0x08, 0x08, 0xfb, 0x0e, 0x0f, 0x0e, 0xa0, 0x0b, 0x0b, 0x0b,
+  0xc3, 0x06, 0x07, 0x07, 0xfe, 0x85, 0x00, 0x20, 0xc2, 0x05, 0x06, 0x06, 0xfe, 0x0c, 0x0c, 0x0c,
+  0xbd, 0x17, 0x17, 0x16, 0x21, 0x02, 0x03, 0xc1, 0x14, 0x14, 0x14, 0x46, 0x07, 0x08, 0x08, 0xf6,
+  0xa8, 0x00, 0x20, 0xc1, 0x08, 0x08, 0x08, 0xf0, 0x18, 0x18, 0x17, 0x1f, 0x00, 0xc1, 0x11, 0x11,
+  0x11, 0x4f, 0x06, 0x07, 0x07, 0xfa, 0x87, 0x00, 0x20, 0xc2, 0x06, 0x06, 0x07, 0xfe, 0x10, 0x11,
+  0x11, 0xc5, 0x06, 0x07, 0x07, 0xfe, 0x9d, 0x00, 0x20, 0xc0, 0x0b, 0x0c, 0x0c, 0xe4, 0x92, 0x00,
+  0x20, 0xc1, 0x07, 0x08, 0x07, 0xe5, 0x1a, 0x1a, 0x1a, 0x15, 0x01, 0x02, 0xc1, 0x1c, 0x1d, 0x1c,
+  0x1d, 0x07, 0x07, 0x08, 0xf0, 0x47, 0x00, 0x20, 0x00, 0x20, 0x19, 0x04, 0x94, 0xb2, 0xbd, 0xf8,
+  0xce, 0x59, 0xb5, 0xb6, 0x73, 0xae, 0x82, 0x00, 0x20, 0x46, 0x18, 0xe3, 0x73, 0x8e, 0x73, 0xae,
+  0x73, 0xae, 0x73, 0x8e, 0x6b, 0x6d, 0x4a, 0x69, 0x83, 0x00, 0x20, 0x40, 0x5a, 0xeb, 0x83, 0x73,
+  0x8e, 0x4e, 0x73, 0xae, 0x73, 0x8e, 0x5a, 0xeb, 0x00, 0x20, 0x5a, 0xcb, 0x73, 0x8e, 0x73, 0xae,
+  0x52, 0xaa, 0x00, 0x20, 0x00, 0x20, 0x4a, 0x69, 0x73, 0x8e, 0x73, 0x8e, 0x63, 0x0c, 0x00, 0x20,
+  0xc3, 0x06, 0x07, 0x07, 0xfe, 0x0e, 0x0e, 0x0e, 0x86, 0x19, 0x19, 0x18, 0x1f, 0x06, 0x07, 0x07,
+  0xf2, 0x47, 0x00, 0x20, 0x00, 0x20, 0x42, 0x08, 0xa5, 0x34, 0xc6, 0x38, 0xc6, 0x38, 0xa5, 0x34,
+  0x52, 0x8a, 0x84, 0x00, 0x20, 0x45, 0x5a, 0xcb, 0xad, 0x55, 0xc6, 0x39, 0xc6, 0x18, 0xa5, 0x14,
+  0x42, 0x08, 0x82, 0x00, 0x20, 0x4b, 0x52, 0x8a, 0x73, 0x8e, 0x73, 0x8e, 0x5a, 0xcb, 0x00, 0x20,
+  0x00, 0x20, 0x52, 0xaa, 0x73, 0x8e, 0x73, 0x8e, 0x52, 0xaa, 0x00, 0x20, 0x6b, 0x4d, 0x83, 0x73,
+  0xae, 0x41, 0x63, 0x2c, 0x08, 0x82, 0x84, 0x00, 0x20, 0x51, 0x4a, 0x69, 0xad, 0x35, 0xc6, 0x38,
+  0xc6, 0x18, 0x9c, 0xf3, 0x29, 0x65, 0x00, 0x20, 0x00, 0x20, 0x31, 0x86, 0x73, 0x8e, 0x73, 0xae,
+  0x73, 0xae, 0x73, 0x8e, 0x73, 0xae, 0x73, 0xae, 0x63, 0x0c, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0f,
+  0x0f, 0x0f, 0x85, 0x01, 0x02, 0xc0, 0x0e, 0x0f, 0x0e, 0x99, 0x43, 0x00, 0x20, 0x00, 0x20, 0x4a,
+  0x49, 0xe7, 0x1c, 0x84, 0xff, 0xff, 0x43, 0xc6, 0x18, 0x00, 0x41, 0x00, 0x20, 0x7b, 0xcf, 0x85,
+  0xff, 0xff, 0x44, 0xe7, 0x1c, 0x73, 0x8e, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff, 0xff,
+  0x4d, 0xde, 0xfb, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00,
+  0x20, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x0d, 0x0d,
+  0x0d, 0xb6, 0x0a, 0x0b, 0x0b, 0xa4, 0x43, 0x00, 0x20, 0x00, 0x20, 0x7b, 0xaf, 0xf7, 0x9e, 0x83,
+  0xff, 0xff, 0x41, 0xf7, 0xbe, 0x84, 0x10, 0x82, 0x00, 0x20, 0x41, 0x9c, 0xf3, 0xff, 0xdf, 0x83,
+  0xff, 0xff, 0x4f, 0xf7, 0x9e, 0x73, 0xae, 0x00, 0x20, 0x00, 0x20, 0xc6, 0x18, 0xff, 0xff, 0xff,
+  0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00,
+  0x20, 0xf7, 0x9e, 0x84, 0xff, 0xff, 0x40, 0xf7, 0x9e, 0xc0, 0xaa, 0xa9, 0xaa, 0xfe, 0x44, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x8c, 0x51, 0xf7, 0xbe, 0x83, 0xff, 0xff, 0x43, 0xef, 0x5d, 0x4a,
+  0x69, 0x00, 0x20, 0xa5, 0x14, 0x85, 0xff, 0xff, 0x42, 0xe7, 0x3c, 0x00, 0x20, 0x00, 0x20, 0xc0,
+  0x08, 0x08, 0x09, 0xc2, 0x01, 0x01, 0xc1, 0x2a, 0x2b, 0x2a, 0x09, 0x09, 0x09, 0x09, 0xf3, 0x42,
+  0x00, 0x20, 0x00, 0x20, 0xce, 0x79, 0x86, 0xff, 0xff, 0x42, 0x9c, 0xd3, 0x00, 0x20, 0x7b, 0xcf,
+  0x86, 0xff, 0xff, 0x43, 0xf7, 0x9e, 0x4a, 0x69, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff, 0xff, 0x4d,
+  0xe7, 0x1c, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x31, 0x86, 0x00, 0x20,
+  0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x08, 0x09, 0x09,
+  0xe4, 0x06, 0x07, 0x07, 0xf9, 0x42, 0x00, 0x20, 0x31, 0x86, 0xef, 0x7d, 0x85, 0xff, 0xff, 0x44,
+  0xf7, 0x9e, 0x29, 0x45, 0x00, 0x20, 0x6b, 0x4d, 0xff, 0xdf, 0x85, 0xff, 0xff, 0x4e, 0xef, 0x5d,
+  0x18, 0xc3, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20,
+  0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0x86, 0xff, 0xff, 0xc0,
+  0x9d, 0x9d, 0x9d, 0xfe, 0x42, 0x00, 0x20, 0x39, 0xc7, 0xf7, 0x9e, 0x85, 0xff, 0xff, 0x42, 0xce,
+  0x59, 0x00, 0x20, 0xa5, 0x14, 0x85, 0xff, 0xff, 0x42, 0xef, 0x5d, 0x00, 0x20, 0x00, 0x20, 0xc0,
+  0x0a, 0x0b, 0x0b, 0xcf, 0x01, 0x01, 0xc1, 0x15, 0x15, 0x15, 0x45, 0x06, 0x06, 0x07, 0xfe, 0x41,
+  0x00, 0x20, 0x52, 0xaa, 0x83, 0xff, 0xff, 0x40, 0xff, 0xdf, 0x82, 0xff, 0xff, 0x41, 0xde, 0xfb,
+  0x00, 0x20, 0xc0, 0x7b, 0x7c, 0x7c, 0xfe, 0x87, 0xff, 0xff, 0x42, 0xb5, 0xb6, 0x00, 0x20, 0xd6,
+  0xba, 0x85, 0xff, 0xff, 0x42, 0xde, 0xfb, 0x00, 0x20, 0xd6, 0xdb, 0x82, 0xff, 0xff, 0x45, 0x8c,
+  0x71, 0x00, 0x20, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0xc0, 0x97,
+  0x98, 0x98, 0xfe, 0x87, 0xff, 0xff, 0x42, 0x94, 0x92, 0x00, 0x20, 0xc6, 0x18, 0x87, 0xff, 0xff,
+  0x4d, 0x8c, 0x71, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00,
+  0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0x86, 0xff, 0xff,
+  0x42, 0xe7, 0x3c, 0x00, 0x20, 0x9c, 0xd3, 0x86, 0xff, 0xff, 0x42, 0xf7, 0xbe, 0x18, 0xc3, 0xa5,
+  0x14, 0x85, 0xff, 0xff, 0xc0, 0xe8, 0xe8, 0xe8, 0xfe, 0x41, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x09,
+  0x0a, 0x0a, 0xce, 0x01, 0x01, 0xc0, 0x10, 0x11, 0x10, 0x74, 0x48, 0x00, 0x20, 0x00, 0x20, 0x9c,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x73, 0x8e, 0x08, 0x41, 0xc6, 0x38, 0x82, 0xff, 0xff,
+  0x41, 0x31, 0x86, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x4a, 0xa5, 0x34, 0x84, 0x10, 0xe7, 0x3c, 0xff,
+  0xff, 0xff, 0xff, 0xde, 0xfb, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0x82,
+  0x7b, 0xcf, 0x42, 0x5a, 0xeb, 0x00, 0x20, 0xd6, 0xba, 0x82, 0xff, 0xff, 0x45, 0xc6, 0x18, 0x00,
+  0x20, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x43, 0xbd, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xc0, 0x5d, 0x5d, 0x5e, 0xfe, 0x61, 0x42, 0x28, 0xf7, 0x9e, 0xff,
+  0xff, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x20, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0x29,
+  0x45, 0x4a, 0x69, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x17, 0x00, 0x20, 0xc6, 0x38, 0xff,
+  0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce,
+  0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x63, 0x2c, 0xc6, 0x38, 0x82,
+  0xff, 0xff, 0x46, 0x42, 0x08, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x31, 0xa6, 0x84,
+  0x30, 0x82, 0xff, 0xff, 0x46, 0x63, 0x0c, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x7b,
+  0xcf, 0x7b, 0xcf, 0xc0, 0x7b, 0x7b, 0x7b, 0xfe, 0x42, 0x6b, 0x4d, 0x00, 0x20, 0x00, 0x20, 0xc0,
+  0x0b, 0x0c, 0x0b, 0xb0, 0x01, 0x01, 0xc0, 0x0c, 0x0c, 0x0c, 0x91, 0x48, 0x00, 0x20, 0x00, 0x20,
+  0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0x73, 0xae, 0x82, 0xff,
+  0xff, 0x41, 0x6b, 0x4d, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x4a, 0x84, 0x10, 0x00, 0x20, 0xad, 0x75,
+  0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba,
+  0x84, 0x00, 0x20, 0x40, 0xd6, 0xba, 0x82, 0xff, 0xff, 0x45, 0xef, 0x5d, 0x00, 0x20, 0xbd, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x66, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x3c, 0x00, 0x20, 0x00, 0x20, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x00, 0x00,
+  0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0x00, 0x20, 0xce, 0x79, 0xff, 0xff,
+  0xff, 0xff, 0xce, 0x79, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20,
+  0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff,
+  0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0x63, 0x0c, 0x82, 0xff, 0xff, 0x46, 0x6b, 0x6d, 0xce, 0x79,
+  0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0x10, 0x82, 0x82, 0xff, 0xff, 0x45, 0x7b, 0xcf,
+  0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00, 0x00, 0x83, 0x00, 0x20, 0xc1, 0x05, 0x06,
+  0x06, 0xfe, 0x10, 0x10, 0x10, 0x59, 0x01, 0x01, 0xc0, 0x08, 0x09, 0x08, 0x99, 0x48, 0x00, 0x20,
+  0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0x63, 0x2c,
+  0x82, 0xff, 0xff, 0x41, 0x7b, 0xcf, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x4a, 0x84, 0x10, 0x00, 0x20,
+  0x94, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0x9a, 0x84, 0x00, 0x20, 0x40, 0xd6, 0xba, 0x83, 0xff, 0xff, 0x44, 0x63, 0x2c, 0xbd, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x4d, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xdf, 0x3a, 0x08, 0x00, 0x20, 0xa5, 0x14, 0xce, 0x59, 0xce, 0x59, 0x9c, 0xd3, 0x00, 0x00,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa5, 0xa5, 0xa4, 0xfe, 0x57, 0x00, 0x20, 0x00, 0x20,
+  0xce, 0x58, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20,
+  0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0x31, 0xa6, 0x82, 0xff, 0xff, 0x4f,
+  0x7b, 0xef, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0x08, 0x41, 0xb5, 0x96,
+  0xb5, 0xb6, 0xb5, 0xb6, 0x4a, 0x49, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00, 0x00,
+  0x83, 0x00, 0x20, 0xc1, 0x0a, 0x0a, 0x0a, 0xb2, 0x46, 0x46, 0x46, 0x01, 0x01, 0x01, 0xc0, 0x0a,
+  0x0b, 0x0b, 0x99, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba,
+  0x00, 0x20, 0x00, 0x20, 0x63, 0x2c, 0xc0, 0xfc, 0xfd, 0xfc, 0xfe, 0x43, 0xff, 0xff, 0xff, 0xff,
+  0x7b, 0xcf, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x4a, 0x84, 0x10, 0x00, 0x20, 0x8c, 0x51, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x84, 0x00,
+  0x20, 0x40, 0xd6, 0xba, 0x83, 0xff, 0xff, 0xc0, 0xaf, 0xaf, 0xaf, 0xfe, 0x43, 0xbd, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0xc0, 0x92, 0x92, 0x92, 0xfe, 0x82, 0xff, 0xff,
+  0x40, 0xce, 0x59, 0x84, 0x00, 0x20, 0x43, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0xa4, 0xa5, 0xa5, 0xfe, 0x57, 0x00, 0x20, 0x00, 0x20, 0xc6, 0x59, 0xff, 0xff, 0xff, 0xff, 0xde,
+  0xdb, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce,
+  0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xad,
+  0x55, 0x00, 0x20, 0x31, 0x86, 0x82, 0xff, 0xff, 0x44, 0x7b, 0xef, 0xde, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0x59, 0x85, 0x00, 0x20, 0x44, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00,
+  0x00, 0x83, 0x00, 0x20, 0xc0, 0x0c, 0x0c, 0x0c, 0xb8, 0x02, 0x01, 0xc0, 0x0b, 0x0c, 0x0c, 0x9a,
+  0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00,
+  0x20, 0x63, 0x2c, 0xc0, 0xfc, 0xfd, 0xfd, 0xfe, 0x43, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0x7b,
+  0xef, 0x82, 0xff, 0xff, 0x50, 0x84, 0x10, 0x00, 0x20, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xdf, 0x00, 0x00, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0xb5, 0x96, 0xb5, 0x96, 0xad,
+  0x75, 0x18, 0xe3, 0x00, 0x20, 0xd6, 0xbb, 0x83, 0xff, 0xff, 0x44, 0xde, 0xdb, 0xbd, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x41, 0x18, 0xe3, 0xef, 0x5d, 0x82, 0xff, 0xff,
+  0x41, 0xce, 0x59, 0x21, 0x04, 0x82, 0x00, 0x20, 0x43, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0xa4, 0xa5, 0xa4, 0xfe, 0x57, 0x00, 0x20, 0x00, 0x20, 0xc6, 0x59, 0xff, 0xff, 0xff,
+  0xff, 0xde, 0xdb, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00,
+  0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff,
+  0xff, 0xad, 0x55, 0x00, 0x20, 0x63, 0x0c, 0x82, 0xff, 0xff, 0x44, 0x6b, 0x6d, 0xde, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0xce, 0x59, 0x85, 0x00, 0x20, 0x43, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xf7,
+  0xbe, 0x82, 0xb5, 0x96, 0x41, 0x5a, 0xeb, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x06, 0xfd, 0x2d, 0x2d,
+  0x2e, 0x12, 0x01, 0x01, 0xc0, 0x0c, 0x0d, 0x0c, 0x9b, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0x63, 0x2c, 0x82, 0xff, 0xff, 0x41,
+  0x7b, 0xcf, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x41, 0x84, 0x10, 0x00, 0x00, 0xc0, 0xcc, 0xcc, 0xcc,
+  0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff, 0xff, 0x47,
+  0x39, 0xe7, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf,
+  0xc0, 0xc1, 0xc1, 0xc0, 0xfe, 0x44, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20,
+  0xc1, 0x08, 0x09, 0x09, 0xeb, 0x05, 0x06, 0x06, 0xfc, 0x43, 0x00, 0x20, 0x00, 0x20, 0x84, 0x10,
+  0xff, 0xdf, 0x82, 0xff, 0xff, 0x47, 0xde, 0xdb, 0x39, 0xc7, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa5, 0xa5, 0xa5, 0xfe, 0x57, 0x00, 0x20, 0x00, 0x20,
+  0xc6, 0x59, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20,
+  0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x7b, 0xef, 0xd6, 0x9a, 0x82, 0xff, 0xff, 0x44,
+  0x39, 0xc7, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x85, 0x00, 0x20, 0x40, 0xa5, 0x14,
+  0x85, 0xff, 0xff, 0x41, 0x8c, 0x71, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfe, 0x17, 0x18, 0x18,
+  0x2d, 0x01, 0x01, 0xc0, 0x0c, 0x0c, 0x0c, 0x9a, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0xff,
+  0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0x63, 0x2c, 0x82, 0xff, 0xff, 0x41, 0x7b,
+  0xcf, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x41, 0xef, 0x7d, 0xef, 0x7d, 0x82, 0xff, 0xff, 0x42, 0xce,
+  0x59, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff, 0xff, 0x47, 0x39, 0xc7, 0x00, 0x20, 0xd6, 0xba, 0xff,
+  0xff, 0xff, 0xff, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xe8, 0xe8, 0xe8, 0xfe, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x06, 0x06, 0x06, 0xc8, 0x09, 0x09,
+  0x09, 0x97, 0x82, 0x00, 0x20, 0x41, 0x8c, 0x71, 0xff, 0xdf, 0x82, 0xff, 0xff, 0x46, 0xe7, 0x1c,
+  0x39, 0xe7, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa4, 0xa4, 0xa4,
+  0xfe, 0x52, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20,
+  0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff,
+  0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0x86, 0xff, 0xff, 0x45, 0xde, 0xfb, 0x00, 0x20,
+  0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x85, 0x00, 0x20, 0x40, 0xa5, 0x14, 0x85, 0xff,
+  0xff, 0x41, 0x8c, 0x71, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfe, 0x21, 0x21, 0x21, 0x2f, 0x01,
+  0x01, 0xc0, 0x0b, 0x0c, 0x0c, 0x9a, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff,
+  0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0x63, 0x2c, 0x82, 0xff, 0xff, 0x41, 0x7b, 0xcf, 0x7b,
+  0xef, 0x87, 0xff, 0xff, 0x45, 0x7b, 0xcf, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x7d, 0xc0, 0xcb, 0xcb, 0xcb, 0xfe, 0x48, 0xce, 0x59, 0xce, 0x59, 0x21, 0x04, 0x00, 0x20, 0xd6,
+  0xba, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0xef, 0x7d, 0x83, 0xff, 0xff, 0x42, 0xde, 0xdb, 0x00,
+  0x20, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x05, 0xc9, 0x13, 0x13, 0x12, 0x2e, 0x83, 0x00, 0x20, 0x41,
+  0x7b, 0xcf, 0xef, 0x9e, 0x82, 0xff, 0xff, 0x59, 0xce, 0x79, 0x00, 0x20, 0x00, 0x00, 0xff, 0xdf,
+  0xff, 0xff, 0xff, 0xff, 0xa5, 0x34, 0x00, 0x20, 0x00, 0x20, 0xc6, 0x39, 0xff, 0xff, 0xff, 0xff,
+  0xde, 0xdb, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20,
+  0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0x85, 0xff, 0xff, 0x46,
+  0xf7, 0xbe, 0x73, 0xae, 0x00, 0x20, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x85, 0x00,
+  0x20, 0x43, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xc1, 0xca, 0xcb, 0xcb, 0xfe, 0xca,
+  0xcb, 0xcb, 0xfe, 0x42, 0xce, 0x59, 0x6b, 0x6d, 0x00, 0x20, 0xc1, 0x04, 0x05, 0x05, 0xfe, 0x25,
+  0x24, 0x25, 0x21, 0x01, 0x01, 0xc0, 0x0a, 0x0b, 0x0b, 0x9a, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd,
+  0xf7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20, 0x00, 0x20, 0x63, 0x2c, 0x82, 0xff, 0xff,
+  0x41, 0x7b, 0xcf, 0x7b, 0xef, 0x85, 0xff, 0xff, 0x47, 0xf7, 0xbe, 0x9c, 0xf3, 0x00, 0x20, 0x00,
+  0x20, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x84, 0x00, 0x20, 0x44, 0xd6, 0xbb, 0xff,
+  0xff, 0xff, 0xff, 0xbd, 0xd7, 0xc6, 0x38, 0x83, 0xff, 0xff, 0x42, 0xde, 0xdb, 0x00, 0x20, 0x00,
+  0x20, 0xc1, 0x09, 0x0a, 0x0a, 0xd8, 0x06, 0x07, 0x07, 0xce, 0x84, 0x00, 0x20, 0x41, 0x5a, 0xcb,
+  0xef, 0x7d, 0x82, 0xff, 0xff, 0x41, 0x73, 0x8e, 0x00, 0x00, 0x82, 0xff, 0xff, 0x60, 0xa5, 0x34,
+  0x00, 0x20, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0xc6, 0x38,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xf7, 0xbe, 0xff, 0xff,
+  0xff, 0xff, 0xad, 0x75, 0x00, 0x20, 0x00, 0x20, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59,
+  0x85, 0x00, 0x20, 0x44, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9e, 0x00, 0x00, 0x83, 0x00,
+  0x20, 0xc1, 0x09, 0x09, 0x09, 0xdc, 0x48, 0x48, 0x48, 0x01, 0x01, 0x01, 0xc0, 0x0a, 0x0b, 0x0b,
+  0x99, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x00, 0x20,
+  0x00, 0x20, 0x63, 0x2c, 0x82, 0xff, 0xff, 0x41, 0x7b, 0xcf, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x41,
+  0xbd, 0xf7, 0xa5, 0x14, 0xc0, 0x88, 0x89, 0x88, 0xfe, 0x40, 0x31, 0xa6, 0x82, 0x00, 0x20, 0x43,
+  0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x84, 0x00, 0x20, 0x44, 0xd6, 0xbb, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0xd7, 0x94, 0x92, 0x83, 0xff, 0xff, 0x40, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x45,
+  0x4a, 0x69, 0x5a, 0xcb, 0x5a, 0xcb, 0x29, 0x45, 0x00, 0x20, 0x73, 0x8e, 0x82, 0xff, 0xff, 0x44,
+  0xb5, 0x96, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa4, 0xa5, 0xa5, 0xfe, 0x58,
+  0x00, 0x20, 0x00, 0x20, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0xc6, 0x38,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xbd, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xdd, 0xdd, 0xdd, 0xfe, 0x50, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0x00, 0x20, 0x9c, 0xd3, 0xa5, 0x14, 0x9d, 0x14, 0x4a, 0x69,
+  0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x00, 0x00, 0x83, 0x00, 0x20, 0xc0, 0x10, 0x11,
+  0x10, 0x83, 0x02, 0x01, 0xc0, 0x13, 0x13, 0x12, 0x92, 0x48, 0x00, 0x20, 0x00, 0x20, 0xbd, 0xf7,
+  0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20, 0x6b, 0x4d, 0x82, 0xff, 0xff, 0x41,
+  0x73, 0xae, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x40, 0x84, 0x10, 0x85, 0x00, 0x20, 0x43, 0xd6, 0xba,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x84, 0x00, 0x20, 0x45, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0xbd, 0xf7, 0x31, 0xa6, 0xff, 0xdf, 0x82, 0xff, 0xff, 0x40, 0xde, 0xdb, 0x84, 0x00, 0x20, 0x48,
+  0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x34, 0x00, 0x20, 0x00, 0x20, 0xef, 0x7d, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xc7, 0xc7, 0xc7, 0xfe, 0x43, 0x00, 0x00, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0xa5, 0xa5, 0xa5, 0xfe, 0x56, 0x00, 0x20, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0x9a, 0x00, 0x20, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x20, 0x00, 0x20,
+  0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff,
+  0xad, 0x55, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x50, 0x52, 0xaa, 0x00, 0x20, 0xd6, 0x9a, 0xff, 0xff,
+  0xff, 0xff, 0xce, 0x59, 0x00, 0x20, 0x08, 0x41, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xef,
+  0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x00, 0x00, 0x83, 0x00, 0x20, 0xc1, 0x07, 0x07,
+  0x07, 0xf3, 0x15, 0x15, 0x15, 0x28, 0x01, 0x01, 0xc0, 0x14, 0x14, 0x14, 0x77, 0x48, 0x00, 0x20,
+  0x00, 0x20, 0xa5, 0x55, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x10, 0xc3, 0x00, 0x20, 0x94, 0xb2,
+  0x82, 0xff, 0xff, 0x41, 0x42, 0x08, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x40, 0x84, 0x10, 0x85, 0x00,
+  0x20, 0x43, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x84, 0x00, 0x20, 0x45, 0xd6, 0xdb,
+  0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0xde, 0xdb, 0x82, 0xff, 0xff, 0x40, 0xde, 0xdb,
+  0x84, 0x00, 0x20, 0x70, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x20, 0x18, 0xc3,
+  0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x00, 0x20, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xff,
+  0xc6, 0x18, 0x00, 0x20, 0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x00, 0x20,
+  0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0xff, 0xff,
+  0xff, 0xff, 0xc6, 0x18, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0x10, 0x82,
+  0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xad, 0x75, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0xba, 0x00, 0x20, 0x42, 0x28, 0x82, 0xff, 0xff, 0x45, 0x7b, 0xcf, 0xa5, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x9e, 0x00, 0x00, 0x84, 0x00, 0x20, 0xc0, 0x0c, 0x0c, 0x0c, 0xa2, 0x01, 0x01,
+  0xc0, 0x14, 0x15, 0x14, 0x4e, 0x41, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x7a, 0x7a, 0x7a, 0xfe, 0x82,
+  0xff, 0xff, 0x47, 0xd6, 0xba, 0xb5, 0xb6, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x00,
+  0x00, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x41, 0x84, 0x10, 0x00, 0x20, 0xc2, 0x05, 0x07, 0x07, 0xfe,
+  0x0e, 0x0e, 0x0e, 0x78, 0x09, 0x0a, 0x09, 0xc2, 0x45, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0x82, 0xf7, 0xbe, 0x46, 0xd6, 0xba, 0x00, 0x20, 0xd6, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0xc0, 0xad, 0xae, 0xae, 0xfe, 0x82, 0xff, 0xff, 0x40,
+  0xde, 0xdb, 0x84, 0x00, 0x20, 0x45, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xa5, 0x34,
+  0xce, 0x79, 0x82, 0xff, 0xff, 0x47, 0xa5, 0x34, 0x00, 0x20, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xdf, 0xbd, 0xf7, 0xce, 0x79, 0x82, 0xff, 0xff, 0x41, 0xa5, 0x14, 0x00, 0x20, 0xc0, 0x97,
+  0x97, 0x97, 0xfe, 0x82, 0xff, 0xff, 0x41, 0xce, 0x59, 0xbd, 0xf7, 0x82, 0xff, 0xff, 0x50, 0x9c,
+  0xf3, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0xd6, 0x9a, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x1c, 0x00, 0x20, 0xb5, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbd,
+  0xd7, 0xc0, 0xd3, 0xd3, 0xd3, 0xfe, 0x82, 0xff, 0xff, 0x41, 0x42, 0x08, 0xa5, 0x14, 0x82, 0xff,
+  0xff, 0x82, 0xf7, 0xbe, 0x42, 0xe7, 0x1c, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x0d, 0x0d, 0x0d, 0xe1,
+  0x01, 0x01, 0xc1, 0x29, 0x29, 0x29, 0x12, 0x06, 0x07, 0x07, 0xf9, 0x42, 0x00, 0x20, 0x08, 0x82,
+  0xef, 0x5d, 0x86, 0xff, 0xff, 0x42, 0xb5, 0x96, 0x00, 0x20, 0x7b, 0xef, 0x82, 0xff, 0xff, 0x41,
+  0x84, 0x10, 0x00, 0x20, 0xc2, 0x05, 0x07, 0x07, 0xfe, 0x14, 0x15, 0x14, 0x35, 0x08, 0x09, 0x09,
+  0xa4, 0x42, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff, 0xff, 0x47, 0xdf, 0x1b, 0x00, 0x20,
+  0xd6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0x6b, 0x4d, 0x82, 0xff, 0xff, 0x40,
+  0xde, 0xdb, 0x84, 0x00, 0x20, 0xc0, 0xa4, 0xa4, 0xa4, 0xfe, 0x86, 0xff, 0xff, 0x43, 0xf7, 0xdf,
+  0x4a, 0x69, 0x00, 0x20, 0x8c, 0x51, 0x86, 0xff, 0xff, 0x44, 0xf7, 0xbe, 0x42, 0x08, 0x00, 0x20,
+  0x39, 0xe7, 0xf7, 0xbe, 0x85, 0xff, 0xff, 0x42, 0xf7, 0xbe, 0x42, 0x28, 0x00, 0x20, 0xc0, 0xf2,
+  0xf3, 0xf3, 0xfe, 0x43, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0xc0, 0xa4, 0xa4, 0xa4,
+  0xfe, 0x82, 0xff, 0xff, 0x41, 0x5a, 0xcb, 0x63, 0x2c, 0x86, 0xff, 0xff, 0x42, 0xde, 0xfb, 0x00,
+  0x20, 0xa5, 0x14, 0x85, 0xff, 0xff, 0x42, 0xef, 0x7d, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x05, 0x06,
+  0x06, 0xf5, 0x01, 0x02, 0xc0, 0x0e, 0x0e, 0x0e, 0xab, 0x41, 0x00, 0x20, 0x00, 0x20, 0xc0, 0x7d,
+  0x7d, 0x7d, 0xfe, 0x40, 0xf7, 0xdf, 0x84, 0xff, 0xff, 0x43, 0xde, 0xfb, 0x29, 0x65, 0x00, 0x20,
+  0x7b, 0xef, 0x82, 0xff, 0xff, 0x41, 0x84, 0x10, 0x00, 0x20, 0xc2, 0x05, 0x06, 0x07, 0xfe, 0x12,
+  0x12, 0x12, 0x34, 0x07, 0x08, 0x08, 0xa3, 0x42, 0x00, 0x20, 0x00, 0x20, 0xd6, 0xba, 0x85, 0xff,
+  0xff, 0x4d, 0xde, 0xfb, 0x00, 0x20, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20,
+  0x00, 0x20, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x08,
+  0x09, 0x09, 0xed, 0x06, 0x07, 0x07, 0xfb, 0x41, 0x00, 0x20, 0x10, 0x82, 0xc0, 0xd6, 0xd6, 0xd6,
+  0xfe, 0x84, 0xff, 0xff, 0x41, 0xff, 0xdf, 0x9c, 0xf3, 0x82, 0x00, 0x20, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xfe, 0x84, 0xff, 0xff, 0x40, 0xff, 0xdf, 0xc0, 0x95, 0x96, 0x96, 0xfe, 0x82, 0x00, 0x20, 0x40,
+  0xa5, 0x34, 0x85, 0xff, 0xff, 0x48, 0xa5, 0x14, 0x00, 0x20, 0x00, 0x20, 0xf7, 0x9e, 0xff, 0xff,
+  0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0x52, 0xaa, 0x82, 0xff, 0xff, 0x41, 0xad, 0x96, 0x00, 0x20,
+  0xc0, 0xb9, 0xba, 0xba, 0xfe, 0x84, 0xff, 0xff, 0x40, 0xf7, 0xbe, 0xc0, 0x76, 0x76, 0x76, 0xfe,
+  0x41, 0x00, 0x20, 0xa5, 0x14, 0x85, 0xff, 0xff, 0x42, 0xef, 0x5d, 0x00, 0x20, 0x00, 0x20, 0xc0,
+  0x07, 0x08, 0x08, 0xf3, 0x01, 0x02, 0xc1, 0x17, 0x17, 0x17, 0x2f, 0x07, 0x07, 0x08, 0xfa, 0x45,
+  0x00, 0x20, 0x00, 0x20, 0x5a, 0xcb, 0xbd, 0xf7, 0xde, 0xfb, 0xe7, 0x1c, 0xc0, 0xcf, 0xd0, 0xd0,
+  0xfe, 0x44, 0xa5, 0x14, 0x18, 0xc3, 0x00, 0x20, 0x00, 0x20, 0x39, 0xc7, 0x82, 0x8c, 0x71, 0x41,
+  0x31, 0xa6, 0x00, 0x20, 0xc2, 0x05, 0x06, 0x06, 0xfe, 0x17, 0x17, 0x17, 0x20, 0x07, 0x08, 0x08,
+  0x9d, 0x42, 0x00, 0x20, 0x00, 0x20, 0x73, 0x8e, 0x85, 0x8c, 0x71, 0x4d, 0x73, 0x8e, 0x00, 0x20,
+  0x73, 0x8e, 0x8c, 0x71, 0x8c, 0x71, 0x5a, 0xeb, 0x00, 0x20, 0x00, 0x20, 0x6b, 0x6d, 0x8c, 0x71,
+  0x8c, 0x71, 0x73, 0x8e, 0x00, 0x20, 0x00, 0x20, 0xc1, 0x0c, 0x0d, 0x0c, 0xb2, 0x0c, 0x0c, 0x0c,
+  0x8d, 0x42, 0x00, 0x20, 0x00, 0x20, 0x08, 0x62, 0xc0, 0x9d, 0x9d, 0x9d, 0xfe, 0x40, 0xd6, 0x9a,
+  0xc0, 0xe1, 0xe2, 0xe2, 0xfe, 0x40, 0xde, 0xfb, 0xc1, 0xc1, 0xc2, 0xc2, 0xfe, 0x73, 0x73, 0x73,
+  0xfe, 0x84, 0x00, 0x20, 0x40, 0x8c, 0x51, 0xc1, 0xc8, 0xc9, 0xc9, 0xfe, 0xe0, 0xe0, 0xe1, 0xfe,
+  0x40, 0xde, 0xfb, 0xc0, 0xbf, 0xc0, 0xc0, 0xfe, 0x40, 0x6b, 0x4d, 0x84, 0x00, 0x20, 0x41, 0x7b,
+  0xcf, 0xc6, 0x38, 0xc1, 0xdf, 0xe0, 0xe0, 0xfe, 0xdf, 0xe0, 0xe0, 0xfe, 0x41, 0xc6, 0x38, 0x7b,
+  0xcf, 0x82, 0x00, 0x20, 0x4d, 0x84, 0x30, 0x8c, 0x71, 0x8c, 0x71, 0x52, 0xaa, 0x00, 0x20, 0x00,
+  0x20, 0x84, 0x10, 0x8c, 0x71, 0x8c, 0x71, 0x6b, 0x6d, 0x00, 0x20, 0x00, 0x20, 0x8c, 0x51, 0xce,
+  0x79, 0xc1, 0xe1, 0xe2, 0xe2, 0xfe, 0xdc, 0xdd, 0xdd, 0xfe, 0x44, 0xbd, 0xf7, 0x5a, 0xcb, 0x00,
+  0x20, 0x00, 0x20, 0x4a, 0x69, 0x85, 0x8c, 0x71, 0x42, 0x84, 0x10, 0x00, 0x20, 0x00, 0x20, 0xc0,
+  0x0d, 0x0e, 0x0e, 0xc2, 0x01, 0x03, 0xc1, 0x10, 0x10, 0x10, 0x77, 0x05, 0x06, 0x06, 0xfe, 0x8f,
+  0x00, 0x20, 0xc0, 0x09, 0x0a, 0x09, 0xd6, 0x00, 0xc1, 0x12, 0x12, 0x11, 0x5a, 0x06, 0x07, 0x07,
+  0xfe, 0x94, 0x00, 0x20, 0xc3, 0x06, 0x07, 0x07, 0xfe, 0x0d, 0x0d, 0x0d, 0x65, 0x24, 0x23, 0x22,
+  0x08, 0x09, 0x09, 0x09, 0xc5, 0x88, 0x00, 0x20, 0xc2, 0x06, 0x07, 0x07, 0xfe, 0x0c, 0x0d, 0x0c,
+  0xcc, 0x06, 0x07, 0x07, 0xfe, 0x87, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x06, 0xfe, 0x0c, 0x0c, 0x0b,
+  0xda, 0xa7, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x06, 0xfe, 0x13, 0x13, 0x13, 0x58, 0x01, 0x04, 0xc1,
+  0x12, 0x12, 0x11, 0x66, 0x08, 0x08, 0x08, 0xf2, 0x85, 0x00, 0x20, 0xc2, 0x06, 0x07, 0x06, 0xfe,
+  0x0a, 0x0b, 0x0b, 0xe5, 0x06, 0x07, 0x07, 0xfd, 0x84, 0x00, 0x20, 0xc1, 0x07, 0x08, 0x07, 0xf1,
+  0x13, 0x13, 0x13, 0x39, 0x00, 0xc1, 0x26, 0x25, 0x25, 0x03, 0x09, 0x09, 0x09, 0xb7, 0x93, 0x00,
+  0x20, 0xc2, 0x06, 0x07, 0x06, 0xfe, 0x0d, 0x0d, 0x0d, 0xb1, 0x1c, 0x1d, 0x1c, 0x03, 0x00, 0xc2,
+  0x26, 0x25, 0x23, 0x0e, 0x0c, 0x0c, 0x0c, 0xab, 0x06, 0x07, 0x07, 0xfe, 0x85, 0x00, 0x20, 0xc4,
+  0x08, 0x08, 0x08, 0xf0, 0x12, 0x12, 0x11, 0x5f, 0x18, 0x18, 0x17, 0x07, 0x0f, 0x0f, 0x0f, 0x96,
+  0x06, 0x08, 0x07, 0xfd, 0x85, 0x00, 0x20, 0xc4, 0x07, 0x07, 0x07, 0xf9, 0x11, 0x11, 0x11, 0x7e,
+  0x34, 0x34, 0x34, 0x06, 0x10, 0x11, 0x10, 0x99, 0x06, 0x07, 0x07, 0xfe, 0x85, 0x00, 0x20, 0xc1,
+  0x08, 0x08, 0x08, 0xf9, 0x08, 0x09, 0x09, 0xf8, 0x8a, 0x00, 0x20, 0xc1, 0x05, 0x06, 0x06, 0xfe,
+  0x05, 0x06, 0x06, 0xfe, 0x85, 0x00, 0x20, 0xc1, 0x09, 0x0a, 0x09, 0xf5, 0x0a, 0x0b, 0x0a, 0xec,
+  0x87, 0x00, 0x20, 0xc1, 0x06, 0x07, 0x07, 0xfe, 0x0d, 0x0d, 0x0d, 0x8e, 0x02, 0x05, 0xcf, 0x1a,
+  0x19, 0x19, 0x16, 0x0f, 0x0f, 0x0f, 0x77, 0x0b, 0x0c, 0x0c, 0xb6, 0x07, 0x08, 0x08, 0xcc, 0x08,
+  0x09, 0x08, 0xcf, 0x0b, 0x0b, 0x0b, 0xc7, 0x0f, 0x10, 0x0f, 0xa3, 0x11, 0x10, 0x10, 0x59, 0x27,
+  0x29, 0x29, 0x07, 0x14, 0x15, 0x15, 0x3e, 0x10, 0x11, 0x11, 0x9a, 0x09, 0x0a, 0x09, 0xb4, 0x09,
+  0x0a, 0x09, 0xb4, 0x10, 0x11, 0x10, 0xb0, 0x0e, 0x0e, 0x0e, 0x84, 0x1b, 0x1a, 0x1a, 0x1e, 0x02,
+  0xd6, 0x3e, 0x3f, 0x3e, 0x03, 0x13, 0x14, 0x14, 0x60, 0x12, 0x13, 0x13, 0xa6, 0x0d, 0x0e, 0x0d,
+  0xb3, 0x0e, 0x0f, 0x0f, 0xb2, 0x0e, 0x0f, 0x0f, 0xb1, 0x0e, 0x0f, 0x0f, 0xb1, 0x0f, 0x0f, 0x0f,
+  0xb1, 0x0e, 0x0f, 0x0f, 0xb2, 0x10, 0x10, 0x0f, 0x95, 0x11, 0x11, 0x10, 0x7e, 0x13, 0x14, 0x13,
+  0xab, 0x10, 0x11, 0x10, 0xb2, 0x11, 0x12, 0x12, 0xb1, 0x13, 0x13, 0x13, 0x9f, 0x11, 0x10, 0x10,
+  0x61, 0x11, 0x12, 0x11, 0x4b, 0x0f, 0x10, 0x10, 0x9c, 0x10, 0x11, 0x11, 0xb3, 0x0b, 0x0c, 0x0b,
+  0xb3, 0x0f, 0x10, 0x10, 0x9e, 0x10, 0x10, 0x10, 0x53, 0x44, 0x47, 0x42, 0x01, 0x03, 0xc7, 0x17,
+  0x17, 0x17, 0x3a, 0x10, 0x11, 0x10, 0x94, 0x09, 0x09, 0x09, 0xc2, 0x09, 0x0a, 0x09, 0xcf, 0x07,
+  0x08, 0x08, 0xce, 0x0e, 0x0f, 0x0f, 0xb7, 0x12, 0x13, 0x12, 0x75, 0x18, 0x18, 0x18, 0x14, 0x02,
+  0xc7, 0x19, 0x19, 0x19, 0x2d, 0x0f, 0x0f, 0x0f, 0x89, 0x0b, 0x0b, 0x0b, 0xbf, 0x06, 0x07, 0x06,
+  0xce, 0x06, 0x07, 0x06, 0xcd, 0x0c, 0x0d, 0x0c, 0xb8, 0x0e, 0x0e, 0x0d, 0x7e, 0x22, 0x22, 0x22,
+  0x1f, 0x02, 0xe6, 0x19, 0x19, 0x19, 0x34, 0x0f, 0x10, 0x10, 0x90, 0x0a, 0x0b, 0x0a, 0xc0, 0x06,
+  0x06, 0x06, 0xcd, 0x06, 0x07, 0x07, 0xcd, 0x0d, 0x0e, 0x0d, 0xba, 0x0f, 0x0f, 0x0e, 0x82, 0x1c,
+  0x1c, 0x1c, 0x23, 0x13, 0x13, 0x13, 0x2a, 0x0e, 0x0f, 0x0e, 0x8d, 0x13, 0x14, 0x13, 0xaf, 0x10,
+  0x11, 0x10, 0xb0, 0x10, 0x11, 0x10, 0xb1, 0x10, 0x10, 0x10, 0x8f, 0x17, 0x17, 0x17, 0x4c, 0x0e,
+  0x0f, 0x0f, 0x6f, 0x13, 0x14, 0x13, 0xa5, 0x10, 0x11, 0x10, 0xb0, 0x10, 0x11, 0x10, 0xb1, 0x11,
+  0x12, 0x11, 0x9d, 0x10, 0x10, 0x10, 0x59, 0x1d, 0x1d, 0x1c, 0x38, 0x0f, 0x10, 0x0f, 0x92, 0x09,
+  0x0a, 0x09, 0xc2, 0x09, 0x09, 0x09, 0xcf, 0x08, 0x09, 0x08, 0xce, 0x0c, 0x0c, 0x0c, 0xbf, 0x0f,
+  0x0f, 0x0e, 0x83, 0x24, 0x22, 0x23, 0x1e, 0x1b, 0x1b, 0x1a, 0x18, 0x0d, 0x0d, 0x0c, 0x7b, 0x10,
+  0x11, 0x10, 0xa9, 0x0d, 0x0e, 0x0d, 0xb2, 0x0e, 0x10, 0x0f, 0xb1, 0x0e, 0x10, 0x0f, 0xb1, 0x0e,
+  0x0f, 0x0e, 0xb1, 0x0c, 0x0d, 0x0d, 0xb2, 0x0f, 0x0f, 0x0f, 0x90, 0x13, 0x13, 0x13, 0x3a, 0x03,
+  0x3f, 0x34, 0x3f, 0x34,
+};
+const DisplayImage imageLogo = { 117, 60, imageLogoData, 11108 };
+
+// pickaxe.png: 32x32, 1563 bytes as PNG, 1256 as runs
+static const uint8_t imagePickaxeData[] PROGMEM = {
+  0x1f, 0x0e, 0xc8, 0xe4, 0xe4, 0xe8, 0x4c, 0xdb, 0xdd, 0xe1, 0x81, 0xd2, 0xd7, 0xdc, 0xa6, 0xcb,
+  0xd1, 0xd8, 0xc4, 0xc4, 0xca, 0xd2, 0xc6, 0xbf, 0xc5, 0xce, 0xc6, 0xb8, 0xbe, 0xc8, 0xac, 0xaf,
+  0xb6, 0xc3, 0x89, 0xa3, 0xad, 0xc2, 0x32, 0x07, 0x0b, 0xc2, 0xea, 0xef, 0xef, 0x30, 0xe1, 0xe1,
+  0xe6, 0xa2, 0xda, 0xdc, 0xe0, 0xe5, 0x47, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x7a, 0xc6, 0x5a, 0xc6,
+  0x39, 0xbe, 0x19, 0xbd, 0xf9, 0xb5, 0xd8, 0xc1, 0xad, 0xb5, 0xc2, 0xfd, 0xa4, 0xad, 0xbc, 0xbe,
+  0x06, 0x08, 0xc3, 0x46, 0x46, 0x46, 0x0b, 0x4b, 0x4b, 0x4c, 0x9a, 0xb5, 0xb7, 0xb8, 0xc5, 0xdd,
+  0xdf, 0xe2, 0xfa, 0x48, 0xd6, 0xdb, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x7a, 0xc6, 0x5a, 0xc6, 0x39,
+  0xbe, 0x19, 0xbd, 0xf9, 0xb5, 0xd8, 0xc3, 0xad, 0xb5, 0xc2, 0xfe, 0xa5, 0xad, 0xbc, 0xf6, 0x9d,
+  0xa6, 0xb6, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x05, 0x05, 0xc3, 0xe1, 0x87, 0x5a, 0x11, 0xe4, 0x96,
+  0x64, 0xd8, 0xb4, 0x7e, 0x5a, 0xe3, 0x3f, 0x3e, 0x3e, 0xec, 0x4b, 0x29, 0x65, 0x4a, 0x49, 0xbe,
+  0x18, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x7a, 0xc6, 0x5a, 0xc6, 0x39, 0xbe, 0x19, 0xb5, 0xd8, 0xa5,
+  0x77, 0x9d, 0x56, 0xc2, 0x97, 0xa3, 0xb3, 0xe9, 0x95, 0xa2, 0xb1, 0xa4, 0x97, 0xa1, 0xb2, 0x4c,
+  0x06, 0x04, 0xc1, 0xc9, 0x79, 0x43, 0x13, 0xd6, 0x81, 0x50, 0xcf, 0x4b, 0xa3, 0x6a, 0x31, 0x86,
+  0x29, 0x45, 0x31, 0xa6, 0x42, 0x08, 0x5b, 0x0c, 0xbe, 0x19, 0xce, 0x7a, 0xc6, 0x5a, 0xc6, 0x39,
+  0xb5, 0xf8, 0xa5, 0x77, 0xc3, 0x97, 0xa3, 0xb3, 0xfc, 0x95, 0xa2, 0xb1, 0xa4, 0x96, 0xa2, 0xb2,
+  0x3f, 0x80, 0x80, 0x80, 0x02, 0x08, 0x03, 0xc1, 0xc9, 0x5e, 0x36, 0x13, 0xc9, 0x6c, 0x3e, 0xcf,
+  0x4a, 0x8b, 0x09, 0x29, 0x45, 0x21, 0x24, 0x31, 0x86, 0x39, 0xe7, 0x4a, 0x49, 0x52, 0xaa, 0x6b,
+  0x6d, 0xbd, 0xf8, 0xbe, 0x19, 0xa5, 0x77, 0xc2, 0x96, 0xa1, 0xb3, 0xfb, 0x96, 0xa1, 0xb3, 0xa0,
+  0x98, 0x9f, 0xb3, 0x25, 0x0b, 0x03, 0xc0, 0xbb, 0x5e, 0x32, 0xad, 0x4a, 0x92, 0xc7, 0x29, 0x65,
+  0x21, 0x24, 0x29, 0x65, 0x39, 0xc7, 0x42, 0x28, 0x52, 0x8a, 0x5a, 0xcb, 0x63, 0x2c, 0x84, 0x10,
+  0x9d, 0x36, 0xc1, 0x97, 0xa1, 0xb2, 0xc1, 0x98, 0x9f, 0xb3, 0x25, 0x0d, 0x03, 0xc0, 0x89, 0x4c,
+  0x30, 0xaf, 0x48, 0x31, 0x86, 0x21, 0x24, 0x29, 0x45, 0x31, 0xa6, 0x42, 0x08, 0x4a, 0x69, 0x5a,
+  0xcb, 0x63, 0x0c, 0x63, 0x4d, 0xc2, 0x42, 0x44, 0x48, 0xfd, 0x96, 0xa2, 0xb2, 0x70, 0x80, 0x80,
+  0x80, 0x02, 0x0e, 0x02, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x47, 0x44, 0x43, 0xe7, 0x48, 0x21, 0x24,
+  0x21, 0x24, 0x31, 0x86, 0x39, 0xe7, 0x4a, 0x49, 0x52, 0xaa, 0x5a, 0xeb, 0x9b, 0xed, 0xa3, 0x69,
+  0xc0, 0x31, 0x32, 0x34, 0xa7, 0x10, 0x02, 0xc0, 0x59, 0x59, 0x59, 0x5c, 0x49, 0x21, 0x24, 0x21,
+  0x24, 0x29, 0x65, 0x39, 0xc7, 0x42, 0x28, 0x52, 0x8a, 0x5a, 0xeb, 0xa3, 0xcc, 0xdc, 0x6b, 0xdc,
+  0x4b, 0xc0, 0xe1, 0x90, 0x5f, 0x97, 0x10, 0x02, 0xc0, 0xdd, 0xdf, 0xe0, 0x9e, 0x4a, 0x84, 0x30,
+  0x29, 0x65, 0x31, 0xa6, 0x42, 0x08, 0x4a, 0x69, 0x52, 0xaa, 0x93, 0x6b, 0xd3, 0xa8, 0xdc, 0x2a,
+  0xdc, 0x4a, 0xdc, 0x4a, 0xc0, 0xe2, 0x91, 0x5f, 0x84, 0x0f, 0x01, 0xc1, 0xee, 0xee, 0xee, 0x0f,
+  0xdb, 0xdd, 0xe1, 0xf3, 0x48, 0xd6, 0xdb, 0x8c, 0x72, 0x39, 0xe7, 0x4a, 0x49, 0x52, 0x8a, 0x7b,
+  0x2b, 0xc3, 0x26, 0xcb, 0x67, 0xd3, 0xc8, 0x82, 0xdc, 0x2a, 0xc0, 0xe0, 0x8e, 0x5d, 0x73, 0x0e,
+  0x01, 0xc0, 0xe4, 0xe7, 0xe7, 0x7d, 0x4c, 0xd6, 0xdb, 0xd6, 0xbb, 0xce, 0x9b, 0x9c, 0xd3, 0x52,
+  0x8a, 0x5a, 0xcb, 0x8a, 0x25, 0xba, 0xe6, 0xc3, 0x26, 0xcb, 0x67, 0xd3, 0xc9, 0xdc, 0x2a, 0xdc,
+  0x2a, 0xc1, 0xd9, 0x86, 0x52, 0xfe, 0xdd, 0x8f, 0x5b, 0x62, 0x0d, 0x01, 0xc0, 0xd9, 0xdb, 0xdf,
+  0xc8, 0x45, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x7a, 0xc6, 0x5a, 0x94, 0xd3, 0x29, 0x65, 0xc1, 0x4e,
+  0x38, 0x2d, 0x76, 0x97, 0x48, 0x26, 0xdd, 0x45, 0xb2, 0xc6, 0xc3, 0x26, 0xcb, 0x67, 0xd3, 0xc9,
+  0xdc, 0x2a, 0xd4, 0x0a, 0xc1, 0xd7, 0x83, 0x51, 0xfe, 0xdb, 0x8f, 0x5b, 0x54, 0x0c, 0x00, 0xc1,
+  0xea, 0xea, 0xea, 0x0c, 0xd5, 0xd9, 0xde, 0xfa, 0x43, 0xde, 0xfc, 0xe7, 0x5d, 0xce, 0x9b, 0xbe,
+  0x39, 0xc1, 0x82, 0x88, 0x95, 0xf6, 0x2d, 0x2f, 0x30, 0xa4, 0x00, 0xc1, 0x92, 0x49, 0x24, 0x15,
+  0x97, 0x47, 0x24, 0xcc, 0x45, 0xb2, 0xc6, 0xc3, 0x26, 0xcb, 0x67, 0xd3, 0xe9, 0xd4, 0x0a, 0xd4,
+  0x09, 0xc1, 0xd6, 0x81, 0x50, 0xfd, 0xdd, 0x8d, 0x5b, 0x43, 0x0b, 0x00, 0xc0, 0xe1, 0xe4, 0xe8,
+  0x4c, 0x44, 0xce, 0x9b, 0xdf, 0x1c, 0xef, 0x9e, 0xd6, 0xbb, 0xad, 0x98, 0xc1, 0x8d, 0x96, 0xa4,
+  0x6b, 0x00, 0x00, 0x00, 0x03, 0x01, 0xc1, 0x92, 0x49, 0x24, 0x0e, 0x95, 0x47, 0x26, 0xbe, 0x45,
+  0xb2, 0xc5, 0xc3, 0x26, 0xcb, 0x67, 0xd3, 0xe9, 0xd4, 0x09, 0xd3, 0xe9, 0xc1, 0xd5, 0x7f, 0x4e,
+  0xfb, 0xdd, 0x8c, 0x5b, 0x35, 0x0a, 0x00, 0xc0, 0xd4, 0xd6, 0xdb, 0x88, 0x43, 0xce, 0x7a, 0xc6,
+  0x7a, 0xce, 0x7a, 0xbe, 0x19, 0xc1, 0x99, 0xa5, 0xb4, 0xc3, 0xff, 0xff, 0xff, 0x01, 0x03, 0xc1,
+  0x92, 0x49, 0x24, 0x07, 0x95, 0x47, 0x25, 0xad, 0x42, 0xb2, 0xa5, 0xc3, 0x26, 0xcb, 0x67, 0x82,
+  0xd3, 0xe9, 0xc1, 0xd4, 0x7f, 0x4d, 0xf9, 0xd9, 0x8c, 0x59, 0x28, 0x09, 0x00, 0xc0, 0xc5, 0xca,
+  0xd3, 0xac, 0x42, 0xc6, 0x5a, 0xc6, 0x39, 0xbe, 0x19, 0xc1, 0xac, 0xb4, 0xc0, 0xfe, 0x99, 0x9f,
+  0xb3, 0x28, 0x05, 0xc1, 0x80, 0x80, 0x00, 0x02, 0x94, 0x46, 0x25, 0x92, 0x45, 0xaa, 0xa5, 0xc3,
+  0x26, 0xcb, 0x88, 0xd3, 0xe9, 0xd3, 0xc9, 0xd3, 0xc9, 0xc1, 0xd2, 0x7c, 0x4c, 0xf6, 0xdc, 0x84,
+  0x58, 0x1d, 0x08, 0x00, 0xc0, 0xbe, 0xc5, 0xce, 0xbc, 0x42, 0xc6, 0x39, 0xbe, 0x19, 0xb5, 0xf9,
+  0xc0, 0x9d, 0xa6, 0xb7, 0xc5, 0x08, 0xc1, 0x95, 0x46, 0x26, 0x80, 0xaa, 0x53, 0x2c, 0xfe, 0x44,
+  0xc3, 0x26, 0xcb, 0x88, 0xd3, 0xc9, 0xd3, 0xc9, 0xd3, 0xc8, 0xc1, 0xd3, 0x7c, 0x4c, 0xf1, 0xd9,
+  0x8c, 0x59, 0x14, 0x07, 0x00, 0xc0, 0xb7, 0xbe, 0xc7, 0xbc, 0x42, 0xbe, 0x19, 0xbd, 0xf9, 0xad,
+  0xb8, 0xc0, 0x95, 0xa2, 0xb3, 0x3c, 0x09, 0xc1, 0x95, 0x47, 0x26, 0x65, 0xa6, 0x52, 0x2b, 0xfd,
+  0x44, 0xc3, 0x26, 0xcb, 0xa8, 0xd3, 0xc9, 0xcb, 0xa8, 0xcb, 0xa8, 0xc1, 0xd3, 0x7c, 0x4a, 0xeb,
+  0xea, 0x95, 0x6a, 0x0c, 0x06, 0x00, 0xc0, 0xae, 0xb7, 0xc2, 0xa3, 0x41, 0xbd, 0xf9, 0xb5, 0xd8,
+  0xc0, 0xa3, 0xab, 0xbb, 0xeb, 0x0b, 0xc1, 0x93, 0x47, 0x25, 0x53, 0xa5, 0x51, 0x2b, 0xfa, 0x40,
+  0xc3, 0x26, 0x82, 0xcb, 0xa8, 0x40, 0xcb, 0x88, 0xc1, 0xd2, 0x7a, 0x4a, 0xe3, 0xd5, 0x80, 0x55,
+  0x06, 0x05, 0x00, 0xc0, 0xa2, 0xad, 0xbd, 0x5d, 0x41, 0xb5, 0xd8, 0xad, 0xb8, 0xc0, 0x9d, 0xa6,
+  0xb6, 0xb1, 0x0c, 0xc1, 0x96, 0x47, 0x26, 0x3d, 0xa4, 0x50, 0x2a, 0xf4, 0x44, 0xc3, 0x26, 0xcb,
+  0xa8, 0xcb, 0xa8, 0xcb, 0x88, 0xcb, 0x88, 0xc1, 0xd1, 0x79, 0x49, 0xdc, 0xff, 0xaa, 0x00, 0x03,
+  0x04, 0x00, 0xc1, 0x99, 0x99, 0xaa, 0x0f, 0xa4, 0xad, 0xbb, 0xfd, 0x40, 0xa5, 0x77, 0xc0, 0x92,
+  0x9e, 0xb2, 0x3f, 0x0d, 0xc1, 0x92, 0x47, 0x26, 0x2f, 0xa1, 0x4d, 0x29, 0xed, 0x40, 0xc3, 0x27,
+  0x82, 0xcb, 0x88, 0x40, 0xcb, 0x67, 0xc1, 0xd0, 0x79, 0x48, 0xd5, 0xff, 0x80, 0x00, 0x02, 0x03,
+  0x01, 0xc2, 0x9a, 0xa6, 0xb5, 0xc2, 0x9c, 0xa5, 0xb6, 0xf5, 0xaa, 0xaa, 0xaa, 0x03, 0x0e, 0xc1,
+  0x92, 0x49, 0x24, 0x23, 0xa0, 0x4d, 0x28, 0xe4, 0x41, 0xc3, 0x47, 0xcb, 0x88, 0x82, 0xcb, 0x67,
+  0xc0, 0xd0, 0x78, 0x46, 0xc7, 0x03, 0x01, 0xc1, 0x93, 0xa2, 0xb2, 0x21, 0x95, 0xa0, 0xb2, 0x59,
+  0x10, 0xc1, 0x92, 0x49, 0x24, 0x15, 0x9e, 0x4c, 0x28, 0xd3, 0x40, 0xc3, 0x47, 0x82, 0xcb, 0x67,
+  0x40, 0xc3, 0x47, 0xc0, 0xd0, 0x77, 0x47, 0xba, 0x02, 0x15, 0xc1, 0x9d, 0x4e, 0x27, 0x0d, 0x9f,
+  0x4c, 0x27, 0xc5, 0x41, 0xc3, 0x47, 0xcb, 0x67, 0x82, 0xc3, 0x47, 0xc0, 0xcf, 0x77, 0x47, 0xa9,
+  0x01, 0x16, 0xc1, 0x99, 0x33, 0x33, 0x05, 0x9d, 0x4b, 0x29, 0xae, 0x44, 0xc3, 0x27, 0xc3, 0x47,
+  0xc3, 0x47, 0xc3, 0x27, 0xc3, 0x26, 0xc0, 0xce, 0x78, 0x47, 0x68, 0x00, 0x17, 0xc1, 0xff, 0x00,
+  0x00, 0x01, 0x9b, 0x4c, 0x27, 0x9b, 0x43, 0xc3, 0x27, 0xc3, 0x47, 0xc3, 0x26, 0xc3, 0x26, 0xc0,
+  0xbe, 0x68, 0x39, 0xbb, 0x00, 0x19, 0xc0, 0xa0, 0x4c, 0x27, 0x83, 0x42, 0xc3, 0x26, 0xc3, 0x26,
+  0xc3, 0x27, 0xc0, 0xa0, 0x4c, 0x2a, 0x43, 0x00, 0x1a, 0xc2, 0x95, 0x45, 0x25, 0x59, 0x9d, 0x4a,
+  0x27, 0xbd, 0x95, 0x45, 0x25, 0x59, 0x01, 0x1f,
+};
+const DisplayImage imagePickaxe = { 32, 32, imagePickaxeData, 1256 };
+
+// pool_connected.png: 32x32, 1942 bytes as PNG, 1768 as runs
+static const uint8_t imagePoolConnectedData[] PROGMEM = {
+  0x1b, 0xc1, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x78, 0x01, 0x1b, 0xc2, 0x2b, 0x2b, 0x2b,
+  0x9c, 0x83, 0x83, 0x83, 0xf8, 0xaf, 0xaf, 0xaf, 0x6c, 0x00, 0x1a, 0xc1, 0x4c, 0x4c, 0x4c, 0x79,
+  0xae, 0xae, 0xae, 0xf7, 0x40, 0xad, 0x75, 0xc1, 0x7c, 0x7c, 0x7c, 0xf6, 0x16, 0x16, 0x16, 0x74,
+  0x18, 0xc2, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x1d, 0x1d, 0xb2, 0xa6, 0xa6, 0xa6, 0xf7, 0x40, 0xad,
+  0x75, 0xc2, 0x7d, 0x7d, 0x7d, 0xf7, 0x1a, 0x1a, 0x1a, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x11, 0xc3,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0xc3, 0x07, 0x07, 0x00, 0x24, 0x28, 0x20, 0x05, 0xd7, 0x1b, 0x15, 0x07, 0xe5, 0x73, 0x73,
+  0x73, 0xfa, 0x40, 0xad, 0x75, 0xc2, 0x7d, 0x7d, 0x7d, 0xf6, 0x18, 0x18, 0x18, 0xb1, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x0f, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x24, 0x0d, 0x09, 0x88, 0x3f, 0x17, 0x0f,
+  0xdd, 0x7b, 0x2e, 0x1d, 0xea, 0x6d, 0x28, 0x1b, 0xe6, 0x2e, 0x11, 0x0c, 0xdc, 0x17, 0x09, 0x05,
+  0x71, 0x33, 0x29, 0x07, 0xdc, 0x41, 0xe5, 0x83, 0xdd, 0x63, 0xc3, 0x37, 0x2f, 0x12, 0xeb, 0x6d,
+  0x6d, 0x6d, 0xf8, 0x1a, 0x1a, 0x1a, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0e, 0xc2, 0x00, 0x00,
+  0x00, 0x01, 0x23, 0x0e, 0x09, 0xaa, 0xa4, 0x41, 0x2c, 0xf5, 0x43, 0xfc, 0xd0, 0xfd, 0x12, 0xfd,
+  0x32, 0xfc, 0x4e, 0xc1, 0x67, 0x2c, 0x19, 0xee, 0x83, 0x69, 0x11, 0xf3, 0x42, 0xf6, 0x04, 0xf6,
+  0x04, 0xdd, 0x63, 0xc1, 0x1d, 0x18, 0x07, 0xe1, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0d, 0xc2, 0x00,
+  0x00, 0x00, 0x01, 0x20, 0x0c, 0x08, 0xa8, 0xaa, 0x41, 0x2c, 0xf4, 0x45, 0xfd, 0x33, 0xfb, 0x8a,
+  0xfa, 0xe7, 0xfa, 0xe7, 0xfc, 0x0d, 0xfc, 0xf1, 0xc1, 0x73, 0x34, 0x1a, 0xef, 0x8f, 0x73, 0x14,
+  0xf2, 0x41, 0xf6, 0x04, 0xdd, 0x83, 0xc0, 0x2c, 0x24, 0x06, 0xcf, 0x03, 0x0b, 0xc3, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x23, 0x21, 0x0c, 0x08, 0xa8, 0xaa, 0x43, 0x2e, 0xf4, 0x41, 0xfb,
+  0xcb, 0xfb, 0x49, 0x83, 0xfa, 0xe7, 0x41, 0xfb, 0xec, 0xfc, 0xf1, 0xc3, 0x72, 0x33, 0x1b, 0xef,
+  0x81, 0x65, 0x12, 0xf2, 0x30, 0x26, 0x07, 0xdb, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x0a, 0xc3, 0x20,
+  0x19, 0x05, 0x6f, 0x5d, 0x4a, 0x0c, 0xe9, 0x3b, 0x2c, 0x09, 0xe7, 0x63, 0x2b, 0x1c, 0xfc, 0x41,
+  0xf3, 0x29, 0xfb, 0x69, 0x82, 0xfa, 0xe7, 0x44, 0xb2, 0x25, 0xca, 0x46, 0xfa, 0xe7, 0xfb, 0xec,
+  0xfc, 0xf1, 0xc1, 0x67, 0x2b, 0x19, 0xed, 0x15, 0x07, 0x05, 0x6b, 0x04, 0x09, 0xc1, 0x00, 0x00,
+  0x00, 0x35, 0x4f, 0x3f, 0x0b, 0xe5, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x4a, 0x2b, 0x0f, 0xf1,
+  0x91, 0x3f, 0x2a, 0xfe, 0x49, 0xf2, 0xc7, 0xfa, 0xe7, 0xfa, 0xe7, 0x9a, 0x06, 0x7b, 0x8e, 0x5a,
+  0x69, 0xca, 0x66, 0xfa, 0xe7, 0xfb, 0xcb, 0xf3, 0x08, 0xc0, 0x2f, 0x12, 0x0c, 0xda, 0x04, 0x08,
+  0xc2, 0x20, 0x17, 0x05, 0x70, 0x4c, 0x3d, 0x0a, 0xe5, 0x39, 0x2e, 0x08, 0xe9, 0x42, 0xdd, 0x63,
+  0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x4a, 0x2b, 0x10, 0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x45, 0xf2, 0xc7,
+  0xfa, 0xe7, 0x91, 0xe5, 0x94, 0x92, 0x6b, 0x2c, 0xc2, 0x46, 0x82, 0xfa, 0xe7, 0xc1, 0x66, 0x26,
+  0x18, 0xe5, 0x00, 0x00, 0x00, 0x17, 0x03, 0x07, 0xc1, 0x05, 0x05, 0x00, 0x35, 0x5f, 0x4c, 0x0d,
+  0xea, 0x41, 0xf6, 0x04, 0xd5, 0x63, 0xc0, 0x3c, 0x30, 0x08, 0xeb, 0x42, 0xdd, 0x63, 0xf6, 0x04,
+  0xed, 0xe3, 0xc1, 0x4a, 0x2c, 0x0f, 0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x43, 0xf2, 0xc7, 0xf2, 0xc7,
+  0x92, 0x05, 0xaa, 0x26, 0x83, 0xfa, 0xe7, 0xc1, 0x71, 0x2a, 0x1b, 0xe8, 0x00, 0x00, 0x00, 0x21,
+  0x03, 0x07, 0xc1, 0x00, 0x00, 0x00, 0x28, 0x3e, 0x34, 0x0d, 0xe8, 0x42, 0xed, 0xe4, 0xf6, 0x04,
+  0xd5, 0x63, 0xc0, 0x3c, 0x30, 0x08, 0xeb, 0x42, 0xdd, 0x63, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x4a,
+  0x2c, 0x0f, 0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x40, 0xf2, 0xc7, 0x85, 0xfa, 0xe7, 0xc1, 0x3d, 0x16,
+  0x0f, 0xdb, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0xc3, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1a, 0x20,
+  0xa9, 0x28, 0x54, 0x66, 0xfc, 0x38, 0x41, 0x2d, 0xf1, 0x42, 0xed, 0xe4, 0xf6, 0x04, 0xd5, 0x63,
+  0xc0, 0x3d, 0x31, 0x08, 0xeb, 0x42, 0xdd, 0x63, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x4a, 0x2c, 0x0f,
+  0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x40, 0xf2, 0xc7, 0x83, 0xfa, 0xe7, 0xc1, 0x9a, 0x39, 0x25, 0xf2,
+  0x23, 0x0c, 0x08, 0x7b, 0x04, 0x05, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x1a, 0x1e, 0xa8, 0x4e,
+  0x84, 0x9e, 0xf3, 0x40, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1, 0x42,
+  0xed, 0xe4, 0xf6, 0x04, 0xd5, 0x63, 0xc0, 0x7a, 0x62, 0x10, 0xda, 0x42, 0xf6, 0x04, 0xf6, 0x04,
+  0xed, 0xe3, 0xc1, 0x4a, 0x2c, 0x10, 0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x42, 0xf2, 0xc7, 0xfa, 0xe7,
+  0xfa, 0xe7, 0xc1, 0xa2, 0x3c, 0x28, 0xf4, 0x26, 0x0e, 0x0a, 0xa1, 0x05, 0x04, 0xc2, 0x00, 0x00,
+  0x00, 0x01, 0x0f, 0x1a, 0x1e, 0xa8, 0x4e, 0x84, 0x9e, 0xf3, 0x42, 0x76, 0x1d, 0x76, 0x1d, 0x6d,
+  0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1, 0x42, 0xed, 0xe4, 0xf6, 0x04, 0xf6,
+  0x04, 0xc0, 0xa0, 0x7f, 0x15, 0xd1, 0x42, 0xed, 0xc3, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x4a, 0x2c,
+  0x10, 0xf1, 0x91, 0x3f, 0x2a, 0xfe, 0x40, 0xf2, 0xc7, 0xc1, 0xa2, 0x3c, 0x28, 0xf4, 0x24, 0x0e,
+  0x09, 0xa2, 0x06, 0x04, 0xc1, 0x10, 0x1b, 0x21, 0x8c, 0x48, 0x7a, 0x92, 0xf5, 0x83, 0x76, 0x1d,
+  0x40, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1, 0x42, 0xed, 0xe4, 0xf6,
+  0x04, 0xed, 0xc3, 0xc0, 0x3d, 0x31, 0x08, 0xeb, 0x42, 0xdd, 0x63, 0xf6, 0x04, 0xed, 0xe3, 0xc2,
+  0x4a, 0x2b, 0x0f, 0xf2, 0x5e, 0x28, 0x1a, 0xfc, 0x26, 0x0e, 0x09, 0xa2, 0x07, 0x03, 0xc1, 0x00,
+  0x00, 0x00, 0x03, 0x1b, 0x2f, 0x39, 0xe0, 0x85, 0x76, 0x1d, 0x40, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e,
+  0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1, 0x42, 0xed, 0xe4, 0xf6, 0x04, 0xdd, 0x63, 0xc0, 0x3d, 0x31,
+  0x08, 0xeb, 0x42, 0xdd, 0x63, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x39, 0x2c, 0x09, 0xe7, 0x00, 0x00,
+  0x00, 0x20, 0x07, 0x03, 0xc1, 0x00, 0x00, 0x00, 0x2d, 0x38, 0x62, 0x75, 0xeb, 0x83, 0x76, 0x1d,
+  0x43, 0x4b, 0xf2, 0x4b, 0xb1, 0x75, 0xfc, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41,
+  0x2d, 0xf1, 0x42, 0xed, 0xe4, 0xf6, 0x04, 0xdd, 0x63, 0xc0, 0x3d, 0x31, 0x08, 0xeb, 0x41, 0xdd,
+  0x63, 0xf6, 0x04, 0xc1, 0x54, 0x43, 0x0b, 0xe7, 0x00, 0x00, 0x00, 0x2a, 0x07, 0x03, 0xc1, 0x00,
+  0x00, 0x00, 0x22, 0x34, 0x58, 0x6b, 0xe8, 0x82, 0x76, 0x1d, 0x45, 0x54, 0x54, 0x73, 0xae, 0x8c,
+  0x71, 0x4b, 0xd1, 0x76, 0x1d, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1,
+  0x42, 0xed, 0xe4, 0xf6, 0x04, 0xdd, 0x63, 0xc2, 0x38, 0x2d, 0x08, 0xe9, 0x48, 0x39, 0x0a, 0xe4,
+  0x1e, 0x17, 0x03, 0x65, 0x08, 0x03, 0xc1, 0x00, 0x00, 0x00, 0x03, 0x16, 0x25, 0x2d, 0xde, 0x49,
+  0x76, 0x1d, 0x86, 0x5d, 0x76, 0x1d, 0x5c, 0xb6, 0x52, 0xcb, 0x6b, 0x6d, 0x54, 0x33, 0x76, 0x1d,
+  0x76, 0x1d, 0x6d, 0xfc, 0xc1, 0x3c, 0x7e, 0x99, 0xfe, 0x38, 0x41, 0x2d, 0xf1, 0x41, 0xed, 0xe4,
+  0xf6, 0x04, 0xc3, 0x46, 0x38, 0x09, 0xe3, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x16, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x04, 0xc1,
+  0x0b, 0x13, 0x13, 0x76, 0x3a, 0x58, 0x5f, 0xee, 0x44, 0x86, 0x5d, 0x86, 0x5d, 0x76, 0x1d, 0x5c,
+  0xd7, 0x54, 0x95, 0x82, 0x76, 0x1d, 0x41, 0x76, 0x3d, 0x6d, 0xfc, 0xcc, 0x27, 0x51, 0x62, 0xfc,
+  0x3d, 0x34, 0x0c, 0xe7, 0x56, 0x44, 0x0b, 0xe8, 0x1e, 0x17, 0x03, 0x65, 0x00, 0x00, 0x00, 0x26,
+  0x04, 0x30, 0x1b, 0xe4, 0x05, 0x2a, 0x18, 0xdf, 0x03, 0x18, 0x0e, 0xa8, 0x05, 0x2e, 0x1b, 0xdc,
+  0x08, 0x4b, 0x2a, 0xe5, 0x07, 0x41, 0x26, 0xe2, 0x04, 0x24, 0x15, 0xce, 0x04, 0x12, 0x0b, 0x46,
+  0x01, 0x03, 0xc3, 0x07, 0x07, 0x00, 0x24, 0x32, 0x28, 0x07, 0xdd, 0x7c, 0x64, 0x12, 0xf4, 0x43,
+  0x5f, 0x60, 0xef, 0x41, 0xa6, 0xbe, 0x8e, 0x7d, 0x83, 0x76, 0x1d, 0x41, 0x86, 0x5d, 0xae, 0xde,
+  0xc3, 0x4a, 0x7d, 0x96, 0xf2, 0x10, 0x1b, 0x21, 0xa0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x19, 0x05, 0x2e, 0x1a, 0xe0, 0x41, 0x15, 0xac, 0x15, 0x2b,
+  0x82, 0x15, 0xed, 0x40, 0x15, 0xcd, 0xc1, 0x08, 0x4e, 0x2d, 0xea, 0x03, 0x19, 0x0f, 0x65, 0x00,
+  0x02, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x29, 0x21, 0x06, 0xd8, 0x41, 0xe5, 0x83, 0xf6, 0x04, 0xc1,
+  0x87, 0x6d, 0x13, 0xf1, 0x43, 0x5f, 0x62, 0xed, 0x45, 0xa6, 0xbe, 0x8e, 0x7e, 0x76, 0x1d, 0x76,
+  0x1d, 0x86, 0x5d, 0xae, 0xde, 0xc1, 0x4c, 0x7e, 0x96, 0xf5, 0x11, 0x1c, 0x23, 0xa2, 0x04, 0xc0,
+  0x03, 0x19, 0x0f, 0xab, 0x40, 0x15, 0x2b, 0x82, 0x15, 0xed, 0x42, 0x15, 0x0b, 0x13, 0x28, 0x15,
+  0x8c, 0xc1, 0x06, 0x35, 0x1f, 0xe1, 0x00, 0x00, 0x00, 0x16, 0x02, 0xc1, 0x00, 0x00, 0x00, 0x04,
+  0x1d, 0x17, 0x07, 0xe4, 0x42, 0xdd, 0x83, 0xf6, 0x04, 0xf6, 0x04, 0xc1, 0x7a, 0x62, 0x12, 0xf2,
+  0x39, 0x57, 0x61, 0xed, 0x43, 0x96, 0x9e, 0xa6, 0xde, 0xa6, 0xde, 0x9e, 0xbe, 0xc1, 0x47, 0x78,
+  0x8f, 0xf3, 0x10, 0x1b, 0x20, 0xa0, 0x04, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x05, 0x31, 0x1c, 0xdc,
+  0x46, 0x15, 0xed, 0x1b, 0x48, 0x13, 0x88, 0x14, 0xeb, 0x32, 0x47, 0xad, 0x55, 0x1b, 0x07, 0xc1,
+  0x0f, 0x95, 0x55, 0xfe, 0x02, 0x18, 0x0e, 0x7e, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x04, 0x19, 0x19,
+  0x19, 0xb8, 0x70, 0x70, 0x70, 0xf9, 0x37, 0x2f, 0x14, 0xeb, 0x41, 0xdd, 0x83, 0xdd, 0x83, 0xc6,
+  0x30, 0x26, 0x07, 0xdc, 0x0c, 0x13, 0x18, 0x6c, 0x17, 0x28, 0x2f, 0xda, 0x3b, 0x64, 0x79, 0xe2,
+  0x59, 0x98, 0xb7, 0xdc, 0x55, 0x8f, 0xad, 0xab, 0x11, 0x1d, 0x21, 0x7a, 0x05, 0xc1, 0x00, 0x00,
+  0x00, 0x1b, 0x08, 0x4f, 0x2d, 0xe5, 0x47, 0x14, 0xeb, 0x5b, 0x4c, 0x8c, 0xb2, 0x32, 0x27, 0xe7,
+  0x1c, 0x42, 0x89, 0x14, 0xcb, 0x15, 0xcd, 0xc0, 0x03, 0x1e, 0x11, 0xb3, 0x00, 0xc2, 0x00, 0x00,
+  0x00, 0x04, 0x19, 0x19, 0x19, 0xb8, 0x83, 0x83, 0x83, 0xf8, 0x40, 0xad, 0x75, 0xc3, 0x6b, 0x6b,
+  0x6b, 0xf8, 0x1d, 0x18, 0x06, 0xe3, 0x28, 0x20, 0x05, 0xd4, 0x00, 0x00, 0x00, 0x1e, 0x01, 0xc2,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x06, 0xc1, 0x00, 0x00,
+  0x00, 0x11, 0x07, 0x46, 0x27, 0xe3, 0x47, 0x15, 0xed, 0x1a, 0x46, 0xb5, 0xd7, 0xef, 0x5d, 0x42,
+  0x89, 0x14, 0xaa, 0x15, 0xed, 0x15, 0x6c, 0xc0, 0x03, 0x1e, 0x11, 0xa3, 0xc2, 0x00, 0x00, 0x00,
+  0x03, 0x19, 0x19, 0x19, 0xb6, 0x82, 0x82, 0x82, 0xf8, 0x40, 0xad, 0x75, 0xc2, 0x7d, 0x7d, 0x7d,
+  0xf8, 0x18, 0x18, 0x18, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x0e, 0xc0, 0x04, 0x25, 0x15, 0xd0, 0x46,
+  0x15, 0xed, 0x15, 0xcd, 0x22, 0xa7, 0x2a, 0x26, 0x14, 0xaa, 0x15, 0xed, 0x15, 0xed, 0xc1, 0x0b,
+  0x6b, 0x3d, 0xf2, 0x00, 0x0b, 0x04, 0x47, 0xc1, 0x18, 0x18, 0x18, 0x7d, 0x83, 0x83, 0x83, 0xf8,
+  0x40, 0xad, 0x75, 0xc2, 0x7d, 0x7d, 0x7d, 0xf7, 0x18, 0x18, 0x18, 0xb2, 0x00, 0x00, 0x00, 0x02,
+  0x0f, 0xc1, 0x03, 0x14, 0x0d, 0x4c, 0x09, 0x54, 0x30, 0xeb, 0x84, 0x15, 0xed, 0x40, 0x15, 0x2b,
+  0xc0, 0x03, 0x1f, 0x11, 0xc5, 0x00, 0x00, 0xc3, 0xb0, 0xb0, 0xb0, 0x71, 0x7d, 0x7d, 0x7d, 0xf7,
+  0x18, 0x18, 0x18, 0xb7, 0x00, 0x00, 0x00, 0x03, 0x11, 0xc1, 0x02, 0x1a, 0x0e, 0x6d, 0x06, 0x3a,
+  0x21, 0xe2, 0x42, 0x0c, 0xcb, 0x15, 0xcd, 0x15, 0x6c, 0xc2, 0x0a, 0x6d, 0x3e, 0xf3, 0x03, 0x1f,
+  0x12, 0xc5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0xc1, 0x17, 0x17, 0x17, 0x79, 0x00, 0x00, 0x00,
+  0x02, 0x13, 0xc4, 0x00, 0x00, 0x00, 0x19, 0x02, 0x19, 0x0f, 0x84, 0x03, 0x20, 0x12, 0xb7, 0x03,
+  0x1f, 0x11, 0xa7, 0x00, 0x0a, 0x07, 0x49, 0x02,
+};
+const DisplayImage imagePoolConnected = { 32, 32, imagePoolConnectedData, 1768 };
+
+// pool_disconnected.png: 32x32, 2089 bytes as PNG, 1915 as runs
+static const uint8_t imagePoolDisconnectedData[] PROGMEM = {
+  0x1b, 0xc1, 0x00, 0x00, 0x00, 0x0d, 0x1b, 0x1b, 0x1b, 0x79, 0x01, 0x19, 0xc4, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x15, 0x1c, 0x1c, 0x1c, 0xcc, 0x93, 0x93, 0x93, 0xfb, 0xaf, 0xaf, 0xaf,
+  0x59, 0x00, 0x14, 0xc2, 0x06, 0x0c, 0x0c, 0x2c, 0x26, 0x39, 0x42, 0x1b, 0x00, 0x00, 0x00, 0x25,
+  0x00, 0xc3, 0x0b, 0x0b, 0x00, 0x2f, 0x33, 0x2a, 0x07, 0xdc, 0x25, 0x1f, 0x07, 0xe9, 0x76, 0x75,
+  0x74, 0xfc, 0x40, 0xad, 0x75, 0xc1, 0x47, 0x47, 0x47, 0xe7, 0x04, 0x04, 0x04, 0x3b, 0x12, 0xc6,
+  0x10, 0x1d, 0x22, 0x62, 0x27, 0x43, 0x50, 0xd9, 0x6e, 0xb2, 0xd3, 0xf4, 0x75, 0xb8, 0xdc, 0xfc,
+  0x31, 0x52, 0x62, 0xe7, 0x11, 0x1a, 0x1e, 0xb9, 0x3a, 0x2f, 0x08, 0xe0, 0x41, 0xe5, 0xc3, 0xe5,
+  0xc3, 0xc2, 0x41, 0x35, 0x0f, 0xec, 0x3b, 0x3b, 0x3a, 0xeb, 0x17, 0x17, 0x17, 0x63, 0x00, 0x11,
+  0xc1, 0x0d, 0x16, 0x1d, 0x73, 0x35, 0x59, 0x6b, 0xea, 0x43, 0xa6, 0xbe, 0xa6, 0xbe, 0x9e, 0x9e,
+  0xae, 0xde, 0xc1, 0x66, 0x9e, 0xb8, 0xfd, 0x41, 0x38, 0x12, 0xec, 0x42, 0xed, 0xc3, 0xf6, 0x04,
+  0xe5, 0xc3, 0xc0, 0x2c, 0x23, 0x06, 0xd2, 0x01, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x04, 0xc1,
+  0x0d, 0x16, 0x1d, 0x73, 0x36, 0x5c, 0x6e, 0xea, 0x45, 0xa6, 0xde, 0x86, 0x5d, 0x76, 0x1d, 0x76,
+  0x1d, 0x76, 0x3d, 0xae, 0xde, 0xc1, 0x67, 0x9f, 0xba, 0xfd, 0x41, 0x38, 0x12, 0xec, 0x40, 0xed,
+  0xc3, 0xc1, 0xa3, 0x83, 0x16, 0xf5, 0x26, 0x1e, 0x05, 0x99, 0x01, 0x0d, 0xc3, 0x0c, 0x0c, 0x00,
+  0x2a, 0x22, 0x1b, 0x04, 0xba, 0x11, 0x1d, 0x20, 0xa1, 0x35, 0x5a, 0x6d, 0xed, 0x41, 0x8e, 0x7e,
+  0x86, 0x5d, 0x83, 0x76, 0x1d, 0x41, 0x76, 0x3d, 0xa6, 0xde, 0xc3, 0x5d, 0x9c, 0xb7, 0xfb, 0x2f,
+  0x2a, 0x0e, 0xed, 0x21, 0x1b, 0x05, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0c, 0xc1, 0x00, 0x00,
+  0x00, 0x13, 0x38, 0x2c, 0x08, 0xe0, 0x40, 0xdd, 0x83, 0xc1, 0x32, 0x39, 0x28, 0xf1, 0x3e, 0x82,
+  0x9d, 0xfd, 0x48, 0x6d, 0xfc, 0x76, 0x1d, 0x76, 0x1d, 0x76, 0x1c, 0x3a, 0xac, 0x32, 0x09, 0x65,
+  0x79, 0x76, 0x1d, 0x96, 0x9e, 0xc1, 0x59, 0x92, 0xae, 0xfb, 0x13, 0x20, 0x27, 0x96, 0x02, 0x0c,
+  0xc1, 0x13, 0x10, 0x02, 0x6e, 0xa5, 0x83, 0x15, 0xfb, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x34,
+  0x3d, 0x2d, 0xf1, 0x3e, 0x82, 0x9d, 0xfd, 0x45, 0x6d, 0xfc, 0x76, 0x1d, 0x5c, 0xf7, 0x52, 0xcb,
+  0x8c, 0x71, 0x3b, 0x0e, 0x82, 0x76, 0x1d, 0xc1, 0x1d, 0x30, 0x3b, 0xdd, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x0c, 0xc2, 0x00, 0x00, 0x00, 0x07, 0x21, 0x1b, 0x04, 0xbf, 0xbd, 0x98, 0x1a, 0xf9, 0x41,
+  0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x34, 0x3d, 0x2d, 0xf2, 0x3e, 0x82, 0x9d, 0xfd, 0x44, 0x6d, 0xfc,
+  0x6d, 0xfc, 0x29, 0xe8, 0x29, 0xc7, 0x5c, 0xf7, 0x82, 0x76, 0x1d, 0xc1, 0x2f, 0x50, 0x61, 0xe5,
+  0x00, 0x00, 0x00, 0x18, 0x01, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x01, 0xc2, 0x00, 0x00, 0x00,
+  0x07, 0x21, 0x1b, 0x04, 0xbf, 0xbd, 0x98, 0x1a, 0xf9, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x34,
+  0x3d, 0x2d, 0xf2, 0x3e, 0x82, 0x9d, 0xfd, 0x40, 0x6d, 0xfc, 0x85, 0x76, 0x1d, 0xc1, 0x20, 0x37,
+  0x43, 0xdd, 0x00, 0x00, 0x00, 0x03, 0x01, 0x0e, 0xc2, 0x00, 0x00, 0x00, 0x07, 0x21, 0x1b, 0x04,
+  0xbf, 0xbd, 0x98, 0x1a, 0xf9, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x34, 0x3d, 0x2d, 0xf2, 0x3e,
+  0x82, 0x9d, 0xfd, 0x40, 0x6d, 0xfc, 0x83, 0x76, 0x1d, 0xc1, 0x5d, 0x9f, 0xbf, 0xfe, 0x11, 0x1c,
+  0x22, 0xb4, 0x02, 0x0b, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x22, 0x22, 0x22, 0x90, 0x22, 0x22, 0x22,
+  0x95, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x21, 0x1b, 0x04, 0xbf, 0xbd, 0x98, 0x1a,
+  0xf9, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x34, 0x3d, 0x2d, 0xf2, 0x3e, 0x82, 0x9d, 0xfd, 0x43,
+  0x6d, 0xfc, 0x76, 0x1d, 0x76, 0x1d, 0x65, 0x59, 0xc1, 0x13, 0x21, 0x27, 0xd2, 0x00, 0x00, 0x00,
+  0x0f, 0x02, 0x06, 0xc2, 0x00, 0x00, 0x00, 0x22, 0x0f, 0x0d, 0x03, 0x65, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0xc4, 0x00, 0x00, 0x00, 0x03, 0x21, 0x21, 0x21, 0xb7, 0xab, 0xab, 0xab, 0xf9, 0x81, 0x81,
+  0x81, 0xf6, 0x00, 0x00, 0x00, 0x43, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x06, 0x23, 0x1b, 0x04, 0xbd,
+  0xbb, 0x96, 0x18, 0xfa, 0x41, 0xf6, 0x04, 0xed, 0xe4, 0xc1, 0x37, 0x41, 0x2f, 0xf1, 0x3d, 0x7e,
+  0x9a, 0xfe, 0x41, 0x6d, 0xfc, 0x65, 0x59, 0xc1, 0x14, 0x23, 0x2a, 0xd4, 0x00, 0x00, 0x00, 0x14,
+  0x03, 0x05, 0xc6, 0x0c, 0x0c, 0x00, 0x2a, 0x37, 0x2d, 0x08, 0xdf, 0x9c, 0x7c, 0x14, 0xf9, 0x22,
+  0x1b, 0x04, 0xbb, 0x00, 0x00, 0x00, 0x08, 0x21, 0x21, 0x21, 0xb7, 0xb1, 0xb1, 0xb1, 0xf8, 0x40,
+  0xe7, 0x1c, 0xc1, 0x31, 0x31, 0x31, 0xdc, 0x00, 0x00, 0x00, 0x12, 0x01, 0xc2, 0x00, 0x00, 0x00,
+  0x07, 0x21, 0x1b, 0x04, 0xbf, 0xbd, 0x98, 0x1a, 0xf9, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc3, 0x34,
+  0x3d, 0x2c, 0xf2, 0x35, 0x6e, 0x86, 0xfe, 0x14, 0x23, 0x2a, 0xd6, 0x00, 0x00, 0x00, 0x13, 0x04,
+  0x05, 0xc0, 0x23, 0x1b, 0x05, 0xbf, 0x41, 0xe5, 0xa3, 0xf6, 0x04, 0xc2, 0xb4, 0x91, 0x19, 0xf9,
+  0x11, 0x0f, 0x09, 0xea, 0xab, 0xab, 0xab, 0xf7, 0x40, 0xe7, 0x1c, 0xc1, 0x35, 0x35, 0x35, 0xdf,
+  0x07, 0x07, 0x07, 0x24, 0x03, 0xc2, 0x00, 0x00, 0x00, 0x07, 0x23, 0x1d, 0x05, 0xc2, 0xbd, 0x97,
+  0x19, 0xfb, 0x41, 0xf6, 0x04, 0xed, 0xe3, 0xc1, 0x35, 0x33, 0x17, 0xed, 0x04, 0x04, 0x00, 0x40,
+  0x05, 0x05, 0xc1, 0x12, 0x1c, 0x1d, 0xa6, 0x3a, 0x3f, 0x28, 0xf1, 0x41, 0xed, 0xe4, 0xf6, 0x04,
+  0xc0, 0xb6, 0x93, 0x1b, 0xfc, 0x40, 0x5a, 0x88, 0xc1, 0x33, 0x33, 0x33, 0xdd, 0x07, 0x07, 0x07,
+  0x24, 0x02, 0xc5, 0x21, 0x21, 0x21, 0x6d, 0x22, 0x22, 0x22, 0x87, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x07, 0x23, 0x1d, 0x05, 0xc2, 0xbd, 0x97, 0x19, 0xfb, 0x40, 0xf6, 0x04, 0xc1, 0x8c,
+  0x70, 0x13, 0xf4, 0x11, 0x0e, 0x03, 0x5c, 0x05, 0x04, 0xc3, 0x0d, 0x16, 0x1d, 0x72, 0x33, 0x5a,
+  0x6c, 0xec, 0x3b, 0x7b, 0x96, 0xfe, 0x3a, 0x43, 0x2f, 0xf1, 0x41, 0xed, 0xe4, 0xf6, 0x04, 0xc2,
+  0xb6, 0x92, 0x19, 0xfc, 0x21, 0x1a, 0x05, 0xc2, 0x00, 0x00, 0x00, 0x05, 0x01, 0xc3, 0x20, 0x20,
+  0x20, 0x98, 0x89, 0x89, 0x89, 0xf2, 0x88, 0x88, 0x88, 0xf9, 0x0f, 0x0f, 0x0f, 0x57, 0x00, 0xc4,
+  0x00, 0x00, 0x00, 0x07, 0x24, 0x1c, 0x05, 0xc1, 0x61, 0x4d, 0x0c, 0xe7, 0x22, 0x1b, 0x05, 0xa3,
+  0x00, 0x00, 0x00, 0x01, 0x05, 0x03, 0xc1, 0x0d, 0x16, 0x1d, 0x72, 0x34, 0x5a, 0x6c, 0xea, 0x41,
+  0x76, 0x1d, 0x6d, 0xfc, 0xc1, 0x3b, 0x7b, 0x96, 0xfe, 0x3a, 0x43, 0x2f, 0xf1, 0x41, 0xed, 0xe4,
+  0xf6, 0x04, 0xc4, 0xb6, 0x91, 0x18, 0xfa, 0x24, 0x1e, 0x05, 0xbd, 0x00, 0x00, 0x00, 0x05, 0x20,
+  0x20, 0x20, 0x99, 0x92, 0x92, 0x92, 0xf1, 0x40, 0xef, 0x5d, 0xc1, 0x40, 0x40, 0x40, 0xe4, 0x00,
+  0x00, 0x00, 0x23, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x07, 0x02, 0xc1,
+  0x0f, 0x18, 0x1d, 0x69, 0x35, 0x59, 0x6b, 0xeb, 0x82, 0x76, 0x1d, 0x40, 0x6d, 0xfc, 0xc1, 0x3b,
+  0x7b, 0x96, 0xfe, 0x3a, 0x43, 0x2e, 0xf0, 0x41, 0xed, 0xe4, 0xf6, 0x04, 0xc2, 0xb6, 0x91, 0x18,
+  0xfa, 0x15, 0x12, 0x08, 0xe2, 0x8e, 0x8e, 0x8e, 0xf0, 0x40, 0xef, 0x5d, 0xc1, 0x45, 0x45, 0x45,
+  0xe5, 0x14, 0x14, 0x14, 0x3f, 0x0c, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x12, 0x1c, 0x30, 0x39, 0xe4,
+  0x84, 0x76, 0x1d, 0x40, 0x6d, 0xfc, 0xc1, 0x3b, 0x7b, 0x96, 0xfe, 0x3a, 0x43, 0x2e, 0xf0, 0x41,
+  0xed, 0xe4, 0xf6, 0x04, 0xc0, 0xb5, 0x92, 0x1a, 0xfd, 0x40, 0x5a, 0xa8, 0xc1, 0x44, 0x44, 0x44,
+  0xe4, 0x15, 0x15, 0x15, 0x3e, 0x0d, 0x01, 0xc1, 0x03, 0x03, 0x06, 0x58, 0x4a, 0x7e, 0x98, 0xf8,
+  0x83, 0x76, 0x1d, 0x42, 0x5d, 0x18, 0x6d, 0xfc, 0x6d, 0xfc, 0xc1, 0x3b, 0x7b, 0x96, 0xfe, 0x3a,
+  0x43, 0x2f, 0xf1, 0x41, 0xed, 0xe4, 0xf6, 0x04, 0xc2, 0xb6, 0x92, 0x19, 0xfc, 0x1f, 0x1a, 0x05,
+  0xc8, 0x00, 0x00, 0x00, 0x05, 0x02, 0xc2, 0x00, 0x00, 0x00, 0x0d, 0x18, 0x08, 0x06, 0x7d, 0x00,
+  0x00, 0x00, 0x26, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0xc1,
+  0x0a, 0x0f, 0x14, 0x65, 0x53, 0x8e, 0xaa, 0xfe, 0x82, 0x76, 0x1d, 0x44, 0x3a, 0xac, 0x52, 0xab,
+  0x32, 0x09, 0x76, 0x1d, 0x6d, 0xfc, 0xc1, 0x3b, 0x7b, 0x96, 0xfe, 0x3b, 0x43, 0x2d, 0xf1, 0x41,
+  0xed, 0xe4, 0xf6, 0x04, 0xc2, 0xb4, 0x91, 0x19, 0xf9, 0x22, 0x1b, 0x04, 0xba, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0xc8, 0x1b, 0x0a, 0x06, 0x85, 0xa5, 0x3c, 0x28, 0xfe, 0x40, 0x17, 0x0f, 0xe0, 0x1f,
+  0x0b, 0x08, 0x9d, 0x3a, 0x15, 0x0e, 0xd9, 0x5b, 0x22, 0x15, 0xe3, 0x4e, 0x1c, 0x13, 0xe1, 0x2e,
+  0x12, 0x0b, 0xcb, 0x17, 0x08, 0x08, 0x42, 0x01, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x2a, 0x33, 0x56,
+  0x69, 0xea, 0x48, 0x7e, 0x3d, 0x76, 0x1d, 0x76, 0x1d, 0x32, 0x09, 0x94, 0x92, 0x29, 0xc7, 0x76,
+  0x1d, 0x76, 0x1d, 0x6d, 0xfc, 0xc1, 0x3b, 0x7b, 0x96, 0xfe, 0x3b, 0x43, 0x2d, 0xf1, 0x41, 0xed,
+  0xe4, 0xf6, 0x04, 0xc1, 0x5b, 0x48, 0x0c, 0xe6, 0x00, 0x00, 0x00, 0x22, 0x01, 0xc1, 0x06, 0x00,
+  0x00, 0x2e, 0x46, 0x1a, 0x11, 0xe3, 0x41, 0xea, 0xa7, 0xd2, 0x66, 0x82, 0xfa, 0xe7, 0x40, 0xf2,
+  0xc7, 0xc1, 0x65, 0x25, 0x19, 0xe9, 0x21, 0x0d, 0x08, 0x64, 0x00, 0x02, 0xc1, 0x13, 0x1c, 0x22,
+  0xbd, 0x6a, 0xa4, 0xc1, 0xfd, 0x44, 0x86, 0x5d, 0x76, 0x1d, 0x65, 0x59, 0x3a, 0xed, 0x5c, 0xd7,
+  0x82, 0x76, 0x1d, 0x40, 0x6d, 0xfc, 0xc3, 0x32, 0x69, 0x7e, 0xfe, 0x3e, 0x3a, 0x18, 0xed, 0x8e,
+  0x71, 0x13, 0xf4, 0x22, 0x1b, 0x05, 0xa3, 0x03, 0xc0, 0x1f, 0x0b, 0x08, 0xa4, 0x46, 0xd2, 0x66,
+  0xca, 0x66, 0x61, 0x85, 0xd2, 0x66, 0x81, 0xe5, 0x79, 0xc5, 0xfa, 0xe7, 0xc1, 0x47, 0x1a, 0x11,
+  0xe2, 0x00, 0x00, 0x00, 0x18, 0x01, 0xc3, 0x0b, 0x0b, 0x00, 0x2f, 0x3a, 0x2f, 0x08, 0xe0, 0x3d,
+  0x35, 0x11, 0xec, 0x6a, 0xa4, 0xc0, 0xfd, 0x40, 0xae, 0xde, 0x84, 0x76, 0x1d, 0x41, 0xa6, 0xde,
+  0x6d, 0x79, 0xc3, 0x14, 0x22, 0x2b, 0xd7, 0x04, 0x04, 0x00, 0x46, 0x12, 0x10, 0x03, 0x62, 0x00,
+  0x00, 0x00, 0x01, 0x03, 0xc0, 0x3c, 0x16, 0x0e, 0xda, 0x47, 0xfa, 0xe7, 0x59, 0x85, 0xd6, 0x9a,
+  0x52, 0x08, 0xa4, 0xd3, 0x6a, 0xeb, 0xd2, 0x66, 0xca, 0x46, 0xc0, 0x21, 0x0c, 0x08, 0x83, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0x0b, 0x34, 0x2a, 0x07, 0xdd, 0x41, 0xe5, 0xc3, 0xe5, 0xc3, 0xc1, 0x3c,
+  0x34, 0x11, 0xeb, 0x6c, 0xa5, 0xc2, 0xfd, 0x45, 0xae, 0xde, 0x76, 0x3d, 0x76, 0x1d, 0x76, 0x1d,
+  0xa6, 0xde, 0x75, 0x9a, 0xc1, 0x14, 0x23, 0x2a, 0xd5, 0x00, 0x00, 0x00, 0x13, 0x05, 0xc1, 0x00,
+  0x00, 0x00, 0x14, 0x60, 0x24, 0x17, 0xe4, 0x47, 0xfa, 0xe7, 0xca, 0x66, 0x5a, 0x48, 0xef, 0x7d,
+  0xc6, 0x38, 0x51, 0x64, 0xfa, 0xe7, 0xf2, 0xc7, 0xc0, 0x28, 0x0f, 0x0a, 0xb9, 0x00, 0xc1, 0x00,
+  0x00, 0x00, 0x19, 0x2c, 0x23, 0x08, 0xe8, 0x42, 0xed, 0xc3, 0xf6, 0x04, 0xe5, 0xc3, 0xc1, 0x2d,
+  0x29, 0x10, 0xed, 0x65, 0x9e, 0xba, 0xfd, 0x42, 0xa6, 0xde, 0xa6, 0xde, 0xae, 0xde, 0xc2, 0x6d,
+  0xa8, 0xc7, 0xfe, 0x13, 0x21, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x13, 0x06, 0xc1, 0x00, 0x00, 0x00,
+  0x0d, 0x56, 0x20, 0x14, 0xe2, 0x47, 0xfa, 0xe7, 0x81, 0xe5, 0xa4, 0xf3, 0xce, 0x59, 0xe7, 0x1c,
+  0x49, 0xc6, 0xea, 0xa7, 0xea, 0xa7, 0xc0, 0x28, 0x0f, 0x0a, 0xab, 0xc3, 0x00, 0x00, 0x00, 0x0d,
+  0x1c, 0x1c, 0x1c, 0xcc, 0x71, 0x70, 0x6f, 0xfc, 0x43, 0x37, 0x10, 0xeb, 0x40, 0xed, 0xc3, 0xc7,
+  0xa3, 0x83, 0x16, 0xf5, 0x21, 0x1a, 0x05, 0xaa, 0x12, 0x1f, 0x25, 0xa7, 0x23, 0x3b, 0x47, 0xdb,
+  0x61, 0xa2, 0xc3, 0xd5, 0x5b, 0x9c, 0xba, 0xb6, 0x13, 0x22, 0x28, 0xae, 0x00, 0x00, 0x00, 0x0d,
+  0x08, 0xc0, 0x30, 0x11, 0x0c, 0xcf, 0x46, 0xf2, 0xc7, 0x71, 0xc5, 0x73, 0x2c, 0x51, 0x64, 0x51,
+  0xe7, 0x49, 0xa6, 0xe2, 0xa6, 0xc1, 0x9a, 0x38, 0x26, 0xf4, 0x13, 0x06, 0x03, 0x52, 0xc1, 0x1d,
+  0x1d, 0x1d, 0x7d, 0x93, 0x93, 0x93, 0xfb, 0x40, 0xad, 0x75, 0xc3, 0x39, 0x38, 0x37, 0xec, 0x2e,
+  0x24, 0x06, 0xd4, 0x24, 0x1e, 0x05, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x0a, 0xc1, 0x1b, 0x0a, 0x07, 0x4c, 0x70,
+  0x29, 0x1b, 0xeb, 0x45, 0xfa, 0xe7, 0xd2, 0x66, 0xfa, 0xe7, 0xe2, 0xa7, 0xe2, 0xa6, 0xe2, 0x86,
+  0xc1, 0x2b, 0x0f, 0x0a, 0xcb, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc2, 0xaf, 0xaf, 0xaf, 0x56, 0x46,
+  0x46, 0x46, 0xe7, 0x17, 0x17, 0x17, 0x63, 0x12, 0xc1, 0x24, 0x0e, 0x09, 0x70, 0x4f, 0x1d, 0x13,
+  0xe4, 0x42, 0xd2, 0x66, 0xfa, 0xe7, 0xf2, 0xc7, 0xc2, 0x9c, 0x39, 0x25, 0xf5, 0x2b, 0x10, 0x0a,
+  0xcc, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x01, 0x08, 0x08, 0x08, 0x3d,
+  0x14, 0xc5, 0x00, 0x00, 0x00, 0x1d, 0x24, 0x0d, 0x09, 0x8e, 0x28, 0x0f, 0x09, 0xbe, 0x28, 0x0e,
+  0x0a, 0xb1, 0x15, 0x09, 0x03, 0x57, 0x00, 0x00, 0x00, 0x02, 0x01,
+};
+const DisplayImage imagePoolDisconnected = { 32, 32, imagePoolDisconnectedData, 1915 };
+
+// wifi.png: 32x32, 1231 bytes as PNG, 1130 as runs
+static const uint8_t imageWifiData[] PROGMEM = {
+  0x1f, 0x1f, 0x1f, 0x1f, 0x08, 0xcd, 0xff, 0xaa, 0x00, 0x03, 0xff, 0xb8, 0x13, 0x36, 0xfd, 0xba,
+  0x11, 0x77, 0xfd, 0xba, 0x12, 0xa6, 0xfd, 0xbb, 0x11, 0xcd, 0xfd, 0xba, 0x12, 0xe0, 0xfd, 0xba,
+  0x12, 0xee, 0xff, 0x94, 0x01, 0xfe, 0xff, 0x95, 0x02, 0xfb, 0xff, 0x98, 0x03, 0xf5, 0xff, 0x9c,
+  0x05, 0xdf, 0xff, 0xa0, 0x06, 0xb6, 0xff, 0xa4, 0x08, 0x5f, 0xff, 0xaa, 0x00, 0x06, 0x08, 0x06,
+  0xc2, 0xff, 0xb9, 0x11, 0x2c, 0xfd, 0xba, 0x12, 0x90, 0xfd, 0xba, 0x12, 0xeb, 0x85, 0xfd, 0xc2,
+  0x85, 0xfc, 0x80, 0xc2, 0xff, 0x94, 0x01, 0xfd, 0xfe, 0x9e, 0x05, 0xcf, 0xff, 0xa3, 0x06, 0x50,
+  0x06, 0x04, 0xc2, 0xff, 0xbc, 0x11, 0x2e, 0xfe, 0xb9, 0x11, 0xb0, 0xfd, 0xba, 0x12, 0xfe, 0x87,
+  0xfd, 0xc2, 0x88, 0xfc, 0x80, 0xc1, 0xff, 0x9b, 0x04, 0xe6, 0xff, 0xa5, 0x06, 0x52, 0x04, 0x02,
+  0xc2, 0xff, 0xb3, 0x1a, 0x0a, 0xfd, 0xb9, 0x12, 0x8b, 0xfd, 0xba, 0x12, 0xfc, 0x84, 0xfd, 0xc2,
+  0xc9, 0xfd, 0xba, 0x12, 0xda, 0xfd, 0xbb, 0x12, 0x9d, 0xfd, 0xbb, 0x12, 0x74, 0xfc, 0xbb, 0x12,
+  0x56, 0xfb, 0xbc, 0x12, 0x48, 0xfd, 0xa2, 0x08, 0x7c, 0xfd, 0xa2, 0x07, 0x8f, 0xff, 0xa0, 0x06,
+  0xb4, 0xff, 0x9d, 0x05, 0xda, 0xff, 0x97, 0x02, 0xfa, 0x85, 0xfc, 0x80, 0xc1, 0xff, 0x9d, 0x06,
+  0xc9, 0xff, 0xaa, 0x0e, 0x12, 0x02, 0x01, 0xc1, 0xff, 0xba, 0x15, 0x25, 0xfd, 0xba, 0x12, 0xd4,
+  0x83, 0xfd, 0xc2, 0xc2, 0xfd, 0xba, 0x12, 0xe4, 0xfd, 0xb9, 0x12, 0x80, 0xff, 0xbc, 0x0f, 0x22,
+  0x09, 0xc2, 0xff, 0xa5, 0x08, 0x41, 0xfe, 0x9d, 0x05, 0xc1, 0xff, 0x96, 0x02, 0xfc, 0x83, 0xfc,
+  0x80, 0xc1, 0xff, 0x98, 0x03, 0xf7, 0xff, 0xa0, 0x0b, 0x43, 0x01, 0x00, 0xc1, 0xff, 0xb8, 0x11,
+  0x3d, 0xfd, 0xba, 0x12, 0xef, 0x82, 0xfd, 0xc2, 0xc2, 0xfd, 0xba, 0x12, 0xeb, 0xfd, 0xb9, 0x11,
+  0x6a, 0xff, 0xb6, 0x00, 0x07, 0x0d, 0xc2, 0xff, 0xa4, 0x00, 0x0e, 0xff, 0xa0, 0x08, 0xa9, 0xfe,
+  0x94, 0x01, 0xfe, 0x82, 0xfc, 0x80, 0xc1, 0xff, 0x94, 0x01, 0xfe, 0xff, 0xa4, 0x07, 0x6a, 0x00,
+  0xc1, 0xff, 0xba, 0x10, 0x3f, 0xfd, 0xba, 0x12, 0xf4, 0x82, 0xfd, 0xc2, 0xc1, 0xfd, 0xba, 0x12,
+  0xa9, 0xff, 0xbf, 0x0d, 0x14, 0x03, 0xc9, 0xff, 0xb9, 0x12, 0x1d, 0xfc, 0xbb, 0x12, 0x61, 0xfd,
+  0xbb, 0x13, 0x95, 0xfe, 0xb9, 0x12, 0xb7, 0xfc, 0xba, 0x12, 0xc8, 0xff, 0x98, 0x03, 0xf3, 0xff,
+  0x9a, 0x04, 0xea, 0xff, 0x9d, 0x05, 0xd2, 0xfd, 0xa2, 0x07, 0x9c, 0xff, 0xa4, 0x0a, 0x35, 0x03,
+  0xc1, 0xff, 0xa6, 0x06, 0x28, 0xff, 0x9b, 0x04, 0xe3, 0x83, 0xfc, 0x80, 0xc0, 0xff, 0xa5, 0x07,
+  0x6e, 0xc0, 0xfd, 0xba, 0x12, 0xe1, 0x41, 0xfd, 0xc2, 0xfd, 0xc2, 0xc1, 0xfd, 0xba, 0x12, 0xfd,
+  0xfd, 0xb9, 0x12, 0x71, 0x02, 0xc3, 0xff, 0xff, 0x00, 0x01, 0xfc, 0xb9, 0x13, 0x50, 0xfc, 0xba,
+  0x11, 0xbf, 0xfd, 0xba, 0x12, 0xfe, 0x83, 0xfd, 0xc2, 0x84, 0xfc, 0x80, 0xc2, 0xff, 0x99, 0x03,
+  0xee, 0xfd, 0xa2, 0x08, 0x86, 0xff, 0xff, 0x00, 0x02, 0x02, 0xc0, 0xff, 0x9f, 0x06, 0xb2, 0x82,
+  0xfc, 0x80, 0xc0, 0xff, 0x95, 0x02, 0xfb, 0xc0, 0xfd, 0xba, 0x12, 0xd9, 0x40, 0xfd, 0xc2, 0xc1,
+  0xfd, 0xba, 0x12, 0xfc, 0xfc, 0xba, 0x13, 0x5d, 0x02, 0xc1, 0xff, 0xbc, 0x11, 0x2e, 0xfc, 0xba,
+  0x12, 0xca, 0x86, 0xfd, 0xc2, 0x86, 0xfc, 0x80, 0xc1, 0xff, 0x98, 0x03, 0xf3, 0xff, 0xa5, 0x06,
+  0x52, 0x02, 0xc0, 0xff, 0xa2, 0x07, 0x99, 0x41, 0xfc, 0x80, 0xfc, 0x80, 0xc0, 0xff, 0x97, 0x02,
+  0xf9, 0xc2, 0xff, 0xba, 0x15, 0x25, 0xfd, 0xba, 0x12, 0x82, 0xff, 0xba, 0x10, 0x3f, 0x02, 0xc1,
+  0xfd, 0xba, 0x11, 0x67, 0xfd, 0xba, 0x12, 0xf9, 0x83, 0xfd, 0xc2, 0xc6, 0xfd, 0xba, 0x12, 0xf6,
+  0xfe, 0xba, 0x12, 0xb4, 0xfd, 0xba, 0x12, 0x91, 0xfd, 0xba, 0x11, 0x77, 0xff, 0xa0, 0x06, 0xb6,
+  0xfe, 0x9d, 0x05, 0xd0, 0xfe, 0x9a, 0x04, 0xea, 0x85, 0xfc, 0x80, 0xc0, 0xfd, 0xa1, 0x06, 0xa2,
+  0x02, 0xc2, 0xff, 0xa5, 0x07, 0x6e, 0xfe, 0x9f, 0x05, 0xc2, 0xff, 0xa3, 0x0b, 0x45, 0x04, 0xc0,
+  0xfd, 0xba, 0x12, 0x82, 0x83, 0xfd, 0xc2, 0xc2, 0xfd, 0xb9, 0x12, 0xd1, 0xfc, 0xb9, 0x12, 0x57,
+  0xff, 0xb9, 0x17, 0x0b, 0x05, 0xc2, 0xff, 0xb1, 0x0b, 0x17, 0xff, 0xa1, 0x07, 0x90, 0xff, 0x97,
+  0x03, 0xf7, 0x83, 0xfc, 0x80, 0xc0, 0xfe, 0x9e, 0x05, 0xc0, 0x04, 0x03, 0xc0, 0xfc, 0xbb, 0x13,
+  0x5e, 0x82, 0xfd, 0xc2, 0xc2, 0xfd, 0xba, 0x12, 0xf3, 0xfd, 0xbb, 0x11, 0x69, 0xff, 0xaa, 0x00,
+  0x03, 0x09, 0xc1, 0xff, 0x9f, 0x00, 0x08, 0xff, 0xa0, 0x08, 0xa9, 0x83, 0xfc, 0x80, 0xc0, 0xfd,
+  0xa1, 0x07, 0x98, 0x03, 0x03, 0xc0, 0xfd, 0xbb, 0x13, 0x95, 0x41, 0xfd, 0xc2, 0xfd, 0xc2, 0xc1,
+  0xfd, 0xba, 0x12, 0xeb, 0xff, 0xb8, 0x13, 0x36, 0x02, 0xc7, 0xff, 0x80, 0x00, 0x02, 0xfb, 0xb8,
+  0x14, 0x41, 0xfd, 0xba, 0x12, 0x7d, 0xfd, 0xba, 0x12, 0x98, 0xff, 0x9d, 0x05, 0xd5, 0xfe, 0x9e,
+  0x07, 0xbd, 0xfd, 0xa2, 0x09, 0x70, 0xff, 0x80, 0x00, 0x04, 0x02, 0xc1, 0xff, 0xa1, 0x08, 0x62,
+  0xff, 0x94, 0x01, 0xfd, 0x41, 0xfc, 0x80, 0xfc, 0x80, 0xc0, 0xff, 0x9d, 0x05, 0xd2, 0x03, 0x03,
+  0xc3, 0xff, 0xb9, 0x13, 0x28, 0xfd, 0xbb, 0x11, 0xcd, 0xfc, 0xba, 0x12, 0xc4, 0xff, 0xb7, 0x14,
+  0x27, 0x01, 0xc2, 0xff, 0xff, 0x00, 0x01, 0xfc, 0xba, 0x13, 0x60, 0xfd, 0xba, 0x12, 0xe4, 0x82,
+  0xfd, 0xc2, 0x82, 0xfc, 0x80, 0xc2, 0xff, 0x96, 0x02, 0xfc, 0xfd, 0xa0, 0x07, 0x9b, 0xff, 0xff,
+  0x00, 0x02, 0x01, 0xc3, 0xff, 0xa2, 0x0a, 0x4a, 0xff, 0x99, 0x03, 0xf2, 0xff, 0x98, 0x03, 0xf4,
+  0xff, 0xa2, 0x0a, 0x4a, 0x03, 0x08, 0xc1, 0xff, 0xbf, 0x20, 0x08, 0xfe, 0xba, 0x12, 0xb4, 0x84,
+  0xfd, 0xc2, 0x84, 0xfc, 0x80, 0xc1, 0xff, 0x9b, 0x04, 0xe8, 0xff, 0xaf, 0x10, 0x10, 0x08, 0x07,
+  0xc1, 0xff, 0x80, 0x00, 0x02, 0xfe, 0xba, 0x12, 0xb8, 0x83, 0xfd, 0xc2, 0xc3, 0xfc, 0xba, 0x12,
+  0xca, 0xfd, 0xba, 0x12, 0xa0, 0xfe, 0x9c, 0x05, 0xdc, 0xff, 0x98, 0x03, 0xf4, 0x83, 0xfc, 0x80,
+  0xc1, 0xff, 0x9a, 0x04, 0xeb, 0xff, 0x80, 0x00, 0x04, 0x07, 0x07, 0xc0, 0xff, 0xb9, 0x12, 0x3a,
+  0x82, 0xfd, 0xc2, 0xc1, 0xfc, 0xba, 0x12, 0xc8, 0xff, 0xbc, 0x11, 0x2e, 0x03, 0xc1, 0xff, 0xa5,
+  0x06, 0x55, 0xfe, 0x98, 0x03, 0xf4, 0x82, 0xfc, 0x80, 0xc0, 0xff, 0xa3, 0x08, 0x64, 0x07, 0x07,
+  0xc1, 0xff, 0xbc, 0x0d, 0x13, 0xfd, 0xba, 0x12, 0xe9, 0x40, 0xfd, 0xc2, 0xc1, 0xfe, 0xba, 0x12,
+  0xb9, 0xff, 0xc6, 0x1c, 0x09, 0x05, 0xc1, 0xff, 0xa6, 0x0d, 0x14, 0xff, 0x9a, 0x04, 0xeb, 0x40,
+  0xfc, 0x80, 0xc1, 0xff, 0x94, 0x01, 0xfd, 0xff, 0xa0, 0x07, 0x23, 0x07, 0x08, 0xc2, 0xff, 0xb8,
+  0x0e, 0x12, 0xff, 0xba, 0x11, 0x3b, 0xff, 0xbf, 0x00, 0x04, 0x01, 0xc3, 0xff, 0xbf, 0x0d, 0x14,
+  0xfd, 0xb9, 0x12, 0x66, 0xff, 0xa0, 0x06, 0xa3, 0xff, 0xa5, 0x07, 0x25, 0x01, 0xc2, 0xff, 0xaa,
+  0x00, 0x06, 0xff, 0xa1, 0x07, 0x67, 0xff, 0xa5, 0x07, 0x25, 0x08, 0x0c, 0xc1, 0xff, 0xb7, 0x10,
+  0x20, 0xfd, 0xba, 0x12, 0xe9, 0x41, 0xfd, 0xc2, 0xfc, 0x80, 0xc1, 0xff, 0x94, 0x01, 0xfd, 0xff,
+  0xa4, 0x09, 0x38, 0x0c, 0x0c, 0xc0, 0xfd, 0xba, 0x11, 0x94, 0x43, 0xfd, 0xc2, 0xfd, 0xc2, 0xfc,
+  0x80, 0xfc, 0x80, 0xc0, 0xff, 0x9d, 0x05, 0xd1, 0x0c, 0x0c, 0xc0, 0xfe, 0xba, 0x12, 0xaa, 0x43,
+  0xfd, 0xc2, 0xfd, 0xc2, 0xfc, 0x80, 0xfc, 0x80, 0xc0, 0xff, 0x9b, 0x05, 0xe2, 0x0c, 0x0c, 0xc0,
+  0xfc, 0xb9, 0x11, 0x5b, 0x43, 0xfd, 0xc2, 0xfd, 0xc2, 0xfc, 0x80, 0xfc, 0x80, 0xc0, 0xfd, 0xa1,
+  0x07, 0x93, 0x0c, 0x0d, 0xc3, 0xfd, 0xb9, 0x12, 0x71, 0xfd, 0xba, 0x12, 0xda, 0xff, 0x97, 0x02,
+  0xf9, 0xfe, 0xa0, 0x07, 0xae, 0x0d, 0x1f, 0x1f, 0x1f, 0x1f,
+};
+const DisplayImage imageWifi = { 32, 32, imageWifiData, 1130 };
+
+// wifi_slash.png: 32x32, 1118 bytes as PNG, 1375 as runs
+static const uint8_t imageWifiSlashData[] PROGMEM = {
+  0x1f, 0x1f, 0x02, 0xc1, 0xff, 0x0b, 0x0b, 0x30, 0xff, 0x0b, 0x0b, 0x30, 0x1a, 0x01, 0xc3, 0xff,
+  0x0b, 0x0b, 0x30, 0xff, 0x0b, 0x0b, 0xfd, 0xff, 0x0b, 0x0b, 0xfd, 0xff, 0x0a, 0x0a, 0x63, 0x19,
+  0x01, 0xc1, 0xff, 0x0b, 0x0b, 0x2f, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b,
+  0x0b, 0xfd, 0xff, 0x0a, 0x0a, 0x63, 0x18, 0x02, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b,
+  0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x02, 0xc9, 0xff,
+  0x90, 0x90, 0x17, 0xff, 0x8a, 0x8a, 0x55, 0xff, 0x8b, 0x8b, 0x7f, 0xff, 0x8a, 0x8a, 0x97, 0xff,
+  0x8a, 0x8a, 0xa4, 0xff, 0x8b, 0x8b, 0xa5, 0xff, 0x8a, 0x8a, 0x99, 0xff, 0x8b, 0x8b, 0x7f, 0xff,
+  0x8b, 0x8b, 0x58, 0xff, 0x8a, 0x8a, 0x25, 0x0a, 0x03, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b,
+  0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x1e, 0x1e, 0x79, 0x01, 0xc1,
+  0xff, 0x88, 0x88, 0x0f, 0xff, 0x8b, 0x8b, 0xc8, 0x87, 0xfc, 0x51, 0xc2, 0xff, 0x8b, 0x8b, 0xe2,
+  0xff, 0x8b, 0x8b, 0x91, 0xff, 0x8c, 0x8c, 0x33, 0x07, 0x04, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff,
+  0x0b, 0x0b, 0xfe, 0x41, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x3a, 0x3a, 0xa4, 0x01, 0xc1, 0xff,
+  0x88, 0x88, 0x0f, 0xff, 0x8b, 0x8b, 0xc8, 0x89, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xc0, 0xff,
+  0x8b, 0x8b, 0x42, 0x05, 0x03, 0xc1, 0xff, 0x8f, 0x8f, 0x19, 0xff, 0x8b, 0x8b, 0xab, 0x43, 0xfa,
+  0xcb, 0xf8, 0x61, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x36, 0x36, 0x9c, 0x01, 0xc8, 0xff, 0x8e,
+  0x8e, 0x09, 0xff, 0x8a, 0x8a, 0x18, 0xff, 0x80, 0x80, 0x08, 0xff, 0x99, 0x99, 0x05, 0xff, 0x86,
+  0x86, 0x13, 0xff, 0x8c, 0x8c, 0x33, 0xff, 0x8c, 0x8c, 0x5d, 0xff, 0x8a, 0x8a, 0x9b, 0xff, 0x8b,
+  0x8b, 0xe4, 0x83, 0xfc, 0x51, 0xc1, 0xff, 0x8c, 0x8c, 0xaa, 0xff, 0x8f, 0x8f, 0x19, 0x03, 0x02,
+  0xc1, 0xff, 0x8c, 0x8c, 0x47, 0xff, 0x8b, 0x8b, 0xe9, 0x42, 0xfc, 0x51, 0xfc, 0x51, 0xfa, 0xcb,
+  0xc0, 0xff, 0x0c, 0x0c, 0xfe, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c,
+  0x69, 0x08, 0xc2, 0xff, 0x80, 0x80, 0x02, 0xff, 0x8a, 0x8a, 0x46, 0xff, 0x8b, 0x8b, 0xb8, 0x82,
+  0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xe9, 0xff, 0x8a, 0x8a, 0x46, 0x02, 0x01, 0xc1, 0xff, 0x8b,
+  0x8b, 0x65, 0xff, 0x8b, 0x8b, 0xfc, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc3, 0xff, 0x8b, 0x8b, 0xd3,
+  0xff, 0x8a, 0x8a, 0x3f, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1,
+  0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x02, 0xc2, 0xff, 0x8e, 0x8e, 0x24, 0xff, 0x8a,
+  0x8a, 0x30, 0xff, 0x8e, 0x8e, 0x12, 0x04, 0xc1, 0xff, 0x8a, 0x8a, 0x3d, 0xff, 0x8a, 0x8a, 0xd2,
+  0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xfc, 0xff, 0x8b, 0x8b, 0x65, 0x01, 0x00,
+  0xc1, 0xff, 0x8c, 0x8c, 0x50, 0xff, 0x8b, 0x8b, 0xfe, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff,
+  0x8a, 0x8a, 0x8e, 0xff, 0x80, 0x80, 0x08, 0x01, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b,
+  0xfd, 0x41, 0xf8, 0x41, 0xf8, 0x41, 0xc0, 0xff, 0x3a, 0x3a, 0xa4, 0x01, 0xc1, 0xff, 0x88, 0x88,
+  0x0f, 0xff, 0x8b, 0x8b, 0xc8, 0x40, 0xfc, 0x51, 0xc2, 0xff, 0x8b, 0x8b, 0xe1, 0xff, 0x8a, 0x8a,
+  0x8e, 0xff, 0x8a, 0x8a, 0x3b, 0x02, 0xc2, 0xff, 0x80, 0x80, 0x06, 0xff, 0x8a, 0x8a, 0x90, 0xff,
+  0x8b, 0x8b, 0xfe, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc0, 0xff, 0x8b, 0x8b, 0x4f, 0x00, 0x00, 0xc0,
+  0xff, 0x8b, 0x8b, 0x6e, 0x40, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xfc, 0xff, 0x8c, 0x8c, 0x66,
+  0x02, 0xc1, 0xff, 0x8a, 0x8a, 0x3f, 0xff, 0x8c, 0x8c, 0xc9, 0x43, 0xfa, 0xcb, 0xf8, 0x61, 0xf8,
+  0x41, 0xf8, 0x61, 0xc0, 0xff, 0x3a, 0x3a, 0xa4, 0x01, 0xc1, 0xff, 0x88, 0x88, 0x0f, 0xff, 0x8a,
+  0x8a, 0xc7, 0x82, 0xfc, 0x51, 0xc1, 0xff, 0x8a, 0x8a, 0xc7, 0xff, 0x8c, 0x8c, 0x3c, 0x02, 0xc1,
+  0xff, 0x8b, 0x8b, 0x63, 0xff, 0x8b, 0x8b, 0xfc, 0x40, 0xfc, 0x51, 0xc0, 0xff, 0x8b, 0x8b, 0x6c,
+  0x00, 0x00, 0xc2, 0xff, 0x99, 0x99, 0x05, 0xff, 0x8b, 0x8b, 0x61, 0xff, 0x8d, 0x8d, 0x38, 0x01,
+  0xc2, 0xff, 0x80, 0x80, 0x08, 0xff, 0x8a, 0x8a, 0x99, 0xff, 0x8b, 0x8b, 0xfe, 0x44, 0xfc, 0x51,
+  0xfc, 0x51, 0xfa, 0xcb, 0xf8, 0x61, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x13, 0x13,
+  0x6e, 0x01, 0xc1, 0xff, 0x88, 0x88, 0x0f, 0xff, 0x8b, 0x8b, 0xc3, 0x82, 0xfc, 0x51, 0xc2, 0xff,
+  0x8b, 0x8b, 0xfe, 0xff, 0x8c, 0x8c, 0x94, 0xff, 0x99, 0x99, 0x05, 0x01, 0xc2, 0xff, 0x8d, 0x8d,
+  0x38, 0xff, 0x8b, 0x8b, 0x61, 0xff, 0x99, 0x99, 0x05, 0x00, 0x04, 0xc1, 0xff, 0x86, 0x86, 0x13,
+  0xff, 0x8b, 0x8b, 0xc4, 0x82, 0xfc, 0x51, 0xc3, 0xff, 0x8b, 0x8b, 0xb4, 0xff, 0x8c, 0x8c, 0x3e,
+  0xff, 0x0d, 0x0d, 0x63, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe,
+  0xff, 0x0c, 0x0c, 0x69, 0x02, 0xc2, 0xff, 0x8b, 0x8b, 0x39, 0xff, 0x8b, 0x8b, 0xb0, 0xff, 0x8b,
+  0x8b, 0xfe, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xbd, 0xff, 0x8e, 0x8e, 0x12,
+  0x04, 0x04, 0xc0, 0xff, 0x8a, 0x8a, 0xa4, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b,
+  0xe6, 0xff, 0x8c, 0x8c, 0x47, 0x02, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40,
+  0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x03, 0xc1, 0xff, 0x8b, 0x8b,
+  0x44, 0xff, 0x8b, 0x8b, 0xe3, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc0, 0xff, 0x8b, 0x8b, 0xa2, 0x04,
+  0x04, 0xc0, 0xff, 0x8b, 0x8b, 0x8a, 0x40, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xce, 0xff, 0x8d,
+  0x8d, 0x1d, 0x01, 0xc3, 0xff, 0xff, 0xff, 0x01, 0xff, 0x8b, 0x8b, 0x4b, 0xff, 0x8b, 0x8b, 0x9e,
+  0xff, 0x55, 0x55, 0xe7, 0x42, 0xf8, 0x61, 0xf8, 0x41, 0xf8, 0x41, 0xc0, 0xff, 0x38, 0x38, 0xa3,
+  0x03, 0xc1, 0xff, 0x8f, 0x8f, 0x19, 0xff, 0x8b, 0x8b, 0xcd, 0x40, 0xfc, 0x51, 0xc0, 0xff, 0x8c,
+  0x8c, 0x89, 0x04, 0x04, 0xc2, 0xff, 0xff, 0xff, 0x01, 0xff, 0x8b, 0x8b, 0x2c, 0xff, 0x80, 0x80,
+  0x06, 0x01, 0xc1, 0xff, 0x8c, 0x8c, 0x35, 0xff, 0x8b, 0x8b, 0xcb, 0x82, 0xfc, 0x51, 0x43, 0xfa,
+  0xcb, 0xf8, 0x61, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x3a, 0x3a, 0xa4, 0x03, 0xc2, 0xff, 0x80,
+  0x80, 0x06, 0xff, 0x8b, 0x8b, 0x2c, 0xff, 0xff, 0xff, 0x01, 0x04, 0x08, 0xc1, 0xff, 0x8a, 0x8a,
+  0x55, 0xff, 0x8b, 0x8b, 0xf7, 0x82, 0xfc, 0x51, 0xc2, 0xff, 0x8b, 0x8b, 0xdc, 0xff, 0x8b, 0x8b,
+  0xb5, 0xff, 0x4f, 0x4f, 0xd1, 0x42, 0xf8, 0x61, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x3a, 0x3a,
+  0xa4, 0x0a, 0x08, 0xc0, 0xff, 0x8b, 0x8b, 0xf0, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff, 0x8a,
+  0x8a, 0xaf, 0xff, 0x8b, 0x8b, 0x2c, 0x02, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd,
+  0x41, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x3a, 0x3a, 0xa4, 0x09, 0x08, 0xc2, 0xff, 0x8b, 0x8b,
+  0x9e, 0xff, 0x8b, 0x8b, 0xf3, 0xff, 0x8c, 0x8c, 0x6f, 0x05, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff,
+  0x0b, 0x0b, 0xfd, 0x41, 0xf8, 0x41, 0xf8, 0x61, 0xc0, 0xff, 0x2d, 0x2d, 0x8d, 0x08, 0x0d, 0xc3,
+  0xff, 0x8e, 0x8e, 0x2d, 0xff, 0x8b, 0x8b, 0x91, 0xff, 0x8b, 0x8b, 0x91, 0xff, 0x8b, 0x8b, 0x2c,
+  0x00, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b,
+  0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x07, 0x0c, 0xc1, 0xff, 0x8e, 0x8e, 0x2d, 0xff, 0x8b, 0x8b,
+  0xf7, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1, 0xff, 0x8b, 0x8b, 0xf7, 0xff, 0x8b, 0x8b, 0x2c, 0x00,
+  0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b,
+  0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x06, 0x0c, 0xc0, 0xff, 0x8c, 0x8c, 0x92, 0x83, 0xfc, 0x51, 0xc0,
+  0xff, 0x8a, 0x8a, 0x90, 0x01, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8,
+  0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x05, 0x0c, 0xc0, 0xff, 0x8b, 0x8b,
+  0x91, 0x83, 0xfc, 0x51, 0xc0, 0xff, 0x8b, 0x8b, 0x8f, 0x02, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff,
+  0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x04,
+  0x0c, 0xc1, 0xff, 0x8b, 0x8b, 0x2c, 0xff, 0x8b, 0x8b, 0xf7, 0x41, 0xfc, 0x51, 0xfc, 0x51, 0xc1,
+  0xff, 0x8b, 0x8b, 0xf6, 0xff, 0x88, 0x88, 0x2b, 0x03, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b,
+  0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x03, 0x0d,
+  0xc3, 0xff, 0x8b, 0x8b, 0x2c, 0xff, 0x8a, 0x8a, 0x90, 0xff, 0x8a, 0x8a, 0x90, 0xff, 0x88, 0x88,
+  0x2b, 0x05, 0xc1, 0xff, 0x0a, 0x0a, 0x62, 0xff, 0x0b, 0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff,
+  0x0b, 0x0b, 0xfe, 0xff, 0x0c, 0x0c, 0x69, 0x02, 0x18, 0xc1, 0xff, 0x0a, 0x0a, 0x63, 0xff, 0x0b,
+  0x0b, 0xfd, 0x40, 0xf8, 0x41, 0xc1, 0xff, 0x0b, 0x0b, 0xfd, 0xff, 0x0b, 0x0b, 0x2f, 0x01, 0x19,
+  0xc3, 0xff, 0x0a, 0x0a, 0x63, 0xff, 0x0b, 0x0b, 0xfd, 0xff, 0x0b, 0x0b, 0xfd, 0xff, 0x0b, 0x0b,
+  0x2e, 0x01, 0x1a, 0xc1, 0xff, 0x0b, 0x0b, 0x2f, 0xff, 0x0b, 0x0b, 0x2e, 0x02, 0x1f, 0x1f,
+};
+const DisplayImage imageWifiSlash = { 32, 32, imageWifiSlashData, 1375 };
+
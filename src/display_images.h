@@ -0,0 +1,27 @@
+// Generated by tools/build_display_images.py from graphics/. Do not edit.
+#ifndef DISPLAY_IMAGES_H
+#define DISPLAY_IMAGES_H
+
+#include <Arduino.h>
+
+// Run kinds, in the top two bits of each run's first byte
+#define IMAGE_RUN_CLEAR 0x00
+#define IMAGE_RUN_PIXELS 0x40
+#define IMAGE_RUN_REPEAT 0x80
+#define IMAGE_RUN_BLEND 0xc0
+
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  const uint8_t* data;
+  uint32_t length;
+} DisplayImage;
+
+extern const DisplayImage imageLogo;
+extern const DisplayImage imagePickaxe;
+extern const DisplayImage imagePoolConnected;
+extern const DisplayImage imagePoolDisconnected;
+extern const DisplayImage imageWifi;
+extern const DisplayImage imageWifiSlash;
+
+#endif
@@ -0,0 +1,156 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "lwip/dns.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "dnsCache.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Pool address cache.
+//
+// A reconnect used to look the pool up again every time, and a slow or dead
+// DNS server held the whole reconnect up for as long as lwIP kept trying.
+// Addresses are now kept for DNS_CACHE_TTL_MS. Once that runs out the name
+// is looked up again, but if that takes more than DNS_LOOKUP_TIMEOUT_MS or
+// fails, the last address that worked is used instead.
+//
+// Only the stratum task calls in here.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern MonitorData monitorData;
+
+typedef struct {
+  char host[MAX_POOL_URL_LENGTH + 1];
+  uint32_t ip;
+  uint32_t resolvedAt;
+  bool stale;
+} DnsCacheEntry;
+
+typedef struct {
+  struct tcpip_api_call_data call;    // Must be first
+  const char* host;
+  ip_addr_t addr;
+  uint32_t generation;
+} DnsLookupCall;
+
+static DnsCacheEntry entries[DNS_CACHE_ENTRIES];
+static uint8_t nextEntry = 0;
+
+// The lookup being waited on. A reply to one we've given up on has an old generation.
+static volatile uint32_t lookupGeneration = 0;
+static volatile bool lookupDone = false;
+static volatile uint32_t lookupAddr = 0;
+
+
+static DnsCacheEntry* findEntry(const char* host) {
+  for( uint8_t i = 0; i < DNS_CACHE_ENTRIES; i++ ) {
+    if( entries[i].host[0] && strcmp(entries[i].host, host) == 0 ) {
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+// Runs on the lwIP thread
+static void lookupFound(const char* name, const ip_addr_t* addr, void* arg) {
+  if( (uint32_t) (uintptr_t) arg != lookupGeneration ) {
+    return;
+  }
+  lookupAddr = (addr && IP_IS_V4(addr)) ? ip4_addr_get_u32(ip_2_ip4(addr)) : 0;
+  lookupDone = true;
+}
+
+static err_t lookupStart(struct tcpip_api_call_data* call) {
+  DnsLookupCall* c = (DnsLookupCall*) call;
+  return dns_gethostbyname(c->host, &c->addr, lookupFound, (void*) (uintptr_t) c->generation);
+}
+
+// Like WiFi.hostByName(), but gives up after timeoutMs
+static bool lookup(const char* host, uint32_t timeoutMs, uint32_t* ip) {
+  DnsLookupCall c;
+  memset(&c, 0, sizeof(c));
+  c.host = host;
+  c.generation = ++lookupGeneration;
+  lookupDone = false;
+
+  err_t err = tcpip_api_call(lookupStart, &c.call);
+  if( err == ERR_OK ) {
+    // Cached by lwIP, or the host was already an address
+    *ip = IP_IS_V4(&c.addr) ? ip4_addr_get_u32(ip_2_ip4(&c.addr)) : 0;
+    return *ip != 0;
+  }
+  if( err != ERR_INPROGRESS ) {
+    return false;
+  }
+
+  uint32_t start = millis();
+  while( ! lookupDone && millis() - start < timeoutMs ) {
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  if( ! lookupDone ) {
+    lookupGeneration++;     // Ignore it if it does turn up
+    return false;
+  }
+  *ip = lookupAddr;
+  return *ip != 0;
+}
+
+// The address to connect to for host, from the cache if it's fresh
+bool dnsResolve(const char* host, IPAddress& ip) {
+  DnsCacheEntry* e = findEntry(host);
+
+  if( e && ! e->stale && millis() - e->resolvedAt < DNS_CACHE_TTL_MS ) {
+    monitorData.dnsCacheHits++;
+    ip = IPAddress(e->ip);
+    return true;
+  }
+
+  uint32_t found = 0;
+  monitorData.dnsLookups++;
+  if( lookup(host, e ? DNS_LOOKUP_TIMEOUT_MS : DNS_LOOKUP_FIRST_TIMEOUT_MS, &found) ) {
+    if( ! e ) {
+      e = &entries[nextEntry];
+      nextEntry = (nextEntry + 1) % DNS_CACHE_ENTRIES;
+      safeStrnCpy(e->host, host, sizeof(e->host));
+    }
+    e->ip = found;
+    e->resolvedAt = millis();
+    e->stale = false;
+    ip = IPAddress(found);
+    return true;
+  }
+
+  if( e ) {
+    dbg("DNS: %s didn't resolve, using the last good address\n", host);
+    monitorData.dnsFallbacks++;
+    ip = IPAddress(e->ip);
+    return true;
+  }
+
+  dbg("DNS: can't resolve %s\n", host);
+  return false;
+}
+
+// The address didn't connect, so look it up again next time. It's kept as
+// the fallback in case DNS is what's broken.
+void dnsForget(const char* host) {
+  DnsCacheEntry* e = findEntry(host);
+  if( e ) {
+    e->stale = true;
+  }
+}
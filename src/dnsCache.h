@@ -0,0 +1,29 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef DNS_CACHE_H
+#define DNS_CACHE_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define DNS_CACHE_ENTRIES 4
+#define DNS_CACHE_TTL_MS 1800000          // lwIP doesn't pass the record's TTL up, so a fixed one
+#define DNS_LOOKUP_TIMEOUT_MS 3000        // Longer than this and we use the last good address
+#define DNS_LOOKUP_FIRST_TIMEOUT_MS 15000 // With no address to fall back on, as long as lwIP takes
+
+bool dnsResolve(const char* host, IPAddress& ip);
+void dnsForget(const char* host);
+
+#endif
@@ -13,8 +13,6 @@
  * GNU General Public License for more details.
  */
 #include <Arduino.h>
-#include <NTPClient.h>
-#include <WiFiUdp.h>
 #include "defines_n_types.h"
 #include "utils.h"
 #include "MyWiFi.h"
@@ -22,6 +20,12 @@
 #include "monitor.h"
 #include "esp_wifi.h"
 #include "miner.h"
+#include "journal.h"
+#include "timeService.h"
+#include "bootProfile.h"
+#include "eventTask.h"
+#include "displayTask.h"
+#include "freertos/timers.h"
 
 typedef struct {
   unsigned long lastDownTime;
@@ -37,7 +41,10 @@ Button button1 = {0, 0, 0, false, false, false};
 extern SetupData settings;
 extern MonitorData monitorData;
 
-extern QueueHandle_t appMessageQueueHandle;
+extern TaskHandle_t eventTaskHandle;
+
+static StaticTimer_t tickTimerBuffer;
+static TimerHandle_t tickTimer = NULL;
 
 uint32_t lastScreenTouch = millis();
 uint32_t lastDataSave = millis(); 
@@ -45,13 +52,6 @@ uint32_t lastWifiReconnect = millis();  // Last time we attempted to reconnect
 uint32_t wifiFailureStartTime = 0;    // When WiFi failure started (0 = not failing)
 
 
-WiFiUDP udp;
-
-// You can specify the time server pool and the offset (in seconds, can be
-// changed later with setTimeOffset() ). Additionally you can specify the
-// update interval (in milliseconds, can be changed using setUpdateInterval() ).
-NTPClient timeClient(udp, settings.ntpServer, 0, 60000);
-
 
 // Timer interrupt
 void IRAM_ATTR isr() {
@@ -71,7 +71,56 @@ void IRAM_ATTR isr() {
       button1.clicked = true;
     }        
   }
+  notifyEventTaskFromISR(EVENT_NOTIFY_BUTTON);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// The event task sleeps until one of these says there's something to do
+//////////////////////////////////////////////////////////////////////////////////////////
+void notifyEventTask(uint32_t bits) {
+  if( eventTaskHandle ) {
+    xTaskNotify(eventTaskHandle, bits, eSetBits);
+  }
+}
+
+void IRAM_ATTR notifyEventTaskFromISR(uint32_t bits) {
+  BaseType_t woken = pdFALSE;
+  if( eventTaskHandle ) {
+    xTaskNotifyFromISR(eventTaskHandle, bits, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Application actions. Producers OR their bits into pendingActions and never
+// wait; the event task swaps the whole mask out in one go, so an action posted
+// ten times before it runs is handled once, and nothing is lost to a full queue.
+//////////////////////////////////////////////////////////////////////////////////////////
+static volatile uint32_t pendingActions = 0;
+
+void postApplicationActions(uint16_t actions) {
+  uint32_t was = __atomic_fetch_or(&pendingActions, (uint32_t) actions, __ATOMIC_RELEASE);
+  if( was & actions ) {
+    // Posted from several tasks at once, so the count has to be atomic too
+    __atomic_fetch_add(&monitorData.appActionsCoalesced, 1, __ATOMIC_RELAXED);
+  }
+  notifyEventTask(EVENT_NOTIFY_APP_MESSAGE);
+}
+
+static void tickTimerCallback(TimerHandle_t timer) {
+  notifyEventTask(EVENT_NOTIFY_TICK);
+}
+
+#if ARDUINO_USB_CDC_ON_BOOT
+static void serialReceived(void* arg, esp_event_base_t base, int32_t id, void* data) {
+  notifyEventTask(EVENT_NOTIFY_SERIAL);
+}
+#else
+static void serialReceived() {
+  notifyEventTask(EVENT_NOTIFY_SERIAL);
 }
+#endif
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -92,7 +141,7 @@ void factoryReset() {
 void turnOnAccessPoint() {
   MyWiFi::enterAccessPointMode();
   #ifdef USE_DISPLAY
-    setCurrentScreen(SCREEN_ACCESS_POINT);
+    notifyDisplayTask(DISPLAY_NOTIFY_ACCESS_POINT);
   #endif
 }
 
@@ -115,38 +164,35 @@ void setLED1Levels() {
 
 }
 
+// The backlight is set here; anything that draws is handed to the display task
 void screenActionHandler(ApplicationMessage* am) {
 
-
   #ifdef USE_DISPLAY
+    uint32_t bits = 0;
+
     if( am->action & MAIN_ACTION_SET_BRIGHTNESS ) {
       setBrightness(settings.screenBrightness);
+      setDisplayDimmed(false);
     }
     if( am->action & MAIN_ACTION_SET_ROTATION ) {
-      setRotation(settings.screenRotation);
+      bits |= DISPLAY_NOTIFY_ROTATION;
     }
     if( am->action & MAIN_ACTION_GOTO_MAIN_SCREEN) {
-      setCurrentScreen(SCREEN_MINING);
+      bits |= DISPLAY_NOTIFY_MAIN_SCREEN;
       lastScreenTouch = millis();     
     }
     if( am->action & MAIN_ACTION_SHOW_FIRMWARE_SCREEN ) {
-      setCurrentScreen(SCREEN_FIRMWARE);
+      bits |= DISPLAY_NOTIFY_FIRMWARE_SCREEN;
     }
     if( am->action & MAIN_ACTION_REDRAW ) {
-      redraw();
+      bits |= DISPLAY_NOTIFY_REDRAW;
     }
     if( am->action & MAIN_ACTION_REFRESH ) {
-      // Get rid of back-to-back refresh requests
-      ApplicationMessage m;
-
-      //while( taskMessages.peekMessage(&m, 150) && m.action ==  MAIN_ACTION_REFRESH) {
-      while( xQueuePeek(appMessageQueueHandle, &m, 0) == pdTRUE && m.action == MAIN_ACTION_REFRESH ) {
-        //taskMessages.receiveMessage(&m, 150);
-        xQueueReceive(appMessageQueueHandle, &m, 0);
-      }
-      refreshDisplay();
-      updateScreenCycle();
-    }    
+      bits |= DISPLAY_NOTIFY_REFRESH;
+    }
+    if( bits ) {
+      notifyDisplayTask(bits);
+    }
   #endif
 
 }
@@ -165,6 +211,7 @@ void handleApplicationMessage(ApplicationMessage* am) {
   }
   
   if( am->action & MAIN_ACTION_RESTART ) {
+    journalFlush(true);
     ESP.restart();
   }
   
@@ -229,6 +276,16 @@ void handleSerialCommand(char *cmd) {
         doSerialOutput(mac);
       } else if(strcmp("model", &cmd[5]) == 0) {
         doSerialOutput(MINING_HARDWARE_MODEL);
+      } else if(strcmp("boot", &cmd[5]) == 0) {
+        char line[40];
+        for( uint8_t i = 0; i < BOOT_PHASE_COUNT; i++ ) {
+          if( bootPhaseMs(i) ) {
+            snprintf(line, sizeof(line), "%s %lu ms", bootPhaseName(i), (unsigned long) bootPhaseMs(i));
+            doSerialOutput(line);
+          }
+        }
+        snprintf(line, sizeof(line), "self test %s", minerSelfTestName(minerSelfTestState()));
+        doSerialOutput(line);
       }
     } else if( strcmp(CMD_ACCESS_POINT, cmd) == 0 && ! MyWiFi::isAccessPoint() ) {
       doSerialOutput(RESP_AP_MODE);
@@ -242,6 +299,72 @@ void handleSerialCommand(char *cmd) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Housekeeping that used to be checked on every pass, now once a second
+//////////////////////////////////////////////////////////////////////////////////////////
+static void handleTick() {
+
+  // Move a slow connect on to its next step
+  MyWiFi::checkConnect();
+
+  // A self-test that never finds its nonce has failed
+  minerSelfTestCheck();
+
+  // Reconnect to WiFi if need be
+  if( ! MyWiFi::isAccessPoint() && ! MyWiFi::isConnected() && ! MyWiFi::isConnecting() && millis() - lastWifiReconnect > WIFI_RECONNECT_TIME ) {
+    dbg("Reconnecting WiFi...");
+    MyWiFi::enterStationMode();
+    lastWifiReconnect = millis();
+    
+    // Track when failure started
+    if( wifiFailureStartTime == 0 ) {
+      wifiFailureStartTime = millis();
+    }
+    
+    // If failed for too long, enter AP mode for alternative config
+    if( millis() - wifiFailureStartTime > WIFI_FAILURE_TIMEOUT ) {
+      // Only enter AP mode automatically if we've never successfully connected
+      if( ! MyWiFi::hasEverConnected() ) {
+        dbg("WiFi connection failed for 1 minute, never connected before; entering AP mode for alternative config...");
+        turnOnAccessPoint();
+        wifiFailureStartTime = 0;  // Reset failure timer after entering AP mode
+      } else {
+        dbg("WiFi connection failed for 1 minute, but previously connected; keep retrying, not entering AP mode.");
+        // Keep wifiFailureStartTime running - don't reset it, so we only log this message once
+      }
+    }
+  }
+
+  // Reset failure timer when connection is successful
+  if( MyWiFi::isConnected() && wifiFailureStartTime != 0 ) {
+    wifiFailureStartTime = 0;
+  }
+
+  if( MyWiFi::isConnected() ) {
+    timeBegin();
+  }
+
+  // Save statistics
+  if( millis() - lastDataSave >= DATA_SAVE_FREQUENCY_MS ) {
+    if( settings.saveMonitorData ) {
+      dbg("Saving data....\n");
+      saveMonitorData();
+    }
+    lastDataSave = millis();
+  }
+
+  // SNTP keeps the system clock in the background, so this is just a read
+  monitorData.currentTime = timeNow();
+
+  #ifdef USE_DISPLAY
+  if( settings.inactivityTimer && millis() - lastScreenTouch > settings.inactivityTimer) {
+    setBrightness(settings.inactivityBrightness); // Turn off the display
+    setDisplayDimmed(true);
+  }
+  #endif
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Main event task for app
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -250,63 +373,34 @@ void eventTask(void *task_id) {
   int16_t serialCommandLength = 0;
   char serialCommand[256];
 
+  // Producers may run before xTaskCreate hands the handle back to setup()
+  eventTaskHandle = xTaskGetCurrentTaskHandle();
+
   // Set up the interrupt handler on the button
   pinMode(PIN_INPUT, INPUT_PULLUP);
   attachInterrupt(PIN_INPUT, isr, CHANGE);
 
-  int16_t ntpFrequencyCounter = 0;  
-  
-  bool timeClientActive = false;
+  #if ARDUINO_USB_CDC_ON_BOOT
+    Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, serialReceived);
+  #else
+    Serial.onReceive(serialReceived);
+  #endif
 
-  while(1) {
-  
+  tickTimer = xTimerCreateStatic("EventTick", pdMS_TO_TICKS(EVENT_TICK_MS), pdTRUE, NULL, tickTimerCallback, &tickTimerBuffer);
+  xTimerStart(tickTimer, 0);
 
-    // Reconnect to WiFi if need be
-    if( ! MyWiFi::isAccessPoint() && ! MyWiFi::isConnected() && ! MyWiFi::isConnecting() && millis() - lastWifiReconnect > WIFI_RECONNECT_TIME ) {
-      dbg("Reconnecting WiFi...");
-      MyWiFi::enterStationMode();
-      lastWifiReconnect = millis();
-      
-      // Track when failure started
-      if( wifiFailureStartTime == 0 ) {
-        wifiFailureStartTime = millis();
-      }
-      
-      // If failed for too long, enter AP mode for alternative config
-      if( millis() - wifiFailureStartTime > WIFI_FAILURE_TIMEOUT ) {
-        // Only enter AP mode automatically if we've never successfully connected
-        if( ! MyWiFi::hasEverConnected() ) {
-          dbg("WiFi connection failed for 1 minute, never connected before; entering AP mode for alternative config...");
-          turnOnAccessPoint();
-          wifiFailureStartTime = 0;  // Reset failure timer after entering AP mode
-        } else {
-          dbg("WiFi connection failed for 1 minute, but previously connected; keep retrying, not entering AP mode.");
-          // Keep wifiFailureStartTime running - don't reset it, so we only log this message once
-        }
-      }
-    }
+  // Look at everything once in case something arrived before we were listening
+  uint32_t events = EVENT_NOTIFY_ALL;
 
-    // Reset failure timer when connection is successful
-    if( MyWiFi::isConnected() && wifiFailureStartTime != 0 ) {
-      wifiFailureStartTime = 0;
-    }
+  while(1) {
 
-    if( ! timeClientActive && MyWiFi::isConnected() ) {
-      dbg("Starting NTP client...");
-      timeClient.begin();
-      timeClientActive = true;
-    }
+    monitorData.eventWakeups++;
 
-    // Save statistics
-    if( millis() - lastDataSave >= DATA_SAVE_FREQUENCY_MS ) {
-      if( settings.saveMonitorData ) {
-        dbg("Saving data....\n");
-        saveMonitorData();
-      }
-      lastDataSave = millis();
+    if( events & EVENT_NOTIFY_TICK ) {
+      handleTick();
     }
 
-
+    // A held button is checked again on each tick until it's let go
     if( button1.pressed ) {
       unsigned long l = millis() - button1.lastDownTime;
       if( l >= FACTORY_RESET_BUTTON_TIME ) {
@@ -317,66 +411,58 @@ void eventTask(void *task_id) {
         turnOnAccessPoint();
       } else {
         #if defined(USE_DISPLAY)      
-          handleScreenTouch();
+          notifyDisplayTask(DISPLAY_NOTIFY_NEXT_SCREEN);
         #endif
       }
       button1.clicked = false;
     }
 
-    if( uxQueueMessagesWaiting(appMessageQueueHandle) ) {
-      ApplicationMessage m;      
-      if( xQueueReceive(appMessageQueueHandle, &m, 0) == pdTRUE  ) {
-          handleApplicationMessage(&m);
-      }      
+    if( events & EVENT_NOTIFY_APP_MESSAGE ) {
+      ApplicationMessage m;
+      m.action = __atomic_exchange_n(&pendingActions, 0, __ATOMIC_ACQUIRE);
+      if( m.action ) {
+        handleApplicationMessage(&m);
+      }
     }
 
     #ifdef USE_DISPLAY
-    if( screenTouched() ) {
+    if( (events & EVENT_NOTIFY_TOUCH) && screenTouched() ) {
       lastScreenTouch = millis();
       setBrightness(settings.screenBrightness);
+      setDisplayDimmed(false);
       
       int16_t c = 10;
       while( screenTouched() && c-- > 0) {
         vTaskDelay(20/portTICK_PERIOD_MS);
       }
       if( c < 4 ) {
-        handleScreenTouch();
+        notifyDisplayTask(DISPLAY_NOTIFY_NEXT_SCREEN);
       }
-      
-    } else if( settings.inactivityTimer && millis() - lastScreenTouch > settings.inactivityTimer) {
-      setBrightness(settings.inactivityBrightness); // Turn off the display
     }
     #endif
 
-
-
-    // Every once in a while deal with the NTP stuff
-    if( ++ntpFrequencyCounter % 10 == 0 && timeClientActive ) {
-      timeClient.update();
-      monitorData.currentTime = timeClient.getEpochTime();
-      ntpFrequencyCounter = 0;
-    }
-
     // Read commands off the serial port
-    while( Serial.available() ) {   
-      char receivedChar = Serial.read();
-      if( receivedChar == 10 || receivedChar == 13 ) {
-        if( serialCommandLength > 0 ) {
-          handleSerialCommand(serialCommand);
-        }        
-        serialCommandLength = 0;        
-        break;
-      } 
-      
-      if( serialCommandLength < 254 ) {
-        serialCommand[serialCommandLength++] = receivedChar;
-        serialCommand[serialCommandLength] = '\0';
+    if( events & EVENT_NOTIFY_SERIAL ) {
+      while( Serial.available() ) {   
+        char receivedChar = Serial.read();
+        if( receivedChar == 10 || receivedChar == 13 ) {
+          if( serialCommandLength > 0 ) {
+            handleSerialCommand(serialCommand);
+          }        
+          serialCommandLength = 0;        
+          continue;
+        } 
+        
+        if( serialCommandLength < 254 ) {
+          serialCommand[serialCommandLength++] = receivedChar;
+          serialCommand[serialCommandLength] = '\0';
+        }
       }
     }
 
-    vTaskDelay(100/portTICK_PERIOD_MS);  
-
-
+    // Sleep until an interrupt, a producer or the tick timer has something for us
+    events = 0;
+    xTaskNotifyWait(0, EVENT_NOTIFY_ALL, &events, portMAX_DELAY);
   }
 
-}
\ No newline at end of file
+}
@@ -15,6 +15,26 @@
 #ifndef EVENT_TASK_INCLUDED_H
 #define EVENT_TASK_INCLUDED_H
 
+#include <Arduino.h>
+#include "defines_n_types.h"
+
+// Reasons to wake the event task, delivered as task notification bits
+#define EVENT_NOTIFY_TICK 1           // Once a second from a software timer
+#define EVENT_NOTIFY_BUTTON 2
+#define EVENT_NOTIFY_TOUCH 4
+#define EVENT_NOTIFY_SERIAL 8
+#define EVENT_NOTIFY_APP_MESSAGE 16
+#define EVENT_NOTIFY_ALL 0x1f
+
+#define EVENT_TICK_MS 1000
+
 void eventTask(void *task_id);
+void notifyEventTask(uint32_t bits);
+void notifyEventTaskFromISR(uint32_t bits);
+
+// Application actions (MAIN_ACTION_*) are posted as bits and coalesce until
+// the event task gets to them. Actions carry no data; handlers read what
+// they need from settings or monitorData.
+void postApplicationActions(uint16_t actions);
 
 #endif
@@ -0,0 +1,188 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "fetchTask.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Background fetches.
+//
+// Whatever the screens show from the internet is fetched here, so a slow or
+// dead server only ever holds up this task. Each source keeps its last good
+// value. Reading one that's past its TTL still returns it, for staleMs more,
+// and asks this task for a new copy; the reader never waits on the network.
+// Failures back off, and the old value stays until it's too stale to show.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern MonitorData monitorData;
+extern TaskHandle_t fetchTaskHandle;
+
+typedef struct {
+  const FetchSource* source;
+  uint8_t value[FETCH_VALUE_SIZE];
+  bool valid;
+  uint32_t fetchedAt;
+  uint32_t retryAt;
+  uint32_t retryDelay;
+  volatile bool wanted;
+} FetchEntry;
+
+static FetchEntry entries[FETCH_MAX_SOURCES];
+static uint8_t entryCount = 0;
+
+static StaticSemaphore_t fetchMutexBuffer;
+static SemaphoreHandle_t fetchMutex = NULL;
+
+// Only ever used from the fetch task
+static char body[FETCH_BODY_SIZE];
+static uint8_t parsed[FETCH_VALUE_SIZE];
+
+
+void fetchBegin() {
+  fetchMutex = xSemaphoreCreateMutexStatic(&fetchMutexBuffer);
+}
+
+// Returns -1 if there's no room. The fetch task may already be running; it
+// picks the new source up on its next pass.
+int8_t fetchRegister(const FetchSource* source) {
+  xSemaphoreTake(fetchMutex, portMAX_DELAY);
+  if( entryCount >= FETCH_MAX_SOURCES || source->valueSize > FETCH_VALUE_SIZE ) {
+    xSemaphoreGive(fetchMutex);
+    dbg("Fetch: can't register %s\n", source->url);
+    return -1;
+  }
+  FetchEntry* e = &entries[entryCount];
+  e->source = source;
+  e->valid = false;
+  e->wanted = true;
+  e->retryAt = 0;
+  e->retryDelay = FETCH_RETRY_MS;
+  int8_t id = entryCount++;
+  xSemaphoreGive(fetchMutex);
+
+  if( fetchTaskHandle ) {
+    xTaskNotifyGive(fetchTaskHandle);
+  }
+  return id;
+}
+
+// Copies out the last good value. False if there isn't one, or it's too old to show.
+bool fetchGet(int8_t id, void* value) {
+  if( id < 0 || id >= entryCount || ! fetchMutex ) {
+    return false;
+  }
+  FetchEntry* e = &entries[id];
+
+  xSemaphoreTake(fetchMutex, portMAX_DELAY);
+  uint32_t age = millis() - e->fetchedAt;
+  bool usable = e->valid && age < e->source->ttlMs + e->source->staleMs;
+  if( usable ) {
+    memcpy(value, e->value, e->source->valueSize);
+  }
+  xSemaphoreGive(fetchMutex);
+
+  if( (! e->valid || age >= e->source->ttlMs) && ! e->wanted ) {
+    e->wanted = true;
+    if( fetchTaskHandle ) {
+      xTaskNotifyGive(fetchTaskHandle);
+    }
+  }
+  return usable;
+}
+
+// Reads at most FETCH_BODY_SIZE - 1 bytes; a longer body fails rather than being cut
+static int readBody(HTTPClient& http) {
+  int size = http.getSize();
+  if( size >= FETCH_BODY_SIZE ) {
+    return -1;
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  size_t want = size >= 0 ? size : FETCH_BODY_SIZE - 1;
+  size_t len = stream->readBytes(body, want);
+  if( size >= 0 ? len != (size_t) size : stream->available() > 0 ) {
+    return -1;
+  }
+  body[len] = 0;
+  return len;
+}
+
+static bool fetchOne(FetchEntry* e) {
+  HTTPClient http;
+  http.setConnectTimeout(FETCH_TIMEOUT_MS);
+  http.setTimeout(FETCH_TIMEOUT_MS);
+  http.useHTTP10(true);   // No chunked replies, so the length is known up front
+  if( ! http.begin(e->source->url) ) {
+    return false;
+  }
+
+  bool ok = false;
+  int code = http.GET();
+  if( code == HTTP_CODE_OK ) {
+    int len = readBody(http);
+    memset(parsed, 0, sizeof(parsed));
+    if( len >= 0 && e->source->parse(body, len, parsed) ) {
+      xSemaphoreTake(fetchMutex, portMAX_DELAY);
+      memcpy(e->value, parsed, e->source->valueSize);
+      e->valid = true;
+      e->fetchedAt = millis();
+      xSemaphoreGive(fetchMutex);
+      ok = true;
+    } else {
+      dbg("Fetch: bad response from %s\n", e->source->url);
+    }
+  } else {
+    dbg("Fetch: %s returned %d\n", e->source->url, code);
+  }
+  http.end();
+  return ok;
+}
+
+void fetchTask(void *task_id) {
+
+  // fetchGet() may run before xTaskCreate hands the handle back to setup()
+  fetchTaskHandle = xTaskGetCurrentTaskHandle();
+
+  while(1) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FETCH_POLL_MS));
+    if( WiFi.status() != WL_CONNECTED ) {
+      continue;
+    }
+
+    xSemaphoreTake(fetchMutex, portMAX_DELAY);
+    uint8_t count = entryCount;
+    xSemaphoreGive(fetchMutex);
+
+    for( uint8_t i = 0; i < count; i++ ) {
+      FetchEntry* e = &entries[i];
+      if( ! e->wanted || (int32_t) (millis() - e->retryAt) < 0 ) {
+        continue;
+      }
+
+      if( fetchOne(e) ) {
+        monitorData.fetchSuccesses++;
+        e->retryDelay = FETCH_RETRY_MS;
+        e->wanted = false;
+      } else {
+        monitorData.fetchFailures++;
+        e->retryAt = millis() + e->retryDelay;
+        e->retryDelay = e->retryDelay * 2 < e->source->ttlMs ? e->retryDelay * 2 : e->source->ttlMs;
+      }
+    }
+  }
+}
@@ -0,0 +1,43 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef FETCH_TASK_H
+#define FETCH_TASK_H
+
+#include <Arduino.h>
+
+#define FETCH_MAX_SOURCES 4
+#define FETCH_BODY_SIZE 1024          // Longest response accepted; anything longer is a failure
+#define FETCH_VALUE_SIZE 384          // Largest parsed value a source can keep
+#define FETCH_TIMEOUT_MS 5000
+#define FETCH_RETRY_MS 60000          // First retry after a failure, doubling up to the source's TTL
+#define FETCH_POLL_MS 10000           // How often waiting retries are looked at
+
+// Turns a response body into the source's value. body is nul terminated.
+typedef bool (*FetchParser)(const char* body, size_t length, void* value);
+
+typedef struct {
+  const char* url;
+  uint32_t ttlMs;       // Fresh for this long
+  uint32_t staleMs;     // Then still handed out this much longer while a new copy is fetched
+  size_t valueSize;
+  FetchParser parse;
+} FetchSource;
+
+void fetchBegin();
+int8_t fetchRegister(const FetchSource* source);
+bool fetchGet(int8_t id, void* value);
+void fetchTask(void *task_id);
+
+#endif
@@ -0,0 +1,148 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "defines_n_types.h"
+#include "html_template.h"
+
+
+TemplateRenderer::TemplateRenderer(char* buffer, size_t size, TemplateFlushCallback flush) :
+  ChunkWriter(buffer, size, flush) {
+}
+
+// One pass: runs of ordinary characters are copied whole, the five that
+// matter inside an attribute are swapped for entities
+void TemplateRenderer::appendEscaped(const char* s, size_t maxLength) {
+  if( ! s ) {
+    return;
+  }
+  const char* run = s;
+  const char* end = s;
+  while( (size_t) (end - s) < maxLength && *end ) {
+    const char* entity = NULL;
+    switch( *end ) {
+      case '&': entity = "&amp;"; break;
+      case '<': entity = "&lt;"; break;
+      case '>': entity = "&gt;"; break;
+      case '"': entity = "&quot;"; break;
+      case '\'': entity = "&#39;"; break;
+    }
+    if( entity ) {
+      append(run, end - run);
+      append(entity, strlen(entity));
+      run = end + 1;
+    }
+    end++;
+  }
+  append(run, end - run);
+}
+
+void TemplateRenderer::appendInt(int32_t v) {
+  if( v < 0 ) {
+    append('-');
+  }
+  appendUnsigned(v < 0 ? (uint64_t) -(int64_t) v : (uint64_t) v);
+}
+
+void TemplateRenderer::render(const TemplateOp* ops, size_t count, TemplateResolver resolve) {
+
+  static const char hex[] = "0123456789ABCDEF";
+
+  for( size_t i = 0; i < count; i++ ) {
+    const TemplateOp& op = ops[i];
+
+    if( op.type == TEMPLATE_TEXT ) {
+      append(op.text, op.length);
+      continue;
+    }
+    if( op.type == TEMPLATE_END ) {
+      continue;
+    }
+
+    TemplateValue v = { NULL, 0, 0 };
+    if( ! resolve(op.field, v) ) {
+      dbg("Template field %d has no value\n", op.field);
+    }
+
+    switch( op.type ) {
+      case TEMPLATE_HTML:
+        appendEscaped(v.str, v.maxLength ? v.maxLength : SIZE_MAX);
+        break;
+
+      case TEMPLATE_RAW:
+        if( v.str ) {
+          append(v.str, v.maxLength ? strnlen(v.str, v.maxLength) : strlen(v.str));
+        }
+        break;
+
+      case TEMPLATE_INT:
+        appendInt(v.num);
+        break;
+
+      case TEMPLATE_IP:
+        for( int b = 0; b < 4; b++ ) {
+          if( b ) {
+            append('.');
+          }
+          appendInt((v.num >> (b * 8)) & 0xff);
+        }
+        break;
+
+      case TEMPLATE_COLOR:
+        append('#');
+        for( int shift = 20; shift >= 0; shift -= 4 ) {
+          append(hex[(v.num >> shift) & 0x0f]);
+        }
+        break;
+
+      case TEMPLATE_SELECTED:
+        if( v.num == op.value ) {
+          append(" SELECTED", 9);
+        }
+        break;
+
+      case TEMPLATE_OPTIONS:
+        for( int32_t n = op.value; n <= op.limit; n++ ) {
+          append("<option value=\"", 15);
+          appendInt(n);
+          append('"');
+          if( n == v.num ) {
+            append(" SELECTED", 9);
+          }
+          append('>');
+          appendInt(n);
+          append(op.text, op.length);
+          append("</option>", 9);
+        }
+        break;
+
+      case TEMPLATE_IF:
+        if( ! v.num && ! (v.str && v.str[0]) ) {
+          // Skip to the matching END
+          int depth = 1;
+          while( depth && ++i < count ) {
+            if( ops[i].type == TEMPLATE_IF ) {
+              depth++;
+            } else if( ops[i].type == TEMPLATE_END ) {
+              depth--;
+            }
+          }
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+}
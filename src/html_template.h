@@ -0,0 +1,70 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef HTML_TEMPLATE_H
+#define HTML_TEMPLATE_H
+
+#include <Arduino.h>
+#include "chunkWriter.h"
+
+// Operations produced by tools/build_web_assets.py from a web/*.tmpl file
+enum TemplateOpType : uint8_t {
+  TEMPLATE_TEXT,        // Literal markup
+  TEMPLATE_HTML,        // String field, HTML escaped
+  TEMPLATE_RAW,         // String field, written as is
+  TEMPLATE_INT,         // Signed integer field
+  TEMPLATE_IP,          // IPv4 address field, first octet in the low byte
+  TEMPLATE_COLOR,       // 24-bit colour field as #RRGGBB
+  TEMPLATE_SELECTED,    // " SELECTED" when the field equals value
+  TEMPLATE_OPTIONS,     // <option> for value..limit with text as the label suffix
+  TEMPLATE_IF,          // Skip to the matching END unless the field is set
+  TEMPLATE_END
+};
+
+typedef struct {
+  TemplateOpType type;
+  uint8_t field;
+  uint16_t length;      // Of text
+  int32_t value;
+  int32_t limit;
+  const char* text;
+} TemplateOp;
+
+// Filled in by the page for each field the template asks about. Strings are
+// read up to maxLength so fixed size settings fields need no terminator.
+typedef struct {
+  const char* str;
+  size_t maxLength;
+  int32_t num;
+} TemplateValue;
+
+typedef bool (*TemplateResolver)(uint8_t field, TemplateValue& value);
+typedef ChunkFlushCallback TemplateFlushCallback;
+
+// Renders a template into a caller supplied buffer, escaping as it goes and
+// handing the buffer to the flush callback whenever it fills. Nothing is allocated.
+class TemplateRenderer : private ChunkWriter {
+  public:
+    TemplateRenderer(char* buffer, size_t size, TemplateFlushCallback flush);
+
+    void render(const TemplateOp* ops, size_t count, TemplateResolver resolve);
+    using ChunkWriter::finish;
+    using ChunkWriter::flushes;
+
+  private:
+    void appendEscaped(const char* s, size_t maxLength);
+    void appendInt(int32_t v);
+};
+
+#endif
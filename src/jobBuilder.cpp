@@ -0,0 +1,148 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "MinerSha256.h"
+#include "jobBuilder.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Building our miners' header.
+//
+// startMiningJob() picks an extranonce2 and hands it here with the pool's
+// job; what comes back is the block header as the miners hash it, less the
+// timestamp roll and the nonce. Nothing here touches the hardware or the
+// tasks, which is what lets a stratum capture be replayed on a PC.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#define MAX_COINBASE_LENGTH 512
+
+
+// Encode an extra nonce value as a hexadecimal string
+void encodeExtraNonce(char *dest, size_t len, unsigned long en) {
+  static const char *tbl= "0123456789ABCDEF";  
+  dest += len * 2;
+  *dest-- = '\0';
+  while( len-- ) {
+      *dest-- = tbl[en & 0x0f];
+      *dest-- = tbl[(en >> 4) & 0x0f];
+      en >>= 8;
+  }
+}
+
+static void convert_string_to_bytes(unsigned char*out, const char *in, size_t len) {
+    size_t b = 0;
+    for(size_t i = 0; i < len; i+=2) {
+        out[b++] = (unsigned char) (decodeHexChar(in[i]) << 4) + decodeHexChar(in[i+1]);
+    }
+}
+
+static void double_sha256_merkle(unsigned char *dest, unsigned char* buf64) {
+  
+  miner_sha256_hash ctx, ctx1;
+
+  sha256(&ctx, buf64, 64); // get hash of pair
+  sha256(&ctx1, ctx.bytes, 32); // double hash
+
+  // Copy hash into original position
+  memcpy(dest, ctx1.bytes, 32);
+}
+
+static void calculateMerkleRoot(unsigned char *root, unsigned char* coinbaseHash, JsonArray& merkleBranch) {
+
+  size_t i;
+  unsigned char merklePair[64];
+
+  // Add coinbase hash to tree at position 0
+  memcpy(merklePair, coinbaseHash, 32);
+
+  for(i = 0; i < merkleBranch.size(); i++) {
+    convert_string_to_bytes(&merklePair[32], (const char*) merkleBranch[i], 64);
+    double_sha256_merkle(merklePair, merklePair);
+  }
+  memcpy(root, merklePair, 32);
+
+}
+
+// Returns the extranonce2 length used, which the submits have to match
+static size_t createCoinbaseHash(unsigned char* hash, stratum_block* sb, const char* cb1, const char* cb2, unsigned long extraNonce2) {
+
+  char buffer[400];
+  unsigned char cbin[MAX_COINBASE_LENGTH];
+  size_t cbSize = ((strlen(cb1) + strlen(cb2) + sb->extraNonce1.length()) / 2) + sb->extraNonce2Size;
+
+  size_t en2len = sb->extraNonce2Size;
+  if( en2len > 8 ) {
+    dbg("Bad extra nonce 2 length\n");
+    en2len = 8;
+  }
+
+  // Build coinbase string of hex
+  if( cbSize <= MAX_COINBASE_LENGTH ) {
+    size_t clen = 0;
+    // Start with coinbase 1
+    
+    convert_string_to_bytes(cbin, (const char*) cb1, strlen(cb1));
+    clen += strlen(cb1) / 2;
+
+    // Add extra nonce 1
+    convert_string_to_bytes(&cbin[clen], (const char*) sb->extraNonce1.c_str(), sb->extraNonce1.length());
+    clen += sb->extraNonce1.length() / 2;
+
+    // Add extra nonce 2
+    encodeExtraNonce(buffer, en2len, extraNonce2);
+
+    convert_string_to_bytes(&cbin[clen], (const char*) buffer, strlen(buffer));
+    clen += en2len;
+
+    // Finish with coinbase 2
+    convert_string_to_bytes(&cbin[clen], (const char*) cb2, strlen(cb2));
+    clen += strlen(cb2) / 2;
+
+    // Produce the double hash
+    miner_sha256_hash ctx, ctx1;
+    sha256(&ctx, cbin, clen);
+    sha256(&ctx1, ctx.bytes, 32);
+
+    memcpy(hash, ctx1.bytes, 32);    
+  }
+
+  return en2len;
+}
+
+// Swap bytes on merkle 
+static void longSwap(uint32_t* val) {
+  for(int i = 0; i < 8; i++) {
+    val[i] = BYTESWAP32(val[i]);
+  }
+}
+
+// Everything but the nonce. Returns the extranonce2 length, as for createCoinbaseHash().
+size_t jobBuildHeader(hash_block* block, stratum_block* sb, unsigned long extraNonce2) {
+
+  unsigned char coinbaseHash[32];
+
+  block->version = strtoul(sb->version.c_str(), NULL, 16);
+  convert_string_to_bytes(block->prev_hash, (const char*) sb->prevHash.c_str(), 64);
+  size_t en2len = createCoinbaseHash(coinbaseHash, sb, sb->coinBase1.c_str(), sb->coinBase2.c_str(), extraNonce2);
+  calculateMerkleRoot(block->merkle_root, coinbaseHash, sb->merkleBranch);
+  block->timestamp = strtoul(sb->nTime.c_str(), NULL, 16);
+  block->difficulty = strtoul(sb->difficulty.c_str(), NULL, 16);
+
+  // Do some swaps
+  longSwap((uint32_t*) &block->prev_hash);
+
+  return en2len;
+}
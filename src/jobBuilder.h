@@ -0,0 +1,27 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef JOB_BUILDER_H
+#define JOB_BUILDER_H
+
+#include <Arduino.h>
+#include "stratum.h"
+#include "miner.h"
+
+// Our own miners' header for a pool job. Pure data in and out, so
+// tools/stratum_replay builds the same headers on a PC from a capture.
+void encodeExtraNonce(char *dest, size_t len, unsigned long en);
+size_t jobBuildHeader(hash_block* block, stratum_block* sb, unsigned long extraNonce2);
+
+#endif
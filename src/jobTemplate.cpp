@@ -0,0 +1,136 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "MinerSha256.h"
+#include "jobTemplate.h"
+
+static void putLE32(uint8_t* p, uint32_t v) {
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+  p[2] = (v >> 16) & 0xff;
+  p[3] = (v >> 24) & 0xff;
+}
+
+static void doubleSha(uint8_t* out, uint8_t* in, size_t len) {
+  miner_sha256_hash ctx, ctx1;
+  sha256(&ctx, in, len);
+  sha256(&ctx1, ctx.bytes, 32);
+  memcpy(out, ctx1.bytes, 32);
+}
+
+// False if the job won't fit, in which case it can't be handed on
+bool jobTemplateDecode(JobTemplate* job, stratum_block* sb) {
+  const char* cb1 = sb->coinBase1.c_str();
+  const char* cb2 = sb->coinBase2.c_str();
+  size_t cb1Len = strlen(cb1);
+  size_t cb2Len = strlen(cb2);
+
+  if( sb->jobId.length() >= MAX_JOB_ID_LENGTH || sb->prevHash.length() != 64 ||
+      (cb1Len & 1) || (cb2Len & 1) || (cb1Len + cb2Len) / 2 > JOB_TEMPLATE_COINBASE_SIZE ||
+      sb->merkleBranch.size() > JOB_TEMPLATE_MERKLE_MAX ) {
+    return false;
+  }
+
+  safeStrnCpy(job->jobId, sb->jobId.c_str(), MAX_JOB_ID_LENGTH);
+  job->version = strtoul(sb->version.c_str(), NULL, 16);
+  job->nbits = strtoul(sb->difficulty.c_str(), NULL, 16);
+  job->ntime = strtoul(sb->nTime.c_str(), NULL, 16);
+
+  // The pool sends the previous hash with each 4-byte word reversed
+  uint8_t prev[32];
+  hex2bin(prev, sb->prevHash.c_str(), 64);
+  for( uint8_t i = 0; i < 32; i++ ) {
+    job->prevHash[i] = prev[(i & ~3) + 3 - (i & 3)];
+  }
+
+  hex2bin(job->coinbase, cb1, cb1Len);
+  hex2bin(&job->coinbase[cb1Len / 2], cb2, cb2Len);
+  job->coinbase1Length = cb1Len / 2;
+  job->coinbase2Length = cb2Len / 2;
+
+  job->merkleCount = sb->merkleBranch.size();
+  for( uint8_t i = 0; i < job->merkleCount; i++ ) {
+    const char* branch = sb->merkleBranch[i];
+    if( ! branch || strlen(branch) != 64 ) {
+      return false;
+    }
+    hex2bin(job->merkle[i], branch, 64);
+  }
+  return true;
+}
+
+// The 80-byte header for one extranonce2, laid out as it's hashed. False if
+// the extranonces are longer than any pool we'd hand work on for.
+bool jobTemplateHeader(const JobTemplate* job, const char* extraNonce1, const uint8_t* extraNonce2, size_t extraNonce2Size,
+    uint32_t ntime, uint32_t nonce, uint8_t* header) {
+
+  uint8_t coinbase[JOB_TEMPLATE_COINBASE_SIZE + JOB_TEMPLATE_EXTRANONCE_SIZE];
+  size_t extraNonce1Size = strlen(extraNonce1) / 2;
+  if( extraNonce1Size + extraNonce2Size > JOB_TEMPLATE_EXTRANONCE_SIZE ) {
+    return false;
+  }
+
+  size_t len = 0;
+  memcpy(coinbase, job->coinbase, job->coinbase1Length);
+  len += job->coinbase1Length;
+  hex2bin(&coinbase[len], extraNonce1, extraNonce1Size * 2);
+  len += extraNonce1Size;
+  memcpy(&coinbase[len], extraNonce2, extraNonce2Size);
+  len += extraNonce2Size;
+  memcpy(&coinbase[len], &job->coinbase[job->coinbase1Length], job->coinbase2Length);
+  len += job->coinbase2Length;
+
+  uint8_t merklePair[64];
+  doubleSha(merklePair, coinbase, len);
+  for( uint8_t i = 0; i < job->merkleCount; i++ ) {
+    memcpy(&merklePair[32], job->merkle[i], 32);
+    doubleSha(merklePair, merklePair, 64);
+  }
+
+  putLE32(header, job->version);
+  memcpy(&header[4], job->prevHash, 32);
+  memcpy(&header[36], merklePair, 32);
+  putLE32(&header[68], ntime);
+  putLE32(&header[72], job->nbits);
+  putLE32(&header[76], nonce);
+  return true;
+}
+
+// Double SHA of a header; returns the hash's difficulty
+double jobTemplateHash(const uint8_t* header, uint8_t* hash) {
+  static const double maxTarget = 26959535291011309493156476344723991336010898738574164086137773096960.0;
+
+  uint8_t copy[80];
+  memcpy(copy, header, 80);
+  doubleSha(hash, copy, 80);
+
+  double value = 0.0;
+  for( int8_t i = 31; i >= 0; i-- ) {
+    value = value * 256 + hash[i];
+  }
+  return value > 0 ? maxTarget / value : INFINITY;
+}
+
+// The difficulty a hash needs to be a block, from the header's compact target
+double jobTemplateNetworkDifficulty(const JobTemplate* job) {
+  uint32_t mantissa = job->nbits & 0xffffff;
+  int exponent = job->nbits >> 24;
+  if( ! mantissa ) {
+    return INFINITY;
+  }
+  return 65535.0 / mantissa * pow(256.0, 0x1d - exponent);
+}
@@ -0,0 +1,47 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef JOB_TEMPLATE_H
+#define JOB_TEMPLATE_H
+
+#include <Arduino.h>
+#include "stratum.h"
+
+#define JOB_TEMPLATE_COINBASE_SIZE 512
+#define JOB_TEMPLATE_MERKLE_MAX 16
+#define JOB_TEMPLATE_EXTRANONCE_SIZE 24     // extranonce1 and 2 together, in bytes
+
+// A pool job decoded once, so building a header for any extranonce2 is
+// just hashing. Used wherever work is handed on: the stratum server and
+// the cluster leader.
+typedef struct {
+  char jobId[MAX_JOB_ID_LENGTH];
+  uint32_t version;
+  uint32_t nbits;
+  uint32_t ntime;               // The pool's, for work handed out whole
+  uint8_t prevHash[32];         // As it goes in the header
+  uint16_t coinbase1Length;
+  uint16_t coinbase2Length;
+  uint8_t coinbase[JOB_TEMPLATE_COINBASE_SIZE];     // Both halves, without the extranonces
+  uint8_t merkleCount;
+  uint8_t merkle[JOB_TEMPLATE_MERKLE_MAX][32];
+} JobTemplate;
+
+bool jobTemplateDecode(JobTemplate* job, stratum_block* sb);
+bool jobTemplateHeader(const JobTemplate* job, const char* extraNonce1, const uint8_t* extraNonce2, size_t extraNonce2Size,
+    uint32_t ntime, uint32_t nonce, uint8_t* header);
+double jobTemplateHash(const uint8_t* header, uint8_t* hash);
+double jobTemplateNetworkDifficulty(const JobTemplate* job);
+
+#endif
@@ -0,0 +1,326 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "journal.h"
+
+#if defined(USE_SD_CARD)
+  #include <FS.h>
+  #include <SD.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Append only event journal.
+//
+// Records are queued by whoever has something to say, without waiting, and
+// written in batches from the monitor task. Storage is a ring of erase sized
+// sectors: the sector after the one being filled is erased just before it's
+// needed, which drops the oldest records and spreads the wear evenly. After a
+// reboot the sector holding the highest sequence number is where writing resumes.
+//
+// Storage is a "journal" data partition if the partition table has one, else
+// the "spiffs" partition, which this firmware doesn't otherwise use. Boards
+// with an SD card use a file on the card instead when one is present.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#define RECORDS_PER_SECTOR (JOURNAL_SECTOR_SIZE / sizeof(JournalRecord))
+
+extern MonitorData monitorData;
+
+static const esp_partition_t* partition = NULL;
+static size_t storageSize = 0;
+static uint16_t sectorCount = 0;
+static bool ready = false;
+
+#if defined(USE_SD_CARD)
+static bool useSD = false;
+static File sdFile;
+#endif
+
+static uint16_t headSector = 0;
+static uint16_t headSlot = 0;
+static uint32_t nextSeq = 1;
+
+static StaticQueue_t journalQueueBuffer;
+static uint8_t journalQueueStorage[JOURNAL_QUEUE_LENGTH * sizeof(JournalRecord)];
+static QueueHandle_t journalQueue = NULL;
+static StaticSemaphore_t journalMutexBuffer;
+static SemaphoreHandle_t journalMutex = NULL;
+static uint32_t firstPendingMillis = 0;
+
+static JournalRecord batch[JOURNAL_BATCH];
+
+
+static uint16_t recordCheck(const JournalRecord* r) {
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*) r, offsetof(JournalRecord, check));
+  crc = esp_rom_crc32_le(crc, (const uint8_t*) &r->value, sizeof(r->value));
+  return crc ^ (crc >> 16);
+}
+
+static bool recordValid(const JournalRecord* r) {
+  return r->seq != 0xffffffff && r->check == recordCheck(r);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Storage
+//////////////////////////////////////////////////////////////////////////////////////////
+static bool storageRead(size_t offset, void* data, size_t len) {
+#if defined(USE_SD_CARD)
+  if( useSD ) {
+    // Past the end of the file hasn't been written yet, same as erased flash
+    memset(data, 0xff, len);
+    if( offset < sdFile.size() ) {
+      sdFile.seek(offset);
+      sdFile.read((uint8_t*) data, len);
+    }
+    return true;
+  }
+#endif
+  return esp_partition_read(partition, offset, data, len) == ESP_OK;
+}
+
+static bool storageWrite(size_t offset, const void* data, size_t len) {
+#if defined(USE_SD_CARD)
+  if( useSD ) {
+    bool ok = sdFile.seek(offset) && sdFile.write((const uint8_t*) data, len) == len;
+    sdFile.flush();
+    return ok;
+  }
+#endif
+  return esp_partition_write(partition, offset, data, len) == ESP_OK;
+}
+
+static bool storageErase(uint16_t sector) {
+#if defined(USE_SD_CARD)
+  if( useSD ) {
+    uint8_t blank[256];
+    memset(blank, 0xff, sizeof(blank));
+    if( ! sdFile.seek((size_t) sector * JOURNAL_SECTOR_SIZE) ) {
+      return false;
+    }
+    for( size_t i = 0; i < JOURNAL_SECTOR_SIZE; i += sizeof(blank) ) {
+      sdFile.write(blank, sizeof(blank));
+    }
+    sdFile.flush();
+    return true;
+  }
+#endif
+  return esp_partition_erase_range(partition, (size_t) sector * JOURNAL_SECTOR_SIZE, JOURNAL_SECTOR_SIZE) == ESP_OK;
+}
+
+static bool openStorage() {
+#if defined(USE_SD_CARD)
+  // settingsFromSDCard() has already mounted the card if there is one
+  if( SD.cardType() != CARD_NONE ) {
+    if( ! SD.exists(JOURNAL_SD_PATH) ) {
+      File f = SD.open(JOURNAL_SD_PATH, FILE_WRITE);
+      f.close();
+    }
+    sdFile = SD.open(JOURNAL_SD_PATH, "r+");
+    if( sdFile ) {
+      useSD = true;
+      storageSize = JOURNAL_SD_BYTES;
+      dbg("Journal on SD card\n");
+      return true;
+    }
+  }
+#endif
+
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "journal");
+  if( ! partition ) {
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, NULL);
+  }
+  if( ! partition ) {
+    dbg("Journal: no partition\n");
+    return false;
+  }
+
+  storageSize = partition->size < JOURNAL_FLASH_BYTES ? partition->size : JOURNAL_FLASH_BYTES;
+  dbg("Journal in partition %s\n", partition->label);
+  return true;
+}
+
+// Find where the last run left off
+static void findHead() {
+  JournalRecord r;
+  uint32_t bestSeq = 0;
+  bool found = false;
+
+  for( uint16_t s = 0; s < sectorCount; s++ ) {
+    if( storageRead((size_t) s * JOURNAL_SECTOR_SIZE, &r, sizeof(r)) && recordValid(&r) && (! found || r.seq > bestSeq) ) {
+      bestSeq = r.seq;
+      headSector = s;
+      found = true;
+    }
+  }
+
+  if( ! found ) {
+    headSector = 0;
+    headSlot = 0;
+    storageErase(0);
+    return;
+  }
+
+  // Walk the newest sector to its first unwritten slot
+  nextSeq = bestSeq + 1;
+  for( headSlot = 1; headSlot < RECORDS_PER_SECTOR; headSlot++ ) {
+    storageRead((size_t) headSector * JOURNAL_SECTOR_SIZE + headSlot * sizeof(r), &r, sizeof(r));
+    if( r.seq == 0xffffffff ) {
+      break;
+    }
+    if( recordValid(&r) ) {
+      nextSeq = r.seq + 1;
+    }
+  }
+}
+
+void journalBegin() {
+  journalQueue = xQueueCreateStatic(JOURNAL_QUEUE_LENGTH, sizeof(JournalRecord), journalQueueStorage, &journalQueueBuffer);
+  journalMutex = xSemaphoreCreateMutexStatic(&journalMutexBuffer);
+
+  if( ! openStorage() ) {
+    return;
+  }
+  sectorCount = storageSize / JOURNAL_SECTOR_SIZE;
+  if( sectorCount < 2 ) {
+    return;
+  }
+
+  findHead();
+  ready = true;
+  dbg("Journal: %u sectors, resuming at sector %u slot %u, seq %lu\n", sectorCount, headSector, headSlot, (unsigned long) nextSeq);
+}
+
+// Safe from any task; never waits. A full queue costs the record, not the caller.
+void journalAdd(uint8_t type, uint8_t code, float value) {
+  if( ! journalQueue ) {
+    return;
+  }
+
+  JournalRecord r;
+  r.seq = 0;
+  r.time = monitorData.currentTime;
+  r.type = type;
+  r.code = code;
+  r.check = 0;
+  r.value = value;
+
+  if( xQueueSend(journalQueue, &r, 0) != pdTRUE ) {
+    __atomic_fetch_add(&monitorData.journalDrops, 1, __ATOMIC_RELAXED);   // Any task can get here
+  }
+}
+
+// Called from the monitor task once a second
+void journalFlush(bool force) {
+  if( ! ready ) {
+    return;
+  }
+
+  UBaseType_t waiting = uxQueueMessagesWaiting(journalQueue);
+  if( ! waiting ) {
+    firstPendingMillis = 0;
+    return;
+  }
+  if( ! firstPendingMillis ) {
+    firstPendingMillis = millis();
+  }
+  if( ! force && waiting < JOURNAL_BATCH && millis() - firstPendingMillis < JOURNAL_MAX_DELAY_MS ) {
+    return;
+  }
+
+  xSemaphoreTake(journalMutex, portMAX_DELAY);
+
+  while( uxQueueMessagesWaiting(journalQueue) ) {
+
+    // Gather what fits in the rest of this sector and write it in one go
+    size_t n = 0;
+    while( n < JOURNAL_BATCH && headSlot + n < RECORDS_PER_SECTOR && xQueueReceive(journalQueue, &batch[n], 0) == pdTRUE ) {
+      batch[n].seq = nextSeq++;
+      batch[n].check = recordCheck(&batch[n]);
+      n++;
+    }
+    if( n ) {
+      if( ! storageWrite((size_t) headSector * JOURNAL_SECTOR_SIZE + headSlot * sizeof(JournalRecord), batch, n * sizeof(JournalRecord)) ) {
+        dbg("Journal write failed\n");
+      }
+      headSlot += n;
+    }
+
+    if( headSlot >= RECORDS_PER_SECTOR ) {
+      headSector = (headSector + 1) % sectorCount;
+      headSlot = 0;
+      storageErase(headSector);
+    }
+  }
+
+  xSemaphoreGive(journalMutex);
+  firstPendingMillis = 0;
+}
+
+// Oldest first. The lock is only held for each small read so the monitor can
+// keep writing while a slow client downloads.
+void journalForEach(JournalRecordCallback callback, void* context) {
+  if( ! ready ) {
+    return;
+  }
+
+  JournalRecord records[JOURNAL_BATCH];
+  uint32_t lastSeq = 0;
+
+  for( uint16_t i = 1; i <= sectorCount; i++ ) {
+    uint16_t s = (headSector + i) % sectorCount;
+    for( uint16_t slot = 0; slot < RECORDS_PER_SECTOR; slot += JOURNAL_BATCH ) {
+
+      xSemaphoreTake(journalMutex, portMAX_DELAY);
+      bool ok = storageRead((size_t) s * JOURNAL_SECTOR_SIZE + slot * sizeof(JournalRecord), records, sizeof(records));
+      xSemaphoreGive(journalMutex);
+      if( ! ok ) {
+        return;
+      }
+
+      for( size_t r = 0; r < JOURNAL_BATCH; r++ ) {
+        if( records[r].seq == 0xffffffff ) {
+          slot = RECORDS_PER_SECTOR;  // Rest of the sector is blank
+          break;
+        }
+        // Skip anything torn, and anything the writer wrapped onto while we read
+        if( recordValid(&records[r]) && records[r].seq > lastSeq ) {
+          lastSeq = records[r].seq;
+          callback(&records[r], context);
+        }
+      }
+    }
+  }
+}
+
+const char* journalEventName(uint8_t type) {
+  switch( type ) {
+    case JOURNAL_BOOT: return "boot";
+    case JOURNAL_SHARE_ACCEPTED: return "share_accepted";
+    case JOURNAL_SHARE_REJECTED: return "share_rejected";
+    case JOURNAL_BEST_DIFFICULTY: return "best_difficulty";
+    case JOURNAL_BLOCK_FOUND: return "block_found";
+    case JOURNAL_POOL_CONNECTED: return "pool_connected";
+    case JOURNAL_POOL_DISCONNECTED: return "pool_disconnected";
+    case JOURNAL_POOL_FAILOVER: return "pool_failover";
+    case JOURNAL_POOL_RECOVERED: return "pool_recovered";
+    case JOURNAL_WIFI_RECOVERED: return "wifi_recovered";
+    case JOURNAL_SELF_TEST: return "self_test";
+  }
+  return "unknown";
+}
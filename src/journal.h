@@ -0,0 +1,60 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <Arduino.h>
+
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_FLASH_BYTES (128 * 1024)     // Most of a partition we'll use: 8192 records
+#define JOURNAL_SD_BYTES (1024 * 1024)       // 65536 records on the card
+#define JOURNAL_SD_PATH "/journal.bin"
+#define JOURNAL_QUEUE_LENGTH 64
+#define JOURNAL_BATCH 16                     // Records gathered before a write
+#define JOURNAL_MAX_DELAY_MS 30000           // Or this long since the first one waiting
+
+// Event types. Append only; the numbers are on flash.
+#define JOURNAL_BOOT 1                // code: esp_reset_reason()
+#define JOURNAL_SHARE_ACCEPTED 2      // value: share difficulty
+#define JOURNAL_SHARE_REJECTED 3      // code: stratum error, value: share difficulty
+#define JOURNAL_BEST_DIFFICULTY 4     // value: new best
+#define JOURNAL_BLOCK_FOUND 5         // value: share difficulty
+#define JOURNAL_POOL_CONNECTED 6      // Subscribed; code: 0 primary, 1 backup
+#define JOURNAL_POOL_DISCONNECTED 7
+#define JOURNAL_POOL_FAILOVER 8       // Switched to the backup
+#define JOURNAL_POOL_RECOVERED 9      // Back on the primary
+#define JOURNAL_WIFI_RECOVERED 10     // Subscribed again after WiFi dropped; value: seconds down
+#define JOURNAL_SELF_TEST 11          // code: SELF_TEST_ result, value: ms taken
+
+// Fixed size so a sector holds a whole number of them. Erased flash reads as
+// all ones, so a seq of 0xffffffff marks the end of what's been written.
+typedef struct {
+  uint32_t seq;
+  uint32_t time;      // Epoch seconds, 0 before the clock is set
+  uint8_t type;
+  uint8_t code;
+  uint16_t check;
+  float value;
+} JournalRecord;
+
+void journalBegin();
+void journalAdd(uint8_t type, uint8_t code, float value);
+void journalFlush(bool force);
+
+typedef void (*JournalRecordCallback)(const JournalRecord* record, void* context);
+void journalForEach(JournalRecordCallback callback, void* context);
+const char* journalEventName(uint8_t type);
+
+#endif
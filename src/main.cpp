@@ -27,8 +27,15 @@
 #include "esp_system.h"
 #include "MyWiFi.h"
 #include "utils.h"
+#include "journal.h"
+#include "bootProfile.h"
 
 #include "eventTask.h"
+#include "displayTask.h"
+#include "fetchTask.h"
+#include "stratumServer.h"
+#include "clusterTask.h"
+#include "stratumCapture.h"
 #include "esp_mac.h"
 
 #include "esp_pm.h"
@@ -44,21 +51,14 @@
 #define STRATUM_QUEUE_LENGTH 25
 #define STRATUM_QUEUE_ITEM_SIZE sizeof(jobSubmitQueueEntry)
 
-#define APPLICATION_MESSAGE_QUEUE_LENGTH 12
-
-
 extern MonitorData monitorData;
-TaskHandle_t mTask1, mTask2, strTaskHandle, monTaskHandle, webTaskHandle, eventTaskHandle, strServerTaskHandle = NULL;
+TaskHandle_t mTask1, mTask2, strTaskHandle, monTaskHandle, webTaskHandle, eventTaskHandle, strServerTaskHandle, displayTaskHandle, fetchTaskHandle, clusterTaskHandle = NULL;
 
 static StaticQueue_t stratumQueueBuffer; // Static task messaging queue
 uint8_t stratumQueueStorageArea[ STRATUM_QUEUE_LENGTH * STRATUM_QUEUE_ITEM_SIZE];
-uint8_t appMessageBuffer[APPLICATION_MESSAGE_QUEUE_LENGTH * sizeof(ApplicationMessage)];
 
 
-static StaticQueue_t applicationMessageQueueBuffer; // Static task messaging queue
-
 QueueHandle_t stratumMessageQueueHandle;
-QueueHandle_t appMessageQueueHandle;
 
 
 SetupData settings;
@@ -137,6 +137,7 @@ void setup() {
   Serial.begin(115200);
   Serial.setTimeout(0);
   delay(100);
+  bootMark(BOOT_SETUP);
 
   // Note: PlatformIO uses watchdog differently than Arduino IDE
   // Instead of disabling it, we'll feed it in the miner tasks
@@ -154,15 +155,16 @@ void setup() {
   // Tell our WiFi about access point name
   MyWiFi::setAccessPointInfo(apName, AP_SSID_PASSWORD);
 
-  // Try to load settings and monitor data
+  // Settings first; WiFi can't start without them
   init_nvs();
   loadSettings();
-  loadMonitorData();
 
 #if defined(USE_SD_CARD)
   settingsFromSDCard();
 #endif
 
+  bootMark(BOOT_SETTINGS);
+
   dbg("%x\n", settings.ipAddress);
 
   // Check if we are starting up in access point mode
@@ -186,26 +188,28 @@ void setup() {
       dbg("Static IP not set\n");
     }
     
+    // Returns straight away; the rest of setup runs while it associates
     MyWiFi::enterStationMode();
+    bootMark(BOOT_WIFI_STARTED);
 
   }
 
-#ifdef USE_DISPLAY
+  loadMonitorData();
 
-  initializeDisplay(settings.screenRotation, settings.screenBrightness);  
-  if( MyWiFi::isAccessPoint() ) {
-    dbg("Set up as access point.\n");
-    setCurrentScreen(SCREEN_ACCESS_POINT);  
-  } else {
-    dbg("Show mining screen\n");
-    setCurrentScreen(SCREEN_MINING);
-  }
+  // After the SD card is mounted, so the journal can go there
+  journalBegin();
+  journalAdd(JOURNAL_BOOT, esp_reset_reason(), 0);
 
-#endif
+  // Before the display registers what it wants fetched
+  fetchBegin();
+
+  // Before the stratum task can hand it anything
+  stratumServerBegin();
+  clusterBegin();
+  captureBegin();
 
   // Create a message queue for submitting jobs
   stratumMessageQueueHandle = xQueueCreateStatic(STRATUM_QUEUE_LENGTH, STRATUM_QUEUE_ITEM_SIZE, stratumQueueStorageArea, &stratumQueueBuffer);
-  appMessageQueueHandle = xQueueCreateStatic(APPLICATION_MESSAGE_QUEUE_LENGTH, sizeof(ApplicationMessage), appMessageBuffer, &applicationMessageQueueBuffer);
 
   //disableCore0WDT();
   
@@ -224,9 +228,20 @@ void setup() {
   #endif
   
   xTaskCreatePinnedToCore(stratumTask, "Stratum", STRATUM_STACK_SIZE, NULL, STRATUM_TASK_PRIORITY, &strTaskHandle, STRATUM_CORE);
+  xTaskCreatePinnedToCore(stratumServerTask, "StratumServer", STRATUM_SERVER_STACK_SIZE, NULL, STRATUM_SERVER_TASK_PRIORITY, &strServerTaskHandle, STRATUM_SERVER_CORE);
+  xTaskCreatePinnedToCore(clusterTask, "Cluster", CLUSTER_STACK_SIZE, NULL, CLUSTER_TASK_PRIORITY, &clusterTaskHandle, CLUSTER_CORE);
   xTaskCreatePinnedToCore(monitorTask, "Monitor", MONITOR_STACK_SIZE, NULL, MONITOR_TASK_PRIORITY, &monTaskHandle, MONITOR_CORE);
   xTaskCreatePinnedToCore(webTask, "WebServer", WEB_SERVER_STACK_SIZE, NULL, WEB_SERVER_TASK_PRIORITY, &webTaskHandle, WEB_SERVER_CORE);
   xTaskCreatePinnedToCore(eventTask, "EventServer", EVENT_HANDLER_STACK_SIZE, NULL, EVENT_HANDLER_TASK_PRIORITY, &eventTaskHandle, EVENT_HANDLER_CORE);
+  #ifdef USE_DISPLAY
+    // Brings the panel up itself, so nothing here waits on it
+    xTaskCreatePinnedToCore(displayTask, "Display", DISPLAY_STACK_SIZE, NULL, DISPLAY_TASK_PRIORITY, &displayTaskHandle, DISPLAY_CORE);
+  #endif
+  #ifdef USE_OLED
+    // Only the OLED screens show anything fetched from the internet
+    xTaskCreatePinnedToCore(fetchTask, "Fetch", FETCH_STACK_SIZE, NULL, FETCH_TASK_PRIORITY, &fetchTaskHandle, FETCH_CORE);
+  #endif
+  bootMark(BOOT_TASKS);
 
 
   #if defined(ESP32_2432S028) || defined(ESP32_2432S024)
@@ -258,11 +273,13 @@ void setup() {
     ledcWrite(LED1_GREEN_CHANNEL, HIGH);
     ledcWrite(LED1_BLUE_CHANNEL, HIGH);
 
-    ApplicationMessage am;
-    am.action = MAIN_ACTION_LED1_SET;
-    xQueueSend(appMessageQueueHandle, &am, pdMS_TO_TICKS(100));
+    postApplicationActions(MAIN_ACTION_LED1_SET);
 
   #endif
+
+  // Last, since Miner1 outranks this task on its core. The miners check
+  // themselves against the genesis block until the pool's first job arrives.
+  minerSelfTestBegin();
   
 }
 
@@ -0,0 +1,414 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "metrics.h"
+#include "miner.h"
+#include "bootProfile.h"
+
+
+extern MonitorData monitorData;
+extern QueueHandle_t stratumMessageQueueHandle;
+extern TaskHandle_t mTask1, mTask2, strTaskHandle, monTaskHandle, webTaskHandle, eventTaskHandle, strServerTaskHandle, displayTaskHandle, fetchTaskHandle, clusterTaskHandle;
+
+typedef struct {
+  const char* label;
+  TaskHandle_t* handle;
+} MetricsTask;
+
+// Every task handle owned by main.cpp, labelled with the name given to xTaskCreate
+static const MetricsTask metricsTasks[] = {
+  { "task=\"Miner0\"", &mTask1 },
+  { "task=\"Miner1\"", &mTask2 },
+  { "task=\"Stratum\"", &strTaskHandle },
+  { "task=\"Monitor\"", &monTaskHandle },
+  { "task=\"WebServer\"", &webTaskHandle },
+  { "task=\"EventServer\"", &eventTaskHandle },
+  { "task=\"StratumServer\"", &strServerTaskHandle },
+  { "task=\"Cluster\"", &clusterTaskHandle },
+  { "task=\"Display\"", &displayTaskHandle },
+  { "task=\"Fetch\"", &fetchTaskHandle },
+};
+
+
+MetricsWriter::MetricsWriter(char* buffer, size_t size, MetricsFlushCallback flush) :
+  ChunkWriter(buffer, size, flush) {
+}
+
+void MetricsWriter::append(const char* s) {
+  append(s, strlen(s));
+}
+
+void MetricsWriter::startSample(const char* name, const char* labels) {
+  append(name);
+  if( labels && labels[0] ) {
+    append("{", 1);
+    append(labels);
+    append("}", 1);
+  }
+  append(" ", 1);
+}
+
+void MetricsWriter::describe(const char* name, const char* type, const char* help) {
+  append("# HELP ");
+  append(name);
+  append(" ", 1);
+  append(help);
+  append("\n# TYPE ");
+  append(name);
+  append(" ", 1);
+  append(type);
+  append("\n", 1);
+}
+
+void MetricsWriter::value(const char* name, const char* labels, uint64_t v) {
+  startSample(name, labels);
+  appendUnsigned(v);
+  append("\n", 1);
+}
+
+void MetricsWriter::value(const char* name, const char* labels, int64_t v) {
+  startSample(name, labels);
+  if( v < 0 ) {
+    append("-", 1);
+    appendUnsigned((uint64_t) -v);
+  } else {
+    appendUnsigned((uint64_t) v);
+  }
+  append("\n", 1);
+}
+
+// Six significant digits, like %.6g, done by hand to stay clear of %f on the ESP32.
+// Difficulties from vardiff pools can be well below 0.001, so a fixed number of
+// decimals would round them away. out needs 16 bytes; returns the length used.
+static size_t formatSignificant(double v, char* out) {
+  if( v == 0.0 ) {
+    out[0] = '0';
+    return 1;
+  }
+
+  // Scale into 100000..999999 and count how far the point moved
+  int exponent = 5;
+  while( v >= 1000000.0 ) {
+    v /= 10.0;
+    exponent++;
+  }
+  while( v < 100000.0 ) {
+    v *= 10.0;
+    exponent--;
+  }
+  uint32_t digits = (uint32_t) (v + 0.5);
+  if( digits >= 1000000 ) {
+    digits /= 10;
+    exponent++;
+  }
+
+  char d[6];
+  for( int i = 5; i >= 0; i-- ) {
+    d[i] = '0' + digits % 10;
+    digits /= 10;
+  }
+  int used = 6;
+  while( used > 1 && d[used - 1] == '0' ) {
+    used--;
+  }
+
+  size_t n = 0;
+  if( exponent < -4 ) {
+    out[n++] = d[0];
+    if( used > 1 ) {
+      out[n++] = '.';
+      for( int i = 1; i < used; i++ ) {
+        out[n++] = d[i];
+      }
+    }
+    out[n++] = 'e';
+    out[n++] = '-';
+    int e = -exponent;
+    if( e >= 100 ) {
+      out[n++] = '0' + e / 100;
+    }
+    out[n++] = '0' + (e / 10) % 10;
+    out[n++] = '0' + e % 10;
+  } else if( exponent < 0 ) {
+    out[n++] = '0';
+    out[n++] = '.';
+    for( int i = -1; i > exponent; i-- ) {
+      out[n++] = '0';
+    }
+    for( int i = 0; i < used; i++ ) {
+      out[n++] = d[i];
+    }
+  } else {
+    for( int i = 0; i <= exponent; i++ ) {
+      out[n++] = d[i];
+    }
+    if( used > exponent + 1 ) {
+      out[n++] = '.';
+      for( int i = exponent + 1; i < used; i++ ) {
+        out[n++] = d[i];
+      }
+    }
+  }
+  return n;
+}
+
+// Anything that rounds to a million or more is written as a whole number, which
+// is never less precise than %.6g; smaller values get six significant digits.
+void MetricsWriter::value(const char* name, const char* labels, double v) {
+  startSample(name, labels);
+  if( isnan(v) ) {
+    append("NaN\n");
+    return;
+  }
+  if( isinf(v) || v >= 1.8e19 || v <= -1.8e19 ) {
+    append(v < 0 ? "-Inf\n" : "+Inf\n");
+    return;
+  }
+  if( v < 0 ) {
+    append("-", 1);
+    v = -v;
+  }
+  if( v >= 999999.5 ) {
+    appendUnsigned((uint64_t) (v + 0.5));
+  } else {
+    char text[16];
+    append(text, formatSignificant(v, text));
+  }
+  append("\n", 1);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Raw counters and gauges for scraping. Everything here is read without locking, the
+// same as the status page, so values from different tasks may be a tick apart.
+//////////////////////////////////////////////////////////////////////////////////////////
+void writeMetrics(MetricsWriter& w) {
+
+  uint64_t allHashes = monitorData.internalHashes;
+  char label[32];
+
+  // Labelled with the core each miner task is pinned to in main.cpp. Miner0 counts its
+  // own hashes in core0Hashes; the rest are Miner1's, which is alone on core 0 when
+  // there's only one core.
+  w.describe("bitsy_hashes_total", "counter", "Hashes computed since boot by each core.");
+  #ifndef SINGLE_CORE
+    uint64_t miner0 = monitorData.core0Hashes;
+    snprintf(label, sizeof(label), "core=\"%d\"", MINER_0_CORE);
+    w.value("bitsy_hashes_total", label, miner0);
+    snprintf(label, sizeof(label), "core=\"%d\"", MINER_1_CORE);
+    w.value("bitsy_hashes_total", label, allHashes > miner0 ? allHashes - miner0 : 0);
+  #else
+    w.value("bitsy_hashes_total", "core=\"0\"", allHashes);
+  #endif
+
+  w.describe("bitsy_hashrate", "gauge", "Hashes per second including external miners.");
+  w.value("bitsy_hashrate", NULL, monitorData.hashesPerSecond * 1000.0);
+
+  w.describe("bitsy_external_hashrate", "gauge", "Hashes per second reported by external miners.");
+  w.value("bitsy_external_hashrate", NULL, isnan(monitorData.externalHashesPerSecond) ? 0.0 : monitorData.externalHashesPerSecond * 1000.0);
+
+  w.describe("bitsy_share_candidates_total", "counter", "Hashes that met the pool target, lifetime.");
+  w.value("bitsy_share_candidates_total", NULL, (uint64_t) monitorData.poolSubmissions);
+
+  w.describe("bitsy_shares_total", "counter", "Pool responses to submitted shares since boot.");
+  w.value("bitsy_shares_total", "result=\"accepted\"", (uint64_t) monitorData.sharesAccepted);
+  w.value("bitsy_shares_total", "result=\"stale\"", (uint64_t) monitorData.sharesStale);
+  w.value("bitsy_shares_total", "result=\"duplicate\"", (uint64_t) monitorData.sharesDuplicate);
+  w.value("bitsy_shares_total", "result=\"rejected\"", (uint64_t) monitorData.sharesRejected);
+
+  w.describe("bitsy_submit_queue_drops_total", "counter", "Shares dropped because the submit queue was full.");
+  w.value("bitsy_submit_queue_drops_total", NULL, (uint64_t) monitorData.submitQueueDrops);
+
+  w.describe("bitsy_jobs_total", "counter", "Mining jobs started since boot.");
+  w.value("bitsy_jobs_total", NULL, (uint64_t) monitorData.jobsReceived);
+
+  w.describe("bitsy_job_switches_total", "counter", "Jobs that arrived with clean_jobs set.");
+  w.value("bitsy_job_switches_total", NULL, (uint64_t) monitorData.jobSwitches);
+
+  w.describe("bitsy_pool_reconnects_total", "counter", "Pool sessions established after the first.");
+  w.value("bitsy_pool_reconnects_total", NULL, (uint64_t) monitorData.poolReconnects);
+
+  w.describe("bitsy_pool_resumes_total", "counter", "Reconnects where the pool resumed the previous session.");
+  w.value("bitsy_pool_resumes_total", NULL, (uint64_t) monitorData.poolResumes);
+
+  w.describe("bitsy_pool_reconnect_phase_seconds", "gauge", "Time spent in each phase of the last pool connect.");
+  w.value("bitsy_pool_reconnect_phase_seconds", "phase=\"dns\"", monitorData.poolDnsMs / 1000.0);
+  w.value("bitsy_pool_reconnect_phase_seconds", "phase=\"connect\"", monitorData.poolConnectMs / 1000.0);
+  w.value("bitsy_pool_reconnect_phase_seconds", "phase=\"subscribe\"", monitorData.poolSubscribeMs / 1000.0);
+  w.value("bitsy_pool_reconnect_phase_seconds", "phase=\"first_job\"", monitorData.poolFirstJobMs / 1000.0);
+  w.value("bitsy_pool_reconnect_phase_seconds", "phase=\"total\"", monitorData.poolOutageMs / 1000.0);
+
+  w.describe("bitsy_tls_handshakes_total", "counter", "TLS handshakes with the pool, by outcome.");
+  w.value("bitsy_tls_handshakes_total", "type=\"full\"", (uint64_t) monitorData.tlsHandshakes);
+  w.value("bitsy_tls_handshakes_total", "type=\"resumed\"", (uint64_t) monitorData.tlsResumes);
+  w.value("bitsy_tls_handshakes_total", "type=\"failed\"", (uint64_t) monitorData.tlsFailures);
+
+  w.describe("bitsy_tls_pin_failures_total", "counter", "Pool TLS keys that didn't match the configured pin.");
+  w.value("bitsy_tls_pin_failures_total", NULL, (uint64_t) monitorData.tlsPinFailures);
+
+  w.describe("bitsy_tls_handshake_seconds", "gauge", "How long the last full and last resumed TLS handshakes took.");
+  w.value("bitsy_tls_handshake_seconds", "type=\"full\"", monitorData.tlsHandshakeMs / 1000.0);
+  w.value("bitsy_tls_handshake_seconds", "type=\"resumed\"", monitorData.tlsResumeMs / 1000.0);
+
+  w.describe("bitsy_server_clients", "gauge", "Miners connected to the stratum server.");
+  w.value("bitsy_server_clients", NULL, (uint64_t) monitorData.serverClients);
+
+  w.describe("bitsy_server_jobs_relayed_total", "counter", "Jobs sent down to connected miners.");
+  w.value("bitsy_server_jobs_relayed_total", NULL, (uint64_t) monitorData.serverJobsRelayed);
+
+  w.describe("bitsy_server_shares_total", "counter", "Shares from connected miners, by outcome.");
+  w.value("bitsy_server_shares_total", "result=\"forwarded\"", (uint64_t) monitorData.serverSharesForwarded);
+  w.value("bitsy_server_shares_total", "result=\"accepted\"", (uint64_t) monitorData.serverSharesAccepted);
+  w.value("bitsy_server_shares_total", "result=\"rejected\"", (uint64_t) monitorData.serverSharesRejected);
+  w.value("bitsy_server_shares_total", "result=\"invalid\"", (uint64_t) monitorData.serverSharesInvalid);
+
+  w.describe("bitsy_cluster_followers", "gauge", "Followers this cluster leader is handing work to.");
+  w.value("bitsy_cluster_followers", NULL, (uint64_t) monitorData.clusterFollowers);
+
+  w.describe("bitsy_cluster_hashrate", "gauge", "Hashes per second the followers report, together.");
+  w.value("bitsy_cluster_hashrate", NULL, isnan(monitorData.clusterHashesPerSecond) ? 0.0 : monitorData.clusterHashesPerSecond * 1000.0);
+
+  w.describe("bitsy_cluster_jobs_total", "counter", "Cluster jobs: sent by a leader, received by a follower, or ignored by one for coming from another leader.");
+  w.value("bitsy_cluster_jobs_total", "direction=\"sent\"", (uint64_t) monitorData.clusterJobsSent);
+  w.value("bitsy_cluster_jobs_total", "direction=\"received\"", (uint64_t) monitorData.clusterJobsReceived);
+  w.value("bitsy_cluster_jobs_total", "direction=\"ignored\"", (uint64_t) monitorData.clusterJobsIgnored);
+
+  w.describe("bitsy_cluster_shares_total", "counter", "Follower shares, by outcome at the leader; sent counts a follower's own.");
+  w.value("bitsy_cluster_shares_total", "result=\"valid\"", (uint64_t) monitorData.clusterSharesValid);
+  w.value("bitsy_cluster_shares_total", "result=\"invalid\"", (uint64_t) monitorData.clusterSharesInvalid);
+  w.value("bitsy_cluster_shares_total", "result=\"stale\"", (uint64_t) monitorData.clusterSharesStale);
+  w.value("bitsy_cluster_shares_total", "result=\"sent\"", (uint64_t) monitorData.clusterSharesSent);
+
+  w.describe("bitsy_cluster_packets_rejected_total", "counter", "Packets a leader dropped for not carrying this cluster's key.");
+  w.value("bitsy_cluster_packets_rejected_total", NULL, (uint64_t) monitorData.clusterPacketsRejected);
+
+  w.describe("bitsy_dns_lookups_total", "counter", "Pool host lookups that went to the DNS server.");
+  w.value("bitsy_dns_lookups_total", NULL, (uint64_t) monitorData.dnsLookups);
+
+  w.describe("bitsy_dns_cache_hits_total", "counter", "Pool host lookups answered from the cache.");
+  w.value("bitsy_dns_cache_hits_total", NULL, (uint64_t) monitorData.dnsCacheHits);
+
+  w.describe("bitsy_dns_fallbacks_total", "counter", "Failed lookups that fell back to the last known address.");
+  w.value("bitsy_dns_fallbacks_total", NULL, (uint64_t) monitorData.dnsFallbacks);
+
+  w.describe("bitsy_pool_connected", "gauge", "1 when subscribed to a pool.");
+  w.value("bitsy_pool_connected", NULL, (uint64_t) (monitorData.poolConnected ? 1 : 0));
+
+  w.describe("bitsy_wifi_disconnects_total", "counter", "Times the WiFi link dropped.");
+  w.value("bitsy_wifi_disconnects_total", NULL, (uint64_t) monitorData.wifiDisconnects);
+
+  w.describe("bitsy_wifi_fast_connects_total", "counter", "Connects that went straight to the cached AP without a scan.");
+  w.value("bitsy_wifi_fast_connects_total", NULL, (uint64_t) monitorData.wifiFastConnects);
+
+  w.describe("bitsy_wifi_downtime_seconds_total", "counter", "Time from WiFi dropping to being subscribed to a pool again.");
+  w.value("bitsy_wifi_downtime_seconds_total", NULL, monitorData.wifiDowntimeMs / 1000.0);
+
+  w.describe("bitsy_wifi_last_downtime_seconds", "gauge", "The same, for the most recent drop.");
+  w.value("bitsy_wifi_last_downtime_seconds", NULL, monitorData.wifiLastDowntimeMs / 1000.0);
+
+  w.describe("bitsy_mining", "gauge", "1 when a job is being hashed.");
+  w.value("bitsy_mining", NULL, (uint64_t) (monitorData.isMining ? 1 : 0));
+
+  w.describe("bitsy_pool_difficulty", "gauge", "Current pool share difficulty.");
+  w.value("bitsy_pool_difficulty", NULL, monitorData.poolDifficulty);
+
+  w.describe("bitsy_best_difficulty", "gauge", "Best share difficulty found.");
+  w.value("bitsy_best_difficulty", NULL, monitorData.bestDifficulty);
+
+  w.describe("bitsy_block_height", "gauge", "Height of the block being mined.");
+  w.value("bitsy_block_height", NULL, (uint64_t) monitorData.blockHeight);
+
+  w.describe("bitsy_weblog_drops_total", "counter", "Log lines a websocket client missed because it fell behind.");
+  w.value("bitsy_weblog_drops_total", NULL, (uint64_t) monitorData.webLogDrops);
+
+  w.describe("bitsy_event_task_wakeups_total", "counter", "Times the event task woke up to do something.");
+  w.value("bitsy_event_task_wakeups_total", NULL, (uint64_t) monitorData.eventWakeups);
+
+  w.describe("bitsy_app_actions_coalesced_total", "counter", "Application actions posted while the same action was still pending.");
+  w.value("bitsy_app_actions_coalesced_total", NULL, (uint64_t) monitorData.appActionsCoalesced);
+
+  w.describe("bitsy_display_frames_total", "counter", "Frames the display task has drawn.");
+  w.value("bitsy_display_frames_total", NULL, (uint64_t) monitorData.displayFrames);
+
+  w.describe("bitsy_display_frames_skipped_total", "counter", "Refreshes skipped because the backlight was dimmed.");
+  w.value("bitsy_display_frames_skipped_total", NULL, (uint64_t) monitorData.displayFramesSkipped);
+
+  w.describe("bitsy_display_frame_us", "gauge", "Time taken to draw the last frame.");
+  w.value("bitsy_display_frame_us", NULL, (uint64_t) monitorData.displayFrameUs);
+
+  w.describe("bitsy_display_frame_max_us", "gauge", "Longest frame since boot.");
+  w.value("bitsy_display_frame_max_us", NULL, (uint64_t) monitorData.displayFrameMaxUs);
+
+  w.describe("bitsy_fetches_total", "counter", "Background HTTP fetches for the screens.");
+  w.value("bitsy_fetches_total", "result=\"ok\"", (uint64_t) monitorData.fetchSuccesses);
+  w.value("bitsy_fetches_total", "result=\"failed\"", (uint64_t) monitorData.fetchFailures);
+
+  w.describe("bitsy_time_syncs_total", "counter", "SNTP replies that set or slewed the clock.");
+  w.value("bitsy_time_syncs_total", NULL, (uint64_t) monitorData.timeSyncs);
+
+  w.describe("bitsy_pool_clock_offset_seconds", "gauge", "How far the pool's job timestamps run ahead of our clock.");
+  w.value("bitsy_pool_clock_offset_seconds", NULL, (int64_t) monitorData.poolClockOffset);
+
+  w.describe("bitsy_boot_phase_seconds", "gauge", "When each boot phase finished, from app start.");
+  for( uint8_t i = 0; i < BOOT_PHASE_COUNT; i++ ) {
+    if( bootPhaseMs(i) ) {
+      snprintf(label, sizeof(label), "phase=\"%s\"", bootPhaseName(i));
+      w.value("bitsy_boot_phase_seconds", label, bootPhaseMs(i) / 1000.0);
+    }
+  }
+
+  w.describe("bitsy_self_test", "gauge", "Outcome of the miners' boot self-test, 1 on the result label.");
+  snprintf(label, sizeof(label), "result=\"%s\"", minerSelfTestName(minerSelfTestState()));
+  w.value("bitsy_self_test", label, (uint64_t) 1);
+
+  w.describe("bitsy_journal_drops_total", "counter", "Journal records lost because the write queue was full.");
+  w.value("bitsy_journal_drops_total", NULL, (uint64_t) monitorData.journalDrops);
+
+  w.describe("bitsy_queue_depth", "gauge", "Messages waiting in each FreeRTOS queue.");
+  if( stratumMessageQueueHandle ) {
+    w.value("bitsy_queue_depth", "queue=\"stratum\"", (uint64_t) uxQueueMessagesWaiting(stratumMessageQueueHandle));
+  }
+
+  w.describe("bitsy_heap_free_bytes", "gauge", "Free heap.");
+  w.value("bitsy_heap_free_bytes", NULL, (uint64_t) ESP.getFreeHeap());
+
+  w.describe("bitsy_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+  w.value("bitsy_heap_min_free_bytes", NULL, (uint64_t) ESP.getMinFreeHeap());
+
+  w.describe("bitsy_heap_max_alloc_bytes", "gauge", "Largest block the heap can allocate.");
+  w.value("bitsy_heap_max_alloc_bytes", NULL, (uint64_t) ESP.getMaxAllocHeap());
+
+  w.describe("bitsy_task_stack_high_water_bytes", "gauge", "Least free stack each task has had.");
+  for( size_t i = 0; i < sizeof(metricsTasks) / sizeof(MetricsTask); i++ ) {
+    TaskHandle_t handle = *metricsTasks[i].handle;
+    if( handle ) {
+      w.value("bitsy_task_stack_high_water_bytes", metricsTasks[i].label, (uint64_t) uxTaskGetStackHighWaterMark(handle));
+    }
+  }
+
+  w.describe("bitsy_wifi_connected", "gauge", "1 when associated with an access point.");
+  w.value("bitsy_wifi_connected", NULL, (uint64_t) (WiFi.status() == WL_CONNECTED ? 1 : 0));
+
+  if( WiFi.status() == WL_CONNECTED ) {
+    w.describe("bitsy_wifi_rssi_dbm", "gauge", "Signal strength of the current access point.");
+    w.value("bitsy_wifi_rssi_dbm", NULL, (int64_t) WiFi.RSSI());
+  }
+
+  w.describe("bitsy_uptime_seconds", "counter", "Seconds since boot.");
+  w.value("bitsy_uptime_seconds", NULL, (uint64_t) (monitorData.uptime / 1000));
+}
@@ -0,0 +1,46 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "chunkWriter.h"
+
+#define METRICS_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+typedef ChunkFlushCallback MetricsFlushCallback;
+
+// Writes Prometheus text exposition format into a caller supplied buffer,
+// handing it to the flush callback whenever it fills up. Nothing is allocated.
+class MetricsWriter : private ChunkWriter {
+  public:
+    MetricsWriter(char* buffer, size_t size, MetricsFlushCallback flush);
+
+    void describe(const char* name, const char* type, const char* help);
+    void value(const char* name, const char* labels, uint64_t v);
+    void value(const char* name, const char* labels, int64_t v);
+    void value(const char* name, const char* labels, double v);
+    using ChunkWriter::finish;
+
+  private:
+    using ChunkWriter::append;
+    void append(const char* s);
+    void startSample(const char* name, const char* labels);
+};
+
+// Appends the miner metrics; the caller adds its own and calls finish()
+void writeMetrics(MetricsWriter& w);
+
+#endif
@@ -21,6 +21,13 @@
 #include "stratum.h"
 #include "MinerSha256.h"
 #include "monitor.h"
+#include "eventTask.h"
+#include "timeService.h"
+#include "journal.h"
+#include "bootProfile.h"
+#include "clusterTask.h"
+#include "jobBuilder.h"
+#include "stratumCapture.h"
 #include "soc/hwcrypto_reg.h"
 #ifndef ESP32C3
   #include "soc/dport_reg.h"
@@ -30,13 +37,11 @@
 #include "soc/i2s_struct.h"
 
 #define MAX_DIFFICULTY 0x1d00ffff
-#define MAX_COINBASE_LENGTH 512
 #define MAX_EXTRA_NONCE_LENGTH 16
 
 
 extern SetupData settings;
 extern QueueHandle_t stratumMessageQueueHandle;
-extern QueueHandle_t appMessageQueueHandle;
 
 unsigned char blockTarget[32];
 double poolDifficulty = 1.0;
@@ -51,24 +56,27 @@ hash_block pendingMiningJobBlock;
 unsigned long startNonce[2] = {0, 0x80000000};
 volatile bool isMining = false;
 char currentJobId[MAX_JOB_ID_LENGTH];
+static volatile bool miningClusterJob = false;  // From a cluster leader, not the pool
 
 volatile bool core0Mining = false;
 volatile bool core1Mining = false;
 
 extern MonitorData monitorData;
 
+// The genesis block, as the miners hash it
+#define GENESIS_TIME 1231006505
+#define GENESIS_BITS 0x1d00ffff
+#define GENESIS_NONCE 2083236893
+static const unsigned char genesisMerkleRoot[32] = {
+  0x3b, 0xa3, 0xed, 0xfd, 0x7a, 0x7b, 0x12, 0xb2, 0x7a, 0xc7, 0x2c, 0x3e, 0x67, 0x76, 0x8f, 0x61,
+  0x7f, 0xc8, 0x1b, 0xc3, 0x88, 0x8a, 0x51, 0x32, 0x3a, 0x9f, 0xb8, 0xaa, 0x4b, 0x1e, 0x5e, 0x4a
+};
 
-// Encode an extra nonce value as a hexadecimal string
-void encodeExtraNonce(char *dest, size_t len, unsigned long en) {
-  static const char *tbl= "0123456789ABCDEF";  
-  dest += len * 2;
-  *dest-- = '\0';
-  while( len-- ) {
-      *dest-- = tbl[en & 0x0f];
-      *dest-- = tbl[(en >> 4) & 0x0f];
-      en >>= 8;
-  }
-}
+static volatile uint8_t selfTestState = SELF_TEST_NOT_RUN;
+static uint32_t selfTestStart = 0;
+static uint32_t selfTestCores = 0;      // Bit per core that still has to find the nonce
+
+static void selfTestFinish(uint8_t result);
 
 
 void divide_256bit_by_double(uint64_t* target, double divisor) {
@@ -147,93 +155,6 @@ int check_target(const unsigned char* hash, const unsigned char* target) {
     return 1;  // Equal is also valid
 }
 
-void convert_string_to_bytes(unsigned char*out, const char *in, size_t len) {
-    size_t b = 0;
-    for(int i = 0; i < len; i+=2) {
-        out[b++] = (unsigned char) (decodeHexChar(in[i]) << 4) + decodeHexChar(in[i+1]);
-    }
-}
-
-void double_sha256_merkle(unsigned char *dest, unsigned char* buf64) {
-  
-  miner_sha256_hash ctx, ctx1;
-
-  sha256(&ctx, buf64, 64); // get hash of pair
-  sha256(&ctx1, ctx.bytes, 32); // double hash
-
-  // Copy hash into original position
-  memcpy(dest, ctx1.bytes, 32);
-}
-
-void calculateMerkleRoot(unsigned char *root, unsigned char* coinbaseHash, JsonArray& merkleBranch) {
-
-  int i, j;
-  unsigned char merklePair[64];
-
-  // Add coinbase hash to tree at position 0
-  memcpy(merklePair, coinbaseHash, 32);
-
-  for(i = 0; i < merkleBranch.size(); i++) {
-    convert_string_to_bytes(&merklePair[32], (const char*) merkleBranch[i], 64);
-    double_sha256_merkle(merklePair, merklePair);
-  }
-  memcpy(root, merklePair, 32);
-
-}
-
-
-void createCoinbaseHash(unsigned char* hash, stratum_block* sb, const char* cb1, const char* cb2) {
-
-  char buffer[400];
-  unsigned char cbin[MAX_COINBASE_LENGTH];
-  size_t cbSize = ((strlen(cb1) + strlen(cb2) + sb->extraNonce1.length()) / 2) + sb->extraNonce2Size;
-
-  // Build coinbase string of hex
-  if( cbSize <= MAX_COINBASE_LENGTH ) {
-    size_t clen = 0;
-    // Start with coinbase 1
-    
-    convert_string_to_bytes(cbin, (const char*) cb1, strlen(cb1));
-    clen += strlen(cb1) / 2;
-
-    // Add extra nonce 1
-    convert_string_to_bytes(&cbin[clen], (const char*) sb->extraNonce1.c_str(), sb->extraNonce1.length());
-    clen += sb->extraNonce1.length() / 2;
-
-    size_t en2len = sb->extraNonce2Size;
-    if( en2len > 8 ) {
-      dbg("Bad extra nonce 2 length\n");
-      en2len = 8;
-    }
-    // Add extra nonce 2
-    extraNonce2Size = en2len;
-
-    encodeExtraNonce(buffer, en2len, extraNonce2);
-
-    convert_string_to_bytes(&cbin[clen], (const char*) buffer, strlen(buffer));
-    clen += en2len;
-
-    // Finish with coinbase 2
-    convert_string_to_bytes(&cbin[clen], (const char*) cb2, strlen(cb2));
-    clen += strlen(cb2) / 2;
-
-    // Produce the double hash
-    miner_sha256_hash ctx, ctx1;
-    sha256(&ctx, cbin, clen);
-    sha256(&ctx1, ctx.bytes, 32);
-
-    memcpy(hash, ctx1.bytes, 32);    
-  }
-
-}
-
-// Swap bytes on merkle 
-void longSwap(unsigned long* val) {
-  for(int i = 0; i < 8; i++) {
-    val[i] = BYTESWAP32(val[i]);
-  }
-}
-
 // Calculates hash difficulty and compares it to best achieved
 //__attribute__((section(".fastcode")))
 void compareBestDifficulty(miner_sha256_hash *ctx) {
@@ -294,45 +215,55 @@ void setPoolTarget() {
 // Copy everything to a local structure and get ready to roll
 void startMiningJob(stratum_block* sb) {
 
-  char buffer[65];
-  unsigned char coinbaseHash[32];
+  // Real work beats the self-test
+  if( selfTestState == SELF_TEST_RUNNING ) {
+    selfTestFinish(SELF_TEST_INTERRUPTED);
+  }
 
   while( isMining || core0Mining || core1Mining ) {
     isMining = false;
     vTaskDelay(10/portTICK_PERIOD_MS);    
   }
 
-  // Define a random Extra Nonce 2
+  // Define a random Extra Nonce 2. Its first byte is 0; the stratum server
+  // and the cluster leader hand out the others.
   extraNonce2 = esp_random();
+  if( sb->extraNonce2Size >= 2 && sb->extraNonce2Size <= 4 ) {
+    extraNonce2 &= 0xffffffffUL >> (8 * (5 - sb->extraNonce2Size));
+  }
 
   // Build the block
-  pendingMiningJobBlock.version = strtoul(sb->version.c_str(), NULL, 16);
-  convert_string_to_bytes(pendingMiningJobBlock.prev_hash, (const char*) sb->prevHash.c_str(), 64);
-  createCoinbaseHash(coinbaseHash, sb, sb->coinBase1.c_str(), sb->coinBase2.c_str());
-  calculateMerkleRoot(pendingMiningJobBlock.merkle_root, coinbaseHash, sb->merkleBranch);
-  pendingMiningJobBlock.timestamp = strtoul(sb->nTime.c_str(), NULL, 16);
-  pendingMiningJobBlock.difficulty = strtoul(sb->difficulty.c_str(), NULL, 16);
+  extraNonce2Size = jobBuildHeader(&pendingMiningJobBlock, sb, extraNonce2);
+  captureJob(sb->jobId.c_str(), sb->extraNonce1.c_str(), extraNonce2, extraNonce2Size, &pendingMiningJobBlock);
   safeStrnCpy(currentJobId, sb->jobId.c_str(), MAX_JOB_ID_LENGTH);
+  miningClusterJob = false;
 
   dbg("Job ID first: %s\n", currentJobId);
 
   getBlockHeight(sb->coinBase1.c_str());
 
-  // Play with time stamp
+  // Play with time stamp, up to 255 seconds in the future, but never so far
+  // past the pool's own clock that it turns the shares away
   if( settings.randomizeTimestamp ) {
-    pendingMiningJobBlock.timestamp += (esp_random() & 0xff); // Up to 255 seconds in the future
+    int64_t span = 0xff;
+    uint32_t poolNow = poolClockNow();
+    if( poolNow ) {
+      int64_t room = (int64_t) poolNow + POOL_NTIME_AHEAD_MAX - pendingMiningJobBlock.timestamp;
+      span = room < 0 ? 0 : (room < span ? room : span);
+    }
+    pendingMiningJobBlock.timestamp += esp_random() % (span + 1);
   }
 
-  // Do some swaps
-  longSwap((unsigned long*) &pendingMiningJobBlock.prev_hash);
-
-  
   // Make our nonces random but without overlap
   startNonce[0] = esp_random();
   startNonce[1] = startNonce[0] + 0x80000000;
 
   //Serial.println("Begin new mining job...");
   monitorData.totalJobs++;
+  monitorData.jobsReceived++;
+  if( sb->cleanJobs ) {
+    monitorData.jobSwitches++;
+  }
 
   // Set up the target
   bits_to_target(pendingMiningJobBlock.difficulty, blockTarget);
@@ -341,9 +272,146 @@ void startMiningJob(stratum_block* sb) {
   setPoolTarget();
 
   isMining = true;
+  bootMark(BOOT_FIRST_JOB);
 
 }
 
+// Work from a cluster leader: a finished header, our extranonce2 already in
+// it, and every nonce ours. The job id is the leader's sequence number.
+void startClusterJob(const uint8_t* header, uint32_t seq, double difficulty, bool clean) {
+
+  if( selfTestState == SELF_TEST_RUNNING ) {
+    selfTestFinish(SELF_TEST_INTERRUPTED);
+  }
+
+  while( isMining || core0Mining || core1Mining ) {
+    isMining = false;
+    vTaskDelay(10/portTICK_PERIOD_MS);
+  }
+
+  memcpy(&pendingMiningJobBlock, header, sizeof(hash_block));
+  snprintf(currentJobId, MAX_JOB_ID_LENGTH, "%lu", (unsigned long) seq);
+  miningClusterJob = true;
+
+  startNonce[0] = esp_random();
+  startNonce[1] = startNonce[0] + 0x80000000;
+
+  monitorData.totalJobs++;
+  monitorData.jobsReceived++;
+  if( clean ) {
+    monitorData.jobSwitches++;
+  }
+
+  bits_to_target(pendingMiningJobBlock.difficulty, blockTarget);
+  setPoolDifficulty(difficulty);
+
+  isMining = true;
+  bootMark(BOOT_FIRST_JOB);
+}
+
+bool isMiningClusterJob() {
+  return isMining && miningClusterJob;
+}
+
+// The stratum task dropping its job; leaves a running self-test alone
+void stopMiningJob() {
+  if( selfTestState != SELF_TEST_RUNNING ) {
+    isMining = false;
+  }
+}
+
+// Mining something the pool gave us, as opposed to the self-test
+bool isMiningPoolJob() {
+  return isMining && selfTestState != SELF_TEST_RUNNING;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Self-test.
+//
+// Right after boot there's nothing to hash until WiFi is up and the pool
+// sends a job, so the miners spend that time on the genesis block. Each core
+// starts a little short of its nonce, running its real hashing loop, and has
+// to come up with the known answer. That proves the SHA paths before any
+// share depends on them. A job from the pool cuts it short.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// Only the first caller out of RUNNING gets to set the result
+static void selfTestFinish(uint8_t result) {
+  uint8_t expected = SELF_TEST_RUNNING;
+  if( ! __atomic_compare_exchange_n(&selfTestState, &expected, result, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) {
+    return;
+  }
+  isMining = false;
+
+  uint32_t elapsed = millis() - selfTestStart;
+  dbg("Miner self-test %s after %lu ms\n", minerSelfTestName(result), elapsed);
+  journalAdd(JOURNAL_SELF_TEST, result, elapsed);
+  bootMark(BOOT_SELF_TEST);
+}
+
+// Call before the miner tasks start
+void minerSelfTestBegin() {
+  memset(&pendingMiningJobBlock, 0, sizeof(hash_block));
+  pendingMiningJobBlock.version = 1;
+  memcpy(pendingMiningJobBlock.merkle_root, genesisMerkleRoot, sizeof(genesisMerkleRoot));
+  pendingMiningJobBlock.timestamp = GENESIS_TIME;
+  pendingMiningJobBlock.difficulty = GENESIS_BITS;
+  bits_to_target(GENESIS_BITS, blockTarget);
+  safeStrnCpy(currentJobId, "selftest", MAX_JOB_ID_LENGTH);
+
+  // Core 1 counts through the nonce byte swapped
+  startNonce[0] = GENESIS_NONCE - SELF_TEST_NONCES;
+  startNonce[1] = BYTESWAP32(BYTESWAP32((uint32_t) GENESIS_NONCE) - SELF_TEST_NONCES);
+
+  #ifndef SINGLE_CORE
+    selfTestCores = 1 << MINER_1_CORE;
+    if( ! settings.coreZeroDisabled ) {
+      selfTestCores |= 1 << MINER_0_CORE;
+    }
+  #else
+    selfTestCores = 1;
+  #endif
+
+  selfTestStart = millis();
+  selfTestState = SELF_TEST_RUNNING;
+  isMining = true;
+}
+
+// From hashCheck() while the self-test runs
+static void selfTestHit(miner_sha256_hash *ctx, uint32_t nonce) {
+  if( nonce != GENESIS_NONCE || ! check_target(ctx->bytes, blockTarget) ) {
+    return;
+  }
+  uint32_t left = __atomic_and_fetch(&selfTestCores, ~(1u << xPortGetCoreID()), __ATOMIC_ACQ_REL);
+  if( ! left ) {
+    selfTestFinish(SELF_TEST_PASSED);
+  }
+}
+
+// Called on the event task's tick
+void minerSelfTestCheck() {
+  if( selfTestState == SELF_TEST_RUNNING && millis() - selfTestStart > SELF_TEST_TIMEOUT_MS ) {
+    dbg("*************** Miner self-test failed. **********************\n");
+    selfTestFinish(SELF_TEST_FAILED);
+  }
+}
+
+uint8_t minerSelfTestState() {
+  return selfTestState;
+}
+
+const char* minerSelfTestName(uint8_t state) {
+  switch( state ) {
+    case SELF_TEST_NOT_RUN: return "not_run";
+    case SELF_TEST_RUNNING: return "running";
+    case SELF_TEST_PASSED: return "passed";
+    case SELF_TEST_FAILED: return "failed";
+    case SELF_TEST_INTERRUPTED: return "interrupted";
+  }
+  return "unknown";
+}
+
 
 
 // Sets the pool difficulty as recalculates the target
@@ -354,9 +422,7 @@ void setPoolDifficulty(double pDiff) {
     poolDifficulty = pDiff;
     setPoolTarget();
 
-    ApplicationMessage am;
-    am.action = MAIN_ACTION_SEND_DIFFICULTY;
-    xQueueSend(appMessageQueueHandle, &am, pdMS_TO_TICKS(100));
+    postApplicationActions(MAIN_ACTION_SEND_DIFFICULTY);
   }
 }
 
@@ -367,6 +433,12 @@ void setPoolDifficulty(double pDiff) {
 //__attribute__((section(".fastcode")))
 void submitJob(const char* jobId, uint32_t timestamp, uint32_t nonce, bool topPriority, uint32_t submitFlags, double difficulty) {
   
+  // The leader fills in the rest and sends it on
+  if( miningClusterJob ) {
+    clusterSubmit(jobId, timestamp, nonce);
+    return;
+  }
+
   //submit(jobId, extraNonce2, hb->timestamp, hb->nonce);
   jobSubmitQueueEntry qe;
 
@@ -377,14 +449,20 @@ void submitJob(const char* jobId, uint32_t timestamp, uint32_t nonce, bool topPr
   qe.timestamp = timestamp;
   qe.nonce = nonce;
   qe.callback = NULL;
+  qe.sessionId = 0;
+  qe.sessionMessageId = 0;
   qe.versionBits = 0;
   qe.submitflags = submitFlags;
   qe.difficulty = difficulty;
 
+  BaseType_t queued;
   if( ! topPriority ) {
-    xQueueSendToFront(stratumMessageQueueHandle, &qe, pdMS_TO_TICKS(100));
+    queued = xQueueSendToFront(stratumMessageQueueHandle, &qe, pdMS_TO_TICKS(100));
   } else {
-    xQueueSend(stratumMessageQueueHandle, &qe, pdMS_TO_TICKS(100));
+    queued = xQueueSend(stratumMessageQueueHandle, &qe, pdMS_TO_TICKS(100));
+  }
+  if( queued != pdTRUE ) {
+    monitorData.submitQueueDrops++;
   }
 }
 
@@ -394,6 +472,11 @@ void hashCheck(char* jobId, miner_sha256_hash *ctx, uint32_t timestamp, uint32_t
 
   uint32_t submitFlags = 0;
 
+  if( selfTestState == SELF_TEST_RUNNING ) {
+    selfTestHit(ctx, nonce);
+    return;
+  }
+
   if( check_target(ctx->bytes, poolTarget) ) {
       
     if( ! ctx->hash[7] ) {
@@ -478,6 +561,7 @@ void minerTask(void *task_id) {
 
         hb.nonce += 1;        
         monitorData.internalHashes += 1;        
+        monitorData.core0Hashes += 1;
         
       } // isMining
 
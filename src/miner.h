@@ -53,13 +53,25 @@
 
 #define DEFAULT_DIFFICULTY 0x1dffff // As per stratum
 
+// Boot self-test: each miner hashes its way up to the genesis block's nonce
+// and has to find it, while WiFi and the pool are still coming up
+#define SELF_TEST_NONCES 0x10000          // Hashed by each core before the genesis nonce
+#define SELF_TEST_TIMEOUT_MS 20000
+
+#define SELF_TEST_NOT_RUN 0
+#define SELF_TEST_RUNNING 1
+#define SELF_TEST_PASSED 2
+#define SELF_TEST_FAILED 3
+#define SELF_TEST_INTERRUPTED 4           // The pool's first job came in first
+
+// Laid out exactly as the 80-byte block header
 typedef struct {
-  unsigned long version;
+  uint32_t version;
   unsigned char prev_hash[32];
   unsigned char merkle_root[32];
-  unsigned long timestamp;
-  unsigned long difficulty;
-  unsigned long nonce;
+  uint32_t timestamp;
+  uint32_t difficulty;
+  uint32_t nonce;
 } hash_block;
 
 void minerTask(void *task_id);
@@ -68,6 +80,15 @@ void setExtraNonce(const char* en);
 void setExtraNonce2Length(size_t len);
 void startMiningJob(stratum_block *sb);
 void setPoolDifficulty(double pDiff);
+void stopMiningJob();
+bool isMiningPoolJob();
+void startClusterJob(const uint8_t* header, uint32_t seq, double difficulty, bool clean);
+bool isMiningClusterJob();
+
+void minerSelfTestBegin();
+void minerSelfTestCheck();
+uint8_t minerSelfTestState();
+const char* minerSelfTestName(uint8_t state);
 
 
 #endif // MINER_H
@@ -20,12 +20,23 @@
 #include "miner.h"
 #include "utils.h"
 #include "MyWiFi.h"
+#include "MyWebServer.h"
+#include "journal.h"
+#include "eventTask.h"
+#include "bootProfile.h"
 
 
 MonitorData monitorData = {};
 
-extern volatile bool isMining;
-extern QueueHandle_t appMessageQueueHandle;
+extern SetupData settings;
+
+// Two snapshots so the web task can send one while the other is rebuilt. A reader
+// pins its buffer and the monitor skips a rebuild rather than write under it.
+static StatusSnapshot statusSnapshots[2];
+static uint8_t publishedSnapshot = 0;
+static uint8_t snapshotReaders[2] = {0, 0};
+static uint32_t snapshotVersion = 0;
+static char bootJson[288];
 
 
 
@@ -43,9 +54,122 @@ void uptimeToString(char* dest, uint64_t uptime) {
   sprintf(dest, "%dd %dh %dm %ds", days, hours, minutes, seconds);
 }
 
-void monitorTask(void *task_id) {
+static void appendStatusField(StatusSnapshot* ss, const char* key, const char* value, bool quoted) {
+  if( ss->fieldCount >= STATUS_FIELD_COUNT || ss->length >= STATUS_SNAPSHOT_SIZE - 2 ) {
+    return;
+  }
+  if( ss->fieldCount ) {
+    ss->json[ss->length++] = ',';
+    ss->json[ss->length++] = ' ';
+  }
+  size_t room = STATUS_SNAPSHOT_SIZE - ss->length;
+  int n = snprintf(ss->json + ss->length, room, quoted ? "\"%s\": \"%s\"" : "\"%s\": %s", key, value);
+  if( n <= 0 || (size_t) n >= room ) {
+    ss->json[ss->length] = '\0';
+    return;
+  }
+  ss->fieldStart[ss->fieldCount] = ss->length;
+  ss->fieldLength[ss->fieldCount] = n;
+  ss->fieldCount++;
+  ss->length += n;
+}
+
+static const char* orZero(const char* s) {
+  return s[0] ? s : "0";
+}
+
+// Build the status JSON into the spare buffer and flip it in if anything changed
+static void publishStatusSnapshot() {
 
-  ApplicationMessage appMessage;
+  uint8_t target = __atomic_load_n(&publishedSnapshot, __ATOMIC_ACQUIRE) ^ 1;
+  if( __atomic_load_n(&snapshotReaders[target], __ATOMIC_ACQUIRE) ) {
+    return; // A slow client still holds it; try again next second
+  }
+
+  StatusSnapshot* ss = &statusSnapshots[target];
+  char number[24];
+  char pool[MAX_POOL_URL_LENGTH + 1];
+
+  ss->length = 0;
+  ss->fieldCount = 0;
+  ss->json[ss->length++] = '{';
+
+  appendStatusField(ss, "mining", monitorData.isMining ? "true" : "false", false);
+  appendStatusField(ss, "hps", orZero(monitorData.hashesPerSecondStr), true);
+  appendStatusField(ss, "poolSubmissions", orZero(monitorData.poolSubmissionsStr), true);
+  appendStatusField(ss, "validBlocks", orZero(monitorData.validBlocksFoundStr), true);
+  appendStatusField(ss, "poolConnected", monitorData.poolConnected ? "true" : "false", false);
+  appendStatusField(ss, "blocks32", orZero(monitorData.blocks32FoundStr), true);
+  appendStatusField(ss, "blocks16", orZero(monitorData.blocks16FoundStr), true);
+  safeStrnCpy(pool, monitorData.currentPool, sizeof(pool));
+  appendStatusField(ss, "poolHost", pool, true);
+  snprintf(number, sizeof(number), "%d", (int) settings.poolPort);
+  appendStatusField(ss, "poolPort", number, false);
+  // Split to stay clear of %llu on the ESP32
+  uint32_t uptimeHigh = (uint32_t) (monitorData.uptime / 100000000ULL);
+  uint32_t uptimeLow = (uint32_t) (monitorData.uptime % 100000000ULL);
+  if( uptimeHigh ) {
+    snprintf(number, sizeof(number), "%lu%08lu", (unsigned long) uptimeHigh, (unsigned long) uptimeLow);
+  } else {
+    snprintf(number, sizeof(number), "%lu", (unsigned long) uptimeLow);
+  }
+  appendStatusField(ss, "uptime", number, false);
+  appendStatusField(ss, "bestDifficulty", orZero(monitorData.bestDifficultyStr), true);
+  appendStatusField(ss, "totalHashes", orZero(monitorData.totalHashesStr), true);
+  appendStatusField(ss, "totalJobs", orZero(monitorData.totalJobsStr), true);
+  snprintf(number, sizeof(number), "%lu", (unsigned long) monitorData.blockHeight);
+  appendStatusField(ss, "blockHeight", number, false);
+  appendStatusField(ss, "mac", monitorData.macAddress[0] ? monitorData.macAddress : "00:00:00:00:00:00", true);
+  dtostrf(monitorData.poolDifficulty, 1, 2, number);
+  appendStatusField(ss, "poolDifficulty", number, false);
+  bootPhasesJson(bootJson, sizeof(bootJson));
+  appendStatusField(ss, "boot", bootJson, false);
+
+  if( ss->length >= STATUS_SNAPSHOT_SIZE - 1 ) {
+    ss->length = STATUS_SNAPSHOT_SIZE - 2;
+  }
+  ss->json[ss->length++] = '}';
+  ss->json[ss->length] = '\0';
+
+  const StatusSnapshot* current = &statusSnapshots[target ^ 1];
+  if( current->length == ss->length && memcmp(current->json, ss->json, ss->length) == 0 ) {
+    return;
+  }
+
+  // Starts somewhere new each boot, so an ETag a browser kept from before a
+  // reboot can't match. Never 0, which the websocket takes as nothing sent yet.
+  if( ! snapshotVersion ) {
+    snapshotVersion = esp_random();
+  }
+  if( ! ++snapshotVersion ) {
+    snapshotVersion++;
+  }
+  ss->version = snapshotVersion;
+  __atomic_store_n(&publishedSnapshot, target, __ATOMIC_RELEASE);
+
+  // Wake the websocket task so status subscribers get the change right away
+  notifyStatusSubscribers();
+}
+
+// Pin the current snapshot. Must be paired with releaseStatusSnapshot.
+const StatusSnapshot* acquireStatusSnapshot() {
+  while( true ) {
+    uint8_t idx = __atomic_load_n(&publishedSnapshot, __ATOMIC_ACQUIRE);
+    __atomic_add_fetch(&snapshotReaders[idx], 1, __ATOMIC_ACQ_REL);
+    if( idx == __atomic_load_n(&publishedSnapshot, __ATOMIC_ACQUIRE) ) {
+      return &statusSnapshots[idx];
+    }
+    // Flipped underneath us, so let go and take the new one
+    __atomic_sub_fetch(&snapshotReaders[idx], 1, __ATOMIC_ACQ_REL);
+  }
+}
+
+void releaseStatusSnapshot(const StatusSnapshot* snapshot) {
+  uint8_t idx = snapshot == &statusSnapshots[1] ? 1 : 0;
+  __atomic_sub_fetch(&snapshotReaders[idx], 1, __ATOMIC_ACQ_REL);
+}
+
+void monitorTask(void *task_id) {
 
   static uint32_t lastMillis = millis(); 
   //static unsigned long long lastTotalHashes = monitorData.totalHashes;
@@ -62,6 +186,7 @@ void monitorTask(void *task_id) {
 
   // Get MAC address at start
   getMacAddress(monitorData.macAddress);
+  publishStatusSnapshot();
 
   while( true ) {
 
@@ -75,7 +200,7 @@ void monitorTask(void *task_id) {
       monitorData.uptime = bigMillis();
       uptimeToString(monitorData.uptimeStr, monitorData.uptime);
       
-      monitorData.isMining = isMining;
+      monitorData.isMining = isMiningPoolJob();
       //monitorData.hashesPerSecond = (double) (tHashes - lastTotalHashes) / (double) millisDiff;
       monitorData.hashesPerSecond = (double) tHashes / (double) millisDiff;
       monitorData.totalHashes += tHashes;
@@ -85,6 +210,9 @@ void monitorTask(void *task_id) {
       if(! isnan(monitorData.externalHashesPerSecond) ) {
         monitorData.hashesPerSecond += monitorData.externalHashesPerSecond;
       }
+      if(! isnan(monitorData.clusterHashesPerSecond) ) {
+        monitorData.hashesPerSecond += monitorData.clusterHashesPerSecond;
+      }
       
       dtostrf(monitorData.hashesPerSecond, 3, 2, monitorData.hashesPerSecondStr);
       
@@ -115,8 +243,12 @@ void monitorTask(void *task_id) {
         lastValidBlocks = monitorData.validBlocksFound;
       }
       
-      appMessage.action = MAIN_ACTION_REFRESH;
-      xQueueSend(appMessageQueueHandle, &appMessage, 0);
+      publishStatusSnapshot();
+
+      // Journal records are batched here so nobody else waits on flash
+      journalFlush(false);
+
+      postApplicationActions(MAIN_ACTION_REFRESH);
 
       lastMillis = millis();
 
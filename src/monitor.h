@@ -49,10 +49,85 @@ typedef struct {
   uint32_t espNowDiscoverableTime;
   uint32_t sessionPoolSubmissions;
   uint32_t sessionPoolRejects;
+  // Raw counters since boot, exported on /metrics
+  uint64_t core0Hashes;
+  uint32_t sharesAccepted;
+  uint32_t sharesRejected;
+  uint32_t sharesStale;
+  uint32_t sharesDuplicate;
+  uint32_t submitQueueDrops;
+  uint32_t jobsReceived;
+  uint32_t jobSwitches;
+  uint32_t poolReconnects;
+  uint32_t webLogDrops;
+  uint32_t journalDrops;
+  uint32_t eventWakeups;
+  uint32_t appActionsCoalesced;
+  uint32_t displayFrames;
+  uint32_t displayFramesSkipped;
+  uint32_t displayFrameUs;
+  uint32_t displayFrameMaxUs;
+  uint32_t fetchSuccesses;
+  uint32_t fetchFailures;
+  uint32_t timeSyncs;
+  int32_t poolClockOffset;     // Pool clock less ours, seconds
+  uint32_t wifiDisconnects;
+  uint32_t wifiFastConnects;   // Joined the cached AP without a scan
+  uint64_t wifiDowntimeMs;     // WiFi dropping to the pool taking shares again
+  uint32_t wifiLastDowntimeMs;
+  uint32_t dnsCacheHits;
+  uint32_t dnsLookups;
+  uint32_t dnsFallbacks;       // Lookups that failed and used the last known address
+  uint32_t poolResumes;        // Reconnects where the pool took our session id back
+  uint32_t poolDnsMs;          // The last reconnect, phase by phase
+  uint32_t poolConnectMs;
+  uint32_t poolSubscribeMs;
+  uint32_t poolFirstJobMs;
+  uint32_t poolOutageMs;       // Losing the pool to hashing a job from it again
+  uint32_t tlsHandshakes;      // Full handshakes
+  uint32_t tlsResumes;         // Handshakes that resumed a saved session
+  uint32_t tlsFailures;
+  uint32_t tlsPinFailures;     // Pool keys that didn't match the pin
+  uint32_t tlsHandshakeMs;     // The last of each kind
+  uint32_t tlsResumeMs;
+  uint32_t serverClients;      // Miners connected to our stratum server
+  uint32_t serverJobsRelayed;
+  uint32_t serverSharesForwarded;
+  uint32_t serverSharesAccepted;
+  uint32_t serverSharesRejected;
+  uint32_t serverSharesInvalid; // Turned away here, never sent to the pool
+  uint32_t clusterFollowers;   // On a leader
+  uint32_t clusterJobsSent;
+  uint32_t clusterSharesValid;
+  uint32_t clusterSharesInvalid;
+  uint32_t clusterSharesStale; // For a job the leader no longer has
+  double clusterHashesPerSecond; // Followers together, as they report it
+  uint32_t clusterPacketsRejected; // Not tagged with our cluster key
+  uint32_t clusterJobsReceived; // On a follower
+  uint32_t clusterJobsIgnored;  // From a leader that isn't ours
+  uint32_t clusterSharesSent;
 } MonitorData;
 
+#define STATUS_SNAPSHOT_SIZE 960
+#define STATUS_FIELD_COUNT 17
+
+// Prebuilt /statusJson body. The version doubles as the ETag and only moves
+// when the bytes change. Each "key": value pair is also indexed so the
+// websocket status channel can send just the fields that changed.
+typedef struct {
+  uint32_t version;
+  uint16_t length;
+  uint8_t fieldCount;
+  uint16_t fieldStart[STATUS_FIELD_COUNT];
+  uint16_t fieldLength[STATUS_FIELD_COUNT];
+  char json[STATUS_SNAPSHOT_SIZE];
+} StatusSnapshot;
+
 // void updateTotalHashes();
 void monitorTask(void *task_id);
 
+const StatusSnapshot* acquireStatusSnapshot();
+void releaseStatusSnapshot(const StatusSnapshot* snapshot);
+
 
 #endif
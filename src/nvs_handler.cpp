@@ -15,8 +15,10 @@
 #include <Arduino.h>
 #include "nvs_flash.h"
 #include "nvs.h"
+#include "esp_rom_crc.h"
 #include "defines_n_types.h"
 #include "monitor.h"
+#include "nvs_handler.h"
 
 #define NVS_TYPE_16BIT 0
 #define NVS_TYPE_CHAR 1
@@ -25,6 +27,14 @@
 #define NVS_TYPE_32BIT 4
 #define NVS_TYPE_64BIT 5
 
+// Settings and statistics are each kept as a single blob: a header, then one
+// tagged field per table entry. Tags come from the key names, so fields can be
+// added or dropped without a format change; unknown tags are skipped and
+// missing ones get their defaults.
+#define STORE_MAGIC 0x5342
+#define STORE_VERSION 1
+#define STORE_BUFFER_SIZE 2048
+
 
 typedef struct {
   char keyName[32];
@@ -62,6 +72,10 @@ SetupDataTypes setupData[] =
     {"bupPoolPort", NVS_TYPE_16BIT, &defaults16[1], 0, &settings.backupPoolPort},
     {"bupPoolPass", NVS_TYPE_CHAR, defaultChar[3], MAX_POOL_PASSWORD_LENGTH, settings.backupPoolPassword},
     {"bupWallet", NVS_TYPE_CHAR, defaultChar[3], MAX_WALLET_LENGTH, settings.backupWallet},    
+    {"poolTls", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.poolTls},
+    {"poolPin", NVS_TYPE_CHAR, defaultChar[3], MAX_POOL_PIN_LENGTH, settings.poolPin},
+    {"bupPoolTls", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.backupPoolTls},
+    {"bupPoolPin", NVS_TYPE_CHAR, defaultChar[3], MAX_POOL_PIN_LENGTH, settings.backupPoolPin},
     {"screenRot", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.screenRotation},
     {"randoTS", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.randomizeTimestamp},
     {"screenBrt", NVS_TYPE_8BIT, &defaults8[0], 0, &settings.screenBrightness},
@@ -80,6 +94,9 @@ SetupDataTypes setupData[] =
     {"utcOffset", NVS_TYPE_32BIT, &defaults32[0], 0, &settings.utcOffset},
     {"clock24", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.clock24},
     {"stratumRptr", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.stratumRepeater},
+    {"clusterRole", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.clusterRole},
+    {"clusterUdp", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.clusterUdp},
+    {"clusterKey", NVS_TYPE_CHAR, defaultChar[3], MAX_CLUSTER_KEY_LENGTH, settings.clusterKey},
     {"led1red", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.led1red},
     {"led1green", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.led1green},
     {"led1blue", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.led1blue},
@@ -87,7 +104,8 @@ SetupDataTypes setupData[] =
     {"webTheme", NVS_TYPE_8BIT, &defaults8[1], 0, &settings.webTheme},
     {"asicBoost", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.supportAsicBoost},
     {"invertCol", NVS_TYPE_BOOL, &defaultsBool[0], 0, &settings.invertColors},
-    {"logViewer", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.enableLogViewer}
+    {"logViewer", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.enableLogViewer},
+    {"stratumCapture", NVS_TYPE_BOOL, &defaultsBool[1], 0, &settings.stratumCapture}
   }; 
 
 
@@ -102,7 +120,13 @@ SetupDataTypes monitorSavedValues[] =
   {"mBestDiff", NVS_TYPE_64BIT, &defaults64[0], 0, &monitorData.bestDifficulty}
 };
 
+// Held while either store is packed or unpacked in storeBuffer, below
+static StaticSemaphore_t storeMutexBuffer;
+static SemaphoreHandle_t storeMutex = NULL;
+
 void init_nvs() {
+    storeMutex = xSemaphoreCreateMutexStatic(&storeMutexBuffer);
+
     esp_err_t err = nvs_flash_init();
     if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         // NVS partition was truncated and needs to be erased
@@ -175,70 +199,226 @@ bool loadData(SetupDataTypes dt[], size_t items) {
   return rv;
 }
 
-bool loadSettings() {
-  return loadData(setupData, sizeof(setupData) / sizeof(SetupDataTypes));
+typedef struct {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t fieldCount;
+  uint16_t length;    // Of the fields that follow
+  uint16_t reserved;
+  uint32_t crc;       // Of the fields that follow
+} StoreHeader;
+
+typedef struct {
+  const char* blobKey;
+  SetupDataTypes* fields;
+  size_t items;
+  uint32_t savedCrc;  // Of what's on flash, so unchanged data isn't written again
+  bool saved;
+} SettingsStore;
+
+SettingsStore settingsStore = { "settings", setupData, sizeof(setupData) / sizeof(SetupDataTypes), 0, false };
+SettingsStore monitorStore = { "monitor", monitorSavedValues, sizeof(monitorSavedValues) / sizeof(SetupDataTypes), 0, false };
+
+// Shared by both stores. The web server, event task and main loop all save,
+// so whoever is packing or unpacking holds the mutex.
+static uint8_t storeBuffer[STORE_BUFFER_SIZE];
+
+static uint16_t fieldTag(const char* keyName) {
+  uint32_t h = 0x811c9dc5;
+  while( *keyName ) {
+    h = (h ^ (uint8_t) *keyName++) * 0x01000193;
+  }
+  return (h >> 16) ^ (h & 0xffff);
 }
 
-bool loadMonitorData() {
-  return loadData(monitorSavedValues, sizeof(monitorSavedValues) / sizeof(SetupDataTypes));
+static size_t fieldSize(const SetupDataTypes& f) {
+  switch( f.type ) {
+    case NVS_TYPE_BOOL:
+    case NVS_TYPE_8BIT: return 1;
+    case NVS_TYPE_16BIT: return 2;
+    case NVS_TYPE_32BIT: return 4;
+    case NVS_TYPE_64BIT: return 8;
+    case NVS_TYPE_CHAR: return strnlen((const char*) f.settingsPtr, f.maxLength);
+  }
+  return 0;
 }
 
+static void setDefault(const SetupDataTypes& f) {
+  if( f.type == NVS_TYPE_CHAR ) {
+    strncpy((char*) f.settingsPtr, (const char*) f.defaultValue, f.maxLength);
+  } else {
+    memcpy(f.settingsPtr, f.defaultValue, fieldSize(f));
+  }
+}
 
-bool saveData(SetupDataTypes dt[], size_t items) {
-  bool rv = true;
-  nvs_handle_t nvs_handle;
-  esp_err_t err;
+// Pack the table into storeBuffer. Returns the total length including the header.
+static size_t encodeStore(SettingsStore& store) {
+  StoreHeader* h = (StoreHeader*) storeBuffer;
+  size_t pos = sizeof(StoreHeader);
+
+  for( size_t i = 0; i < store.items; i++ ) {
+    const SetupDataTypes& f = store.fields[i];
+    size_t n = fieldSize(f);
+    if( pos + 3 + n > STORE_BUFFER_SIZE ) {
+      dbg("Store %s too large at %s\n", store.blobKey, f.keyName);
+      return 0;
+    }
+    uint16_t tag = fieldTag(f.keyName);
+    storeBuffer[pos++] = tag & 0xff;
+    storeBuffer[pos++] = tag >> 8;
+    storeBuffer[pos++] = n;
+    memcpy(&storeBuffer[pos], f.settingsPtr, n);
+    pos += n;
+  }
 
-  // Open NVS handle
-  err = nvs_open("storage", NVS_READWRITE, &nvs_handle);
-  if (err != ESP_OK) {
-      return false;
+  h->magic = STORE_MAGIC;
+  h->version = STORE_VERSION;
+  h->fieldCount = store.items;
+  h->length = pos - sizeof(StoreHeader);
+  h->reserved = 0;
+  h->crc = esp_rom_crc32_le(0, &storeBuffer[sizeof(StoreHeader)], h->length);
+  return pos;
+}
+
+// Fill the table from storeBuffer, defaults first so missing fields are covered
+static bool decodeStore(SettingsStore& store, size_t length) {
+  const StoreHeader* h = (const StoreHeader*) storeBuffer;
+
+  if( length < sizeof(StoreHeader) || h->magic != STORE_MAGIC || h->length != length - sizeof(StoreHeader) ) {
+    dbg("Store %s is malformed\n", store.blobKey);
+    return false;
+  }
+  if( esp_rom_crc32_le(0, &storeBuffer[sizeof(StoreHeader)], h->length) != h->crc ) {
+    dbg("Store %s failed its CRC check\n", store.blobKey);
+    return false;
   }
 
-  for(int16_t i = 0; i < items; i++) {
-    switch( dt[i].type ) {
-      case NVS_TYPE_BOOL:
-      case NVS_TYPE_8BIT:
-        err = nvs_set_u8(nvs_handle, dt[i].keyName, *((uint8_t*)dt[i].settingsPtr));
-        break;
-      case NVS_TYPE_16BIT:
-        err = nvs_set_u16(nvs_handle, dt[i].keyName, *((uint16_t*)dt[i].settingsPtr));
-        if(err != ESP_OK ) dbg("Error saving 16\n");
-        break;
-      case NVS_TYPE_32BIT:
-        err = nvs_set_u32(nvs_handle, dt[i].keyName, *((uint32_t*)dt[i].settingsPtr));
-        if(err != ESP_OK ) dbg("Error saving 32\n");
-        break;
-      case NVS_TYPE_64BIT:
-        err = nvs_set_u64(nvs_handle, dt[i].keyName, *((uint64_t*)dt[i].settingsPtr));
-        if(err != ESP_OK ) dbg("Error saving 64\n");
-        break;        
-      case NVS_TYPE_CHAR:        
-        err = nvs_set_str(nvs_handle, dt[i].keyName, (char*)dt[i].settingsPtr);
-        if(err != ESP_OK ) dbg("Error saving char\n");
-        break;
+  for( size_t i = 0; i < store.items; i++ ) {
+    setDefault(store.fields[i]);
+  }
+
+  size_t pos = sizeof(StoreHeader);
+  while( pos + 3 <= length ) {
+    uint16_t tag = storeBuffer[pos] | (storeBuffer[pos + 1] << 8);
+    size_t n = storeBuffer[pos + 2];
+    pos += 3;
+    if( pos + n > length ) {
+      break;
     }
-    if( err != ESP_OK ) {
-      dbg("Error saving %d\n", err);
-      rv = false;
-    } 
+    for( size_t i = 0; i < store.items; i++ ) {
+      const SetupDataTypes& f = store.fields[i];
+      if( fieldTag(f.keyName) != tag ) {
+        continue;
+      }
+      if( f.type == NVS_TYPE_CHAR ) {
+        size_t c = n < f.maxLength ? n : f.maxLength;
+        memcpy(f.settingsPtr, &storeBuffer[pos], c);
+        ((char*) f.settingsPtr)[c] = '\0';
+      } else if( n == fieldSize(f) ) {
+        memcpy(f.settingsPtr, &storeBuffer[pos], n);
+      }
+      // A field whose width changed keeps its default
+      break;
+    }
+    pos += n;
   }
 
-  if( rv ) {
-    nvs_commit(nvs_handle);
+  return true;
+}
+
+static bool writeStore(SettingsStore& store) {
+  size_t length = encodeStore(store);
+  if( ! length ) {
+    return false;
+  }
+
+  const StoreHeader* h = (const StoreHeader*) storeBuffer;
+  if( store.saved && h->crc == store.savedCrc ) {
+    dbg("Store %s unchanged, not written\n", store.blobKey);
+    return true;
+  }
+
+  if( ! save_blob(store.blobKey, storeBuffer, length) ) {
+    dbg("Error saving store %s\n", store.blobKey);
+    return false;
+  }
+  dbg("Store %s written: %u bytes\n", store.blobKey, (unsigned) length);
+  store.savedCrc = h->crc;
+  store.saved = true;
+  return true;
+}
+
+static void eraseLegacyKeys(SettingsStore& store) {
+  nvs_handle_t nvs_handle;
+
+  if( nvs_open("storage", NVS_READWRITE, &nvs_handle) != ESP_OK ) {
+    return;
   }
+  for( size_t i = 0; i < store.items; i++ ) {
+    nvs_erase_key(nvs_handle, store.fields[i].keyName);
+  }
+  nvs_commit(nvs_handle);
   nvs_close(nvs_handle);
+}
+
+static bool loadStore(SettingsStore& store) {
+  nvs_handle_t nvs_handle;
+  size_t length = STORE_BUFFER_SIZE;
+  bool found = false;
+  bool rv;
+  uint32_t start = micros();
 
+  if( nvs_open("storage", NVS_READONLY, &nvs_handle) == ESP_OK ) {
+    found = nvs_get_blob(nvs_handle, store.blobKey, storeBuffer, &length) == ESP_OK;
+    nvs_close(nvs_handle);
+  }
+
+  if( found && decodeStore(store, length) ) {
+    store.savedCrc = ((const StoreHeader*) storeBuffer)->crc;
+    store.saved = true;
+    rv = true;
+  } else {
+    // First boot on this firmware: pick up the old one key per field values,
+    // write them as a blob and drop the keys
+    rv = loadData(store.fields, store.items);
+    if( rv && writeStore(store) ) {
+      eraseLegacyKeys(store);
+      dbg("Migrated %s to a single blob\n", store.blobKey);
+    }
+  }
+
+  dbg("Loaded %s in %lu us\n", store.blobKey, (unsigned long) (micros() - start));
   return rv;
 }
 
+static bool lockedLoad(SettingsStore& store) {
+  xSemaphoreTake(storeMutex, portMAX_DELAY);
+  bool rv = loadStore(store);
+  xSemaphoreGive(storeMutex);
+  return rv;
+}
+
+static bool lockedWrite(SettingsStore& store) {
+  xSemaphoreTake(storeMutex, portMAX_DELAY);
+  bool rv = writeStore(store);
+  xSemaphoreGive(storeMutex);
+  return rv;
+}
+
+bool loadSettings() {
+  return lockedLoad(settingsStore);
+}
+
+bool loadMonitorData() {
+  return lockedLoad(monitorStore);
+}
 
 bool saveSettings() { 
-  return saveData(setupData, sizeof(setupData) / sizeof(SetupDataTypes) );
+  return lockedWrite(settingsStore);
 }
 
 bool saveMonitorData() {
-  return saveData(monitorSavedValues, sizeof(monitorSavedValues) / sizeof(SetupDataTypes));
+  return lockedWrite(monitorStore);
 }
 
 
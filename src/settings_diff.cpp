@@ -0,0 +1,117 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <stddef.h>
+#include "defines_n_types.h"
+#include "settings_diff.h"
+
+#define SETTINGS_FIELD_STRING 1     // Compare up to the terminator
+#define SETTINGS_FIELD_STATIC_IP 2  // Only matters while a static address is in use
+
+typedef struct {
+  uint16_t offset;
+  uint16_t size;
+  uint8_t flags;
+  uint16_t mainActions;
+  uint8_t stratumActions;
+} SettingsField;
+
+#define FIELD(name, flags, mainActions, stratumActions) \
+  { offsetof(SetupData, name), sizeof(((SetupData*) 0)->name), flags, mainActions, stratumActions }
+
+#define NETWORK_ACTIONS (MAIN_ACTION_NETWORK_CONNECT | MAIN_ACTION_GOTO_MAIN_SCREEN)
+
+// Anything not listed is read where it's used (theme, log viewer, NTP server,
+// core 0, timestamps, login, stratum server, cluster, stratum capture) and takes effect as
+// soon as it's copied in.
+static const SettingsField settingsFields[] = {
+  FIELD(ssid, SETTINGS_FIELD_STRING, NETWORK_ACTIONS, 0),
+  FIELD(ssidPassword, SETTINGS_FIELD_STRING, NETWORK_ACTIONS, 0),
+  FIELD(staticIp, 0, NETWORK_ACTIONS, 0),
+  FIELD(ipAddress, SETTINGS_FIELD_STATIC_IP, NETWORK_ACTIONS, 0),
+  FIELD(gateway, SETTINGS_FIELD_STATIC_IP, NETWORK_ACTIONS, 0),
+  FIELD(subnet, SETTINGS_FIELD_STATIC_IP, NETWORK_ACTIONS, 0),
+  FIELD(primaryDNS, SETTINGS_FIELD_STATIC_IP, NETWORK_ACTIONS, 0),
+  FIELD(secondaryDNS, SETTINGS_FIELD_STATIC_IP, NETWORK_ACTIONS, 0),
+
+  // A new pool or wallet means a new connection, since many pools tie a
+  // session to the first worker authorized on it. A new password can be
+  // authorized on the connection we already have.
+  FIELD(poolUrl, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_RECONNECT),
+  FIELD(poolPort, 0, 0, STRATUM_ACTION_RECONNECT),
+  FIELD(poolTls, 0, 0, STRATUM_ACTION_RECONNECT),
+  FIELD(poolPin, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_RECONNECT),
+  FIELD(wallet, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_RECONNECT),
+  FIELD(poolPassword, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_REAUTHORIZE),
+  FIELD(backupPoolUrl, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_BACKUP_CHANGED),
+  FIELD(backupPoolPort, 0, 0, STRATUM_ACTION_BACKUP_CHANGED),
+  FIELD(backupPoolTls, 0, 0, STRATUM_ACTION_BACKUP_CHANGED),
+  FIELD(backupPoolPin, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_BACKUP_CHANGED),
+  FIELD(backupWallet, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_BACKUP_CHANGED),
+  FIELD(backupPoolPassword, SETTINGS_FIELD_STRING, 0, STRATUM_ACTION_BACKUP_CHANGED),
+
+  FIELD(screenRotation, 0, MAIN_ACTION_SET_ROTATION | MAIN_ACTION_REDRAW, 0),
+  FIELD(screenBrightness, 0, MAIN_ACTION_SET_BRIGHTNESS, 0),
+  FIELD(foregroundColor, 0, MAIN_ACTION_REDRAW, 0),
+  FIELD(backgroundColor, 0, MAIN_ACTION_REDRAW, 0),
+  FIELD(invertColors, 0, MAIN_ACTION_REDRAW, 0),
+  FIELD(utcOffset, 0, MAIN_ACTION_REDRAW, 0),
+  FIELD(clock24, 0, MAIN_ACTION_REDRAW, 0),
+  FIELD(led1red, 0, MAIN_ACTION_LED1_SET, 0),
+  FIELD(led1green, 0, MAIN_ACTION_LED1_SET, 0),
+  FIELD(led1blue, 0, MAIN_ACTION_LED1_SET, 0)
+};
+
+bool classifySettingsChange(const SetupData* before, const SetupData* after, SettingsChange* change) {
+
+  const uint8_t* a = (const uint8_t*) before;
+  const uint8_t* b = (const uint8_t*) after;
+  bool staticInUse = before->staticIp || after->staticIp;
+
+  memset(change, 0, sizeof(SettingsChange));
+
+  for( size_t i = 0; i < sizeof(settingsFields) / sizeof(SettingsField); i++ ) {
+    const SettingsField& f = settingsFields[i];
+
+    if( (f.flags & SETTINGS_FIELD_STATIC_IP) && ! staticInUse ) {
+      continue;
+    }
+
+    bool differs;
+    if( f.flags & SETTINGS_FIELD_STRING ) {
+      differs = strncmp((const char*) a + f.offset, (const char*) b + f.offset, f.size) != 0;
+    } else {
+      differs = memcmp(a + f.offset, b + f.offset, f.size) != 0;
+    }
+
+    if( differs ) {
+      change->mainActions |= f.mainActions;
+      change->stratumActions |= f.stratumActions;
+      change->fieldsChanged++;
+    }
+  }
+
+  // A new endpoint covers whatever the credentials needed
+  if( change->stratumActions & STRATUM_ACTION_RECONNECT ) {
+    change->stratumActions &= ~STRATUM_ACTION_REAUTHORIZE;
+  }
+
+  // The WiFi reconnect takes the pool connection down with it
+  if( change->mainActions & MAIN_ACTION_NETWORK_CONNECT ) {
+    change->stratumActions = 0;
+  }
+
+  return change->fieldsChanged > 0;
+}
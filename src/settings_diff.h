@@ -0,0 +1,35 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef SETTINGS_DIFF_H
+#define SETTINGS_DIFF_H
+
+#include <Arduino.h>
+#include "defines_n_types.h"
+
+// Rough cost of each way of applying a change, in lost hashing time
+#define DOWNTIME_STRATUM_RECONNECT_MS 5000
+#define DOWNTIME_NETWORK_CONNECT_MS 15000
+
+// What it takes to put a new SetupData into effect
+typedef struct {
+  uint16_t mainActions;     // MAIN_ACTION_* for the event task
+  uint8_t stratumActions;   // STRATUM_ACTION_* for the stratum task
+  uint8_t fieldsChanged;
+} SettingsChange;
+
+// Compares the two field by field. Returns false if nothing differs.
+bool classifySettingsChange(const SetupData* before, const SetupData* after, SettingsChange* change);
+
+#endif
@@ -22,6 +22,16 @@
 #include "monitor.h"
 #include "MyWiFi.h"
 #include "MyWebServer.h"
+#include "journal.h"
+#include "eventTask.h"
+#include "timeService.h"
+#include "bootProfile.h"
+#include "dnsCache.h"
+#include "stratumTransport.h"
+#include "stratumServer.h"
+#include "cluster.h"
+#include "clusterTask.h"
+#include "stratumCapture.h"
 
 unsigned long id = 1;
 
@@ -37,23 +47,46 @@ unsigned long id = 1;
 
 
 extern SetupData settings;
-extern volatile bool isMining;
 extern QueueHandle_t stratumMessageQueueHandle;
-extern QueueHandle_t appMessageQueueHandle;
 extern MonitorData monitorData;
 extern double poolDifficulty;
 
-// Prototype
-void suggestDifficulty(WiFiClient& client, double difficulty);
+// Prototypes
+void suggestDifficulty(StratumTransport& client, double difficulty);
+void dropWork();
 
 uint32_t lastMiningNotify = 0;
+uint32_t poolSessions = 0;
 unsigned long lastSubmitted = millis();
-bool reconnect = false;  // Use this falg to force a reconnect
+volatile uint8_t pendingActions = 0;  // STRATUM_ACTION_* requested by the web task
+uint32_t reauthorizeId = 0;           // Outstanding in-session mining.authorize
 
 
 uint16_t submissionsNextPos = 0;
 jobSubmitQueueEntry submissionsNeedingResponse[MAX_SUBMISSIONS_AWAITING_RESPONSE];
 
+// The pool's name for our last session on the primary [0] and backup [1].
+// It's offered back on the next subscribe so the pool can keep our
+// extranonce1 and vardiff, and the work in hand stays good.
+typedef struct {
+  char host[MAX_POOL_URL_LENGTH + 1];
+  uint16_t port;
+  char id[STRATUM_SESSION_ID_LENGTH];
+  char extraNonce1[STRATUM_EXTRANONCE1_LENGTH];
+} PoolSession;
+
+PoolSession savedSessions[2];
+char subscriptionId[STRATUM_SESSION_ID_LENGTH];   // From the last subscribe response
+
+uint32_t suspendedAt = 0;         // Connection lost but still mining its job, hoping to resume
+uint32_t connectionLostAt = 0;    // For timing the reconnect; 0 when connected
+uint32_t awaitingFirstJob = 0;    // When subscribe finished, until the first notify
+
+// Two of each, for the connection in use and for trying the primary again
+// while on the backup. Static, as the TLS ones are too big for the stack.
+PlainTransport plainTransports[2];
+TlsTransport tlsTransports[2];
+
 
 StaticJsonDocument<4096> doc;
 
@@ -72,7 +105,13 @@ char* currentWallet;
 
 // The web process can request a reconnect
 bool requestStratumReconnect() {
-  reconnect = true;
+  return requestStratumSettingsChange(STRATUM_ACTION_RECONNECT);
+}
+
+// Settings were saved; the stratum task decides what that means for the
+// connection it has. See classifySettingsChange().
+bool requestStratumSettingsChange(uint8_t actions) {
+  __atomic_fetch_or(&pendingActions, actions, __ATOMIC_SEQ_CST);
   return true;
 }
 
@@ -110,8 +149,30 @@ bool parseMiningNotify(String& line) {
     sb.nTime = String((const char*) doc["params"][7]);
     sb.cleanJobs = doc["params"][8];
 
+    poolClockSample(strtoul(sb.nTime.c_str(), NULL, 16));
+
+    // Downstream miners and followers first; ours have to stop before they can switch
+    if( settings.stratumRepeater || settings.clusterRole == CLUSTER_ROLE_LEADER ) {
+      static JobTemplate job;
+      if( jobTemplateDecode(&job, &sb) ) {
+        stratumServerJob(&job, sb.cleanJobs, line);
+        clusterJob(&job, sb.extraNonce1.c_str(), sb.extraNonce2Size, sb.cleanJobs);
+      } else {
+        dbg("Stratum: job %s is too big to hand on\n", sb.jobId.c_str());
+      }
+    }
     startMiningJob(&sb);
 
+    if( awaitingFirstJob ) {
+      monitorData.poolFirstJobMs = millis() - awaitingFirstJob;
+      awaitingFirstJob = 0;
+      if( connectionLostAt ) {
+        monitorData.poolOutageMs = millis() - connectionLostAt;
+        connectionLostAt = 0;
+        dbg("Stratum: back on a job %lu ms after losing the pool\n", monitorData.poolOutageMs);
+      }
+    }
+
   }
   return true;
 }
@@ -119,7 +180,7 @@ bool parseMiningNotify(String& line) {
 
 
 // Submit a job from a queue entry
-void prepareAndSubmit(WiFiClient& client, jobSubmitQueueEntry *sqEntry) {
+void prepareAndSubmit(StratumTransport& client, jobSubmitQueueEntry *sqEntry) {
 
   char msg[STRATUM_OUT_MESSAGE_SIZE];
 
@@ -149,6 +210,7 @@ void prepareAndSubmit(WiFiClient& client, jobSubmitQueueEntry *sqEntry) {
         currentWallet, sqEntry->jobId, sqEntry->extraNonce2, tStamp, nonce, vbits);
   
   client.print(msg);
+  captureLine(CAPTURE_TO_POOL, msg);
 
   dbg("Submitting: ");
   dbg("%s", msg);
@@ -156,11 +218,9 @@ void prepareAndSubmit(WiFiClient& client, jobSubmitQueueEntry *sqEntry) {
   addToWebLog(msg);
 
   //Copy into our buffer of submissions awaiting response
-  if( sqEntry->sessionMessageId ) {
-    memcpy(&submissionsNeedingResponse[submissionsNextPos], sqEntry, sizeof(jobSubmitQueueEntry));
-    if( ++submissionsNextPos >= MAX_SUBMISSIONS_AWAITING_RESPONSE ) {
-      submissionsNextPos = 0;
-    }
+  memcpy(&submissionsNeedingResponse[submissionsNextPos], sqEntry, sizeof(jobSubmitQueueEntry));
+  if( ++submissionsNextPos >= MAX_SUBMISSIONS_AWAITING_RESPONSE ) {
+    submissionsNextPos = 0;
   }
   lastSubmitted = millis();
 }
@@ -180,7 +240,18 @@ bool parseSubscribeResponse(String& line) {
   // Expecting an array type
   if( ! doc["result"].is<JsonArray>() ) return false;
 
-   //mSubscribe.sub_details = String((const char*) doc["result"][0][0][1]);
+  // [[["mining.set_difficulty", id], ["mining.notify", id]], extranonce1, size].
+  // The notify subscription's id is the one pools resume on.
+  subscriptionId[0] = '\0';
+  JsonArray subscriptions = doc["result"][0];
+  for( JsonVariant s : subscriptions ) {
+    const char* method = s[0];
+    const char* sid = s[1];
+    if( sid && (! subscriptionId[0] || (method && strcmp(method, "mining.notify") == 0)) ) {
+      safeStrnCpy(subscriptionId, sid, STRATUM_SESSION_ID_LENGTH);
+    }
+  }
+
   sb.extraNonce1 = String((const char*) doc["result"][1]);
   sb.extraNonce2Size = doc["result"][2];
 
@@ -228,14 +299,43 @@ bool parseConfigResponse(String &line) {
 
 
 
-bool subscribe(WiFiClient& client, const char* wallet, const char* password) {
+// Send mining.authorize and return its id. The response is left to the caller.
+unsigned long authorize(StratumTransport& client, const char* wallet, const char* password) {
+
+  char msg[STRATUM_OUT_MESSAGE_SIZE];
+
+  unsigned long authId = getNextId();
+  snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.authorize\", \"params\": [\"%s\", \"%s\"]}\n", authId, 
+      wallet, password);
+
+  client.print(msg);
+  dbg("Authorizing: %s\n", msg);
+  
+  addToWebLog(msg);
+
+  // A capture is made to be passed around, so it doesn't get the password
+  snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.authorize\", \"params\": [\"%s\", \"x\"]}\n", authId, wallet);
+  captureLine(CAPTURE_TO_POOL, msg);
+
+  return authId;
+}
+
+// slot is 0 for the primary pool, 1 for the backup
+bool subscribe(StratumTransport& client, uint8_t slot, const char* wallet, const char* password) {
 
   int t;
   char msg[STRATUM_OUT_MESSAGE_SIZE];
   char minerName[MINER_NAME_LENGTH];
   char versionStr[15];
+  uint32_t start = millis();
 
   id = 0;
+  poolClockReset();
+
+  PoolSession* session = &savedSessions[slot];
+  const char* host = slot ? settings.backupPoolUrl : settings.poolUrl;
+  uint16_t port = slot ? settings.backupPoolPort : settings.poolPort;
+  bool offered = session->id[0] && session->port == port && strcmp(session->host, host) == 0;
 
   versionToString(versionStr, MINING_HARDWARE_VERSION_HEX);
   strcpy(minerName, MINING_HARDWARE_NAME);
@@ -246,9 +346,14 @@ bool subscribe(WiFiClient& client, const char* wallet, const char* password) {
 
   // Subscribe
   id = getNextId();  
-  snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.subscribe\", \"params\": [\"%s\"]}\n", id, minerName);
+  if( offered ) {
+    snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.subscribe\", \"params\": [\"%s\", \"%s\"]}\n", id, minerName, session->id);
+  } else {
+    snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.subscribe\", \"params\": [\"%s\"]}\n", id, minerName);
+  }
   dbg("Subscribe: %s\n", msg);
   client.print(msg);
+  captureLine(CAPTURE_TO_POOL, msg);
 
   addToWebLog(msg);
 
@@ -260,6 +365,7 @@ bool subscribe(WiFiClient& client, const char* wallet, const char* password) {
 
   if( client.available() ) {
     String resp = client.readStringUntil('\n');
+    captureLine(CAPTURE_FROM_POOL, resp.c_str());
 
     dbg("%s\n", resp.c_str());
 
@@ -275,15 +381,7 @@ bool subscribe(WiFiClient& client, const char* wallet, const char* password) {
 
 
   // Authorize
-  
-  id = getNextId();
-  snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.authorize\", \"params\": [\"%s\", \"%s\"]}\n", id, 
-      wallet, password);
-
-  client.print(msg);
-  dbg("Authorizing: %s\n", msg);
-  
-  addToWebLog(msg);
+  authorize(client, wallet, password);
 
   t = 20;
   while( ! client.available() && t-- > 0) {
@@ -292,9 +390,42 @@ bool subscribe(WiFiClient& client, const char* wallet, const char* password) {
 
   if( client.available() ) {
     String resp = client.readStringUntil('\n');
+    captureLine(CAPTURE_FROM_POOL, resp.c_str());
     dbg("%s\n", resp.c_str());
   }
 
+  if( poolSessions++ ) {
+    monitorData.poolReconnects++;
+  }
+
+  // Same extranonce1 back means the pool took the session id, so the job
+  // we kept mining and the shares it found are still good
+  bool resumed = offered && strcmp(session->extraNonce1, sb.extraNonce1.c_str()) == 0;
+  if( resumed ) {
+    monitorData.poolResumes++;
+    addToWebLog(infoMessageColor, "Resumed the previous pool session.");
+  }
+  if( suspendedAt ) {
+    if( ! resumed ) {
+      dropWork();
+    }
+    suspendedAt = 0;
+  }
+
+  safeStrnCpy(session->host, host, sizeof(session->host));
+  session->port = port;
+  safeStrnCpy(session->id, subscriptionId, sizeof(session->id));
+  safeStrnCpy(session->extraNonce1, sb.extraNonce1.c_str(), sizeof(session->extraNonce1));
+
+  // A resumed session keeps the extranonce1, so downstream miners keep their work too
+  stratumServerUpstream(sb.extraNonce1.c_str(), sb.extraNonce2Size);
+
+  monitorData.poolSubscribeMs = millis() - start;
+  awaitingFirstJob = millis();
+
+  MyWiFi::poolSubscribed();
+  bootMark(BOOT_POOL);
+
   return true;
 
 }
@@ -306,6 +437,8 @@ void parseSetDifficulty(String& line) {
     difficulty = (double) doc["params"][0];
     if( ! isnan(difficulty) && difficulty > 0 ) {
       setPoolDifficulty(difficulty);
+      stratumServerDifficulty(difficulty);
+      clusterDifficulty(difficulty);
     }
   }
   
@@ -316,7 +449,27 @@ void parseMiningConfigure(String& line) {
 
 }
 
-bool handleServerMessage(WiFiClient& client) { 
+// Sort a rejected share by the stratum error code. Pools send either
+// [code, "message", data] or {"code": code, "message": "..."}
+int countRejectedShare() {
+  int code = 0;
+  if( doc["error"].is<JsonArray>() ) {
+    code = doc["error"][0] | 0;
+  } else if( doc["error"].is<JsonObject>() ) {
+    code = doc["error"]["code"] | 0;
+  }
+
+  if( code == STRATUM_ERROR_JOB_NOT_FOUND ) {
+    monitorData.sharesStale++;
+  } else if( code == STRATUM_ERROR_DUPLICATE_SHARE ) {
+    monitorData.sharesDuplicate++;
+  } else {
+    monitorData.sharesRejected++;
+  }
+  return code;
+}
+
+bool handleServerMessage(StratumTransport& client) { 
   
   //JsonDocument doc;
   String line = client.readStringUntil('\n');
@@ -325,7 +478,7 @@ bool handleServerMessage(WiFiClient& client) {
   if( line.length() == 0) {
     return false;
   }
-  
+  captureLine(CAPTURE_FROM_POOL, line.c_str());
   
   addToWebLog(incomingMessageColor, line.c_str());
 
@@ -343,6 +496,18 @@ bool handleServerMessage(WiFiClient& client) {
     bool result = doc["result"];
     String err = doc["error"];
 
+    // The pool wouldn't take the new password on this session, so start a fresh one
+    if( reauthorizeId && id == reauthorizeId ) {
+      reauthorizeId = 0;
+      if( result ) {
+        addToWebLog(infoMessageColor, "New pool password accepted without reconnecting.");
+      } else {
+        addToWebLog(infoMessageColor, "Pool refused the new password in session. Reconnecting.");
+        requestStratumSettingsChange(STRATUM_ACTION_RECONNECT);
+      }
+      return true;
+    }
+
     for(int16_t i = 0; i < MAX_SUBMISSIONS_AWAITING_RESPONSE; i++) {
 
       if( submissionsNeedingResponse[i].submissionMessageId && submissionsNeedingResponse[i].submissionMessageId == id ) {
@@ -353,22 +518,29 @@ bool handleServerMessage(WiFiClient& client) {
               submissionsNeedingResponse[i].sessionMessageId,
               result, err.c_str());
         }
+        double difficulty = submissionsNeedingResponse[i].difficulty;
         if( ! result ) {
           dbg("Rejected submission!\n");
+          int code = countRejectedShare();
+          journalAdd(JOURNAL_SHARE_REJECTED, code, difficulty);
         } else {
+          monitorData.sharesAccepted++;
+          journalAdd(JOURNAL_SHARE_ACCEPTED, 0, difficulty);
+          bootMark(BOOT_FIRST_SHARE);
           // If it wasn't rejected, then update our stats
           if( submissionsNeedingResponse[i].submitflags & SUBMIT_FLAG_BLOCK_SOLUTION ) {
             monitorData.validBlocksFound++;
+            journalAdd(JOURNAL_BLOCK_FOUND, 0, difficulty);
           }
           if( submissionsNeedingResponse[i].submitflags & SUBMIT_FLAG_32BIT ) {
             monitorData.blocks32Found++;
           }
-          double difficulty = submissionsNeedingResponse[i].difficulty;
 
           if( ! isnan(difficulty) && ! isinf(difficulty) && 
             (isnan(monitorData.bestDifficulty) || isinf(monitorData.bestDifficulty) || difficulty >= monitorData.bestDifficulty) ) 
           {
             monitorData.bestDifficulty = difficulty;
+            journalAdd(JOURNAL_BEST_DIFFICULTY, 0, difficulty);
           }
         }
 
@@ -395,7 +567,7 @@ bool handleServerMessage(WiFiClient& client) {
   return true;
 }
 
-void suggestDifficulty(WiFiClient& client, double difficulty) {
+void suggestDifficulty(StratumTransport& client, double difficulty) {
       
     char msg[STRATUM_OUT_MESSAGE_SIZE];
 
@@ -403,6 +575,7 @@ void suggestDifficulty(WiFiClient& client, double difficulty) {
     unsigned long id = getNextId();
     snprintf(msg, STRATUM_OUT_MESSAGE_SIZE, "{\"id\": %lu, \"method\": \"mining.suggest_difficulty\", \"params\": [%.10g]}\n", id, difficulty);
     client.print(msg);
+    captureLine(CAPTURE_TO_POOL, msg);
 
     addToWebLog(msg);
     
@@ -413,27 +586,108 @@ void suggestDifficulty(WiFiClient& client, double difficulty) {
 }
 
 void stopExternalMiners() {
-  ApplicationMessage m;
-  m.action = MAIN_ACTION_STOP_EXTERNAL_MINERS;
-  xQueueSend(appMessageQueueHandle, &m, pdMS_TO_TICKS(150));
+  stratumCloseClientConnections();
+  clusterStop();
 }
 
 // Stop the stratum connection and stop mining
-void stopClient(WiFiClient& client) {
-  isMining = false;
+// Closes the connection, leaving the miners and the submit queue alone
+void closeClient(StratumTransport& client) {
+  if( monitorData.poolConnected ) {
+    journalAdd(JOURNAL_POOL_DISCONNECTED, 0, 0);
+  }
   client.stop();
-  stopExternalMiners();
+  captureEvent("closed");
   monitorData.poolConnected = false;
   monitorData.currentPool[0] = '\0';
+
+  // Nothing sent on this connection will be answered now, and the ids start over
+  for( int16_t i = 0; i < MAX_SUBMISSIONS_AWAITING_RESPONSE; i++ ) {
+    submissionsNeedingResponse[i].submissionMessageId = 0;
+  }
+  if( ! connectionLostAt ) {
+    connectionLostAt = millis() ? millis() : 1;
+  }
+}
+
+// Stops work on the current job and throws away shares waiting to go
+void dropWork() {
+  stopMiningJob();
+  stopExternalMiners();
   vTaskDelay(20 / portTICK_PERIOD_MS);
   xQueueReset(stratumMessageQueueHandle); // Clear the submission queue
 }
 
+void stopClient(StratumTransport& client) {
+  suspendedAt = 0;
+  closeClient(client);
+  dropWork();
+}
+
+// The connection's gone. With a session id to offer back the pool may let
+// us carry on where we were, so the miners keep at the job they have and
+// their shares wait in the queue. After STRATUM_RESUME_GRACE_MS, or if
+// there's nothing to resume, it's a plain stop.
+void suspendClient(StratumTransport& client, bool usingBackup) {
+  if( ! savedSessions[usingBackup ? 1 : 0].id[0] || ! isMiningPoolJob() ) {
+    stopClient(client);
+    return;
+  }
+  if( ! suspendedAt ) {
+    dbg("Stratum: connection lost, mining on while we reconnect\n");
+    suspendedAt = millis() ? millis() : 1;
+    closeClient(client);
+  } else if( millis() - suspendedAt > STRATUM_RESUME_GRACE_MS ) {
+    dbg("Stratum: couldn't resume in time, dropping the job\n");
+    stopClient(client);
+  }
+}
+
+// Connects to the primary (slot 0) or backup pool through the address cache,
+// on whichever transport its settings ask for, timing the lookup and the
+// connect. busy is the transport holding the other connection, if any.
+StratumTransport* connectPool(uint8_t slot, StratumTransport* busy) {
+  const char* host = slot ? settings.backupPoolUrl : settings.poolUrl;
+  uint16_t port = slot ? settings.backupPoolPort : settings.poolPort;
+  bool tls = slot ? settings.backupPoolTls : settings.poolTls;
+  const char* pin = slot ? settings.backupPoolPin : settings.poolPin;
+
+  StratumTransport* client = tls ? (StratumTransport*) &tlsTransports[0] : &plainTransports[0];
+  if( client == busy ) {
+    client = tls ? (StratumTransport*) &tlsTransports[1] : &plainTransports[1];
+  }
+  if( tls ) {
+    ((TlsTransport*) client)->setPin(pin);
+  }
+
+  uint32_t start = millis();
+  IPAddress ip;
+  if( ! dnsResolve(host, ip) ) {
+    return NULL;
+  }
+  monitorData.poolDnsMs = millis() - start;
+
+  start = millis();
+  if( ! client->open(host, ip, port) ) {
+    dnsForget(host);
+    return NULL;
+  }
+  monitorData.poolConnectMs = millis() - start;
+  captureEvent("connect %s %u%s", host, port, tls ? " tls" : "");
+
+  if( tls && ! pin[0] ) {
+    char msg[160];
+    snprintf(msg, sizeof(msg), "No TLS key pin set for %s, so its key isn't checked. It's %s", host, ((TlsTransport*) client)->peerPin());
+    addToWebLog(infoMessageColor, msg);
+  }
+  return client;
+}
+
 
 void stratumTask(void *task_id) {
   
   bool usingBackup = false;
-  WiFiClient client, altClient;
+  StratumTransport* client = &plainTransports[0];   // Never NULL; idle until connected
 
   jobSubmitQueueEntry sqEntry;
 
@@ -449,8 +703,8 @@ void stratumTask(void *task_id) {
       //Serial.println("Stratum: WiFi not connected");
       monitorData.wifiConnected = false;
       monitorData.poolConnected = false;
-      if( isMining || client.connected() ) {
-        stopClient(client);
+      if( isMiningPoolJob() || client->connected() ) {
+        suspendClient(*client, usingBackup);
       }
       vTaskDelay(500 / portTICK_PERIOD_MS);
       continue;
@@ -459,10 +713,20 @@ void stratumTask(void *task_id) {
     // If we're here, then we're connected to WiFi
     monitorData.wifiConnected = true;
 
+    // A follower's work comes from its cluster leader
+    if( clusterFollowing() ) {
+      if( client->connected() || monitorData.poolConnected ) {
+        addToWebLog(infoMessageColor, "Following a cluster leader; leaving the pool.");
+        stopClient(*client);
+      }
+      vTaskDelay(1000 / portTICK_PERIOD_MS);
+      continue;
+    }
+
     if( ! (strlen(settings.poolUrl) && settings.poolPort) ) {
       dbg("Stratum: No pool specified.\n");
-      if( isMining || client.connected() ) {
-        stopClient(client);
+      if( isMiningPoolJob() || client->connected() ) {
+        stopClient(*client);
       }
       vTaskDelay(5000 / portTICK_PERIOD_MS);
       continue;
@@ -470,25 +734,25 @@ void stratumTask(void *task_id) {
 
     if( ! settings.wallet[0]  || ! settings.poolPassword[0] ) {
       dbg("Stratum: Wallet and/or pool password not set.\n");
-      if( isMining || client.connected() ) {
-        stopClient(client);
+      if( isMiningPoolJob() || client->connected() ) {
+        stopClient(*client);
       }
       vTaskDelay(5000 / portTICK_PERIOD_MS);
       continue;
     }
 
-    if(! client.connected()) {
-      if( isMining || monitorData.poolConnected ) {
-        stopClient(client);
+    if(! client->connected()) {
+      if( isMiningPoolJob() || monitorData.poolConnected ) {
+        suspendClient(*client, usingBackup);
       }
       usingBackup = false;
-      //stratumCloseClientConnections(); // Close out anyone connected to us on our StratumServer
       dbg("*************************************************\nStratum: Attempting client connection...\n*************************************************\n");
       
       
       addToWebLog(infoMessageColor, "Connecting to primary pool.");
 
-      if (!client.connect(settings.poolUrl, settings.poolPort)) {
+      StratumTransport* connection = connectPool(0, NULL);
+      if( ! connection ) {
 
         dbg("Connection failed.\n");
 
@@ -500,16 +764,20 @@ void stratumTask(void *task_id) {
           if( strlen(settings.backupPoolUrl) && strlen(settings.backupPoolPassword) && strlen(settings.backupWallet) && settings.backupPoolPort ) {
             dbg("*** Attempting backup pool connection ***\n");
             addToWebLog(infoMessageColor, "Connecting to backup pool.");
-            if( client.connect(settings.backupPoolUrl, settings.backupPoolPort) ) {              
-              if( subscribe(client, settings.backupWallet, settings.backupPoolPassword) ) { // Try to subscribe to backup connection
+            connection = connectPool(1, NULL);
+            if( connection ) {
+              client = connection;
+              if( subscribe(*client, 1, settings.backupWallet, settings.backupPoolPassword) ) { // Try to subscribe to backup connection
                 lastMiningNotify = millis();
                 backupConnectTime = millis();
                 currentWallet = settings.backupWallet;
                 safeStrnCpy(monitorData.currentPool, settings.backupPoolUrl, MAX_POOL_URL_LENGTH + 1);
                 usingBackup = true;
+                journalAdd(JOURNAL_POOL_FAILOVER, 1, 0);
+                journalAdd(JOURNAL_POOL_CONNECTED, 1, 0);
               } else {
                 addToWebLog(infoMessageColor, "Backup pool connection failed.");
-                client.stop();
+                client->stop();
               }
             } 
           }
@@ -518,7 +786,8 @@ void stratumTask(void *task_id) {
         }     
 
       } else {
-      
+        client = connection;
+
         // Reset last notify time to connection time
         lastMiningNotify = millis();
         
@@ -527,13 +796,14 @@ void stratumTask(void *task_id) {
         usingBackup = false;
 
         // Got connection, so try to subscribe
-        if( ! subscribe(client, settings.wallet, settings.poolPassword) ) {
-          stopClient(client);
+        if( ! subscribe(*client, 0, settings.wallet, settings.poolPassword) ) {
+          stopClient(*client);
           vTaskDelay(10000 / portTICK_PERIOD_MS);
           continue;
         } else {
           currentWallet = settings.wallet;
           safeStrnCpy(monitorData.currentPool, settings.poolUrl, MAX_POOL_URL_LENGTH + 1);
+          journalAdd(JOURNAL_POOL_CONNECTED, 0, 0);
         }
       }
 
@@ -543,17 +813,20 @@ void stratumTask(void *task_id) {
     if( usingBackup && millis() - backupConnectTime > 120000 ) {
       addToWebLog(infoMessageColor, "Attempting reconnect to primary pool.");
       dbg("********** Attempt reconnect to main ***********\n");
-      if( altClient.connect(settings.poolUrl, settings.poolPort) ) {
-        if( subscribe(altClient, settings.wallet, settings.poolPassword) ) {
-          stopClient(client);
-          //stratumCloseClientConnections(); // Close out anyone connected to us on our StratumServer
+      StratumTransport* altClient = connectPool(0, client);
+      if( altClient ) {
+        if( subscribe(*altClient, 0, settings.wallet, settings.poolPassword) ) {
+          stopClient(*client);
           usingBackup = false;
           currentWallet = settings.wallet;
           safeStrnCpy(monitorData.currentPool, settings.poolUrl, MAX_POOL_URL_LENGTH + 1);
           client = altClient;
+          journalAdd(JOURNAL_POOL_RECOVERED, 0, 0);
+          journalAdd(JOURNAL_POOL_CONNECTED, 0, 0);
           addToWebLog(infoMessageColor, "Successful reconnect to primary pool.");
           continue;
         }
+        altClient->stop();
       }      
       // Still here, then reset backup time
       backupConnectTime = millis();
@@ -564,34 +837,49 @@ void stratumTask(void *task_id) {
     lastPoolConnectTime = millis();
 
     // Handle any incoming messages
-    while( client.available() > 0 ) {
-      handleServerMessage(client);
+    while( client->available() > 0 ) {
+      handleServerMessage(*client);
     }
 
     // Look for submit messages on the queue
     while( uxQueueMessagesWaiting(stratumMessageQueueHandle) ) {
       if( xQueueReceive( stratumMessageQueueHandle, &sqEntry, 0 ) == pdTRUE ) {
-        prepareAndSubmit(client, &sqEntry);
+        prepareAndSubmit(*client, &sqEntry);
       }
     }
 
 
-    // If we were asked to reconnect, let's do it
-    if( reconnect ) {
-      stopClient(client);
+    // Settings changes from the web side
+    uint8_t actions = __atomic_exchange_n(&pendingActions, 0, __ATOMIC_SEQ_CST);
+    if( usingBackup && (actions & (STRATUM_ACTION_BACKUP_CHANGED | STRATUM_ACTION_REAUTHORIZE)) ) {
+      // On the backup, its own settings are the identity of this session. New
+      // primary credentials are simply used on the next attempt to switch back.
+      if( actions & STRATUM_ACTION_BACKUP_CHANGED ) {
+        actions |= STRATUM_ACTION_RECONNECT;
+      }
+      actions &= ~STRATUM_ACTION_REAUTHORIZE;
+    }
+
+    if( actions & STRATUM_ACTION_RECONNECT ) {
+      reauthorizeId = 0;
+      stopClient(*client);
       vTaskDelay(100 / portTICK_PERIOD_MS);
-      reconnect = false;
+    } else if( actions & STRATUM_ACTION_REAUTHORIZE ) {
+      // Same worker, so a new password just gets authorized on the
+      // connection we have
+      addToWebLog(infoMessageColor, "Authorizing the new pool password on the current connection.");
+      reauthorizeId = authorize(*client, settings.wallet, settings.poolPassword);
     }
 
     if( millis() - lastSubmitted > 120000 ) {
-      suggestDifficulty(client, DESIRED_DIFFICULTY);
+      suggestDifficulty(*client, DESIRED_DIFFICULTY);
     }
 
     // If we're not getting messages from the server, time to close the connection
     if( millis() - lastMiningNotify >= 700000 ) {
       addToWebLog(infoMessageColor, "No client activity. Disconnecting from pool.");
       dbg("******* DEAD CLIENT *******\n");
-      stopClient(client);
+      stopClient(*client);
       vTaskDelay(100 / portTICK_PERIOD_MS);
     }
 
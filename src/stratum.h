@@ -23,6 +23,14 @@
 
 #define MAX_SUBMISSIONS_AWAITING_RESPONSE 30
 
+#define STRATUM_SESSION_ID_LENGTH 65
+#define STRATUM_EXTRANONCE1_LENGTH 33
+#define STRATUM_RESUME_GRACE_MS 60000     // Mining on through a lost connection while we try to resume
+
+// Share rejection codes from the stratum v1 spec
+#define STRATUM_ERROR_JOB_NOT_FOUND 21
+#define STRATUM_ERROR_DUPLICATE_SHARE 22
+
 typedef void (*StratumSubmitCallback)(uint32_t, uint32_t, bool, const char*);
 
 #define SUBMIT_FLAG_32BIT 2
@@ -60,6 +68,7 @@ typedef struct {
 
 
 bool requestStratumReconnect();
+bool requestStratumSettingsChange(uint8_t actions);
 void stratumTask(void *task_id);
 
 #endif
\ No newline at end of file
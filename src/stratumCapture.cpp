@@ -0,0 +1,232 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <stdarg.h>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "jobBuilder.h"
+#include "stratumCapture.h"
+
+#if defined(USE_SD_CARD)
+  #include <FS.h>
+  #include <SD.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Stratum capture.
+//
+// With the setting on, every line to and from the pool goes into a ring in
+// RAM, along with the header each job was built into, for a pool that
+// misbehaves in ways we can't reproduce. The ring holds the last few minutes
+// and is downloaded from /stratum.cap; boards with an SD card also append
+// everything to a file there. Only the stratum task writes. Turning the
+// setting off stops recording but keeps the ring to download.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern SetupData settings;
+
+static char* ring = NULL;
+static uint32_t ringStart = 0;    // Where the oldest line kept starts, counting every byte ever written
+static uint32_t ringEnd = 0;      // Just past the newest
+
+static StaticSemaphore_t captureMutexBuffer;
+static SemaphoreHandle_t captureMutex = NULL;
+
+#if defined(USE_SD_CARD)
+static File sdFile;
+static bool sdTried = false;
+static uint32_t sdFlushedAt = 0;
+#endif
+
+
+void captureBegin() {
+  captureMutex = xSemaphoreCreateMutexStatic(&captureMutexBuffer);
+}
+
+static void ringCopy(const char* data, size_t len) {
+  while( len ) {
+    size_t at = ringEnd % STRATUM_CAPTURE_SIZE;
+    size_t n = STRATUM_CAPTURE_SIZE - at < len ? STRATUM_CAPTURE_SIZE - at : len;
+    memcpy(&ring[at], data, n);
+    ringEnd += n;
+    data += n;
+    len -= n;
+  }
+}
+
+static void ringAdd(const char* prefix, size_t prefixLen, const char* text, size_t textLen) {
+  size_t len = prefixLen + textLen + 1;
+  if( len > STRATUM_CAPTURE_SIZE ) {
+    dbg("Stratum capture: a %u byte line won't fit\n", (unsigned) len);
+    return;
+  }
+
+  xSemaphoreTake(captureMutex, portMAX_DELAY);
+  // Whole lines go, oldest first, until the new one fits
+  while( ringEnd - ringStart + len > STRATUM_CAPTURE_SIZE ) {
+    while( ringStart != ringEnd && ring[ringStart++ % STRATUM_CAPTURE_SIZE] != '\n' );
+  }
+  ringCopy(prefix, prefixLen);
+  ringCopy(text, textLen);
+  ringCopy("\n", 1);
+  xSemaphoreGive(captureMutex);
+}
+
+#if defined(USE_SD_CARD)
+static void sdAdd(const char* prefix, size_t prefixLen, const char* text, size_t textLen) {
+  if( ! sdTried ) {
+    sdTried = true;
+    if( SD.cardType() != CARD_NONE ) {
+      sdFile = SD.open(STRATUM_CAPTURE_SD_PATH, FILE_APPEND);
+      dbg("Stratum capture on SD card\n");
+    }
+  }
+  if( ! sdFile ) {
+    return;
+  }
+
+  if( sdFile.size() >= STRATUM_CAPTURE_SD_BYTES ) {
+    sdFile.close();
+    SD.remove(STRATUM_CAPTURE_SD_OLD_PATH);
+    SD.rename(STRATUM_CAPTURE_SD_PATH, STRATUM_CAPTURE_SD_OLD_PATH);
+    sdFile = SD.open(STRATUM_CAPTURE_SD_PATH, FILE_APPEND);
+    if( ! sdFile ) {
+      return;
+    }
+  }
+
+  sdFile.write((const uint8_t*) prefix, prefixLen);
+  sdFile.write((const uint8_t*) text, textLen);
+  sdFile.write('\n');
+  if( millis() - sdFlushedAt >= STRATUM_CAPTURE_SD_FLUSH_MS ) {
+    sdFile.flush();
+    sdFlushedAt = millis();
+  }
+}
+
+static void sdClose() {
+  if( sdFile ) {
+    sdFile.close();
+  }
+  sdTried = false;
+}
+#endif
+
+// Most of what's recorded is on its way out or just in, so any trailing
+// newline is left off; the record adds its own
+void captureLine(char kind, const char* text) {
+  if( ! settings.stratumCapture || ! captureMutex ) {
+#if defined(USE_SD_CARD)
+    sdClose();
+#endif
+    return;
+  }
+
+  if( ! ring ) {
+    char* buffer = (char*) malloc(STRATUM_CAPTURE_SIZE);
+    if( ! buffer ) {
+      dbg("Stratum capture: no memory for the ring\n");
+      return;
+    }
+    xSemaphoreTake(captureMutex, portMAX_DELAY);
+    ring = buffer;
+    xSemaphoreGive(captureMutex);
+  }
+
+  size_t textLen = strlen(text);
+  while( textLen && (text[textLen - 1] == '\n' || text[textLen - 1] == '\r') ) {
+    textLen--;
+  }
+
+  char prefix[16];
+  int prefixLen = snprintf(prefix, sizeof(prefix), "%lu %c ", (unsigned long) millis(), kind);
+
+  ringAdd(prefix, prefixLen, text, textLen);
+#if defined(USE_SD_CARD)
+  sdAdd(prefix, prefixLen, text, textLen);
+#endif
+}
+
+void captureEvent(const char* format, ...) {
+  if( ! settings.stratumCapture ) {
+    return;
+  }
+
+  char text[STRATUM_CAPTURE_EVENT_SIZE];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  captureLine(CAPTURE_EVENT, text);
+}
+
+// The header as startMiningJob() built it, before the timestamp roll, nonce 0.
+// The extranonce1 is repeated so a ring that's lost the subscribe still replays.
+void captureJob(const char* jobId, const char* extraNonce1, unsigned long extraNonce2, size_t extraNonce2Size, const hash_block* block) {
+  if( ! settings.stratumCapture ) {
+    return;
+  }
+
+  char en2[17];
+  char header[sizeof(hash_block) * 2 + 1];
+  hash_block hb = *block;
+  hb.nonce = 0;
+  encodeExtraNonce(en2, extraNonce2Size <= 8 ? extraNonce2Size : 8, extraNonce2);
+  bin2hex(header, (unsigned char*) &hb, sizeof(hb));
+
+  char text[MAX_JOB_ID_LENGTH + STRATUM_EXTRANONCE1_LENGTH + sizeof(en2) + sizeof(header) + 3];
+  snprintf(text, sizeof(text), "%s %s %s %s", jobId, extraNonce1[0] ? extraNonce1 : "-", en2, header);
+  captureLine(CAPTURE_JOB, text);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Download
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// Where the capture ends right now. A download stops here rather than
+// chasing a ring that's still filling.
+uint32_t captureEnd() {
+  if( ! captureMutex ) {
+    return 0;
+  }
+  xSemaphoreTake(captureMutex, portMAX_DELAY);
+  uint32_t end = ring ? ringEnd : 0;
+  xSemaphoreGive(captureMutex);
+  return end;
+}
+
+// Copies out from *position up to end, oldest first, and moves *position on;
+// 0 when there's nothing left. Anything dropped since the last call is
+// skipped to the next whole line. The lock is only held for each copy.
+size_t captureRead(uint32_t* position, uint32_t end, char* buffer, size_t len) {
+  if( ! captureMutex ) {
+    return 0;
+  }
+
+  xSemaphoreTake(captureMutex, portMAX_DELAY);
+  if( ! ring ) {
+    xSemaphoreGive(captureMutex);
+    return 0;
+  }
+  if( (int32_t) (*position - ringStart) < 0 ) {
+    *position = ringStart;
+  }
+  size_t n = 0;
+  while( n < len && (int32_t) (end - *position) > 0 ) {
+    buffer[n++] = ring[(*position)++ % STRATUM_CAPTURE_SIZE];
+  }
+  xSemaphoreGive(captureMutex);
+  return n;
+}
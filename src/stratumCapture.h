@@ -0,0 +1,43 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef STRATUM_CAPTURE_H
+#define STRATUM_CAPTURE_H
+
+#include <Arduino.h>
+#include "miner.h"
+
+#define STRATUM_CAPTURE_SIZE (16 * 1024)              // RAM ring, only allocated once capturing starts
+#define STRATUM_CAPTURE_SD_BYTES (4 * 1024 * 1024)    // Then the card's file is kept as the old one and started over
+#define STRATUM_CAPTURE_SD_PATH "/stratum.cap"
+#define STRATUM_CAPTURE_SD_OLD_PATH "/stratum.old"
+#define STRATUM_CAPTURE_SD_FLUSH_MS 1000
+#define STRATUM_CAPTURE_EVENT_SIZE 160
+
+// A capture is text, a record to a line: milliseconds since boot, the
+// kind, then the rest. tools/stratum_replay reads it back.
+#define CAPTURE_FROM_POOL '<'       // A line as the pool sent it
+#define CAPTURE_TO_POOL '>'         // A line as we sent it, less the pool password
+#define CAPTURE_EVENT '*'           // "connect host port" and "closed"
+#define CAPTURE_JOB 'J'             // Job id, then extranonce1 ("-" if none), extranonce2 and the header in hex
+
+void captureBegin();
+void captureLine(char kind, const char* text);
+void captureEvent(const char* format, ...);
+void captureJob(const char* jobId, const char* extraNonce1, unsigned long extraNonce2, size_t extraNonce2Size, const hash_block* block);
+
+uint32_t captureEnd();
+size_t captureRead(uint32_t* position, uint32_t end, char* buffer, size_t len);
+
+#endif
@@ -0,0 +1,649 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "miner.h"
+#include "jobTemplate.h"
+#include "MyWebServer.h"
+#include "stratumServer.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Stratum server.
+//
+// Other miners on the LAN can point at us instead of the pool and share our
+// one upstream connection. Each gets its own first byte of the pool's
+// extranonce2 (ours is 0), so nobody hashes the same work twice. Jobs go
+// down as the pool sent them. Shares are checked here against the pool's
+// difficulty before they go up, so a bad miner can't get the session
+// banned, and the pool's answer comes back to whoever found the share.
+//
+// The stratum task only ever copies state in under the mutex; everything
+// that talks to a downstream miner happens in this task.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern SetupData settings;
+extern MonitorData monitorData;
+extern QueueHandle_t stratumMessageQueueHandle;
+extern TaskHandle_t strServerTaskHandle;
+extern const char* infoMessageColor;
+
+// The pool's answer to a share, on its way back down
+typedef struct {
+  uint32_t sessionId;
+  uint32_t messageId;
+  bool result;
+  char error[96];
+} ServerResult;
+
+typedef struct {
+  WiFiClient client;
+  uint8_t generation;           // Moves with each new miner in the slot, so late answers go nowhere
+  bool subscribed;
+  bool authorized;
+  uint32_t connectedAt;
+  uint16_t length;
+  char line[STRATUM_SERVER_LINE_SIZE + 1];
+  char worker[64];
+} ServerClient;
+
+// Shared with the stratum task
+static StaticSemaphore_t upstreamMutexBuffer;
+static SemaphoreHandle_t upstreamMutex = NULL;
+static char upstreamExtraNonce1[STRATUM_EXTRANONCE1_LENGTH];
+static uint8_t upstreamExtraNonce2Size = 0;
+static uint32_t upstreamGeneration = 0;       // Moves when downstream miners have to start over
+static double upstreamDifficulty = 0;
+static uint32_t difficultyVersion = 0;
+static char notifyLine[STRATUM_SERVER_NOTIFY_SIZE];
+static uint32_t notifyVersion = 0;
+static JobTemplate jobs[STRATUM_SERVER_JOBS];
+static uint8_t nextJob = 0;
+
+static StaticQueue_t resultQueueBuffer;
+static uint8_t resultQueueStorage[STRATUM_SERVER_RESULTS * sizeof(ServerResult)];
+static QueueHandle_t resultQueue = NULL;
+
+// Only ever used from the server task
+static WiFiServer server(STRATUM_SERVER_PORT);
+static bool listening = false;
+static ServerClient clients[STRATUM_SERVER_MAX_CLIENTS];
+static StaticJsonDocument<1024> request;
+static JobTemplate job;
+static char out[STRATUM_SERVER_NOTIFY_SIZE];
+static uint8_t recentShares[STRATUM_SERVER_RECENT_SHARES][8];
+static uint8_t nextRecent = 0;
+static double rateDifficulty = 0;             // Share difficulty forwarded this interval
+static uint32_t rateStart = 0;
+static double hashRate = NAN;
+
+
+void stratumServerBegin() {
+  upstreamMutex = xSemaphoreCreateMutexStatic(&upstreamMutexBuffer);
+  resultQueue = xQueueCreateStatic(STRATUM_SERVER_RESULTS, sizeof(ServerResult), resultQueueStorage, &resultQueueBuffer);
+}
+
+static void wakeServer() {
+  if( strServerTaskHandle ) {
+    xTaskNotifyGive(strServerTaskHandle);
+  }
+}
+
+static bool isHexString(const char* s, size_t len) {
+  if( strlen(s) != len ) {
+    return false;
+  }
+  for( size_t i = 0; i < len; i++ ) {
+    if( ! isxdigit((unsigned char) s[i]) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Upstream, called from the stratum task
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// Everyone's work depends on extranonce1, so a new one means starting over
+static void resetUpstream() {
+  upstreamGeneration++;
+  notifyLine[0] = 0;
+  for( uint8_t i = 0; i < STRATUM_SERVER_JOBS; i++ ) {
+    jobs[i].jobId[0] = 0;
+  }
+}
+
+void stratumServerUpstream(const char* extraNonce1, int extraNonce2Size) {
+  if( ! upstreamMutex ) {
+    return;
+  }
+
+  // One byte of extranonce2 is ours to hand out, and the rest has to fit the subscribe reply
+  if( strlen(extraNonce1) >= sizeof(upstreamExtraNonce1) || extraNonce2Size < 2 || extraNonce2Size > 8 ) {
+    extraNonce1 = "";
+    extraNonce2Size = 0;
+  }
+
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  bool changed = strcmp(upstreamExtraNonce1, extraNonce1) != 0 || upstreamExtraNonce2Size != extraNonce2Size;
+  if( changed ) {
+    safeStrnCpy(upstreamExtraNonce1, extraNonce1, sizeof(upstreamExtraNonce1));
+    upstreamExtraNonce2Size = extraNonce2Size;
+    resetUpstream();
+  }
+  xSemaphoreGive(upstreamMutex);
+
+  if( changed ) {
+    wakeServer();
+  }
+}
+
+// Called with the notify line as the pool sent it, before our own miners take the job
+void stratumServerJob(const JobTemplate* decoded, bool cleanJobs, const String& line) {
+  if( ! upstreamMutex || ! settings.stratumRepeater ) {
+    return;
+  }
+
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  if( cleanJobs ) {
+    for( uint8_t i = 0; i < STRATUM_SERVER_JOBS; i++ ) {
+      jobs[i].jobId[0] = 0;
+    }
+  }
+
+  bool ok = line.length() + 1 < sizeof(notifyLine);
+  if( ok ) {
+    memcpy(&jobs[nextJob], decoded, sizeof(JobTemplate));
+    nextJob = (nextJob + 1) % STRATUM_SERVER_JOBS;
+    memcpy(notifyLine, line.c_str(), line.length());
+    notifyLine[line.length()] = '\n';
+    notifyLine[line.length() + 1] = 0;
+    notifyVersion++;
+  }
+  xSemaphoreGive(upstreamMutex);
+
+  if( ok ) {
+    wakeServer();
+  } else {
+    dbg("Stratum server: job %s is too big to pass down\n", decoded->jobId);
+  }
+}
+
+void stratumServerDifficulty(double difficulty) {
+  if( ! upstreamMutex ) {
+    return;
+  }
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  upstreamDifficulty = difficulty;
+  difficultyVersion++;
+  xSemaphoreGive(upstreamMutex);
+  wakeServer();
+}
+
+// The work everyone has is gone. Whoever comes back gets the next job, or is
+// sent away again if that comes with a new extranonce1.
+void stratumCloseClientConnections() {
+  if( ! upstreamMutex ) {
+    return;
+  }
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  resetUpstream();
+  xSemaphoreGive(upstreamMutex);
+  wakeServer();
+}
+
+// Runs in the stratum task when the pool answers a share we passed up
+static void shareResult(uint32_t sessionId, uint32_t messageId, bool result, const char* error) {
+  ServerResult r;
+  r.sessionId = sessionId;
+  r.messageId = messageId;
+  r.result = result;
+  safeStrnCpy(r.error, error ? error : "", sizeof(r.error));
+  if( xQueueSend(resultQueue, &r, 0) == pdTRUE ) {
+    wakeServer();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Downstream
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static void sendLine(ServerClient* c, const char* s) {
+  c->client.write((const uint8_t*) s, strlen(s));
+}
+
+static void reply(ServerClient* c, uint32_t id, const char* result, const char* error) {
+  char msg[STRATUM_OUT_MESSAGE_SIZE];
+  snprintf(msg, sizeof(msg), "{\"id\": %lu, \"result\": %s, \"error\": %s}\n", (unsigned long) id, result, error);
+  sendLine(c, msg);
+}
+
+static void replyError(ServerClient* c, uint32_t id, int code, const char* message) {
+  char error[80];
+  snprintf(error, sizeof(error), "[%d, \"%s\", null]", code, message);
+  reply(c, id, "null", error);
+}
+
+static void closeSlot(uint8_t slot) {
+  ServerClient* c = &clients[slot];
+  if( c->client.connected() ) {
+    dbg("Stratum server: closing miner %u (%s)\n", slot + 1, c->worker);
+  }
+  c->client.stop();
+  c->subscribed = false;
+  c->authorized = false;
+  c->length = 0;
+}
+
+static void closeAll() {
+  for( uint8_t i = 0; i < STRATUM_SERVER_MAX_CLIENTS; i++ ) {
+    closeSlot(i);
+  }
+}
+
+static void sendDifficulty(ServerClient* c, double difficulty) {
+  char msg[STRATUM_OUT_MESSAGE_SIZE];
+  snprintf(msg, sizeof(msg), "{\"id\": null, \"method\": \"mining.set_difficulty\", \"params\": [%.10g]}\n", difficulty);
+  sendLine(c, msg);
+}
+
+// A newly authorized miner gets the difficulty and the current job straight away
+static void sendWork(ServerClient* c) {
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  double difficulty = upstreamDifficulty;
+  safeStrnCpy(out, notifyLine, sizeof(out));
+  xSemaphoreGive(upstreamMutex);
+
+  if( difficulty > 0 ) {
+    sendDifficulty(c, difficulty);
+  }
+  if( out[0] ) {
+    sendLine(c, out);
+  }
+}
+
+static void handleSubscribe(uint8_t slot, uint32_t id) {
+  ServerClient* c = &clients[slot];
+
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  char extraNonce1[STRATUM_EXTRANONCE1_LENGTH];
+  safeStrnCpy(extraNonce1, upstreamExtraNonce1, sizeof(extraNonce1));
+  uint8_t extraNonce2Size = upstreamExtraNonce2Size;
+  xSemaphoreGive(upstreamMutex);
+
+  if( extraNonce2Size < 2 ) {
+    replyError(c, id, 20, "Not connected to a pool");
+    return;
+  }
+
+  char result[STRATUM_OUT_MESSAGE_SIZE];
+  snprintf(result, sizeof(result), "[[[\"mining.set_difficulty\", \"%02x%02x\"], [\"mining.notify\", \"%02x%02x\"]], \"%s%02x\", %u]",
+      slot + 1, c->generation, slot + 1, c->generation, extraNonce1, slot + 1, extraNonce2Size - 1);
+  reply(c, id, result, "null");
+  c->subscribed = true;
+}
+
+static void handleSubmit(uint8_t slot, uint32_t id) {
+  ServerClient* c = &clients[slot];
+
+  if( ! c->authorized ) {
+    replyError(c, id, 24, "Unauthorized worker");
+    return;
+  }
+
+  JsonArray params = request["params"];
+  const char* jobId = params[1];
+  const char* en2 = params[2];
+  const char* nTime = params[3];
+  const char* nonce = params[4];
+  const char* versionBits = params[5];
+  if( ! jobId || ! en2 || ! nTime || ! nonce ) {
+    replyError(c, id, 20, "Bad submit");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+
+  xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+  bool found = false;
+  for( uint8_t i = 0; i < STRATUM_SERVER_JOBS && ! found; i++ ) {
+    if( jobs[i].jobId[0] && strcmp(jobs[i].jobId, jobId) == 0 ) {
+      memcpy(&job, &jobs[i], sizeof(job));
+      found = true;
+    }
+  }
+  char extraNonce1[STRATUM_EXTRANONCE1_LENGTH];
+  safeStrnCpy(extraNonce1, upstreamExtraNonce1, sizeof(extraNonce1));
+  uint8_t extraNonce2Size = upstreamExtraNonce2Size;
+  double difficulty = upstreamDifficulty;
+  xSemaphoreGive(upstreamMutex);
+
+  if( ! found ) {
+    replyError(c, id, STRATUM_ERROR_JOB_NOT_FOUND, "Job not found");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+  if( extraNonce2Size < 2 || ! isHexString(en2, (extraNonce2Size - 1) * 2) ||
+      ! isHexString(nTime, 8) || ! isHexString(nonce, 8) ) {
+    replyError(c, id, 20, "Bad submit");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+  if( versionBits && strtoul(versionBits, NULL, 16) != 0 ) {
+    replyError(c, id, 20, "Version rolling isn't supported");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+
+  // Header with the miner's extranonce2 behind its prefix
+  uint8_t extraNonce2[8];
+  extraNonce2[0] = slot + 1;
+  hex2bin(&extraNonce2[1], en2, strlen(en2));
+
+  uint32_t timestamp = strtoul(nTime, NULL, 16);
+  uint32_t n = strtoul(nonce, NULL, 16);
+  uint8_t header[80];
+  uint8_t hash[32];
+  if( ! jobTemplateHeader(&job, extraNonce1, extraNonce2, extraNonce2Size, timestamp, n, header) ) {
+    replyError(c, id, 20, "Bad submit");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+  double shareDifficulty = jobTemplateHash(header, hash);
+  if( shareDifficulty < (difficulty > 0 ? difficulty : 1.0) ) {
+    replyError(c, id, 23, "Low difficulty share");
+    monitorData.serverSharesInvalid++;
+    return;
+  }
+
+  for( uint8_t i = 0; i < STRATUM_SERVER_RECENT_SHARES; i++ ) {
+    if( memcmp(recentShares[i], hash, 8) == 0 ) {
+      replyError(c, id, STRATUM_ERROR_DUPLICATE_SHARE, "Duplicate share");
+      monitorData.serverSharesInvalid++;
+      return;
+    }
+  }
+
+  jobSubmitQueueEntry qe;
+  memset(&qe, 0, sizeof(qe));
+  safeStrnCpy(qe.jobId, jobId, MAX_JOB_ID_LENGTH);
+  snprintf(qe.extraNonce2, sizeof(qe.extraNonce2), "%02x%s", slot + 1, en2);
+  qe.timestamp = timestamp;
+  qe.nonce = n;
+  qe.difficulty = shareDifficulty;
+  qe.callback = shareResult;
+  qe.sessionId = ((uint32_t) c->generation << 8) | slot;
+  qe.sessionMessageId = id;
+
+  if( ! hash[31] && ! hash[30] && ! hash[29] && ! hash[28] ) {
+    qe.submitflags |= SUBMIT_FLAG_32BIT;
+  }
+  if( shareDifficulty >= jobTemplateNetworkDifficulty(&job) ) {
+    qe.submitflags |= SUBMIT_FLAG_BLOCK_SOLUTION;
+    addToWebLog(infoMessageColor, "Stratum server: a downstream miner found a block!");
+  }
+
+  if( xQueueSend(stratumMessageQueueHandle, &qe, 0) != pdTRUE ) {
+    monitorData.submitQueueDrops++;
+    replyError(c, id, 20, "Busy, try again");
+    return;
+  }
+
+  memcpy(recentShares[nextRecent], hash, 8);
+  nextRecent = (nextRecent + 1) % STRATUM_SERVER_RECENT_SHARES;
+  monitorData.serverSharesForwarded++;
+  rateDifficulty += difficulty > 0 ? difficulty : 1.0;
+}
+
+// False if the miner isn't speaking stratum and should be dropped
+static bool handleLine(uint8_t slot) {
+  ServerClient* c = &clients[slot];
+
+  DeserializationError error = deserializeJson(request, c->line);
+  if( error ) {
+    return false;
+  }
+
+  const char* method = request["method"];
+  uint32_t id = request["id"] | 0;
+  if( ! method ) {
+    return true;
+  }
+
+  if( strcmp(method, "mining.subscribe") == 0 ) {
+    handleSubscribe(slot, id);
+  } else if( strcmp(method, "mining.authorize") == 0 ) {
+    if( ! c->subscribed ) {
+      replyError(c, id, 25, "Not subscribed");
+      return true;
+    }
+    const char* worker = request["params"][0];
+    safeStrnCpy(c->worker, worker ? worker : "", sizeof(c->worker));
+    c->authorized = true;
+    reply(c, id, "true", "null");
+    dbg("Stratum server: miner %u authorized as %s\n", slot + 1, c->worker);
+    sendWork(c);
+  } else if( strcmp(method, "mining.submit") == 0 ) {
+    handleSubmit(slot, id);
+  } else if( strcmp(method, "mining.configure") == 0 ) {
+    // Every downstream miner works the version the pool sent
+    reply(c, id, "{\"version-rolling\": false}", "null");
+  } else if( strcmp(method, "mining.suggest_difficulty") == 0 ) {
+    reply(c, id, "true", "null");
+  } else if( strcmp(method, "mining.extranonce.subscribe") == 0 ) {
+    reply(c, id, "false", "null");
+  } else {
+    replyError(c, id, 20, "Unsupported method");
+  }
+  return true;
+}
+
+static void acceptClients() {
+  WiFiClient incoming = server.accept();
+  if( ! incoming ) {
+    return;
+  }
+
+  for( uint8_t i = 0; i < STRATUM_SERVER_MAX_CLIENTS; i++ ) {
+    ServerClient* c = &clients[i];
+    if( c->client.connected() ) {
+      continue;
+    }
+    c->client.stop();
+    c->client = incoming;
+    c->client.setNoDelay(true);
+    c->generation++;
+    c->subscribed = false;
+    c->authorized = false;
+    c->connectedAt = millis();
+    c->length = 0;
+    c->worker[0] = 0;
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "Stratum server: miner %u connected from %s", i + 1, incoming.remoteIP().toString().c_str());
+    addToWebLog(infoMessageColor, msg);
+    return;
+  }
+
+  dbg("Stratum server: no room for another miner\n");
+  incoming.stop();
+}
+
+static void readClient(uint8_t slot) {
+  ServerClient* c = &clients[slot];
+
+  while( c->client.available() > 0 ) {
+    int ch = c->client.read();
+    if( ch < 0 ) {
+      break;
+    }
+    if( ch == '\n' ) {
+      c->line[c->length] = 0;
+      bool ok = c->length == 0 || handleLine(slot);
+      c->length = 0;
+      if( ! ok ) {
+        closeSlot(slot);
+        return;
+      }
+    } else if( ch != '\r' ) {
+      if( c->length >= STRATUM_SERVER_LINE_SIZE ) {
+        closeSlot(slot);
+        return;
+      }
+      c->line[c->length++] = ch;
+    }
+  }
+
+  if( ! c->authorized && millis() - c->connectedAt > STRATUM_SERVER_SUBSCRIBE_TIMEOUT_MS ) {
+    closeSlot(slot);
+  }
+}
+
+// Pool answers go back to the miner that found the share, if it's still there
+static void deliverResults() {
+  ServerResult r;
+  while( xQueueReceive(resultQueue, &r, 0) == pdTRUE ) {
+    if( r.result ) {
+      monitorData.serverSharesAccepted++;
+    } else {
+      monitorData.serverSharesRejected++;
+    }
+
+    uint8_t slot = r.sessionId & 0xff;
+    uint8_t generation = (r.sessionId >> 8) & 0xff;
+    if( slot >= STRATUM_SERVER_MAX_CLIENTS || clients[slot].generation != generation || ! clients[slot].authorized ) {
+      continue;
+    }
+
+    if( r.result ) {
+      reply(&clients[slot], r.messageId, "true", "null");
+    } else {
+      // The pool's own error goes down if it's whole JSON, otherwise a generic one
+      size_t len = strlen(r.error);
+      bool passOn = len > 0 && len < sizeof(r.error) - 1 && (r.error[0] == '[' || r.error[0] == '{');
+      reply(&clients[slot], r.messageId, "false", passOn ? r.error : "[20, \"Rejected by pool\", null]");
+    }
+  }
+}
+
+// Downstream hashrate, from the difficulty of the shares they find
+static void updateRate(bool active) {
+  uint32_t elapsed = millis() - rateStart;
+  if( elapsed < STRATUM_SERVER_RATE_INTERVAL_MS ) {
+    return;
+  }
+
+  // Each share at difficulty D is worth D * 2^32 hashes; per ms, as the monitor keeps it
+  double rate = rateDifficulty * 4294967296.0 / elapsed;
+  if( ! active ) {
+    hashRate = NAN;
+  } else if( isnan(hashRate) ) {
+    hashRate = rate;
+  } else {
+    hashRate += (rate - hashRate) / STRATUM_SERVER_RATE_WEIGHT;
+  }
+  monitorData.externalHashesPerSecond = hashRate;
+
+  rateDifficulty = 0;
+  rateStart = millis();
+}
+
+void stratumServerTask(void *task_id) {
+
+  // The stratum task may have something for us before xTaskCreate hands the handle back
+  strServerTaskHandle = xTaskGetCurrentTaskHandle();
+
+  uint32_t seenGeneration = 0;
+  uint32_t seenDifficulty = 0;
+  uint32_t seenNotify = 0;
+  rateStart = millis();
+
+  while(1) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STRATUM_SERVER_POLL_MS));
+
+    bool wanted = settings.stratumRepeater && WiFi.status() == WL_CONNECTED;
+    if( wanted != listening ) {
+      if( wanted ) {
+        server.begin();
+        server.setNoDelay(true);
+        char msg[64];
+        snprintf(msg, sizeof(msg), "Stratum server listening on port %d.", STRATUM_SERVER_PORT);
+        addToWebLog(infoMessageColor, msg);
+      } else {
+        closeAll();
+        server.end();
+        dbg("Stratum server stopped\n");
+      }
+      listening = wanted;
+    }
+
+    if( ! listening ) {
+      // Results still have to be drained, or they'd go to the next miner in the slot
+      deliverResults();
+      monitorData.serverClients = 0;
+      updateRate(false);
+      continue;
+    }
+
+    acceptClients();
+
+    // Anything new from the pool
+    xSemaphoreTake(upstreamMutex, portMAX_DELAY);
+    uint32_t generation = upstreamGeneration;
+    bool newDifficulty = difficultyVersion != seenDifficulty;
+    double difficulty = upstreamDifficulty;
+    bool newJob = notifyVersion != seenNotify && notifyLine[0];
+    if( newJob ) {
+      safeStrnCpy(out, notifyLine, sizeof(out));
+    }
+    seenDifficulty = difficultyVersion;
+    seenNotify = notifyVersion;
+    xSemaphoreGive(upstreamMutex);
+
+    if( generation != seenGeneration ) {
+      closeAll();
+      seenGeneration = generation;
+    }
+
+    uint8_t count = 0;
+    for( uint8_t i = 0; i < STRATUM_SERVER_MAX_CLIENTS; i++ ) {
+      ServerClient* c = &clients[i];
+      if( ! c->client.connected() ) {
+        if( c->subscribed ) {
+          closeSlot(i);
+        }
+        continue;
+      }
+      count++;
+      if( c->authorized ) {
+        if( newDifficulty && difficulty > 0 ) {
+          sendDifficulty(c, difficulty);
+        }
+        if( newJob ) {
+          sendLine(c, out);
+          monitorData.serverJobsRelayed++;
+        }
+      }
+      readClient(i);
+    }
+    monitorData.serverClients = count;
+
+    deliverResults();
+    updateRate(count > 0);
+  }
+}
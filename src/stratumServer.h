@@ -0,0 +1,43 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef STRATUM_SERVER_H
+#define STRATUM_SERVER_H
+
+#include <Arduino.h>
+#include "stratum.h"
+#include "jobTemplate.h"
+
+#define STRATUM_SERVER_PORT 3333
+#define STRATUM_SERVER_MAX_CLIENTS 8          // Each gets an extranonce2 prefix byte, 1 and up
+#define STRATUM_SERVER_LINE_SIZE 512          // Longest request a downstream miner may send
+#define STRATUM_SERVER_NOTIFY_SIZE 3072       // Longest mining.notify passed down
+#define STRATUM_SERVER_JOBS 4                 // Recent jobs kept for checking shares
+#define STRATUM_SERVER_RESULTS 16             // Pool answers waiting to go back down
+#define STRATUM_SERVER_RECENT_SHARES 32       // For catching a miner sending the same share twice
+#define STRATUM_SERVER_POLL_MS 50
+#define STRATUM_SERVER_SUBSCRIBE_TIMEOUT_MS 30000
+#define STRATUM_SERVER_RATE_INTERVAL_MS 30000
+#define STRATUM_SERVER_RATE_WEIGHT 4          // Each interval moves the hashrate 1/4 of the way
+
+void stratumServerBegin();
+void stratumServerTask(void *task_id);
+
+// From the stratum task, as the pool session changes
+void stratumServerUpstream(const char* extraNonce1, int extraNonce2Size);
+void stratumServerJob(const JobTemplate* job, bool cleanJobs, const String& line);
+void stratumServerDifficulty(double difficulty);
+void stratumCloseClientConnections();
+
+#endif
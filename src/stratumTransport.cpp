@@ -0,0 +1,428 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <WiFi.h>
+#include "mbedtls/version.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/md.h"
+#include "mbedtls/pk.h"
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "dnsCache.h"
+#include "stratumTransport.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Pool transports.
+//
+// The stratum code talks to a StratumTransport and never knows which kind it
+// has. PlainTransport is the WiFiClient it always used. TlsTransport runs
+// mbedTLS over a WiFiClient of its own.
+//
+// A full TLS handshake on the ESP32 is the better part of a second of
+// public key maths. The session from the last one with each pool is kept, so
+// the next connect can resume it with a ticket and skip all of that. Full
+// and resumed handshakes are timed separately for /metrics.
+//
+// Only the stratum task uses these.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#if MBEDTLS_VERSION_MAJOR >= 3
+  #define CRT_PK(crt) (&(crt)->MBEDTLS_PRIVATE(pk))
+#else
+  #define CRT_PK(crt) (&(crt)->pk)
+#endif
+
+extern MonitorData monitorData;
+
+typedef struct {
+  char host[MAX_POOL_URL_LENGTH + 1];
+  uint16_t port;
+  bool pinSet;
+  uint8_t pin[TLS_PIN_SIZE];    // The pin it was checked against
+  bool valid;
+  mbedtls_ssl_session session;
+} TlsSessionEntry;
+
+static TlsSessionEntry sessions[TLS_SESSION_CACHE_ENTRIES];
+static bool sessionsReady = false;
+static uint8_t nextSession = 0;
+
+// Big enough for the public key of an RSA-4096 certificate
+static uint8_t keyDer[640];
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common
+//////////////////////////////////////////////////////////////////////////////////////////
+
+int StratumTransport::connect(IPAddress ip, uint16_t port) {
+  return open(NULL, ip, port);
+}
+
+int StratumTransport::connect(const char* host, uint16_t port) {
+  IPAddress ip;
+  if( ! dnsResolve(host, ip) ) {
+    return 0;
+  }
+  return open(host, ip, port);
+}
+
+int StratumTransport::connect(IPAddress ip, uint16_t port, int32_t timeout) {
+  return connect(ip, port);
+}
+
+int StratumTransport::connect(const char* host, uint16_t port, int32_t timeout) {
+  return connect(host, port);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Plain
+//////////////////////////////////////////////////////////////////////////////////////////
+
+bool PlainTransport::open(const char* host, IPAddress ip, uint16_t port) {
+  return client.connect(ip, port);
+}
+
+size_t PlainTransport::write(uint8_t b) { return client.write(b); }
+size_t PlainTransport::write(const uint8_t* buf, size_t size) { return client.write(buf, size); }
+int PlainTransport::available() { return client.available(); }
+int PlainTransport::read() { return client.read(); }
+int PlainTransport::read(uint8_t* buf, size_t size) { return client.read(buf, size); }
+int PlainTransport::peek() { return client.peek(); }
+void PlainTransport::flush() { client.flush(); }
+void PlainTransport::stop() { client.stop(); }
+uint8_t PlainTransport::connected() { return client.connected(); }
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// TLS
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static int randomBytes(void* ctx, unsigned char* out, size_t len) {
+  esp_fill_random(out, len);    // Hardware RNG; WiFi is on, so it's seeded from RF noise
+  return 0;
+}
+
+static int bioSend(void* ctx, const unsigned char* buf, size_t len) {
+  WiFiClient* client = (WiFiClient*) ctx;
+  if( ! client->connected() ) {
+    return MBEDTLS_ERR_NET_CONN_RESET;
+  }
+  size_t sent = client->write(buf, len);
+  return sent ? (int) sent : MBEDTLS_ERR_SSL_WANT_WRITE;
+}
+
+// Never blocks; the callers decide how long to wait
+static int bioRecv(void* ctx, unsigned char* buf, size_t len) {
+  WiFiClient* client = (WiFiClient*) ctx;
+  if( client->available() <= 0 ) {
+    return client->connected() ? MBEDTLS_ERR_SSL_WANT_READ : 0;
+  }
+  int got = client->read(buf, len);
+  return got > 0 ? got : MBEDTLS_ERR_SSL_WANT_READ;
+}
+
+static bool parsePin(const char* hex, uint8_t* pin) {
+  if( strlen(hex) != TLS_PIN_SIZE * 2 ) {
+    return false;
+  }
+  for( uint8_t i = 0; i < TLS_PIN_SIZE * 2; i++ ) {
+    char c = tolower(hex[i]);
+    uint8_t v;
+    if( c >= '0' && c <= '9' ) {
+      v = c - '0';
+    } else if( c >= 'a' && c <= 'f' ) {
+      v = c - 'a' + 10;
+    } else {
+      return false;
+    }
+    pin[i / 2] = (i & 1) ? (pin[i / 2] | v) : (v << 4);
+  }
+  return true;
+}
+
+static TlsSessionEntry* findSession(const char* host, uint16_t port, bool pinSet, const uint8_t* pin) {
+  for( uint8_t i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++ ) {
+    TlsSessionEntry* s = &sessions[i];
+    if( s->valid && s->port == port && strcmp(s->host, host) == 0 && s->pinSet == pinSet
+        && ( ! pinSet || memcmp(s->pin, pin, TLS_PIN_SIZE) == 0) ) {
+      return s;
+    }
+  }
+  return NULL;
+}
+
+TlsTransport::TlsTransport() {
+  memset(pin, 0, sizeof(pin));
+}
+
+TlsTransport::~TlsTransport() {
+  stop();
+  if( configured ) {
+    mbedtls_ssl_config_free(&conf);
+  }
+}
+
+void TlsTransport::setPin(const char* hex) {
+  pinSet = hex && hex[0];
+  if( pinSet && ! parsePin(hex, pin) ) {
+    // Rejected by the settings page, so only a corrupt setting gets here.
+    // Nothing can match an all zero pin, which is the safe way to fail.
+    memset(pin, 0, sizeof(pin));
+  }
+}
+
+// Called for each certificate in the chain, the pool's own last. There are
+// no CAs here to check a chain against; the pool's public key has to hash
+// to the pin, and nothing else about the chain matters.
+//
+// In optional mode mbedTLS carries on with the handshake whatever this
+// returns, so a key that doesn't match is also flagged for handshake() to
+// refuse once it's done.
+int TlsTransport::verifyPeer(void* ctx, mbedtls_x509_crt* crt, int depth, uint32_t* flags) {
+  TlsTransport* t = (TlsTransport*) ctx;
+  *flags = 0;
+  if( depth != 0 ) {
+    return 0;
+  }
+  t->certChecked = true;
+
+  uint8_t hash[TLS_PIN_SIZE];
+  int len = mbedtls_pk_write_pubkey_der(CRT_PK(crt), keyDer, sizeof(keyDer));
+  if( len <= 0 || mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), keyDer + sizeof(keyDer) - len, len, hash) != 0 ) {
+    t->pinFailed = true;
+    *flags |= MBEDTLS_X509_BADCERT_NOT_TRUSTED;
+    return MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+  }
+  for( uint8_t i = 0; i < TLS_PIN_SIZE; i++ ) {
+    sprintf(t->peerPinHex + i * 2, "%02x", hash[i]);
+  }
+
+  if( t->pinSet && memcmp(hash, t->pin, TLS_PIN_SIZE) != 0 ) {
+    dbg("TLS: pool key %s doesn't match the pin\n", t->peerPinHex);
+    monitorData.tlsPinFailures++;
+    t->pinFailed = true;
+    *flags |= MBEDTLS_X509_BADCERT_NOT_TRUSTED;
+    return MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+  }
+  return 0;
+}
+
+bool TlsTransport::handshake(const char* host, uint16_t port) {
+  if( ! sessionsReady ) {
+    for( uint8_t i = 0; i < TLS_SESSION_CACHE_ENTRIES; i++ ) {
+      mbedtls_ssl_session_init(&sessions[i].session);
+      sessions[i].valid = false;
+    }
+    sessionsReady = true;
+  }
+
+  if( ! configured ) {
+    mbedtls_ssl_config_init(&conf);
+    if( mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT) != 0 ) {
+      mbedtls_ssl_config_free(&conf);
+      return false;
+    }
+    // Optional, because there's no CA chain for required to check against.
+    // verifyPeer does all the checking there is to do.
+    mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_OPTIONAL);
+    mbedtls_ssl_conf_verify(&conf, verifyPeer, this);
+    mbedtls_ssl_conf_rng(&conf, randomBytes, NULL);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+    configured = true;
+  }
+
+  mbedtls_ssl_init(&ssl);
+  if( mbedtls_ssl_setup(&ssl, &conf) != 0 ) {
+    mbedtls_ssl_free(&ssl);
+    return false;
+  }
+  const char* key = host ? host : "";
+  if( host ) {
+    mbedtls_ssl_set_hostname(&ssl, host);   // SNI, for pools behind a shared front end
+  }
+  TlsSessionEntry* saved = findSession(key, port, pinSet, pin);
+  if( saved ) {
+    mbedtls_ssl_set_session(&ssl, &saved->session);
+  }
+  mbedtls_ssl_set_bio(&ssl, &client, bioSend, bioRecv, NULL);
+
+  certChecked = false;
+  pinFailed = false;
+  uint32_t start = millis();
+  int ret;
+  while( (ret = mbedtls_ssl_handshake(&ssl)) != 0 ) {
+    if( (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) || millis() - start > TLS_HANDSHAKE_TIMEOUT_MS ) {
+      dbg("TLS: handshake failed, -0x%04x\n", -ret);
+      monitorData.tlsFailures++;
+      mbedtls_ssl_free(&ssl);
+      if( saved ) {
+        saved->valid = false;   // In case it's the ticket the pool didn't like
+      }
+      return false;
+    }
+    vTaskDelay(2 / portTICK_PERIOD_MS);
+  }
+  uint32_t elapsed = millis() - start;
+
+  // Optional mode finishes the handshake even when the key was wrong. A pool
+  // that sent no certificate has to be resuming a session we offered it.
+  if( pinFailed || mbedtls_ssl_get_verify_result(&ssl) != 0 || ( ! certChecked && ! saved ) ) {
+    dbg("TLS: refusing %s, its key wasn't accepted\n", key);
+    monitorData.tlsFailures++;
+    mbedtls_ssl_close_notify(&ssl);
+    mbedtls_ssl_free(&ssl);
+    if( saved ) {
+      saved->valid = false;
+    }
+    return false;
+  }
+
+  // The certificate only comes with a full handshake
+  resumed = ! certChecked;
+  if( resumed ) {
+    monitorData.tlsResumes++;
+    monitorData.tlsResumeMs = elapsed;
+  } else {
+    monitorData.tlsHandshakes++;
+    monitorData.tlsHandshakeMs = elapsed;
+  }
+  dbg("TLS: %s handshake with %s in %lu ms, %s\n", resumed ? "resumed" : "full", key, elapsed, mbedtls_ssl_get_ciphersuite(&ssl));
+
+  // Keep the session, or the newer ticket for it, for next time
+  if( ! saved ) {
+    saved = &sessions[nextSession];
+    nextSession = (nextSession + 1) % TLS_SESSION_CACHE_ENTRIES;
+    safeStrnCpy(saved->host, key, sizeof(saved->host));
+    saved->port = port;
+    saved->pinSet = pinSet;
+    memcpy(saved->pin, pin, TLS_PIN_SIZE);
+  }
+  mbedtls_ssl_session_free(&saved->session);
+  mbedtls_ssl_session_init(&saved->session);
+  saved->valid = mbedtls_ssl_get_session(&ssl, &saved->session) == 0;
+
+  up = true;
+  peeked = -1;
+  return true;
+}
+
+bool TlsTransport::open(const char* host, IPAddress ip, uint16_t port) {
+  stop();
+  if( ! client.connect(ip, port) ) {
+    return false;
+  }
+  client.setNoDelay(true);    // Handshake messages are small and go back and forth
+  if( ! handshake(host, port) ) {
+    client.stop();
+    return false;
+  }
+  return true;
+}
+
+void TlsTransport::shutdown() {
+  if( up ) {
+    mbedtls_ssl_free(&ssl);
+    up = false;
+  }
+  peeked = -1;
+  client.stop();
+}
+
+void TlsTransport::stop() {
+  if( up && client.connected() ) {
+    mbedtls_ssl_close_notify(&ssl);
+  }
+  shutdown();
+}
+
+uint8_t TlsTransport::connected() {
+  return up && (client.connected() || peeked >= 0 || mbedtls_ssl_get_bytes_avail(&ssl) > 0);
+}
+
+int TlsTransport::available() {
+  if( ! up ) {
+    return 0;
+  }
+  int extra = peeked >= 0 ? 1 : 0;
+  size_t n = mbedtls_ssl_get_bytes_avail(&ssl);
+  if( n == 0 && client.available() > 0 ) {
+    // Decrypt whatever record has arrived, without taking any of it
+    int ret = mbedtls_ssl_read(&ssl, NULL, 0);
+    if( ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE ) {
+      shutdown();
+      return extra;
+    }
+    n = mbedtls_ssl_get_bytes_avail(&ssl);
+  }
+  return n + extra;
+}
+
+int TlsTransport::read(uint8_t* buf, size_t size) {
+  size_t got = 0;
+  if( peeked >= 0 && size ) {
+    buf[got++] = peeked;
+    peeked = -1;
+  }
+  if( up && got < size ) {
+    int ret = mbedtls_ssl_read(&ssl, buf + got, size - got);
+    if( ret > 0 ) {
+      got += ret;
+    } else if( ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE ) {
+      shutdown();   // Closed, or the record didn't decrypt
+    }
+  }
+  return got ? got : -1;
+}
+
+int TlsTransport::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+int TlsTransport::peek() {
+  if( peeked < 0 ) {
+    uint8_t b;
+    if( read(&b, 1) == 1 ) {
+      peeked = b;
+    }
+  }
+  return peeked;
+}
+
+size_t TlsTransport::write(const uint8_t* buf, size_t size) {
+  size_t sent = 0;
+  uint32_t start = millis();
+  while( up && sent < size ) {
+    int ret = mbedtls_ssl_write(&ssl, buf + sent, size - sent);
+    if( ret > 0 ) {
+      sent += ret;
+    } else if( (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) || millis() - start > TLS_WRITE_TIMEOUT_MS ) {
+      shutdown();
+    } else {
+      vTaskDelay(1);
+    }
+  }
+  return sent;
+}
+
+size_t TlsTransport::write(uint8_t b) {
+  return write(&b, 1);
+}
+
+void TlsTransport::flush() {
+}
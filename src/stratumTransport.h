@@ -0,0 +1,104 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef STRATUM_TRANSPORT_H
+#define STRATUM_TRANSPORT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "mbedtls/ssl.h"
+#include "defines_n_types.h"
+
+#define TLS_HANDSHAKE_TIMEOUT_MS 15000
+#define TLS_WRITE_TIMEOUT_MS 5000
+#define TLS_SESSION_CACHE_ENTRIES 2       // One per pool slot
+#define TLS_PIN_SIZE 32                   // SHA-256 of the server's public key
+
+// The stream the stratum code reads and writes. It only ever sees a Client,
+// so it doesn't know or care whether the bytes are encrypted.
+class StratumTransport : public Client {
+public:
+    // host is the name the pool was looked up by, or NULL; ip is where to go
+    virtual bool open(const char* host, IPAddress ip, uint16_t port) = 0;
+
+    int connect(IPAddress ip, uint16_t port);
+    int connect(const char* host, uint16_t port);
+    int connect(IPAddress ip, uint16_t port, int32_t timeout);
+    int connect(const char* host, uint16_t port, int32_t timeout);
+    using Print::write;
+    operator bool() { return connected(); }
+};
+
+class PlainTransport : public StratumTransport {
+public:
+    bool open(const char* host, IPAddress ip, uint16_t port);
+    size_t write(uint8_t b);
+    size_t write(const uint8_t* buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t* buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+
+private:
+    WiFiClient client;
+};
+
+// TLS over a WiFiClient with mbedTLS. There's no CA bundle on the miner; the
+// pool is trusted by the SHA-256 of its public key instead. Sessions are kept
+// per pool, so a reconnect can skip the key exchange and certificate.
+class TlsTransport : public StratumTransport {
+public:
+    TlsTransport();
+    ~TlsTransport();
+
+    // 64 hex characters, or empty to accept any key
+    void setPin(const char* hex);
+    // The key the pool showed on the last full handshake, as hex
+    const char* peerPin() { return peerPinHex; }
+    bool lastResumed() { return resumed; }
+
+    bool open(const char* host, IPAddress ip, uint16_t port);
+    size_t write(uint8_t b);
+    size_t write(const uint8_t* buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t* buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+
+private:
+    WiFiClient client;
+    mbedtls_ssl_config conf;
+    mbedtls_ssl_context ssl;
+    bool configured = false;
+    bool up = false;
+    bool resumed = false;
+    bool pinSet = false;
+    bool certChecked = false;
+    bool pinFailed = false;
+    int peeked = -1;
+    uint8_t pin[TLS_PIN_SIZE];
+    char peerPinHex[TLS_PIN_SIZE * 2 + 1] = "";
+
+    bool handshake(const char* host, uint16_t port);
+    void shutdown();
+    static int verifyPeer(void* ctx, mbedtls_x509_crt* crt, int depth, uint32_t* flags);
+};
+
+#endif
@@ -0,0 +1,137 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#include <Arduino.h>
+#include <time.h>
+#include "esp_idf_version.h"
+#include "esp_sntp.h"
+#include "esp_timer.h"
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "timeService.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Time.
+//
+// Wall clock time comes from lwIP's SNTP client, which polls in the
+// background and slews the system clock rather than stepping it, so reading
+// the time never touches the network and never jumps backwards once set.
+//
+// Separately, every mining.notify carries the pool's idea of the time. The
+// offset between that and our own monotonic clock is smoothed, which gives
+// an estimate of the pool's clock at any moment, with or without SNTP.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+extern SetupData settings;
+extern MonitorData monitorData;
+
+static bool started = false;
+
+// lwIP keeps the pointer it's given, so it gets a copy the web server can't
+// rewrite underneath it
+static char ntpServer[MAX_POOL_URL_LENGTH + 1];
+static volatile bool synced = false;
+
+// Pool time in ms less esp_timer's ms; only used from the stratum task
+static int64_t poolOffsetMs = 0;
+static bool poolOffsetValid = false;
+
+
+static void timeSynced(struct timeval* tv) {
+  synced = true;
+  monitorData.timeSyncs++;
+}
+
+// The esp_sntp_ names came in with IDF 5.1; before that there are only lwIP's
+static void sntpStart(const char* server) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+  esp_sntp_setoperatingmode(ESP_SNTP_OPMODE_POLL);
+  esp_sntp_setservername(0, server);
+#else
+  sntp_setoperatingmode(SNTP_OPMODE_POLL);
+  sntp_setservername(0, server);
+#endif
+  sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+  sntp_set_sync_interval(NTP_UPDATE_INTERVAL);
+  sntp_set_time_sync_notification_cb(timeSynced);
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+  esp_sntp_init();
+#else
+  sntp_init();
+#endif
+}
+
+static void sntpStop() {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+  esp_sntp_stop();
+#else
+  sntp_stop();
+#endif
+}
+
+// Safe to call on every tick. The first call after WiFi is up starts SNTP,
+// and a later one restarts it if the server in the settings has changed.
+void timeBegin() {
+  if( started ) {
+    if( strncmp(ntpServer, settings.ntpServer, sizeof(ntpServer)) == 0 ) {
+      return;
+    }
+    sntpStop();
+  }
+  started = true;
+  safeStrnCpy(ntpServer, settings.ntpServer, sizeof(ntpServer));
+
+  sntpStart(ntpServer);
+  dbg("SNTP started with %s\n", ntpServer);
+}
+
+// Epoch seconds, or 0 until the first SNTP reply
+uint32_t timeNow() {
+  return synced ? (uint32_t) time(NULL) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Pool clock
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// A new connection may be a different pool with a different clock
+void poolClockReset() {
+  poolOffsetValid = false;
+}
+
+void poolClockSample(uint32_t ntime) {
+  int64_t sample = (int64_t) ntime * 1000 - esp_timer_get_time() / 1000;
+  int64_t error = sample - poolOffsetMs;
+
+  if( ! poolOffsetValid || error > POOL_CLOCK_JUMP_MS || error < -POOL_CLOCK_JUMP_MS ) {
+    poolOffsetMs = sample;
+    poolOffsetValid = true;
+  } else {
+    poolOffsetMs += error / POOL_CLOCK_WEIGHT;
+  }
+
+  uint32_t now = timeNow();
+  if( now ) {
+    monitorData.poolClockOffset = (int32_t) (poolClockNow() - now);
+  }
+}
+
+// Our best guess at the pool's clock in epoch seconds, 0 before the first job
+uint32_t poolClockNow() {
+  if( ! poolOffsetValid ) {
+    return 0;
+  }
+  return (uint32_t) ((esp_timer_get_time() / 1000 + poolOffsetMs) / 1000);
+}
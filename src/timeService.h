@@ -0,0 +1,31 @@
+/* 
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <Arduino.h>
+
+#define POOL_NTIME_AHEAD_MAX 300      // Seconds past the pool's clock a share timestamp may go
+#define POOL_CLOCK_WEIGHT 8           // Each notify moves the pool clock estimate 1/8 of the way
+#define POOL_CLOCK_JUMP_MS 600000     // A sample this far off is a different clock, not noise
+
+void timeBegin();
+uint32_t timeNow();
+
+void poolClockReset();
+void poolClockSample(uint32_t ntime);
+uint32_t poolClockNow();
+
+#endif
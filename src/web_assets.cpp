@@ -0,0 +1,2945 @@
+// Generated by tools/build_web_assets.py from web/. Do not edit.
+#include "web_assets.h"
+
+// common.js: 1107 bytes, 511 as sent
+static const uint8_t webAsset_common_js[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x54, 0xdb, 0x6e, 0xdb, 0x30,
+  0x0c, 0x7d, 0xcf, 0x57, 0x70, 0x7d, 0x91, 0x02, 0xb4, 0xca, 0x07, 0x14, 0x19, 0xd0, 0x66, 0x19,
+  0x90, 0xa1, 0xdd, 0x06, 0x14, 0xdb, 0x9e, 0x15, 0x89, 0x76, 0xb4, 0x28, 0x92, 0x21, 0xc9, 0x69,
+  0x8d, 0x21, 0xff, 0x3e, 0xd2, 0x97, 0x36, 0xd8, 0xba, 0xbe, 0xce, 0x80, 0x6d, 0x81, 0x3a, 0x22,
+  0xcf, 0x21, 0x8f, 0x7d, 0x93, 0x92, 0xee, 0x54, 0x95, 0xe2, 0x41, 0xda, 0x68, 0xda, 0x03, 0x86,
+  0xa2, 0x6a, 0x2c, 0x6b, 0x8f, 0xbc, 0xcc, 0xb7, 0xdd, 0xca, 0xeb, 0x9c, 0x3f, 0xeb, 0x03, 0x4a,
+  0x61, 0x74, 0x93, 0x7f, 0xe8, 0x62, 0x76, 0x62, 0x3e, 0x57, 0x55, 0x4c, 0x6b, 0x6d, 0x76, 0x12,
+  0x10, 0x96, 0xef, 0xe1, 0xd7, 0x0c, 0x00, 0x95, 0xb6, 0x76, 0x7d, 0xa4, 0x63, 0x77, 0x2e, 0x17,
+  0x0c, 0x98, 0xa4, 0xd8, 0x63, 0xd7, 0x36, 0xe2, 0x12, 0xaa, 0x36, 0x98, 0xe2, 0x62, 0x90, 0xc8,
+  0xfb, 0xf3, 0x1e, 0x0f, 0x60, 0x62, 0xc8, 0x05, 0x9e, 0x60, 0x09, 0xaf, 0xd4, 0xbe, 0xed, 0x36,
+  0x56, 0x22, 0x07, 0x6e, 0x4a, 0x49, 0x6e, 0xdb, 0x16, 0xa2, 0x60, 0x75, 0xd1, 0x57, 0xcc, 0xe3,
+  0xca, 0x05, 0xeb, 0x8c, 0x2e, 0x31, 0x11, 0x99, 0xeb, 0x3e, 0x9b, 0xab, 0x24, 0xe5, 0xa2, 0xdc,
+  0x30, 0x5e, 0xb3, 0xe1, 0xc5, 0xf1, 0xbe, 0x2c, 0xe7, 0xba, 0x8f, 0xd6, 0x55, 0x0e, 0xd3, 0x43,
+  0xd1, 0x9c, 0x6f, 0x45, 0xa9, 0xee, 0xa2, 0xd9, 0x8b, 0x39, 0x4c, 0xa4, 0xf8, 0x7a, 0x52, 0xb9,
+  0x74, 0x1e, 0x95, 0x75, 0xb9, 0xf1, 0xba, 0x23, 0x82, 0x62, 0xeb, 0x19, 0x76, 0x3d, 0x42, 0x4e,
+  0x80, 0x3e, 0xe3, 0xdb, 0x27, 0x42, 0x0c, 0x78, 0x76, 0xe0, 0x9c, 0xd4, 0x89, 0x9e, 0xa7, 0x9e,
+  0xf6, 0x6b, 0x4d, 0xdb, 0xfa, 0x36, 0xfd, 0xdf, 0x9e, 0xbd, 0xad, 0xe6, 0xf4, 0x0c, 0x65, 0x0d,
+  0x7c, 0xcf, 0x9e, 0xb9, 0xfc, 0xa5, 0xe6, 0xe2, 0xc3, 0x97, 0xfb, 0x55, 0x0c, 0x85, 0x63, 0x51,
+  0x5b, 0xb4, 0x17, 0x97, 0x20, 0xe7, 0x93, 0x67, 0xa8, 0x7e, 0xe9, 0x1a, 0x8c, 0x15, 0x34, 0xba,
+  0x46, 0x06, 0x7c, 0x1c, 0x55, 0xc3, 0x72, 0x49, 0x55, 0xa7, 0x1e, 0x88, 0x41, 0xfe, 0x9f, 0x20,
+  0xd9, 0xcb, 0x38, 0x0d, 0x1c, 0x16, 0x0b, 0xf8, 0x4a, 0xfb, 0x19, 0x32, 0xa6, 0x23, 0x5a, 0xd0,
+  0xb4, 0xa2, 0x29, 0x3b, 0x03, 0x95, 0xf3, 0x14, 0x6e, 0x9c, 0xd9, 0x43, 0xdb, 0x40, 0xd9, 0xa1,
+  0x4b, 0xd0, 0x60, 0xba, 0xb2, 0x78, 0x74, 0x06, 0x09, 0x5f, 0x8a, 0x0b, 0x75, 0x86, 0x1d, 0x26,
+  0x9c, 0x4d, 0x25, 0xc1, 0x53, 0xa1, 0x6f, 0x4e, 0x0e, 0x95, 0x2b, 0x24, 0xdf, 0x4b, 0xb1, 0x68,
+  0xdd, 0xa7, 0xcc, 0x74, 0x14, 0x65, 0x09, 0x32, 0xb1, 0x8e, 0xa4, 0x7e, 0x66, 0xa6, 0x32, 0xc6,
+  0x5a, 0x37, 0x89, 0x83, 0x97, 0x11, 0x6d, 0xa3, 0xed, 0x94, 0x99, 0x3e, 0x25, 0xea, 0x67, 0xeb,
+  0x18, 0x7d, 0xc0, 0xa1, 0xa3, 0xe4, 0x2d, 0xed, 0x1f, 0x68, 0x30, 0xc4, 0x5f, 0x11, 0x9d, 0x4d,
+  0xc1, 0x83, 0x14, 0x3d, 0x80, 0x8c, 0x30, 0x61, 0xc7, 0x99, 0x0d, 0x0e, 0xf0, 0xb1, 0xde, 0x18,
+  0x6e, 0xd3, 0x3f, 0x7d, 0x20, 0x46, 0x88, 0x38, 0x9b, 0xf5, 0x74, 0xea, 0xc5, 0xec, 0x63, 0x64,
+  0x20, 0xc7, 0x53, 0x53, 0x25, 0xd6, 0xb5, 0x27, 0xdf, 0x84, 0x98, 0x77, 0xf1, 0x91, 0xea, 0xbf,
+  0x63, 0x06, 0x84, 0xfb, 0xee, 0xf0, 0x11, 0xd3, 0x98, 0x6d, 0xb0, 0xb0, 0x32, 0xfc, 0x3f, 0x90,
+  0xe3, 0x40, 0x7b, 0x3b, 0xcc, 0x7e, 0x03, 0xa6, 0x7e, 0x1c, 0xbd, 0x53, 0x04, 0x00, 0x00,
+};
+
+// config.js: 28820 bytes, 7893 as sent
+static const uint8_t webAsset_config_js[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3d, 0x6b, 0x77, 0xdb, 0x36,
+  0xb2, 0x9f, 0xed, 0x5f, 0xc1, 0xb8, 0xdb, 0x92, 0x6a, 0x6c, 0x99, 0xa4, 0x44, 0x3d, 0xac, 0xd8,
+  0xb9, 0xce, 0xa3, 0x4d, 0x76, 0x93, 0x34, 0x37, 0x4e, 0xdb, 0xdd, 0xba, 0xee, 0x39, 0x7c, 0x80,
+  0x12, 0x63, 0x8a, 0x54, 0x49, 0xca, 0xb2, 0x9b, 0xf8, 0xfe, 0xf6, 0x3b, 0x33, 0x00, 0x48, 0x90,
+  0xa2, 0xfc, 0x68, 0xd3, 0xee, 0xd9, 0x7b, 0xb3, 0x5b, 0x5b, 0x02, 0x06, 0xf3, 0xc6, 0xcc, 0x00,
+  0x04, 0xe1, 0xfd, 0xfd, 0x59, 0x51, 0x2c, 0xf2, 0x83, 0xfd, 0xfd, 0x69, 0x54, 0xcc, 0x96, 0x5e,
+  0xd7, 0x4f, 0xe7, 0xfb, 0xff, 0x70, 0x13, 0xf6, 0x34, 0x9d, 0xb1, 0x64, 0x7f, 0x9e, 0x06, 0x6e,
+  0xbc, 0x77, 0xe1, 0x26, 0x51, 0x1c, 0xbb, 0xdb, 0xab, 0x28, 0x09, 0xd2, 0x55, 0xf7, 0xe4, 0xc5,
+  0xb1, 0xed, 0x0c, 0xb4, 0x43, 0xed, 0xe3, 0xf6, 0xd6, 0xec, 0x40, 0x3b, 0x35, 0x2f, 0x07, 0xae,
+  0x39, 0x66, 0x83, 0xc1, 0x70, 0x57, 0x33, 0x2f, 0x3d, 0x6f, 0x30, 0x74, 0xd9, 0xc8, 0xc1, 0xcf,
+  0x3d, 0x7f, 0xc0, 0xc2, 0xde, 0xd0, 0xc6, 0xcf, 0xae, 0xd3, 0x0f, 0x43, 0xa7, 0xe7, 0xe2, 0x67,
+  0xc7, 0x32, 0x99, 0x63, 0x0f, 0x43, 0xfc, 0x3c, 0xf6, 0x4c, 0x67, 0x30, 0x1a, 0xf9, 0xf8, 0xd9,
+  0x0a, 0x47, 0xbd, 0x60, 0xec, 0x7a, 0x04, 0xe3, 0x31, 0xd3, 0x0f, 0xac, 0xf1, 0xd9, 0xee, 0xf6,
+  0xd6, 0x39, 0x51, 0xe9, 0xdb, 0x23, 0xd7, 0x0e, 0xc7, 0x23, 0xec, 0x1d, 0x5a, 0xbd, 0x61, 0xbf,
+  0x3f, 0xb6, 0x88, 0xa2, 0xe3, 0x9b, 0xa1, 0xe7, 0x13, 0x36, 0x36, 0xf6, 0x9c, 0xc0, 0x73, 0x39,
+  0xf5, 0xb1, 0x33, 0xf0, 0x6d, 0x87, 0x63, 0x1b, 0x87, 0x96, 0x65, 0x85, 0x04, 0x3f, 0xb6, 0x7b,
+  0xe1, 0xc8, 0x76, 0xfb, 0xc4, 0x95, 0x67, 0xf9, 0x0e, 0x0b, 0x1c, 0x20, 0xa2, 0x69, 0xf0, 0x3d,
+  0x18, 0x99, 0x43, 0xd7, 0xe5, 0x34, 0x2c, 0x7b, 0xd4, 0x73, 0x3c, 0x93, 0xc6, 0xd8, 0xfd, 0x9e,
+  0x35, 0x02, 0x96, 0x08, 0x97, 0x63, 0xfa, 0xc3, 0xc0, 0xef, 0x11, 0x1f, 0xb6, 0xc7, 0x9c, 0x60,
+  0x48, 0xb8, 0x46, 0x66, 0xc0, 0x3c, 0x2b, 0x64, 0x5c, 0xaa, 0xc0, 0x37, 0x07, 0x2e, 0x69, 0xc4,
+  0xb7, 0xc6, 0x5e, 0x68, 0x01, 0x8c, 0xa0, 0xc1, 0xfa, 0x63, 0x6f, 0x30, 0xf6, 0x09, 0x2f, 0x0b,
+  0x3d, 0xd6, 0x1f, 0x8e, 0x06, 0xf8, 0xd9, 0x0c, 0x01, 0x32, 0xf0, 0x07, 0x9c, 0x9e, 0xe9, 0xbb,
+  0x96, 0x4f, 0x5a, 0xb1, 0x03, 0x36, 0xb6, 0xfd, 0x01, 0xc9, 0xd7, 0x77, 0x87, 0xfd, 0x51, 0xdf,
+  0xe5, 0x5a, 0xf4, 0x3d, 0xd3, 0x85, 0x01, 0xc4, 0xc7, 0x00, 0x14, 0x33, 0x0a, 0x5c, 0x49, 0x63,
+  0x3c, 0xea, 0x31, 0xc7, 0x72, 0xb8, 0xe6, 0x47, 0x3d, 0xcb, 0x1f, 0x0c, 0x02, 0xd2, 0x95, 0x69,
+  0xf6, 0xec, 0xa1, 0x4f, 0xf2, 0x79, 0xa1, 0x33, 0x1e, 0x86, 0x3e, 0xe7, 0x71, 0xc0, 0x4c, 0xd3,
+  0x0b, 0x49, 0xa6, 0xc0, 0x71, 0x87, 0x63, 0xab, 0x4f, 0xed, 0xe6, 0xc0, 0x77, 0x07, 0x3d, 0x87,
+  0x78, 0xb5, 0xfa, 0xf6, 0xd8, 0x1e, 0x83, 0x95, 0x05, 0x0d, 0x7b, 0xe8, 0x0d, 0x4d, 0x97, 0x5b,
+  0xda, 0x66, 0x96, 0x67, 0x5b, 0x3d, 0xc2, 0xdb, 0x0f, 0x80, 0xdb, 0x20, 0x24, 0xbe, 0x9c, 0x5e,
+  0x0f, 0xd4, 0x62, 0x11, 0xde, 0x81, 0x63, 0xba, 0xc3, 0x9e, 0xd3, 0xe7, 0xfc, 0x82, 0xcf, 0xb8,
+  0x1e, 0xd9, 0x66, 0x64, 0xf9, 0xb6, 0x3f, 0xb6, 0xb9, 0xde, 0xec, 0xa1, 0x6d, 0xfb, 0xa3, 0xd2,
+  0x1e, 0xae, 0xed, 0x85, 0x6c, 0xe4, 0x5a, 0x5c, 0x0e, 0xcb, 0x1d, 0x0c, 0xfa, 0x34, 0xc6, 0xb7,
+  0xfb, 0xde, 0x08, 0xc8, 0xd3, 0xe7, 0xe1, 0xc0, 0x77, 0x2c, 0x97, 0xf3, 0x6e, 0x01, 0xa2, 0x91,
+  0x35, 0xa6, 0xcf, 0x83, 0xf1, 0xd8, 0x1c, 0xd8, 0x44, 0x2f, 0xec, 0x9b, 0xac, 0xe7, 0x70, 0x5e,
+  0x2d, 0x30, 0x8c, 0x6b, 0xc2, 0x58, 0x41, 0xc3, 0x1a, 0xbb, 0x7d, 0xdf, 0xb2, 0x48, 0xef, 0x16,
+  0xeb, 0x01, 0x36, 0x93, 0xe4, 0xb0, 0x41, 0xd5, 0xc3, 0x61, 0x9f, 0xe4, 0xe8, 0xf5, 0x3d, 0xd3,
+  0xf3, 0x3d, 0xe1, 0x57, 0x96, 0x6f, 0xfa, 0x1e, 0xd1, 0xeb, 0xb3, 0x60, 0xe4, 0xba, 0x7d, 0x6e,
+  0x0f, 0x6f, 0xec, 0xfb, 0x6e, 0x9f, 0xec, 0x34, 0x18, 0xd9, 0x6c, 0x10, 0x82, 0x3e, 0x05, 0x0d,
+  0x40, 0x05, 0x3e, 0xc7, 0x48, 0xc6, 0xe1, 0xc8, 0x75, 0x06, 0x3d, 0x6e, 0xcf, 0x51, 0xdf, 0x1f,
+  0x0d, 0x47, 0x16, 0xf7, 0x1f, 0xdf, 0x1f, 0x9a, 0x36, 0xa7, 0x3d, 0x36, 0x3d, 0x16, 0x86, 0x21,
+  0xe1, 0x75, 0xfb, 0x0e, 0x98, 0x81, 0x91, 0xdc, 0xd0, 0x3a, 0x76, 0x7b, 0xa1, 0xb0, 0xd9, 0xd0,
+  0x1a, 0x8e, 0x42, 0xfb, 0x8c, 0x13, 0xd9, 0xde, 0xca, 0xd2, 0x22, 0x3b, 0xd0, 0xc2, 0x65, 0xe2,
+  0x17, 0x51, 0x9a, 0x18, 0x97, 0xbb, 0x5a, 0xd2, 0xc1, 0x49, 0xba, 0x95, 0xb1, 0x62, 0x99, 0x25,
+  0x9a, 0x71, 0xa9, 0x1d, 0x1d, 0x1d, 0x61, 0xe3, 0x27, 0xfc, 0xfc, 0xe8, 0x91, 0x66, 0xf4, 0x6c,
+  0x6d, 0x0f, 0x1a, 0x3a, 0x93, 0xed, 0xad, 0x6b, 0x40, 0xb3, 0xbd, 0x95, 0xaf, 0xdc, 0x45, 0xcf,
+  0x56, 0xb0, 0x5c, 0xb8, 0x71, 0x1d, 0x09, 0xb6, 0x68, 0x5f, 0x01, 0xfd, 0x6f, 0xbe, 0xe9, 0x20,
+  0x0e, 0xbb, 0xdf, 0xd9, 0xd6, 0xaa, 0x7f, 0x9f, 0x6a, 0x10, 0xa6, 0x49, 0x30, 0xa3, 0x56, 0x10,
+  0xe0, 0x65, 0xd4, 0xa9, 0x00, 0x37, 0x80, 0x00, 0x7e, 0x49, 0x4e, 0x32, 0x59, 0x64, 0x6e, 0x92,
+  0x87, 0x69, 0x36, 0x57, 0xf8, 0xf4, 0x0b, 0x90, 0xd7, 0x5b, 0x82, 0x56, 0xd3, 0x30, 0xcc, 0x59,
+  0x81, 0x4c, 0x03, 0xd7, 0x31, 0x2b, 0xb4, 0x95, 0x0b, 0xc1, 0x2a, 0x61, 0x2b, 0xed, 0x38, 0xcb,
+  0xdc, 0xab, 0x27, 0xcb, 0x30, 0x64, 0x19, 0x48, 0x8e, 0x42, 0x8b, 0xfe, 0x91, 0x00, 0xf8, 0x3e,
+  0x4a, 0x8a, 0x11, 0x41, 0x19, 0x2b, 0x57, 0xe9, 0x07, 0x35, 0x55, 0x00, 0x3d, 0x7b, 0x1d, 0xa2,
+  0x85, 0x00, 0xc4, 0xc8, 0xaa, 0xbf, 0x8d, 0x40, 0xd5, 0xdb, 0x8e, 0xbe, 0xec, 0x07, 0xd1, 0x5a,
+  0xc6, 0x43, 0xab, 0x0a, 0xd1, 0x8a, 0x43, 0x85, 0x01, 0xdd, 0xb4, 0x60, 0x81, 0x56, 0x82, 0x80,
+  0xff, 0x83, 0x42, 0x0d, 0x04, 0x8c, 0x00, 0xca, 0x9c, 0xc0, 0x2f, 0xb0, 0x1b, 0xfc, 0x7a, 0xf8,
+  0x90, 0xdb, 0x7f, 0x0b, 0xd5, 0x70, 0x1a, 0x9d, 0x41, 0x2f, 0x91, 0x83, 0x8f, 0x38, 0xf0, 0xba,
+  0x65, 0xf0, 0xae, 0xf6, 0xa1, 0xc4, 0x61, 0x0d, 0x08, 0x07, 0x36, 0x3d, 0x3c, 0xd4, 0xfa, 0x12,
+  0x97, 0x44, 0x85, 0x0c, 0x8c, 0x4e, 0xa1, 0x4f, 0x98, 0xed, 0x4c, 0xb8, 0x14, 0x7a, 0x00, 0xef,
+  0x7a, 0x68, 0x3d, 0x14, 0x5d, 0x8f, 0x00, 0x19, 0x74, 0xe0, 0xf8, 0x2d, 0xd9, 0x69, 0x57, 0x9d,
+  0x23, 0x75, 0x50, 0x4f, 0xb6, 0x77, 0x26, 0x5b, 0xc4, 0xe0, 0xf5, 0x76, 0x93, 0x4d, 0xe2, 0x0c,
+  0x84, 0x1c, 0xf4, 0x55, 0x29, 0xb1, 0x37, 0x37, 0xa1, 0xbb, 0x98, 0x45, 0x79, 0x17, 0xa7, 0x94,
+  0x41, 0xcc, 0xee, 0x59, 0xce, 0xd9, 0xae, 0x36, 0xec, 0x68, 0xbf, 0xb4, 0xf7, 0x58, 0x23, 0xec,
+  0xaa, 0x5a, 0x68, 0xaa, 0xf5, 0x48, 0xb7, 0x1c, 0xa7, 0xd5, 0x82, 0xd3, 0xc6, 0x81, 0xad, 0x38,
+  0xa9, 0x67, 0xac, 0xa0, 0xb4, 0x39, 0x46, 0xcb, 0xe4, 0x28, 0x2b, 0x05, 0x0a, 0x8a, 0x83, 0x33,
+  0xd0, 0x21, 0x30, 0xfe, 0x50, 0xe3, 0x0d, 0x43, 0xfa, 0x6e, 0x75, 0x36, 0xd9, 0x68, 0xa3, 0xec,
+  0x0d, 0x3e, 0xd1, 0xe8, 0x7d, 0x60, 0x66, 0xd0, 0xe0, 0x52, 0xb6, 0x5b, 0xd6, 0x86, 0x0e, 0xdb,
+  0xa9, 0x84, 0xf7, 0x67, 0xc4, 0x29, 0xef, 0x82, 0xd9, 0x4c, 0x9f, 0x9c, 0x33, 0x12, 0xcf, 0xf8,
+  0x1f, 0xd1, 0xde, 0x91, 0x1d, 0x83, 0xb3, 0x6a, 0x64, 0xc1, 0xe6, 0x0b, 0xe4, 0x88, 0x3a, 0x84,
+  0x4c, 0xf0, 0x03, 0x10, 0x3e, 0xe4, 0x44, 0xcf, 0x51, 0x0d, 0x42, 0xe8, 0xb3, 0xc9, 0x26, 0x0b,
+  0xe2, 0x68, 0x13, 0x99, 0x6a, 0x61, 0x16, 0xdb, 0xad, 0xde, 0x86, 0x0e, 0xdb, 0xae, 0x78, 0x99,
+  0xbb, 0x1f, 0x4a, 0x31, 0xcc, 0x52, 0x0c, 0x8b, 0x8b, 0xd1, 0x68, 0xb5, 0x95, 0x56, 0x4b, 0x6d,
+  0xad, 0x49, 0x86, 0x73, 0x96, 0x6c, 0x06, 0xa8, 0x27, 0xe5, 0x1c, 0x1b, 0x9e, 0x49, 0x81, 0x07,
+  0x67, 0x13, 0xf9, 0x41, 0x36, 0x39, 0xb2, 0xc9, 0x29, 0x9b, 0xfa, 0xb2, 0xa9, 0x5f, 0x36, 0xf5,
+  0x50, 0x27, 0xa4, 0xbb, 0x89, 0x56, 0xe2, 0xed, 0x95, 0xdd, 0xb6, 0x1c, 0x61, 0x97, 0x4d, 0x96,
+  0x6c, 0xb2, 0xca, 0x26, 0x53, 0x36, 0x99, 0xd8, 0xc4, 0x2d, 0xc1, 0xb1, 0xda, 0x93, 0xd6, 0x19,
+  0xd5, 0x16, 0x35, 0x64, 0xac, 0xc0, 0xd9, 0x2f, 0x22, 0x88, 0xe2, 0x92, 0x22, 0xa9, 0x00, 0x50,
+  0x99, 0x81, 0x82, 0x68, 0xca, 0xf2, 0x42, 0x89, 0xec, 0x14, 0xd4, 0xbd, 0xab, 0x82, 0xe5, 0x1c,
+  0x65, 0x14, 0x1a, 0xc5, 0xd5, 0x82, 0xa5, 0x21, 0x6f, 0xd4, 0x0e, 0x0f, 0x0f, 0x35, 0x7d, 0x99,
+  0x04, 0x2c, 0x8c, 0x12, 0x16, 0xe8, 0x82, 0xae, 0xe8, 0xc3, 0xb0, 0xd7, 0xc5, 0xcf, 0xaf, 0x58,
+  0x32, 0x2d, 0x66, 0x92, 0xf4, 0xed, 0x01, 0x11, 0x21, 0x32, 0x36, 0x77, 0xa3, 0x04, 0x91, 0x10,
+  0xb2, 0x2f, 0x71, 0xba, 0x88, 0xae, 0x22, 0x2d, 0xdc, 0x18, 0x70, 0x96, 0x9d, 0x7b, 0x02, 0x5a,
+  0x04, 0x53, 0x11, 0x95, 0x6f, 0x4e, 0x3c, 0xb7, 0x85, 0xed, 0x5b, 0xd4, 0xbb, 0x55, 0xd3, 0xaf,
+  0xf0, 0xf7, 0x59, 0xa9, 0xe0, 0xf6, 0xd1, 0x92, 0x71, 0x44, 0x72, 0x08, 0x02, 0x09, 0x75, 0xd1,
+  0xd8, 0x32, 0xaf, 0x2a, 0xd9, 0x34, 0x52, 0x23, 0x08, 0xe2, 0x8a, 0xe7, 0x2d, 0x42, 0x01, 0x9e,
+  0x49, 0xd9, 0xdf, 0xa2, 0xd5, 0x78, 0x5e, 0xf6, 0xf3, 0xd4, 0xd0, 0x60, 0x4e, 0xe1, 0x0a, 0x78,
+  0x24, 0x8d, 0xca, 0xb4, 0x51, 0x45, 0xa7, 0x39, 0x04, 0xf6, 0x33, 0x6e, 0xd2, 0x91, 0xe2, 0x46,
+  0xd4, 0xfe, 0xf0, 0x21, 0xf6, 0x60, 0x11, 0x2e, 0x14, 0x07, 0x5e, 0xf2, 0x41, 0x3b, 0xd2, 0x20,
+  0x09, 0x6f, 0x16, 0x30, 0x9e, 0x43, 0x1d, 0x25, 0x66, 0xe4, 0x7c, 0xd4, 0x0d, 0x61, 0x95, 0x63,
+  0x98, 0xaa, 0xbc, 0x7e, 0x9a, 0xe4, 0x20, 0x11, 0x60, 0x7e, 0x12, 0x4d, 0x5f, 0x26, 0x85, 0xc1,
+  0x6d, 0xfd, 0x35, 0xd4, 0x2d, 0x13, 0x41, 0x79, 0x40, 0xb3, 0xea, 0xcd, 0x72, 0xee, 0x81, 0x1a,
+  0x78, 0xd9, 0x13, 0x86, 0x49, 0xd5, 0x6d, 0x2b, 0xdd, 0x06, 0xaf, 0x79, 0x92, 0xce, 0x3a, 0x98,
+  0xb5, 0x06, 0x66, 0x0d, 0xda, 0xe0, 0xcc, 0x35, 0x38, 0xbb, 0xdf, 0x02, 0xe7, 0x8c, 0xd7, 0xe0,
+  0x7a, 0x76, 0x1b, 0xdc, 0x68, 0x0d, 0xae, 0x6f, 0xb6, 0xc1, 0x0d, 0xd7, 0xe1, 0xda, 0xe4, 0x70,
+  0x06, 0x6b, 0x70, 0x4e, 0x53, 0x8e, 0xed, 0xdb, 0x8c, 0x71, 0x9f, 0xa8, 0x22, 0xbc, 0x9e, 0x97,
+  0xad, 0x86, 0x6c, 0xee, 0xdc, 0x12, 0x62, 0xd2, 0xa5, 0x17, 0xb3, 0x93, 0x99, 0xfb, 0x27, 0x47,
+  0x19, 0xee, 0x3e, 0x3c, 0x0c, 0x10, 0x9b, 0x3c, 0xb6, 0xa9, 0xb4, 0x26, 0x8a, 0x9f, 0x05, 0x0d,
+  0x30, 0x52, 0x8b, 0x08, 0x17, 0x42, 0x8a, 0xa0, 0x94, 0xc1, 0x8b, 0x12, 0xfb, 0x05, 0xbb, 0xfc,
+  0x0b, 0xe2, 0x24, 0xf6, 0xea, 0xfa, 0xa4, 0x64, 0xd3, 0xdb, 0x1c, 0x34, 0x9b, 0x66, 0x7b, 0x04,
+  0xec, 0x4f, 0x2a, 0xab, 0xe5, 0x98, 0x04, 0x0c, 0x0f, 0x0d, 0xd4, 0x2d, 0xd2, 0x93, 0x22, 0x8b,
+  0x92, 0xa9, 0x01, 0x35, 0x5d, 0x77, 0xe1, 0x06, 0x27, 0x85, 0x9b, 0x15, 0x06, 0x2c, 0x58, 0x75,
+  0x53, 0x2f, 0xcd, 0x27, 0xa4, 0xce, 0x4b, 0xa9, 0x67, 0xec, 0xd2, 0x7e, 0x12, 0x25, 0x8a, 0xd4,
+  0x79, 0x91, 0x71, 0xec, 0x62, 0xae, 0x52, 0x48, 0x86, 0xc6, 0x6e, 0x4c, 0x82, 0x68, 0xfb, 0x9a,
+  0x5d, 0xb1, 0xee, 0x7a, 0x2d, 0xb1, 0x0b, 0x00, 0x3b, 0x2a, 0x48, 0x4b, 0xf8, 0x72, 0xbd, 0x56,
+  0xc7, 0x54, 0xeb, 0x5c, 0x85, 0x26, 0x85, 0x56, 0x5b, 0x0d, 0x5d, 0x80, 0x94, 0x87, 0xae, 0x85,
+  0x9b, 0xe5, 0x0c, 0x03, 0x09, 0x42, 0xe7, 0x4b, 0x0f, 0x7e, 0x19, 0xd1, 0xae, 0xdd, 0x81, 0x0a,
+  0x64, 0xd0, 0x94, 0xda, 0xf5, 0x4a, 0xb1, 0x61, 0x5d, 0x56, 0x64, 0xef, 0xd3, 0x92, 0xeb, 0x36,
+  0xf9, 0x91, 0xab, 0xb6, 0x7c, 0x53, 0xf1, 0x55, 0x86, 0xe0, 0xab, 0x75, 0x09, 0x6f, 0x4a, 0x38,
+  0x75, 0xc9, 0xa4, 0x4c, 0x57, 0x7c, 0xfa, 0x61, 0xa7, 0x3f, 0x73, 0xb3, 0xa7, 0x69, 0xc0, 0x8e,
+  0x0b, 0x23, 0x6a, 0x4a, 0x51, 0xcd, 0xba, 0x79, 0x14, 0xe4, 0x85, 0x5b, 0x30, 0xd5, 0x65, 0xe3,
+  0xd4, 0x3f, 0x57, 0xcd, 0x77, 0x63, 0xca, 0x2c, 0x41, 0xfe, 0xc4, 0xa4, 0xb9, 0x31, 0x3c, 0x11,
+  0xab, 0x32, 0x42, 0xb5, 0xc4, 0x14, 0x3f, 0x9d, 0x2f, 0x80, 0x26, 0x7b, 0xe1, 0xe6, 0x33, 0x45,
+  0x42, 0x29, 0xf4, 0x53, 0x05, 0x47, 0x92, 0x26, 0x3e, 0x23, 0xa9, 0x6f, 0x91, 0x5b, 0x19, 0xac,
+  0xcc, 0xcd, 0x7b, 0xe8, 0x82, 0xfa, 0xbb, 0xb0, 0x0c, 0x32, 0x9a, 0x10, 0x0a, 0xea, 0x8e, 0x54,
+  0x9b, 0x98, 0xde, 0xc8, 0x64, 0x2b, 0x56, 0x6e, 0xad, 0xc9, 0xe7, 0x2b, 0x05, 0xe2, 0x79, 0x2b,
+  0x1d, 0x82, 0xa0, 0x84, 0x22, 0x6b, 0x4f, 0xc1, 0xd3, 0x29, 0xac, 0x72, 0x26, 0xb2, 0xc3, 0xaa,
+  0x75, 0x0c, 0xab, 0x0e, 0xbb, 0xd6, 0x31, 0xaa, 0x3a, 0x28, 0x53, 0x93, 0xf2, 0xcb, 0xa6, 0x7e,
+  0x33, 0x83, 0x60, 0x05, 0xc1, 0xff, 0x75, 0x2a, 0x4a, 0xce, 0x3a, 0x94, 0x3d, 0x32, 0xef, 0x96,
+  0xcc, 0x3e, 0x6b, 0x3a, 0xab, 0xac, 0x04, 0x31, 0xdc, 0x8d, 0xd1, 0xd7, 0x36, 0xe5, 0x0c, 0x15,
+  0x76, 0xd6, 0xaa, 0xe6, 0x12, 0x05, 0x6a, 0x1b, 0x37, 0x5d, 0x20, 0x61, 0x68, 0x0f, 0x34, 0x03,
+  0xc1, 0x71, 0x0d, 0xc2, 0x73, 0x76, 0x18, 0x92, 0x32, 0x34, 0xe4, 0x94, 0xef, 0xcd, 0x08, 0xe7,
+  0x2f, 0x87, 0x4f, 0xa8, 0xbd, 0x9e, 0x6d, 0x43, 0x37, 0xce, 0x51, 0xcb, 0xb4, 0x46, 0xd8, 0xbe,
+  0x06, 0x02, 0x17, 0x6e, 0xa6, 0x45, 0x49, 0x54, 0x44, 0x6e, 0x7c, 0x72, 0xf2, 0xf2, 0x19, 0xf2,
+  0xb3, 0x8c, 0x63, 0xe8, 0x40, 0xbd, 0x4c, 0x19, 0x7c, 0x87, 0xff, 0x8e, 0xb4, 0x8f, 0x32, 0xd1,
+  0xa5, 0xfe, 0x72, 0xce, 0x92, 0xa2, 0x3b, 0x65, 0xc5, 0xf3, 0x98, 0xe1, 0xc7, 0x27, 0x57, 0x2f,
+  0x03, 0x83, 0x75, 0x10, 0x99, 0x9c, 0x5e, 0xda, 0x05, 0xcb, 0x72, 0xf8, 0xfd, 0x5e, 0x26, 0x93,
+  0x0b, 0xce, 0x66, 0x99, 0xb6, 0x2e, 0x74, 0x58, 0xb1, 0x18, 0x17, 0xbc, 0x9e, 0xea, 0xc0, 0xe7,
+  0x9d, 0xee, 0x0e, 0xb6, 0xf0, 0xa6, 0x91, 0x2c, 0x4c, 0x94, 0x9e, 0x0b, 0xd9, 0x84, 0x62, 0x55,
+  0xf9, 0xe7, 0x5a, 0x21, 0x9a, 0xcf, 0xd2, 0xd5, 0xab, 0xd4, 0x0d, 0x90, 0x20, 0xa7, 0x37, 0x65,
+  0x86, 0x1e, 0xf3, 0x96, 0xef, 0x80, 0xa5, 0xd8, 0xbd, 0xd2, 0x3b, 0xdd, 0xbc, 0xb8, 0x8a, 0x59,
+  0xf7, 0x22, 0xca, 0x23, 0x2f, 0x8a, 0xa3, 0xe2, 0x8a, 0xf8, 0xc1, 0x6f, 0x31, 0xd3, 0xeb, 0x08,
+  0x67, 0x51, 0xc0, 0x7e, 0x27, 0x42, 0x18, 0x1a, 0xb0, 0xa4, 0x81, 0x0f, 0x74, 0x31, 0x3f, 0x86,
+  0x5a, 0x96, 0xe3, 0x22, 0x6b, 0x77, 0xc3, 0x2c, 0x9d, 0x1b, 0xa5, 0x56, 0x7f, 0x5d, 0xb2, 0xec,
+  0xea, 0x84, 0xc5, 0xcc, 0x2f, 0xd2, 0x0c, 0x41, 0xf5, 0x28, 0x59, 0x2c, 0x8b, 0x53, 0x2c, 0x18,
+  0x0e, 0x0b, 0x76, 0x59, 0x9c, 0xe9, 0x9d, 0x4e, 0x17, 0xdc, 0xf6, 0xb9, 0xeb, 0xcf, 0x0c, 0x61,
+  0x1a, 0xb2, 0x33, 0x30, 0xe0, 0xc6, 0x4b, 0xb2, 0x17, 0xff, 0xd4, 0x45, 0x6a, 0x06, 0xa9, 0xeb,
+  0xba, 0x53, 0xe7, 0x03, 0xe7, 0xc3, 0xc9, 0xd2, 0x9b, 0x47, 0x45, 0x01, 0x81, 0x01, 0xbf, 0xed,
+  0xe6, 0x8c, 0xba, 0x76, 0x5d, 0xfe, 0x4b, 0x2b, 0xa2, 0x39, 0x4b, 0x97, 0xc5, 0x31, 0x7d, 0xad,
+  0x8c, 0x17, 0xb8, 0x85, 0xdc, 0xb4, 0xfb, 0xfe, 0xdd, 0xab, 0x13, 0xe6, 0x66, 0xfe, 0xec, 0xad,
+  0x9b, 0xb9, 0xf3, 0x9c, 0x22, 0xd9, 0x37, 0x80, 0xea, 0x19, 0x80, 0x10, 0xce, 0x0e, 0xd1, 0xc6,
+  0x11, 0x5d, 0x77, 0xb1, 0x60, 0x49, 0x60, 0xe8, 0x82, 0x8a, 0xbe, 0xab, 0x89, 0x4f, 0xdc, 0xc5,
+  0x6b, 0x86, 0xa3, 0x16, 0x4a, 0x9a, 0xb3, 0x4c, 0x90, 0xfa, 0xe7, 0xeb, 0x57, 0x2f, 0x8a, 0x62,
+  0xf1, 0x8e, 0x81, 0x7a, 0x60, 0x2e, 0x11, 0x5e, 0xe8, 0xed, 0xba, 0x41, 0xf0, 0xfc, 0x02, 0xd4,
+  0xf6, 0x2a, 0xca, 0x0b, 0x96, 0x80, 0x28, 0x7a, 0xc6, 0xdc, 0xe0, 0x8a, 0x02, 0x28, 0xe4, 0xbe,
+  0x64, 0xca, 0x80, 0x12, 0x68, 0xbb, 0x54, 0x12, 0xcc, 0x24, 0x1c, 0x47, 0x50, 0x27, 0x08, 0x05,
+  0xc5, 0x97, 0xd6, 0xd7, 0xbe, 0xfa, 0x8a, 0xd0, 0xe1, 0xb8, 0x25, 0xd6, 0x63, 0x9a, 0x8d, 0x33,
+  0x4b, 0xce, 0x2b, 0x45, 0xee, 0xbf, 0x9f, 0x7c, 0xf7, 0xa6, 0x4b, 0xb5, 0x82, 0xc0, 0x93, 0x2f,
+  0x60, 0x26, 0xb3, 0xf7, 0x60, 0x98, 0xce, 0x44, 0x80, 0xe3, 0x6c, 0x15, 0xf5, 0x1d, 0x57, 0x26,
+  0x2f, 0xf0, 0xa4, 0xf2, 0xf5, 0x0a, 0xb1, 0x26, 0x00, 0x0c, 0xc4, 0x5e, 0x8e, 0xbf, 0xde, 0x96,
+  0x3f, 0xaf, 0xb9, 0x2e, 0xda, 0x25, 0x45, 0x2f, 0x04, 0x9d, 0x36, 0x04, 0xac, 0x79, 0xec, 0xe4,
+  0x36, 0x1c, 0xc2, 0xc8, 0xeb, 0x4a, 0x92, 0x02, 0xd4, 0xbc, 0xa0, 0x21, 0x87, 0x12, 0x79, 0x6a,
+  0x60, 0x46, 0x67, 0x72, 0x37, 0x09, 0x58, 0x96, 0xa5, 0x59, 0x83, 0x36, 0x06, 0xc6, 0x14, 0x26,
+  0x53, 0x9c, 0x4e, 0x25, 0x40, 0x53, 0x0c, 0x41, 0x0c, 0xac, 0xd1, 0x83, 0x00, 0x38, 0xd1, 0x44,
+  0x73, 0x0a, 0x1e, 0x66, 0xe8, 0x6f, 0xbf, 0x3b, 0x79, 0x0f, 0x28, 0xf5, 0x7d, 0x40, 0x14, 0x46,
+  0x53, 0xbd, 0x74, 0x15, 0xc8, 0xb5, 0xc2, 0x7d, 0x5e, 0x80, 0xf1, 0x91, 0xfc, 0xb1, 0xef, 0xb3,
+  0x05, 0xca, 0xae, 0x83, 0x77, 0xc6, 0x91, 0xef, 0x22, 0xf3, 0xfb, 0x1f, 0x72, 0x34, 0x51, 0x35,
+  0x0a, 0xbc, 0x96, 0x5b, 0x47, 0x43, 0x42, 0x38, 0x8b, 0xaa, 0x69, 0xb4, 0xcc, 0x59, 0x86, 0xde,
+  0xfe, 0xfd, 0x02, 0x40, 0x98, 0x00, 0x24, 0x41, 0xaa, 0x12, 0x9f, 0x3b, 0x0e, 0x2a, 0x2e, 0xf5,
+  0x3e, 0x80, 0xcf, 0xeb, 0xe8, 0x6c, 0x42, 0x32, 0x88, 0xbb, 0xbc, 0x1f, 0x9b, 0xb8, 0xbf, 0xe6,
+  0xc7, 0xc8, 0x0b, 0xac, 0x02, 0x64, 0x5f, 0x47, 0x31, 0xca, 0x03, 0x3e, 0x99, 0x68, 0x30, 0x8e,
+  0xa1, 0x6f, 0xf5, 0x71, 0x8a, 0x51, 0xc4, 0x53, 0x41, 0xc8, 0xb7, 0x24, 0x19, 0x38, 0x2b, 0xba,
+  0x4c, 0x69, 0x1d, 0x8d, 0x41, 0x26, 0x28, 0x81, 0x71, 0x96, 0x3d, 0x45, 0x95, 0x65, 0xf3, 0x27,
+  0xe9, 0xa5, 0xf1, 0x11, 0x43, 0xcd, 0x01, 0xe1, 0x9f, 0xb3, 0x3c, 0x77, 0xa7, 0x6c, 0x97, 0x5c,
+  0xeb, 0xa9, 0x0b, 0x49, 0x3a, 0x3e, 0x80, 0x40, 0xb6, 0x64, 0x60, 0x12, 0xad, 0x32, 0x74, 0x2d,
+  0xbe, 0xa0, 0x62, 0xb8, 0x52, 0x5e, 0xb8, 0x49, 0x10, 0x83, 0xb6, 0x3b, 0x48, 0xa8, 0x0c, 0x7f,
+  0x13, 0x31, 0xc3, 0x17, 0xab, 0x77, 0x6c, 0xca, 0xb0, 0xc2, 0xda, 0xff, 0xc5, 0x78, 0x7c, 0xd8,
+  0xfd, 0xfa, 0xd4, 0xdd, 0xfb, 0xed, 0xac, 0xc3, 0x3f, 0x1e, 0xef, 0xfd, 0x24, 0x3e, 0xfe, 0x1c,
+  0x88, 0xa6, 0xff, 0xea, 0x7e, 0xf1, 0xb7, 0x07, 0x5f, 0x7e, 0xfd, 0xf8, 0xab, 0xb3, 0x0e, 0x76,
+  0x03, 0xf0, 0xcf, 0x41, 0xd5, 0xf6, 0x71, 0xb4, 0xdb, 0xb3, 0xaf, 0xff, 0xb6, 0x4f, 0x6c, 0xc9,
+  0x4c, 0x83, 0x9c, 0x4a, 0x72, 0x4b, 0xf8, 0xbe, 0x29, 0x7f, 0xe9, 0xc8, 0x33, 0xc4, 0x72, 0x0a,
+  0x9d, 0x25, 0x7f, 0x37, 0x0d, 0x58, 0xb8, 0x79, 0xbe, 0x4a, 0xb3, 0x60, 0x6d, 0x90, 0x7f, 0xd3,
+  0x28, 0x9f, 0x2b, 0xf9, 0x6d, 0xcb, 0x60, 0x6e, 0xe2, 0xa5, 0x5c, 0x20, 0x7d, 0xfa, 0x04, 0xdf,
+  0x16, 0xf2, 0x9b, 0xb4, 0x6b, 0xab, 0xa1, 0xf4, 0xef, 0x81, 0xf9, 0xc4, 0x9d, 0x33, 0x0d, 0xd4,
+  0xad, 0x49, 0xc6, 0x34, 0x37, 0x63, 0x90, 0x29, 0x7f, 0x5d, 0x46, 0x19, 0x0b, 0xba, 0x7a, 0xbb,
+  0x05, 0x35, 0x8d, 0x1b, 0x11, 0x75, 0x25, 0x8a, 0x83, 0xd2, 0x39, 0x90, 0xa1, 0x92, 0x1d, 0xf0,
+  0xb7, 0x35, 0x66, 0x10, 0x60, 0xa1, 0x3d, 0x38, 0x44, 0x99, 0x3b, 0x37, 0xfb, 0x92, 0x2e, 0x25,
+  0xce, 0x41, 0x37, 0x50, 0xec, 0xe1, 0xae, 0x6d, 0xe1, 0xcf, 0x36, 0xb0, 0x25, 0x30, 0xd5, 0x98,
+  0x92, 0x8e, 0x26, 0x34, 0x95, 0x23, 0x47, 0x0f, 0xa4, 0x0b, 0x75, 0x0b, 0x4c, 0x0c, 0x8b, 0xce,
+  0x2d, 0x7a, 0x92, 0x4c, 0x00, 0x0f, 0xb0, 0xb8, 0x26, 0x2e, 0x18, 0x3a, 0x4a, 0x91, 0x71, 0xc1,
+  0x40, 0x7d, 0xfb, 0x30, 0xb7, 0x84, 0x98, 0x42, 0x77, 0x68, 0xbc, 0xbc, 0xc1, 0xa8, 0xca, 0x67,
+  0x5d, 0x75, 0x15, 0x7f, 0x1b, 0x58, 0x11, 0xb2, 0x55, 0x49, 0x80, 0x58, 0xd3, 0xf4, 0x63, 0xb0,
+  0xd6, 0x55, 0xba, 0xd4, 0xf2, 0xa5, 0xf8, 0xb0, 0x72, 0x13, 0xdc, 0xcf, 0xd4, 0xf8, 0x0c, 0xc7,
+  0x26, 0xe0, 0x2c, 0x9d, 0x42, 0x60, 0x88, 0x12, 0xcc, 0xaf, 0x34, 0xad, 0x1f, 0xeb, 0xbb, 0x25,
+  0xa2, 0xf4, 0x5c, 0x59, 0xe0, 0x00, 0xf5, 0x7a, 0x9a, 0xc7, 0xd2, 0x25, 0xcc, 0xe6, 0xdf, 0x93,
+  0x9f, 0x43, 0xd4, 0x23, 0x87, 0xdf, 0x6d, 0x06, 0xb1, 0xce, 0x75, 0x2d, 0x0d, 0xf1, 0xe0, 0x5b,
+  0x2f, 0x1e, 0xa0, 0x3c, 0x7c, 0x0b, 0x11, 0xe1, 0x35, 0x0f, 0x0c, 0xc6, 0x3c, 0x9f, 0x2a, 0xf5,
+  0x01, 0xe8, 0x82, 0x08, 0x01, 0xd0, 0x6b, 0x3c, 0xa4, 0x20, 0xa0, 0x78, 0x48, 0x45, 0xbd, 0x54,
+  0x21, 0x2a, 0x80, 0x90, 0x34, 0x4f, 0x2f, 0x98, 0x48, 0x54, 0x58, 0x2b, 0xa8, 0x33, 0xc7, 0x87,
+  0x2c, 0x5d, 0x30, 0x31, 0x79, 0x0c, 0x3d, 0x88, 0x2e, 0x38, 0x92, 0xa0, 0x1b, 0x21, 0xdc, 0x3a,
+  0x09, 0xde, 0xe9, 0xc7, 0x60, 0x63, 0x4c, 0x32, 0x98, 0x71, 0x0c, 0x9d, 0x4e, 0x4a, 0xe8, 0x65,
+  0xc4, 0x61, 0x77, 0xa1, 0xc0, 0x5a, 0x91, 0xec, 0xcd, 0x55, 0x51, 0x58, 0x37, 0x4a, 0x20, 0x8b,
+  0xbd, 0x78, 0xff, 0xfa, 0x15, 0xa0, 0x04, 0x1d, 0x70, 0xea, 0xbc, 0xd0, 0x79, 0x3a, 0x8b, 0x62,
+  0x2c, 0x89, 0xa9, 0x4d, 0x52, 0xf3, 0xd2, 0xe0, 0xaa, 0xd6, 0x1f, 0x08, 0x71, 0x78, 0xf9, 0x18,
+  0x44, 0xf9, 0x02, 0xca, 0x49, 0x94, 0x8c, 0xd6, 0x48, 0x8d, 0xd2, 0x71, 0x91, 0xe6, 0xc5, 0x1b,
+  0x56, 0x80, 0xf3, 0x9e, 0x73, 0x93, 0xd6, 0xb3, 0x4d, 0x49, 0xa5, 0x0c, 0xf7, 0xb3, 0x8c, 0x85,
+  0xc0, 0xa3, 0x1f, 0x2f, 0x03, 0x96, 0x1b, 0xba, 0x35, 0xb6, 0xbb, 0xd6, 0x60, 0xd4, 0xed, 0x77,
+  0x2d, 0xa8, 0x20, 0xa5, 0x05, 0xd2, 0xb7, 0x58, 0x28, 0x60, 0xc1, 0xbf, 0x5b, 0xf3, 0x1c, 0xe1,
+  0x03, 0x4d, 0x53, 0xef, 0xbc, 0x9f, 0x31, 0x2d, 0x60, 0x17, 0x91, 0x0f, 0xc1, 0x01, 0xe7, 0x0f,
+  0xf8, 0x23, 0xb8, 0x66, 0xa6, 0xb9, 0x17, 0x6e, 0x14, 0xbb, 0x50, 0x40, 0x6b, 0x6e, 0x41, 0xcb,
+  0x1e, 0x0d, 0xf4, 0x06, 0xd5, 0x51, 0xde, 0x7d, 0xe4, 0x65, 0xfb, 0x47, 0xf4, 0xe3, 0xb5, 0x7b,
+  0xce, 0x2a, 0xe7, 0xc6, 0xd8, 0x84, 0x15, 0x31, 0x20, 0xcc, 0x31, 0x70, 0x25, 0x5c, 0x36, 0xcd,
+  0xcd, 0xa9, 0x4d, 0x10, 0xc1, 0x70, 0xb6, 0xc4, 0x48, 0x54, 0xe4, 0x34, 0x8d, 0x5e, 0xbe, 0x95,
+  0x88, 0x71, 0x62, 0x64, 0x0c, 0xa2, 0x69, 0x02, 0x49, 0xb5, 0xbb, 0x23, 0xb3, 0x5a, 0x8b, 0xbf,
+  0x06, 0xa9, 0xd0, 0xdb, 0x53, 0x9a, 0x47, 0x42, 0x7b, 0x5c, 0xc8, 0xd6, 0x19, 0x22, 0xc0, 0x69,
+  0x92, 0x08, 0xb6, 0x74, 0x45, 0x3d, 0x81, 0x1a, 0xfd, 0xd4, 0x4c, 0xbe, 0x31, 0x8d, 0x53, 0x87,
+  0xf4, 0x1e, 0x6a, 0xd9, 0x1c, 0x2c, 0x1b, 0x51, 0x21, 0x28, 0xf3, 0x6f, 0xd9, 0xd1, 0x0c, 0x97,
+  0x9b, 0xe7, 0x3f, 0xfa, 0x45, 0xa3, 0x3e, 0xe8, 0xb4, 0x39, 0x52, 0x67, 0x52, 0x4e, 0xfa, 0x5a,
+  0x4e, 0xdf, 0x5d, 0x07, 0x6e, 0x2c, 0x24, 0x84, 0x03, 0xe5, 0x4b, 0xa8, 0xa5, 0x58, 0x70, 0xdc,
+  0xb6, 0x76, 0x00, 0xcd, 0x81, 0x6f, 0x34, 0xd7, 0x11, 0xff, 0xf9, 0xb5, 0x7d, 0x4d, 0xe6, 0x1b,
+  0x4a, 0xfc, 0x1a, 0xdc, 0xef, 0xaa, 0xf4, 0x37, 0x56, 0xe9, 0x77, 0x28, 0xd2, 0xff, 0x8c, 0x1a,
+  0xbd, 0xa2, 0x5c, 0x59, 0x76, 0x23, 0xd9, 0x0a, 0x64, 0x03, 0xcd, 0xaa, 0x9c, 0x1f, 0x3a, 0xcd,
+  0x6a, 0xfe, 0xdb, 0xe7, 0xbc, 0x98, 0x5f, 0x80, 0x93, 0x7d, 0x96, 0x52, 0x5e, 0x29, 0xe3, 0x4b,
+  0x1f, 0x16, 0x15, 0x59, 0x2d, 0x48, 0x88, 0xf0, 0xd0, 0x3a, 0x39, 0x79, 0x25, 0x21, 0xb3, 0x35,
+  0xb9, 0x9b, 0x92, 0xa5, 0x31, 0x78, 0xc9, 0x58, 0x06, 0x8c, 0x16, 0xc0, 0x79, 0x2e, 0x73, 0x34,
+  0xce, 0xcf, 0xd6, 0x68, 0xd4, 0xb2, 0x44, 0x17, 0x38, 0xee, 0x52, 0x45, 0x37, 0xcb, 0xdc, 0x3c,
+  0x8f, 0x64, 0x1a, 0xc6, 0x8f, 0x6d, 0x45, 0xad, 0xec, 0x7b, 0xbb, 0xa1, 0x86, 0xcd, 0xa3, 0x12,
+  0x0a, 0xe6, 0x4d, 0xe4, 0xbf, 0x5c, 0x54, 0x10, 0xb2, 0xbe, 0x81, 0xe1, 0xcd, 0x7a, 0x90, 0x6f,
+  0x6b, 0x45, 0x8b, 0x8c, 0x57, 0xf4, 0xb6, 0x73, 0x6a, 0xee, 0x39, 0x67, 0x9f, 0x6c, 0xf8, 0xd5,
+  0x3f, 0x83, 0x1f, 0xe3, 0xb3, 0x4f, 0xa7, 0xa6, 0x75, 0xf6, 0x98, 0x3e, 0xd2, 0x8f, 0xc7, 0x9d,
+  0x9f, 0xbb, 0xff, 0x1e, 0x38, 0x58, 0x27, 0x28, 0x3c, 0x83, 0xc0, 0x9e, 0xe0, 0xda, 0xfc, 0x64,
+  0x3b, 0x0e, 0xa0, 0x69, 0xf6, 0x33, 0xea, 0x07, 0xf4, 0x1c, 0x40, 0x8e, 0x07, 0x5d, 0x90, 0xb6,
+  0xd0, 0xff, 0xd1, 0x0a, 0x8a, 0xef, 0x4b, 0x75, 0x08, 0x55, 0x46, 0x8b, 0x63, 0x9e, 0xbb, 0x54,
+  0x6d, 0x57, 0x70, 0xd3, 0x95, 0x80, 0x9b, 0x82, 0xc5, 0x57, 0xb4, 0xb1, 0xd4, 0x02, 0x95, 0x27,
+  0xd2, 0x30, 0x4b, 0x0f, 0x7c, 0xa4, 0x1d, 0x68, 0x11, 0x24, 0xb9, 0x00, 0x5b, 0x80, 0xb7, 0xb8,
+  0xd9, 0xd5, 0xb3, 0x37, 0x27, 0x1b, 0xf0, 0x55, 0xa0, 0x39, 0xa6, 0xd3, 0xa0, 0x09, 0xac, 0x44,
+  0xbe, 0x07, 0x68, 0x5a, 0x5e, 0x69, 0xb7, 0xca, 0xd3, 0xc1, 0x35, 0x0b, 0x69, 0x92, 0x03, 0x45,
+  0x0b, 0xd9, 0xc2, 0x94, 0x16, 0x35, 0x38, 0xb6, 0x57, 0xe9, 0x2f, 0x13, 0x40, 0x07, 0x3e, 0xac,
+  0x64, 0xfb, 0x7c, 0xc1, 0xfc, 0x28, 0x8c, 0x36, 0xae, 0x63, 0xaa, 0x70, 0x5b, 0x5f, 0x32, 0xd4,
+  0xd6, 0x32, 0x2a, 0xff, 0xab, 0xcf, 0xcd, 0xac, 0xb0, 0xda, 0x9f, 0xc6, 0x71, 0x9e, 0xdc, 0x87,
+  0x1b, 0xee, 0x1d, 0x7f, 0x1a, 0x33, 0xe8, 0x60, 0xf7, 0x61, 0x47, 0x78, 0xa1, 0x06, 0x9e, 0xf5,
+  0xe7, 0x29, 0xe8, 0x9e, 0x3c, 0x95, 0xee, 0xfe, 0xb9, 0xb8, 0x12, 0xd9, 0xad, 0xac, 0x0d, 0x73,
+  0x85, 0x19, 0xce, 0xeb, 0x42, 0x59, 0x4c, 0x53, 0x94, 0x86, 0xa5, 0xb3, 0xba, 0xf7, 0x7e, 0x13,
+  0xf3, 0xca, 0x29, 0x4c, 0x2e, 0xc7, 0xbf, 0x20, 0xfb, 0x04, 0x80, 0x03, 0x57, 0xb1, 0x9c, 0x6b,
+  0x70, 0xbe, 0x72, 0xf1, 0xdf, 0xd5, 0x36, 0xae, 0x27, 0x8b, 0x8c, 0x27, 0x2c, 0x5e, 0x3b, 0x6b,
+  0xab, 0xa8, 0x98, 0x61, 0x02, 0xae, 0xc6, 0xaa, 0x6b, 0x4a, 0x9e, 0xb5, 0xda, 0x72, 0x64, 0x09,
+  0x52, 0x69, 0xa5, 0xb1, 0xa9, 0xa4, 0x6d, 0xc8, 0xad, 0x2d, 0xf5, 0x8f, 0x3a, 0xb0, 0xdd, 0x6c,
+  0x28, 0xee, 0x7c, 0x99, 0xab, 0xb2, 0xfe, 0x18, 0x7d, 0x13, 0x69, 0xa8, 0xb8, 0xcd, 0xb6, 0xaa,
+  0x2f, 0x05, 0xe6, 0xa0, 0xec, 0x64, 0x7a, 0xd7, 0x75, 0xc0, 0x6b, 0x82, 0xa6, 0x65, 0x00, 0x1f,
+  0x08, 0x54, 0xb6, 0xf9, 0xb2, 0xa8, 0xb9, 0x14, 0xf8, 0x4c, 0x8b, 0x81, 0xdb, 0xad, 0xde, 0xb6,
+  0x20, 0x58, 0x5f, 0x12, 0xa8, 0xa6, 0xd1, 0xd6, 0x94, 0x4d, 0x45, 0x90, 0xaa, 0x16, 0x9a, 0x0f,
+  0x10, 0xbe, 0x7e, 0x74, 0x63, 0x48, 0xfe, 0x06, 0x2b, 0x57, 0x95, 0x94, 0x16, 0x56, 0xd4, 0x2a,
+  0x63, 0xbc, 0xf4, 0xe0, 0x23, 0xcd, 0x2c, 0xdd, 0x55, 0x9e, 0xb4, 0x6d, 0x81, 0x86, 0x35, 0x2d,
+  0x28, 0x59, 0xef, 0xf2, 0x3a, 0xac, 0x9c, 0x1a, 0x4f, 0xde, 0x3f, 0xe5, 0xc4, 0x7e, 0xe0, 0xa4,
+  0xd3, 0xac, 0x2b, 0x99, 0x30, 0x56, 0xa7, 0xe6, 0x19, 0xcc, 0xe3, 0x9b, 0x77, 0x93, 0xfe, 0x85,
+  0x9b, 0x21, 0x9c, 0x16, 0xae, 0x44, 0x5d, 0x2e, 0x83, 0xf6, 0x24, 0x2a, 0xfc, 0x14, 0x74, 0xca,
+  0x7b, 0x6e, 0xd8, 0xb3, 0xb9, 0xcb, 0xf6, 0xe7, 0x1a, 0x91, 0x44, 0x5b, 0x26, 0xe7, 0x49, 0xba,
+  0xe2, 0x0f, 0x50, 0x60, 0xa5, 0x8b, 0xcb, 0xd3, 0x39, 0xc4, 0x7c, 0x9c, 0x82, 0x1e, 0x13, 0x3c,
+  0x40, 0x5f, 0xc9, 0x07, 0xf7, 0x9b, 0x9b, 0xf8, 0xb8, 0x9b, 0xf3, 0xe3, 0xba, 0x5b, 0x30, 0x02,
+  0xb1, 0x29, 0x0e, 0x90, 0x1d, 0x36, 0x5f, 0x14, 0x57, 0x5a, 0x8a, 0x4f, 0xef, 0x88, 0xf0, 0x46,
+  0x2a, 0xd7, 0xad, 0xc6, 0x7e, 0xe2, 0xfa, 0xe7, 0xcb, 0x45, 0xbb, 0xc9, 0x3d, 0xa5, 0xef, 0xae,
+  0x86, 0x6f, 0x1d, 0xf3, 0xa7, 0x9a, 0x9f, 0x53, 0xfc, 0x6b, 0xbc, 0x60, 0x9d, 0xd6, 0xbf, 0xd7,
+  0x19, 0xea, 0xfc, 0xfc, 0x51, 0x9f, 0xe0, 0x9c, 0xdd, 0x77, 0xad, 0xc1, 0x0b, 0xc8, 0x99, 0x28,
+  0x9b, 0x1f, 0x1f, 0xc0, 0xff, 0xef, 0x58, 0xa1, 0x77, 0x3e, 0xf6, 0xae, 0xef, 0x0a, 0xfd, 0xb7,
+  0x4f, 0xbf, 0x18, 0x06, 0x3e, 0x17, 0x38, 0xde, 0xfb, 0x89, 0x43, 0x54, 0x9f, 0xab, 0x8f, 0x3f,
+  0xef, 0x9d, 0x7d, 0xad, 0x74, 0x20, 0x8d, 0x87, 0x86, 0x78, 0x46, 0x00, 0x43, 0xc4, 0x07, 0xf1,
+  0x5b, 0xc2, 0x97, 0xdf, 0xce, 0x44, 0x35, 0x2f, 0xaa, 0x67, 0x12, 0xe8, 0xd4, 0x82, 0xf6, 0x8f,
+  0xd6, 0x35, 0xb1, 0xf1, 0xd1, 0xdc, 0xed, 0x5f, 0x73, 0x18, 0x9e, 0xc9, 0xa9, 0xb4, 0x4e, 0xd3,
+  0xf8, 0xfb, 0x2c, 0x2e, 0x9d, 0x9d, 0x36, 0xb4, 0x8d, 0x59, 0x76, 0xdb, 0x26, 0x74, 0x59, 0x14,
+  0xc1, 0x78, 0xa8, 0x42, 0xb2, 0x0b, 0x58, 0x59, 0xcc, 0x52, 0x20, 0x8c, 0x3b, 0xf8, 0x37, 0x95,
+  0x1d, 0x8d, 0x8d, 0x66, 0xbe, 0xf6, 0x50, 0x77, 0xa3, 0x24, 0x57, 0x6f, 0xd3, 0xac, 0x68, 0xb0,
+  0x55, 0xab, 0x65, 0x69, 0xdf, 0x5e, 0x9e, 0x78, 0x6a, 0x1b, 0xd4, 0x81, 0x69, 0x3e, 0x70, 0x9c,
+  0x9e, 0x73, 0x87, 0x7a, 0xea, 0x2d, 0x8a, 0xb1, 0x80, 0xc1, 0xe8, 0x80, 0x58, 0x48, 0xa4, 0xa1,
+  0x96, 0x61, 0xde, 0xfb, 0xbd, 0x15, 0xd4, 0x5d, 0x26, 0x65, 0x4d, 0x87, 0x48, 0xfc, 0x77, 0x3c,
+  0x48, 0xe0, 0xfa, 0xa3, 0x07, 0x69, 0x1b, 0x9f, 0xf1, 0xa0, 0x5e, 0x1a, 0x6b, 0x64, 0x19, 0x08,
+  0x61, 0xc1, 0x67, 0xde, 0x62, 0xe9, 0x63, 0x31, 0xb3, 0x04, 0x9b, 0xf2, 0xe1, 0x03, 0xe8, 0xa9,
+  0x7c, 0x2c, 0xa3, 0xbd, 0x2c, 0x28, 0x6a, 0x7c, 0xc0, 0xd2, 0x06, 0xc2, 0xc6, 0xcf, 0x3b, 0x97,
+  0x3f, 0xef, 0x60, 0x59, 0x30, 0x47, 0x8f, 0xf0, 0xdd, 0x9c, 0xe5, 0xf7, 0x75, 0x09, 0xfe, 0x68,
+  0x64, 0x73, 0xea, 0x26, 0xc6, 0x65, 0x84, 0xbd, 0x21, 0xe6, 0xd5, 0xc3, 0xa8, 0xca, 0x35, 0x85,
+  0xb5, 0x5b, 0xc3, 0xd9, 0xfa, 0x73, 0x11, 0xa9, 0xf2, 0x4d, 0x5a, 0xdb, 0x56, 0xeb, 0x5b, 0x5e,
+  0xa6, 0xe5, 0x50, 0x9f, 0xc6, 0xb1, 0x56, 0xe0, 0xe6, 0x31, 0x0b, 0x43, 0x2c, 0x58, 0xa3, 0xf9,
+  0x9c, 0x05, 0x11, 0x84, 0xaa, 0xf8, 0xaa, 0xab, 0x3d, 0x4b, 0x79, 0x6d, 0x1b, 0xe5, 0x33, 0x2c,
+  0x6a, 0x17, 0x59, 0x8a, 0xbb, 0x6d, 0x55, 0x05, 0x8b, 0xd5, 0xeb, 0x7a, 0xd9, 0xd7, 0xd8, 0x2c,
+  0xae, 0xf6, 0x33, 0xf9, 0x26, 0xfc, 0x5a, 0x24, 0xdc, 0x54, 0x22, 0x3e, 0xe3, 0xf0, 0x54, 0x23,
+  0x8a, 0xb1, 0x9b, 0xb6, 0x8a, 0xd7, 0x8a, 0xc3, 0x0d, 0x35, 0x20, 0x6d, 0xda, 0x12, 0xec, 0x5f,
+  0x5d, 0x17, 0xd2, 0xa6, 0x9c, 0x9a, 0x16, 0x62, 0x16, 0xdc, 0x59, 0x13, 0xaf, 0x9e, 0x3f, 0x23,
+  0x2d, 0xc4, 0xd1, 0x74, 0x56, 0xf0, 0x5a, 0xf9, 0xff, 0x8a, 0x1a, 0xdc, 0xe0, 0x02, 0x07, 0x37,
+  0x75, 0xb1, 0x79, 0xe1, 0x70, 0x2c, 0x06, 0x90, 0x42, 0xe4, 0xe8, 0xff, 0x38, 0x85, 0x94, 0x8b,
+  0xec, 0x8d, 0xcb, 0x98, 0x07, 0xda, 0xfa, 0xe3, 0x85, 0x5b, 0xb2, 0x45, 0x70, 0xe3, 0x79, 0x82,
+  0xbb, 0x93, 0xbe, 0x37, 0x61, 0xad, 0x8c, 0x27, 0x2e, 0x1f, 0x71, 0x5b, 0x76, 0x42, 0x5b, 0xfa,
+  0x31, 0x73, 0x33, 0x7c, 0x96, 0x50, 0x6e, 0x71, 0x89, 0x23, 0xd7, 0x12, 0x48, 0x26, 0x5d, 0x96,
+  0xe0, 0xc3, 0xaf, 0x57, 0xe9, 0xf4, 0x87, 0x88, 0xad, 0xaa, 0x73, 0x04, 0x5a, 0xb9, 0x29, 0x58,
+  0xcb, 0xa3, 0xca, 0x43, 0xc1, 0xda, 0x79, 0x2f, 0x28, 0x94, 0xe3, 0x74, 0xfa, 0xd2, 0xc7, 0x6d,
+  0x6b, 0xe5, 0x11, 0xa4, 0x78, 0x4a, 0xaa, 0x27, 0x29, 0x9e, 0x93, 0xd2, 0x15, 0x1e, 0xd7, 0xd6,
+  0xdb, 0xf7, 0xc4, 0x4c, 0x0f, 0x37, 0x5b, 0xd0, 0xb6, 0xcd, 0x89, 0xc6, 0x9a, 0x71, 0x8a, 0xcf,
+  0x07, 0xdc, 0xb8, 0x6d, 0x4e, 0xfc, 0x7f, 0xa9, 0x13, 0x93, 0x62, 0x21, 0xb7, 0x4e, 0xe1, 0xe3,
+  0x09, 0x15, 0x72, 0xcd, 0xf3, 0x1c, 0x08, 0xa3, 0x6c, 0xfa, 0x3c, 0xe0, 0x0d, 0xf7, 0xad, 0x14,
+  0xf1, 0x19, 0xc9, 0x1f, 0xa9, 0x14, 0x95, 0x52, 0x91, 0x6f, 0x60, 0xb4, 0x45, 0xad, 0x6f, 0xb9,
+  0x45, 0x29, 0x68, 0x09, 0xeb, 0xb6, 0xc6, 0xac, 0x7b, 0x45, 0xad, 0x4d, 0x71, 0xeb, 0xc6, 0xc8,
+  0x75, 0x63, 0xec, 0xba, 0x21, 0x7a, 0xd5, 0xe2, 0xd7, 0x67, 0x88, 0x60, 0x7f, 0x2c, 0x8a, 0xfd,
+  0xe1, 0x38, 0xf6, 0xb9, 0x22, 0x99, 0xa6, 0x29, 0x1f, 0x69, 0xc9, 0x5e, 0xa8, 0x6f, 0x3c, 0x50,
+  0xa1, 0xc8, 0x3c, 0x58, 0x55, 0xce, 0x59, 0x59, 0xff, 0xab, 0xa3, 0xd1, 0x8f, 0x61, 0x48, 0x53,
+  0x33, 0xf5, 0x83, 0x0d, 0x8d, 0xa0, 0x12, 0xb8, 0xd9, 0xf9, 0xde, 0x3c, 0x0d, 0x98, 0x5e, 0x43,
+  0xd5, 0x12, 0xb0, 0x36, 0x23, 0x92, 0x71, 0x6f, 0x13, 0xae, 0xed, 0x4d, 0x01, 0xab, 0x65, 0x85,
+  0xeb, 0xfa, 0x3e, 0x54, 0xde, 0xf0, 0xe9, 0x84, 0x15, 0xcb, 0x85, 0x08, 0x54, 0x78, 0xf4, 0x19,
+  0x3a, 0xda, 0x8f, 0x6b, 0xe5, 0x4f, 0xae, 0x9e, 0x22, 0x2b, 0x6f, 0x60, 0xaa, 0x19, 0x3b, 0xe5,
+  0x78, 0x7e, 0xd2, 0x80, 0x0e, 0x4d, 0x4f, 0x78, 0xfe, 0xd7, 0x0c, 0xe5, 0xf4, 0x38, 0xc0, 0x35,
+  0x5f, 0xc9, 0xe0, 0xe7, 0x3c, 0xfd, 0xd3, 0xe8, 0x6c, 0xfd, 0xf9, 0xea, 0x8e, 0x1f, 0x47, 0xfe,
+  0xf9, 0x8e, 0x32, 0xcd, 0x58, 0xa5, 0x66, 0xd6, 0x5d, 0x64, 0x0c, 0xc1, 0x9f, 0xb1, 0xd0, 0x5d,
+  0xc6, 0x45, 0xb5, 0x71, 0x4a, 0x07, 0xcb, 0x2b, 0x45, 0x15, 0xe9, 0x74, 0x1a, 0x13, 0x93, 0x45,
+  0x74, 0xc1, 0x76, 0x4a, 0x30, 0xe4, 0x72, 0xe1, 0x26, 0x2c, 0x96, 0x67, 0xd1, 0x13, 0xf0, 0x1f,
+  0x21, 0xde, 0x49, 0xe4, 0xc5, 0x50, 0xa6, 0x55, 0x0f, 0xb6, 0x35, 0x83, 0x40, 0xc5, 0x69, 0x94,
+  0xb9, 0x7b, 0xf9, 0x82, 0x61, 0x29, 0xa7, 0x5a, 0xbd, 0x15, 0xa0, 0x3c, 0x30, 0xbe, 0xc1, 0xc2,
+  0x9b, 0x06, 0x89, 0x76, 0x3f, 0x4b, 0xe3, 0x58, 0x34, 0x3e, 0xd4, 0x76, 0x16, 0x97, 0x3b, 0x93,
+  0x0d, 0xc6, 0x5c, 0x3f, 0xd0, 0x71, 0xe2, 0xbb, 0xa8, 0xb0, 0x8f, 0x2d, 0x47, 0x88, 0xc1, 0x32,
+  0x0c, 0x63, 0xac, 0xbe, 0xbf, 0x8a, 0xc2, 0x08, 0x01, 0x61, 0x92, 0x7c, 0x9c, 0xb3, 0x62, 0x96,
+  0x06, 0x07, 0xf4, 0x5c, 0xf9, 0x9a, 0xdf, 0x6b, 0xd0, 0x2d, 0x66, 0x2c, 0x31, 0xe4, 0xc3, 0xfe,
+  0xea, 0x21, 0xb7, 0x5c, 0xe8, 0xcb, 0x9e, 0x6e, 0x7a, 0x5e, 0x9b, 0x01, 0xc5, 0x2c, 0x4b, 0x57,
+  0x34, 0x41, 0x9f, 0x63, 0x6c, 0x33, 0x74, 0xa4, 0xa1, 0x29, 0x27, 0x56, 0x55, 0xbf, 0x14, 0xc7,
+  0xd5, 0x4b, 0x5c, 0xf8, 0x64, 0xba, 0x7c, 0x1c, 0xae, 0xf2, 0xc1, 0x8f, 0x22, 0x1c, 0x6d, 0x8a,
+  0xb4, 0xf2, 0xac, 0x68, 0x2d, 0xd8, 0x2a, 0x87, 0x44, 0xff, 0x92, 0x8a, 0xb0, 0xc2, 0x88, 0x22,
+  0xbf, 0x63, 0x39, 0xb8, 0x26, 0x50, 0xea, 0xa2, 0x05, 0x8c, 0x4e, 0x77, 0x91, 0x2e, 0x96, 0x31,
+  0x6e, 0xe4, 0xb5, 0x1c, 0x75, 0x10, 0x91, 0x48, 0x8a, 0xec, 0x53, 0x1a, 0x24, 0xf9, 0x14, 0x99,
+  0xab, 0x43, 0xc0, 0xd4, 0xc3, 0xfb, 0x1b, 0xca, 0xa2, 0x77, 0x1c, 0xe2, 0x2b, 0xa3, 0x76, 0x2e,
+  0xa1, 0xe5, 0xf4, 0xf3, 0xfa, 0x73, 0x75, 0xf9, 0x3c, 0xbb, 0x5e, 0xb2, 0xf0, 0x84, 0x7e, 0xb1,
+  0xf1, 0x99, 0x37, 0xf7, 0x86, 0x0b, 0xe5, 0x29, 0x6f, 0xe9, 0x0c, 0x77, 0x3b, 0xc5, 0xff, 0x05,
+  0xc7, 0x29, 0x1c, 0xf7, 0x65, 0x12, 0xa6, 0xda, 0xd7, 0xf5, 0x93, 0xfc, 0x87, 0x47, 0x1f, 0x99,
+  0x08, 0x79, 0xc7, 0x45, 0x91, 0x45, 0xde, 0xb2, 0xc0, 0xd8, 0x17, 0xe5, 0x58, 0x59, 0xc2, 0x52,
+  0x42, 0x4c, 0x04, 0xd5, 0x06, 0x9f, 0x95, 0x74, 0xce, 0x8a, 0x36, 0xba, 0xbb, 0xe4, 0x0e, 0x92,
+  0x7a, 0xf3, 0xec, 0x04, 0x00, 0x17, 0xf5, 0x98, 0x4a, 0x5b, 0xc1, 0x45, 0xf2, 0x7d, 0x79, 0x02,
+  0x18, 0x94, 0xb8, 0x7e, 0xac, 0x84, 0xc2, 0x1e, 0xe0, 0x46, 0xd2, 0x2d, 0xa7, 0x85, 0x21, 0xff,
+  0x88, 0x89, 0x5f, 0xee, 0x48, 0x17, 0xc9, 0x1b, 0xf5, 0x44, 0x84, 0x5e, 0x95, 0x4e, 0xed, 0xdd,
+  0xb7, 0x11, 0x6d, 0x3d, 0x5f, 0x51, 0xd1, 0x2d, 0xd1, 0xbe, 0x56, 0xb6, 0x46, 0x6f, 0xc7, 0xda,
+  0xb6, 0x91, 0x2a, 0x90, 0x96, 0xde, 0x2f, 0x10, 0xe3, 0xe4, 0x11, 0x3c, 0xe7, 0xb7, 0x22, 0x6e,
+  0x86, 0xbc, 0x26, 0x3e, 0xc5, 0x63, 0x5b, 0x10, 0xc9, 0xd3, 0x52, 0xb5, 0xf0, 0xb6, 0x36, 0x11,
+  0xd4, 0x13, 0x74, 0x1b, 0xbb, 0x9b, 0xcf, 0xfd, 0x6f, 0xa2, 0xa6, 0xc6, 0xb1, 0x05, 0xaf, 0x59,
+  0x5a, 0x89, 0x95, 0x47, 0x66, 0x5b, 0x55, 0xde, 0xb4, 0xf3, 0x0f, 0xb5, 0x87, 0x55, 0xb7, 0x69,
+  0x4e, 0xfb, 0xd8, 0xf2, 0x74, 0xab, 0x61, 0xe2, 0x1f, 0x5a, 0x9e, 0x88, 0xdc, 0x03, 0x6f, 0xf3,
+  0x41, 0x8a, 0x22, 0x54, 0x43, 0xb0, 0x67, 0xea, 0xee, 0xd2, 0xba, 0x64, 0x8d, 0xee, 0xdb, 0x7c,
+  0xad, 0x75, 0xaf, 0xaa, 0xf2, 0xe0, 0xa6, 0x56, 0xbf, 0x55, 0x17, 0x6c, 0xeb, 0xc4, 0x1b, 0xdd,
+  0xb7, 0x11, 0x6f, 0x5d, 0xfe, 0x55, 0x61, 0xa2, 0x4e, 0xfa, 0xb8, 0xb6, 0x81, 0xb2, 0x4e, 0xbb,
+  0xd9, 0x7f, 0x1b, 0xf1, 0xf6, 0x0d, 0x99, 0x4d, 0xd4, 0x5f, 0x3d, 0x7f, 0xb6, 0x89, 0xb0, 0xd2,
+  0x75, 0x1b, 0xcd, 0xf8, 0x4e, 0xe4, 0x30, 0x07, 0xfe, 0x08, 0x05, 0x47, 0xb5, 0x67, 0x5c, 0x23,
+  0xb9, 0xde, 0x7d, 0xcb, 0x04, 0x52, 0xea, 0x00, 0xd6, 0x2d, 0xdc, 0x0c, 0xca, 0x53, 0x58, 0x30,
+  0x30, 0xff, 0xbc, 0xbe, 0x52, 0x68, 0x39, 0xce, 0x85, 0x27, 0xf4, 0x70, 0xb3, 0x02, 0x73, 0xbe,
+  0xbe, 0xb1, 0x38, 0xbb, 0x61, 0x60, 0xf9, 0x7a, 0xc3, 0xe4, 0xd6, 0xe2, 0x1a, 0x8f, 0xc8, 0xe3,
+  0xc5, 0x02, 0xf8, 0x28, 0xde, 0xa8, 0x3f, 0x49, 0xe4, 0x07, 0xd0, 0xaa, 0x17, 0x06, 0x6a, 0x2f,
+  0x1a, 0xb6, 0x9d, 0x50, 0xab, 0x63, 0x5e, 0x8b, 0x1b, 0x4a, 0xb6, 0xfe, 0x4f, 0x3a, 0x66, 0x76,
+  0x97, 0x93, 0x60, 0xa8, 0x32, 0x03, 0x5f, 0xdc, 0x8d, 0x16, 0x62, 0x83, 0x00, 0x24, 0xec, 0x74,
+  0xe8, 0xc5, 0x0b, 0xb9, 0x56, 0x9b, 0xd3, 0xad, 0x36, 0x47, 0xb4, 0x7f, 0xaf, 0xf8, 0x55, 0xe3,
+  0xc4, 0x18, 0xe0, 0x38, 0x45, 0xc8, 0x5d, 0x6d, 0x7e, 0x6a, 0xd3, 0xcf, 0x1e, 0xfc, 0xd4, 0x2d,
+  0xfd, 0xac, 0xfb, 0x21, 0x8d, 0x92, 0xf2, 0x79, 0xac, 0xd6, 0x72, 0x90, 0x0c, 0x4d, 0x6f, 0x3b,
+  0x4e, 0x57, 0xfe, 0x67, 0xea, 0x15, 0xe4, 0xfa, 0x59, 0xb2, 0x7b, 0x52, 0x6a, 0x39, 0x60, 0x86,
+  0xf4, 0xfa, 0x5d, 0xfa, 0x9f, 0x5e, 0xda, 0x5f, 0x3d, 0xf7, 0x0e, 0x85, 0x2a, 0x96, 0x74, 0xdf,
+  0xd4, 0x4f, 0xa7, 0x37, 0xd7, 0x73, 0x38, 0xb4, 0x56, 0x8c, 0xf0, 0xb7, 0x44, 0x55, 0xbf, 0x6c,
+  0xd4, 0x81, 0x4c, 0x2e, 0xab, 0xbe, 0x49, 0x33, 0x36, 0xcd, 0xd2, 0x65, 0x12, 0x3c, 0x4d, 0xe3,
+  0x34, 0x53, 0xea, 0x98, 0xb0, 0xde, 0xa3, 0xb2, 0xfc, 0x45, 0x48, 0xff, 0xf4, 0x4d, 0x48, 0x31,
+  0x29, 0xb4, 0x23, 0xf5, 0xea, 0x3d, 0x35, 0xa4, 0x66, 0xdf, 0x36, 0xfb, 0x0e, 0x47, 0xca, 0x97,
+  0x6f, 0xb5, 0x12, 0x9b, 0xae, 0x76, 0xe4, 0xd9, 0x19, 0x02, 0xc9, 0x41, 0xdb, 0x89, 0x7d, 0x71,
+  0xa8, 0x8f, 0xc5, 0xa1, 0x58, 0xf3, 0x4d, 0xd4, 0x83, 0xce, 0x37, 0xbd, 0x98, 0x84, 0x13, 0xf1,
+  0x3d, 0xd6, 0x7c, 0x3f, 0x66, 0xf8, 0x92, 0x82, 0xb2, 0x8a, 0x11, 0xaf, 0x9e, 0xd5, 0x96, 0x3f,
+  0x77, 0x7a, 0x53, 0x43, 0x80, 0x8a, 0xf7, 0x35, 0xd6, 0x08, 0x4c, 0x6a, 0x05, 0x7f, 0xa1, 0xf9,
+  0xd6, 0xdd, 0x91, 0xfa, 0x96, 0x58, 0x52, 0xfa, 0x79, 0x8e, 0x27, 0xb4, 0x29, 0x62, 0xa5, 0x79,
+  0x84, 0xea, 0x38, 0x70, 0x3d, 0x58, 0x3e, 0x40, 0x19, 0x3b, 0x59, 0x45, 0x41, 0x31, 0x3b, 0xe8,
+  0x39, 0xe6, 0xe2, 0x72, 0x32, 0xa3, 0x35, 0xe6, 0x41, 0xcf, 0xc4, 0x2f, 0x45, 0xba, 0x38, 0xb0,
+  0x9d, 0x2f, 0x27, 0x31, 0x0b, 0x8b, 0x03, 0xc7, 0xfc, 0x72, 0xe2, 0x81, 0x37, 0xb1, 0xec, 0xc0,
+  0x5a, 0x5c, 0x6a, 0x30, 0x16, 0x18, 0xf6, 0x62, 0xb0, 0xd3, 0x64, 0x01, 0xe1, 0x19, 0x6a, 0x91,
+  0x03, 0x07, 0xc6, 0x54, 0x86, 0xdb, 0xf3, 0xd1, 0x72, 0x07, 0x60, 0x1f, 0x63, 0x6f, 0xcf, 0x9b,
+  0xf2, 0xaf, 0x9d, 0x49, 0x75, 0xfb, 0x1d, 0x7d, 0xc2, 0x45, 0xd0, 0x3f, 0x8d, 0x3d, 0xc0, 0xde,
+  0x51, 0x44, 0x6d, 0xc8, 0x5c, 0xdc, 0x43, 0x91, 0x45, 0xb0, 0x2e, 0x33, 0xac, 0x16, 0xb2, 0x30,
+  0x4e, 0x57, 0x7b, 0x57, 0x07, 0x7c, 0x29, 0x3d, 0x81, 0x35, 0xf6, 0x9e, 0x90, 0x75, 0x64, 0x7e,
+  0xa9, 0xd7, 0x54, 0xa6, 0xbe, 0x7d, 0x52, 0x04, 0x9d, 0x8d, 0x5c, 0xcd, 0xee, 0xce, 0xd4, 0x6c,
+  0x9d, 0x27, 0x85, 0x03, 0x1b, 0x54, 0x4b, 0xcb, 0xce, 0x3d, 0x28, 0x96, 0xa6, 0xc9, 0x81, 0x0f,
+  0x28, 0x6a, 0x96, 0x9f, 0xd5, 0x5e, 0xa3, 0xd1, 0x1f, 0xf1, 0x39, 0xac, 0xd1, 0xde, 0xc6, 0xe1,
+  0x0e, 0xa4, 0xe8, 0x1d, 0x2d, 0x4d, 0x28, 0x11, 0x1f, 0xee, 0xd4, 0x97, 0x9b, 0xb8, 0xd6, 0x33,
+  0x3a, 0x3b, 0x47, 0x7c, 0xd5, 0xfa, 0x68, 0x9f, 0x8f, 0x3c, 0xda, 0x2c, 0x70, 0xf9, 0x3a, 0x3d,
+  0x77, 0x4a, 0xb5, 0xcb, 0xb7, 0x54, 0x7f, 0xbd, 0xe5, 0x85, 0x1d, 0x75, 0x39, 0x7b, 0xc3, 0xcb,
+  0x3b, 0xb5, 0x95, 0x3f, 0x4e, 0x48, 0x51, 0xf2, 0xee, 0x6e, 0x97, 0x2f, 0xea, 0xde, 0x6f, 0x06,
+  0x57, 0x77, 0xd1, 0xfc, 0xce, 0x39, 0xdc, 0x98, 0xc1, 0xeb, 0xac, 0x27, 0x69, 0xc2, 0xf4, 0x0d,
+  0x7b, 0x17, 0xeb, 0x12, 0xc8, 0x85, 0xfe, 0x41, 0xeb, 0x1e, 0xf1, 0x2d, 0x62, 0x88, 0xe5, 0x17,
+  0xee, 0x53, 0x07, 0x5d, 0xf9, 0x45, 0x8d, 0x55, 0xb8, 0x67, 0xc5, 0xaf, 0x43, 0xe8, 0xa8, 0xcd,
+  0xb3, 0x62, 0x1e, 0x93, 0xa3, 0x14, 0x28, 0x66, 0x65, 0x6d, 0x89, 0xa2, 0x5a, 0xd5, 0x26, 0x5a,
+  0x6d, 0x4f, 0x81, 0x07, 0xb1, 0xb8, 0x7a, 0x23, 0x2a, 0xe9, 0xa2, 0xb6, 0x3a, 0x8d, 0x6d, 0x4d,
+  0xc2, 0xff, 0x90, 0x08, 0x64, 0x47, 0x8f, 0x8a, 0xe0, 0x08, 0xef, 0x29, 0xe0, 0xa0, 0xf0, 0x41,
+  0x7f, 0xb4, 0x0f, 0x4d, 0xd8, 0xbc, 0xee, 0xa8, 0x74, 0xa0, 0x93, 0x2f, 0xbc, 0x9f, 0x50, 0xdf,
+  0x0e, 0x6d, 0xcd, 0xec, 0x61, 0xf3, 0xe1, 0x4e, 0x1d, 0xcd, 0xce, 0x11, 0x07, 0xe4, 0xe8, 0xf6,
+  0x81, 0x94, 0xbe, 0xfe, 0xf4, 0x05, 0x04, 0xee, 0x2e, 0x96, 0xf9, 0x4c, 0x72, 0x3a, 0xd9, 0x6e,
+  0x1e, 0xb7, 0xac, 0x98, 0xdd, 0x2f, 0xd5, 0x51, 0xd3, 0x72, 0xf1, 0xfb, 0x9d, 0xa5, 0xbe, 0xdf,
+  0x5b, 0x74, 0xc3, 0x28, 0xcb, 0x0b, 0x9a, 0x06, 0xea, 0x47, 0x75, 0xf2, 0x22, 0x37, 0x93, 0x5b,
+  0x47, 0xf0, 0x28, 0xf5, 0x3e, 0x5d, 0xf0, 0xdb, 0xc6, 0x1a, 0x5b, 0xb9, 0x6d, 0x3b, 0x1a, 0x1b,
+  0xb6, 0x64, 0xf5, 0xa6, 0xbe, 0x37, 0x5d, 0x8c, 0xc0, 0xb7, 0x52, 0x6f, 0x28, 0xef, 0xe3, 0x3a,
+  0xac, 0x76, 0xb3, 0xca, 0x94, 0x84, 0xcd, 0x62, 0x59, 0x93, 0x4f, 0xeb, 0x9b, 0x27, 0xd2, 0xee,
+  0xf5, 0x0d, 0x6b, 0x9c, 0x0c, 0x22, 0x6c, 0x4d, 0xda, 0x0e, 0xcf, 0x56, 0xf1, 0x69, 0x7d, 0xce,
+  0x61, 0x65, 0x84, 0x77, 0xaf, 0x94, 0xa5, 0x86, 0xb2, 0xc5, 0x87, 0xe5, 0xa1, 0x3b, 0xa7, 0x53,
+  0x15, 0x14, 0xcb, 0xc5, 0xcd, 0x27, 0xa2, 0xf5, 0x50, 0xbe, 0xb0, 0x24, 0xbe, 0x3f, 0xa8, 0xdf,
+  0x36, 0xa5, 0x3d, 0x96, 0x1d, 0x07, 0xda, 0xc7, 0x6b, 0x4e, 0x8d, 0x5f, 0x9c, 0x22, 0xa2, 0x39,
+  0x2d, 0x20, 0x70, 0xa3, 0x51, 0x45, 0xfa, 0x58, 0xfd, 0xc6, 0x41, 0x1b, 0x6f, 0xb0, 0x3e, 0xa6,
+  0x8b, 0xa9, 0x54, 0xa8, 0xf4, 0xbc, 0xe2, 0xa5, 0xd1, 0xbe, 0xce, 0x53, 0x03, 0xa0, 0x1e, 0x29,
+  0x55, 0x36, 0x05, 0x4c, 0xb5, 0x7f, 0xd9, 0x4e, 0x44, 0xe9, 0xbf, 0x99, 0x98, 0x02, 0x78, 0x50,
+  0xde, 0x96, 0x52, 0x93, 0xc3, 0xbf, 0x81, 0x8c, 0x7f, 0x17, 0x12, 0x7e, 0x89, 0xbe, 0x2e, 0x93,
+  0x20, 0x83, 0x6b, 0x24, 0xa3, 0x23, 0xef, 0x68, 0xa9, 0xec, 0xdc, 0x5d, 0x64, 0x69, 0x91, 0x8a,
+  0xe5, 0x19, 0xdd, 0x23, 0x06, 0x80, 0x8d, 0x14, 0xb2, 0x55, 0xe2, 0xc8, 0x0b, 0xa4, 0x52, 0x6e,
+  0xce, 0xcb, 0x0e, 0x9e, 0xcc, 0x8d, 0x4e, 0xd5, 0x02, 0xb1, 0x3f, 0x5d, 0x16, 0x6a, 0x0b, 0xbf,
+  0x94, 0x22, 0xe7, 0x4d, 0x78, 0x89, 0xd2, 0x16, 0x1f, 0xb5, 0x46, 0xab, 0x3a, 0x00, 0xba, 0xe1,
+  0xa9, 0xb3, 0xb6, 0xf3, 0x85, 0x38, 0x01, 0xbe, 0xb7, 0xe2, 0x41, 0x66, 0x47, 0x6b, 0x94, 0x95,
+  0x2b, 0xc1, 0xb6, 0x56, 0xc7, 0x53, 0x2f, 0x3a, 0xb4, 0x1d, 0xa8, 0x3a, 0x68, 0x28, 0xde, 0xdb,
+  0xb3, 0xe2, 0x05, 0xe5, 0x4e, 0x13, 0x35, 0xef, 0xdd, 0x9c, 0xbe, 0x81, 0x02, 0x61, 0xe0, 0x77,
+  0xe2, 0x08, 0xff, 0x51, 0x34, 0xb5, 0x9a, 0x6c, 0xd7, 0xaa, 0x21, 0x25, 0xdf, 0xec, 0x3c, 0x02,
+  0x06, 0x34, 0x08, 0xe4, 0xf2, 0xfd, 0xfd, 0x3d, 0x2f, 0xbd, 0xd4, 0x8f, 0x1e, 0xcd, 0xec, 0x5a,
+  0xe3, 0x8c, 0xde, 0x47, 0x83, 0xf6, 0xfd, 0x99, 0x7d, 0xc4, 0xf9, 0x91, 0x31, 0xba, 0x05, 0x03,
+  0x45, 0xad, 0x5c, 0x2f, 0x73, 0x89, 0xda, 0x99, 0x9e, 0xeb, 0x47, 0xdf, 0xfd, 0xa3, 0xac, 0x6a,
+  0x76, 0xea, 0x4a, 0xdb, 0xe0, 0xb0, 0xb5, 0x54, 0x56, 0x11, 0x16, 0xe8, 0xe9, 0x0a, 0x19, 0x9d,
+  0x7f, 0xd1, 0x6b, 0xc4, 0xb8, 0x43, 0xea, 0xcd, 0x52, 0x6a, 0xa7, 0x59, 0x0a, 0x54, 0x28, 0xf7,
+  0x41, 0x98, 0x35, 0x01, 0x95, 0x46, 0xba, 0xcc, 0x6b, 0xd5, 0x92, 0x1e, 0x84, 0x43, 0x71, 0xa7,
+  0x5b, 0x77, 0x5e, 0x9e, 0xb6, 0x84, 0x41, 0xe5, 0x53, 0x2b, 0x69, 0xa2, 0x89, 0x02, 0x11, 0x25,
+  0xe5, 0x83, 0x24, 0x71, 0xcf, 0x05, 0xa7, 0xc5, 0x1b, 0x3f, 0x7d, 0xaa, 0x3c, 0x49, 0x7e, 0x10,
+  0xbe, 0xd4, 0x85, 0xb0, 0x0f, 0xbf, 0x5a, 0x00, 0xc5, 0xd3, 0xc7, 0xaa, 0x77, 0xb2, 0x2d, 0x05,
+  0xe1, 0xfc, 0x88, 0x82, 0x69, 0xa6, 0x10, 0xae, 0x3f, 0xb8, 0xda, 0x92, 0xe2, 0x35, 0x96, 0x67,
+  0x90, 0x28, 0x88, 0xb6, 0x26, 0xa4, 0x14, 0x5f, 0xd7, 0x0a, 0xb0, 0x1d, 0xaa, 0x1d, 0xb9, 0x06,
+  0xeb, 0x30, 0xe9, 0xc2, 0xf5, 0xf9, 0xc5, 0x42, 0x56, 0xa9, 0xc3, 0x46, 0x05, 0x79, 0x33, 0x91,
+  0x0a, 0x01, 0xdd, 0xc3, 0xb9, 0x05, 0x2b, 0xd5, 0xf7, 0xfc, 0xc5, 0x4b, 0xa3, 0x69, 0x83, 0xcd,
+  0xec, 0x61, 0x7d, 0xc8, 0xb9, 0xbb, 0xde, 0xa5, 0xd7, 0x68, 0x05, 0x2f, 0xf0, 0x53, 0xc4, 0x8c,
+  0x75, 0x8b, 0xe2, 0x22, 0xb6, 0x56, 0x05, 0x0a, 0x9d, 0x52, 0x32, 0x94, 0x96, 0xdd, 0x1c, 0x36,
+  0xd2, 0x73, 0x98, 0xf6, 0x5d, 0x1c, 0x20, 0x96, 0x01, 0x78, 0xb0, 0xa1, 0xc9, 0x70, 0x95, 0x58,
+  0xb5, 0x1a, 0x5a, 0x19, 0x30, 0x6e, 0x12, 0x96, 0x0f, 0x2e, 0x33, 0x8d, 0x88, 0x83, 0xaa, 0x80,
+  0x5b, 0x14, 0x9a, 0xef, 0x3b, 0xff, 0xee, 0x28, 0x1f, 0x9f, 0x7a, 0x24, 0x63, 0xf9, 0xbe, 0x4d,
+  0xbb, 0xa0, 0x6d, 0x75, 0xc4, 0xba, 0xb8, 0x2a, 0x54, 0xbb, 0xd0, 0xea, 0x93, 0x77, 0x55, 0x76,
+  0xce, 0x89, 0x51, 0x7f, 0xc4, 0x2e, 0xb5, 0x50, 0x36, 0x28, 0x15, 0xdb, 0xf6, 0xbd, 0x04, 0xe5,
+  0xa1, 0x11, 0x05, 0x55, 0x83, 0x02, 0x0d, 0xc6, 0xf2, 0x61, 0xa2, 0x62, 0xa3, 0x27, 0x89, 0x6d,
+  0xa6, 0x84, 0xb8, 0x8d, 0x55, 0x10, 0xdd, 0x59, 0xb6, 0xfe, 0x0e, 0x01, 0x4f, 0x8b, 0x9e, 0x9b,
+  0x33, 0x67, 0x44, 0x97, 0x82, 0x1c, 0xd0, 0x31, 0xee, 0x1e, 0x1e, 0xff, 0x39, 0x9f, 0xe3, 0x99,
+  0x9f, 0x17, 0x7f, 0xdf, 0x7b, 0xf3, 0x76, 0xef, 0x27, 0x3a, 0xd9, 0x6d, 0x3b, 0xbb, 0x3d, 0x3c,
+  0xd3, 0x0d, 0x53, 0xc9, 0x63, 0xfe, 0xac, 0x67, 0x97, 0x43, 0x0c, 0x0f, 0xd6, 0x83, 0xb8, 0x7d,
+  0x87, 0x47, 0x81, 0x3e, 0xf6, 0xc6, 0xbb, 0xce, 0x98, 0xe0, 0x24, 0xee, 0x67, 0xcc, 0x4f, 0x6b,
+  0x53, 0xaf, 0x71, 0xd5, 0xa5, 0x1b, 0x2f, 0x66, 0xae, 0xc7, 0xa8, 0x7a, 0xb2, 0xec, 0x5e, 0xdf,
+  0x19, 0x0c, 0x47, 0xe3, 0xe3, 0x27, 0x4f, 0x9f, 0x3d, 0xff, 0xe6, 0xdb, 0x17, 0x7f, 0xff, 0xc7,
+  0xab, 0xd7, 0x6f, 0xde, 0xfe, 0xf7, 0xbb, 0x93, 0xf7, 0xdf, 0xff, 0xf0, 0xe3, 0x3f, 0xff, 0xf5,
+  0x93, 0xeb, 0xf9, 0x50, 0x26, 0x4c, 0x67, 0xd1, 0x87, 0xf3, 0x79, 0x92, 0x2e, 0x7e, 0x85, 0x42,
+  0x79, 0x79, 0xb1, 0xba, 0xbc, 0xfa, 0x4d, 0xbd, 0xd8, 0xd3, 0xc5, 0x27, 0xd3, 0x9a, 0x33, 0x9a,
+  0xc8, 0x9b, 0xf3, 0x03, 0x62, 0x21, 0xa8, 0xee, 0xbf, 0x35, 0xcb, 0xbb, 0xfb, 0xe6, 0xb0, 0x3e,
+  0x8e, 0xf0, 0x5c, 0x48, 0x56, 0xf5, 0x5a, 0xfc, 0xde, 0x3e, 0x3a, 0xac, 0x20, 0xaf, 0xbb, 0x53,
+  0xae, 0xe2, 0xdc, 0x83, 0xa8, 0x02, 0x6d, 0x47, 0xfc, 0x14, 0xc3, 0xde, 0x5e, 0x2d, 0x18, 0xe3,
+  0x1d, 0x92, 0x1c, 0x5c, 0xde, 0xe3, 0x5d, 0xb5, 0xbf, 0x84, 0x12, 0x07, 0x77, 0xa5, 0xa4, 0xc4,
+  0x60, 0x2e, 0x68, 0xf8, 0x2e, 0x34, 0xb0, 0x93, 0xd3, 0xdc, 0xc2, 0x93, 0x05, 0x0a, 0x2c, 0x54,
+  0x46, 0x7b, 0x96, 0x9c, 0x7c, 0x6b, 0x0f, 0xd1, 0xe5, 0x81, 0xa7, 0x27, 0xa4, 0x68, 0xa2, 0x01,
+  0x91, 0x85, 0xaf, 0x4d, 0xb6, 0xc4, 0xdd, 0xc9, 0x5b, 0x52, 0xf8, 0x87, 0xa5, 0x7c, 0x25, 0xfe,
+  0x8e, 0xf6, 0xb5, 0xa2, 0x00, 0x1a, 0xa3, 0xe8, 0xe3, 0xeb, 0xea, 0xba, 0x60, 0xc0, 0xdf, 0x29,
+  0x6f, 0x63, 0xde, 0xdf, 0xc7, 0x72, 0xfa, 0x82, 0x65, 0x95, 0x62, 0x39, 0x1c, 0x9e, 0x28, 0xc6,
+  0xfb, 0x1d, 0x35, 0x17, 0xd7, 0x25, 0x95, 0x3d, 0xc4, 0xd5, 0xac, 0xa7, 0xa4, 0x8f, 0x15, 0x14,
+  0x17, 0x4c, 0x33, 0xe4, 0xc8, 0x23, 0xcd, 0x54, 0x6f, 0x70, 0xe5, 0x4b, 0x38, 0x71, 0xf1, 0xae,
+  0x84, 0xf9, 0x52, 0xf2, 0x81, 0x7f, 0x8b, 0x80, 0x5f, 0xf3, 0x58, 0x4a, 0xb5, 0x7f, 0xa8, 0x76,
+  0xaa, 0x3c, 0xbe, 0x63, 0x78, 0xab, 0x1e, 0x7f, 0xc5, 0xbc, 0xe2, 0x0a, 0x79, 0x9c, 0xe2, 0xc5,
+  0xd7, 0xd0, 0xea, 0xa7, 0x59, 0x86, 0x27, 0xa4, 0x69, 0x33, 0x6b, 0x5b, 0x72, 0x90, 0xf1, 0x71,
+  0x06, 0x37, 0x08, 0x20, 0xe2, 0xbb, 0xe9, 0x50, 0xdf, 0xd0, 0x93, 0x72, 0xed, 0x37, 0x96, 0xa5,
+  0x39, 0x56, 0xf8, 0x42, 0xeb, 0x2c, 0x01, 0x4e, 0xa0, 0x43, 0x7a, 0x8c, 0xe2, 0x07, 0x78, 0xef,
+  0x81, 0x74, 0xf6, 0xd2, 0xb2, 0xfc, 0xa9, 0xb8, 0x25, 0x2f, 0xae, 0x15, 0x54, 0x97, 0x49, 0x3e,
+  0x8b, 0x42, 0xe9, 0x99, 0x5b, 0xe5, 0xa3, 0x07, 0x82, 0x80, 0xea, 0xee, 0x5c, 0x58, 0x54, 0xc8,
+  0x27, 0x96, 0x3c, 0xcd, 0xfb, 0x6b, 0xf9, 0x5d, 0xbc, 0xdb, 0x3c, 0xcb, 0xf0, 0x79, 0x7a, 0xdb,
+  0xf4, 0x7b, 0xfa, 0xe2, 0xf8, 0xdd, 0xc9, 0xf3, 0xf7, 0x38, 0xfb, 0x7e, 0x5d, 0xfc, 0x96, 0x5d,
+  0x8d, 0x2f, 0x47, 0xd3, 0xd0, 0x2e, 0x2e, 0x82, 0x95, 0x99, 0xf7, 0x3e, 0x24, 0x4e, 0xff, 0x7c,
+  0xe6, 0xb3, 0xc1, 0x7c, 0xe9, 0x0e, 0x63, 0x9d, 0x34, 0x22, 0x36, 0x56, 0x08, 0x2d, 0xde, 0x23,
+  0x8f, 0x32, 0xe5, 0xe2, 0x5c, 0xc1, 0x96, 0xbc, 0x70, 0x1c, 0xb7, 0x9d, 0xca, 0xec, 0x59, 0x9b,
+  0x48, 0xe2, 0xe4, 0x0f, 0x8d, 0x6a, 0xb9, 0x8e, 0x55, 0x4e, 0x17, 0xfc, 0xf3, 0x0c, 0x08, 0x22,
+  0x67, 0x91, 0x68, 0x8f, 0x02, 0x9c, 0x40, 0x82, 0xe7, 0x6a, 0xfe, 0x88, 0x34, 0x84, 0x2a, 0x26,
+  0x88, 0xda, 0xb4, 0xb9, 0x61, 0xde, 0x90, 0x86, 0xd6, 0xe6, 0x0d, 0xbf, 0xa3, 0x72, 0xab, 0x94,
+  0xc2, 0x10, 0x9f, 0x1e, 0x3d, 0xd2, 0x1c, 0xfc, 0xe3, 0x0c, 0x40, 0xa2, 0xb4, 0xc6, 0x56, 0x75,
+  0x58, 0x05, 0x40, 0xc8, 0xff, 0x14, 0x2d, 0xe1, 0x6d, 0xaa, 0xb0, 0xc6, 0x7d, 0x8a, 0xcf, 0xa0,
+  0xf2, 0x25, 0x3e, 0xad, 0x30, 0x66, 0xd9, 0x62, 0x57, 0x9c, 0x42, 0x91, 0x2a, 0x13, 0xc7, 0x29,
+  0x70, 0x99, 0x8c, 0xf3, 0x04, 0x20, 0x9e, 0x5f, 0x2e, 0xc0, 0xe9, 0x10, 0xb6, 0xd3, 0x85, 0x5e,
+  0xdf, 0x2d, 0xe4, 0xf9, 0x90, 0x8a, 0xe2, 0x22, 0x8d, 0xaf, 0xe6, 0x69, 0x60, 0xf0, 0x71, 0x9d,
+  0x26, 0xe9, 0x12, 0x8b, 0x20, 0xda, 0x24, 0x57, 0x4a, 0xc7, 0xa7, 0x65, 0xab, 0x91, 0x60, 0x58,
+  0x9b, 0x89, 0xf8, 0x50, 0x3e, 0x55, 0x11, 0xa4, 0x76, 0x6f, 0x2e, 0xdd, 0x95, 0xdd, 0x51, 0xf5,
+  0x53, 0x01, 0x0b, 0xe7, 0xfe, 0x6c, 0xa4, 0xbe, 0xd2, 0x7a, 0x56, 0xe7, 0x8e, 0xa6, 0x10, 0xea,
+  0x42, 0x6d, 0x08, 0x8d, 0x35, 0x14, 0xf2, 0xed, 0xf3, 0x37, 0xcf, 0xdf, 0x1d, 0xbf, 0xff, 0xee,
+  0x1d, 0xea, 0xc4, 0xbc, 0xec, 0x79, 0x03, 0xd7, 0x19, 0x7a, 0xf4, 0xa7, 0x87, 0xec, 0x81, 0x63,
+  0x8e, 0x18, 0xff, 0xd3, 0x43, 0x16, 0x73, 0x2d, 0x6b, 0xcc, 0xff, 0xa4, 0x4d, 0x2f, 0xe8, 0xdb,
+  0xbd, 0x5e, 0x40, 0xed, 0xb6, 0x6b, 0xf5, 0x07, 0xb6, 0xd7, 0x3b, 0x53, 0xfe, 0x5a, 0xc4, 0xb9,
+  0xac, 0x40, 0x2b, 0x91, 0xf9, 0x46, 0x0e, 0xfc, 0x7a, 0x24, 0x0c, 0x5e, 0x4a, 0xbd, 0x68, 0xce,
+  0x81, 0x82, 0x76, 0x7d, 0x10, 0x0b, 0x5e, 0x8f, 0xee, 0x88, 0x69, 0x40, 0x48, 0x0d, 0xfc, 0xf5,
+  0x15, 0xfd, 0xa9, 0x29, 0xfa, 0x47, 0x7f, 0x9d, 0xc6, 0xd1, 0x7e, 0x11, 0x38, 0x4f, 0x17, 0x62,
+  0xd2, 0xb4, 0x69, 0xda, 0xa9, 0x29, 0x98, 0x10, 0xfe, 0x02, 0x18, 0x0d, 0x24, 0x07, 0x84, 0x48,
+  0xad, 0x30, 0x77, 0x1e, 0x57, 0x0a, 0xc1, 0x1b, 0x5d, 0x0f, 0xc4, 0x5c, 0xe6, 0x9a, 0x56, 0xd5,
+  0x0d, 0x08, 0xd6, 0x75, 0x9d, 0xcb, 0x94, 0xe9, 0xe6, 0xc5, 0x4b, 0x31, 0x4b, 0x31, 0xe6, 0x4d,
+  0xb6, 0xf9, 0x2c, 0x45, 0x88, 0x47, 0x9a, 0x85, 0x2b, 0x0a, 0xfc, 0xf8, 0x50, 0x1b, 0x42, 0x26,
+  0x50, 0x72, 0x2c, 0x5e, 0x2d, 0x50, 0x7d, 0x3b, 0xd2, 0xc6, 0x66, 0xb9, 0x5e, 0xbf, 0x79, 0x2e,
+  0xe7, 0x74, 0x81, 0xaa, 0x5e, 0x65, 0x82, 0x72, 0x36, 0x08, 0x8e, 0xf8, 0x6d, 0xd5, 0x78, 0xe4,
+  0xc9, 0xa4, 0x0b, 0x7b, 0x94, 0x6b, 0x88, 0xc5, 0xcd, 0x36, 0x75, 0x28, 0xce, 0x9e, 0xd5, 0x91,
+  0x2f, 0x67, 0xea, 0x9d, 0xee, 0xdc, 0x5d, 0x88, 0x48, 0x7e, 0xb4, 0x1e, 0x8a, 0x30, 0x95, 0xf3,
+  0xd4, 0x41, 0x01, 0xbf, 0x1e, 0x00, 0xd4, 0xd9, 0x8f, 0xbb, 0x1e, 0xd6, 0x1d, 0xa5, 0xf2, 0xc5,
+  0x78, 0x45, 0x2e, 0xa1, 0x7d, 0x1a, 0x0e, 0x58, 0x0f, 0x50, 0xc4, 0x5d, 0xca, 0x8c, 0x80, 0xfd,
+  0x80, 0x5f, 0x76, 0x98, 0x43, 0x65, 0xcc, 0x50, 0xce, 0xbd, 0x41, 0x67, 0x97, 0xdb, 0x88, 0xa7,
+  0x86, 0xea, 0x30, 0x06, 0xa6, 0x30, 0x25, 0x39, 0xac, 0xf0, 0x49, 0xab, 0xf8, 0x9b, 0x43, 0xf8,
+  0xe2, 0xbb, 0x32, 0x3f, 0xaa, 0x22, 0x8a, 0xea, 0x79, 0xb5, 0xb8, 0x13, 0xc3, 0x6a, 0xe5, 0x4e,
+  0x19, 0xf1, 0xc4, 0x38, 0xc1, 0xcc, 0x5e, 0x5f, 0x05, 0xc3, 0x45, 0xe4, 0x1a, 0x08, 0xf2, 0xdb,
+  0xef, 0x34, 0xf6, 0x66, 0x67, 0x6e, 0x3e, 0xb3, 0xd7, 0x6f, 0x61, 0xe6, 0x7f, 0xc4, 0xad, 0x5b,
+  0xde, 0x84, 0x6f, 0x20, 0xc6, 0x4e, 0xad, 0x96, 0xe2, 0x8c, 0x74, 0x31, 0xab, 0x5f, 0x19, 0x7c,
+  0xee, 0xef, 0x6a, 0x11, 0x2f, 0x7f, 0xc0, 0x80, 0xf2, 0xcd, 0x83, 0x43, 0x4e, 0xe2, 0x94, 0x7a,
+  0xce, 0x3a, 0x55, 0x00, 0x22, 0x35, 0xf3, 0xc3, 0xf9, 0xcd, 0xc4, 0xdc, 0xb8, 0x25, 0x58, 0xe4,
+  0x67, 0x8d, 0x0e, 0xea, 0x69, 0x46, 0x79, 0x8a, 0x5b, 0x88, 0x2b, 0x2f, 0xea, 0x94, 0x27, 0xf4,
+  0x5a, 0x10, 0x5c, 0x37, 0xed, 0x43, 0xe6, 0x6f, 0xb3, 0xcf, 0xad, 0xe6, 0x51, 0x92, 0xbf, 0x6a,
+  0x1e, 0x79, 0x2f, 0xb1, 0xd0, 0x38, 0xcd, 0x0b, 0xac, 0x47, 0x3c, 0x9f, 0x2a, 0xe8, 0x3f, 0xc6,
+  0x7c, 0x83, 0xfb, 0x76, 0xbe, 0xd1, 0x2a, 0x8a, 0x07, 0x29, 0xf7, 0x11, 0x72, 0x20, 0x41, 0x54,
+  0x2a, 0x1e, 0x21, 0xeb, 0xee, 0xaa, 0x88, 0x53, 0x1e, 0x19, 0x97, 0x28, 0xab, 0xa5, 0xc9, 0x5d,
+  0x51, 0xd2, 0x88, 0x75, 0x94, 0x6b, 0x82, 0xef, 0xc0, 0x32, 0x6b, 0x19, 0x07, 0x89, 0x4e, 0xef,
+  0x1d, 0xce, 0x58, 0x46, 0x27, 0x87, 0x37, 0xd8, 0x10, 0xaf, 0x8a, 0xfe, 0x5f, 0x9a, 0x79, 0x30,
+  0x6e, 0x94, 0x70, 0x00, 0x00,
+};
+
+// favicon.png: 1057 bytes, 1057 as sent
+static const uint8_t webAsset_favicon_png[] PROGMEM = {
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7a, 0x7a,
+  0xf4, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
+  0x03, 0xdb, 0x49, 0x44, 0x41, 0x54, 0x58, 0x47, 0xc5, 0x97, 0x6b, 0x6c, 0x53, 0x65, 0x18, 0xc7,
+  0xff, 0x4f, 0xcf, 0x19, 0x82, 0x21, 0x20, 0x97, 0x2d, 0xbb, 0x74, 0xb6, 0x02, 0xad, 0x61, 0x23,
+  0x5c, 0x86, 0x92, 0x60, 0x4c, 0xd4, 0xd1, 0x8a, 0x19, 0x7e, 0x31, 0x2c, 0xca, 0x08, 0x09, 0xe1,
+  0x7e, 0x4b, 0x08, 0xb7, 0x20, 0x64, 0x12, 0x58, 0x54, 0x82, 0x8a, 0x21, 0x90, 0x09, 0x86, 0xa9,
+  0x03, 0x13, 0x3b, 0x63, 0x08, 0xea, 0x87, 0x29, 0xdb, 0x60, 0x5f, 0x90, 0x4b, 0x18, 0x97, 0x11,
+  0xd8, 0xd0, 0x41, 0xba, 0x8d, 0x8d, 0x4b, 0xc6, 0xd8, 0x8d, 0x61, 0xb7, 0xf5, 0x9c, 0xbe, 0xf8,
+  0x9e, 0xae, 0x87, 0x75, 0x6b, 0xcf, 0xdb, 0x6d, 0x35, 0xed, 0xd7, 0x3e, 0xef, 0xf3, 0xff, 0x9d,
+  0xe7, 0xf6, 0x3e, 0x2f, 0x21, 0xd2, 0xdf, 0x24, 0xc7, 0x58, 0xc9, 0x47, 0x59, 0x60, 0xc8, 0x24,
+  0x60, 0x16, 0x23, 0x58, 0x09, 0x78, 0x89, 0x1f, 0x67, 0x40, 0x1b, 0x31, 0xd4, 0x31, 0xe0, 0x1a,
+  0x08, 0xe5, 0xaa, 0x89, 0xfd, 0x01, 0xf7, 0xe9, 0xf6, 0x48, 0x5c, 0x93, 0xd0, 0x28, 0x65, 0x9e,
+  0x5d, 0x92, 0xe9, 0x63, 0x22, 0xe4, 0x00, 0x34, 0x4a, 0x68, 0xaf, 0x19, 0x30, 0x0f, 0x63, 0x28,
+  0x52, 0x15, 0xf6, 0x05, 0xee, 0x9d, 0xa9, 0x31, 0x3a, 0x13, 0x1e, 0xc0, 0x3c, 0x77, 0x94, 0x2c,
+  0x8d, 0xfe, 0x14, 0x84, 0x8d, 0x00, 0xe2, 0x22, 0x13, 0x1e, 0x60, 0xe5, 0x05, 0xc3, 0x21, 0x45,
+  0xed, 0xdc, 0x85, 0xc6, 0x0b, 0x9e, 0x50, 0x3e, 0x42, 0x03, 0x98, 0x9d, 0x36, 0x59, 0xc2, 0xaf,
+  0x20, 0xa4, 0x0f, 0x51, 0x38, 0xf8, 0x18, 0x43, 0x95, 0xa2, 0xe2, 0x03, 0x34, 0x96, 0xdd, 0xee,
+  0xef, 0x6f, 0x20, 0x80, 0x25, 0x33, 0x43, 0x82, 0x54, 0x42, 0x84, 0x89, 0x51, 0x11, 0xef, 0x75,
+  0xc2, 0x18, 0x9a, 0x55, 0xa8, 0xf3, 0x51, 0x5f, 0x7e, 0xb5, 0xaf, 0xdf, 0x60, 0x00, 0xb3, 0xd3,
+  0x26, 0x49, 0x38, 0x1f, 0x6d, 0xf1, 0x80, 0xa0, 0x06, 0xa1, 0xe2, 0x8d, 0xbe, 0x91, 0x78, 0x0e,
+  0xe0, 0xcf, 0x79, 0x45, 0xb8, 0xb0, 0x4f, 0x18, 0x37, 0x06, 0x8e, 0x37, 0x33, 0xf0, 0xc2, 0x88,
+  0xe0, 0x72, 0xf0, 0x74, 0xf5, 0xa0, 0xa6, 0xb6, 0x11, 0x37, 0xfe, 0x76, 0xc3, 0xe7, 0x63, 0xe2,
+  0xa0, 0x69, 0xe9, 0xe8, 0x7c, 0x3d, 0x50, 0x13, 0x3a, 0x80, 0x6c, 0x71, 0xee, 0x07, 0x61, 0x6b,
+  0xc8, 0x42, 0x21, 0xc2, 0xf5, 0xd2, 0x02, 0x4c, 0x9d, 0xf2, 0x72, 0x58, 0x81, 0x86, 0xfb, 0x4d,
+  0xc8, 0x3b, 0xf0, 0x23, 0x8e, 0x9f, 0x28, 0x8d, 0x04, 0xe2, 0x6b, 0xa5, 0xbe, 0x6c, 0x1b, 0x37,
+  0xf4, 0x03, 0xa4, 0xcc, 0xb3, 0xcb, 0x71, 0xa6, 0x9b, 0xe1, 0xaa, 0xdd, 0x9c, 0x14, 0x8f, 0xda,
+  0xf3, 0x3f, 0x89, 0x1d, 0xff, 0xe7, 0x30, 0xef, 0xc0, 0x71, 0x7c, 0x76, 0x48, 0x68, 0xeb, 0x55,
+  0xbc, 0xbe, 0x69, 0xbc, 0x45, 0x35, 0x00, 0xc9, 0xe2, 0xf8, 0x9e, 0x88, 0x96, 0x87, 0x53, 0x48,
+  0xb7, 0x5b, 0x51, 0x59, 0x72, 0x54, 0xff, 0xdb, 0xeb, 0x55, 0x50, 0x59, 0x75, 0x07, 0x71, 0x71,
+  0x32, 0xa6, 0xda, 0x2c, 0x41, 0x69, 0x51, 0x54, 0x15, 0xe9, 0x99, 0xcb, 0xe1, 0xbe, 0xfb, 0xc0,
+  0x10, 0x98, 0x31, 0xf6, 0x83, 0x5a, 0x7f, 0x7a, 0x05, 0x61, 0x92, 0x63, 0xac, 0xec, 0xc3, 0x03,
+  0xa3, 0x21, 0x33, 0xed, 0x55, 0x2b, 0xae, 0x9d, 0x7a, 0x0e, 0xf0, 0xf0, 0x51, 0x0b, 0x52, 0xe7,
+  0x2c, 0xf2, 0x07, 0x2f, 0x71, 0x22, 0xca, 0x5c, 0x5f, 0xc2, 0xf6, 0x8a, 0x59, 0x17, 0xdc, 0x9c,
+  0x77, 0x18, 0xf9, 0xc7, 0x7e, 0x13, 0x44, 0x8c, 0x79, 0x14, 0x13, 0x92, 0x48, 0xb2, 0x3a, 0x73,
+  0x08, 0x70, 0x19, 0x59, 0x1b, 0x01, 0xf0, 0x73, 0x2b, 0x73, 0xb2, 0x70, 0x64, 0xef, 0x26, 0xdd,
+  0xc5, 0xbe, 0xc3, 0x45, 0xd8, 0xf5, 0x55, 0xa1, 0x30, 0x65, 0x0c, 0x58, 0x4c, 0x92, 0xc5, 0x59,
+  0x40, 0x84, 0x95, 0xc3, 0x01, 0xc8, 0x5e, 0xf0, 0x16, 0x8a, 0xf2, 0x73, 0x75, 0x17, 0x1b, 0x72,
+  0x0f, 0xe2, 0xa8, 0xab, 0x58, 0x0c, 0xc0, 0xf0, 0x1d, 0xc9, 0x16, 0xe7, 0x65, 0x10, 0x66, 0x0f,
+  0x15, 0x40, 0x92, 0x4c, 0x38, 0xf1, 0xed, 0x6e, 0xbc, 0xef, 0x98, 0xab, 0xb9, 0x68, 0x6e, 0x69,
+  0x47, 0x5a, 0xe6, 0x32, 0xb4, 0xb6, 0x77, 0x0a, 0x01, 0xc0, 0x70, 0x85, 0xa7, 0xa0, 0x99, 0x80,
+  0x09, 0x83, 0x01, 0xe0, 0xbd, 0x7f, 0xf2, 0xcf, 0xb3, 0x30, 0x99, 0x08, 0xb3, 0xa7, 0xdb, 0x61,
+  0xef, 0xcd, 0x7f, 0x4b, 0x5b, 0x07, 0x16, 0xae, 0xde, 0x83, 0xbf, 0x2a, 0x78, 0x43, 0x89, 0x7f,
+  0x0c, 0x78, 0x4c, 0xb2, 0xd5, 0xa9, 0xf0, 0x46, 0x18, 0x0c, 0x40, 0x28, 0x5b, 0xc6, 0x18, 0xf6,
+  0x7d, 0x53, 0x84, 0xbd, 0xf9, 0x2e, 0x74, 0x75, 0xf7, 0x88, 0xd5, 0xfd, 0x16, 0x6a, 0xd4, 0x00,
+  0x02, 0x8a, 0x37, 0xff, 0xa9, 0xc5, 0xfc, 0x25, 0x3b, 0xd0, 0xd4, 0xdc, 0x1a, 0x09, 0x84, 0x3a,
+  0xa4, 0x14, 0x3c, 0x6e, 0xed, 0xc0, 0x82, 0xa5, 0x3b, 0x41, 0x44, 0x48, 0xb3, 0x59, 0xb0, 0x67,
+  0xcb, 0x52, 0xa4, 0x26, 0x27, 0xe8, 0x82, 0xbf, 0x97, 0x9e, 0x43, 0xf6, 0x9a, 0x3c, 0x21, 0x80,
+  0x3f, 0x05, 0xc3, 0x2c, 0x42, 0xae, 0x32, 0x33, 0x6d, 0x32, 0x2a, 0x8a, 0x8f, 0xe8, 0x82, 0xaa,
+  0xea, 0x43, 0x62, 0x46, 0x36, 0xda, 0x3a, 0x04, 0x85, 0xa8, 0x15, 0x61, 0x14, 0xda, 0x90, 0x2b,
+  0x37, 0x5c, 0xfa, 0x19, 0x89, 0xf1, 0xe3, 0x75, 0x88, 0xd7, 0xb2, 0xd6, 0xe2, 0xfa, 0x2d, 0xb7,
+  0x61, 0x14, 0x18, 0x6f, 0xc3, 0x68, 0x0c, 0x22, 0xde, 0x8a, 0x4d, 0x95, 0x27, 0x31, 0x66, 0xf4,
+  0x8b, 0xba, 0xe0, 0x8c, 0x77, 0x57, 0xa1, 0xfa, 0x76, 0xbd, 0x31, 0x00, 0x1f, 0x44, 0xc3, 0x1d,
+  0xc5, 0x5c, 0x61, 0xfb, 0xba, 0x8f, 0xf0, 0xf9, 0xf6, 0x15, 0xba, 0xd8, 0xbf, 0x9e, 0x2e, 0x24,
+  0xcc, 0x5c, 0x88, 0xee, 0x1e, 0xaf, 0x01, 0x40, 0xef, 0x28, 0xe6, 0x16, 0x83, 0xbd, 0x8c, 0x7a,
+  0xbc, 0x5e, 0x5c, 0xb8, 0x52, 0xad, 0x39, 0x4f, 0x49, 0x8c, 0xc7, 0x14, 0x6b, 0x72, 0x90, 0x50,
+  0x81, 0xab, 0x18, 0xeb, 0x73, 0x0f, 0x0a, 0xc2, 0x1f, 0xb8, 0x8c, 0x34, 0x2f, 0xc6, 0xd7, 0x71,
+  0x6a, 0x72, 0x3c, 0xdc, 0xe7, 0x84, 0x57, 0xac, 0x26, 0x58, 0x55, 0x53, 0x87, 0x77, 0x3e, 0xdc,
+  0x22, 0x9a, 0x84, 0xc1, 0xd7, 0x31, 0x3f, 0x28, 0x5a, 0x48, 0xaa, 0xcb, 0x0b, 0x07, 0x7c, 0x69,
+  0xdf, 0x4f, 0xf4, 0x74, 0x75, 0xe3, 0xd8, 0x2f, 0x25, 0xf8, 0x64, 0x7f, 0x21, 0x3a, 0x9e, 0x3c,
+  0x35, 0x6e, 0x41, 0x86, 0x7e, 0x0b, 0x09, 0x37, 0x17, 0xac, 0x64, 0x49, 0x09, 0xe3, 0xf1, 0xde,
+  0xdb, 0x73, 0x30, 0x72, 0xe4, 0x88, 0x20, 0xe7, 0x8a, 0xa2, 0xa2, 0xae, 0xe1, 0x21, 0x2e, 0x5e,
+  0xad, 0xc6, 0x93, 0xa7, 0x21, 0x37, 0xef, 0x60, 0x98, 0x70, 0x2b, 0x99, 0x66, 0x15, 0xd3, 0xa5,
+  0x34, 0xc0, 0x19, 0xd3, 0xb5, 0x3c, 0x00, 0x11, 0xd3, 0x87, 0x89, 0x0e, 0x11, 0xcb, 0xa7, 0x59,
+  0xdf, 0xb2, 0x89, 0xd9, 0xe3, 0xb4, 0x7f, 0x23, 0xfd, 0x4f, 0xcf, 0xf3, 0x67, 0xd6, 0xb9, 0xd8,
+  0x7a, 0x8d, 0x5c, 0x98, 0x68, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60,
+  0x82,
+};
+
+// gears.png: 5430 bytes, 5430 as sent
+static const uint8_t webAsset_gears_png[] PROGMEM = {
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x69, 0x71,
+  0xde, 0x00, 0x00, 0x00, 0x04, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0x08, 0x7c, 0x08, 0x64,
+  0x88, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x01, 0xbb, 0x00, 0x00, 0x01,
+  0xbb, 0x01, 0x3a, 0xec, 0xe3, 0xe2, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f,
+  0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x77, 0x77, 0x77, 0x2e, 0x69, 0x6e, 0x6b, 0x73, 0x63,
+  0x61, 0x70, 0x65, 0x2e, 0x6f, 0x72, 0x67, 0x9b, 0xee, 0x3c, 0x1a, 0x00, 0x00, 0x14, 0xb3, 0x49,
+  0x44, 0x41, 0x54, 0x78, 0x9c, 0xc5, 0x9b, 0x77, 0x78, 0x54, 0x55, 0xde, 0xc7, 0x3f, 0x67, 0x26,
+  0x95, 0x24, 0x64, 0x12, 0x02, 0x49, 0x20, 0x81, 0x40, 0x42, 0x80, 0x14, 0x02, 0x48, 0x0b, 0x4d,
+  0x44, 0x50, 0x17, 0x11, 0x11, 0x41, 0x5c, 0x0b, 0x22, 0x88, 0xeb, 0x8b, 0x0a, 0xf6, 0x8a, 0x4b,
+  0x11, 0xdd, 0x15, 0xd4, 0x7d, 0x2d, 0xac, 0xe8, 0xee, 0xb2, 0xac, 0x2b, 0x2a, 0x4a, 0xb1, 0xa0,
+  0x20, 0xbd, 0x08, 0x48, 0x91, 0x90, 0x84, 0x40, 0x80, 0x14, 0x48, 0x21, 0xbd, 0xd7, 0x99, 0xcc,
+  0xcc, 0xef, 0xfd, 0xe3, 0x26, 0x93, 0x36, 0x69, 0xb4, 0xf7, 0xfb, 0x3c, 0xf7, 0x79, 0x66, 0xce,
+  0x39, 0xbf, 0xf6, 0xbd, 0xf7, 0x9c, 0x7b, 0xce, 0xef, 0x9c, 0x8b, 0x88, 0x70, 0xad, 0x2f, 0xa0,
+  0x17, 0xf0, 0x37, 0xa0, 0x18, 0x90, 0x16, 0xae, 0x52, 0x60, 0x35, 0xd0, 0xf7, 0x7a, 0xf8, 0xd0,
+  0xde, 0x4b, 0xd5, 0x3a, 0x7c, 0x4d, 0xa1, 0x94, 0xda, 0x05, 0xdc, 0xea, 0xe0, 0xec, 0x2e, 0x7a,
+  0x27, 0x57, 0x65, 0xaf, 0x8d, 0xb5, 0xa6, 0x9a, 0x9a, 0xea, 0x32, 0x80, 0xdf, 0x45, 0x64, 0xe8,
+  0x35, 0x77, 0xa2, 0x9d, 0xb8, 0xe6, 0x04, 0x28, 0xa5, 0x42, 0x80, 0xf3, 0x9e, 0x3d, 0xc2, 0x54,
+  0xc4, 0xf4, 0x3f, 0xa3, 0x94, 0xae, 0x85, 0x96, 0xc2, 0x99, 0xad, 0xab, 0x28, 0x4c, 0x39, 0x01,
+  0x70, 0x93, 0x88, 0x9c, 0xbc, 0xa6, 0x8e, 0xb4, 0x13, 0x2d, 0x79, 0xd7, 0x2a, 0x94, 0x06, 0x97,
+  0x16, 0xaa, 0x43, 0x00, 0xe5, 0xea, 0xd5, 0xa3, 0x95, 0xe0, 0x01, 0x14, 0x9d, 0xbc, 0x7a, 0xd4,
+  0xfd, 0x09, 0x6d, 0xc1, 0x8e, 0x93, 0x52, 0x4a, 0x7f, 0x25, 0x3e, 0xb6, 0x17, 0x1d, 0x22, 0x40,
+  0x29, 0xe5, 0xa0, 0x94, 0x7a, 0x11, 0x48, 0x06, 0x95, 0xad, 0x94, 0xfa, 0x48, 0x29, 0xd5, 0xbd,
+  0x49, 0xb3, 0x2e, 0x57, 0xe0, 0x47, 0x23, 0x19, 0xa5, 0x94, 0x8f, 0x52, 0xea, 0x5d, 0x50, 0x59,
+  0xa0, 0x2e, 0x2a, 0xa5, 0xde, 0x68, 0x85, 0xf0, 0xab, 0x42, 0xbb, 0x09, 0x50, 0x4a, 0x39, 0x00,
+  0x5f, 0x03, 0x2b, 0xf5, 0x8e, 0xce, 0x41, 0x4e, 0x6e, 0x86, 0xce, 0xc0, 0x53, 0xc0, 0x7e, 0xa5,
+  0x54, 0x6f, 0xa5, 0xd4, 0x7d, 0x4a, 0xa9, 0xbd, 0xc0, 0x17, 0x00, 0xce, 0x1e, 0x6d, 0xf3, 0xe0,
+  0xec, 0xe1, 0x53, 0xf7, 0xf3, 0x63, 0xa5, 0xd4, 0x61, 0xa5, 0xd4, 0x43, 0x4a, 0xa9, 0x00, 0x60,
+  0x0f, 0xf0, 0xbc, 0xa3, 0x6b, 0x67, 0x2f, 0xbd, 0x93, 0x4b, 0x0f, 0x60, 0x39, 0xf0, 0xdd, 0xf5,
+  0x20, 0xa1, 0x5d, 0x63, 0x80, 0x52, 0xca, 0x11, 0x2d, 0xf8, 0xe9, 0x2e, 0x9e, 0x7e, 0x44, 0xde,
+  0xbb, 0x04, 0x27, 0x57, 0x4f, 0x12, 0xb7, 0xff, 0x8d, 0x82, 0xe4, 0xe3, 0xa0, 0x8d, 0xea, 0x0a,
+  0xc0, 0xa9, 0x93, 0x41, 0xfc, 0x22, 0x26, 0xaa, 0xc0, 0xe1, 0xf7, 0xa2, 0x74, 0x6d, 0x3c, 0xbd,
+  0x22, 0x64, 0xfc, 0xfe, 0x1d, 0x59, 0x71, 0x3b, 0x30, 0x96, 0x17, 0xd8, 0x4a, 0x01, 0x65, 0x08,
+  0x8c, 0x24, 0xec, 0xae, 0x97, 0xb0, 0xd4, 0x18, 0x39, 0xbd, 0x79, 0x39, 0x15, 0x05, 0x69, 0x00,
+  0x3b, 0x81, 0xa9, 0x22, 0x52, 0x7d, 0x65, 0xe1, 0xda, 0x89, 0xad, 0x2d, 0x02, 0x6a, 0x83, 0xff,
+  0x06, 0x98, 0x56, 0x17, 0xbc, 0xb3, 0xbb, 0x76, 0x77, 0xc5, 0x6a, 0xe1, 0xfc, 0x8e, 0x8f, 0xc9,
+  0x4f, 0x3a, 0x4a, 0xe7, 0xee, 0xfd, 0xf0, 0x8f, 0xbc, 0x8d, 0x2e, 0xc1, 0xc3, 0xdb, 0x0e, 0xbc,
+  0x09, 0x44, 0xac, 0x14, 0xa6, 0xfe, 0x4e, 0x76, 0xfc, 0x0e, 0x8a, 0xd3, 0x13, 0xf0, 0x0a, 0x1a,
+  0x44, 0xff, 0x3f, 0x3c, 0x8b, 0x4e, 0xef, 0x08, 0x40, 0x4d, 0x55, 0x69, 0x43, 0x12, 0x76, 0xa1,
+  0x91, 0x50, 0xd5, 0xe1, 0x68, 0xed, 0xc5, 0xd7, 0x1a, 0x01, 0xb5, 0xc1, 0x7f, 0x0b, 0xdc, 0xdd,
+  0x34, 0xf8, 0x26, 0x21, 0x50, 0xfb, 0x00, 0x5c, 0x03, 0xd8, 0xd7, 0xd5, 0x84, 0x84, 0xdd, 0xc0,
+  0x5d, 0xd7, 0x82, 0x84, 0xb6, 0x08, 0xd8, 0x00, 0xdc, 0xd7, 0x7a, 0xf0, 0x6d, 0xc3, 0x6a, 0xa9,
+  0xc1, 0x58, 0x96, 0x8f, 0x58, 0xcc, 0x38, 0xb9, 0x19, 0x70, 0x70, 0x71, 0xe7, 0x4a, 0x08, 0x6b,
+  0x42, 0xc2, 0x0e, 0x11, 0xb9, 0xfd, 0x8a, 0x1c, 0x6a, 0x80, 0x16, 0x09, 0x50, 0x4a, 0x45, 0x00,
+  0xf1, 0x2e, 0x9e, 0xbe, 0x44, 0xde, 0xbb, 0xb4, 0x43, 0xc1, 0x5b, 0x4c, 0x55, 0xe4, 0x9c, 0xdd,
+  0x47, 0x41, 0xd2, 0x6f, 0x54, 0x97, 0xe4, 0x60, 0xaa, 0x28, 0xa2, 0xa1, 0x1d, 0xa5, 0xd3, 0xe3,
+  0xe1, 0x1b, 0x42, 0x97, 0xe0, 0xe1, 0x74, 0x09, 0x19, 0x81, 0x4b, 0xe7, 0x6e, 0xed, 0xd6, 0x5d,
+  0x53, 0x55, 0x4a, 0xfc, 0xe6, 0x65, 0x54, 0x16, 0xa4, 0x03, 0x8c, 0x11, 0x91, 0x43, 0xed, 0x16,
+  0xb6, 0x83, 0xd6, 0x08, 0x58, 0x01, 0xbc, 0x1e, 0x3a, 0xe9, 0x49, 0xba, 0x0d, 0xb8, 0xb9, 0x5d,
+  0xca, 0xaa, 0x4b, 0x73, 0xc9, 0x8c, 0xd9, 0x4a, 0xde, 0xd9, 0x7d, 0x98, 0x4d, 0xda, 0x38, 0xe5,
+  0xe4, 0xa8, 0xe8, 0xe5, 0xe7, 0x4c, 0xef, 0x1e, 0x2e, 0x38, 0x39, 0x2a, 0xb2, 0xf2, 0x4d, 0xa4,
+  0xe7, 0x98, 0xc8, 0x2d, 0xac, 0xa9, 0xb3, 0x44, 0xd7, 0x7e, 0x63, 0xe8, 0x15, 0x3d, 0xab, 0xdd,
+  0x44, 0x14, 0xa6, 0x9c, 0xe0, 0xcc, 0xd6, 0x95, 0x00, 0xab, 0x45, 0xe4, 0xa9, 0x76, 0x09, 0xb5,
+  0x00, 0x87, 0x56, 0xea, 0x76, 0x02, 0xaf, 0x67, 0x27, 0xec, 0xc6, 0xa7, 0xef, 0x48, 0x74, 0x0e,
+  0xce, 0xad, 0x2a, 0xca, 0x4f, 0x3a, 0x4a, 0xd2, 0xae, 0xd5, 0x98, 0x4d, 0xd5, 0xb8, 0xb9, 0xea,
+  0x99, 0x3f, 0xc3, 0x97, 0xff, 0xb9, 0xd7, 0x8f, 0xf0, 0x3e, 0x9d, 0xd0, 0xd9, 0x79, 0xd9, 0x9e,
+  0x3a, 0x5f, 0xc1, 0x77, 0xfb, 0x0a, 0xf9, 0x64, 0x63, 0x0e, 0xb9, 0xe7, 0x0e, 0x52, 0x90, 0x74,
+  0x84, 0xc0, 0xe1, 0x33, 0x09, 0x1c, 0x76, 0x4f, 0xab, 0x76, 0xc4, 0x62, 0x26, 0x2b, 0x7e, 0x47,
+  0x43, 0x1f, 0xaf, 0x0a, 0x6d, 0x8d, 0x01, 0x47, 0x81, 0xe1, 0x86, 0x80, 0x08, 0xc2, 0xa6, 0xbe,
+  0x6c, 0x97, 0x04, 0xb1, 0x5a, 0xb8, 0x78, 0x68, 0x3d, 0x99, 0x31, 0x5b, 0xd1, 0xeb, 0x14, 0xaf,
+  0xcf, 0xed, 0xc1, 0xb3, 0x0f, 0xf8, 0x63, 0xf0, 0x68, 0x8d, 0xdb, 0x7a, 0xe4, 0x17, 0x9b, 0x59,
+  0xf0, 0x4e, 0x0a, 0xdf, 0xee, 0xd2, 0x5e, 0x83, 0x3e, 0xa1, 0xa3, 0x08, 0x9d, 0xb8, 0x00, 0x9d,
+  0x83, 0x53, 0x73, 0x5b, 0x16, 0x33, 0x67, 0xb7, 0xbd, 0x5f, 0x37, 0x7d, 0x4e, 0x04, 0x22, 0x44,
+  0xc4, 0xd2, 0x2e, 0x43, 0x2d, 0xa0, 0x2d, 0x02, 0xba, 0xa0, 0xbd, 0x76, 0x06, 0xf5, 0x1e, 0xf3,
+  0x30, 0x3d, 0x86, 0xdc, 0xd5, 0xac, 0xcd, 0xb9, 0xed, 0x1f, 0x90, 0x77, 0xfe, 0x10, 0xbe, 0xde,
+  0x8e, 0x7c, 0xf5, 0x56, 0x5f, 0x6e, 0x19, 0xea, 0xd9, 0xac, 0x8d, 0xd1, 0x64, 0x25, 0x2e, 0xa9,
+  0x12, 0x8b, 0x45, 0x88, 0x0a, 0x75, 0xc3, 0xd5, 0xb9, 0xf9, 0x23, 0xb1, 0x61, 0x67, 0x01, 0x4f,
+  0xbe, 0x93, 0x42, 0x41, 0x89, 0x19, 0xaf, 0x5e, 0x51, 0x84, 0x4d, 0x7d, 0xb5, 0xd9, 0x54, 0x3a,
+  0x27, 0x61, 0x0f, 0x17, 0x76, 0xaf, 0x01, 0x38, 0x07, 0x4c, 0x10, 0x91, 0xcb, 0x1d, 0x0b, 0xb7,
+  0x39, 0x5a, 0xbd, 0x4d, 0x22, 0x52, 0xa0, 0x94, 0x8a, 0x03, 0x06, 0x29, 0x3b, 0xcf, 0x71, 0x76,
+  0xfc, 0x4e, 0xf2, 0xce, 0x1f, 0xa2, 0x5f, 0x2f, 0x57, 0xf6, 0xae, 0x09, 0xc3, 0xdf, 0xa7, 0xfe,
+  0xae, 0xa5, 0xe7, 0x98, 0x78, 0x6b, 0x6d, 0x06, 0x47, 0x4f, 0x97, 0x93, 0x90, 0x52, 0x49, 0x8d,
+  0x59, 0x23, 0x5a, 0xaf, 0x53, 0x84, 0xf5, 0x71, 0x65, 0x58, 0x98, 0x3b, 0xaf, 0x3d, 0xda, 0x83,
+  0xe0, 0x00, 0x6d, 0x72, 0x37, 0x6b, 0x52, 0x17, 0xc6, 0xdf, 0xd4, 0x99, 0x71, 0xf3, 0x4f, 0x73,
+  0xfe, 0x52, 0x2c, 0xa9, 0x07, 0xff, 0x4b, 0x9f, 0x71, 0x8f, 0x34, 0x36, 0x58, 0xef, 0xc3, 0xb9,
+  0x6b, 0x11, 0x3c, 0xb4, 0xfd, 0x04, 0x74, 0x03, 0xd2, 0x74, 0x7a, 0x47, 0xa7, 0xe1, 0xf3, 0xd6,
+  0x28, 0x07, 0x17, 0x0f, 0x5b, 0x5d, 0x45, 0xde, 0x45, 0xe2, 0xbe, 0x7d, 0x1d, 0x27, 0xbd, 0x85,
+  0xa3, 0xeb, 0x22, 0x89, 0x0c, 0xe9, 0x64, 0xab, 0x5b, 0xb7, 0x35, 0x8f, 0x45, 0xef, 0x5d, 0xa4,
+  0xb4, 0xdc, 0x5c, 0x57, 0x74, 0x09, 0x38, 0x0e, 0x58, 0x80, 0xa1, 0x40, 0x30, 0x80, 0xab, 0x8b,
+  0x9e, 0x55, 0x0b, 0x7b, 0xb2, 0x60, 0x86, 0x1f, 0xaa, 0xf6, 0xad, 0xf8, 0x5b, 0x7c, 0x19, 0x63,
+  0x1e, 0x4b, 0xc0, 0x62, 0x15, 0xc2, 0xee, 0x7a, 0x19, 0xef, 0xde, 0x37, 0xd9, 0xf4, 0x5a, 0xcd,
+  0x46, 0x8e, 0xfe, 0xf3, 0x4f, 0x62, 0x31, 0x55, 0x0a, 0x10, 0x22, 0x22, 0xa9, 0x57, 0x4b, 0x40,
+  0x5b, 0x6b, 0x81, 0xf9, 0x80, 0xb3, 0x4f, 0xe8, 0xa8, 0x46, 0xc1, 0x03, 0xa4, 0xfe, 0xfa, 0x5f,
+  0x2c, 0xe6, 0x1a, 0x3e, 0x78, 0x21, 0xc8, 0x16, 0xbc, 0xd9, 0x22, 0x4c, 0x7b, 0xe1, 0x1c, 0x8f,
+  0x2e, 0x4b, 0xa2, 0xac, 0xc2, 0x6c, 0x41, 0x9b, 0xc3, 0x77, 0x15, 0x91, 0x20, 0x11, 0x99, 0x29,
+  0x22, 0xf7, 0x8b, 0x48, 0x08, 0xe0, 0x0d, 0xbc, 0x5c, 0x6d, 0xb4, 0x9a, 0x9e, 0x5a, 0x99, 0xca,
+  0xa4, 0x27, 0xcf, 0x50, 0x65, 0xb4, 0x02, 0x30, 0x32, 0xd2, 0x83, 0x17, 0x67, 0x6b, 0xeb, 0xab,
+  0x8b, 0x87, 0xd6, 0x23, 0x62, 0xad, 0x77, 0xd6, 0xc1, 0x19, 0xdf, 0xb0, 0xf1, 0xaa, 0xd6, 0xef,
+  0x05, 0x57, 0x1b, 0x3c, 0x34, 0x21, 0x40, 0x29, 0x15, 0xac, 0x94, 0x5a, 0xa5, 0x94, 0x3a, 0xaf,
+  0x94, 0xba, 0x08, 0x2c, 0x06, 0xf0, 0x1f, 0xd8, 0x7c, 0xbe, 0x71, 0xf3, 0xf8, 0x21, 0x7c, 0xfc,
+  0x52, 0x6f, 0xe6, 0x4f, 0xf3, 0xb5, 0x95, 0xbd, 0xb5, 0x36, 0x93, 0xef, 0xf7, 0x17, 0x02, 0x9c,
+  0x11, 0x61, 0xb8, 0x88, 0x2c, 0x11, 0x91, 0xfc, 0xa6, 0xb2, 0x22, 0x52, 0x24, 0x22, 0x2b, 0x45,
+  0x64, 0x30, 0x70, 0x72, 0xf7, 0xf1, 0x12, 0x5e, 0x5b, 0x9d, 0x66, 0xab, 0x5f, 0xf6, 0x78, 0x20,
+  0x11, 0xc1, 0x9d, 0xa8, 0x2c, 0xcc, 0x20, 0x2f, 0xf1, 0x60, 0x23, 0x59, 0xff, 0xc8, 0xdb, 0xa8,
+  0x9d, 0x44, 0x2d, 0x54, 0x4a, 0x5d, 0x54, 0x4a, 0x25, 0x29, 0xa5, 0x3e, 0x54, 0x4a, 0x0d, 0xb8,
+  0x12, 0x02, 0x6c, 0x5d, 0x40, 0x9b, 0xf6, 0xaa, 0x34, 0x10, 0xbf, 0x46, 0x06, 0x07, 0xde, 0x4e,
+  0xf0, 0xf8, 0x79, 0xcd, 0x04, 0xdf, 0xbb, 0x75, 0x33, 0xc3, 0xbb, 0x5f, 0xb2, 0xfd, 0x3f, 0x99,
+  0x58, 0xc1, 0x88, 0x39, 0xf1, 0x58, 0xac, 0x94, 0x88, 0x48, 0xb8, 0x88, 0x64, 0xb6, 0xcb, 0x01,
+  0xa5, 0xba, 0x28, 0xa5, 0x12, 0x40, 0x7c, 0xf7, 0x7d, 0x1a, 0xce, 0xb8, 0xc1, 0x9d, 0x01, 0x38,
+  0x14, 0x5b, 0xc6, 0x98, 0xc7, 0x4e, 0xe3, 0x19, 0x10, 0x4e, 0xe4, 0xf4, 0x25, 0x8d, 0x64, 0x2e,
+  0x1e, 0xfe, 0x8a, 0x8c, 0x13, 0x5b, 0x9a, 0x6a, 0x2a, 0x05, 0xe9, 0x2e, 0x22, 0x15, 0xed, 0xb1,
+  0x6b, 0x93, 0x6a, 0x40, 0xc0, 0x7d, 0xc0, 0x06, 0xbf, 0x88, 0x49, 0x04, 0x8f, 0x9f, 0xdb, 0xe2,
+  0x82, 0xc6, 0x62, 0xaa, 0x22, 0x7e, 0xe3, 0x62, 0x96, 0x3c, 0xe4, 0xc0, 0x0b, 0x0f, 0xd6, 0x73,
+  0x15, 0xf5, 0x40, 0x2c, 0x71, 0x17, 0x2a, 0x01, 0x1e, 0x12, 0x91, 0xf5, 0x1d, 0x72, 0x42, 0xa9,
+  0x29, 0xc0, 0x8f, 0xbd, 0xbb, 0xbb, 0x70, 0x61, 0xcb, 0x20, 0xf4, 0x3a, 0x6d, 0x40, 0xe8, 0x39,
+  0xe5, 0x77, 0x32, 0x72, 0xcd, 0x0c, 0x7f, 0xec, 0x1f, 0x38, 0xba, 0x7a, 0xd8, 0x95, 0x15, 0xb1,
+  0x72, 0xe9, 0xd0, 0x97, 0x64, 0x9c, 0xfc, 0x01, 0xe0, 0x4f, 0x22, 0xf2, 0x59, 0x47, 0x6c, 0x37,
+  0xec, 0x02, 0x43, 0x00, 0x3c, 0x03, 0xc2, 0x5a, 0x5d, 0xcd, 0x55, 0x16, 0xa4, 0x53, 0x9e, 0x9f,
+  0xce, 0xa9, 0xc4, 0x32, 0x5b, 0x59, 0x5a, 0xb6, 0xb1, 0x2e, 0xf8, 0xdf, 0x3a, 0x1a, 0x3c, 0x80,
+  0x88, 0x6c, 0x05, 0xb6, 0xa7, 0x5e, 0xae, 0x26, 0x21, 0xb9, 0x7e, 0x7d, 0x33, 0x75, 0x9c, 0x37,
+  0x22, 0x56, 0x8a, 0xd3, 0x62, 0x5b, 0x94, 0x55, 0x4a, 0x87, 0x67, 0x60, 0x44, 0xa3, 0x18, 0x3a,
+  0x82, 0x0e, 0xa7, 0xc4, 0xaa, 0xcb, 0xf2, 0x00, 0xe8, 0xe5, 0x5f, 0x3f, 0x29, 0x3a, 0x7e, 0xa6,
+  0xbc, 0xee, 0xe7, 0xaf, 0x1d, 0xd5, 0xd7, 0x00, 0xbf, 0x36, 0xd1, 0x65, 0x1b, 0x5c, 0x8d, 0xb5,
+  0x36, 0xaf, 0x07, 0x3a, 0x4e, 0x40, 0x49, 0x2e, 0x00, 0x41, 0xdd, 0x1b, 0x12, 0x60, 0xeb, 0x76,
+  0x27, 0xae, 0xc2, 0x97, 0x13, 0x9a, 0xae, 0x7a, 0x02, 0xea, 0xe6, 0x15, 0xa6, 0x8a, 0xe2, 0xab,
+  0x50, 0xdb, 0x3a, 0x3a, 0x4c, 0x40, 0x4d, 0x55, 0x09, 0x00, 0xdd, 0xbc, 0x1c, 0x6d, 0x65, 0x29,
+  0x99, 0xb6, 0x04, 0x4d, 0xca, 0x55, 0xf8, 0x92, 0x0c, 0x90, 0x9c, 0x51, 0x9f, 0xec, 0xf1, 0xf2,
+  0xd0, 0xba, 0xa2, 0xd9, 0x58, 0x6e, 0x5f, 0xe2, 0x1a, 0xa0, 0xc3, 0x04, 0x38, 0xd6, 0xce, 0x07,
+  0xf2, 0x8b, 0x6d, 0x93, 0x1c, 0x22, 0x82, 0x6d, 0x93, 0xa0, 0x88, 0xe6, 0x12, 0xed, 0x46, 0x28,
+  0x40, 0x70, 0x80, 0x0b, 0x56, 0xab, 0x50, 0x51, 0x66, 0xe4, 0x72, 0x76, 0xa5, 0x56, 0x63, 0xae,
+  0xc1, 0x94, 0x9b, 0x5a, 0x7f, 0xe5, 0x5d, 0xc2, 0x5c, 0x9c, 0x8d, 0x98, 0x8d, 0x57, 0x61, 0x4e,
+  0x43, 0xfb, 0x56, 0x2c, 0x0d, 0xe0, 0xe8, 0x66, 0x00, 0x20, 0x2b, 0xdf, 0x64, 0x2b, 0x1b, 0x16,
+  0xe6, 0x6e, 0xfb, 0x09, 0xfc, 0xfb, 0x0a, 0x7d, 0x89, 0x04, 0x08, 0xef, 0xe3, 0x4a, 0x59, 0x49,
+  0x15, 0xc5, 0xa5, 0x66, 0xb6, 0xec, 0xd7, 0x1e, 0xfd, 0xb2, 0xbc, 0x54, 0x52, 0x8e, 0x7e, 0x63,
+  0x6b, 0xe8, 0xd4, 0xc9, 0x40, 0xd7, 0x3e, 0xc3, 0x70, 0x36, 0x55, 0xe3, 0xe8, 0xed, 0x7f, 0x85,
+  0xe6, 0x34, 0x34, 0x24, 0xc0, 0xda, 0x62, 0xab, 0x06, 0x70, 0x35, 0x68, 0x06, 0x8f, 0x25, 0xd4,
+  0x3f, 0x96, 0x0d, 0x08, 0xb8, 0x55, 0x29, 0xe5, 0x20, 0x22, 0xe6, 0xe6, 0x92, 0x2d, 0x43, 0x69,
+  0xab, 0x9e, 0x07, 0x00, 0x06, 0x05, 0xbb, 0x50, 0x6d, 0xb4, 0x32, 0x7c, 0xfe, 0x79, 0x72, 0x8b,
+  0xb4, 0x9c, 0x41, 0x55, 0x49, 0x0e, 0x55, 0x25, 0x39, 0x8d, 0x64, 0xb2, 0xce, 0xec, 0x65, 0xe0,
+  0x94, 0x97, 0xd0, 0x39, 0xb9, 0xa0, 0xa5, 0xd1, 0xda, 0x1f, 0x43, 0x43, 0x34, 0x24, 0x60, 0x27,
+  0xf0, 0x6a, 0xee, 0xd9, 0x03, 0xb8, 0x7a, 0xfa, 0xa1, 0xf4, 0x5a, 0x55, 0x27, 0xef, 0x80, 0x46,
+  0xaf, 0xc5, 0xce, 0xfe, 0xfd, 0x70, 0x74, 0x71, 0x67, 0xe7, 0xd1, 0x12, 0x2a, 0xaa, 0xac, 0xb8,
+  0xb9, 0xea, 0xf0, 0x31, 0x38, 0x70, 0x47, 0xb4, 0x81, 0xed, 0x47, 0x8a, 0x43, 0x81, 0xd7, 0x81,
+  0x65, 0x1d, 0xf4, 0x63, 0x1e, 0x30, 0x70, 0xd2, 0x08, 0x4f, 0x06, 0x87, 0xba, 0xb2, 0x69, 0x4f,
+  0x21, 0xb9, 0x45, 0x35, 0xf8, 0x0e, 0x18, 0x4b, 0xf0, 0xb8, 0x39, 0xcd, 0x1a, 0x67, 0x27, 0xec,
+  0x21, 0xe5, 0xd7, 0xf5, 0x64, 0x27, 0xee, 0xc7, 0xa7, 0xcf, 0x70, 0x72, 0x92, 0x8f, 0xd6, 0x55,
+  0x1d, 0x6c, 0xd6, 0xb8, 0x0d, 0xd8, 0x08, 0x10, 0x91, 0xbd, 0x4a, 0xa9, 0x53, 0x45, 0x97, 0x62,
+  0x06, 0x15, 0x5d, 0x8a, 0xb1, 0x35, 0xf0, 0xec, 0x31, 0x80, 0xc8, 0xe9, 0x4b, 0xa9, 0x5b, 0xad,
+  0x28, 0x9d, 0x1e, 0xaf, 0xde, 0x37, 0x91, 0x7b, 0x76, 0x3f, 0x5f, 0xfd, 0x92, 0xcf, 0x63, 0xd3,
+  0xb4, 0x2c, 0xce, 0x3f, 0x16, 0x07, 0x13, 0x3e, 0x2b, 0x96, 0xb2, 0x72, 0xf3, 0x62, 0xa5, 0xd4,
+  0x0f, 0x22, 0x12, 0x43, 0x1b, 0x50, 0x4a, 0xdd, 0x0c, 0x3c, 0xa8, 0xd3, 0xa9, 0x99, 0x22, 0xc2,
+  0x9f, 0x1f, 0xf1, 0xc5, 0x5c, 0x63, 0xe1, 0x72, 0xbe, 0x76, 0xe7, 0xbb, 0x86, 0x8c, 0xc4, 0x27,
+  0xd8, 0xfe, 0xb6, 0x61, 0xca, 0xaf, 0xeb, 0xc9, 0xb9, 0x70, 0x84, 0x9c, 0x0b, 0x47, 0xea, 0x8a,
+  0x32, 0x35, 0x95, 0x6a, 0x35, 0xf0, 0xb5, 0x88, 0xb4, 0x8b, 0x8c, 0xa6, 0x83, 0xe0, 0x70, 0xe0,
+  0x8f, 0x68, 0x99, 0xe0, 0xef, 0x81, 0xac, 0x92, 0xcc, 0xb3, 0x14, 0x5d, 0x3a, 0xd5, 0xa8, 0x91,
+  0x36, 0x1f, 0x87, 0x17, 0x3e, 0xb8, 0x44, 0x66, 0x9e, 0x36, 0x16, 0x04, 0x74, 0x73, 0xe2, 0xc3,
+  0xe7, 0x83, 0x10, 0x70, 0x50, 0x4a, 0xed, 0x53, 0x4a, 0x3d, 0xdc, 0x46, 0xf0, 0xff, 0x03, 0xec,
+  0x05, 0xe6, 0x5b, 0xad, 0x62, 0xf0, 0xf6, 0x70, 0xc0, 0x58, 0x63, 0xe5, 0x2f, 0xff, 0xcd, 0xe1,
+  0x83, 0x6f, 0xb5, 0xf7, 0xbe, 0xbd, 0xa4, 0x08, 0x80, 0xde, 0xc1, 0xb1, 0x69, 0xd1, 0x0f, 0x40,
+  0x1a, 0xb0, 0x1e, 0x6d, 0x91, 0x74, 0x40, 0x29, 0xf5, 0x89, 0x52, 0xaa, 0xcd, 0xcc, 0x6b, 0x23,
+  0x02, 0x44, 0xa4, 0x46, 0x44, 0xbe, 0x16, 0x91, 0xfb, 0x44, 0x64, 0x1a, 0xb5, 0x8f, 0x72, 0x56,
+  0xdc, 0x2f, 0x8d, 0x84, 0x3c, 0xfc, 0xfa, 0xe2, 0x13, 0x32, 0x82, 0x92, 0x72, 0x33, 0xf3, 0x57,
+  0x24, 0xdb, 0xca, 0x1f, 0x99, 0xd2, 0x95, 0x25, 0xf3, 0x03, 0xd0, 0xeb, 0xe8, 0x0c, 0x7c, 0xae,
+  0x94, 0xfa, 0x4e, 0x29, 0x35, 0x51, 0x29, 0x65, 0xb0, 0x13, 0xfc, 0x6a, 0x9d, 0x83, 0x93, 0x8a,
+  0x9c, 0xf6, 0x0a, 0x7e, 0x61, 0x37, 0x53, 0x50, 0x6a, 0x66, 0xe2, 0xa2, 0x24, 0x56, 0xae, 0xcf,
+  0x21, 0xa7, 0xb0, 0x86, 0xae, 0x7d, 0xa3, 0x09, 0x1c, 0x3a, 0xd5, 0xae, 0xd3, 0x5e, 0xbd, 0xa2,
+  0x08, 0x1a, 0x39, 0xa3, 0x61, 0xd7, 0x9c, 0x0a, 0x44, 0x77, 0xf6, 0x0f, 0x65, 0xf0, 0xac, 0x15,
+  0x38, 0x7b, 0x74, 0x11, 0xe0, 0x09, 0x60, 0x4d, 0x5b, 0x24, 0xb4, 0x95, 0x0f, 0xe8, 0x04, 0x64,
+  0xa2, 0x94, 0x61, 0xe8, 0x23, 0x1f, 0x35, 0x4a, 0x5a, 0x56, 0x17, 0x67, 0x73, 0xf2, 0xcb, 0x17,
+  0xb1, 0x9a, 0x8d, 0xfc, 0x73, 0x71, 0x30, 0xf3, 0xee, 0xae, 0xaf, 0x3b, 0x99, 0x58, 0xc1, 0x9c,
+  0x65, 0xc9, 0xc4, 0x27, 0x35, 0x5a, 0x97, 0x24, 0x01, 0x15, 0x4a, 0xa9, 0x60, 0x11, 0x71, 0xd7,
+  0x3b, 0x38, 0x31, 0x7c, 0xce, 0x87, 0x74, 0x0d, 0x8d, 0xc6, 0x6a, 0x31, 0x13, 0xbf, 0xe5, 0x2d,
+  0x0a, 0x52, 0x4e, 0xd0, 0x35, 0x74, 0x34, 0x41, 0xd1, 0x33, 0xf1, 0xf0, 0x0d, 0x6e, 0xcd, 0x6f,
+  0xcd, 0x87, 0x92, 0x5c, 0x2e, 0x1d, 0xdb, 0x4c, 0x66, 0xec, 0x76, 0xdc, 0xbc, 0x03, 0x18, 0x7c,
+  0xff, 0x0a, 0x9c, 0x3a, 0x19, 0x28, 0xcf, 0xbb, 0xc8, 0xa1, 0x35, 0xf3, 0xc4, 0x58, 0x96, 0xaf,
+  0x80, 0x7f, 0x02, 0x8f, 0x4b, 0x0b, 0x81, 0xb6, 0x67, 0x67, 0xe8, 0x03, 0x60, 0x61, 0xaf, 0xe8,
+  0xfb, 0x09, 0x1c, 0x36, 0xbd, 0x51, 0x5d, 0xfe, 0x85, 0x23, 0x24, 0x6e, 0xfb, 0x1b, 0x9d, 0xdd,
+  0xf4, 0x6c, 0x59, 0xd5, 0x8f, 0x09, 0xc3, 0xea, 0xd3, 0x61, 0xa6, 0x1a, 0x61, 0xfd, 0xf6, 0x3c,
+  0x8e, 0xc4, 0x95, 0x73, 0x2c, 0x41, 0xcb, 0x0a, 0x99, 0x2d, 0xb5, 0x59, 0x21, 0x47, 0x67, 0x2d,
+  0xf8, 0xbe, 0x23, 0xdb, 0x0c, 0x12, 0xb4, 0x05, 0x4f, 0x55, 0xd1, 0x65, 0x5c, 0x3c, 0x7d, 0x6d,
+  0xbb, 0x45, 0x6d, 0xa1, 0x3c, 0xef, 0x12, 0x87, 0x3f, 0x9d, 0x27, 0xd5, 0xa5, 0x79, 0x0a, 0xf8,
+  0x4c, 0x44, 0xfe, 0x64, 0x37, 0xbe, 0x36, 0x9e, 0x80, 0x70, 0xb4, 0x8d, 0xca, 0x6e, 0x7d, 0x6f,
+  0x7d, 0x02, 0xdf, 0xf0, 0x09, 0xcd, 0xda, 0xa4, 0x1d, 0xfd, 0x96, 0xb4, 0xa3, 0xdf, 0xa2, 0x14,
+  0x2c, 0x98, 0xe1, 0xc7, 0xca, 0x85, 0xbd, 0xe8, 0xe4, 0xd2, 0x78, 0x68, 0x31, 0x56, 0xd7, 0x70,
+  0x21, 0xb5, 0x82, 0xc8, 0xd9, 0x67, 0x71, 0x70, 0x72, 0x61, 0xf8, 0x9c, 0x0f, 0xf1, 0x09, 0x19,
+  0xd1, 0xa2, 0x5d, 0xab, 0xc5, 0x4c, 0x56, 0xfc, 0x2e, 0x8a, 0xd3, 0x4f, 0x53, 0x9c, 0x91, 0x40,
+  0x49, 0xe6, 0x59, 0xcc, 0xa6, 0x2a, 0x74, 0x7a, 0x47, 0x3a, 0xfb, 0x87, 0x62, 0x08, 0x0c, 0xc7,
+  0x10, 0x10, 0x8e, 0x7f, 0xe4, 0x44, 0x1c, 0x5d, 0xdc, 0x5b, 0xd4, 0x53, 0x91, 0x9f, 0xc6, 0xa1,
+  0x35, 0xf3, 0xa4, 0xba, 0x34, 0x57, 0x01, 0x03, 0x44, 0x24, 0xb1, 0xdd, 0x04, 0x68, 0xbb, 0xc1,
+  0x2a, 0x15, 0x24, 0xc0, 0x3f, 0xf2, 0x36, 0x82, 0x6f, 0x99, 0x47, 0x4b, 0xbb, 0x39, 0x59, 0x71,
+  0xbf, 0x90, 0x72, 0x60, 0x1d, 0x62, 0xb5, 0x10, 0x12, 0xe8, 0xc2, 0xba, 0x25, 0x21, 0x8c, 0x8e,
+  0x6a, 0x90, 0x3e, 0x2b, 0xab, 0x66, 0xef, 0x89, 0x12, 0xee, 0x7a, 0x29, 0x85, 0x80, 0x21, 0x77,
+  0x32, 0xe4, 0xfe, 0xb7, 0x5b, 0x74, 0xba, 0x34, 0xeb, 0x3c, 0x31, 0x5f, 0x2f, 0xa6, 0x24, 0xeb,
+  0x9c, 0xad, 0xac, 0x6b, 0x57, 0x1f, 0x06, 0xf4, 0xef, 0xcb, 0xc5, 0x8b, 0xe9, 0xa4, 0xa5, 0x67,
+  0xd8, 0xca, 0x5d, 0x0d, 0x7e, 0x0c, 0x9a, 0xb1, 0x94, 0xae, 0xa1, 0xd1, 0x2d, 0xea, 0x4b, 0x3e,
+  0xf0, 0x39, 0x09, 0x5b, 0xdf, 0x03, 0x58, 0x28, 0x22, 0x1f, 0x75, 0x84, 0x80, 0x7b, 0x81, 0x8d,
+  0x5d, 0x43, 0x47, 0xd3, 0xef, 0x8e, 0x85, 0x2d, 0x06, 0x5f, 0x87, 0xe2, 0x8c, 0xd3, 0x24, 0xed,
+  0xfe, 0x94, 0xea, 0x92, 0x1c, 0x74, 0x3a, 0xc5, 0x1d, 0xd1, 0x06, 0xa6, 0x8d, 0xf7, 0xe2, 0x8e,
+  0x68, 0x2f, 0xbc, 0xdd, 0xa0, 0xaa, 0xd2, 0x44, 0xe4, 0xec, 0x44, 0xb2, 0x0b, 0xcd, 0x44, 0x4d,
+  0x7f, 0x83, 0x5e, 0x23, 0xee, 0x6d, 0x24, 0x2f, 0x56, 0x2b, 0x49, 0xfb, 0xd6, 0x72, 0x6e, 0xd7,
+  0x1a, 0xac, 0xe6, 0x1a, 0x26, 0x4d, 0x1c, 0xcf, 0xec, 0x87, 0x66, 0x31, 0x38, 0x2a, 0x92, 0x1e,
+  0x3d, 0xea, 0x67, 0x7b, 0x85, 0x45, 0xc5, 0xc4, 0x9c, 0x8a, 0xe3, 0xc7, 0xad, 0xbf, 0xf0, 0xf9,
+  0x17, 0x1b, 0x10, 0x11, 0x7a, 0x8d, 0x98, 0x41, 0xf8, 0x94, 0xe7, 0x70, 0x70, 0x76, 0x6b, 0xa4,
+  0xb3, 0x20, 0xe5, 0x04, 0xbf, 0xad, 0x7d, 0x52, 0x2c, 0xa6, 0x6a, 0x2b, 0x10, 0x24, 0x22, 0x19,
+  0x34, 0x41, 0x6b, 0x04, 0x2c, 0x06, 0xde, 0x0c, 0x99, 0xf0, 0x38, 0x7e, 0x11, 0x13, 0x5b, 0x0d,
+  0xbe, 0x3e, 0x08, 0x0b, 0xd9, 0xa7, 0x77, 0x91, 0x7e, 0x7c, 0x33, 0xa6, 0x8a, 0x22, 0x5b, 0xb9,
+  0x83, 0x5e, 0xe1, 0x63, 0x70, 0xa0, 0xbc, 0xd2, 0x42, 0x79, 0x95, 0x15, 0x94, 0x62, 0xe2, 0x2b,
+  0x3f, 0xd3, 0xc9, 0xab, 0xfe, 0x6c, 0xc5, 0x89, 0xf5, 0x2f, 0x72, 0x39, 0x76, 0x07, 0x9d, 0x3d,
+  0x3c, 0x78, 0x7b, 0xc5, 0x62, 0x1e, 0xfc, 0xe3, 0x0c, 0x00, 0xd2, 0x33, 0x32, 0x39, 0x73, 0xe6,
+  0x1c, 0xd9, 0x39, 0xb9, 0xf4, 0xef, 0xd7, 0x97, 0x41, 0x51, 0x11, 0x38, 0x3b, 0x6b, 0x2b, 0xd1,
+  0x03, 0x07, 0x8f, 0xf0, 0xf4, 0x33, 0xaf, 0x90, 0x96, 0x9e, 0x41, 0x67, 0xff, 0x50, 0xc6, 0x3d,
+  0xbd, 0xbe, 0xd1, 0xab, 0x73, 0xdb, 0x92, 0x31, 0x52, 0x53, 0x55, 0xa6, 0x80, 0x97, 0x45, 0x64,
+  0xa5, 0x3d, 0x9f, 0x5b, 0x5b, 0x0b, 0xac, 0x05, 0x96, 0xa6, 0xfe, 0xfa, 0x85, 0xce, 0xbd, 0x6b,
+  0x6f, 0xe5, 0xde, 0x8e, 0x51, 0x59, 0xe9, 0xf4, 0xf8, 0x0f, 0xbc, 0x1d, 0xff, 0xc8, 0xdb, 0x28,
+  0xb9, 0x9c, 0x48, 0x41, 0xf2, 0x31, 0xca, 0xb2, 0xce, 0x61, 0xaa, 0x28, 0x22, 0xb7, 0xb8, 0x18,
+  0xab, 0xa5, 0x76, 0xa6, 0x2a, 0x82, 0x58, 0xea, 0x67, 0xcb, 0x99, 0xa7, 0xb6, 0x71, 0x39, 0x76,
+  0x07, 0xfd, 0xfa, 0x85, 0xb0, 0x79, 0xc3, 0x7f, 0xe8, 0xde, 0xdd, 0x8f, 0xf8, 0xd3, 0x67, 0x58,
+  0xf6, 0xe6, 0x2a, 0xf6, 0xec, 0x3b, 0xd8, 0x68, 0x5f, 0xd1, 0xd1, 0xd1, 0x91, 0xa8, 0x81, 0x11,
+  0xbc, 0xf2, 0xe2, 0x42, 0x6e, 0x9d, 0x30, 0x8e, 0xc3, 0x07, 0xb6, 0x31, 0xf7, 0xf1, 0x85, 0xec,
+  0xd8, 0xb9, 0x97, 0xc4, 0x1d, 0x7f, 0x27, 0x6c, 0xf2, 0x33, 0xb6, 0x9b, 0x21, 0x22, 0x0a, 0x6d,
+  0x9e, 0xbc, 0xa9, 0x45, 0x9f, 0xdb, 0x18, 0x04, 0x17, 0x03, 0x6f, 0x7a, 0xf7, 0x19, 0x66, 0x0e,
+  0x9b, 0xf2, 0x62, 0x87, 0x17, 0x4e, 0x62, 0x36, 0x61, 0x2e, 0xcd, 0x43, 0xcc, 0x26, 0x40, 0xc8,
+  0x4b, 0x39, 0x41, 0xea, 0xb1, 0x8d, 0x74, 0xe9, 0x33, 0x94, 0xd1, 0x4f, 0xfc, 0x0b, 0x80, 0xea,
+  0xd2, 0x7c, 0xf6, 0xbd, 0x3f, 0x1d, 0x8b, 0xb1, 0x9c, 0x5d, 0xdb, 0x37, 0x33, 0x28, 0x2a, 0x82,
+  0x63, 0xc7, 0x4f, 0x32, 0xe3, 0xfe, 0xb9, 0x94, 0x95, 0x95, 0xe1, 0xe0, 0xec, 0x86, 0x87, 0x4f,
+  0x2f, 0xdc, 0xbc, 0x03, 0xa8, 0x28, 0xcc, 0xa0, 0x28, 0xf3, 0x4c, 0x9d, 0x6f, 0x2c, 0x7a, 0xea,
+  0x71, 0x16, 0xbf, 0xf6, 0x3c, 0xc5, 0x25, 0xa5, 0x8c, 0x18, 0x7d, 0x1b, 0x85, 0x85, 0xc5, 0x8c,
+  0x59, 0xb0, 0x0e, 0xaf, 0x5e, 0x51, 0x00, 0x9c, 0xfe, 0x61, 0x25, 0x29, 0xbf, 0xae, 0x07, 0x58,
+  0x25, 0x22, 0x2f, 0xd9, 0xf3, 0xb1, 0xd5, 0xe5, 0xb0, 0x88, 0xac, 0x00, 0x26, 0x7b, 0x05, 0x44,
+  0x3c, 0x04, 0x94, 0xd9, 0x6b, 0x63, 0x35, 0x1b, 0x29, 0xcf, 0x4d, 0xc5, 0x6a, 0x36, 0x35, 0x96,
+  0xb5, 0x5a, 0xa8, 0x29, 0xce, 0xa2, 0xb2, 0x30, 0x9d, 0xd4, 0xe3, 0x9b, 0x88, 0xfb, 0xf9, 0x3d,
+  0xd2, 0x4e, 0xfd, 0x04, 0x40, 0xef, 0x51, 0xb3, 0x6c, 0xed, 0xe2, 0xb6, 0xac, 0xc0, 0x54, 0x59,
+  0xc2, 0xb3, 0x8b, 0x9e, 0x60, 0x50, 0x54, 0x04, 0xfb, 0x0f, 0x1e, 0x66, 0xda, 0x8c, 0xd9, 0x94,
+  0x97, 0x97, 0x13, 0x18, 0x35, 0x99, 0x21, 0xf7, 0xfc, 0x99, 0xbe, 0x63, 0x1f, 0xc1, 0xab, 0xe7,
+  0x40, 0xca, 0xf2, 0x6d, 0x99, 0xe3, 0xf5, 0x40, 0xc5, 0xff, 0x7e, 0xf4, 0x29, 0xef, 0xbe, 0xbf,
+  0x9a, 0x2e, 0xde, 0x5e, 0xbc, 0xbf, 0xea, 0x4d, 0x44, 0xac, 0xc4, 0x6c, 0x58, 0x8c, 0xd5, 0xa2,
+  0x4d, 0xa5, 0x83, 0xa2, 0x67, 0x51, 0x3b, 0x76, 0x3d, 0xad, 0x94, 0x4a, 0x54, 0x4a, 0x6d, 0x56,
+  0x4a, 0x8d, 0x6b, 0xe8, 0x67, 0xbb, 0x8f, 0xc9, 0x0d, 0x7b, 0xf4, 0xe3, 0xf1, 0xd9, 0x71, 0x3b,
+  0xb7, 0xfb, 0x84, 0x46, 0x3b, 0xbb, 0x77, 0xd3, 0xba, 0x43, 0xc3, 0xfd, 0x7a, 0x07, 0x67, 0x37,
+  0x7c, 0xc3, 0x6e, 0xc1, 0x2f, 0x72, 0x12, 0xae, 0x06, 0x7f, 0x2c, 0x15, 0xc5, 0x98, 0xcb, 0x0b,
+  0x88, 0xdb, 0xba, 0x12, 0x63, 0x83, 0xf1, 0xc0, 0xb7, 0xff, 0x58, 0x86, 0xcf, 0xf9, 0x00, 0xa5,
+  0xd3, 0x63, 0xa9, 0xa9, 0xe6, 0xe7, 0x37, 0xa2, 0x09, 0xe8, 0xee, 0xcf, 0x89, 0xdf, 0x76, 0x53,
+  0x54, 0x54, 0x44, 0xd4, 0xd0, 0xf1, 0x18, 0x8d, 0x46, 0xfa, 0x8c, 0x98, 0x89, 0x4f, 0x9f, 0x61,
+  0xe8, 0xdd, 0xbc, 0xa9, 0x2e, 0x2f, 0xe0, 0xf4, 0xf7, 0x2b, 0xea, 0xfa, 0xf3, 0xfb, 0x22, 0xf2,
+  0xbc, 0x52, 0xea, 0x4e, 0xe0, 0x7b, 0xbd, 0x5e, 0xaf, 0xdf, 0xfd, 0xcb, 0x16, 0xa2, 0x06, 0x86,
+  0x33, 0xf3, 0x8f, 0x73, 0xd9, 0xb5, 0x7b, 0x3f, 0x63, 0x9f, 0xfa, 0x02, 0xaf, 0x9e, 0x91, 0x00,
+  0x24, 0xfc, 0xf4, 0x3e, 0xc9, 0xfb, 0xff, 0xd3, 0x30, 0x64, 0x33, 0x48, 0x4f, 0x11, 0xc9, 0x82,
+  0x0e, 0xe4, 0x03, 0x4e, 0xac, 0x7b, 0x3a, 0x1f, 0x70, 0xce, 0x8a, 0xdf, 0x21, 0x61, 0x77, 0xbd,
+  0xac, 0x5c, 0x3c, 0xfd, 0x38, 0xf3, 0xc3, 0x5f, 0xea, 0x0e, 0x2b, 0x5c, 0x36, 0x1b, 0x2b, 0xfc,
+  0x33, 0x63, 0xb6, 0xaa, 0xcc, 0x98, 0x9f, 0x30, 0xf4, 0x1c, 0x48, 0xc8, 0xa8, 0x07, 0x28, 0xcb,
+  0x49, 0xc2, 0x58, 0x51, 0x84, 0x5f, 0xf8, 0x04, 0x86, 0x3e, 0xf8, 0x57, 0x80, 0x46, 0x1b, 0xac,
+  0x25, 0x99, 0x89, 0x88, 0xd5, 0x4a, 0xf4, 0xc8, 0x61, 0x38, 0x39, 0x39, 0xf2, 0xef, 0xcf, 0xbf,
+  0xc2, 0x68, 0xd4, 0x92, 0x1c, 0x97, 0xcf, 0xec, 0xc5, 0xd0, 0xfb, 0x26, 0x4c, 0x65, 0x79, 0x24,
+  0xfc, 0xf0, 0x76, 0x5d, 0xf0, 0xef, 0x8a, 0xc8, 0x8b, 0x00, 0x22, 0xf2, 0x93, 0x52, 0x6a, 0x91,
+  0xc5, 0x62, 0xf9, 0xf8, 0x9b, 0x8d, 0xdf, 0x11, 0x35, 0x30, 0x9c, 0x9b, 0xc7, 0x8e, 0x62, 0xd7,
+  0xee, 0xfd, 0x14, 0x67, 0x24, 0xd8, 0x08, 0x08, 0xbf, 0xf3, 0x39, 0x06, 0xdc, 0xfe, 0x14, 0x20,
+  0x5c, 0xd8, 0xf3, 0x2f, 0xce, 0xed, 0xfa, 0xd4, 0x01, 0x78, 0x18, 0x58, 0xd9, 0x21, 0x02, 0x44,
+  0xe4, 0xb4, 0x52, 0xea, 0x0d, 0x4b, 0x4d, 0xf5, 0x9b, 0xf1, 0x9b, 0x97, 0x69, 0xab, 0x43, 0xed,
+  0xe9, 0xd9, 0x09, 0xdc, 0x0d, 0xf4, 0x04, 0x9e, 0x00, 0x99, 0x53, 0x9c, 0x16, 0x6b, 0xc8, 0x74,
+  0xef, 0x42, 0x27, 0x83, 0x96, 0x36, 0x77, 0xef, 0x1a, 0x64, 0x77, 0x67, 0xb9, 0x38, 0x23, 0x01,
+  0x80, 0xc1, 0x83, 0x34, 0x67, 0x7f, 0xf8, 0x71, 0x7b, 0x5d, 0xd5, 0x8e, 0xea, 0xb2, 0xfc, 0xdb,
+  0x4e, 0x6e, 0x78, 0xb5, 0xce, 0x86, 0x02, 0x56, 0x8a, 0xc8, 0xcb, 0x4d, 0x7c, 0x5a, 0x1d, 0x14,
+  0x3a, 0x20, 0xfb, 0xb9, 0x67, 0x9e, 0xdc, 0xd8, 0x50, 0x4f, 0x71, 0xc6, 0x99, 0x46, 0x76, 0xea,
+  0xde, 0x0c, 0xee, 0xdd, 0xfa, 0xd4, 0x15, 0x79, 0xdb, 0xea, 0xda, 0x4b, 0x40, 0xad, 0xc1, 0x15,
+  0xc0, 0x78, 0x60, 0x13, 0x22, 0x47, 0x80, 0xd9, 0xc0, 0x14, 0x11, 0xa9, 0x12, 0x91, 0x73, 0x22,
+  0xf2, 0x2c, 0xb5, 0x89, 0x0d, 0x6b, 0x3b, 0xd2, 0x55, 0xc5, 0xe9, 0xf5, 0x04, 0x88, 0x08, 0xa9,
+  0x17, 0xd3, 0x50, 0x4a, 0x15, 0x01, 0x93, 0x81, 0xfb, 0x11, 0x39, 0x00, 0x6c, 0x05, 0x6e, 0x6f,
+  0x1a, 0x7c, 0x1d, 0x2e, 0x9e, 0x3f, 0xbb, 0xc9, 0xec, 0xd0, 0xd9, 0x08, 0x10, 0x35, 0x30, 0x02,
+  0xa5, 0x14, 0xc5, 0xe9, 0xa7, 0xdb, 0x1d, 0x53, 0xc7, 0x47, 0x76, 0x91, 0xfd, 0xc0, 0xfe, 0x56,
+  0x9a, 0xb4, 0x3b, 0x2b, 0x53, 0x53, 0x55, 0x0a, 0x80, 0xc1, 0xd3, 0x13, 0x8b, 0xc5, 0x8a, 0xd5,
+  0x6a, 0x45, 0x44, 0xca, 0x6b, 0xf7, 0xfc, 0x37, 0xd4, 0x5e, 0xad, 0x42, 0x29, 0xf5, 0xc0, 0xc8,
+  0x51, 0xa3, 0xf5, 0xdf, 0x6d, 0xf8, 0x07, 0xae, 0xae, 0x2e, 0x38, 0x3b, 0x3b, 0xdb, 0xf4, 0xb6,
+  0x07, 0x57, 0x74, 0x54, 0xb6, 0x0d, 0xc4, 0x00, 0xe6, 0xd2, 0xdc, 0x14, 0x6a, 0x2a, 0x4b, 0x6a,
+  0x9d, 0xb4, 0xdf, 0xd0, 0x33, 0x40, 0xdb, 0xce, 0x8b, 0x8d, 0x3f, 0x8d, 0x83, 0x83, 0x9e, 0xc8,
+  0x88, 0x01, 0x00, 0x81, 0x4a, 0x29, 0x5f, 0xfb, 0x12, 0xf6, 0xa0, 0xde, 0x3a, 0xf6, 0xdb, 0x11,
+  0x87, 0xb2, 0xf2, 0x0a, 0xce, 0x5f, 0x48, 0xa6, 0xba, 0xba, 0x1a, 0x43, 0x40, 0x58, 0xbb, 0xa5,
+  0xaf, 0x39, 0x01, 0x22, 0x92, 0x0b, 0x6c, 0xaa, 0x2a, 0xce, 0xb2, 0xbd, 0xf6, 0xac, 0x16, 0xfb,
+  0x29, 0x42, 0x43, 0x40, 0x38, 0x00, 0x31, 0xa7, 0xe2, 0x01, 0x18, 0x32, 0x38, 0xaa, 0xae, 0x6a,
+  0x72, 0x7b, 0x6c, 0x29, 0xa5, 0x6e, 0x02, 0x09, 0x1a, 0x15, 0x3d, 0x0c, 0x9f, 0x2e, 0xde, 0x36,
+  0x3d, 0x9e, 0xb5, 0x7a, 0x9b, 0xf9, 0x66, 0xb5, 0x1d, 0x26, 0xb1, 0x3d, 0xa5, 0x1d, 0xee, 0x02,
+  0xed, 0xc4, 0x1c, 0x60, 0x1b, 0x30, 0x17, 0x18, 0x97, 0x7a, 0xf8, 0x6b, 0x2a, 0xb4, 0x53, 0x5d,
+  0x74, 0x1f, 0x78, 0x1b, 0x01, 0x83, 0xb5, 0xf8, 0x0c, 0x01, 0x5a, 0x16, 0xfd, 0x64, 0x4c, 0x1c,
+  0x00, 0xb3, 0x66, 0x4e, 0x63, 0xed, 0xba, 0xf5, 0x58, 0xad, 0xd6, 0x77, 0x95, 0x52, 0x5b, 0x45,
+  0xa4, 0xc5, 0x2d, 0x21, 0xa5, 0x94, 0x13, 0xf0, 0x21, 0xc0, 0xf4, 0x69, 0x53, 0x1a, 0xe9, 0xf1,
+  0x6a, 0x40, 0x40, 0xe1, 0xc5, 0x53, 0x24, 0x1f, 0xf8, 0x0f, 0x22, 0x42, 0xd1, 0xa5, 0xb8, 0xba,
+  0xe2, 0x6d, 0xb6, 0x06, 0xd7, 0xfb, 0x83, 0x04, 0x60, 0x29, 0x60, 0xa4, 0xc1, 0xc7, 0x12, 0xe3,
+  0x9f, 0xdb, 0x28, 0x53, 0x57, 0xc6, 0xca, 0xd4, 0x95, 0xb1, 0xe2, 0xe6, 0xd3, 0x53, 0x94, 0x52,
+  0xb2, 0x65, 0xe3, 0xe7, 0x52, 0x94, 0x9b, 0x2c, 0xcf, 0x2c, 0x7c, 0xa2, 0xae, 0xdd, 0x21, 0xa0,
+  0x4f, 0x0b, 0x3a, 0x3d, 0xd0, 0x26, 0x43, 0x32, 0x76, 0xcc, 0x48, 0xc9, 0xbb, 0x7c, 0x5e, 0x62,
+  0x7f, 0xdf, 0x2f, 0x6e, 0x6e, 0x9d, 0x44, 0xef, 0xe8, 0x2c, 0x77, 0x2c, 0xdd, 0x2f, 0x53, 0x57,
+  0xc6, 0xca, 0xe4, 0x15, 0x47, 0xc4, 0xc1, 0xd9, 0xcd, 0x5a, 0x6f, 0x5b, 0x55, 0x03, 0x9f, 0x34,
+  0xd2, 0x75, 0xbd, 0x09, 0xa8, 0x75, 0xd8, 0x1d, 0x88, 0x42, 0xfb, 0x8a, 0x44, 0x82, 0x46, 0xce,
+  0xb0, 0x11, 0x10, 0x3d, 0xff, 0x53, 0x01, 0x24, 0xa0, 0x47, 0x77, 0x49, 0x4f, 0x89, 0x93, 0xec,
+  0x8c, 0xb3, 0x32, 0x7a, 0xd4, 0x08, 0x01, 0x44, 0x29, 0x55, 0x09, 0xbc, 0x8d, 0xd6, 0x25, 0x02,
+  0x81, 0x51, 0xc0, 0x22, 0xa5, 0xd4, 0x65, 0x40, 0x7a, 0xf5, 0x0c, 0x94, 0xa4, 0xc4, 0x13, 0x52,
+  0x98, 0x93, 0x24, 0xe3, 0xc6, 0x46, 0x0b, 0x20, 0xe1, 0x53, 0x9e, 0xb7, 0xe9, 0x1e, 0x38, 0x7d,
+  0x71, 0x1d, 0x99, 0x3f, 0x03, 0x83, 0x00, 0xaf, 0x66, 0xbe, 0xdd, 0x08, 0x02, 0x1a, 0x10, 0xd1,
+  0x03, 0x30, 0xeb, 0x9d, 0x5c, 0xad, 0x7f, 0x58, 0x7e, 0xc8, 0xe6, 0x68, 0xd0, 0xc8, 0x99, 0x02,
+  0xc8, 0xec, 0x87, 0x66, 0x49, 0x51, 0x6e, 0xb2, 0x14, 0x64, 0x5f, 0x90, 0xe5, 0x4b, 0x5f, 0x11,
+  0x27, 0x27, 0x27, 0xbb, 0x9f, 0xdb, 0xe8, 0x74, 0x3a, 0x79, 0xf4, 0x91, 0x07, 0x24, 0xf5, 0xfc,
+  0x49, 0x29, 0xca, 0x4d, 0x96, 0x55, 0x7f, 0x5d, 0x2a, 0x80, 0x78, 0xf7, 0x1a, 0x24, 0x77, 0xbd,
+  0x13, 0x63, 0xd3, 0xeb, 0xe1, 0x17, 0x52, 0x27, 0x73, 0x7b, 0x4b, 0x3e, 0x5d, 0xaf, 0x31, 0xa0,
+  0x25, 0x98, 0x80, 0x7c, 0x8b, 0xa9, 0xca, 0xb7, 0xb2, 0x30, 0x13, 0xcf, 0xee, 0xfd, 0x00, 0x08,
+  0x9b, 0xf2, 0x1c, 0xb9, 0xe7, 0x0f, 0xf1, 0xf9, 0x17, 0x1b, 0x28, 0x2e, 0x2e, 0xe1, 0xdd, 0x95,
+  0xcb, 0x79, 0x7a, 0xc1, 0x7c, 0xa6, 0x4e, 0xb9, 0x83, 0xfd, 0x07, 0x0e, 0x73, 0x2a, 0xf6, 0x34,
+  0x67, 0x13, 0xcf, 0x13, 0x10, 0xd0, 0x9d, 0x88, 0xf0, 0x01, 0xdc, 0x7a, 0xcb, 0x58, 0x22, 0xc2,
+  0x07, 0x60, 0x34, 0x1a, 0x79, 0x63, 0xe9, 0x5f, 0xf8, 0xfb, 0x9a, 0xb5, 0xe8, 0x1d, 0x9d, 0x19,
+  0x3c, 0xeb, 0x4d, 0xdb, 0xc9, 0x32, 0xb1, 0x5a, 0x28, 0xcf, 0x4d, 0xa5, 0x96, 0x80, 0xac, 0x96,
+  0x1c, 0xba, 0x2e, 0xdf, 0x0c, 0xb5, 0x68, 0x4c, 0xa9, 0xdd, 0xc0, 0x84, 0xae, 0x7d, 0xa3, 0x19,
+  0x31, 0xf7, 0xa3, 0x46, 0xf9, 0xbd, 0xd2, 0xec, 0x0b, 0x9c, 0xfc, 0xf2, 0x15, 0x4a, 0xb3, 0x93,
+  0xf0, 0xf6, 0xf6, 0xe2, 0xdd, 0x77, 0x96, 0x31, 0x6d, 0xea, 0x64, 0x5a, 0x4a, 0xea, 0x1e, 0x3b,
+  0x7e, 0x92, 0x27, 0x17, 0xbd, 0x4c, 0x52, 0x52, 0x0a, 0x2e, 0x1e, 0x3e, 0x0c, 0xba, 0x6f, 0x39,
+  0xdd, 0xfa, 0x8d, 0x6e, 0xd4, 0xa6, 0x7e, 0x35, 0xa8, 0xb2, 0x41, 0x82, 0x44, 0xa4, 0xd9, 0xec,
+  0xec, 0x86, 0x11, 0xa0, 0x94, 0x0a, 0x03, 0x12, 0xbc, 0x83, 0x06, 0x33, 0xea, 0xf1, 0xcf, 0xec,
+  0xe6, 0xfc, 0xad, 0x66, 0x13, 0x89, 0x3b, 0x3e, 0x21, 0xf9, 0xc0, 0x3a, 0xc4, 0x6a, 0xc5, 0xb3,
+  0x73, 0x67, 0xa2, 0xa2, 0xc2, 0x19, 0x32, 0x68, 0x20, 0xfd, 0x6b, 0x53, 0x62, 0x31, 0xb1, 0xf1,
+  0xc4, 0x9c, 0x8a, 0x27, 0x37, 0x57, 0x7b, 0x41, 0x04, 0x0c, 0x9e, 0x4c, 0xc4, 0xdd, 0xaf, 0xe0,
+  0xd4, 0xa9, 0xf9, 0xf9, 0x44, 0x80, 0xd8, 0x4d, 0xcb, 0xb9, 0x74, 0x74, 0x13, 0xc0, 0x03, 0x22,
+  0xf2, 0x55, 0xd3, 0xfa, 0x1b, 0xd9, 0x05, 0x2a, 0x01, 0xab, 0xd9, 0x58, 0xa1, 0xb3, 0x98, 0x4d,
+  0x76, 0x09, 0xd0, 0x39, 0x38, 0x11, 0x36, 0x79, 0x11, 0xfe, 0xe1, 0xe3, 0x39, 0xb7, 0x73, 0x0d,
+  0xc5, 0x19, 0x09, 0x1c, 0x38, 0x78, 0x84, 0x03, 0x07, 0x8f, 0x34, 0x6a, 0xe7, 0xe0, 0xe4, 0x4a,
+  0x97, 0xde, 0x43, 0xe8, 0x33, 0xf6, 0x61, 0xfc, 0x23, 0x9a, 0x27, 0x6a, 0xeb, 0x20, 0x56, 0x6b,
+  0xc3, 0xb3, 0x05, 0x76, 0xcf, 0x0e, 0xdd, 0xe8, 0x2e, 0xb0, 0x19, 0xb8, 0xc7, 0x10, 0x18, 0x4e,
+  0xf4, 0x63, 0x9f, 0xb6, 0x78, 0xee, 0xa7, 0x21, 0x2a, 0x0b, 0x33, 0x28, 0x4e, 0x3f, 0x43, 0x69,
+  0xce, 0x05, 0xdc, 0xbc, 0x03, 0x30, 0x04, 0x46, 0xe0, 0xde, 0xad, 0x77, 0x1b, 0x1f, 0x64, 0x69,
+  0xc1, 0x9f, 0xfc, 0xfa, 0x35, 0x32, 0x4f, 0x6d, 0x03, 0x6d, 0x4f, 0xa2, 0xbf, 0xd8, 0x39, 0x56,
+  0x7b, 0xa3, 0x09, 0x70, 0x03, 0x7e, 0x02, 0x6e, 0x36, 0x04, 0x84, 0x13, 0x3d, 0x7f, 0x0d, 0x8e,
+  0xae, 0xda, 0xa9, 0xb0, 0x9c, 0xb3, 0x07, 0xc9, 0x4b, 0xfa, 0x8d, 0x80, 0xc1, 0x77, 0x76, 0x68,
+  0x2a, 0x5b, 0x59, 0x98, 0xc9, 0xe5, 0xb8, 0x5f, 0x70, 0xf1, 0xf4, 0x25, 0x60, 0xf0, 0x9d, 0x80,
+  0x36, 0x00, 0x9e, 0xfc, 0xea, 0x55, 0x32, 0x63, 0x7f, 0x01, 0xed, 0xd0, 0xc6, 0x2d, 0x22, 0x92,
+  0x66, 0x4f, 0xfe, 0x86, 0x12, 0x00, 0xb6, 0xdd, 0xa6, 0x1f, 0x81, 0x09, 0x9e, 0x3d, 0x06, 0x30,
+  0xea, 0xf1, 0xcf, 0xc8, 0x49, 0x3c, 0x48, 0xcc, 0xd7, 0x8b, 0x6d, 0x87, 0x22, 0x0d, 0x81, 0xe1,
+  0xf4, 0x19, 0xf3, 0xa0, 0x2d, 0x20, 0x7b, 0xc8, 0x4f, 0x3e, 0x41, 0xd2, 0xbe, 0xb5, 0xe4, 0x9d,
+  0x3f, 0x6c, 0xcb, 0x19, 0xf6, 0xbd, 0x65, 0x2e, 0xfd, 0x6f, 0x7f, 0x8a, 0xdf, 0xbf, 0x7c, 0x85,
+  0xcb, 0x71, 0x3b, 0x40, 0xbb, 0xf3, 0xb7, 0x88, 0x9d, 0x6c, 0xb0, 0xcd, 0x9f, 0x1b, 0x4d, 0x00,
+  0x80, 0x52, 0xca, 0x15, 0x6d, 0xf3, 0x75, 0x92, 0xd2, 0xe9, 0x11, 0xab, 0x15, 0x10, 0x0b, 0xf0,
+  0x19, 0xf0, 0x07, 0x20, 0x08, 0x60, 0xc4, 0xdc, 0x8f, 0xf1, 0xed, 0x3f, 0xb6, 0x99, 0x7c, 0x65,
+  0x61, 0x06, 0x7b, 0xde, 0xbd, 0x47, 0xac, 0x66, 0x93, 0x02, 0x0a, 0x80, 0x0d, 0xa0, 0x1e, 0x04,
+  0xf1, 0xd4, 0xe9, 0x1d, 0xeb, 0x52, 0x62, 0xed, 0x3a, 0x50, 0x7d, 0x3d, 0x56, 0x83, 0x6d, 0x42,
+  0xb4, 0x6f, 0x7d, 0xa6, 0x02, 0xcb, 0x45, 0xac, 0x59, 0x20, 0x7b, 0x80, 0x3b, 0x44, 0x64, 0x01,
+  0xda, 0x39, 0xe2, 0xf7, 0x00, 0x2a, 0xf2, 0x2e, 0xd9, 0x95, 0xaf, 0x2c, 0xca, 0xa6, 0x36, 0xf8,
+  0x6d, 0x40, 0x80, 0x88, 0x3c, 0x09, 0x32, 0x06, 0xf8, 0xc6, 0x6a, 0x31, 0x17, 0x02, 0x7f, 0x07,
+  0xc6, 0xb7, 0x15, 0x3c, 0xdc, 0xd8, 0xb7, 0x40, 0x23, 0x88, 0xf6, 0xe9, 0xdb, 0x92, 0xda, 0xab,
+  0x61, 0xb9, 0x55, 0x29, 0x75, 0x01, 0xc0, 0x54, 0xbb, 0x9c, 0x6e, 0x8a, 0x9a, 0x4a, 0xdb, 0xc8,
+  0x7e, 0xa9, 0x56, 0x0f, 0x22, 0x72, 0x1a, 0x98, 0x65, 0x57, 0xa0, 0x15, 0xfc, 0xbf, 0x74, 0x81,
+  0xb6, 0xa0, 0x94, 0xf2, 0x03, 0x32, 0x94, 0xd2, 0xe9, 0x5d, 0x0c, 0xcd, 0x53, 0x03, 0xa6, 0xf2,
+  0x42, 0xb1, 0xd4, 0x18, 0x15, 0x30, 0x51, 0x44, 0x76, 0x5f, 0x95, 0xb1, 0x1b, 0xb9, 0x16, 0xe8,
+  0xe0, 0xba, 0x61, 0x36, 0x10, 0x87, 0xfd, 0x4f, 0xef, 0xd3, 0xd1, 0x0e, 0x72, 0xab, 0xab, 0xb5,
+  0xf3, 0x7f, 0x5a, 0x76, 0x77, 0x30, 0x4b, 0x3a, 0xef, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+  0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// log_icon.png: 1520 bytes, 1520 as sent
+static const uint8_t webAsset_log_icon_png[] PROGMEM = {
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x08, 0x06, 0x00, 0x00, 0x00, 0x57, 0x02, 0xf9,
+  0x87, 0x00, 0x00, 0x01, 0x84, 0x69, 0x43, 0x43, 0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f,
+  0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x91, 0x7d, 0x91, 0x3d, 0x48, 0xc3, 0x40, 0x18, 0x86,
+  0xdf, 0xa6, 0x95, 0x8a, 0x56, 0x1c, 0xac, 0x20, 0xe2, 0x90, 0xa1, 0x3a, 0xd9, 0x45, 0x45, 0x1c,
+  0x4b, 0x15, 0x8b, 0x60, 0xa1, 0xb4, 0x15, 0x5a, 0x75, 0x30, 0xb9, 0xf4, 0x0f, 0x9a, 0x34, 0x24,
+  0x29, 0x2e, 0x8e, 0x82, 0x6b, 0xc1, 0xc1, 0x9f, 0xc5, 0xaa, 0x83, 0x8b, 0xb3, 0xae, 0x0e, 0xae,
+  0x82, 0x20, 0xf8, 0x03, 0xe2, 0x2e, 0x38, 0x29, 0xba, 0x48, 0x89, 0xdf, 0x25, 0x85, 0x16, 0x31,
+  0xde, 0x71, 0xdc, 0xc3, 0x7b, 0xdf, 0xfb, 0x72, 0xf7, 0x1d, 0x20, 0x34, 0xab, 0x4c, 0x35, 0x03,
+  0x31, 0x40, 0xd5, 0x2c, 0x23, 0x9d, 0x88, 0x8b, 0xb9, 0xfc, 0xaa, 0x18, 0x7c, 0x85, 0x1f, 0xc3,
+  0x34, 0x03, 0xe8, 0x97, 0x98, 0xa9, 0x27, 0x33, 0x8b, 0x59, 0x78, 0x8e, 0xaf, 0x7b, 0xf8, 0xf8,
+  0x7e, 0x17, 0xe5, 0x59, 0xde, 0x75, 0x7f, 0x8e, 0x01, 0xa5, 0x60, 0x32, 0xc0, 0x27, 0x12, 0xc7,
+  0x98, 0x6e, 0x58, 0xc4, 0x1b, 0xc4, 0xb3, 0x9b, 0x96, 0xce, 0x79, 0x9f, 0x38, 0xcc, 0xca, 0x92,
+  0x42, 0x7c, 0x4e, 0x3c, 0x69, 0xd0, 0x05, 0x89, 0x1f, 0xb9, 0x2e, 0xbb, 0xfc, 0xc6, 0xb9, 0xe4,
+  0xb0, 0xc0, 0x33, 0xc3, 0x46, 0x36, 0x3d, 0x4f, 0x1c, 0x26, 0x16, 0x4b, 0x5d, 0x2c, 0x77, 0x31,
+  0x2b, 0x1b, 0x2a, 0xf1, 0x0c, 0x71, 0x44, 0x51, 0x35, 0xca, 0x17, 0x72, 0x2e, 0x2b, 0x9c, 0xb7,
+  0x38, 0xab, 0xd5, 0x3a, 0x6b, 0xdf, 0x93, 0xbf, 0x30, 0x54, 0xd0, 0x56, 0x32, 0x5c, 0xa7, 0x35,
+  0x86, 0x04, 0x96, 0x90, 0x44, 0x0a, 0x22, 0x64, 0xd4, 0x51, 0x41, 0x15, 0x16, 0xa2, 0xb4, 0x6b,
+  0xa4, 0x98, 0x48, 0xd3, 0x79, 0xdc, 0xc3, 0x3f, 0xea, 0xf8, 0x53, 0xe4, 0x92, 0xc9, 0x55, 0x01,
+  0x23, 0xc7, 0x02, 0x6a, 0x50, 0x21, 0x39, 0x7e, 0xf0, 0x3f, 0xf8, 0xdd, 0x5b, 0xb3, 0x38, 0x3d,
+  0xe5, 0x26, 0x85, 0xe2, 0x40, 0xcf, 0x8b, 0x6d, 0x7f, 0x8c, 0x03, 0xc1, 0x5d, 0xa0, 0xd5, 0xb0,
+  0xed, 0xef, 0x63, 0xdb, 0x6e, 0x9d, 0x00, 0xfe, 0x67, 0xe0, 0x4a, 0xeb, 0xf8, 0x6b, 0x4d, 0x60,
+  0xee, 0x93, 0xf4, 0x46, 0x47, 0x8b, 0x1c, 0x01, 0x83, 0xdb, 0xc0, 0xc5, 0x75, 0x47, 0x93, 0xf7,
+  0x80, 0xcb, 0x1d, 0x60, 0xe4, 0x49, 0x97, 0x0c, 0xc9, 0x91, 0xfc, 0xb4, 0x84, 0x62, 0x11, 0x78,
+  0x3f, 0xa3, 0x6f, 0xca, 0x03, 0x43, 0xb7, 0x40, 0xdf, 0x9a, 0xdb, 0xb7, 0xf6, 0x39, 0x4e, 0x1f,
+  0x80, 0x2c, 0xf5, 0x6a, 0xf9, 0x06, 0x38, 0x38, 0x04, 0x26, 0x4a, 0x94, 0xbd, 0xee, 0xf1, 0xee,
+  0xde, 0xee, 0xbe, 0xfd, 0x5b, 0xd3, 0xee, 0xdf, 0x0f, 0x56, 0x81, 0x72, 0x9b, 0xa3, 0x77, 0xbe,
+  0x2f, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xa0,
+  0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00,
+  0x00, 0x2e, 0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45,
+  0x07, 0xe9, 0x03, 0x15, 0x15, 0x07, 0x13, 0x0c, 0xea, 0x8b, 0x15, 0x00, 0x00, 0x00, 0x19, 0x74,
+  0x45, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x57, 0x81, 0x0e, 0x17,
+  0x00, 0x00, 0x03, 0xc8, 0x49, 0x44, 0x41, 0x54, 0x68, 0xde, 0xed, 0x99, 0x5d, 0x68, 0x5b, 0x65,
+  0x1c, 0xc6, 0x7f, 0xef, 0x39, 0x27, 0x6b, 0x9a, 0x26, 0x6b, 0xfa, 0xb1, 0xd8, 0x34, 0xfb, 0xf4,
+  0x03, 0x9d, 0xae, 0x8e, 0xe8, 0xd6, 0x76, 0x7a, 0x61, 0xeb, 0xdc, 0xf0, 0x62, 0x43, 0x10, 0xf1,
+  0xc2, 0xa2, 0x74, 0x13, 0x64, 0x08, 0x82, 0xcc, 0x49, 0x40, 0x84, 0xb1, 0x8b, 0x5d, 0xcc, 0xaf,
+  0x8b, 0x29, 0x78, 0xb5, 0x4e, 0x32, 0xe6, 0x85, 0x17, 0x82, 0x6c, 0x97, 0xae, 0xa5, 0xa2, 0x6c,
+  0xb6, 0x51, 0xbb, 0x49, 0x99, 0x4a, 0x61, 0xac, 0xba, 0x64, 0x6d, 0xda, 0xc6, 0x6c, 0x49, 0xf3,
+  0x7d, 0x8e, 0x17, 0xa7, 0x4d, 0xa3, 0xed, 0xb0, 0x27, 0x6d, 0x93, 0x13, 0xc8, 0x73, 0x73, 0xc8,
+  0xff, 0x3d, 0x39, 0x3c, 0xbf, 0xfc, 0x9f, 0xf3, 0xbe, 0xef, 0x39, 0x11, 0x2c, 0xa1, 0xee, 0xf3,
+  0x33, 0x4e, 0xe0, 0x1c, 0xf0, 0x3c, 0xa0, 0xb0, 0x06, 0xda, 0xe9, 0x94, 0xd5, 0xc3, 0x1d, 0x8e,
+  0xd7, 0x1f, 0x6f, 0x96, 0xbe, 0x58, 0xc9, 0x75, 0xa4, 0x7b, 0xd4, 0x4f, 0x00, 0x07, 0xd6, 0xca,
+  0x3c, 0x80, 0x24, 0x90, 0x2c, 0xb2, 0xe8, 0xbb, 0x36, 0xa5, 0xf6, 0xae, 0x05, 0x40, 0x3b, 0x25,
+  0x90, 0x00, 0x61, 0x91, 0x45, 0xdf, 0x48, 0x58, 0x3d, 0xb4, 0xda, 0x00, 0x12, 0x25, 0x92, 0x00,
+  0x51, 0xa3, 0x88, 0x33, 0xc5, 0x76, 0xa2, 0x64, 0x46, 0x97, 0xd3, 0x89, 0x62, 0x20, 0x4c, 0x01,
+  0xb0, 0x92, 0x38, 0x99, 0x06, 0xa0, 0xd8, 0x38, 0x99, 0x0a, 0xa0, 0x98, 0x38, 0x99, 0x0e, 0xc0,
+  0x68, 0x9c, 0x4c, 0x09, 0x60, 0x24, 0x4e, 0xa6, 0x05, 0x58, 0x6e, 0x9c, 0x94, 0x72, 0x99, 0xcb,
+  0xaa, 0x90, 0x48, 0xab, 0xcb, 0xe2, 0xd0, 0xa0, 0xef, 0xd2, 0x8d, 0x8c, 0xd8, 0xbb, 0xcd, 0x72,
+  0xd6, 0x34, 0x00, 0xbf, 0x46, 0x73, 0x1c, 0xfd, 0x36, 0x6a, 0xa0, 0x19, 0x1c, 0x01, 0xce, 0x56,
+  0x54, 0x84, 0x2a, 0x76, 0x16, 0xaa, 0x02, 0x54, 0x01, 0xaa, 0x00, 0x55, 0x80, 0x2a, 0x40, 0xc9,
+  0xa4, 0xaf, 0xc4, 0xbe, 0xc0, 0x8b, 0x40, 0xdb, 0x7c, 0x71, 0x62, 0x62, 0xc6, 0x23, 0x4b, 0xe6,
+  0x62, 0xcb, 0xa9, 0xaa, 0x07, 0x5f, 0xe0, 0x78, 0xe1, 0x62, 0xce, 0xa9, 0x5d, 0x5f, 0x0b, 0x7c,
+  0x81, 0x0f, 0x80, 0x77, 0x2b, 0xb4, 0x01, 0x1f, 0x0a, 0x7c, 0x81, 0x18, 0x50, 0x57, 0xa1, 0x00,
+  0x71, 0xc5, 0xa8, 0xf9, 0x93, 0x9d, 0x1b, 0x70, 0xd4, 0x2a, 0x08, 0x01, 0x6f, 0xf5, 0x87, 0x16,
+  0x8d, 0xf7, 0x6c, 0xb2, 0xf1, 0xec, 0x8e, 0x46, 0x9c, 0x76, 0x0b, 0xe9, 0xac, 0xca, 0xd8, 0xad,
+  0x38, 0xa7, 0x7f, 0x9a, 0x26, 0x9c, 0xd3, 0xf2, 0xe7, 0xb4, 0x59, 0x65, 0x0e, 0xed, 0x6e, 0x66,
+  0xa3, 0xab, 0x16, 0x21, 0x04, 0x93, 0x91, 0x24, 0x5f, 0x05, 0xa6, 0x18, 0x8c, 0x66, 0x8c, 0x02,
+  0xd4, 0x19, 0xde, 0x8d, 0x3e, 0xe3, 0x75, 0xd1, 0x5c, 0x6f, 0xd5, 0x3f, 0x0c, 0x84, 0x60, 0xc1,
+  0x17, 0xef, 0x7b, 0x1b, 0x78, 0x65, 0xdf, 0x36, 0x24, 0x49, 0xe4, 0x6b, 0xde, 0x87, 0x9b, 0x69,
+  0xdf, 0xde, 0xc8, 0x0b, 0xfe, 0x3f, 0x48, 0x6a, 0xf0, 0x84, 0x4d, 0xe6, 0xb3, 0xde, 0xed, 0x34,
+  0xae, 0xaf, 0xf9, 0xd7, 0x75, 0xf7, 0xb4, 0xb9, 0x38, 0xf1, 0xe5, 0x6f, 0x7c, 0x33, 0x99, 0x2a,
+  0xdf, 0x2c, 0x74, 0xe0, 0x29, 0x0f, 0x92, 0x24, 0xc8, 0xa9, 0x1a, 0xfd, 0xc3, 0x41, 0x82, 0xe1,
+  0x38, 0x00, 0x5b, 0xdc, 0x0e, 0x8e, 0xee, 0x6c, 0x00, 0xe0, 0x8d, 0xa7, 0xef, 0xcb, 0x9b, 0xbf,
+  0x7e, 0x23, 0xc2, 0xf0, 0x68, 0x18, 0x00, 0x9b, 0x55, 0xe1, 0xe5, 0x3d, 0x2d, 0xe5, 0x9b, 0x46,
+  0xdb, 0x1d, 0x0a, 0x4e, 0x87, 0x6e, 0x6c, 0xe6, 0xef, 0x24, 0x6f, 0x5e, 0x0a, 0x31, 0x38, 0x12,
+  0xce, 0x8f, 0x3f, 0xb2, 0xd1, 0x0e, 0xc0, 0x56, 0xb7, 0x3d, 0x5f, 0xf3, 0x0f, 0x06, 0x79, 0xf5,
+  0xc2, 0x38, 0xaa, 0xa6, 0xb7, 0xd1, 0xb3, 0xc1, 0x56, 0x3e, 0x80, 0xb6, 0xa6, 0x85, 0x48, 0x68,
+  0x73, 0x86, 0x12, 0x99, 0x5c, 0xbe, 0x66, 0x5d, 0x27, 0x03, 0x60, 0xb7, 0x59, 0xf2, 0xb5, 0x50,
+  0x52, 0x1f, 0x4f, 0x65, 0x35, 0x72, 0xaa, 0x86, 0x28, 0x88, 0x9e, 0xb1, 0x75, 0x60, 0x15, 0x24,
+  0x8b, 0xff, 0x7f, 0xa4, 0x2a, 0x3c, 0x16, 0xca, 0xfb, 0xd1, 0x2f, 0xf7, 0x1e, 0x2c, 0x15, 0x40,
+  0xb1, 0xea, 0xdd, 0x5a, 0x87, 0xd5, 0xa2, 0x07, 0x61, 0x36, 0xad, 0xe2, 0xbf, 0x19, 0xaf, 0x2c,
+  0x80, 0x23, 0x07, 0x1f, 0xc0, 0x59, 0xa7, 0xc7, 0x6a, 0x2a, 0x9a, 0xc4, 0xff, 0xf9, 0x68, 0x65,
+  0xed, 0x85, 0xfa, 0x03, 0x21, 0xa2, 0x77, 0x53, 0x45, 0x7f, 0x7f, 0xd5, 0x00, 0x0a, 0xd6, 0xa9,
+  0x25, 0xa5, 0xfd, 0xe7, 0x38, 0xaf, 0xf7, 0x2e, 0x87, 0x89, 0xcd, 0x66, 0xca, 0x0f, 0x70, 0x75,
+  0xba, 0xe0, 0x57, 0x14, 0xfa, 0xdd, 0x58, 0x6b, 0x91, 0xf3, 0xa5, 0x44, 0x5a, 0x9f, 0x71, 0xe2,
+  0x89, 0x05, 0xb3, 0x9b, 0x6c, 0x7a, 0x82, 0x15, 0xa5, 0x78, 0x1b, 0x2b, 0xba, 0x07, 0x4e, 0x77,
+  0xbb, 0x01, 0x50, 0x35, 0x78, 0x7b, 0x20, 0x44, 0xe4, 0x6e, 0x8a, 0x06, 0x47, 0x0d, 0x4d, 0xf5,
+  0x56, 0x3e, 0xed, 0x6a, 0xe1, 0xd1, 0xfb, 0x9d, 0xf9, 0x73, 0x7f, 0xff, 0x33, 0x06, 0xc0, 0xf8,
+  0xed, 0x38, 0x5b, 0xdc, 0x0e, 0x00, 0x5e, 0xeb, 0xf2, 0xb0, 0x37, 0x3c, 0x8b, 0xab, 0xd1, 0x56,
+  0x9e, 0x0e, 0xec, 0x6f, 0x6f, 0x65, 0x7f, 0x7b, 0x2b, 0xcf, 0xed, 0x76, 0x83, 0x06, 0x17, 0x7f,
+  0xb8, 0x85, 0xaa, 0x6a, 0xc8, 0xb2, 0x60, 0x5f, 0xa7, 0x07, 0x8f, 0x4b, 0xdf, 0x66, 0xdd, 0x0c,
+  0xc5, 0xf8, 0xe4, 0x5a, 0x04, 0x80, 0x73, 0x57, 0x26, 0xf3, 0x91, 0x79, 0x68, 0x73, 0x3d, 0x5d,
+  0x4f, 0xba, 0xb9, 0x13, 0x4f, 0x97, 0xae, 0x03, 0x03, 0x3f, 0x4f, 0xb0, 0xbe, 0x56, 0x59, 0x9c,
+  0x7f, 0x01, 0x27, 0x47, 0x22, 0xfc, 0x15, 0x49, 0xd1, 0xbd, 0xa3, 0x09, 0xbb, 0x4d, 0x41, 0xcd,
+  0x69, 0x8c, 0x05, 0x63, 0x7c, 0x3c, 0x3c, 0x4d, 0x72, 0x2e, 0xfc, 0xdf, 0x45, 0x33, 0x1c, 0xf3,
+  0x5f, 0xa7, 0xa7, 0xc3, 0x45, 0x83, 0x63, 0x1d, 0xb1, 0x44, 0x86, 0x33, 0xdf, 0x4f, 0xf0, 0x92,
+  0xb7, 0x89, 0x3b, 0x89, 0xac, 0x61, 0x00, 0x81, 0x2f, 0x10, 0x02, 0x5a, 0xa8, 0x4c, 0x85, 0x24,
+  0xe0, 0x1d, 0x20, 0x5d, 0x81, 0xe6, 0xd3, 0xc0, 0x31, 0x31, 0xf7, 0x48, 0xd9, 0x02, 0x6c, 0x9e,
+  0x1f, 0xe9, 0x7c, 0xb0, 0xb5, 0x4f, 0x48, 0xe2, 0x31, 0x33, 0xb9, 0xd5, 0x54, 0x6d, 0xf4, 0xca,
+  0x58, 0xf0, 0x70, 0x41, 0x69, 0x9c, 0x53, 0xbb, 0x6e, 0x2f, 0xb9, 0xfb, 0xe8, 0x3e, 0x3f, 0xf3,
+  0x23, 0x25, 0xfa, 0xaf, 0xd8, 0x80, 0x86, 0x06, 0x7a, 0x1a, 0x3b, 0xaa, 0xaf, 0x55, 0x2a, 0x05,
+  0x40, 0x35, 0xa1, 0x57, 0xd5, 0x08, 0xc0, 0x90, 0x09, 0x01, 0x86, 0x8c, 0x00, 0x1c, 0x07, 0x2e,
+  0x00, 0x59, 0x13, 0x18, 0xcf, 0x02, 0x17, 0xe7, 0x3c, 0x2d, 0xd2, 0x3f, 0x47, 0x00, 0x35, 0xa9,
+  0x0a, 0x65, 0x79, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// logo.png: 24842 bytes, 24842 as sent
+static const uint8_t webAsset_logo_png[] PROGMEM = {
+  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x3c, 0x08, 0x02, 0x00, 0x00, 0x00, 0xd7, 0x31, 0x62,
+  0x4f, 0x00, 0x00, 0x3b, 0x10, 0x63, 0x61, 0x42, 0x58, 0x00, 0x00, 0x3b, 0x10, 0x6a, 0x75, 0x6d,
+  0x62, 0x00, 0x00, 0x00, 0x1e, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x32, 0x70, 0x61, 0x00, 0x11, 0x00,
+  0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63, 0x32, 0x70, 0x61, 0x00, 0x00,
+  0x00, 0x3a, 0xea, 0x6a, 0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x47, 0x6a, 0x75, 0x6d, 0x64, 0x63,
+  0x32, 0x6d, 0x61, 0x00, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03,
+  0x75, 0x72, 0x6e, 0x3a, 0x75, 0x75, 0x69, 0x64, 0x3a, 0x38, 0x39, 0x39, 0x38, 0x37, 0x61, 0x30,
+  0x64, 0x2d, 0x65, 0x33, 0x30, 0x63, 0x2d, 0x34, 0x65, 0x31, 0x37, 0x2d, 0x62, 0x63, 0x36, 0x34,
+  0x2d, 0x61, 0x32, 0x37, 0x33, 0x61, 0x65, 0x62, 0x33, 0x61, 0x34, 0x66, 0x37, 0x00, 0x00, 0x00,
+  0x0d, 0x0b, 0x6a, 0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x29, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x32,
+  0x61, 0x73, 0x00, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63,
+  0x32, 0x70, 0x61, 0x2e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00,
+  0x00, 0x0b, 0x5c, 0x6a, 0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x33, 0x6a, 0x75, 0x6d, 0x64, 0x40,
+  0xcb, 0x0c, 0x32, 0xbb, 0x8a, 0x48, 0x9d, 0xa7, 0x0b, 0x2a, 0xd6, 0xf4, 0x7f, 0x43, 0x69, 0x03,
+  0x63, 0x32, 0x70, 0x61, 0x2e, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x6e, 0x61, 0x69, 0x6c, 0x2e, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x2e, 0x6a, 0x70, 0x65, 0x67, 0x00, 0x00, 0x00, 0x00, 0x14, 0x62, 0x66,
+  0x64, 0x62, 0x00, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x6a, 0x70, 0x65, 0x67, 0x00, 0x00, 0x00,
+  0x0b, 0x0d, 0x62, 0x69, 0x64, 0x62, 0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46,
+  0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00,
+  0x3c, 0x00, 0x75, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xdb, 0x00,
+  0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08,
+  0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e, 0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18,
+  0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a, 0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c,
+  0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f, 0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28,
+  0x29, 0x28, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x0a, 0x13, 0x0a, 0x0a,
+  0x13, 0x28, 0x1a, 0x16, 0x1a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+  0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01,
+  0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03,
+  0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14,
+  0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62,
+  0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34,
+  0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54,
+  0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74,
+  0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93,
+  0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+  0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5,
+  0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff,
+  0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04,
+  0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12,
+  0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1,
+  0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1,
+  0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43,
+  0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63,
+  0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+  0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+  0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3,
+  0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+  0x03, 0x11, 0x00, 0x3f, 0x00, 0xf9, 0xd2, 0x80, 0x0a, 0x00, 0x28, 0x00, 0xa0, 0x02, 0x80, 0x24,
+  0x58, 0x64, 0x77, 0x44, 0x89, 0x5a, 0x46, 0x7c, 0xed, 0x08, 0xa4, 0x96, 0xfa, 0x0e, 0xb4, 0x2d,
+  0x44, 0xda, 0x8a, 0xbb, 0x10, 0x46, 0x4a, 0xb3, 0x02, 0x08, 0x00, 0x11, 0xef, 0x9e, 0xdf, 0x5f,
+  0xf0, 0xa0, 0xb4, 0xae, 0x9e, 0xbf, 0xf0, 0x4d, 0x3d, 0x53, 0x44, 0xb9, 0xd3, 0xad, 0xb4, 0xe9,
+  0xee, 0x3e, 0x44, 0xbc, 0x8f, 0xcc, 0x52, 0x7a, 0x01, 0x92, 0x33, 0xfa, 0x7f, 0x2f, 0x5a, 0xce,
+  0x9d, 0x58, 0xd4, 0x94, 0xa0, 0x9e, 0xb1, 0x76, 0x67, 0x45, 0x5c, 0x2b, 0xa7, 0x18, 0xc9, 0xbd,
+  0xcc, 0xdf, 0x26, 0x43, 0xbb, 0x6a, 0xb3, 0x15, 0x04, 0xb0, 0x0a, 0x4e, 0xd0, 0x3a, 0x93, 0xe8,
+  0x2b, 0x43, 0x95, 0xb4, 0xb7, 0x1a, 0xc8, 0x55, 0x41, 0x24, 0x64, 0xf2, 0x07, 0xb7, 0xad, 0x2b,
+  0x80, 0xda, 0x60, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05,
+  0x00, 0x5b, 0xb6, 0x8e, 0x1b, 0x8f, 0x94, 0xb4, 0x71, 0x3a, 0xc6, 0x40, 0x56, 0xce, 0x25, 0x6c,
+  0xf0, 0x33, 0x9f, 0x94, 0x91, 0x9e, 0x7a, 0x64, 0x51, 0x15, 0xae, 0xa2, 0x73, 0xe5, 0x69, 0xda,
+  0xfd, 0xce, 0x87, 0x41, 0xd3, 0xe6, 0xd6, 0x67, 0x91, 0x62, 0x84, 0x24, 0x87, 0x6c, 0x8f, 0x78,
+  0xcc, 0xca, 0x2d, 0xd4, 0x1c, 0x12, 0x00, 0xc6, 0x33, 0xcf, 0x1d, 0x4e, 0x71, 0xd8, 0x9a, 0xe5,
+  0xc5, 0xd7, 0x54, 0x2d, 0x36, 0xfe, 0x5d, 0xdf, 0xf5, 0xf7, 0x1e, 0x8e, 0x0f, 0x07, 0x2a, 0xf1,
+  0xf6, 0x72, 0x8a, 0xb7, 0x77, 0xb2, 0x5f, 0xd7, 0xde, 0x6e, 0x45, 0xa6, 0xf8, 0x6b, 0x4a, 0x88,
+  0x5b, 0x5f, 0x34, 0xaf, 0x79, 0x33, 0x15, 0xf3, 0x15, 0x18, 0xa2, 0x47, 0xbb, 0x06, 0x50, 0x17,
+  0xf8, 0x42, 0x9c, 0xf2, 0x4e, 0x08, 0xc6, 0x2b, 0x8e, 0x35, 0x71, 0x55, 0xe6, 0x9c, 0x34, 0x8a,
+  0xdf, 0xbf, 0xa1, 0xe9, 0xd4, 0x86, 0x0f, 0x07, 0x4b, 0xdf, 0xf8, 0xe5, 0xb6, 0xe9, 0x6b, 0xb3,
+  0xf4, 0xf9, 0xef, 0xa5, 0x8d, 0xaf, 0x19, 0x6a, 0x96, 0x13, 0xde, 0xd9, 0x2d, 0xf5, 0x90, 0x36,
+  0x76, 0x8d, 0xe5, 0xc2, 0x91, 0x06, 0x2c, 0x60, 0x2b, 0x8d, 0xa3, 0x1f, 0x78, 0x85, 0x55, 0x7d,
+  0xcb, 0xc6, 0x0e, 0x2b, 0x1c, 0x36, 0x1a, 0x71, 0x8b, 0x9d, 0x1a, 0x97, 0x94, 0xd5, 0xdf, 0x94,
+  0xaf, 0xfd, 0x22, 0xfd, 0xba, 0x84, 0x25, 0xf5, 0xba, 0x7c, 0xb0, 0x84, 0x92, 0x8b, 0xbf, 0xc4,
+  0x9a, 0xd5, 0xab, 0x7c, 0x9f, 0xfc, 0x13, 0x0d, 0xfc, 0x37, 0x61, 0x7c, 0xcd, 0x77, 0xe1, 0xd9,
+  0x37, 0xc2, 0xca, 0xa5, 0x20, 0x94, 0x95, 0xfb, 0x47, 0x39, 0x64, 0x53, 0xc1, 0xc6, 0x30, 0x39,
+  0x18, 0x27, 0x8e, 0xd5, 0xaa, 0xc7, 0x54, 0xa4, 0xb9, 0x31, 0x0a, 0xcf, 0xab, 0x5d, 0x3c, 0xdf,
+  0xf5, 0xb1, 0x15, 0xb2, 0xea, 0x15, 0x9f, 0x3e, 0x1f, 0x55, 0xa3, 0x49, 0xad, 0xfb, 0xdb, 0x6f,
+  0xcb, 0xca, 0xe7, 0x2d, 0x75, 0x14, 0x52, 0x4a, 0xd0, 0x3a, 0x0b, 0x28, 0x7c, 0xc3, 0x24, 0x9b,
+  0xf7, 0x30, 0x87, 0x92, 0xb8, 0x03, 0xa9, 0xc7, 0x3c, 0x77, 0x2d, 0x8c, 0x71, 0x5e, 0xb5, 0x3f,
+  0x85, 0x5d, 0xdf, 0xcc, 0xf9, 0xfc, 0x4f, 0x35, 0x39, 0xb6, 0xe3, 0xe4, 0x95, 0xff, 0x00, 0xab,
+  0x7c, 0xf6, 0x31, 0x9c, 0xa9, 0x54, 0x0a, 0x80, 0x6d, 0x18, 0x63, 0x92, 0x49, 0x34, 0x22, 0x08,
+  0xe9, 0x80, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x12, 0x5b, 0xc4, 0xf3,
+  0xcc, 0x91, 0xc5, 0x1b, 0xc8, 0xc4, 0xfd, 0xd5, 0xea, 0x47, 0x7f, 0xff, 0x00, 0x5d, 0x29, 0x49,
+  0x45, 0x5d, 0x95, 0x15, 0x77, 0x63, 0x5d, 0x66, 0x8e, 0x1b, 0x3b, 0xdb, 0x5f, 0xb7, 0x81, 0x1b,
+  0xf9, 0x7b, 0xa0, 0x8d, 0x95, 0xc4, 0xa5, 0x7e, 0xee, 0x48, 0xf4, 0xcf, 0x5c, 0xd3, 0x54, 0xe9,
+  0xd4, 0xb5, 0x57, 0xba, 0xdb, 0xb9, 0xad, 0x4a, 0x8e, 0x9b, 0xe4, 0x82, 0xba, 0x7b, 0xea, 0xba,
+  0x6d, 0xd3, 0xfa, 0xea, 0x6f, 0x69, 0xf7, 0xf1, 0xa6, 0x8f, 0x0d, 0x96, 0x91, 0x7e, 0x12, 0x77,
+  0x19, 0xb8, 0x89, 0xc2, 0x11, 0xbc, 0x0e, 0xc7, 0xae, 0x33, 0x80, 0x31, 0xbb, 0xa7, 0x04, 0x53,
+  0x79, 0x7d, 0x1c, 0x43, 0x8c, 0xef, 0x79, 0x1f, 0x43, 0x84, 0x4a, 0x78, 0x75, 0x46, 0x8d, 0x55,
+  0x77, 0xba, 0x69, 0x68, 0xfd, 0x77, 0x6b, 0xd2, 0xff, 0x00, 0x21, 0xba, 0x35, 0xdf, 0x99, 0xa7,
+  0x5c, 0x69, 0xd0, 0x34, 0x0b, 0xa8, 0x99, 0xf7, 0xb4, 0x8c, 0x43, 0x2d, 0xd8, 0x07, 0xfd, 0x4b,
+  0x31, 0xe0, 0x0c, 0x8c, 0xaf, 0x45, 0x63, 0xc1, 0xe4, 0x66, 0xba, 0x29, 0xc7, 0x95, 0x38, 0x46,
+  0xd7, 0xfc, 0xfc, 0x8f, 0x89, 0xcc, 0x69, 0xd4, 0x8e, 0x2b, 0xda, 0x57, 0x97, 0x34, 0x56, 0x9a,
+  0x6a, 0xa3, 0xfd, 0xe5, 0xdf, 0xcf, 0xaa, 0xdd, 0x10, 0xe9, 0x31, 0xcf, 0x71, 0x70, 0xae, 0x93,
+  0xbd, 0xb2, 0xda, 0xa0, 0x69, 0x2e, 0x67, 0xce, 0x2c, 0xd4, 0x39, 0xe1, 0x06, 0x73, 0x9e, 0x80,
+  0x2f, 0x52, 0x72, 0x3a, 0x66, 0xb1, 0xa3, 0x17, 0x19, 0x36, 0x92, 0x57, 0xd4, 0xe8, 0xcc, 0x6b,
+  0xd2, 0x74, 0x69, 0xc3, 0x9a, 0x53, 0x76, 0xb7, 0x2b, 0xd9, 0xbf, 0x2f, 0xee, 0xdb, 0x56, 0xff,
+  0x00, 0xe0, 0x0d, 0xbc, 0xd5, 0xcb, 0xeb, 0xb7, 0x17, 0x7a, 0x42, 0xad, 0x9c, 0x5c, 0x1f, 0x2c,
+  0xe3, 0x92, 0x3f, 0x88, 0xaf, 0xdd, 0xc9, 0x23, 0x24, 0x0c, 0x00, 0x4e, 0x06, 0x3a, 0xd5, 0xcf,
+  0x07, 0x4f, 0x16, 0xde, 0xc9, 0x23, 0xbf, 0x22, 0x86, 0x22, 0x9d, 0x2b, 0x4a, 0xa2, 0x7c, 0xbd,
+  0xff, 0x00, 0x0b, 0x5f, 0x74, 0xb6, 0xd4, 0xa9, 0xa9, 0x6a, 0x31, 0x5e, 0x6b, 0x30, 0x5e, 0x3d,
+  0xd6, 0xd7, 0x0c, 0xad, 0x24, 0xea, 0xa3, 0x28, 0xe0, 0xe4, 0x30, 0x03, 0x1d, 0x31, 0xef, 0xd2,
+  0xa2, 0x58, 0x4c, 0x3d, 0x14, 0xa8, 0xc2, 0x57, 0x5a, 0xdc, 0xec, 0xcc, 0xeb, 0xa9, 0x4f, 0xda,
+  0xc2, 0x5c, 0xf2, 0xeb, 0xb2, 0xd7, 0xa5, 0xbf, 0xa7, 0xe6, 0x51, 0xbc, 0x41, 0x7f, 0x2c, 0xf2,
+  0xc5, 0x72, 0x97, 0x77, 0x2f, 0x2b, 0x31, 0x3e, 0x72, 0x6f, 0x72, 0x4e, 0x4b, 0x6d, 0xea, 0x49,
+  0xf6, 0xef, 0x59, 0x4b, 0x92, 0x8a, 0x54, 0xd6, 0xcb, 0xee, 0x39, 0x1a, 0xf6, 0xb1, 0x72, 0xde,
+  0x4f, 0xcd, 0x75, 0xdf, 0xb5, 0xcc, 0xa2, 0x08, 0x24, 0x11, 0x82, 0x38, 0x20, 0xd5, 0x1c, 0xa2,
+  0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x1e, 0xb9, 0xf0, 0x23, 0xc2, 0xda,
+  0x66, 0xb3, 0xa8, 0xdd, 0xde, 0x78, 0x82, 0x3f, 0x33, 0x48, 0xd3, 0x6c, 0xdf, 0x53, 0xbb, 0x8b,
+  0x1c, 0x4c, 0xaa, 0xc4, 0x47, 0x19, 0xf5, 0x5f, 0x91, 0xd8, 0x8e, 0xe4, 0x28, 0x3c, 0x56, 0x4b,
+  0xde, 0x9b, 0x6f, 0xa1, 0x6f, 0xdd, 0x8a, 0x5d, 0xce, 0xe3, 0xc1, 0xfe, 0x2b, 0xf0, 0xd7, 0xc6,
+  0x5d, 0x46, 0xf7, 0xc2, 0x3a, 0xbf, 0x85, 0x34, 0xfd, 0x28, 0xcf, 0x04, 0x92, 0x69, 0xd7, 0x56,
+  0x60, 0x79, 0xb0, 0x95, 0x1d, 0x09, 0x00, 0x61, 0xb0, 0x41, 0xe3, 0x83, 0x82, 0x08, 0xad, 0x48,
+  0x34, 0xa7, 0xf0, 0xb5, 0x97, 0x8b, 0xfe, 0x00, 0xcf, 0x2c, 0xba, 0x3e, 0x95, 0x1f, 0x8a, 0xed,
+  0xa3, 0x9d, 0x63, 0x9a, 0xd2, 0xd9, 0x63, 0x92, 0x77, 0xb5, 0x90, 0xa9, 0xc1, 0x03, 0x27, 0x72,
+  0xa1, 0x04, 0x77, 0x26, 0x80, 0x28, 0x78, 0xd7, 0xe1, 0xde, 0x81, 0xe1, 0xef, 0x84, 0x3e, 0x1e,
+  0x57, 0xd3, 0xac, 0xdf, 0x5c, 0x8a, 0xfa, 0xc6, 0x2b, 0xeb, 0x8d, 0x9f, 0xbc, 0x2d, 0x2b, 0x82,
+  0xe8, 0xc7, 0xd3, 0x0e, 0x06, 0x3d, 0x31, 0x40, 0x1b, 0x7a, 0x5f, 0xc3, 0xcf, 0x05, 0x5c, 0xfc,
+  0x4e, 0xf1, 0xce, 0x83, 0x79, 0xa0, 0xd9, 0x47, 0x63, 0x6f, 0x6b, 0x69, 0x3d, 0xbb, 0x82, 0x57,
+  0xec, 0xfe, 0x62, 0x15, 0x6d, 0xbc, 0xf0, 0x73, 0xf3, 0x67, 0xd6, 0x80, 0x38, 0xd4, 0xf8, 0x77,
+  0xa7, 0xe8, 0x5e, 0x16, 0xd1, 0x2d, 0xb5, 0x7d, 0x2e, 0xde, 0x5d, 0x59, 0x7c, 0x65, 0x1e, 0x9b,
+  0x35, 0xcb, 0xa7, 0x33, 0xdb, 0x96, 0xc8, 0x1f, 0xee, 0xb2, 0xe0, 0xe3, 0xde, 0x80, 0x3a, 0x3f,
+  0x8a, 0x91, 0xc7, 0xa0, 0x5f, 0x7d, 0x92, 0xd7, 0xe1, 0x86, 0x95, 0x69, 0xa3, 0xae, 0xa5, 0x67,
+  0x14, 0x7a, 0xc2, 0xac, 0x43, 0xcc, 0x1e, 0x74, 0x6d, 0x80, 0xa1, 0x77, 0x00, 0xd8, 0x2a, 0x7d,
+  0xb3, 0x40, 0x1d, 0x8d, 0xd4, 0x96, 0xda, 0xc7, 0xc5, 0x0d, 0x53, 0xc1, 0x17, 0xfe, 0x08, 0xd3,
+  0xdf, 0xc3, 0x62, 0xcf, 0xcc, 0x7d, 0x44, 0x5a, 0xed, 0xda, 0x4a, 0x2b, 0x7d, 0xed, 0xbb, 0x47,
+  0x24, 0x81, 0x83, 0x90, 0x46, 0x68, 0x03, 0xe3, 0xad, 0x6e, 0x34, 0x8f, 0x50, 0x91, 0x62, 0x93,
+  0xcd, 0x40, 0x59, 0x44, 0x9f, 0xf3, 0xd0, 0x06, 0x65, 0x56, 0xfc, 0x54, 0x03, 0xf8, 0xd4, 0x43,
+  0x4b, 0xa3, 0x5a, 0xba, 0xda, 0x4f, 0x76, 0x8a, 0x15, 0x66, 0x41, 0x40, 0x05, 0x00, 0x14, 0x00,
+  0x50, 0x01, 0x40, 0x1e, 0xb7, 0xf0, 0x47, 0xc5, 0x1a, 0x7e, 0x8d, 0x73, 0x77, 0x6d, 0xad, 0xcb,
+  0xe4, 0xe9, 0x3a, 0x8d, 0x93, 0x69, 0xb7, 0x52, 0xff, 0x00, 0x0c, 0x47, 0x73, 0x32, 0x17, 0xf4,
+  0x56, 0x0e, 0xcb, 0xbb, 0xa0, 0x22, 0xb3, 0x83, 0x51, 0x9b, 0x8b, 0xeb, 0xa9, 0x72, 0x4d, 0xc1,
+  0x49, 0x74, 0xd0, 0xf5, 0x4f, 0x04, 0x58, 0x78, 0x6f, 0x46, 0xb6, 0xb4, 0x8b, 0xc3, 0xba, 0xb6,
+  0x89, 0xad, 0x78, 0xa3, 0x4a, 0xb4, 0xb8, 0x8e, 0xc2, 0x48, 0x67, 0x48, 0x1a, 0x48, 0x9c, 0xe4,
+  0x09, 0x4a, 0x92, 0x09, 0x1d, 0xdb, 0xae, 0x33, 0xc7, 0x35, 0xd1, 0x64, 0x64, 0x70, 0x5a, 0x47,
+  0xc4, 0x2d, 0x3f, 0xc3, 0xda, 0x3f, 0x80, 0x57, 0xfb, 0x51, 0x6e, 0x6e, 0x6c, 0xf5, 0x0b, 0xb9,
+  0x75, 0x68, 0xe0, 0x2c, 0x4a, 0xa4, 0xa5, 0xc3, 0x1e, 0x98, 0x39, 0xdd, 0x91, 0x8f, 0x41, 0x53,
+  0x74, 0xac, 0x32, 0x8e, 0xa1, 0xf1, 0x07, 0x4d, 0xd6, 0x7c, 0x19, 0xa9, 0xc7, 0x7f, 0x76, 0xcb,
+  0xaa, 0x5d, 0xf8, 0x92, 0x2d, 0x40, 0x40, 0x63, 0x73, 0xb6, 0xdd, 0x5d, 0x30, 0x73, 0x8c, 0x70,
+  0xab, 0xd3, 0x39, 0xe2, 0x8b, 0xe8, 0x16, 0x34, 0xf5, 0xef, 0x1e, 0xf8, 0x76, 0xeb, 0x5d, 0xf8,
+  0x91, 0x77, 0x6f, 0xa8, 0xb9, 0x4d, 0x5b, 0x4c, 0x86, 0xd6, 0xc1, 0x84, 0x32, 0x03, 0x2b, 0xaa,
+  0x1c, 0xf6, 0xf9, 0x70, 0x48, 0xe4, 0xe2, 0x8b, 0xad, 0x42, 0xc3, 0xb5, 0x3f, 0x89, 0xba, 0x56,
+  0xbf, 0xe1, 0x4f, 0x05, 0x8d, 0x46, 0xf3, 0xca, 0xd6, 0x2c, 0xf5, 0x7b, 0x59, 0xef, 0xd5, 0xa3,
+  0x6e, 0x12, 0x3c, 0x86, 0x97, 0x38, 0xc1, 0x04, 0x60, 0xe3, 0xaf, 0x34, 0x5c, 0x56, 0x1b, 0xf1,
+  0x2b, 0x52, 0xf0, 0xd6, 0xaf, 0x75, 0x73, 0xac, 0x58, 0x7c, 0x42, 0xb9, 0xbb, 0x2d, 0x79, 0x6f,
+  0x3a, 0x68, 0xe5, 0x9b, 0xc9, 0x1b, 0x64, 0x40, 0x48, 0x07, 0xa6, 0xd1, 0xb9, 0xba, 0x7a, 0xd0,
+  0xed, 0xdc, 0x15, 0xce, 0x9b, 0x51, 0xf8, 0x97, 0x6b, 0xe2, 0x0f, 0x19, 0x78, 0x93, 0xc3, 0x37,
+  0x7e, 0x21, 0x81, 0x3c, 0x2b, 0xa8, 0xd8, 0xb4, 0x56, 0x77, 0xe9, 0x2f, 0x96, 0x91, 0x4c, 0x50,
+  0x16, 0x1e, 0x67, 0x1d, 0x72, 0x78, 0x3e, 0x98, 0xef, 0x45, 0xd3, 0x76, 0x1d, 0x9a, 0x57, 0x3e,
+  0x6d, 0xd4, 0xe3, 0x29, 0x73, 0xcb, 0x46, 0xdc, 0x6c, 0xcc, 0x6c, 0x0a, 0x65, 0x7e, 0x53, 0xb4,
+  0x8e, 0x31, 0xc6, 0x47, 0xb1, 0x15, 0x9c, 0x74, 0xd0, 0xda, 0xab, 0xe6, 0x6a, 0x7d, 0xd7, 0xe5,
+  0xa1, 0x52, 0xa8, 0xc8, 0x28, 0x00, 0xa0, 0x02, 0x80, 0x0a, 0x00, 0x28, 0x02, 0x5b, 0x79, 0xe5,
+  0xb7, 0x93, 0xcc, 0xb7, 0x95, 0xe2, 0x7c, 0x63, 0x72, 0x1c, 0x1c, 0x7a, 0x54, 0xca, 0x2a, 0x4a,
+  0xd2, 0x57, 0x1a, 0x93, 0x8b, 0xba, 0x66, 0xa5, 0xc5, 0xe5, 0x85, 0xd5, 0xd1, 0x63, 0xf6, 0xe2,
+  0xbf, 0x75, 0x3c, 0xef, 0x29, 0xf0, 0x3e, 0xa3, 0x6e, 0x3a, 0xf6, 0xa8, 0xa4, 0xa7, 0x4d, 0x59,
+  0x28, 0xeb, 0xea, 0x69, 0xcd, 0xcd, 0x2f, 0xf3, 0xfe, 0x91, 0x6e, 0xc1, 0xed, 0xd5, 0xe2, 0x05,
+  0x8a, 0xda, 0x86, 0xc0, 0x29, 0x21, 0x8d, 0x89, 0x24, 0x8c, 0x72, 0x48, 0x19, 0x23, 0x19, 0x04,
+  0xfe, 0x19, 0xc8, 0xea, 0x55, 0x26, 0xa2, 0xa2, 0xb4, 0x7d, 0xf5, 0xb1, 0xb5, 0x6a, 0x9c, 0x94,
+  0xb9, 0xa3, 0x05, 0xf2, 0x6f, 0xcf, 0xcd, 0xae, 0x9f, 0x71, 0x6e, 0xda, 0x45, 0x94, 0xdd, 0x59,
+  0xd9, 0x49, 0x2c, 0xd3, 0xcb, 0x28, 0x58, 0x98, 0xca, 0xe8, 0x6d, 0xd4, 0x0c, 0xb1, 0x03, 0x24,
+  0x30, 0xea, 0x39, 0x39, 0xe0, 0x7a, 0xd1, 0x7a, 0xd2, 0xa9, 0x15, 0x0a, 0x8d, 0x74, 0x6b, 0xb8,
+  0x65, 0xd3, 0x9d, 0x77, 0xec, 0x25, 0x1b, 0xb9, 0x5a, 0xce, 0xfb, 0x7f, 0x48, 0x92, 0xf6, 0x29,
+  0xb4, 0xe9, 0xb4, 0xf9, 0x9e, 0x49, 0xae, 0xa0, 0x68, 0xc4, 0xad, 0x09, 0xb9, 0x20, 0xcc, 0xbb,
+  0x88, 0x39, 0xc7, 0x2a, 0x73, 0xc6, 0x3d, 0xbe, 0xb5, 0xd5, 0x5e, 0x15, 0x25, 0x45, 0xba, 0x73,
+  0x69, 0xa5, 0xbf, 0xea, 0x76, 0xdf, 0x0f, 0x39, 0xca, 0x34, 0x6e, 0xfd, 0x96, 0x92, 0x4e, 0xeb,
+  0x9b, 0xbd, 0xbf, 0x22, 0x8b, 0x7d, 0x86, 0x54, 0xbe, 0x32, 0xdc, 0xca, 0xc7, 0x77, 0xee, 0xf0,
+  0xe7, 0x11, 0xe4, 0x70, 0x06, 0x4f, 0xcc, 0x09, 0xe0, 0x82, 0x3d, 0xf2, 0x2b, 0x97, 0x9e, 0xa5,
+  0xbe, 0x3b, 0xdb, 0x7f, 0x33, 0xc5, 0xa9, 0x5e, 0x52, 0xab, 0x75, 0x0b, 0x27, 0xb2, 0xbe, 0xdf,
+  0xd2, 0xf3, 0x29, 0x38, 0x82, 0x25, 0xc5, 0xe3, 0xb6, 0xe5, 0x39, 0xd9, 0x1a, 0x87, 0xee, 0x47,
+  0x56, 0x61, 0x9e, 0x47, 0xa5, 0x3a, 0x95, 0xa6, 0xd2, 0xb4, 0x57, 0x7d, 0x6e, 0x76, 0xd6, 0x8c,
+  0x62, 0xbe, 0x14, 0xbe, 0xfb, 0xef, 0x6e, 0xaf, 0xf4, 0x21, 0x9a, 0xf6, 0x11, 0x6d, 0xb2, 0xd6,
+  0x4b, 0xf1, 0x28, 0x60, 0x01, 0x92, 0x44, 0xd9, 0xb3, 0x07, 0x23, 0x68, 0x1d, 0x73, 0x8e, 0xfe,
+  0xb5, 0xc6, 0xa1, 0x27, 0x2b, 0xca, 0xd6, 0x32, 0x55, 0xe6, 0x95, 0x94, 0x99, 0x42, 0x59, 0x64,
+  0x94, 0x83, 0x2b, 0x96, 0x20, 0x60, 0x67, 0xb5, 0x6a, 0x92, 0x5b, 0x19, 0xca, 0x72, 0x9f, 0xc4,
+  0xee, 0x32, 0x99, 0x21, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x01,
+  0x6a, 0xd6, 0xe0, 0x86, 0x8e, 0x29, 0x26, 0x78, 0x60, 0xe8, 0xcc, 0x89, 0xb8, 0x81, 0xc9, 0xe9,
+  0xf5, 0xf7, 0xa3, 0x47, 0x6b, 0xf4, 0x1b, 0xa9, 0x38, 0xc7, 0xdc, 0x2c, 0xda, 0x6a, 0x66, 0xdc,
+  0x24, 0xbb, 0x09, 0x9c, 0x72, 0x1c, 0x36, 0x0a, 0x9d, 0xc0, 0xe7, 0x8e, 0xbc, 0x64, 0x01, 0xd0,
+  0x7e, 0x14, 0xa6, 0x9b, 0x51, 0x69, 0xda, 0xd7, 0x3a, 0x96, 0x26, 0xd6, 0x6d, 0x6a, 0xaf, 0xaf,
+  0xcf, 0xfa, 0xb7, 0x63, 0x5f, 0x5a, 0xd5, 0x6d, 0xda, 0x68, 0x6e, 0x52, 0x00, 0x56, 0x5d, 0xae,
+  0xf1, 0x83, 0xb3, 0x79, 0xfe, 0x22, 0x08, 0xe8, 0x3d, 0x0f, 0x62, 0x7d, 0x45, 0x74, 0x57, 0xc5,
+  0x7b, 0x6a, 0x2a, 0x94, 0x34, 0x6f, 0x7f, 0x5e, 0x9f, 0xe6, 0x7a, 0x98, 0xec, 0xc2, 0x33, 0x84,
+  0x5a, 0x5a, 0xbd, 0x65, 0x6d, 0x2e, 0xfb, 0xfd, 0xdf, 0x8f, 0xa1, 0x88, 0x6e, 0x83, 0x16, 0x3e,
+  0x63, 0x43, 0xb6, 0x3d, 0xc8, 0x11, 0x77, 0x6e, 0x7c, 0xf0, 0x0f, 0xa7, 0x5e, 0x4f, 0xb0, 0xe2,
+  0xb1, 0x69, 0x59, 0x2f, 0x23, 0xc6, 0xa9, 0x5e, 0x76, 0x8c, 0x61, 0xb6, 0x97, 0xff, 0x00, 0x32,
+  0xa4, 0xd2, 0xb4, 0xcc, 0xa5, 0xce, 0x58, 0x0c, 0x67, 0xd7, 0x92, 0x7f, 0xad, 0x2e, 0x89, 0x19,
+  0x4a, 0x4e, 0x4e, 0xec, 0x8e, 0x81, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14,
+  0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x02, 0xd0, 0x02, 0x50, 0x01, 0x40, 0x05,
+  0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x7f, 0xff, 0xd9, 0x00, 0x00, 0x00, 0xd3, 0x6a,
+  0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x26, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x62, 0x6f, 0x72, 0x00,
+  0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63, 0x32, 0x70, 0x61,
+  0x2e, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x63, 0x62, 0x6f,
+  0x72, 0xa1, 0x67, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x81, 0xa3, 0x66, 0x61, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x6c, 0x63, 0x32, 0x70, 0x61, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+  0x6d, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x68, 0x43,
+  0x61, 0x6e, 0x76, 0x61, 0x20, 0x41, 0x49, 0x71, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x53,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x54, 0x79, 0x70, 0x65, 0x78, 0x53, 0x68, 0x74, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x63, 0x76, 0x2e, 0x69, 0x70, 0x74, 0x63, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6e, 0x65,
+  0x77, 0x73, 0x63, 0x6f, 0x64, 0x65, 0x73, 0x2f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x74, 0x79, 0x70, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x65, 0x57, 0x69, 0x74, 0x68, 0x54, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x64, 0x41, 0x6c,
+  0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x69, 0x63, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x00, 0x00,
+  0x00, 0xab, 0x6a, 0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x28, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x62,
+  0x6f, 0x72, 0x00, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63,
+  0x32, 0x70, 0x61, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x7b, 0x63, 0x62, 0x6f, 0x72, 0xa5, 0x6a, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f,
+  0x6e, 0x73, 0x81, 0xa2, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x18, 0x21, 0x66, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x19, 0x3b, 0x1c, 0x64, 0x6e, 0x61, 0x6d, 0x65, 0x6e, 0x6a, 0x75, 0x6d, 0x62,
+  0x66, 0x20, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x63, 0x61, 0x6c, 0x67, 0x66, 0x73,
+  0x68, 0x61, 0x32, 0x35, 0x36, 0x64, 0x68, 0x61, 0x73, 0x68, 0x58, 0x20, 0xdf, 0x5c, 0xbd, 0x63,
+  0x83, 0x22, 0xff, 0x9f, 0x9f, 0x6d, 0xf9, 0x7d, 0x9a, 0x42, 0x76, 0xeb, 0xe2, 0x96, 0x79, 0x01,
+  0x57, 0x3e, 0xa6, 0xc4, 0x55, 0x9d, 0xa8, 0xce, 0x74, 0x49, 0x6c, 0xec, 0x63, 0x70, 0x61, 0x64,
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x6a, 0x75, 0x6d,
+  0x62, 0x00, 0x00, 0x00, 0x24, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x32, 0x63, 0x6c, 0x00, 0x11, 0x00,
+  0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63, 0x32, 0x70, 0x61, 0x2e, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x00, 0x00, 0x00, 0x02, 0x19, 0x63, 0x62, 0x6f, 0x72, 0xa8, 0x6f, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x6f, 0x20,
+  0x63, 0x32, 0x70, 0x61, 0x2d, 0x72, 0x73, 0x2f, 0x30, 0x2e, 0x34, 0x36, 0x2e, 0x30, 0x74, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x69,
+  0x6e, 0x66, 0x6f, 0x80, 0x69, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x78, 0x4d,
+  0x73, 0x65, 0x6c, 0x66, 0x23, 0x6a, 0x75, 0x6d, 0x62, 0x66, 0x3d, 0x2f, 0x63, 0x32, 0x70, 0x61,
+  0x2f, 0x75, 0x72, 0x6e, 0x3a, 0x75, 0x75, 0x69, 0x64, 0x3a, 0x38, 0x39, 0x39, 0x38, 0x37, 0x61,
+  0x30, 0x64, 0x2d, 0x65, 0x33, 0x30, 0x63, 0x2d, 0x34, 0x65, 0x31, 0x37, 0x2d, 0x62, 0x63, 0x36,
+  0x34, 0x2d, 0x61, 0x32, 0x37, 0x33, 0x61, 0x65, 0x62, 0x33, 0x61, 0x34, 0x66, 0x37, 0x2f, 0x63,
+  0x32, 0x70, 0x61, 0x2e, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x6a, 0x61, 0x73,
+  0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x83, 0xa2, 0x63, 0x75, 0x72, 0x6c, 0x78, 0x34,
+  0x73, 0x65, 0x6c, 0x66, 0x23, 0x6a, 0x75, 0x6d, 0x62, 0x66, 0x3d, 0x63, 0x32, 0x70, 0x61, 0x2e,
+  0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x63, 0x32, 0x70, 0x61, 0x2e,
+  0x74, 0x68, 0x75, 0x6d, 0x62, 0x6e, 0x61, 0x69, 0x6c, 0x2e, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x2e,
+  0x6a, 0x70, 0x65, 0x67, 0x64, 0x68, 0x61, 0x73, 0x68, 0x58, 0x20, 0x6b, 0x02, 0x95, 0xa2, 0x2c,
+  0xb7, 0xdd, 0x44, 0x24, 0x58, 0xcb, 0xee, 0x2a, 0x85, 0xc5, 0xbe, 0x99, 0x38, 0x51, 0x8f, 0xed,
+  0x80, 0x90, 0xfe, 0x33, 0x0a, 0x4b, 0x52, 0xea, 0xa5, 0x10, 0xd2, 0xa2, 0x63, 0x75, 0x72, 0x6c,
+  0x78, 0x27, 0x73, 0x65, 0x6c, 0x66, 0x23, 0x6a, 0x75, 0x6d, 0x62, 0x66, 0x3d, 0x63, 0x32, 0x70,
+  0x61, 0x2e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2f, 0x63, 0x32, 0x70,
+  0x61, 0x2e, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x64, 0x68, 0x61, 0x73, 0x68, 0x58, 0x20,
+  0xea, 0x9c, 0xad, 0x83, 0x9d, 0x84, 0xeb, 0x35, 0xad, 0xb5, 0x36, 0x4b, 0xde, 0xd4, 0xf7, 0xfb,
+  0x9a, 0x58, 0x70, 0x7e, 0x79, 0x09, 0x4c, 0x33, 0xa2, 0x9f, 0x6f, 0x3d, 0x1a, 0x7c, 0x9c, 0x09,
+  0xa2, 0x63, 0x75, 0x72, 0x6c, 0x78, 0x29, 0x73, 0x65, 0x6c, 0x66, 0x23, 0x6a, 0x75, 0x6d, 0x62,
+  0x66, 0x3d, 0x63, 0x32, 0x70, 0x61, 0x2e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2f, 0x63, 0x32, 0x70, 0x61, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x2e, 0x64, 0x61, 0x74, 0x61,
+  0x64, 0x68, 0x61, 0x73, 0x68, 0x58, 0x20, 0x46, 0x58, 0x80, 0xa1, 0xa7, 0x87, 0x20, 0x1f, 0x5a,
+  0xf1, 0x41, 0xb3, 0x1c, 0x92, 0xdb, 0x17, 0x46, 0x5a, 0xda, 0x77, 0x21, 0x35, 0x79, 0x59, 0x25,
+  0x43, 0x9a, 0xb7, 0x96, 0x35, 0xda, 0x23, 0x69, 0x64, 0x63, 0x3a, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+  0x74, 0x69, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x6a, 0x69, 0x6e, 0x73, 0x74,
+  0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x78, 0x2c, 0x78, 0x6d, 0x70, 0x3a, 0x69, 0x69, 0x64, 0x3a,
+  0x31, 0x36, 0x63, 0x33, 0x34, 0x39, 0x33, 0x62, 0x2d, 0x30, 0x62, 0x61, 0x34, 0x2d, 0x34, 0x65,
+  0x31, 0x61, 0x2d, 0x62, 0x65, 0x36, 0x65, 0x2d, 0x32, 0x64, 0x34, 0x66, 0x36, 0x35, 0x32, 0x36,
+  0x62, 0x63, 0x66, 0x31, 0x68, 0x64, 0x63, 0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x65, 0x31, 0x2e,
+  0x70, 0x6e, 0x67, 0x63, 0x61, 0x6c, 0x67, 0x66, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36, 0x00, 0x00,
+  0x2b, 0x4b, 0x6a, 0x75, 0x6d, 0x62, 0x00, 0x00, 0x00, 0x28, 0x6a, 0x75, 0x6d, 0x64, 0x63, 0x32,
+  0x63, 0x73, 0x00, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71, 0x03, 0x63,
+  0x32, 0x70, 0x61, 0x2e, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00,
+  0x2b, 0x1b, 0x63, 0x62, 0x6f, 0x72, 0xd2, 0x84, 0x59, 0x12, 0x80, 0xa2, 0x01, 0x38, 0x26, 0x18,
+  0x21, 0x83, 0x59, 0x05, 0x3e, 0x30, 0x82, 0x05, 0x3a, 0x30, 0x82, 0x03, 0x22, 0xa0, 0x03, 0x02,
+  0x01, 0x02, 0x02, 0x10, 0x39, 0x21, 0x2f, 0x05, 0x16, 0x1e, 0x0c, 0xa0, 0x78, 0x62, 0xd1, 0xf3,
+  0xb9, 0xaf, 0x66, 0x53, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+  0x0d, 0x05, 0x00, 0x30, 0x22, 0x31, 0x20, 0x30, 0x1e, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x17,
+  0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64,
+  0x69, 0x61, 0x74, 0x65, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x30, 0x31, 0x32,
+  0x38, 0x32, 0x33, 0x35, 0x30, 0x35, 0x30, 0x5a, 0x17, 0x0d, 0x32, 0x36, 0x30, 0x32, 0x30, 0x35,
+  0x32, 0x33, 0x35, 0x30, 0x35, 0x30, 0x5a, 0x30, 0x38, 0x31, 0x0e, 0x30, 0x0c, 0x06, 0x03, 0x55,
+  0x04, 0x0a, 0x13, 0x05, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x31, 0x0e, 0x30, 0x0c, 0x06, 0x03, 0x55,
+  0x04, 0x0b, 0x13, 0x05, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55,
+  0x04, 0x03, 0x13, 0x0d, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x20, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e,
+  0x67, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01,
+  0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02, 0x0f, 0x00, 0x30, 0x82, 0x02, 0x0a, 0x02, 0x82, 0x02,
+  0x01, 0x00, 0xc5, 0x5a, 0x93, 0xe7, 0x02, 0x8d, 0x04, 0xf8, 0x76, 0x3c, 0xa8, 0x16, 0xea, 0x78,
+  0xe9, 0xa2, 0x29, 0x87, 0x0d, 0xd0, 0x48, 0xed, 0x32, 0x51, 0x43, 0x92, 0x34, 0x80, 0x05, 0xf0,
+  0x09, 0x2c, 0x2c, 0x9a, 0xcd, 0x57, 0x90, 0xf9, 0x23, 0xe3, 0x4a, 0x5c, 0xde, 0x4c, 0xdd, 0xc8,
+  0x4a, 0x6d, 0x7e, 0xa5, 0x69, 0xda, 0x21, 0xb1, 0xb9, 0x23, 0x7a, 0xb4, 0x9b, 0x5e, 0x4a, 0x5d,
+  0x38, 0xfa, 0xdc, 0xa4, 0x8d, 0xb6, 0x2d, 0x7d, 0x0a, 0x7f, 0x35, 0x97, 0xd4, 0x80, 0xc0, 0x09,
+  0x31, 0x4c, 0x25, 0xdf, 0x59, 0xe6, 0x4e, 0x29, 0x2e, 0x7f, 0xce, 0xca, 0x06, 0x65, 0xe0, 0x31,
+  0xb4, 0x53, 0x48, 0xd3, 0x37, 0x52, 0xd1, 0x7f, 0xb3, 0x04, 0x6d, 0xce, 0x29, 0x85, 0x13, 0x83,
+  0xba, 0xa7, 0xca, 0x3a, 0x7e, 0x6b, 0x91, 0xa8, 0x40, 0x0a, 0x00, 0x27, 0x39, 0xcb, 0x49, 0xa6,
+  0x30, 0xf3, 0x0f, 0x55, 0x3e, 0x8d, 0xf7, 0x5d, 0x72, 0xe3, 0x73, 0x57, 0x0f, 0x71, 0xda, 0x0f,
+  0xad, 0xa0, 0x12, 0xc9, 0x26, 0xec, 0x5a, 0x9e, 0xcc, 0x57, 0x5f, 0x2f, 0x36, 0x1e, 0x3a, 0x00,
+  0x8e, 0x6f, 0xe8, 0x94, 0xe9, 0x2a, 0xbb, 0xe2, 0x1b, 0x21, 0xb9, 0x78, 0x0f, 0x33, 0x36, 0xbd,
+  0x31, 0xea, 0xcf, 0x81, 0x8e, 0x1b, 0x6c, 0x45, 0xe3, 0x2d, 0xec, 0x5d, 0x87, 0xdf, 0xf4, 0xa0,
+  0x52, 0x40, 0x79, 0x42, 0x0d, 0x2f, 0x98, 0xab, 0xec, 0x5f, 0x77, 0x37, 0x26, 0x84, 0x99, 0x2e,
+  0xba, 0xa9, 0x8f, 0x7b, 0x25, 0x85, 0x35, 0xaf, 0x28, 0x12, 0xc0, 0x92, 0x31, 0xd9, 0x43, 0x16,
+  0xf2, 0xca, 0x3a, 0x1e, 0x00, 0x88, 0xb3, 0x5f, 0x16, 0x38, 0x73, 0xdf, 0xa6, 0x04, 0x94, 0x98,
+  0x2e, 0x49, 0x6e, 0x2c, 0x47, 0x8c, 0x7f, 0xcd, 0x37, 0x5b, 0x62, 0x07, 0x9b, 0xdf, 0x64, 0x00,
+  0x7a, 0x46, 0x90, 0x65, 0x62, 0xa5, 0xe7, 0x1f, 0x75, 0x28, 0xb5, 0x77, 0xcc, 0x6c, 0xa1, 0xd3,
+  0x14, 0xa7, 0x2a, 0xf2, 0x46, 0x88, 0x72, 0x97, 0xd0, 0x84, 0xc5, 0xe9, 0x89, 0x83, 0x51, 0x70,
+  0xad, 0xdd, 0x7b, 0xbe, 0x91, 0xba, 0x10, 0x4f, 0x16, 0xe1, 0x54, 0x3f, 0x59, 0x79, 0x60, 0xe0,
+  0x2b, 0xd9, 0x38, 0x88, 0x10, 0x3d, 0xdd, 0x0c, 0x28, 0x5d, 0x0d, 0x4b, 0xa4, 0x4f, 0xfb, 0x6e,
+  0x63, 0xa4, 0xae, 0x93, 0x82, 0x3f, 0x3c, 0xba, 0xe6, 0xc3, 0x7a, 0x3f, 0xd6, 0x87, 0x6c, 0x90,
+  0xc4, 0x91, 0x1f, 0x68, 0x57, 0x59, 0x85, 0x57, 0xf0, 0x28, 0xd8, 0x74, 0x1e, 0x88, 0xd9, 0x9c,
+  0x12, 0xed, 0xf7, 0x89, 0x05, 0x58, 0xa3, 0x6e, 0x36, 0x26, 0x43, 0x82, 0x36, 0xfc, 0x48, 0x76,
+  0x26, 0x4c, 0x4f, 0x64, 0x52, 0x76, 0x6f, 0x7a, 0x24, 0x70, 0x57, 0x98, 0x45, 0x39, 0x5a, 0xa7,
+  0x94, 0x86, 0x8b, 0x50, 0x6d, 0x20, 0x69, 0x2e, 0x61, 0x8d, 0xc2, 0x27, 0x90, 0xb2, 0x9d, 0x69,
+  0xa0, 0xf6, 0x01, 0xda, 0xa7, 0x7c, 0x8d, 0xaf, 0x53, 0xa3, 0x46, 0x10, 0x74, 0xd6, 0x1f, 0x3a,
+  0x9b, 0xe1, 0xdf, 0x94, 0xd0, 0x2b, 0xa9, 0xab, 0x8f, 0x7c, 0x33, 0x1e, 0xbf, 0x82, 0x4e, 0xcc,
+  0x25, 0x2a, 0xbf, 0x89, 0x06, 0x4b, 0x19, 0xb2, 0xd3, 0x25, 0x11, 0x68, 0x2e, 0xe2, 0x6a, 0x16,
+  0xe3, 0x33, 0xe7, 0xc9, 0x22, 0x76, 0x7b, 0x97, 0x6f, 0x85, 0x31, 0x8c, 0x45, 0xb4, 0x80, 0x57,
+  0xa4, 0x35, 0x69, 0x82, 0x74, 0x4f, 0x4c, 0x09, 0xec, 0x64, 0xf1, 0x63, 0x6e, 0x8b, 0x61, 0x1f,
+  0xc4, 0xa1, 0xee, 0xb7, 0xf5, 0xe1, 0xd1, 0x46, 0x10, 0x75, 0x01, 0x4f, 0x32, 0x6b, 0x36, 0xd7,
+  0xb9, 0xc0, 0x4e, 0x57, 0x60, 0xae, 0x05, 0x97, 0x71, 0x70, 0x33, 0x50, 0x68, 0x86, 0xf7, 0x1a,
+  0xff, 0x2b, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x56, 0x30, 0x54, 0x30, 0x0e, 0x06, 0x03, 0x55,
+  0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x07, 0x80, 0x30, 0x13, 0x06, 0x03, 0x55,
+  0x1d, 0x25, 0x04, 0x0c, 0x30, 0x0a, 0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x04,
+  0x30, 0x0c, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x02, 0x30, 0x00, 0x30, 0x1f,
+  0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x95, 0xa3, 0x46, 0x3f, 0xfb,
+  0x06, 0xd8, 0x1e, 0x46, 0xd0, 0x29, 0xcc, 0xa4, 0x8e, 0xea, 0xee, 0x7f, 0xa0, 0xe8, 0xd5, 0x30,
+  0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0d, 0x05, 0x00, 0x03, 0x82,
+  0x02, 0x01, 0x00, 0x71, 0x9e, 0x6f, 0x43, 0xe0, 0xaf, 0x6c, 0xd6, 0x85, 0x1e, 0x64, 0x10, 0x58,
+  0x5b, 0xee, 0xa8, 0x2a, 0x5e, 0x97, 0x01, 0x28, 0x0f, 0xb9, 0x72, 0x2c, 0xeb, 0x68, 0xb0, 0x6d,
+  0x6a, 0x0d, 0x53, 0x20, 0xb8, 0x8e, 0x91, 0x5b, 0x99, 0xb8, 0x7b, 0x7d, 0x8d, 0x00, 0xb3, 0x65,
+  0x1c, 0x13, 0x32, 0x22, 0xa7, 0xe8, 0x3a, 0x60, 0x52, 0x46, 0x24, 0x6c, 0x43, 0x62, 0x58, 0xe6,
+  0x2b, 0xd6, 0x2a, 0x87, 0xc6, 0xf8, 0xe6, 0x7f, 0xef, 0x37, 0xc0, 0x31, 0x7c, 0xe9, 0xc7, 0x9a,
+  0x17, 0xd3, 0x76, 0x29, 0xb4, 0xc2, 0xf2, 0x52, 0x58, 0x0a, 0x7c, 0x4a, 0x31, 0x35, 0xe8, 0x93,
+  0xb8, 0x08, 0x40, 0x4d, 0xfb, 0x11, 0x31, 0x12, 0xb4, 0xf7, 0x2b, 0x35, 0x75, 0x50, 0x58, 0x21,
+  0x42, 0xc6, 0xfa, 0xf8, 0x76, 0x8e, 0x09, 0x07, 0x0d, 0x8c, 0xfe, 0xaf, 0x5c, 0x82, 0x0a, 0x22,
+  0x25, 0x7e, 0xaa, 0x9f, 0x4f, 0x52, 0xcb, 0x3c, 0xc1, 0xc6, 0x94, 0xb5, 0x12, 0x09, 0x5e, 0x99,
+  0xeb, 0x85, 0x97, 0x73, 0x3d, 0x93, 0xdc, 0xa3, 0xae, 0x55, 0x52, 0x77, 0x17, 0x83, 0xba, 0x8a,
+  0x6d, 0x6b, 0x19, 0x99, 0x34, 0x83, 0x1e, 0x6d, 0xb4, 0xb4, 0xca, 0x5a, 0xf4, 0x73, 0xf8, 0x2d,
+  0x7c, 0x34, 0xb4, 0xcb, 0x64, 0xaa, 0xad, 0xc9, 0x0a, 0x84, 0x0d, 0x40, 0x08, 0x4b, 0xe6, 0x4d,
+  0x22, 0x65, 0x8b, 0x65, 0xbb, 0xf1, 0x4d, 0x32, 0xbb, 0xad, 0x3f, 0xf7, 0x6d, 0xe0, 0xd6, 0xcb,
+  0x75, 0x3d, 0xdf, 0x5d, 0x13, 0x85, 0x17, 0x66, 0x3d, 0x2d, 0x76, 0x12, 0x47, 0xdc, 0x81, 0xc1,
+  0x28, 0xd4, 0xdd, 0x79, 0x05, 0xf5, 0x14, 0x66, 0x54, 0xb8, 0xff, 0xd3, 0x3b, 0xd5, 0x17, 0x46,
+  0x31, 0xfe, 0xef, 0x1c, 0x6b, 0xa3, 0x41, 0x9f, 0x9a, 0x3d, 0xc4, 0x05, 0x07, 0x44, 0xc5, 0xc6,
+  0xf6, 0xc2, 0xcb, 0x35, 0x5a, 0xe6, 0xe9, 0x30, 0x51, 0x26, 0xf4, 0x9d, 0xce, 0xd7, 0xd5, 0x27,
+  0x36, 0x04, 0x0c, 0xd4, 0xc2, 0xaf, 0x14, 0x79, 0xe6, 0xd3, 0xe5, 0x27, 0xe1, 0xc8, 0x83, 0xae,
+  0xf6, 0x53, 0x1f, 0x87, 0xd9, 0x4f, 0x7c, 0x76, 0x4b, 0x31, 0xbf, 0xa3, 0x34, 0x4e, 0x96, 0xe9,
+  0x69, 0x07, 0xe1, 0x01, 0xed, 0x48, 0xfc, 0x82, 0x16, 0x5c, 0x63, 0x29, 0x80, 0xdb, 0xfb, 0xf4,
+  0x3b, 0x21, 0x8b, 0xda, 0x32, 0x92, 0x4b, 0x62, 0xb3, 0xc9, 0x3d, 0xa2, 0xf3, 0x34, 0xf6, 0xf1,
+  0x4a, 0xc3, 0xdc, 0xb8, 0xdc, 0x55, 0xef, 0xee, 0x27, 0xd5, 0x83, 0x1c, 0xd6, 0x81, 0x9a, 0x6b,
+  0x36, 0x8e, 0xee, 0xc3, 0x38, 0x73, 0x4d, 0xae, 0x71, 0x2a, 0x4c, 0x46, 0xc8, 0xf2, 0x20, 0xfd,
+  0x91, 0x9a, 0x8e, 0xf3, 0x71, 0xea, 0x60, 0xa7, 0x9e, 0xfe, 0x42, 0xfc, 0xd7, 0x59, 0x7e, 0xd1,
+  0x1e, 0x93, 0x92, 0x78, 0xb1, 0x01, 0x6b, 0x20, 0xe8, 0x73, 0xed, 0x87, 0xf9, 0x4d, 0x98, 0xce,
+  0x76, 0x92, 0x55, 0x1d, 0x83, 0x19, 0x95, 0x2e, 0x6c, 0xdc, 0xa0, 0x4b, 0xfd, 0x3f, 0xcf, 0xab,
+  0xe7, 0xb8, 0x4b, 0x2d, 0xd9, 0xfb, 0x7f, 0x91, 0x00, 0x46, 0xe6, 0x1f, 0x08, 0xee, 0x84, 0x9f,
+  0xd3, 0x6e, 0x52, 0x8b, 0x58, 0x0a, 0x10, 0xe6, 0xee, 0xef, 0x66, 0xa1, 0x9e, 0xd4, 0x61, 0x99,
+  0xf7, 0xeb, 0x6d, 0x7d, 0xfb, 0xc2, 0x35, 0x3b, 0x88, 0xc5, 0x19, 0x6f, 0x1e, 0xae, 0x7e, 0x22,
+  0x7c, 0x72, 0x79, 0xb4, 0x2f, 0x96, 0x59, 0x6d, 0x63, 0x4a, 0xf7, 0x93, 0x98, 0x67, 0x12, 0x36,
+  0x9a, 0xe6, 0xec, 0x7c, 0xb3, 0x78, 0xdb, 0x98, 0x68, 0xbc, 0xd7, 0x80, 0x2e, 0x21, 0xaa, 0x02,
+  0xdb, 0xb7, 0xdd, 0xb7, 0x77, 0xa1, 0x94, 0xb6, 0x9c, 0x83, 0xa0, 0x6c, 0xf4, 0x61, 0x00, 0x0a,
+  0x74, 0x75, 0x87, 0x59, 0x06, 0xe8, 0x30, 0x82, 0x06, 0xe4, 0x30, 0x82, 0x04, 0xcc, 0xa0, 0x03,
+  0x02, 0x01, 0x02, 0x02, 0x14, 0x3a, 0xb8, 0x0d, 0xfb, 0xab, 0xe7, 0xda, 0xce, 0x32, 0x02, 0x60,
+  0xc9, 0xd6, 0x4a, 0xe0, 0x4a, 0xae, 0xa2, 0xec, 0x26, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48,
+  0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30, 0x6d, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03,
+  0x55, 0x04, 0x06, 0x13, 0x02, 0x41, 0x55, 0x31, 0x0c, 0x30, 0x0a, 0x06, 0x03, 0x55, 0x04, 0x08,
+  0x13, 0x03, 0x4e, 0x53, 0x57, 0x31, 0x0f, 0x30, 0x0d, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x06,
+  0x53, 0x79, 0x64, 0x6e, 0x65, 0x79, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x13,
+  0x0a, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x31, 0x10, 0x30, 0x0e, 0x06,
+  0x03, 0x55, 0x04, 0x0b, 0x13, 0x07, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x31, 0x18, 0x30,
+  0x16, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x0f, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+  0x43, 0x41, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x30, 0x31, 0x31,
+  0x37, 0x30, 0x35, 0x34, 0x30, 0x32, 0x30, 0x5a, 0x17, 0x0d, 0x32, 0x36, 0x30, 0x32, 0x31, 0x36,
+  0x30, 0x35, 0x34, 0x30, 0x35, 0x30, 0x5a, 0x30, 0x22, 0x31, 0x20, 0x30, 0x1e, 0x06, 0x03, 0x55,
+  0x04, 0x03, 0x13, 0x17, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x49, 0x6e, 0x74, 0x65,
+  0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x43, 0x41, 0x30, 0x82, 0x02, 0x22, 0x30,
+  0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82,
+  0x02, 0x0f, 0x00, 0x30, 0x82, 0x02, 0x0a, 0x02, 0x82, 0x02, 0x01, 0x00, 0xd3, 0xc8, 0x20, 0x98,
+  0x94, 0xb5, 0x9a, 0x9c, 0xde, 0x12, 0x39, 0x98, 0x03, 0xdd, 0xfb, 0xe8, 0xbe, 0xf4, 0x0d, 0xa5,
+  0x76, 0x92, 0xe3, 0x8f, 0xe4, 0x48, 0xed, 0x3a, 0xc9, 0x62, 0xf6, 0xb7, 0xe4, 0x03, 0x2b, 0x10,
+  0x72, 0xe6, 0xd7, 0x5c, 0x4c, 0x77, 0xae, 0x68, 0xbf, 0xad, 0x10, 0xb3, 0xf9, 0x6b, 0x75, 0x77,
+  0xa6, 0x35, 0x0e, 0x8a, 0x57, 0xae, 0x67, 0x40, 0x1b, 0x53, 0xcd, 0x3f, 0x0b, 0xa2, 0x12, 0xb3,
+  0x95, 0xab, 0xd2, 0xc1, 0xf3, 0x5d, 0xad, 0x07, 0x28, 0x14, 0x6b, 0x22, 0xa4, 0x6c, 0xaf, 0xc2,
+  0xb4, 0x60, 0xf8, 0xe6, 0xef, 0x7c, 0xd0, 0xe1, 0x6b, 0x8e, 0xf5, 0xad, 0x1e, 0xd3, 0x80, 0xdd,
+  0x63, 0x85, 0xfb, 0xf7, 0xb1, 0x6a, 0x12, 0x3c, 0xe5, 0x19, 0xa9, 0x04, 0xa8, 0xfb, 0x94, 0x2a,
+  0x7d, 0x4b, 0xfb, 0xa8, 0x8b, 0xd9, 0xb8, 0x98, 0xae, 0x39, 0xe7, 0x05, 0x9a, 0x18, 0xb4, 0x0f,
+  0xb9, 0x10, 0x2c, 0xad, 0x02, 0xf9, 0x7e, 0xb7, 0x6a, 0x22, 0x93, 0xb1, 0x4a, 0x72, 0x7c, 0x6a,
+  0x3e, 0xfe, 0xb6, 0x66, 0xfa, 0xd7, 0xc0, 0x47, 0x16, 0xbe, 0x27, 0xc5, 0x8c, 0xc8, 0xff, 0x33,
+  0x03, 0x23, 0x09, 0xe2, 0x4b, 0x05, 0xec, 0x76, 0xdf, 0x8c, 0x5e, 0x27, 0x21, 0xf6, 0x6f, 0xe2,
+  0xef, 0xb5, 0xac, 0x9d, 0xee, 0xf2, 0x8c, 0xc6, 0xed, 0x55, 0x73, 0xa0, 0x89, 0x80, 0x31, 0xaf,
+  0x0f, 0x37, 0xcc, 0x51, 0xfb, 0x48, 0x82, 0x4f, 0xf2, 0xdc, 0xad, 0xca, 0x1d, 0xfb, 0x0e, 0xa0,
+  0xf9, 0x90, 0x2d, 0x49, 0x9d, 0x7c, 0xc9, 0xc9, 0xe2, 0xa2, 0xf8, 0x69, 0x15, 0xde, 0x4b, 0x8b,
+  0xf2, 0xfb, 0xbc, 0xe7, 0x84, 0x45, 0xe1, 0x50, 0x14, 0x50, 0xce, 0x7a, 0x81, 0x4d, 0x4c, 0x3b,
+  0x5e, 0x07, 0x6d, 0x71, 0x76, 0x4d, 0xe2, 0x79, 0x32, 0x1b, 0x65, 0x92, 0x54, 0xae, 0x31, 0xbe,
+  0x49, 0xb7, 0xf2, 0x6a, 0x91, 0x91, 0xbc, 0xeb, 0x18, 0xd8, 0x39, 0xdb, 0x88, 0x57, 0x9a, 0x41,
+  0x65, 0xae, 0xa7, 0x65, 0x82, 0x95, 0xc6, 0xc9, 0x6c, 0xb4, 0x53, 0x46, 0xd7, 0x75, 0x5c, 0xa0,
+  0xd8, 0xfd, 0x28, 0x75, 0x78, 0xd9, 0x56, 0x49, 0xb3, 0x47, 0x56, 0x79, 0xa4, 0x0c, 0xe1, 0x92,
+  0x39, 0x7e, 0x8b, 0x28, 0xaa, 0x31, 0x35, 0x7c, 0x46, 0xf1, 0x57, 0x3d, 0xd0, 0x87, 0x25, 0xc8,
+  0x70, 0x42, 0xef, 0xe9, 0x9d, 0x9b, 0x68, 0x23, 0x3e, 0x22, 0xaf, 0xa7, 0xe3, 0x94, 0xa1, 0x0b,
+  0x31, 0x98, 0xc4, 0x8e, 0xf9, 0x1c, 0x42, 0x44, 0x1d, 0xa2, 0x20, 0xd7, 0x50, 0xa2, 0x77, 0xff,
+  0xd3, 0xe6, 0xc4, 0x88, 0x55, 0xe4, 0xeb, 0x94, 0xe0, 0xae, 0xe9, 0x79, 0x5e, 0xb2, 0x0d, 0x2d,
+  0x71, 0xfc, 0x45, 0xeb, 0xa1, 0xa3, 0xff, 0xa1, 0x47, 0xf6, 0xcb, 0x95, 0xc5, 0x7c, 0x1c, 0xd3,
+  0x33, 0x85, 0x87, 0xa3, 0xb8, 0x4a, 0x5a, 0xda, 0xf3, 0x71, 0x4a, 0x88, 0x7f, 0x64, 0xe1, 0x54,
+  0x9c, 0xf1, 0x72, 0x65, 0x6e, 0xc7, 0x2a, 0x57, 0x9e, 0x12, 0xdb, 0x20, 0x72, 0xed, 0xf3, 0xd9,
+  0x15, 0xa8, 0x32, 0x76, 0xd9, 0xaa, 0x61, 0xcb, 0xa4, 0x9b, 0x72, 0x1a, 0xf4, 0xd8, 0xe2, 0x91,
+  0x91, 0xcf, 0x7a, 0x3c, 0x07, 0xf0, 0x40, 0x89, 0x5d, 0xc4, 0x3b, 0x1c, 0x46, 0xd0, 0x83, 0x66,
+  0x7d, 0xad, 0xdd, 0x41, 0x65, 0x22, 0x29, 0x09, 0xb7, 0x2b, 0x39, 0x9e, 0xfb, 0x92, 0xe9, 0x7d,
+  0xc2, 0x4a, 0x51, 0x1b, 0xd9, 0x5d, 0xf2, 0x84, 0x01, 0xaf, 0xb1, 0xc6, 0x5f, 0x3c, 0xa7, 0x88,
+  0x2b, 0x27, 0xe0, 0x3f, 0x77, 0xd1, 0x46, 0xca, 0x90, 0x7a, 0x06, 0xb3, 0x83, 0x2d, 0xb1, 0x8f,
+  0x4a, 0xef, 0x17, 0xf7, 0xd5, 0x04, 0x4d, 0x3b, 0x4b, 0x95, 0x22, 0xf5, 0x02, 0x03, 0x01, 0x00,
+  0x01, 0xa3, 0x82, 0x01, 0xc5, 0x30, 0x82, 0x01, 0xc1, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f,
+  0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1d, 0x13,
+  0x01, 0x01, 0xff, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0x30, 0x1d, 0x06,
+  0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x95, 0xa3, 0x46, 0x3f, 0xfb, 0x06, 0xd8, 0x1e,
+  0x46, 0xd0, 0x29, 0xcc, 0xa4, 0x8e, 0xea, 0xee, 0x7f, 0xa0, 0xe8, 0xd5, 0x30, 0x1f, 0x06, 0x03,
+  0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x7c, 0x19, 0x6d, 0x3d, 0xa0, 0x21, 0xbc,
+  0x78, 0x48, 0xd4, 0x60, 0x7f, 0xda, 0x44, 0xd2, 0x29, 0x1d, 0xed, 0xec, 0x7a, 0x30, 0x81, 0xd7,
+  0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x81, 0xca, 0x30, 0x81, 0xc7,
+  0x30, 0x4c, 0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x01, 0x86, 0x40, 0x68, 0x74,
+  0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x70, 0x6b, 0x69, 0x2e, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x76, 0x31, 0x2f,
+  0x70, 0x6b, 0x69, 0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x64, 0x2f, 0x6c,
+  0x31, 0x2f, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x2f, 0x6f, 0x63, 0x73, 0x70, 0x30, 0x77,
+  0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02, 0x86, 0x6b, 0x68, 0x74, 0x74, 0x70,
+  0x73, 0x3a, 0x2f, 0x2f, 0x70, 0x6b, 0x69, 0x2e, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x76, 0x31, 0x2f, 0x70, 0x6b,
+  0x69, 0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x64, 0x2f, 0x6c, 0x31, 0x2f,
+  0x73, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x2f, 0x69, 0x73, 0x73, 0x75, 0x65, 0x72, 0x2f, 0x63,
+  0x37, 0x62, 0x30, 0x38, 0x30, 0x34, 0x62, 0x2d, 0x34, 0x37, 0x64, 0x65, 0x2d, 0x30, 0x32, 0x61,
+  0x31, 0x2d, 0x35, 0x62, 0x66, 0x37, 0x2d, 0x34, 0x62, 0x65, 0x61, 0x63, 0x37, 0x65, 0x37, 0x37,
+  0x37, 0x66, 0x36, 0x2f, 0x64, 0x65, 0x72, 0x30, 0x81, 0x80, 0x06, 0x03, 0x55, 0x1d, 0x1f, 0x04,
+  0x79, 0x30, 0x77, 0x30, 0x75, 0xa0, 0x73, 0xa0, 0x71, 0x86, 0x6f, 0x68, 0x74, 0x74, 0x70, 0x73,
+  0x3a, 0x2f, 0x2f, 0x70, 0x6b, 0x69, 0x2e, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x76, 0x31, 0x2f, 0x70, 0x6b, 0x69,
+  0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x64, 0x2f, 0x6c, 0x31, 0x2f, 0x73,
+  0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x2f, 0x69, 0x73, 0x73, 0x75, 0x65, 0x72, 0x2f, 0x63, 0x37,
+  0x62, 0x30, 0x38, 0x30, 0x34, 0x62, 0x2d, 0x34, 0x37, 0x64, 0x65, 0x2d, 0x30, 0x32, 0x61, 0x31,
+  0x2d, 0x35, 0x62, 0x66, 0x37, 0x2d, 0x34, 0x62, 0x65, 0x61, 0x63, 0x37, 0x65, 0x37, 0x37, 0x37,
+  0x66, 0x36, 0x2f, 0x63, 0x72, 0x6c, 0x2f, 0x64, 0x65, 0x72, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86,
+  0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x03, 0x82, 0x02, 0x01, 0x00, 0x13, 0xdf,
+  0x54, 0x38, 0x3f, 0x4d, 0x25, 0x7c, 0x07, 0x7d, 0x13, 0x4c, 0x61, 0xfe, 0x12, 0x70, 0x42, 0x34,
+  0x5d, 0x8e, 0xfd, 0x48, 0x88, 0xdd, 0xe1, 0xa7, 0x80, 0xd5, 0x09, 0x69, 0x01, 0x31, 0xe5, 0x6c,
+  0xd3, 0x12, 0x70, 0xcf, 0xaa, 0x22, 0x45, 0x17, 0x77, 0x01, 0x82, 0x16, 0xbf, 0x78, 0xcb, 0x6e,
+  0x4e, 0x83, 0x46, 0xef, 0x11, 0xa7, 0xfe, 0x3c, 0x29, 0x47, 0x99, 0x99, 0x52, 0xdd, 0x51, 0xb0,
+  0xf8, 0x32, 0x7f, 0x68, 0xc9, 0x04, 0x8b, 0x77, 0xc9, 0xb0, 0xd0, 0xec, 0x66, 0x44, 0x55, 0x53,
+  0xff, 0x63, 0x4f, 0x08, 0xbe, 0x4c, 0x46, 0x39, 0xfa, 0xc1, 0x8f, 0x43, 0xf1, 0xff, 0xee, 0x13,
+  0xd2, 0x9f, 0x61, 0xc3, 0xbb, 0x7e, 0x92, 0x08, 0xb8, 0xed, 0x8c, 0xc0, 0x9a, 0x64, 0x88, 0xbc,
+  0x54, 0x70, 0x5a, 0x0a, 0x31, 0x01, 0x0b, 0x29, 0x4b, 0x54, 0x08, 0x74, 0x2a, 0xec, 0x59, 0xa1,
+  0x05, 0x89, 0x49, 0xc8, 0x34, 0x66, 0xcc, 0x81, 0x6a, 0x0f, 0xfc, 0x57, 0x2c, 0xfc, 0x85, 0x1f,
+  0x37, 0x40, 0x6d, 0xc0, 0x32, 0x23, 0x7e, 0x0c, 0x61, 0x65, 0xd4, 0xb2, 0xc2, 0xa6, 0x18, 0x9e,
+  0xbe, 0x2c, 0xbb, 0xf3, 0x2d, 0xf2, 0xfe, 0x02, 0x13, 0x27, 0xfd, 0xcf, 0x78, 0x6d, 0xb7, 0x00,
+  0xdd, 0x71, 0x22, 0xf6, 0x86, 0x55, 0xe7, 0x8d, 0x85, 0xb3, 0x4c, 0xa7, 0xb7, 0x68, 0x2a, 0x7b,
+  0x13, 0x44, 0x5e, 0xe6, 0xc0, 0x6d, 0x12, 0xb8, 0x11, 0x93, 0x87, 0x22, 0xdb, 0x65, 0x87, 0xae,
+  0xed, 0xf3, 0xb8, 0x73, 0xde, 0x9b, 0x6d, 0x3a, 0xe4, 0x57, 0xe6, 0xa1, 0xad, 0xf9, 0x8c, 0xf9,
+  0xa9, 0x6a, 0xa7, 0x8e, 0x94, 0x9b, 0xce, 0x11, 0xa0, 0x62, 0x56, 0x37, 0xf0, 0x20, 0x94, 0xcb,
+  0xcb, 0x83, 0xb6, 0xdd, 0xcf, 0x78, 0x62, 0xa0, 0x8b, 0xa5, 0x71, 0x5e, 0x89, 0x0a, 0x64, 0xea,
+  0xd7, 0x32, 0x08, 0x4c, 0xa4, 0x8a, 0x84, 0x7c, 0x58, 0xdd, 0x48, 0xd1, 0xcf, 0x39, 0xc3, 0x94,
+  0x43, 0x8c, 0xc9, 0xd2, 0x61, 0xce, 0x14, 0x1a, 0xc4, 0xff, 0x8e, 0x52, 0x2b, 0xa6, 0xe0, 0x4f,
+  0x32, 0x48, 0xc5, 0xe7, 0xac, 0x9e, 0xce, 0xd0, 0x62, 0x7b, 0x29, 0xe6, 0x8a, 0x7b, 0x82, 0xee,
+  0xe3, 0xfe, 0x6b, 0x5d, 0x03, 0x5e, 0xc7, 0xd1, 0x8a, 0x00, 0x2e, 0xe7, 0x2c, 0xd5, 0x2f, 0xe4,
+  0x0d, 0x34, 0x60, 0x9a, 0xd6, 0x5d, 0xc5, 0x6b, 0x46, 0x05, 0x83, 0x7c, 0x7d, 0x0d, 0xb0, 0x93,
+  0xa8, 0x0d, 0xa7, 0x10, 0x01, 0xa0, 0xbb, 0x18, 0xb1, 0x78, 0x1f, 0x27, 0x24, 0x27, 0x07, 0x54,
+  0xe2, 0xbe, 0xb9, 0xb8, 0x36, 0xae, 0x1b, 0xc8, 0x22, 0xc1, 0xd4, 0xdc, 0xaf, 0x56, 0xc5, 0xc8,
+  0x66, 0x9b, 0xcb, 0x93, 0x64, 0x6f, 0x68, 0x9e, 0xab, 0x95, 0x6e, 0x1f, 0x4c, 0xb8, 0x54, 0x50,
+  0x55, 0x44, 0xaa, 0x5f, 0xa7, 0xa7, 0xd0, 0xbc, 0x65, 0xca, 0xea, 0x52, 0xea, 0x74, 0xbc, 0xb6,
+  0xb3, 0x82, 0x3a, 0xf9, 0xf7, 0x4e, 0x80, 0x7b, 0x2f, 0x99, 0x4d, 0x41, 0xc4, 0x53, 0x32, 0xc0,
+  0x0e, 0xc3, 0x39, 0x78, 0x1e, 0xb6, 0x89, 0xef, 0x4c, 0xe0, 0xfb, 0x0e, 0x6e, 0x01, 0xdd, 0x8f,
+  0x7f, 0x8a, 0x50, 0xdd, 0x08, 0x7f, 0xeb, 0x2d, 0x71, 0x6f, 0x3b, 0x38, 0x2e, 0x94, 0x22, 0xc3,
+  0x6d, 0xce, 0x96, 0xaa, 0xd4, 0xab, 0xe1, 0x8a, 0xa7, 0x1f, 0x2c, 0xd3, 0xdc, 0xf4, 0x41, 0xd0,
+  0x07, 0x7b, 0xf7, 0x7e, 0xb8, 0x6b, 0x01, 0xbe, 0xc2, 0xed, 0xb0, 0xf8, 0xdd, 0x9d, 0x74, 0x41,
+  0x66, 0x0e, 0xe7, 0x0d, 0xbe, 0xd6, 0xb3, 0xc3, 0xd4, 0xec, 0x10, 0xed, 0x0d, 0x39, 0xa5, 0x5f,
+  0x91, 0xe1, 0x82, 0x02, 0xab, 0x26, 0xdf, 0x75, 0x76, 0x27, 0xc2, 0x7d, 0x71, 0xa5, 0x59, 0x06,
+  0x4a, 0x30, 0x82, 0x06, 0x46, 0x30, 0x82, 0x04, 0x2e, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x11,
+  0x00, 0xca, 0x70, 0x5d, 0xd7, 0x53, 0x2a, 0xd4, 0xe5, 0xd1, 0x43, 0x9b, 0x94, 0xec, 0x45, 0x72,
+  0x11, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0d, 0x05, 0x00,
+  0x30, 0x81, 0x81, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x41, 0x55,
+  0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x0a, 0x43, 0x61, 0x6e, 0x76, 0x61,
+  0x20, 0x50, 0x72, 0x6f, 0x64, 0x31, 0x17, 0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x0b, 0x0c, 0x0e,
+  0x43, 0x6c, 0x6f, 0x75, 0x64, 0x20, 0x50, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x31, 0x0c,
+  0x30, 0x0a, 0x06, 0x03, 0x55, 0x04, 0x08, 0x0c, 0x03, 0x4e, 0x53, 0x57, 0x31, 0x25, 0x30, 0x23,
+  0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x1c, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x20, 0x50, 0x72, 0x6f,
+  0x64, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x20, 0x43, 0x41, 0x20, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x47, 0x32, 0x31, 0x0f, 0x30, 0x0d, 0x06, 0x03, 0x55, 0x04, 0x07, 0x0c, 0x06, 0x53, 0x79,
+  0x64, 0x6e, 0x65, 0x79, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x35, 0x31, 0x31, 0x31, 0x36, 0x30, 0x33,
+  0x33, 0x31, 0x34, 0x36, 0x5a, 0x17, 0x0d, 0x32, 0x36, 0x30, 0x35, 0x31, 0x35, 0x30, 0x33, 0x33,
+  0x31, 0x34, 0x36, 0x5a, 0x30, 0x6d, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13,
+  0x02, 0x41, 0x55, 0x31, 0x0c, 0x30, 0x0a, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x03, 0x4e, 0x53,
+  0x57, 0x31, 0x0f, 0x30, 0x0d, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x06, 0x53, 0x79, 0x64, 0x6e,
+  0x65, 0x79, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x13, 0x0a, 0x43, 0x61, 0x6e,
+  0x76, 0x61, 0x20, 0x50, 0x72, 0x6f, 0x64, 0x31, 0x10, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x04, 0x0b,
+  0x13, 0x07, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x31, 0x18, 0x30, 0x16, 0x06, 0x03, 0x55,
+  0x04, 0x03, 0x13, 0x0f, 0x53, 0x69, 0x67, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x41, 0x20, 0x50,
+  0x72, 0x6f, 0x64, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7,
+  0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02, 0x0f, 0x00, 0x30, 0x82, 0x02, 0x0a, 0x02,
+  0x82, 0x02, 0x01, 0x00, 0xc8, 0x9d, 0x4c, 0xb5, 0xbb, 0x43, 0x80, 0x1f, 0x9f, 0x31, 0x0c, 0x05,
+  0x8a, 0xff, 0x3f, 0x09, 0x17, 0x0f, 0xcc, 0x26, 0xe8, 0x1a, 0x45, 0x57, 0x48, 0x34, 0x83, 0xd4,
+  0x1a, 0x50, 0x2f, 0x1c, 0x2a, 0x86, 0x76, 0x6e, 0x13, 0x5b, 0xa9, 0x7c, 0xe3, 0xf5, 0xda, 0x6d,
+  0x09, 0x35, 0xc7, 0xaf, 0x22, 0x5a, 0x86, 0x27, 0xb0, 0xcd, 0x45, 0xc7, 0x58, 0x6c, 0x23, 0xe3,
+  0xe8, 0xf5, 0xf6, 0x02, 0xf5, 0x53, 0xc7, 0x62, 0xad, 0x43, 0xfa, 0xdd, 0x17, 0x40, 0xc3, 0xd1,
+  0x44, 0x39, 0xb0, 0xb9, 0x36, 0xe6, 0xc4, 0xe9, 0x13, 0x31, 0xbd, 0x6f, 0xba, 0xa0, 0x11, 0xc4,
+  0x35, 0xfb, 0xa1, 0x85, 0xb8, 0x4e, 0x5b, 0xc2, 0x6a, 0x61, 0xd9, 0xcd, 0xa4, 0xa1, 0x9a, 0xc7,
+  0xa6, 0xa8, 0x73, 0xa1, 0x90, 0xdc, 0x08, 0x83, 0x38, 0x37, 0x32, 0x64, 0x79, 0x62, 0x50, 0x2a,
+  0x15, 0xbd, 0xbf, 0x2d, 0xec, 0x5e, 0xdf, 0x81, 0x2a, 0xce, 0x6f, 0xff, 0x04, 0xc0, 0xef, 0x4e,
+  0x7a, 0x1a, 0x51, 0xb1, 0x72, 0xd6, 0xa8, 0x88, 0x4d, 0xf1, 0xd0, 0x58, 0x3e, 0x56, 0x3d, 0x87,
+  0xbd, 0xc0, 0xd5, 0xc0, 0xdc, 0x34, 0x80, 0x4b, 0x7c, 0x1e, 0x09, 0x8d, 0x0c, 0x9c, 0xf2, 0xc5,
+  0xf3, 0x80, 0x13, 0xfb, 0xde, 0x01, 0x23, 0x0a, 0x83, 0x54, 0x9f, 0xde, 0xe0, 0xea, 0xd8, 0xc0,
+  0x07, 0x9d, 0x17, 0xb8, 0x3c, 0x1a, 0x36, 0xfb, 0xf8, 0xa8, 0x27, 0x08, 0xc2, 0xa3, 0x86, 0x80,
+  0x07, 0x43, 0xd7, 0x66, 0xf8, 0x2c, 0xd4, 0xef, 0x4f, 0x13, 0x77, 0x00, 0xdc, 0xdc, 0x67, 0xad,
+  0x3f, 0xfb, 0xb9, 0xcc, 0xc7, 0x53, 0x30, 0x9f, 0x17, 0x40, 0xc9, 0xa3, 0x00, 0x80, 0xf1, 0xf6,
+  0xa8, 0xd8, 0x90, 0x15, 0x96, 0x94, 0x9f, 0xd3, 0x8f, 0xb7, 0xe9, 0x96, 0xc6, 0xe9, 0x87, 0xd4,
+  0x49, 0xe1, 0x46, 0xb6, 0x0e, 0x8d, 0xbb, 0x85, 0x0c, 0x35, 0x25, 0xe8, 0xad, 0x93, 0x00, 0x52,
+  0xab, 0x27, 0xb5, 0xbc, 0x23, 0xb3, 0xfa, 0xba, 0x7e, 0x09, 0xab, 0xf6, 0xbe, 0xac, 0x11, 0x0a,
+  0x17, 0x19, 0xce, 0x7f, 0xc9, 0xd9, 0x59, 0x84, 0x13, 0xb9, 0xed, 0xbb, 0x4d, 0x3f, 0xdb, 0x3e,
+  0x4b, 0xdb, 0x8d, 0x35, 0xb0, 0xa2, 0x11, 0xfc, 0x74, 0xf1, 0x9c, 0x2b, 0x85, 0x19, 0xaf, 0x61,
+  0x6f, 0x79, 0x28, 0xee, 0x4d, 0x42, 0x8e, 0xfd, 0xde, 0x9b, 0x62, 0xe5, 0xd1, 0x34, 0x09, 0xf9,
+  0x2e, 0xe7, 0x96, 0x9e, 0xd8, 0xde, 0x4b, 0xd5, 0xfc, 0xd1, 0x54, 0xf0, 0x36, 0x8a, 0x78, 0x61,
+  0xfe, 0x7d, 0xa9, 0x87, 0x96, 0xb6, 0x2c, 0xae, 0x77, 0xf1, 0xc2, 0xbd, 0xfb, 0xae, 0xc0, 0x04,
+  0xc2, 0x36, 0xe0, 0xd6, 0x13, 0x93, 0xdb, 0xea, 0x93, 0xc6, 0x09, 0xba, 0x58, 0xd0, 0xe3, 0xd5,
+  0x8a, 0x52, 0xe5, 0x98, 0x4f, 0xb5, 0x9d, 0x84, 0xca, 0x65, 0x2d, 0xf1, 0x05, 0xe5, 0x6c, 0x5a,
+  0x73, 0x04, 0xb3, 0x9f, 0x7e, 0x3b, 0x51, 0x1b, 0xbf, 0x6a, 0x51, 0xb9, 0xb3, 0x36, 0x33, 0x58,
+  0x32, 0xc3, 0xaf, 0x7f, 0x7f, 0x73, 0x58, 0x47, 0xcf, 0x50, 0x11, 0x1a, 0xee, 0x20, 0xdf, 0xae,
+  0x60, 0x91, 0x16, 0xa9, 0x41, 0x9e, 0x2f, 0x46, 0x2b, 0x09, 0x00, 0x32, 0x5f, 0x24, 0x54, 0x44,
+  0x52, 0x46, 0xff, 0xbf, 0x8e, 0xb0, 0xc1, 0x19, 0x70, 0x55, 0x4f, 0x99, 0xfb, 0x86, 0xf3, 0x14,
+  0xd6, 0xf4, 0x17, 0x69, 0xc9, 0x75, 0xbf, 0xe4, 0x87, 0x43, 0x29, 0x56, 0x0a, 0x3d, 0x44, 0x88,
+  0xc1, 0xc7, 0xb2, 0x08, 0x15, 0x0a, 0xb5, 0xd7, 0x1b, 0x7a, 0xf8, 0x1c, 0xae, 0x3b, 0x08, 0x12,
+  0xf8, 0x20, 0x29, 0x31, 0xdc, 0x3f, 0x56, 0x7a, 0x47, 0xe4, 0x7d, 0x24, 0x60, 0x27, 0xa9, 0xde,
+  0xeb, 0x9d, 0x06, 0x79, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x81, 0xcb, 0x30, 0x81, 0xc8, 0x30,
+  0x12, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xff,
+  0x02, 0x01, 0x01, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14,
+  0xe9, 0x49, 0xea, 0x98, 0xdd, 0x9c, 0x69, 0x54, 0x7d, 0x8d, 0x7f, 0x8f, 0xa1, 0x6c, 0xc8, 0xc7,
+  0x29, 0xe4, 0xad, 0x73, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x7c,
+  0x19, 0x6d, 0x3d, 0xa0, 0x21, 0xbc, 0x78, 0x48, 0xd4, 0x60, 0x7f, 0xda, 0x44, 0xd2, 0x29, 0x1d,
+  0xed, 0xec, 0x7a, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03,
+  0x02, 0x01, 0x86, 0x30, 0x62, 0x06, 0x03, 0x55, 0x1d, 0x1f, 0x04, 0x5b, 0x30, 0x59, 0x30, 0x57,
+  0xa0, 0x55, 0xa0, 0x53, 0x86, 0x51, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x64, 0x31, 0x75,
+  0x61, 0x64, 0x6e, 0x30, 0x70, 0x6a, 0x73, 0x69, 0x68, 0x38, 0x6d, 0x2e, 0x63, 0x6c, 0x6f, 0x75,
+  0x64, 0x66, 0x72, 0x6f, 0x6e, 0x74, 0x2e, 0x6e, 0x65, 0x74, 0x2f, 0x63, 0x72, 0x6c, 0x2f, 0x30,
+  0x61, 0x30, 0x61, 0x61, 0x34, 0x35, 0x32, 0x2d, 0x39, 0x66, 0x32, 0x37, 0x2d, 0x34, 0x38, 0x36,
+  0x33, 0x2d, 0x61, 0x65, 0x64, 0x61, 0x2d, 0x65, 0x64, 0x39, 0x37, 0x36, 0x66, 0x32, 0x30, 0x64,
+  0x38, 0x62, 0x62, 0x2e, 0x63, 0x72, 0x6c, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7,
+  0x0d, 0x01, 0x01, 0x0d, 0x05, 0x00, 0x03, 0x82, 0x02, 0x01, 0x00, 0x38, 0xaf, 0x05, 0x7b, 0x6d,
+  0xbf, 0x68, 0xe0, 0x31, 0x8c, 0x6a, 0xdc, 0xc7, 0x29, 0x6d, 0x90, 0x81, 0xaa, 0x4f, 0x88, 0x4f,
+  0x5b, 0x36, 0x34, 0x63, 0x95, 0x60, 0xef, 0x89, 0x73, 0x91, 0xc7, 0xa6, 0x0d, 0xd6, 0x5b, 0x2d,
+  0xcc, 0x40, 0x26, 0x13, 0xed, 0xf3, 0x6c, 0x84, 0xf8, 0x1f, 0xe0, 0xed, 0xb5, 0xf4, 0xb5, 0x04,
+  0x8c, 0xe1, 0x2d, 0x6b, 0xd1, 0x34, 0x27, 0x5e, 0xb2, 0x55, 0x42, 0x24, 0xce, 0xa7, 0x9d, 0x5e,
+  0x86, 0x84, 0xb0, 0x01, 0x7f, 0x63, 0x06, 0xeb, 0x51, 0x21, 0x52, 0x0e, 0x04, 0xd3, 0x42, 0x14,
+  0x22, 0x30, 0x65, 0xe0, 0xc4, 0x46, 0xbd, 0xf9, 0x13, 0x31, 0xbc, 0x2d, 0x1c, 0x21, 0x16, 0xca,
+  0xef, 0xf9, 0x75, 0x1a, 0x80, 0x8a, 0xcc, 0x11, 0x4d, 0xef, 0x9d, 0xdf, 0x99, 0xa4, 0xed, 0x7b,
+  0xf5, 0xeb, 0x6f, 0x91, 0x9e, 0xf2, 0xf5, 0x64, 0x56, 0x5f, 0xc7, 0x13, 0x2b, 0x06, 0x76, 0x73,
+  0xd6, 0x84, 0xc2, 0x43, 0x06, 0xa6, 0xb8, 0x80, 0xe8, 0xa9, 0xce, 0x2d, 0x08, 0xf6, 0x53, 0x72,
+  0x7e, 0x2e, 0x13, 0xdc, 0x69, 0x1a, 0xbf, 0x07, 0x03, 0xb8, 0xe3, 0x29, 0xca, 0x55, 0x12, 0xb3,
+  0xb1, 0x5d, 0x66, 0x77, 0x00, 0x12, 0x6e, 0xf2, 0xfc, 0x44, 0xa3, 0xbe, 0x42, 0xc3, 0xee, 0x1b,
+  0xd6, 0x9a, 0xf6, 0x06, 0xa5, 0xdb, 0x0c, 0x5e, 0x9f, 0x99, 0xd1, 0xf4, 0x3a, 0x31, 0x1a, 0x54,
+  0xb7, 0xa6, 0xeb, 0xa7, 0xf1, 0x16, 0x0f, 0x47, 0x54, 0x44, 0x9d, 0x84, 0x8a, 0x10, 0xb1, 0xe6,
+  0x60, 0x35, 0xed, 0x15, 0xd8, 0xfb, 0x95, 0xcb, 0x33, 0xfa, 0x0e, 0x71, 0x1a, 0x73, 0x83, 0xbc,
+  0x2e, 0xf8, 0x57, 0xad, 0x92, 0xb5, 0x6f, 0xdf, 0xb1, 0xcf, 0xcb, 0x1f, 0x5c, 0xf2, 0x5b, 0x77,
+  0x5b, 0x2d, 0x90, 0x43, 0xdd, 0xa8, 0xee, 0x63, 0x49, 0x0d, 0x79, 0x86, 0x59, 0x61, 0x56, 0xb6,
+  0x60, 0x2e, 0xf7, 0x32, 0x78, 0x2c, 0xcb, 0x34, 0xd5, 0x1c, 0x06, 0xb1, 0x3e, 0xb4, 0x40, 0x32,
+  0x32, 0x1d, 0xb4, 0x04, 0xed, 0x75, 0x54, 0xba, 0x04, 0x23, 0xda, 0x28, 0x2a, 0x9e, 0xee, 0xf1,
+  0xc1, 0xcf, 0x75, 0x6e, 0x86, 0x32, 0xab, 0x84, 0x04, 0x63, 0x51, 0xc9, 0xa0, 0xc9, 0x41, 0x9f,
+  0xf6, 0xe5, 0xab, 0x31, 0x49, 0x25, 0xb0, 0xdd, 0x73, 0x59, 0xcb, 0x4c, 0x58, 0x0c, 0xf5, 0x9e,
+  0x91, 0x3d, 0x49, 0x10, 0xdd, 0x35, 0xfb, 0xf1, 0x53, 0xfa, 0x94, 0x92, 0x36, 0xb2, 0x15, 0xab,
+  0xe1, 0xcb, 0xe5, 0xd7, 0x5f, 0xa5, 0x66, 0x3b, 0xf2, 0x03, 0x3e, 0xd7, 0x32, 0x56, 0xdd, 0x09,
+  0x60, 0xde, 0x6a, 0x2a, 0xf2, 0xd8, 0x1b, 0x45, 0x93, 0x41, 0x0d, 0x7f, 0x06, 0x59, 0xe5, 0x17,
+  0xc6, 0x36, 0x02, 0xb0, 0x74, 0x85, 0xd6, 0x23, 0x53, 0x10, 0x03, 0x92, 0xc9, 0xbd, 0x47, 0xb5,
+  0x72, 0x34, 0x93, 0x17, 0x71, 0x00, 0x03, 0xb7, 0xc5, 0x29, 0xd5, 0x5c, 0xb4, 0xa4, 0x47, 0x47,
+  0xfe, 0x66, 0x43, 0x32, 0x8a, 0xb6, 0xa0, 0xa5, 0x5e, 0xfc, 0x2a, 0x1f, 0x6c, 0x70, 0x04, 0x4c,
+  0xb0, 0xfb, 0x9f, 0x77, 0x89, 0x87, 0xb1, 0x45, 0xa7, 0x40, 0x75, 0xad, 0x79, 0xd3, 0x87, 0xe0,
+  0xf5, 0x04, 0x1f, 0x45, 0xf1, 0xf5, 0xa7, 0x90, 0xe4, 0xda, 0x59, 0x61, 0xd6, 0x7b, 0x3a, 0x04,
+  0xff, 0xee, 0x84, 0xdb, 0x24, 0x47, 0xe2, 0xa3, 0xff, 0x3d, 0xad, 0x28, 0xca, 0x57, 0x75, 0x46,
+  0x17, 0x93, 0x66, 0x80, 0x06, 0xd4, 0x87, 0xa3, 0x29, 0xc4, 0xc1, 0xa1, 0x01, 0xfa, 0x7c, 0xab,
+  0x9e, 0x77, 0xef, 0x85, 0x03, 0xe1, 0x11, 0x1d, 0x60, 0x86, 0xfd, 0xa9, 0x65, 0x65, 0xd4, 0xa5,
+  0xb9, 0x4c, 0x27, 0xcb, 0x96, 0x3d, 0x47, 0x96, 0x2d, 0x54, 0x2c, 0xa1, 0x63, 0x70, 0x61, 0x64,
+  0x59, 0x16, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x59, 0x02, 0x00, 0x74, 0xa7, 0xe6, 0x02, 0x16, 0xe4, 0x1d,
+  0x73, 0xb9, 0x22, 0xf5, 0xd6, 0x3d, 0x94, 0x25, 0x0d, 0x2f, 0xac, 0x06, 0x15, 0x5e, 0x80, 0xac,
+  0x6c, 0xa6, 0x61, 0x98, 0xff, 0x18, 0x1a, 0x5a, 0x5b, 0x15, 0xbb, 0x43, 0x72, 0xec, 0xee, 0xa7,
+  0xf8, 0x5e, 0x9e, 0x43, 0x45, 0x6b, 0x96, 0x98, 0x00, 0x45, 0xc9, 0xcd, 0xa0, 0x10, 0x09, 0x10,
+  0x86, 0xae, 0xc1, 0xda, 0x80, 0xb6, 0x3e, 0x0e, 0xca, 0xba, 0x72, 0x46, 0x47, 0x96, 0xec, 0xc0,
+  0x42, 0x2e, 0x33, 0xfb, 0x36, 0xa9, 0x92, 0x08, 0x68, 0x16, 0x7f, 0xb5, 0x38, 0x3e, 0x28, 0x0c,
+  0xaa, 0xc2, 0x96, 0x94, 0xf9, 0x46, 0x0c, 0x15, 0x27, 0x5d, 0xd0, 0x8d, 0x6d, 0xa2, 0xc7, 0x98,
+  0x90, 0x30, 0x34, 0x12, 0x8a, 0x12, 0x42, 0x3f, 0xae, 0x63, 0x32, 0x82, 0x94, 0x53, 0x16, 0xdd,
+  0x18, 0x84, 0x0f, 0x12, 0xb4, 0xce, 0xf0, 0x34, 0x05, 0x30, 0xfd, 0x25, 0x6f, 0xf7, 0x28, 0x3e,
+  0x92, 0x13, 0x1e, 0x17, 0x6b, 0xd7, 0x85, 0x24, 0x91, 0x90, 0x47, 0x48, 0xd3, 0x38, 0x92, 0x65,
+  0x5b, 0xfe, 0xbc, 0xeb, 0xd4, 0xcd, 0x4a, 0x30, 0xca, 0xf4, 0xa7, 0xaa, 0xa9, 0x69, 0x5d, 0x57,
+  0x6b, 0x65, 0xab, 0x2e, 0xe5, 0x31, 0xe4, 0x3b, 0x30, 0x2d, 0xcd, 0x8d, 0x9a, 0xce, 0x8f, 0x2c,
+  0xe9, 0x53, 0x31, 0xc2, 0xfd, 0xa2, 0xc7, 0x99, 0xd3, 0xa3, 0xa8, 0x4b, 0x44, 0x7e, 0x74, 0x41,
+  0x5e, 0xbc, 0xdb, 0x6b, 0x9a, 0x40, 0x2b, 0xf0, 0x78, 0x45, 0xb4, 0x57, 0x37, 0x0a, 0x3a, 0x41,
+  0x34, 0xb6, 0xd2, 0x1d, 0x97, 0x0b, 0x4f, 0x8c, 0xbd, 0xed, 0xb3, 0x01, 0x99, 0xe0, 0x7c, 0xbf,
+  0x80, 0x38, 0x47, 0xd4, 0x1e, 0xa5, 0x77, 0xa7, 0x26, 0xa3, 0x82, 0xb1, 0x5f, 0xbb, 0x16, 0x26,
+  0xc3, 0x31, 0xb7, 0xb9, 0xa9, 0xb1, 0xd5, 0xf8, 0x9b, 0x0e, 0x64, 0xa8, 0xbd, 0x91, 0x95, 0x6d,
+  0x45, 0xfb, 0x6c, 0x8d, 0x53, 0x2c, 0x53, 0xf8, 0x98, 0xc0, 0x8c, 0x96, 0x20, 0x51, 0x93, 0x37,
+  0xe0, 0xc2, 0xcf, 0x0a, 0x22, 0x01, 0x22, 0x7f, 0xed, 0x30, 0xad, 0xed, 0x36, 0xbf, 0x3f, 0xa2,
+  0x00, 0xd5, 0x97, 0xf9, 0x5d, 0x6e, 0x09, 0xf8, 0x33, 0x12, 0x14, 0xb5, 0x73, 0xa3, 0xbe, 0x39,
+  0x56, 0x74, 0x46, 0x0e, 0x00, 0x3f, 0x44, 0x1c, 0x3a, 0x49, 0x68, 0x09, 0x9c, 0x18, 0x9a, 0xfb,
+  0xad, 0xed, 0x09, 0x99, 0xaa, 0xb8, 0x7d, 0xe6, 0xe2, 0x26, 0x78, 0xd1, 0x69, 0x86, 0x8e, 0x43,
+  0xb5, 0x51, 0xf8, 0x46, 0xb2, 0x1f, 0xbf, 0x4e, 0x1d, 0xb2, 0x21, 0x1c, 0xd0, 0x30, 0x1f, 0xc4,
+  0x7e, 0xb5, 0xaf, 0x55, 0xac, 0x65, 0xb0, 0xce, 0xcf, 0x12, 0x22, 0x43, 0xf2, 0x39, 0xef, 0x67,
+  0xce, 0xc7, 0x8a, 0xac, 0x07, 0x28, 0xab, 0x4e, 0x1b, 0x98, 0xb9, 0x5f, 0x53, 0x6c, 0x9e, 0x2f,
+  0xeb, 0x5f, 0x62, 0x12, 0xb6, 0x12, 0x9d, 0x60, 0x08, 0x15, 0xc4, 0x21, 0xaa, 0x14, 0xf7, 0x64,
+  0xb8, 0xca, 0x08, 0xd9, 0xc1, 0xf0, 0x94, 0xfe, 0x38, 0x88, 0x18, 0xa3, 0x90, 0x5a, 0xcf, 0x2a,
+  0xee, 0x61, 0x18, 0xfb, 0xf2, 0xc3, 0x65, 0xfc, 0xa9, 0x2e, 0x4c, 0x52, 0x56, 0xc1, 0xe6, 0x17,
+  0x1d, 0x64, 0xf5, 0x4b, 0x6b, 0x1e, 0xe9, 0x85, 0xd3, 0xeb, 0x9a, 0x15, 0x85, 0x20, 0x92, 0x53,
+  0x24, 0x33, 0x2a, 0x9c, 0xa4, 0x00, 0xd4, 0x74, 0x5b, 0x11, 0x0a, 0xce, 0xad, 0x48, 0x6e, 0x9c,
+  0x01, 0x4e, 0x16, 0x7a, 0xc9, 0x50, 0x51, 0xbb, 0x05, 0x0c, 0x66, 0xd3, 0x99, 0x5a, 0x79, 0x6e,
+  0x45, 0x9a, 0x6e, 0x25, 0xc7, 0x27, 0x8f, 0x6a, 0x9f, 0x87, 0xce, 0xe4, 0x58, 0x0a, 0xbe, 0xcc,
+  0x91, 0x82, 0x27, 0x29, 0x8e, 0x7b, 0x36, 0xec, 0x7d, 0xe1, 0x9a, 0xd1, 0xe1, 0x00, 0x00, 0x00,
+  0xb4, 0x65, 0x58, 0x49, 0x66, 0x49, 0x49, 0x2a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12,
+  0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x05, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x1b, 0x01, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5e,
+  0x00, 0x00, 0x00, 0x28, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13,
+  0x02, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x87, 0x04, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x90, 0x07,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x32, 0x31, 0x30, 0x01, 0x91, 0x07, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0xa0, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x31, 0x30,
+  0x30, 0x01, 0xa0, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x02, 0xa0, 0x04,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x03, 0xa0, 0x04, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xa1, 0x6f, 0x40, 0x00, 0x00, 0x00,
+  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0e, 0xc4, 0x00, 0x00, 0x0e, 0xc4, 0x01, 0x95, 0x2b,
+  0x0e, 0x1b, 0x00, 0x00, 0x06, 0x2a, 0x69, 0x54, 0x58, 0x74, 0x58, 0x4d, 0x4c, 0x3a, 0x63, 0x6f,
+  0x6d, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x78, 0x6d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d,
+  0x27, 0xef, 0xbb, 0xbf, 0x27, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70,
+  0x43, 0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53, 0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63,
+  0x39, 0x64, 0x27, 0x3f, 0x3e, 0x0a, 0x3c, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61,
+  0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d, 0x27, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x3a,
+  0x6e, 0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x27, 0x3e, 0x0a, 0x3c, 0x72, 0x64, 0x66, 0x3a,
+  0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x72, 0x64, 0x66, 0x3d, 0x27, 0x68,
+  0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67,
+  0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32, 0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d,
+  0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e, 0x73, 0x23, 0x27, 0x3e, 0x0a, 0x0a, 0x20, 0x3c,
+  0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x78,
+  0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3d, 0x27, 0x68, 0x74, 0x74,
+  0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x69,
+  0x6f, 0x6e, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x61, 0x64, 0x73, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x27,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x41, 0x64, 0x73, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c, 0x69, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
+  0x65, 0x27, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
+  0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x3e, 0x32, 0x30, 0x32, 0x36, 0x2d, 0x30, 0x31,
+  0x2d, 0x32, 0x39, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x43, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x41, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x3a, 0x44, 0x61, 0x74, 0x61, 0x3e, 0x7b, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x64, 0x6f,
+  0x63, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x3a, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x44, 0x41,
+  0x47, 0x5f, 0x79, 0x50, 0x61, 0x35, 0x74, 0x51, 0x41, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x2c,
+  0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x75, 0x73, 0x65, 0x72, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b,
+  0x3a, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x55, 0x41, 0x46, 0x53, 0x49, 0x38, 0x72, 0x74, 0x37,
+  0x5a, 0x45, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x2c, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x62,
+  0x72, 0x61, 0x6e, 0x64, 0x26, 0x71, 0x75, 0x6f, 0x74, 0x3b, 0x3a, 0x26, 0x71, 0x75, 0x6f, 0x74,
+  0x3b, 0x42, 0x41, 0x46, 0x53, 0x49, 0x31, 0x63, 0x5a, 0x37, 0x2d, 0x38, 0x26, 0x71, 0x75, 0x6f,
+  0x74, 0x3b, 0x7d, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x44, 0x61, 0x74, 0x61,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x45,
+  0x78, 0x74, 0x49, 0x64, 0x3e, 0x64, 0x39, 0x38, 0x39, 0x33, 0x66, 0x33, 0x32, 0x2d, 0x62, 0x66,
+  0x63, 0x37, 0x2d, 0x34, 0x32, 0x63, 0x61, 0x2d, 0x62, 0x62, 0x30, 0x36, 0x2d, 0x30, 0x62, 0x35,
+  0x34, 0x66, 0x63, 0x30, 0x32, 0x38, 0x33, 0x37, 0x63, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72, 0x69,
+  0x62, 0x3a, 0x45, 0x78, 0x74, 0x49, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x41,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x46, 0x62, 0x49, 0x64, 0x3e, 0x35, 0x32, 0x35, 0x32, 0x36,
+  0x35, 0x39, 0x31, 0x34, 0x31, 0x37, 0x39, 0x35, 0x38, 0x30, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x3a, 0x46, 0x62, 0x49, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x41,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x54, 0x6f, 0x75, 0x63, 0x68, 0x54, 0x79, 0x70, 0x65, 0x3e,
+  0x32, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x54, 0x6f, 0x75, 0x63, 0x68, 0x54,
+  0x79, 0x70, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x6c,
+  0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x3a, 0x41, 0x64, 0x73, 0x3e,
+  0x0a, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x0a, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75,
+  0x74, 0x3d, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x43, 0x6f, 0x6e,
+  0x74, 0x61, 0x69, 0x6e, 0x73, 0x41, 0x69, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f,
+  0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x65, 0x78, 0x70, 0x6f, 0x72,
+  0x74, 0x27, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x41,
+  0x69, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
+  0x74, 0x3a, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x41, 0x69, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x64, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3e, 0x59, 0x65, 0x73,
+  0x3c, 0x2f, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x41, 0x69, 0x47, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x64, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x43, 0x6f, 0x6e,
+  0x74, 0x61, 0x69, 0x6e, 0x73, 0x41, 0x69, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3e, 0x0a, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a,
+  0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x0a, 0x20, 0x3c,
+  0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x78,
+  0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x64, 0x63, 0x3d, 0x27, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
+  0x70, 0x75, 0x72, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x73, 0x2f, 0x31, 0x2e, 0x31, 0x2f, 0x27, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x64,
+  0x63, 0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x3c, 0x72, 0x64, 0x66,
+  0x3a, 0x41, 0x6c, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x6c,
+  0x69, 0x20, 0x78, 0x6d, 0x6c, 0x3a, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x27, 0x78, 0x2d, 0x64, 0x65,
+  0x66, 0x61, 0x75, 0x6c, 0x74, 0x27, 0x3e, 0x41, 0x64, 0x73, 0xc4, 0xb1, 0x7a, 0x20, 0x74, 0x61,
+  0x73, 0x61, 0x72, 0xc4, 0xb1, 0x6d, 0x20, 0x2d, 0x20, 0x31, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a,
+  0x6c, 0x69, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x41, 0x6c, 0x74,
+  0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x63, 0x3a, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a,
+  0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x3e, 0x0a, 0x0a, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74,
+  0x3d, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x70, 0x64, 0x66, 0x3d,
+  0x27, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65,
+  0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x70, 0x64, 0x66, 0x2f, 0x31, 0x2e, 0x33, 0x2f, 0x27, 0x3e, 0x0a,
+  0x20, 0x20, 0x3c, 0x70, 0x64, 0x66, 0x3a, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x3e, 0x4d, 0x65,
+  0x73, 0x75, 0x74, 0x20, 0x41, 0x73, 0x6c, 0x61, 0x6e, 0x3c, 0x2f, 0x70, 0x64, 0x66, 0x3a, 0x41,
+  0x75, 0x74, 0x68, 0x6f, 0x72, 0x3e, 0x0a, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x0a, 0x20, 0x3c, 0x72, 0x64,
+  0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x64,
+  0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x78, 0x6d, 0x6c,
+  0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x27, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
+  0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
+  0x31, 0x2e, 0x30, 0x2f, 0x27, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72,
+  0x65, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x6f, 0x6f, 0x6c, 0x3e, 0x43, 0x61, 0x6e, 0x76, 0x61, 0x20,
+  0x64, 0x6f, 0x63, 0x3d, 0x44, 0x41, 0x47, 0x5f, 0x79, 0x50, 0x61, 0x35, 0x74, 0x51, 0x41, 0x20,
+  0x75, 0x73, 0x65, 0x72, 0x3d, 0x55, 0x41, 0x46, 0x53, 0x49, 0x38, 0x72, 0x74, 0x37, 0x5a, 0x45,
+  0x20, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x3d, 0x42, 0x41, 0x46, 0x53, 0x49, 0x31, 0x63, 0x5a, 0x37,
+  0x2d, 0x38, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72, 0x54,
+  0x6f, 0x6f, 0x6c, 0x3e, 0x0a, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63,
+  0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x52,
+  0x44, 0x46, 0x3e, 0x0a, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x3e,
+  0x0a, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x3d, 0x27,
+  0x72, 0x27, 0x3f, 0x3e, 0x32, 0xcb, 0xf6, 0xc6, 0x00, 0x00, 0x1e, 0xaa, 0x49, 0x44, 0x41, 0x54,
+  0x78, 0x9c, 0xed, 0x9c, 0x07, 0x74, 0x14, 0xd7, 0xd9, 0xb0, 0x0d, 0x46, 0x48, 0x5a, 0x6d, 0xdf,
+  0xe9, 0xbd, 0xec, 0x6c, 0x9d, 0xed, 0x4d, 0xbd, 0x23, 0x54, 0x90, 0xd5, 0x51, 0x01, 0x24, 0x84,
+  0x24, 0x3a, 0x88, 0x8e, 0x30, 0x20, 0x9a, 0x31, 0x45, 0xb6, 0xc1, 0xd8, 0x80, 0x6b, 0x5c, 0x88,
+  0x93, 0x7c, 0x04, 0xdb, 0x80, 0x1d, 0x57, 0xb0, 0x13, 0x3b, 0xb1, 0x8d, 0x13, 0xc7, 0xc1, 0x31,
+  0x45, 0x14, 0x83, 0x64, 0x10, 0xbd, 0x18, 0x6c, 0xb0, 0x29, 0xd6, 0x7f, 0x77, 0xd7, 0xce, 0x9f,
+  0x7c, 0x5f, 0xbe, 0x9c, 0x3f, 0xe7, 0x48, 0x16, 0x39, 0xe7, 0x7f, 0xb5, 0x9a, 0x73, 0xf7, 0xce,
+  0xcc, 0x9d, 0xf7, 0x3e, 0xfb, 0xde, 0xf7, 0xbe, 0xf7, 0xce, 0x9d, 0xb9, 0x0b, 0xfb, 0xff, 0xd2,
+  0x9f, 0x72, 0xd7, 0x40, 0x2b, 0xf0, 0x6f, 0x08, 0x8e, 0x61, 0x04, 0x86, 0xe3, 0x03, 0xad, 0xc6,
+  0xbf, 0x25, 0x77, 0x3a, 0x5f, 0xfc, 0xef, 0x12, 0x08, 0x86, 0xaa, 0x51, 0x03, 0x8a, 0xa1, 0xf8,
+  0xff, 0xd8, 0x7b, 0xc7, 0xca, 0x80, 0xf1, 0x45, 0x01, 0xa7, 0x08, 0x20, 0xfc, 0x9f, 0xe5, 0x47,
+  0x05, 0x00, 0x85, 0x30, 0x38, 0x7a, 0x0c, 0x8c, 0x22, 0x02, 0x46, 0x35, 0xb0, 0x49, 0x3c, 0x46,
+  0xc2, 0x28, 0x1a, 0xc9, 0xc4, 0xc1, 0x5e, 0x04, 0x1c, 0x15, 0x3d, 0x11, 0x9c, 0x8a, 0xa2, 0xd8,
+  0x3f, 0x93, 0xff, 0x25, 0xfb, 0xa7, 0x90, 0x81, 0xe1, 0x0b, 0x2a, 0x4c, 0xd3, 0x04, 0x68, 0xea,
+  0x28, 0xfa, 0x0f, 0x50, 0x40, 0x8a, 0x04, 0xd9, 0x38, 0x0e, 0x32, 0x01, 0x5c, 0x01, 0x63, 0x65,
+  0xcc, 0x1c, 0x41, 0x8c, 0x43, 0x28, 0x02, 0xe0, 0xd6, 0x08, 0x81, 0x7a, 0x2e, 0x11, 0xa4, 0x89,
+  0x08, 0x5c, 0x3b, 0x66, 0x92, 0x30, 0x01, 0x20, 0x06, 0x65, 0x80, 0xd2, 0x28, 0x92, 0x40, 0xff,
+  0xe1, 0x2a, 0x61, 0x01, 0x17, 0x61, 0x68, 0x62, 0xa0, 0x10, 0x0f, 0x00, 0x5f, 0x00, 0x02, 0x82,
+  0x11, 0x8f, 0x43, 0x34, 0x89, 0x2c, 0x4d, 0x10, 0x1c, 0x4d, 0x45, 0x11, 0xe3, 0x04, 0x81, 0xe2,
+  0x38, 0x4b, 0x93, 0x7e, 0x9b, 0x04, 0xf2, 0xf5, 0x18, 0xe4, 0x84, 0x2d, 0xcb, 0xa0, 0x16, 0x14,
+  0x47, 0x75, 0x28, 0x94, 0x44, 0x9a, 0xeb, 0xa5, 0xe0, 0xea, 0xa9, 0x52, 0x93, 0x39, 0x14, 0xa2,
+  0xcc, 0x7a, 0x14, 0x36, 0xe0, 0xd0, 0x52, 0xa4, 0x29, 0x05, 0x76, 0x6b, 0x30, 0x3d, 0x45, 0x10,
+  0x21, 0xbb, 0xd1, 0xc8, 0x51, 0x08, 0x28, 0x9e, 0x20, 0xb0, 0x08, 0x5c, 0x8e, 0x01, 0xc0, 0x09,
+  0x9b, 0x59, 0xf0, 0xb9, 0x44, 0x08, 0x42, 0x06, 0xc4, 0x73, 0x0f, 0x9c, 0x7f, 0x88, 0xd8, 0x9c,
+  0xc7, 0x66, 0x04, 0x90, 0x11, 0x04, 0xc5, 0x09, 0x1c, 0xd1, 0x6a, 0x11, 0x95, 0x1a, 0x46, 0x50,
+  0x81, 0xa6, 0xac, 0x3c, 0x0f, 0x9c, 0x00, 0x4b, 0x53, 0x85, 0x78, 0x16, 0x87, 0xb1, 0x7a, 0x1c,
+  0x2a, 0xc3, 0x3c, 0x4d, 0x79, 0xd9, 0xb7, 0xb6, 0x66, 0x4f, 0xce, 0x34, 0x97, 0x51, 0x89, 0x80,
+  0x3e, 0x8b, 0x31, 0x45, 0x64, 0xb6, 0xc0, 0xd2, 0x10, 0x82, 0xd8, 0x44, 0x5e, 0x64, 0x40, 0x02,
+  0x45, 0xd5, 0x1a, 0x44, 0xa3, 0x0d, 0x97, 0x86, 0xa0, 0x12, 0x47, 0xfb, 0xed, 0x46, 0xc0, 0x1b,
+  0xa4, 0x07, 0xaa, 0x9a, 0x03, 0xc3, 0x37, 0x6c, 0x49, 0xc0, 0x03, 0x20, 0x48, 0xa2, 0xc9, 0xe2,
+  0x14, 0x45, 0x04, 0x7c, 0x57, 0xab, 0xe5, 0xb1, 0x75, 0xbe, 0xf9, 0x33, 0x71, 0x9d, 0x1e, 0x42,
+  0x51, 0x0b, 0xc3, 0x51, 0x28, 0xe1, 0x4b, 0xb4, 0xe8, 0x58, 0x48, 0x01, 0x6b, 0x93, 0x29, 0x53,
+  0x15, 0x16, 0x7a, 0x7e, 0x69, 0x4d, 0xef, 0x93, 0x89, 0xcf, 0x94, 0x59, 0xaa, 0xe9, 0xa4, 0x24,
+  0xca, 0x04, 0xf2, 0xf5, 0xac, 0x21, 0x98, 0x68, 0x21, 0x31, 0x42, 0xe6, 0x45, 0x70, 0x16, 0xae,
+  0x33, 0x04, 0x66, 0x4e, 0x95, 0xc7, 0xd4, 0xe2, 0x6a, 0x35, 0x84, 0xa3, 0x6e, 0x49, 0x48, 0x36,
+  0x9b, 0x61, 0x18, 0x19, 0xc0, 0x6e, 0xf0, 0xa7, 0xe0, 0x0b, 0xff, 0x37, 0xf3, 0x21, 0x70, 0x48,
+  0xa7, 0x75, 0xe7, 0x17, 0x18, 0xed, 0x72, 0x3d, 0x93, 0xea, 0x22, 0x25, 0x35, 0x8c, 0xc6, 0xc7,
+  0x29, 0x6d, 0x23, 0x2b, 0xec, 0x93, 0x9a, 0xb4, 0x3a, 0x35, 0x68, 0xe2, 0x30, 0x86, 0xb0, 0x38,
+  0xe1, 0x20, 0xb8, 0x6a, 0xd6, 0x5f, 0xc6, 0x04, 0xb2, 0x10, 0x4b, 0x51, 0x20, 0xfd, 0xc2, 0xaf,
+  0x9a, 0x7b, 0xb7, 0x48, 0xfb, 0x46, 0xba, 0x33, 0x08, 0x69, 0x18, 0xe9, 0x28, 0x25, 0xfc, 0x35,
+  0x4c, 0xd0, 0x49, 0xf0, 0x4c, 0xd8, 0x63, 0x83, 0x52, 0x09, 0xad, 0x4e, 0xe3, 0x18, 0xdf, 0xe8,
+  0x18, 0x59, 0x19, 0x1b, 0x97, 0x40, 0xc1, 0x5c, 0x90, 0xb4, 0xd6, 0xd1, 0xc9, 0x92, 0xd3, 0xed,
+  0x29, 0x2e, 0x36, 0x68, 0x35, 0xe0, 0x88, 0x7f, 0xa5, 0x55, 0xff, 0x48, 0xbf, 0xf3, 0x05, 0x4d,
+  0x56, 0x14, 0xc2, 0x1e, 0x16, 0xd4, 0x07, 0x8f, 0xf4, 0x60, 0x14, 0x41, 0xa1, 0x1a, 0x5d, 0xa0,
+  0xbc, 0xca, 0x16, 0x4a, 0x14, 0x51, 0x2c, 0x41, 0x8f, 0x96, 0x7b, 0xd9, 0xe6, 0x54, 0xb3, 0x46,
+  0xa9, 0xe2, 0x95, 0xda, 0x4c, 0xc6, 0xc6, 0x60, 0x44, 0x2e, 0x65, 0x2f, 0x24, 0xbc, 0xa5, 0x9c,
+  0x3f, 0x95, 0x93, 0x66, 0x27, 0xb9, 0x93, 0x39, 0x7c, 0xd9, 0xe4, 0x51, 0xbd, 0xdb, 0xf2, 0xaf,
+  0x6e, 0x92, 0xbe, 0x9d, 0x1b, 0x18, 0xcf, 0x49, 0xa9, 0x16, 0xae, 0x2d, 0xd1, 0x93, 0x29, 0x98,
+  0x4b, 0x58, 0x7f, 0x11, 0xee, 0xcb, 0xa3, 0x9c, 0x14, 0x86, 0xa5, 0x32, 0x36, 0x4e, 0xa9, 0x53,
+  0x29, 0x95, 0xe3, 0x32, 0xcc, 0x23, 0xfd, 0x82, 0x5a, 0x87, 0x0b, 0x28, 0x6a, 0x4b, 0x4c, 0xf2,
+  0x56, 0x56, 0x62, 0x1a, 0x5d, 0xf8, 0xba, 0xd1, 0x50, 0x24, 0xec, 0x9a, 0x30, 0x91, 0xa7, 0x90,
+  0xfe, 0xef, 0xf5, 0xfa, 0x97, 0x2f, 0x30, 0x2b, 0x9d, 0x1e, 0xc9, 0x49, 0x31, 0xd5, 0x8e, 0x70,
+  0x00, 0xeb, 0x01, 0x7f, 0x1a, 0xc2, 0x50, 0x81, 0x67, 0x35, 0x41, 0x05, 0x94, 0xdf, 0x13, 0x4a,
+  0x4a, 0xe7, 0x31, 0xa8, 0xc4, 0x27, 0xbc, 0x34, 0xda, 0xf9, 0x58, 0xb9, 0xdb, 0x67, 0xe4, 0xab,
+  0xf9, 0x60, 0x03, 0x1d, 0xac, 0xa5, 0x43, 0xc3, 0x05, 0xc7, 0xcc, 0x34, 0xcb, 0xcb, 0x75, 0x72,
+  0xd7, 0x64, 0xe7, 0x37, 0x53, 0x1d, 0x8d, 0xc9, 0xde, 0x7d, 0x4f, 0xb4, 0x7e, 0xff, 0x98, 0xf5,
+  0xf2, 0x26, 0xb9, 0x77, 0x83, 0x67, 0x87, 0x47, 0xae, 0xb5, 0x9b, 0xbe, 0x9e, 0xec, 0xed, 0x9e,
+  0x2c, 0xef, 0xa8, 0xb3, 0xb6, 0xa6, 0x5a, 0xf3, 0x38, 0x47, 0x15, 0x15, 0xa8, 0xa5, 0x02, 0x75,
+  0x4c, 0x52, 0x40, 0x12, 0x1e, 0xaf, 0xf1, 0xed, 0x68, 0xf2, 0x8c, 0xf0, 0x0b, 0x2c, 0xa4, 0x4f,
+  0xc9, 0xcd, 0xa1, 0xd2, 0x82, 0x13, 0x74, 0x79, 0x35, 0x78, 0x36, 0xb8, 0x3a, 0xd0, 0x01, 0x68,
+  0x02, 0xf4, 0xc9, 0x4a, 0x32, 0x01, 0xdd, 0xfa, 0xbb, 0xd3, 0xeb, 0x77, 0xfb, 0x05, 0x15, 0xd0,
+  0xea, 0xe0, 0x54, 0x9f, 0x18, 0x74, 0x89, 0x06, 0x03, 0x02, 0xab, 0xd5, 0x1c, 0x42, 0x1a, 0x31,
+  0x0e, 0x42, 0x31, 0x57, 0x76, 0x29, 0xc2, 0x99, 0x67, 0x67, 0x89, 0xed, 0x79, 0x56, 0x60, 0xbf,
+  0x02, 0x41, 0xca, 0x0c, 0xe3, 0x35, 0x53, 0x55, 0x2e, 0x69, 0xff, 0x44, 0xd7, 0xad, 0x56, 0xef,
+  0xf5, 0x29, 0x81, 0xde, 0xf9, 0xbe, 0x1d, 0x25, 0xc6, 0x49, 0xd5, 0x55, 0xbd, 0xaf, 0xd7, 0x7e,
+  0x3c, 0x9f, 0x4a, 0x73, 0xf0, 0xbf, 0x5f, 0x68, 0xbe, 0x5e, 0x1f, 0x28, 0xc2, 0xc4, 0x9d, 0xe5,
+  0xae, 0xde, 0x39, 0xae, 0x1b, 0x53, 0xbc, 0xdf, 0x4d, 0xf5, 0xfe, 0x75, 0x82, 0xab, 0xda, 0x23,
+  0xb9, 0x24, 0xda, 0xc7, 0x09, 0x4e, 0x8a, 0x9f, 0x90, 0x69, 0x5d, 0x51, 0xea, 0x98, 0x9e, 0xc1,
+  0xa3, 0x56, 0x47, 0x52, 0x4b, 0x33, 0x42, 0x10, 0x46, 0x94, 0x05, 0xd7, 0x85, 0x35, 0x6a, 0x83,
+  0x01, 0x0e, 0xba, 0xc5, 0x14, 0xbf, 0xa0, 0xd1, 0xc1, 0x3f, 0x41, 0x44, 0xf1, 0x53, 0xf8, 0x5f,
+  0xd0, 0x0c, 0x8d, 0x02, 0x47, 0x80, 0xf0, 0x0b, 0x41, 0x42, 0x8b, 0xe6, 0xb1, 0x01, 0x2f, 0x0a,
+  0xe9, 0x6d, 0x02, 0x83, 0x53, 0x8c, 0x3f, 0xb7, 0x4a, 0x85, 0x12, 0x36, 0x86, 0xcc, 0xe1, 0xec,
+  0xc0, 0x85, 0xbe, 0x55, 0x2f, 0xbf, 0x37, 0xd6, 0x35, 0xc7, 0x6f, 0xef, 0x9d, 0x15, 0xe8, 0x69,
+  0x74, 0x1d, 0xab, 0xf6, 0xf4, 0xce, 0xf7, 0xcf, 0x4b, 0x34, 0x7d, 0xf8, 0xdc, 0xc6, 0xd3, 0x8f,
+  0x16, 0x67, 0x8d, 0xcc, 0x12, 0x56, 0x3f, 0xe9, 0x4e, 0x49, 0xf9, 0x4b, 0x8e, 0xfb, 0x49, 0xa3,
+  0xab, 0xc9, 0x6d, 0xe9, 0x9d, 0xeb, 0x3f, 0x55, 0xe7, 0xee, 0x1e, 0xe3, 0x01, 0xc7, 0xcf, 0x0d,
+  0x59, 0x5e, 0xaf, 0x73, 0xee, 0x1e, 0x2d, 0xe3, 0x18, 0x99, 0xc5, 0xc8, 0x56, 0x1a, 0x57, 0xe1,
+  0x54, 0x72, 0xd3, 0x04, 0x82, 0x65, 0x2d, 0x22, 0x85, 0xc2, 0x7a, 0x36, 0xe8, 0x0d, 0xae, 0x6c,
+  0x47, 0xc3, 0xfe, 0x1f, 0xe7, 0x18, 0xf6, 0xa7, 0x19, 0x75, 0xfc, 0x14, 0x7c, 0x41, 0x45, 0x18,
+  0x9a, 0x64, 0x48, 0x82, 0x62, 0xe8, 0xf4, 0x35, 0x2b, 0x3c, 0xd5, 0xd5, 0x0c, 0xac, 0xcb, 0x74,
+  0x99, 0x21, 0x08, 0x22, 0x1d, 0x1e, 0x0b, 0x2b, 0x56, 0x90, 0x6e, 0x3f, 0x6d, 0x7a, 0xbd, 0x21,
+  0x6c, 0x8f, 0xbd, 0x73, 0x7c, 0xcd, 0x89, 0xd2, 0xb3, 0x99, 0x72, 0x6f, 0xab, 0xf7, 0xd3, 0x26,
+  0xd7, 0xd2, 0x6c, 0xb3, 0xd3, 0x68, 0xbc, 0xf0, 0xfc, 0xca, 0xf7, 0x46, 0xf9, 0xcd, 0x73, 0xa6,
+  0xa7, 0xee, 0xd9, 0x8f, 0xa4, 0x95, 0xbf, 0x28, 0x58, 0x3f, 0x72, 0x25, 0x8a, 0x24, 0xb9, 0x28,
+  0xc3, 0xf2, 0x51, 0x83, 0xb3, 0xb7, 0xd5, 0xff, 0x62, 0x8e, 0xb3, 0x3e, 0x20, 0xdd, 0x9a, 0xed,
+  0xed, 0x9d, 0xe9, 0x7a, 0xa7, 0xde, 0x15, 0xa2, 0x4d, 0x65, 0xa8, 0xc7, 0x6a, 0x34, 0x09, 0x59,
+  0x69, 0x90, 0xde, 0x90, 0x16, 0xb4, 0xb2, 0x90, 0xce, 0x37, 0xaa, 0x2e, 0xfd, 0x81, 0xfb, 0x81,
+  0x0e, 0x14, 0x8e, 0xd1, 0x14, 0x19, 0x51, 0xec, 0x3f, 0xdc, 0xff, 0x46, 0xdc, 0x03, 0x01, 0xec,
+  0x05, 0x46, 0x10, 0xb3, 0xc0, 0x82, 0x2e, 0x5e, 0x17, 0x1b, 0xef, 0x2b, 0x1e, 0xe1, 0x1d, 0x7e,
+  0x4f, 0x82, 0x5a, 0x99, 0x46, 0xcb, 0x85, 0xa4, 0xb3, 0x8a, 0xf6, 0xfa, 0x58, 0xf1, 0xad, 0xb1,
+  0xce, 0xde, 0x05, 0x9e, 0xf7, 0xc7, 0xca, 0xbf, 0xa8, 0xb4, 0x7d, 0x39, 0xd3, 0x5b, 0xe9, 0x90,
+  0x46, 0x58, 0x79, 0x9a, 0xa1, 0x15, 0x4a, 0xad, 0x42, 0xa3, 0xaf, 0xf5, 0x8b, 0xb7, 0xa7, 0xca,
+  0x0f, 0x97, 0xfa, 0x98, 0xe1, 0xc5, 0x6d, 0x66, 0xf9, 0x90, 0x37, 0x94, 0x27, 0x18, 0xd5, 0x10,
+  0xa4, 0x50, 0xea, 0x50, 0x8a, 0x2a, 0xb4, 0xb2, 0x25, 0xb2, 0xb1, 0x73, 0x9a, 0xeb, 0xb5, 0x51,
+  0xd6, 0xb7, 0xc7, 0xc8, 0xdf, 0xcf, 0x75, 0xed, 0x1e, 0x2b, 0xfb, 0x39, 0x69, 0x24, 0x1d, 0x2c,
+  0x20, 0x9d, 0xe9, 0x8c, 0x43, 0xa9, 0x51, 0x79, 0x2a, 0x2a, 0x3c, 0xc5, 0x45, 0xfa, 0xd8, 0x78,
+  0xa0, 0x12, 0x4f, 0x93, 0x48, 0xa4, 0xb3, 0xa5, 0x18, 0x26, 0x3a, 0x18, 0xe9, 0x3f, 0xe9, 0x57,
+  0xbe, 0xa0, 0x0e, 0x04, 0x85, 0xb3, 0x6a, 0x44, 0x8b, 0x62, 0x28, 0x04, 0x83, 0x01, 0x15, 0x41,
+  0xd0, 0xa4, 0x4e, 0xa3, 0xb6, 0xba, 0xd3, 0x44, 0x5b, 0xd0, 0x8c, 0x92, 0x0b, 0xb9, 0x02, 0x37,
+  0x2d, 0xbc, 0x07, 0x6c, 0xb0, 0xcd, 0xbd, 0xbb, 0xc1, 0xb5, 0xa6, 0xd4, 0x35, 0x63, 0xb8, 0xf4,
+  0xec, 0x70, 0xdb, 0x17, 0xc3, 0x43, 0xe3, 0xac, 0x16, 0x7d, 0x5c, 0x82, 0x25, 0x23, 0x39, 0xb8,
+  0x70, 0x5e, 0x9c, 0x16, 0x5e, 0x98, 0x26, 0xf6, 0xce, 0xf5, 0xbc, 0x99, 0x6c, 0xe9, 0x72, 0xa5,
+  0x34, 0x0b, 0x46, 0x05, 0x64, 0x08, 0x4c, 0x9b, 0x66, 0x0c, 0x7a, 0xa1, 0x78, 0xc5, 0x18, 0x93,
+  0x65, 0x7f, 0x66, 0x68, 0x67, 0x91, 0xf3, 0xde, 0x11, 0xb6, 0x87, 0xca, 0x9d, 0x2f, 0xd5, 0xca,
+  0xbd, 0x6d, 0x9e, 0xdf, 0x35, 0x38, 0x7c, 0x8c, 0xb8, 0x88, 0x2d, 0x32, 0x43, 0x84, 0x29, 0x2d,
+  0xdb, 0x9a, 0x3d, 0x4c, 0xa7, 0x54, 0x52, 0x0c, 0xc9, 0xf3, 0x44, 0x78, 0x18, 0x82, 0x63, 0x1a,
+  0x58, 0x6b, 0x94, 0x1d, 0x24, 0xcd, 0xf4, 0xab, 0x15, 0xf7, 0x73, 0xfc, 0x10, 0x76, 0xbe, 0x48,
+  0xa1, 0x29, 0x8d, 0x41, 0x19, 0x23, 0x83, 0x5f, 0x7c, 0x26, 0xe7, 0x97, 0xd3, 0x3d, 0x3a, 0x03,
+  0xce, 0x82, 0x6c, 0x82, 0x1a, 0xc1, 0x78, 0x52, 0x78, 0xe9, 0xe5, 0x61, 0xae, 0x1b, 0xf5, 0xbe,
+  0x83, 0xcd, 0xae, 0x7b, 0xf3, 0xa5, 0xf5, 0xd5, 0xf2, 0x92, 0x54, 0xfb, 0x68, 0xce, 0x7e, 0x8f,
+  0xc0, 0x65, 0x42, 0x90, 0xdc, 0x50, 0x93, 0xb1, 0x77, 0xaf, 0xb5, 0x69, 0x26, 0x2f, 0x99, 0x0d,
+  0xbc, 0xf9, 0xf1, 0x02, 0xe9, 0x76, 0x59, 0xe6, 0x7c, 0x42, 0x84, 0x2c, 0x36, 0x8e, 0x15, 0xa4,
+  0xaa, 0xc6, 0xd4, 0xf7, 0x3f, 0xb0, 0xd6, 0x96, 0x65, 0x18, 0xf4, 0x55, 0x82, 0x30, 0x4e, 0x90,
+  0xd7, 0x64, 0x7a, 0xd6, 0x57, 0xca, 0xf3, 0xf2, 0xa4, 0x4f, 0xc6, 0x39, 0x6f, 0x8d, 0xf5, 0xef,
+  0x1c, 0xe6, 0x4a, 0xe3, 0xa4, 0x72, 0xda, 0x8b, 0x81, 0x86, 0x00, 0xc6, 0xd3, 0x06, 0x7c, 0xc7,
+  0x22, 0xff, 0xd9, 0xcd, 0xc9, 0x22, 0x4d, 0xd0, 0x08, 0x93, 0x4d, 0x25, 0xc1, 0xb0, 0x01, 0xeb,
+  0x67, 0x0f, 0xd1, 0x8f, 0x7c, 0xa3, 0x33, 0x8a, 0x7a, 0x14, 0x6e, 0x21, 0x8b, 0x1d, 0xb4, 0x8d,
+  0x20, 0xd1, 0xe7, 0x46, 0x3b, 0x66, 0x67, 0x4b, 0x71, 0x10, 0x64, 0xe6, 0x09, 0xaf, 0xc0, 0xf1,
+  0x08, 0xbd, 0xca, 0x6d, 0xb9, 0x55, 0x9d, 0x7a, 0xfa, 0x9e, 0xd0, 0xd9, 0x2a, 0xdf, 0xd6, 0x91,
+  0xb6, 0x29, 0x1e, 0xf3, 0x78, 0xc1, 0x95, 0x48, 0x8a, 0x6a, 0x02, 0xb7, 0x2d, 0x6f, 0x4b, 0x39,
+  0xb0, 0xcf, 0x38, 0x71, 0x89, 0x51, 0xf6, 0xe6, 0x77, 0x3c, 0x43, 0x9a, 0x1d, 0xbc, 0x68, 0x1e,
+  0x67, 0x35, 0x52, 0x9c, 0x91, 0xb1, 0x3a, 0x12, 0xdb, 0x1e, 0x66, 0x4d, 0xb2, 0xb9, 0x69, 0x61,
+  0xf2, 0x9f, 0xfe, 0x62, 0xbd, 0x77, 0xa6, 0x1a, 0x45, 0x83, 0xb4, 0xd0, 0xcc, 0xba, 0xa7, 0x39,
+  0xec, 0x2f, 0x54, 0x3a, 0xcf, 0xd7, 0x04, 0xcf, 0xde, 0x93, 0x78, 0xbb, 0x2a, 0x65, 0x55, 0xc8,
+  0x0a, 0x62, 0x95, 0x64, 0x89, 0x97, 0x78, 0x22, 0x1e, 0x36, 0xb4, 0x97, 0xd8, 0x9e, 0x18, 0x2e,
+  0x13, 0x38, 0x6a, 0xa3, 0xac, 0x23, 0xe1, 0xe1, 0xfa, 0xf0, 0xf4, 0x1b, 0xda, 0xaf, 0x41, 0x44,
+  0x3f, 0xf2, 0x05, 0x3e, 0x81, 0xc7, 0x29, 0x2b, 0xc6, 0xaa, 0x69, 0x98, 0xf1, 0xda, 0xb5, 0x90,
+  0x01, 0x36, 0x90, 0x34, 0x4c, 0x15, 0xd3, 0xbe, 0x2c, 0xda, 0x11, 0xb2, 0xb0, 0xb2, 0x2c, 0x07,
+  0xdd, 0x8e, 0x22, 0x23, 0xbe, 0x39, 0xd1, 0x58, 0x6c, 0x14, 0x33, 0x45, 0xa1, 0xc1, 0x24, 0x3b,
+  0x69, 0x4e, 0x9b, 0xa0, 0xf0, 0x2f, 0x59, 0x9c, 0xf5, 0xd5, 0x49, 0xb1, 0x71, 0x01, 0x67, 0x71,
+  0xf2, 0x49, 0x19, 0x96, 0x51, 0xad, 0xee, 0xc6, 0x36, 0xdc, 0xee, 0x1d, 0xac, 0x4a, 0x20, 0x1c,
+  0x5e, 0xcf, 0xb8, 0x36, 0x53, 0xed, 0x4c, 0x21, 0x29, 0x93, 0x17, 0x65, 0x53, 0x53, 0x5b, 0xee,
+  0xd7, 0xa7, 0xbc, 0x8b, 0x17, 0x6b, 0x94, 0x4a, 0x2f, 0x2d, 0x34, 0x18, 0x1d, 0x99, 0xbc, 0x54,
+  0x6b, 0x96, 0x1e, 0x4b, 0x91, 0x0a, 0xed, 0xa4, 0xcf, 0x69, 0xb3, 0x9a, 0x4d, 0x49, 0x32, 0x9b,
+  0x4e, 0xcb, 0x23, 0x18, 0x1f, 0x0d, 0x81, 0x40, 0x82, 0x02, 0x9a, 0x50, 0x1e, 0xbb, 0x86, 0x41,
+  0x1c, 0x18, 0x6f, 0xc4, 0x69, 0xa4, 0x3f, 0x6d, 0xb8, 0xbf, 0xf8, 0x92, 0x18, 0xae, 0x44, 0xf5,
+  0x2d, 0x6c, 0x5a, 0x33, 0x97, 0x5e, 0x4a, 0xfb, 0x4b, 0x48, 0x6f, 0x11, 0xe3, 0x2d, 0x61, 0x9c,
+  0x85, 0x9c, 0x2b, 0x03, 0x33, 0xa5, 0x60, 0xe6, 0xc1, 0x9a, 0xf8, 0xd5, 0x2d, 0x4b, 0x3b, 0x17,
+  0xbe, 0x37, 0xbf, 0x70, 0x76, 0xb2, 0x33, 0x8d, 0x21, 0xa8, 0x51, 0x54, 0xc8, 0x84, 0x51, 0x18,
+  0x2f, 0x58, 0x12, 0xb3, 0x70, 0xc1, 0x18, 0x7c, 0x69, 0x7b, 0x60, 0xcb, 0x16, 0x0c, 0x67, 0x18,
+  0x0c, 0x0a, 0x24, 0x87, 0x90, 0x40, 0x46, 0x36, 0x46, 0x6e, 0xb5, 0xe7, 0x64, 0xc3, 0x04, 0x99,
+  0x56, 0xe4, 0x4b, 0xf4, 0x93, 0x90, 0x8e, 0x36, 0x99, 0x52, 0xde, 0x7c, 0xd1, 0xff, 0xf2, 0x6b,
+  0x84, 0xc5, 0x69, 0x0a, 0x65, 0x60, 0x9c, 0x60, 0x21, 0xe8, 0x31, 0x4c, 0x92, 0x80, 0x33, 0x01,
+  0x29, 0x79, 0x72, 0x68, 0xe2, 0xce, 0xf4, 0xe7, 0x6b, 0xc9, 0x8a, 0xa1, 0xb0, 0xd2, 0x83, 0xf2,
+  0xe9, 0x98, 0x54, 0x26, 0x78, 0xaa, 0x58, 0x0f, 0x00, 0x5d, 0x4c, 0x7a, 0x4a, 0x69, 0x6f, 0x33,
+  0x97, 0x32, 0x81, 0x49, 0x05, 0x7a, 0x92, 0xfd, 0x36, 0x53, 0xdf, 0x5f, 0x7c, 0x81, 0xbe, 0x10,
+  0x8a, 0x04, 0x29, 0xf3, 0x48, 0xd6, 0x9f, 0x4a, 0x07, 0xd2, 0x59, 0x1f, 0x03, 0x43, 0x72, 0xdd,
+  0x64, 0xfb, 0xbd, 0x8f, 0x18, 0xcb, 0xc6, 0xe0, 0x76, 0x17, 0xcb, 0x52, 0xbf, 0x4b, 0x7f, 0xfc,
+  0x34, 0xf1, 0xfc, 0x45, 0xdf, 0xab, 0x7b, 0xec, 0x8f, 0x6e, 0x16, 0x67, 0xcc, 0xc6, 0xcb, 0xd2,
+  0x08, 0x87, 0x9a, 0x30, 0xa0, 0x92, 0x24, 0xa5, 0xe4, 0x12, 0x9c, 0x29, 0xe9, 0xd5, 0xd7, 0xfd,
+  0xcf, 0x6e, 0x01, 0x2d, 0x38, 0x60, 0x64, 0x42, 0x46, 0x76, 0x9a, 0x60, 0xed, 0x75, 0xe7, 0x4f,
+  0x61, 0x6c, 0xc9, 0x66, 0xce, 0xc7, 0x11, 0x8c, 0xc8, 0xa7, 0xbe, 0xf3, 0xb2, 0x6f, 0xe7, 0x9b,
+  0xa4, 0xe4, 0x34, 0x27, 0xe7, 0x60, 0x46, 0x51, 0x47, 0x40, 0x3e, 0xc4, 0x51, 0xa9, 0x1b, 0x31,
+  0x43, 0x3f, 0xfe, 0x09, 0x64, 0xd5, 0x4b, 0xaa, 0x27, 0x9e, 0xbb, 0xeb, 0x91, 0x25, 0x71, 0x0b,
+  0x28, 0x14, 0xa1, 0x5c, 0x3e, 0xbe, 0xac, 0x21, 0xb0, 0x78, 0x73, 0xe6, 0xd8, 0xe9, 0x0c, 0x02,
+  0xe5, 0xb0, 0xc1, 0x64, 0x32, 0x50, 0x46, 0x7b, 0x81, 0x86, 0x30, 0x06, 0x13, 0xff, 0x79, 0x7c,
+  0xc3, 0xa3, 0x61, 0x6c, 0x90, 0x46, 0xeb, 0xc7, 0x4d, 0x25, 0x26, 0x7b, 0x8a, 0xf5, 0x9e, 0x91,
+  0xb6, 0x66, 0x5b, 0x49, 0x8b, 0x6b, 0xda, 0x1a, 0x41, 0x94, 0x09, 0x5e, 0x32, 0xc0, 0xe8, 0xe3,
+  0xf8, 0xb4, 0xbd, 0xd8, 0xba, 0xf3, 0x86, 0x2d, 0x1d, 0xc8, 0xb8, 0x24, 0x5c, 0x7e, 0x83, 0x58,
+  0xfe, 0x3a, 0xb9, 0xf4, 0x49, 0x6c, 0x6a, 0x22, 0xe1, 0x21, 0xbd, 0x7e, 0xc1, 0x1d, 0x62, 0xac,
+  0xfe, 0xd0, 0x4b, 0xbf, 0x71, 0x3f, 0xf9, 0x2c, 0x0d, 0x61, 0x3e, 0x8e, 0xe2, 0x29, 0xba, 0x94,
+  0x35, 0x32, 0x24, 0x15, 0xa0, 0x09, 0x91, 0xe7, 0x92, 0x77, 0x6f, 0x07, 0x96, 0xcb, 0xd8, 0x12,
+  0x05, 0x57, 0x80, 0xf1, 0xfa, 0x3c, 0xa8, 0x67, 0x56, 0xc2, 0xe4, 0x65, 0x8a, 0xb6, 0x85, 0x8a,
+  0xd9, 0x56, 0xd8, 0xdc, 0xac, 0xa8, 0x7f, 0x7e, 0xf0, 0xe3, 0x8f, 0xc4, 0x76, 0xcc, 0x52, 0x4e,
+  0x83, 0x20, 0x9c, 0xe0, 0x45, 0xa3, 0xd1, 0xe9, 0x99, 0xbd, 0xc1, 0x72, 0x4f, 0x53, 0x9d, 0xad,
+  0x39, 0xd5, 0x54, 0x5c, 0x6a, 0x31, 0x17, 0x9b, 0xac, 0x2a, 0xc4, 0xa0, 0x32, 0x20, 0x7a, 0xd0,
+  0xdd, 0xf6, 0x0f, 0xe1, 0x7e, 0xe1, 0x0b, 0x74, 0xd5, 0x41, 0x61, 0xa7, 0x56, 0x97, 0x21, 0x2d,
+  0x1d, 0x69, 0x5d, 0x5e, 0xee, 0x13, 0x59, 0x2e, 0xc3, 0x5a, 0x98, 0x66, 0x1f, 0x4e, 0x32, 0xbc,
+  0x1d, 0x71, 0x5b, 0x29, 0xa2, 0xd1, 0x6d, 0xa6, 0x69, 0x22, 0x40, 0xc8, 0x33, 0xf1, 0xea, 0x6d,
+  0x70, 0xfb, 0x6f, 0x90, 0x15, 0xef, 0xe2, 0xab, 0x7f, 0x81, 0xcf, 0xd9, 0x0b, 0x3f, 0x99, 0x06,
+  0x07, 0x74, 0xb0, 0xda, 0x92, 0x53, 0x42, 0x19, 0xcd, 0xac, 0x9c, 0x14, 0xda, 0xfa, 0x96, 0x67,
+  0xf3, 0x73, 0x06, 0x14, 0xe7, 0x7d, 0x49, 0x78, 0x30, 0x8d, 0x77, 0x06, 0x10, 0x9e, 0x4d, 0x7e,
+  0xf7, 0x95, 0xd0, 0x2b, 0xbb, 0x39, 0x67, 0x1a, 0xc9, 0x0b, 0xe6, 0x8c, 0x22, 0x2d, 0xa4, 0xf6,
+  0x1b, 0xfc, 0x4f, 0xc5, 0x6c, 0x6c, 0x8f, 0x9f, 0xbd, 0x2a, 0xae, 0x7d, 0x4d, 0xfc, 0xb2, 0x15,
+  0x8a, 0x05, 0xa3, 0xb4, 0x95, 0x4e, 0xd8, 0x41, 0x12, 0x78, 0x8d, 0xdd, 0x24, 0xd3, 0x94, 0xc5,
+  0x20, 0x73, 0x26, 0x5b, 0x9e, 0xbb, 0x22, 0xcb, 0x32, 0x82, 0x63, 0x98, 0xe5, 0x15, 0x8e, 0x15,
+  0x55, 0xae, 0x95, 0xa5, 0xae, 0xd9, 0x59, 0x56, 0x0f, 0x47, 0xa9, 0x20, 0xa4, 0x3f, 0x10, 0xf7,
+  0x3d, 0x5f, 0x12, 0x84, 0x96, 0x7a, 0xc4, 0x25, 0x91, 0x6b, 0xc7, 0x38, 0x1b, 0x73, 0xcd, 0x34,
+  0xac, 0x1a, 0x1a, 0x1b, 0x13, 0x33, 0x74, 0xc8, 0xe0, 0x98, 0x41, 0x3a, 0xad, 0x0e, 0xc7, 0x50,
+  0x82, 0xa0, 0x40, 0x9d, 0x2d, 0x08, 0x04, 0xa9, 0x35, 0x0a, 0xad, 0x2a, 0xd6, 0x90, 0x00, 0x19,
+  0xa0, 0x6c, 0x7d, 0xa8, 0xdd, 0xd0, 0xb8, 0x53, 0xdb, 0x51, 0xa4, 0xcb, 0xd1, 0x13, 0x10, 0xcf,
+  0x70, 0x90, 0x4a, 0x61, 0xc9, 0x2b, 0xe5, 0x1d, 0x1e, 0x52, 0x90, 0x83, 0x0f, 0x3d, 0x1b, 0x9c,
+  0xd6, 0xc6, 0xf2, 0x46, 0x4b, 0x6a, 0x1e, 0x2b, 0x4a, 0xb9, 0x8f, 0xad, 0x4b, 0xf9, 0xc5, 0x8b,
+  0xac, 0xe4, 0x11, 0x9c, 0x3e, 0x73, 0x4e, 0x19, 0xaa, 0x51, 0xba, 0xec, 0x56, 0x8c, 0xc1, 0x02,
+  0x88, 0xaf, 0x59, 0x35, 0xa6, 0x41, 0x5d, 0x9b, 0x0c, 0x25, 0x82, 0xd8, 0x45, 0x8d, 0xaa, 0x41,
+  0x90, 0x4b, 0x23, 0xa8, 0x8b, 0xc0, 0x11, 0x83, 0x01, 0xc1, 0x30, 0x95, 0x32, 0x21, 0x3e, 0x36,
+  0x7e, 0x70, 0xcc, 0x60, 0xa0, 0xcf, 0x90, 0x98, 0xa1, 0xb1, 0x43, 0x63, 0x60, 0x8d, 0x22, 0xc7,
+  0xca, 0xac, 0xc9, 0x71, 0x56, 0x3b, 0x85, 0xfe, 0x40, 0xdc, 0xc7, 0x7c, 0x81, 0x7e, 0x5a, 0x03,
+  0x1a, 0xb2, 0xd2, 0x0f, 0x8d, 0x75, 0x48, 0x0c, 0x12, 0x13, 0xaf, 0x1e, 0x5d, 0x3f, 0xb6, 0xa3,
+  0xe3, 0x81, 0xd5, 0xab, 0x57, 0xaf, 0xba, 0x7f, 0xd5, 0xb0, 0x61, 0xb9, 0x6a, 0x8d, 0x1a, 0x86,
+  0xc3, 0x13, 0x84, 0x05, 0x23, 0x8a, 0xeb, 0xeb, 0xeb, 0x73, 0xb2, 0xb2, 0xdd, 0x0e, 0x17, 0x68,
+  0xba, 0x3a, 0xd2, 0x90, 0x80, 0x6a, 0x50, 0x24, 0x7c, 0x57, 0x2d, 0x1c, 0x79, 0x20, 0x28, 0x18,
+  0xf2, 0x69, 0x54, 0x2a, 0xbd, 0x4e, 0x47, 0x60, 0xa8, 0x3a, 0x3e, 0x3e, 0x4e, 0xa5, 0x8a, 0x8d,
+  0x8d, 0x33, 0x68, 0xd4, 0x10, 0x0c, 0x27, 0xe8, 0x74, 0xb1, 0x83, 0xee, 0x1e, 0x1a, 0x33, 0x04,
+  0x86, 0x21, 0x92, 0x20, 0x18, 0x9a, 0x81, 0x20, 0xc3, 0xd0, 0xa1, 0x43, 0x63, 0x14, 0x31, 0x4a,
+  0x44, 0xa9, 0xc6, 0x35, 0x6a, 0x44, 0x43, 0x52, 0xa4, 0xc0, 0x09, 0x46, 0x41, 0xe4, 0x05, 0x81,
+  0x37, 0x99, 0x82, 0xa1, 0x10, 0x50, 0xaf, 0xb4, 0xb4, 0x74, 0xf9, 0x8a, 0xe5, 0x40, 0x13, 0xa0,
+  0xcf, 0x9a, 0xd5, 0xab, 0x3b, 0xd6, 0x76, 0xcc, 0x9e, 0x3b, 0x1f, 0x67, 0xf8, 0x04, 0xb5, 0x66,
+  0x61, 0xb2, 0x5c, 0x60, 0xe2, 0xd4, 0x70, 0x1f, 0x23, 0xee, 0x4b, 0xbe, 0xe1, 0x80, 0x17, 0x41,
+  0x59, 0x8a, 0xd8, 0xd0, 0xec, 0x16, 0x41, 0xd8, 0x43, 0x72, 0xbb, 0xde, 0x7a, 0xa3, 0xb7, 0xb7,
+  0xf7, 0xfb, 0x88, 0x80, 0xc4, 0xad, 0xdb, 0xb7, 0xb6, 0x6d, 0xdb, 0x66, 0x92, 0xa4, 0xbb, 0xef,
+  0xbe, 0x7b, 0xed, 0x9a, 0x35, 0x20, 0xe7, 0x9b, 0x6f, 0xbe, 0xbe, 0x74, 0xe9, 0xd2, 0x8d, 0x1b,
+  0x37, 0x96, 0xb6, 0xb7, 0xab, 0x14, 0x4a, 0x00, 0x05, 0x8c, 0x3c, 0x58, 0x86, 0x7d, 0x79, 0xfb,
+  0xcb, 0xbb, 0x77, 0xef, 0xda, 0xf6, 0xeb, 0x5f, 0xe7, 0xe5, 0xe5, 0xc5, 0xc7, 0xc7, 0x57, 0x54,
+  0x56, 0x3e, 0xd0, 0xb1, 0x76, 0xe9, 0xd2, 0xa5, 0x26, 0x93, 0x29, 0x10, 0x08, 0x2c, 0x5f, 0xba,
+  0x14, 0x60, 0x6a, 0x5f, 0xb2, 0x84, 0x17, 0x44, 0x30, 0xfa, 0xd2, 0x6a, 0xb5, 0xc3, 0xf2, 0xf2,
+  0x36, 0x6c, 0xd8, 0xb0, 0xe9, 0xd1, 0x4d, 0x1e, 0x97, 0x07, 0x85, 0xd1, 0xe7, 0x9e, 0x7d, 0xf6,
+  0x50, 0x67, 0x67, 0x77, 0x77, 0xf7, 0xa9, 0x53, 0xa7, 0xce, 0x9c, 0x3e, 0x7d, 0xe5, 0xab, 0xcb,
+  0xa7, 0x4f, 0x9f, 0x02, 0xe7, 0x7e, 0xbc, 0x67, 0x0f, 0xb8, 0xe8, 0xed, 0xdb, 0xb7, 0x7b, 0x23,
+  0x12, 0xd5, 0xea, 0xcc, 0xe9, 0x53, 0x05, 0x45, 0x85, 0x5a, 0x8d, 0xba, 0x1d, 0xc4, 0x71, 0x04,
+  0xd1, 0xb7, 0xd3, 0xee, 0x7d, 0xc9, 0x17, 0xfc, 0xf2, 0x4a, 0x2d, 0xdc, 0x5a, 0x62, 0x2d, 0x4e,
+  0xe2, 0x34, 0x10, 0xb1, 0xe7, 0xc3, 0x0f, 0xc2, 0x4c, 0x6f, 0xde, 0xea, 0xfd, 0x51, 0x6e, 0xdf,
+  0x0e, 0xa7, 0x3f, 0xfe, 0x78, 0x0f, 0x38, 0xd8, 0xef, 0xf3, 0x1d, 0x3e, 0xdc, 0x19, 0x3e, 0xe0,
+  0x56, 0x38, 0xf3, 0x60, 0x67, 0x27, 0x11, 0xbe, 0x33, 0x49, 0x24, 0x24, 0x24, 0x34, 0x34, 0x34,
+  0x80, 0x9c, 0x9b, 0x37, 0x6f, 0x82, 0xed, 0xe2, 0xc5, 0x8b, 0xef, 0xba, 0xeb, 0xae, 0xf5, 0xeb,
+  0xd7, 0x47, 0x8f, 0x4c, 0x49, 0x49, 0xa9, 0xad, 0xad, 0xfd, 0xdb, 0xde, 0x8e, 0x8e, 0xb5, 0x1a,
+  0x8d, 0x46, 0xa1, 0x50, 0x2c, 0x59, 0xd2, 0x0e, 0xbe, 0x7e, 0xf7, 0xdd, 0x77, 0x59, 0x59, 0x59,
+  0x80, 0x78, 0x57, 0x57, 0x57, 0x18, 0x5f, 0x84, 0x63, 0x14, 0xe2, 0xf9, 0xf3, 0xe7, 0x6d, 0x36,
+  0xdb, 0x91, 0x23, 0x87, 0x23, 0x87, 0x7d, 0x0b, 0xb2, 0xa3, 0x2a, 0x45, 0xcb, 0x39, 0xb0, 0x6f,
+  0x9f, 0x81, 0xa4, 0xca, 0xcc, 0x42, 0xb1, 0x49, 0x0c, 0x9b, 0x70, 0xdf, 0x31, 0xe9, 0x33, 0xbe,
+  0xc0, 0x78, 0x41, 0x48, 0x20, 0x1b, 0xa9, 0xa5, 0x75, 0xce, 0x98, 0xb8, 0x84, 0x47, 0x36, 0x3c,
+  0x1c, 0xd1, 0xfe, 0xd6, 0xa5, 0xcb, 0x97, 0x36, 0x6d, 0xda, 0xd4, 0xda, 0xda, 0xfa, 0xc2, 0x0b,
+  0x3f, 0x07, 0xf5, 0xff, 0xf6, 0x5b, 0x50, 0xb7, 0xde, 0x27, 0x9f, 0x7c, 0x62, 0xd0, 0xa0, 0x41,
+  0xc0, 0x12, 0xcf, 0x9e, 0x3d, 0x13, 0x05, 0x07, 0x28, 0x94, 0x94, 0xdc, 0x03, 0x2c, 0x51, 0xa7,
+  0xd3, 0xbd, 0xfc, 0xd2, 0x4b, 0x11, 0xd3, 0xbe, 0x06, 0xb6, 0xc0, 0x66, 0x01, 0xdf, 0xfb, 0xef,
+  0xbf, 0x1f, 0xa4, 0xc1, 0xb9, 0xf9, 0xf9, 0xc3, 0x53, 0x53, 0x52, 0x2e, 0x5d, 0xbc, 0x08, 0x4a,
+  0x06, 0x66, 0x78, 0xf1, 0xe2, 0x45, 0x9f, 0xcf, 0x07, 0x5a, 0xc3, 0xfc, 0x79, 0xf3, 0xc0, 0x01,
+  0x57, 0xae, 0x5c, 0x49, 0x49, 0x4e, 0x06, 0x7c, 0x0f, 0x1f, 0x3e, 0x1c, 0x29, 0xe1, 0x9b, 0xe3,
+  0xc7, 0x8f, 0xed, 0xfb, 0x1c, 0xc8, 0x5f, 0x5f, 0xdc, 0xb6, 0x8d, 0x20, 0xc8, 0x37, 0xde, 0x08,
+  0xb7, 0xa7, 0x9b, 0x37, 0xbe, 0xdb, 0xb8, 0x71, 0xe3, 0x94, 0xc9, 0x93, 0x97, 0x2f, 0x5f, 0x7e,
+  0xe6, 0xcc, 0x99, 0xef, 0x23, 0xac, 0xab, 0x6a, 0x6b, 0x25, 0xbd, 0x76, 0xb2, 0xdb, 0xaa, 0xea,
+  0x53, 0x17, 0xd1, 0x67, 0x7c, 0x23, 0xc6, 0x8b, 0x8c, 0xc9, 0x95, 0x46, 0x84, 0x68, 0xc1, 0x64,
+  0xbf, 0x78, 0xe1, 0x3c, 0x50, 0xfa, 0xfa, 0xf5, 0x6b, 0xe5, 0xe5, 0xe5, 0x43, 0x86, 0x0c, 0x01,
+  0x56, 0x09, 0xfc, 0xe3, 0xf4, 0xe9, 0xd3, 0xc2, 0xf6, 0x74, 0xfb, 0xf6, 0x95, 0x2b, 0x5f, 0xb9,
+  0x5d, 0x2e, 0x83, 0xc1, 0xb0, 0xf7, 0xb3, 0xbf, 0x44, 0xc1, 0x81, 0xed, 0xfa, 0x75, 0x0f, 0x01,
+  0x52, 0x5e, 0xaf, 0xf7, 0xe2, 0xc5, 0x0b, 0xe0, 0x2b, 0x70, 0x1a, 0x60, 0x7b, 0xdf, 0xca, 0xfb,
+  0x00, 0x5f, 0xe0, 0xbd, 0xa3, 0x96, 0x58, 0x37, 0x6a, 0x54, 0xcc, 0x90, 0x21, 0x3b, 0xb6, 0x6f,
+  0x8f, 0x14, 0x7e, 0x1d, 0x6c, 0x37, 0x6d, 0xda, 0x08, 0x0e, 0x98, 0x3f, 0x7f, 0x7e, 0x14, 0x68,
+  0x28, 0x18, 0xc4, 0x71, 0x1c, 0x60, 0x05, 0x5f, 0xdf, 0x7e, 0xfb, 0x6d, 0x8a, 0xa2, 0x58, 0x96,
+  0xa5, 0x69, 0x1a, 0x24, 0x80, 0x02, 0x6d, 0x6d, 0xe1, 0xc3, 0xae, 0x5d, 0xbb, 0x16, 0x0c, 0x04,
+  0x81, 0x56, 0xe0, 0xc4, 0x15, 0x2b, 0x56, 0x44, 0x0d, 0x79, 0xe5, 0xea, 0xd5, 0x58, 0x82, 0xa2,
+  0xd5, 0x2b, 0x43, 0x48, 0x5f, 0x8e, 0x98, 0xfb, 0x92, 0x2f, 0x08, 0x1b, 0xe6, 0x57, 0xd8, 0x78,
+  0x4c, 0x35, 0x61, 0xd2, 0x94, 0xa8, 0xd2, 0x4f, 0x3f, 0xfd, 0x34, 0xa8, 0x06, 0xc3, 0x30, 0xa0,
+  0x7a, 0x24, 0x49, 0x02, 0xca, 0xaf, 0xbd, 0xf6, 0x5a, 0x74, 0xd7, 0xac, 0x59, 0x33, 0x55, 0x2a,
+  0xd5, 0xfe, 0xfd, 0x9f, 0xff, 0xad, 0x91, 0x1e, 0x3a, 0xd4, 0x99, 0x00, 0x6a, 0xd8, 0xda, 0x1a,
+  0xf5, 0x2a, 0xd1, 0xcc, 0x55, 0xab, 0x57, 0xfd, 0xcd, 0x7e, 0x81, 0x00, 0xd7, 0x01, 0x7e, 0x83,
+  0x97, 0x22, 0x06, 0x1e, 0xfd, 0x01, 0x2e, 0x5f, 0xbe, 0x04, 0x08, 0xb6, 0x4e, 0x0f, 0x9f, 0xf5,
+  0xf5, 0xd7, 0x5f, 0x83, 0x9f, 0x87, 0x20, 0x09, 0xe0, 0x79, 0xc1, 0xd7, 0x1d, 0x3b, 0x76, 0x28,
+  0x14, 0xf1, 0xa0, 0x41, 0x80, 0x66, 0x01, 0x34, 0x8c, 0x8b, 0x8b, 0x6b, 0x6f, 0x0f, 0xbb, 0x91,
+  0xeb, 0xd7, 0xae, 0xe7, 0xe7, 0xe7, 0x03, 0x7d, 0xd4, 0x6a, 0x75, 0x73, 0x73, 0x73, 0xb4, 0xe4,
+  0xb5, 0x0f, 0x3e, 0x08, 0xf8, 0xce, 0xf0, 0x3a, 0xee, 0x50, 0xbe, 0x30, 0x82, 0x09, 0x0c, 0xde,
+  0x5e, 0x23, 0x6b, 0x54, 0x09, 0x9b, 0x37, 0x6f, 0x8e, 0xf6, 0x1f, 0x8d, 0x8d, 0x63, 0x95, 0x4a,
+  0x25, 0x15, 0x11, 0x60, 0x44, 0xa0, 0x86, 0x6d, 0x6d, 0x6d, 0xd1, 0xfa, 0x3c, 0xfc, 0xf0, 0xc3,
+  0x00, 0x77, 0x94, 0xef, 0xb1, 0x63, 0xc7, 0x81, 0x4d, 0x01, 0xf3, 0xcc, 0xca, 0xcc, 0x7a, 0xf5,
+  0xd5, 0x57, 0x41, 0x4e, 0xd7, 0xf1, 0xe3, 0x57, 0xbe, 0xba, 0x12, 0xae, 0x76, 0xc7, 0x9a, 0x30,
+  0xdf, 0x55, 0x3f, 0xf0, 0x6d, 0x6a, 0x6a, 0x1a, 0x3c, 0x78, 0xf0, 0x8b, 0xdb, 0x5e, 0x8c, 0xd2,
+  0xfc, 0x2e, 0x62, 0xf8, 0x8b, 0xdb, 0x17, 0x8d, 0x6f, 0x69, 0xf9, 0x81, 0xaf, 0xc7, 0x03, 0xc0,
+  0xf5, 0xf4, 0xf4, 0x80, 0xaf, 0x3d, 0x27, 0x4f, 0xee, 0xdc, 0xb1, 0x73, 0xfb, 0xf6, 0xed, 0x6f,
+  0xef, 0xda, 0xd5, 0xd2, 0xd2, 0x02, 0xca, 0x59, 0xb6, 0x6c, 0x59, 0xd4, 0xcc, 0x81, 0x6b, 0x1a,
+  0x74, 0xd7, 0x20, 0xa0, 0xc0, 0x96, 0x2d, 0x3f, 0x8f, 0x96, 0xdc, 0x32, 0x69, 0x92, 0xa8, 0xd3,
+  0x4c, 0xf7, 0xca, 0x77, 0xa2, 0x7f, 0xf8, 0xd1, 0xf9, 0x92, 0x2b, 0x46, 0xcb, 0x2a, 0x8d, 0xf6,
+  0xc5, 0x97, 0xb6, 0x85, 0x6b, 0xfb, 0xcd, 0xd5, 0xac, 0xcc, 0x0c, 0xbd, 0x5e, 0x0f, 0x02, 0xb2,
+  0xd8, 0xd8, 0xa1, 0x20, 0xe8, 0x02, 0xf6, 0x32, 0x36, 0xdc, 0x77, 0x85, 0xfd, 0xdd, 0xa6, 0x8d,
+  0x1b, 0x55, 0x6a, 0xf5, 0xc1, 0x83, 0x07, 0x40, 0xfa, 0x95, 0x57, 0x76, 0xee, 0xf9, 0xe8, 0x23,
+  0x90, 0xf8, 0xcd, 0xab, 0xaf, 0xf6, 0xf4, 0x9c, 0x04, 0x89, 0x07, 0x3a, 0x3a, 0x7a, 0x4e, 0xf5,
+  0x44, 0x7b, 0x30, 0xc0, 0x65, 0xe5, 0xca, 0xfb, 0xa3, 0xfd, 0x7e, 0x63, 0x63, 0x23, 0xb0, 0xdf,
+  0x5f, 0x6f, 0xdd, 0x1a, 0xee, 0x27, 0xf7, 0x7c, 0xbc, 0xeb, 0xed, 0xb7, 0x41, 0xa2, 0xb3, 0xb3,
+  0x73, 0xed, 0x9a, 0xd5, 0xe1, 0x2b, 0x5e, 0xbd, 0xea, 0x71, 0xbb, 0xff, 0xc6, 0x37, 0xda, 0x9d,
+  0x46, 0xdb, 0xc1, 0xba, 0x75, 0xeb, 0x22, 0xed, 0x60, 0x65, 0xc4, 0xf0, 0xbf, 0xdb, 0xba, 0xf5,
+  0xbf, 0x1e, 0x7a, 0xe8, 0xa1, 0x77, 0x76, 0xef, 0x8e, 0x2a, 0x73, 0xf4, 0xc8, 0x11, 0x9c, 0x17,
+  0x8a, 0x25, 0xa1, 0xc2, 0x2a, 0xdd, 0x89, 0xfd, 0x5b, 0x94, 0xaf, 0x43, 0xa2, 0x96, 0xd7, 0x39,
+  0x54, 0x1a, 0xdd, 0x6f, 0x5e, 0xdd, 0x19, 0xf5, 0x8f, 0xa0, 0x3b, 0x02, 0xf6, 0xeb, 0xf1, 0x78,
+  0x97, 0x2d, 0x5b, 0xe1, 0x72, 0xb9, 0xee, 0x1e, 0x72, 0xf7, 0xd4, 0xa9, 0x53, 0xaf, 0x5f, 0xbf,
+  0xf1, 0x7d, 0x98, 0xe0, 0x83, 0xc0, 0x3f, 0xec, 0xf9, 0xf8, 0xcf, 0x61, 0x5b, 0x5e, 0xff, 0xc8,
+  0xe2, 0x45, 0x4b, 0xae, 0x7d, 0xdb, 0xdb, 0xd5, 0x7d, 0xf6, 0xd4, 0xf9, 0xaf, 0x76, 0xef, 0x7e,
+  0x7f, 0x58, 0x6e, 0xde, 0x67, 0x07, 0x8f, 0x9e, 0xbf, 0x7c, 0xa3, 0xbd, 0x3d, 0xec, 0x7f, 0xe7,
+  0xce, 0x5f, 0xd4, 0x73, 0xee, 0xea, 0xe1, 0x2f, 0x7a, 0xca, 0xcb, 0x2b, 0xe3, 0x62, 0x63, 0x1f,
+  0x7b, 0xe2, 0x99, 0xf3, 0x5f, 0xdd, 0xf8, 0xd5, 0xd6, 0x1d, 0xb9, 0x39, 0xb9, 0x9d, 0x47, 0x4f,
+  0x76, 0x7e, 0xd1, 0xf3, 0xc1, 0xc7, 0x7b, 0x3b, 0x8f, 0xf6, 0x1c, 0x38, 0xd8, 0xe5, 0x70, 0x38,
+  0x48, 0x92, 0xfa, 0xe4, 0x93, 0x7d, 0x27, 0x4f, 0x5f, 0xee, 0x3c, 0x74, 0xfc, 0xf7, 0xef, 0xef,
+  0xf9, 0xe0, 0x83, 0x3f, 0x1e, 0xfd, 0xa2, 0xbb, 0xad, 0x6d, 0x21, 0x28, 0x07, 0x5c, 0xe5, 0xbb,
+  0x9b, 0xbd, 0x67, 0xce, 0x5d, 0xba, 0x71, 0xeb, 0x76, 0xa4, 0x5f, 0xbd, 0x7d, 0xe3, 0xe6, 0xad,
+  0x13, 0x27, 0x4e, 0x14, 0x8d, 0x18, 0xa1, 0x55, 0xab, 0xdb, 0x83, 0x6e, 0x91, 0x0c, 0x2f, 0x1e,
+  0xec, 0x13, 0x26, 0x51, 0xe9, 0x5b, 0xfb, 0xa5, 0x56, 0x8e, 0x91, 0x95, 0x2a, 0xf5, 0x53, 0x4f,
+  0x3d, 0x73, 0xed, 0xfa, 0xad, 0x8b, 0x17, 0xaf, 0x4d, 0x9c, 0x30, 0x39, 0x5c, 0xab, 0xc5, 0x2b,
+  0x40, 0x6d, 0xb6, 0xef, 0x78, 0x53, 0xa7, 0xd1, 0x2c, 0x5d, 0xbe, 0xfa, 0xc4, 0xe9, 0xab, 0x47,
+  0xbb, 0xce, 0x35, 0x35, 0x4d, 0x04, 0x9e, 0xf1, 0x9d, 0xdf, 0xee, 0x39, 0x7d, 0xe1, 0xdb, 0xf6,
+  0x25, 0x2b, 0x7d, 0x3e, 0xff, 0xc1, 0x23, 0x27, 0xf7, 0x75, 0x76, 0x9f, 0x38, 0x73, 0x65, 0x7e,
+  0xdb, 0x62, 0x97, 0xd3, 0xfd, 0xd9, 0x81, 0xae, 0x53, 0xe7, 0xaf, 0x2f, 0x5d, 0x1e, 0xf6, 0xbf,
+  0x73, 0xdb, 0x16, 0x9d, 0x38, 0x7b, 0xf5, 0xc0, 0x91, 0x93, 0xa5, 0xa5, 0x15, 0x8a, 0xf8, 0xb8,
+  0xa7, 0x7e, 0xf6, 0xc2, 0xe9, 0x8b, 0xdf, 0x6e, 0xdf, 0xf9, 0x16, 0x70, 0xac, 0x1b, 0x37, 0x3d,
+  0xdd, 0xdd, 0x73, 0x19, 0xec, 0xea, 0xfc, 0xe2, 0xf4, 0xde, 0x7d, 0xc7, 0x65, 0xd9, 0x41, 0x52,
+  0xd4, 0xef, 0x3f, 0xda, 0x7b, 0xe2, 0xcc, 0xd5, 0x9f, 0x3d, 0xf3, 0x4b, 0x92, 0xa0, 0x38, 0x20,
+  0xbc, 0xc0, 0xf3, 0x02, 0x18, 0xa3, 0xb4, 0xce, 0x9c, 0xdb, 0x7d, 0xea, 0xab, 0xbf, 0x1e, 0x38,
+  0xbe, 0xef, 0x60, 0xf7, 0xc1, 0xc3, 0x3d, 0xfb, 0x0f, 0x9d, 0x3c, 0x79, 0xe6, 0xeb, 0x45, 0x0b,
+  0xc3, 0x21, 0x4a, 0x93, 0xcb, 0x5e, 0x63, 0x95, 0x54, 0x30, 0x7c, 0x87, 0x8e, 0x2f, 0x80, 0xff,
+  0x15, 0x59, 0xe2, 0xbe, 0x51, 0x2e, 0xad, 0x3a, 0xa1, 0xed, 0xde, 0x65, 0xc7, 0x4e, 0x5c, 0x3c,
+  0xf6, 0xe5, 0x85, 0x27, 0x9e, 0xda, 0x12, 0x13, 0x33, 0xc4, 0xe3, 0xf6, 0x7e, 0xf0, 0xd1, 0x67,
+  0x27, 0xcf, 0x5c, 0xdd, 0xf2, 0xf3, 0x17, 0xdf, 0x7d, 0xef, 0x8f, 0x5f, 0x9c, 0xb8, 0xf8, 0xe9,
+  0x67, 0x87, 0x4d, 0x26, 0x33, 0xa8, 0xf7, 0x9e, 0x3f, 0xed, 0x3f, 0x7b, 0xf1, 0xbb, 0xb6, 0x05,
+  0x8b, 0x95, 0xa0, 0xeb, 0x7b, 0xeb, 0x3d, 0x70, 0x56, 0xe7, 0x91, 0x13, 0x89, 0xa1, 0x24, 0xbf,
+  0xcf, 0xff, 0x39, 0xe0, 0x7b, 0xee, 0xfa, 0xf2, 0xfb, 0xc2, 0xfe, 0x77, 0xfe, 0x82, 0xc5, 0xa7,
+  0xce, 0x7d, 0x7d, 0xe0, 0xd0, 0xc9, 0xa2, 0xa2, 0x62, 0xa5, 0x32, 0xe1, 0xb9, 0x2d, 0x5b, 0xcf,
+  0x5c, 0xf8, 0x6e, 0xfb, 0xce, 0x37, 0xf5, 0x3a, 0x6d, 0x66, 0x66, 0xf6, 0xc1, 0xa3, 0x27, 0x0f,
+  0x1c, 0x3e, 0x71, 0xf8, 0xd8, 0xe9, 0xcf, 0xf6, 0xff, 0xc0, 0xf7, 0x0f, 0x7b, 0xf6, 0xf6, 0x9c,
+  0xfb, 0x66, 0xf3, 0xe3, 0x3f, 0x1b, 0x72, 0xf7, 0x60, 0x80, 0x15, 0x7c, 0xc0, 0xb8, 0x11, 0x6c,
+  0x67, 0xce, 0x9a, 0x7f, 0xea, 0xfc, 0x37, 0x7f, 0x3d, 0xd0, 0x35, 0x65, 0x4a, 0x6b, 0x51, 0xe1,
+  0x88, 0x1d, 0xaf, 0xec, 0xfa, 0xf2, 0xf4, 0x95, 0xf7, 0x7e, 0xff, 0x09, 0x25, 0x88, 0x79, 0x22,
+  0x5b, 0x6d, 0x31, 0xdd, 0xb9, 0xe3, 0xb7, 0xf0, 0x52, 0x12, 0x08, 0x59, 0x54, 0xe9, 0x30, 0x92,
+  0xfa, 0xe1, 0x05, 0xf7, 0x1c, 0xe9, 0x3a, 0x7b, 0xe0, 0x50, 0xf7, 0x91, 0xe3, 0xa7, 0xe7, 0xcc,
+  0x6e, 0xd3, 0x68, 0xd4, 0xb3, 0x67, 0x2f, 0xf8, 0xa2, 0xfb, 0xc2, 0x17, 0xdd, 0xe7, 0x00, 0x8b,
+  0xd3, 0xe7, 0xae, 0xaf, 0x58, 0xb1, 0x26, 0x2e, 0x2e, 0x36, 0x29, 0x31, 0x79, 0xef, 0xbe, 0xa3,
+  0x3d, 0x67, 0xbe, 0x69, 0x9d, 0x31, 0x17, 0x40, 0x6c, 0x6f, 0x5f, 0x79, 0xe1, 0xca, 0xf7, 0x5b,
+  0xb7, 0xbd, 0xa2, 0xd5, 0x68, 0x52, 0x53, 0xd2, 0xf6, 0xee, 0x3b, 0x76, 0xf2, 0xdc, 0xb5, 0x65,
+  0x2b, 0x56, 0x83, 0x5d, 0xf3, 0xc2, 0x7c, 0xbf, 0xf9, 0xfc, 0x40, 0x77, 0x76, 0x76, 0xae, 0x56,
+  0xab, 0x01, 0x9e, 0x01, 0xe0, 0x7b, 0x79, 0xc7, 0x1b, 0xa0, 0xdb, 0x04, 0xe3, 0x8b, 0xa7, 0x9e,
+  0xda, 0xd2, 0x75, 0xf2, 0x22, 0x40, 0xbc, 0xf7, 0xf3, 0x63, 0xb2, 0x5d, 0x06, 0x99, 0x1f, 0xfe,
+  0xf1, 0xf3, 0xe3, 0x27, 0x2f, 0xef, 0x7a, 0xf7, 0xc3, 0xd9, 0x73, 0xda, 0xa6, 0xb7, 0xce, 0x99,
+  0x3c, 0x65, 0x46, 0x53, 0xd3, 0x04, 0xb5, 0x5a, 0x05, 0xec, 0xb7, 0xe7, 0xdc, 0xf5, 0xcf, 0xf6,
+  0x1f, 0x0b, 0x06, 0x43, 0xa0, 0xd8, 0xc6, 0xc6, 0x96, 0x2f, 0xbe, 0xbc, 0xd8, 0xd5, 0x73, 0xa9,
+  0x65, 0xc2, 0x14, 0x9d, 0x4a, 0x39, 0xc7, 0xeb, 0x24, 0x30, 0xbc, 0x6f, 0x27, 0xdb, 0xfb, 0x8c,
+  0x2f, 0x49, 0x60, 0x0a, 0x2d, 0x32, 0x61, 0x98, 0xb9, 0x3c, 0x59, 0x54, 0xea, 0x90, 0x57, 0x5e,
+  0x7d, 0xbb, 0xbb, 0xe7, 0xd2, 0xbe, 0x83, 0x5d, 0x5f, 0x1c, 0x3f, 0xf7, 0xde, 0x07, 0x7f, 0x7e,
+  0xe7, 0xb7, 0x1f, 0x1d, 0x38, 0x74, 0xe2, 0xb3, 0xfd, 0x5d, 0xc0, 0x42, 0x9f, 0xdf, 0xb2, 0x35,
+  0x21, 0x3e, 0x1e, 0x34, 0xf3, 0xc2, 0x82, 0x11, 0xe0, 0x80, 0xe3, 0x27, 0x2e, 0x8f, 0x1f, 0x3f,
+  0xf5, 0xee, 0xbb, 0x07, 0x0d, 0xcb, 0x1d, 0x7e, 0xee, 0xe2, 0xcd, 0xd6, 0xd6, 0xb9, 0xc0, 0xe8,
+  0xb2, 0xb2, 0x72, 0xf6, 0x75, 0x7e, 0x79, 0xee, 0xd2, 0xcd, 0xe5, 0x2b, 0xc3, 0xfd, 0xdb, 0xa2,
+  0xf6, 0x15, 0xe7, 0x2f, 0xdf, 0x04, 0xcd, 0x39, 0x23, 0x23, 0xcb, 0xa0, 0xd7, 0xbf, 0xf2, 0xda,
+  0x3b, 0x67, 0x2f, 0xdd, 0x78, 0x79, 0xc7, 0x9b, 0xa0, 0x2b, 0x03, 0x7c, 0x73, 0x72, 0x86, 0x1d,
+  0x3a, 0xda, 0x73, 0xb4, 0xfb, 0x1c, 0xb0, 0x5f, 0x30, 0x48, 0x03, 0xa1, 0xca, 0x47, 0x7f, 0xda,
+  0x7f, 0xe4, 0xf8, 0xb9, 0x43, 0xc7, 0xce, 0x9e, 0x38, 0x7d, 0xa5, 0xfb, 0xe4, 0xa5, 0x2f, 0x7b,
+  0x2e, 0x1f, 0x3c, 0x7c, 0x12, 0xf8, 0xd5, 0xa9, 0xd3, 0x67, 0x7e, 0x79, 0xfa, 0xea, 0xa7, 0x7f,
+  0x3d, 0x92, 0x9e, 0x9e, 0x01, 0xc2, 0x36, 0xd0, 0x86, 0xfe, 0xf0, 0xe1, 0x5e, 0xe0, 0x5e, 0x76,
+  0xbe, 0xf2, 0xb6, 0x12, 0x82, 0xeb, 0x2c, 0xa6, 0x5c, 0x51, 0xd0, 0x20, 0x77, 0x5e, 0xff, 0x86,
+  0xfd, 0xe8, 0x82, 0x9d, 0x12, 0xdd, 0x31, 0xda, 0xa3, 0x50, 0x69, 0xd2, 0x52, 0xd3, 0x3e, 0xfd,
+  0xac, 0x13, 0xb4, 0x3e, 0x50, 0xf3, 0x63, 0x27, 0x2e, 0x74, 0x81, 0x4f, 0xcf, 0xe5, 0x63, 0x27,
+  0x2e, 0x1d, 0xe9, 0x3a, 0xf7, 0xcb, 0xff, 0x7a, 0x79, 0x71, 0xfb, 0x7d, 0x95, 0x55, 0x35, 0x95,
+  0x15, 0xd5, 0x27, 0xcf, 0x7c, 0x03, 0x3c, 0xe0, 0xd8, 0xb1, 0x2d, 0x20, 0xf2, 0x05, 0x61, 0x72,
+  0xc7, 0x9a, 0x87, 0x9d, 0x0e, 0x17, 0xe8, 0xf7, 0xd2, 0xd3, 0x32, 0xde, 0xff, 0xc3, 0x5f, 0xf6,
+  0x1d, 0x3c, 0x31, 0x6f, 0xfe, 0x22, 0xc0, 0x77, 0xc1, 0xbd, 0x4b, 0x00, 0xee, 0xdf, 0xbd, 0xff,
+  0x49, 0x30, 0x10, 0x42, 0x10, 0x64, 0xeb, 0xaf, 0x5f, 0xfd, 0x6c, 0x5f, 0xd7, 0x33, 0xcf, 0xfe,
+  0x0a, 0x8f, 0x08, 0x08, 0x51, 0x36, 0x3c, 0xf2, 0xc4, 0x91, 0x63, 0x67, 0x3e, 0xfc, 0xf8, 0x73,
+  0xb3, 0xc9, 0x4c, 0xd3, 0xcc, 0x1f, 0xff, 0xdc, 0x79, 0xac, 0xfb, 0xc2, 0xe1, 0xe3, 0xe7, 0x8e,
+  0x76, 0x5f, 0x00, 0x6e, 0x2a, 0xec, 0xf1, 0x8f, 0x9f, 0x03, 0x27, 0xce, 0x99, 0xb7, 0xf0, 0xda,
+  0xcd, 0x5e, 0x80, 0x3e, 0x3d, 0x3d, 0x13, 0x32, 0x18, 0x80, 0x45, 0x77, 0x74, 0x6c, 0x38, 0x73,
+  0xfe, 0xfa, 0xb1, 0xee, 0x73, 0xc5, 0x65, 0x55, 0x46, 0x83, 0x6e, 0xba, 0x5b, 0xd6, 0x21, 0x7d,
+  0xb9, 0xde, 0xb2, 0x6f, 0xe7, 0x1f, 0xf0, 0x04, 0x2d, 0x3c, 0xad, 0xc8, 0x36, 0xb5, 0xc8, 0x7e,
+  0xd7, 0xe0, 0x84, 0x60, 0x28, 0xe9, 0xf9, 0x2d, 0xbf, 0xfc, 0xe4, 0xd3, 0x03, 0x7f, 0xfa, 0xf4,
+  0xe0, 0x27, 0x9f, 0xec, 0xff, 0xd9, 0x33, 0x2f, 0x80, 0x0e, 0x07, 0xd0, 0xec, 0xea, 0xf9, 0xea,
+  0xea, 0xf5, 0x5e, 0xd0, 0x36, 0x25, 0xa3, 0x34, 0xbe, 0x65, 0xea, 0xe8, 0x51, 0x8d, 0xb2, 0x4d,
+  0x06, 0x31, 0x1c, 0x20, 0x05, 0x6c, 0xf3, 0x87, 0x45, 0xe7, 0x38, 0x1e, 0xee, 0x96, 0x78, 0x9e,
+  0xa4, 0x48, 0x04, 0x81, 0x29, 0x9a, 0xe2, 0x78, 0x8e, 0xe5, 0xd8, 0xc8, 0xcc, 0x1a, 0x42, 0x33,
+  0x34, 0xcb, 0x71, 0x60, 0x0b, 0xd2, 0xe0, 0x03, 0x23, 0x30, 0x30, 0x64, 0xbb, 0x5d, 0x76, 0x38,
+  0x9c, 0x78, 0x64, 0x12, 0xa3, 0x20, 0xbf, 0xa8, 0xac, 0xac, 0xaa, 0xa6, 0x76, 0xcc, 0xb8, 0xa6,
+  0x89, 0x13, 0x27, 0x81, 0xc1, 0xc7, 0x5c, 0xe0, 0x25, 0x40, 0xb1, 0xd9, 0xd9, 0xc3, 0xd6, 0xac,
+  0x5d, 0xb7, 0xe1, 0x91, 0xc7, 0x3d, 0x6e, 0x8f, 0x1e, 0x41, 0x34, 0x3a, 0x6d, 0x4e, 0x56, 0xce,
+  0x1f, 0xfe, 0xf0, 0xe7, 0xfd, 0xfb, 0x8f, 0x6f, 0x7a, 0xf4, 0x09, 0x95, 0x4e, 0x37, 0xcd, 0x2d,
+  0x3b, 0x19, 0xda, 0xd0, 0x77, 0x43, 0x8c, 0xbe, 0x9f, 0xff, 0x05, 0x56, 0x7c, 0x7f, 0xad, 0x7d,
+  0x6e, 0xa9, 0xd5, 0xa0, 0xd7, 0x0d, 0x89, 0xd7, 0x20, 0x24, 0x8f, 0x51, 0x02, 0x84, 0x73, 0x3a,
+  0xbd, 0x01, 0x86, 0x0c, 0xf3, 0xe6, 0x2c, 0xfc, 0xe3, 0x27, 0x07, 0xdf, 0x78, 0xeb, 0x3d, 0x8e,
+  0x65, 0x81, 0xdd, 0xc5, 0x2a, 0x86, 0xc4, 0xc4, 0x0f, 0xd2, 0x18, 0x54, 0x68, 0x78, 0xbd, 0x35,
+  0x1c, 0x5e, 0x01, 0x18, 0x06, 0x44, 0x82, 0x0d, 0x86, 0x82, 0x7f, 0x9c, 0xc6, 0x29, 0x9a, 0x60,
+  0x48, 0x9c, 0x22, 0x50, 0x92, 0xc4, 0x28, 0x8e, 0xe0, 0x59, 0x82, 0xa3, 0x31, 0x06, 0xa4, 0x29,
+  0x9c, 0xe6, 0x40, 0x74, 0x40, 0xb2, 0x1c, 0xc5, 0xd2, 0x04, 0x4d, 0xa0, 0x38, 0x40, 0x1d, 0xe6,
+  0x8f, 0xa1, 0x1a, 0x2d, 0x68, 0x03, 0xf1, 0x4a, 0x65, 0xbc, 0x42, 0x11, 0x13, 0x1b, 0x3f, 0x38,
+  0x36, 0x6e, 0x10, 0x70, 0x47, 0xa0, 0x4c, 0xbd, 0x4e, 0x9f, 0xa0, 0x50, 0xa8, 0xb4, 0xda, 0x38,
+  0x83, 0x61, 0xa6, 0x47, 0x4e, 0xe1, 0xb9, 0xbb, 0xd4, 0x1a, 0x3d, 0x49, 0x43, 0x0c, 0x47, 0xf2,
+  0x42, 0x8c, 0x01, 0x1e, 0x66, 0xe4, 0xaa, 0x2c, 0x52, 0x1f, 0xf6, 0x72, 0x7d, 0xcc, 0x37, 0xf2,
+  0x48, 0x45, 0xf8, 0xe6, 0xc5, 0xa4, 0x7c, 0xe9, 0xa1, 0x06, 0xd7, 0xfc, 0x12, 0x53, 0x63, 0x8e,
+  0x50, 0x9f, 0x25, 0xce, 0x18, 0x21, 0xda, 0x4d, 0x0c, 0xf0, 0x6c, 0x8a, 0x84, 0x18, 0x8a, 0xc1,
+  0x29, 0x96, 0x31, 0xa0, 0x10, 0x84, 0x41, 0x39, 0xb6, 0xd2, 0x71, 0x81, 0x85, 0x25, 0x8e, 0xb1,
+  0x59, 0xd6, 0x8a, 0xfa, 0xc0, 0xbd, 0x13, 0x52, 0x96, 0xe7, 0xca, 0x95, 0x4d, 0xa1, 0xf6, 0xd6,
+  0x94, 0x07, 0xa6, 0xa7, 0xac, 0x9d, 0x9c, 0xfc, 0xe0, 0xa4, 0x94, 0x07, 0x5b, 0xd3, 0x1e, 0x02,
+  0x9f, 0x19, 0xa9, 0x0f, 0xcc, 0x48, 0xed, 0x98, 0x92, 0xba, 0x76, 0x56, 0xea, 0xba, 0x99, 0xa9,
+  0x0f, 0xcd, 0x48, 0x5b, 0x37, 0x35, 0xe5, 0x81, 0xb1, 0xfe, 0x35, 0x75, 0xde, 0xe5, 0xb5, 0x9e,
+  0xc5, 0x65, 0xae, 0x79, 0x15, 0x9e, 0x7b, 0xfd, 0x42, 0xa9, 0x4f, 0x1a, 0xed, 0x31, 0x8e, 0x12,
+  0xe9, 0xac, 0x90, 0x65, 0x82, 0x85, 0xcb, 0xf6, 0x1a, 0x2b, 0xfd, 0xe6, 0x3a, 0x97, 0x54, 0x41,
+  0x50, 0xac, 0x21, 0xbc, 0xcc, 0x05, 0x02, 0x3f, 0x53, 0xb3, 0xd3, 0xba, 0xc8, 0xe7, 0x9c, 0xe3,
+  0xb1, 0xdd, 0xeb, 0x95, 0xa7, 0x39, 0xad, 0x53, 0xed, 0x52, 0x93, 0xc5, 0x58, 0x69, 0xe2, 0x4b,
+  0xcd, 0xe2, 0x52, 0xbf, 0x3d, 0x91, 0x67, 0xf5, 0x77, 0xb2, 0xfd, 0xe2, 0x11, 0xca, 0xf1, 0x5a,
+  0x44, 0xa0, 0xf1, 0x2c, 0x37, 0x5b, 0x9e, 0x22, 0xd4, 0x64, 0x18, 0x87, 0x07, 0x04, 0xd0, 0x9a,
+  0x43, 0x96, 0xaa, 0x5c, 0xc7, 0x78, 0xbf, 0x90, 0x61, 0xc5, 0x05, 0x3b, 0x21, 0x31, 0x18, 0xe9,
+  0x14, 0x82, 0x41, 0x4b, 0x1e, 0x2f, 0xb8, 0x02, 0x6c, 0x30, 0x5d, 0xcc, 0xa4, 0x0c, 0x56, 0x86,
+  0x90, 0x24, 0xda, 0x62, 0x66, 0x64, 0x9e, 0xb4, 0x26, 0x9b, 0x9d, 0x05, 0x16, 0xaf, 0x91, 0x32,
+  0x5b, 0x18, 0xab, 0x85, 0xb5, 0x70, 0xa4, 0x31, 0x8b, 0x4e, 0x63, 0x49, 0xd1, 0x48, 0x49, 0x66,
+  0xda, 0xc4, 0x51, 0x52, 0x96, 0xd9, 0xee, 0xa3, 0xcc, 0x24, 0x2e, 0x92, 0x98, 0x91, 0xc6, 0x8d,
+  0x08, 0xcc, 0xeb, 0x34, 0x9c, 0x40, 0xc9, 0x34, 0x6a, 0x42, 0x69, 0x33, 0x42, 0x02, 0x27, 0xe2,
+  0xb2, 0xb2, 0x19, 0x1e, 0x36, 0xcf, 0x84, 0x19, 0xdd, 0x42, 0x28, 0xdd, 0xd6, 0x22, 0x71, 0x59,
+  0x19, 0x46, 0x2a, 0xc4, 0x73, 0x4a, 0x04, 0xe1, 0x09, 0x22, 0x85, 0x67, 0x52, 0x79, 0x36, 0x95,
+  0xe7, 0x32, 0x45, 0xbe, 0x40, 0x12, 0xbc, 0x2c, 0x6d, 0x40, 0xef, 0xc8, 0xf9, 0x87, 0xff, 0x26,
+  0x20, 0x9c, 0x80, 0x11, 0x54, 0xad, 0x47, 0x95, 0x5a, 0x38, 0x46, 0x61, 0x18, 0x12, 0x67, 0x50,
+  0xa9, 0x21, 0x83, 0x8e, 0x32, 0x13, 0x69, 0xd9, 0x52, 0x4d, 0x35, 0x95, 0x3f, 0x8d, 0x2a, 0x5f,
+  0xcb, 0x4f, 0xd8, 0xc8, 0x4e, 0x5b, 0x49, 0xd6, 0x2f, 0x23, 0x47, 0x3d, 0xc8, 0x8e, 0xe7, 0xd5,
+  0x74, 0x79, 0x6d, 0xa0, 0x6e, 0xe1, 0x54, 0xda, 0x62, 0x0b, 0xaf, 0x4e, 0x73, 0x50, 0x67, 0x96,
+  0xb8, 0x2f, 0x54, 0xb8, 0x27, 0x70, 0x22, 0x4c, 0x22, 0x7a, 0x42, 0x33, 0x8c, 0xf0, 0xbd, 0x69,
+  0x78, 0xd0, 0xa1, 0x77, 0x60, 0x94, 0x0e, 0x78, 0xa1, 0x99, 0xb9, 0xe2, 0xf7, 0x6d, 0xae, 0xcf,
+  0x33, 0xfd, 0x49, 0x24, 0xad, 0xd1, 0xab, 0x29, 0xab, 0x6d, 0xfc, 0x8a, 0xe9, 0x75, 0x35, 0x89,
+  0xaa, 0x04, 0x5d, 0xa6, 0x3a, 0x63, 0x8c, 0x72, 0x64, 0xa3, 0x72, 0xd4, 0x44, 0x75, 0xe3, 0x64,
+  0x75, 0xe3, 0x18, 0x6d, 0x65, 0xa1, 0x3e, 0x2b, 0x89, 0x2d, 0xf2, 0x72, 0xf7, 0xa8, 0x35, 0x58,
+  0x9c, 0xca, 0x10, 0x9b, 0x60, 0xd0, 0x69, 0x11, 0x08, 0x41, 0xb5, 0xff, 0xf7, 0x83, 0x68, 0x60,
+  0xa4, 0x0f, 0x3d, 0x6f, 0x54, 0xfa, 0x73, 0x7d, 0x09, 0x0a, 0xdc, 0x24, 0xba, 0xeb, 0x91, 0xec,
+  0x95, 0x73, 0x92, 0xea, 0x6a, 0xdc, 0xd5, 0x95, 0x8e, 0xfc, 0x61, 0xe6, 0x50, 0x90, 0xb4, 0xcb,
+  0xa8, 0x60, 0xc1, 0x49, 0x06, 0xe5, 0x51, 0x3a, 0x44, 0x38, 0x6a, 0xa9, 0x61, 0xb3, 0xe8, 0x0a,
+  0x13, 0xcc, 0x4f, 0x99, 0x95, 0x77, 0xdf, 0x92, 0x32, 0x57, 0x7a, 0x0e, 0xcb, 0x8b, 0x18, 0x67,
+  0xf4, 0xfa, 0x3c, 0x7f, 0x6e, 0x36, 0x75, 0x15, 0x24, 0x0d, 0xa7, 0x19, 0x37, 0xee, 0x2a, 0xa2,
+  0x53, 0x76, 0xd0, 0xf7, 0x1e, 0xd6, 0x6d, 0x9d, 0x99, 0xd0, 0x1a, 0x40, 0xdd, 0x16, 0x8d, 0xbb,
+  0x24, 0x40, 0x5d, 0x9a, 0x1e, 0xdc, 0xe5, 0x72, 0xf8, 0x4d, 0x0e, 0x42, 0x30, 0xb2, 0xa2, 0xc9,
+  0xee, 0x0b, 0x2e, 0x9e, 0x5b, 0x30, 0x75, 0x5a, 0x16, 0xa9, 0x27, 0xcb, 0xb4, 0xc5, 0xb9, 0xba,
+  0x6c, 0x37, 0xec, 0x12, 0x61, 0x91, 0x63, 0x28, 0xc9, 0x42, 0xc8, 0x0e, 0x3c, 0x18, 0x20, 0xf3,
+  0x87, 0x59, 0xaa, 0x2b, 0x5d, 0x75, 0xb5, 0xde, 0x45, 0xd3, 0xfc, 0xef, 0x6c, 0xca, 0x02, 0xbe,
+  0x1c, 0x45, 0x30, 0xe2, 0xc7, 0x27, 0xf1, 0xfa, 0xfc, 0x0e, 0x67, 0xff, 0xf2, 0x25, 0x09, 0x7c,
+  0x7c, 0x85, 0x35, 0x23, 0x51, 0x70, 0xc8, 0x5c, 0x7a, 0x8a, 0x58, 0x52, 0x64, 0x6b, 0xa8, 0x73,
+  0x4d, 0x68, 0xf4, 0x8f, 0x1d, 0xed, 0x1d, 0xdf, 0xec, 0x29, 0x2e, 0xb4, 0x97, 0x52, 0x99, 0x28,
+  0x85, 0xdd, 0xa5, 0x1e, 0x22, 0x97, 0xd6, 0x95, 0x8c, 0x1d, 0x69, 0x2b, 0xc8, 0x4f, 0x5e, 0x30,
+  0x6f, 0xf8, 0x83, 0xf7, 0x99, 0x42, 0xc9, 0x52, 0x6d, 0xab, 0xd5, 0xe6, 0xf0, 0xb1, 0xb4, 0x0e,
+  0xc5, 0x26, 0x72, 0x25, 0xeb, 0xe9, 0x89, 0x07, 0xb0, 0xf5, 0x53, 0x74, 0x65, 0x1d, 0x43, 0x56,
+  0x8c, 0xd3, 0x8c, 0x2a, 0xd5, 0x17, 0x69, 0x21, 0xcc, 0xc3, 0x93, 0x0e, 0xb3, 0xcd, 0x5a, 0x35,
+  0xd9, 0xe2, 0x4f, 0x1c, 0xd1, 0xb1, 0x22, 0xb9, 0x6d, 0xa6, 0xbd, 0x30, 0xaf, 0xb4, 0xb1, 0xca,
+  0x5d, 0x3a, 0xe6, 0x6e, 0xdd, 0x50, 0x82, 0xc6, 0x46, 0x11, 0xc3, 0x2a, 0x8a, 0x5d, 0x13, 0xc7,
+  0x7b, 0xc7, 0xd5, 0xfb, 0x26, 0x36, 0x05, 0x1a, 0xc7, 0x78, 0x2b, 0x4a, 0xe5, 0xac, 0x0c, 0x93,
+  0xcb, 0xc5, 0xa7, 0x06, 0xf9, 0x09, 0x15, 0x16, 0x92, 0xc4, 0xfb, 0x75, 0x91, 0x6a, 0xbf, 0xaf,
+  0xff, 0x55, 0xa8, 0x60, 0xad, 0x2e, 0x7c, 0xf7, 0x56, 0xab, 0x83, 0x35, 0x1a, 0x58, 0xad, 0x86,
+  0x15, 0x4a, 0x3d, 0x0f, 0x89, 0x16, 0x46, 0x90, 0x04, 0x66, 0x06, 0x55, 0x57, 0xea, 0x71, 0x94,
+  0xf9, 0x59, 0xc8, 0xec, 0xb3, 0x8d, 0x9e, 0x6d, 0x4d, 0x4b, 0xb7, 0xa4, 0x67, 0x1a, 0x53, 0x33,
+  0x28, 0x96, 0xf3, 0x8c, 0x6f, 0xf7, 0x4c, 0xb8, 0x4f, 0x81, 0x23, 0xc3, 0x51, 0xff, 0x6e, 0x66,
+  0xd5, 0x2e, 0xa4, 0xbd, 0xc1, 0x5d, 0x99, 0xb8, 0x60, 0x49, 0x9a, 0xbd, 0x70, 0xd1, 0xd0, 0x99,
+  0x4b, 0x14, 0x0b, 0x32, 0xa0, 0x64, 0x25, 0x0e, 0x39, 0xc7, 0x2d, 0xf6, 0xb6, 0x2c, 0x26, 0x19,
+  0xd6, 0x98, 0x9c, 0x62, 0xcd, 0xce, 0xb1, 0xa5, 0x67, 0xc8, 0x35, 0xb3, 0x61, 0xb3, 0xef, 0x1e,
+  0x0f, 0x37, 0xc2, 0x2d, 0x2f, 0x20, 0xea, 0x2d, 0x02, 0x67, 0x63, 0x44, 0x41, 0x27, 0xc6, 0xab,
+  0xf4, 0x2a, 0x15, 0x1c, 0xbe, 0xa5, 0xac, 0x85, 0x23, 0xfa, 0x20, 0x0a, 0x35, 0xdc, 0xdf, 0x0b,
+  0x80, 0xfb, 0x9d, 0x2f, 0x41, 0x84, 0x9f, 0x77, 0xc0, 0xf1, 0x1f, 0x56, 0x02, 0xd3, 0x04, 0xa9,
+  0xc2, 0xd5, 0x73, 0xf8, 0xd1, 0x0d, 0x78, 0xa1, 0x12, 0xd6, 0x4c, 0x64, 0x2b, 0x79, 0x9c, 0x9e,
+  0x5b, 0x64, 0xcd, 0xb7, 0x11, 0xb8, 0x23, 0xe0, 0x1c, 0x3d, 0xc3, 0x59, 0x39, 0x09, 0x13, 0x24,
+  0x8a, 0x15, 0x8c, 0xbc, 0x20, 0x87, 0xb2, 0x78, 0x59, 0xde, 0xec, 0x9b, 0xfb, 0x17, 0x64, 0xdd,
+  0x1c, 0xbc, 0x3c, 0xe3, 0xfe, 0x07, 0xc7, 0xef, 0x3a, 0xe9, 0x98, 0xb3, 0x24, 0x47, 0x95, 0xb6,
+  0x2e, 0x6e, 0xd5, 0x14, 0x65, 0x33, 0x27, 0x98, 0x64, 0xd0, 0x2f, 0x0a, 0x22, 0xcd, 0x0a, 0xa8,
+  0x20, 0x39, 0x2b, 0x27, 0xba, 0xaa, 0x5b, 0x09, 0xbb, 0x3f, 0xcf, 0x82, 0xcf, 0xca, 0x77, 0x70,
+  0x38, 0x3d, 0x9d, 0xab, 0x51, 0x22, 0xba, 0x09, 0x68, 0xc9, 0x7c, 0xbc, 0x4e, 0x49, 0xa8, 0xc1,
+  0xd5, 0x09, 0x22, 0x3a, 0x28, 0x09, 0xeb, 0x43, 0xf6, 0xd3, 0xa2, 0x92, 0xbf, 0x93, 0x01, 0x78,
+  0xfe, 0x2d, 0xfc, 0x08, 0x51, 0x38, 0x98, 0x25, 0x40, 0x78, 0x5b, 0xc1, 0x0f, 0x2f, 0xc0, 0x33,
+  0x1a, 0x89, 0x62, 0x51, 0xc4, 0x21, 0xb5, 0x56, 0xf2, 0x24, 0x51, 0xa9, 0xb9, 0x66, 0x0c, 0x53,
+  0xc1, 0x3a, 0x9b, 0x48, 0xda, 0x49, 0xa6, 0xda, 0x66, 0x7c, 0xb0, 0x7c, 0xf1, 0xc7, 0x96, 0x47,
+  0x9f, 0xd4, 0x4f, 0x0c, 0x56, 0x34, 0x14, 0x3c, 0xfd, 0xae, 0x31, 0xa5, 0x70, 0x92, 0x62, 0xcc,
+  0xea, 0x84, 0xfb, 0x6a, 0xd5, 0xd5, 0x0d, 0x2e, 0xc9, 0x09, 0x2c, 0x97, 0x0b, 0x1f, 0x6f, 0xc1,
+  0x30, 0x3a, 0x25, 0x57, 0x74, 0x85, 0x0c, 0x6a, 0x0d, 0x2f, 0xe2, 0xe3, 0xc9, 0xf2, 0x42, 0x34,
+  0xa3, 0x56, 0x28, 0xa6, 0xb0, 0xf0, 0xb5, 0x68, 0x8c, 0x44, 0xfb, 0x7b, 0x2d, 0xea, 0x3f, 0x93,
+  0x01, 0x7a, 0xfe, 0x38, 0xb2, 0xba, 0x12, 0xf0, 0xcd, 0x35, 0x17, 0xe4, 0x0a, 0xce, 0x32, 0x49,
+  0xae, 0x0e, 0x98, 0xb2, 0x6c, 0xf6, 0x3a, 0x22, 0x98, 0x87, 0x99, 0xea, 0x2d, 0xce, 0x1c, 0xd2,
+  0xef, 0x84, 0xad, 0x76, 0x2f, 0x3f, 0xce, 0x61, 0x29, 0xf6, 0xda, 0xdf, 0x2a, 0x79, 0xfa, 0x30,
+  0xf6, 0xe8, 0x12, 0xa6, 0x8e, 0x4c, 0x4c, 0x6c, 0x50, 0xd7, 0xbc, 0x30, 0xf4, 0xa9, 0xb9, 0xb1,
+  0x6d, 0x85, 0x92, 0xd0, 0xe2, 0xb3, 0xda, 0xdc, 0x8c, 0x0b, 0xb5, 0xe6, 0xd0, 0x81, 0xd1, 0x66,
+  0x57, 0x1e, 0x66, 0xae, 0x21, 0xfc, 0x99, 0x16, 0x1b, 0x28, 0xad, 0x42, 0x92, 0x73, 0x04, 0x67,
+  0x81, 0xb5, 0x94, 0xc4, 0x09, 0xe4, 0x1f, 0x9e, 0x1a, 0xff, 0x49, 0x65, 0xe0, 0x9e, 0xdf, 0x8c,
+  0x6c, 0xd3, 0xed, 0x05, 0x66, 0x86, 0x6f, 0xf0, 0x98, 0xf2, 0x1d, 0x26, 0x46, 0xe0, 0x02, 0x84,
+  0xb9, 0x8d, 0x2f, 0x1a, 0x8a, 0x2a, 0x17, 0x10, 0x35, 0xad, 0x58, 0x19, 0x6b, 0x07, 0x63, 0x6e,
+  0xb6, 0xc5, 0xc2, 0xd5, 0xe7, 0x55, 0x1c, 0x4d, 0xf9, 0xd5, 0x01, 0x78, 0xdd, 0x26, 0xfd, 0xac,
+  0x87, 0x63, 0x1f, 0xd8, 0x18, 0xb7, 0x3e, 0x1b, 0x49, 0x9e, 0xe4, 0x35, 0x61, 0x28, 0x0d, 0xc2,
+  0xdc, 0xc9, 0x44, 0xf1, 0x12, 0x72, 0x54, 0x0c, 0xac, 0x9c, 0x2d, 0x14, 0x06, 0x29, 0x2b, 0x49,
+  0x93, 0xc3, 0xed, 0x62, 0x83, 0x4f, 0x94, 0x18, 0x36, 0x5b, 0x2e, 0xc1, 0xc3, 0xd1, 0x41, 0xff,
+  0x2e, 0xf2, 0xfd, 0x17, 0x32, 0xa0, 0xef, 0x7f, 0x40, 0xb1, 0x0c, 0x5b, 0x1e, 0x45, 0xb2, 0x09,
+  0x06, 0x83, 0x16, 0x46, 0xc1, 0xf8, 0xd5, 0x80, 0x40, 0x64, 0x78, 0x1a, 0x03, 0x6f, 0x26, 0x0b,
+  0x5a, 0xd0, 0x62, 0x87, 0xc9, 0xb0, 0xae, 0x5e, 0x2e, 0xb0, 0x19, 0xab, 0xec, 0xc6, 0x0d, 0xe5,
+  0xf7, 0x5d, 0x34, 0x6e, 0xf9, 0xad, 0x76, 0xf3, 0x13, 0x43, 0x37, 0x8e, 0x4b, 0x68, 0xae, 0x76,
+  0x08, 0xf9, 0x46, 0xe1, 0xb1, 0x16, 0x97, 0xcf, 0x8f, 0x8d, 0x86, 0xf2, 0xc7, 0x13, 0xf9, 0xc0,
+  0xcf, 0x53, 0x38, 0x05, 0x21, 0x10, 0xb0, 0x55, 0x2d, 0x8c, 0x28, 0x0d, 0x10, 0x45, 0xb0, 0xb9,
+  0x8e, 0xd2, 0x28, 0xdf, 0x81, 0xaa, 0xe2, 0x00, 0xbf, 0x5f, 0x43, 0x60, 0x8c, 0x80, 0x4b, 0xe4,
+  0xd1, 0xc3, 0xf0, 0xb0, 0x0f, 0xa7, 0x28, 0x01, 0x0c, 0x9f, 0x49, 0xac, 0x98, 0x4c, 0xad, 0x46,
+  0x0b, 0x92, 0x9d, 0xe8, 0xf6, 0x6a, 0x27, 0x00, 0x34, 0xce, 0x2a, 0xe5, 0x27, 0xa7, 0x7c, 0x5e,
+  0xf6, 0xeb, 0xdf, 0x2a, 0x36, 0xdc, 0x1f, 0xbb, 0x2a, 0x83, 0x76, 0x34, 0x39, 0x4d, 0xe0, 0x8c,
+  0x6d, 0x8d, 0xce, 0x64, 0x2f, 0x56, 0x81, 0x0c, 0x2b, 0x27, 0xd2, 0x71, 0x02, 0xe5, 0x00, 0x61,
+  0x10, 0x70, 0x85, 0x5f, 0x7c, 0x10, 0xbe, 0x9f, 0x0d, 0x4a, 0x16, 0x58, 0xd3, 0xc0, 0x56, 0x70,
+  0x80, 0xf9, 0x22, 0x68, 0xf8, 0xed, 0x18, 0x00, 0x8a, 0x21, 0x5e, 0xe1, 0x9b, 0x3e, 0x31, 0xad,
+  0xe3, 0x7e, 0x4c, 0xa9, 0x82, 0x09, 0xd8, 0x46, 0x38, 0x33, 0xa8, 0x5c, 0x10, 0xda, 0x69, 0x21,
+  0x5c, 0x87, 0xa0, 0x3e, 0x8e, 0xad, 0xb6, 0xb3, 0x8b, 0x0b, 0x5a, 0xf7, 0xb1, 0xdb, 0xf2, 0x15,
+  0x23, 0xc6, 0x79, 0x24, 0x0f, 0xc3, 0x80, 0x7c, 0x8d, 0x01, 0x57, 0x43, 0xba, 0x64, 0x2a, 0xdd,
+  0x8e, 0x3b, 0x21, 0x1c, 0xc2, 0xb4, 0xba, 0xb4, 0xc7, 0xd6, 0x7b, 0xa6, 0x4f, 0x80, 0xe2, 0x15,
+  0xa0, 0xcc, 0x48, 0xf9, 0xf0, 0xc0, 0x56, 0xf0, 0xce, 0x78, 0x3f, 0x0c, 0x1e, 0x5e, 0xdf, 0xc8,
+  0x7b, 0x3d, 0xa6, 0xf4, 0x54, 0x90, 0x80, 0x31, 0xd8, 0x48, 0x98, 0x13, 0xa9, 0x2c, 0x08, 0x0b,
+  0xaf, 0x2c, 0x07, 0xe6, 0xa8, 0x41, 0xd0, 0x1a, 0x8b, 0xb1, 0xc2, 0xee, 0x9d, 0x4f, 0xce, 0x1c,
+  0xce, 0x5b, 0xea, 0x1c, 0xd6, 0xe8, 0x14, 0x17, 0xd8, 0x05, 0x61, 0x86, 0x00, 0x95, 0x2a, 0xe2,
+  0xe1, 0x65, 0xd2, 0x28, 0x04, 0x9b, 0x32, 0xd3, 0x79, 0xaf, 0x1b, 0x31, 0x40, 0x77, 0xc8, 0x8b,
+  0x7a, 0xee, 0x0c, 0xbe, 0xd8, 0x0f, 0x88, 0x61, 0x9d, 0x3e, 0x9c, 0xc0, 0x10, 0x0e, 0xe7, 0x7d,
+  0x64, 0x08, 0x42, 0x0d, 0x91, 0x38, 0x15, 0x90, 0x43, 0x45, 0x92, 0x98, 0xe2, 0xb1, 0x11, 0x28,
+  0x31, 0xdb, 0xef, 0xe0, 0x49, 0x22, 0x7a, 0x97, 0x37, 0xf2, 0x5e, 0x13, 0x83, 0x97, 0x4c, 0xe2,
+  0x71, 0x01, 0xc1, 0xe0, 0xf0, 0xb9, 0x3a, 0xdd, 0x9d, 0x03, 0x17, 0xbb, 0x83, 0xf8, 0x46, 0xdc,
+  0x2f, 0x1e, 0xe1, 0x02, 0x62, 0x29, 0x12, 0x23, 0x85, 0x30, 0xb2, 0x1f, 0xde, 0xad, 0x13, 0x5e,
+  0xf6, 0x8a, 0x20, 0x39, 0x12, 0xbf, 0x3a, 0xd9, 0x9d, 0x25, 0x0a, 0xda, 0xbf, 0x9b, 0x9f, 0x45,
+  0x31, 0x44, 0xc0, 0x8d, 0x24, 0x08, 0xa9, 0x23, 0x9d, 0xd8, 0xdf, 0x0a, 0xb9, 0x43, 0xe4, 0x0e,
+  0xe2, 0xfb, 0xf7, 0x12, 0xbe, 0x4f, 0xf1, 0x23, 0xdc, 0xbf, 0x97, 0x4c, 0x49, 0xfc, 0x9f, 0xb9,
+  0xe1, 0xf7, 0xef, 0x0c, 0x5c, 0x84, 0xf0, 0xaf, 0xe5, 0x0e, 0xe5, 0xfb, 0xbf, 0x09, 0xb0, 0xdc,
+  0x81, 0x56, 0xe1, 0xdf, 0x93, 0xff, 0x30, 0xbe, 0x77, 0x50, 0xcb, 0xff, 0x7f, 0x93, 0xff, 0x30,
+  0xbe, 0xff, 0x71, 0xf2, 0x7f, 0x00, 0x98, 0x17, 0x13, 0xd3, 0xc8, 0xa6, 0x0e, 0xb8, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+// style.css: 7531 bytes, 2148 as sent
+static const uint8_t webAsset_style_css[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x59, 0x4b, 0x73, 0xdb, 0x38,
+  0x12, 0x3e, 0x4b, 0xbf, 0x02, 0x15, 0x57, 0xca, 0x56, 0x22, 0x32, 0x10, 0xf5, 0xb0, 0x22, 0xd6,
+  0x6e, 0xcd, 0xce, 0x5c, 0x66, 0xaa, 0xe6, 0xb6, 0x53, 0xb5, 0x87, 0xcd, 0x1e, 0x20, 0x12, 0x94,
+  0x50, 0xa6, 0x08, 0x2e, 0x49, 0x45, 0x76, 0x54, 0xda, 0xdf, 0xbe, 0xdd, 0x0d, 0x80, 0x2f, 0x51,
+  0xb1, 0x73, 0x8f, 0x65, 0xd9, 0x52, 0xa3, 0xd1, 0xf8, 0xfa, 0x81, 0x6e, 0xa0, 0xb9, 0x29, 0xb4,
+  0xae, 0xd8, 0x79, 0xcc, 0x98, 0xe7, 0x6d, 0x77, 0x5e, 0xa4, 0x53, 0x5d, 0x6c, 0xd8, 0x5d, 0x92,
+  0x24, 0x21, 0xd1, 0x2a, 0xf9, 0x5c, 0xd5, 0x54, 0xce, 0xb9, 0xa1, 0x46, 0xa2, 0x88, 0xbd, 0xad,
+  0x2e, 0x62, 0x89, 0x64, 0x29, 0xa5, 0x21, 0xef, 0xd5, 0x6e, 0x9f, 0xc2, 0xbb, 0x42, 0x09, 0xc2,
+  0xf2, 0x6e, 0xab, 0x0c, 0x24, 0xb7, 0x65, 0x22, 0x05, 0xe5, 0xb6, 0x25, 0xaa, 0xac, 0x54, 0xb1,
+  0x6c, 0x98, 0x49, 0xe6, 0x65, 0x3c, 0xf6, 0x63, 0x51, 0x3c, 0x79, 0x07, 0x1d, 0xcb, 0x6b, 0x90,
+  0xb3, 0x35, 0xbe, 0x06, 0x70, 0xd6, 0x80, 0xba, 0x38, 0x17, 0x8b, 0xc5, 0x00, 0xce, 0x64, 0x3b,
+  0xe7, 0x7d, 0xa8, 0xf3, 0xf9, 0xfc, 0x0a, 0x6a, 0x0d, 0xff, 0x16, 0xd4, 0x0f, 0xec, 0xcc, 0xb6,
+  0xfa, 0xd9, 0x2b, 0xd5, 0x37, 0x95, 0xc1, 0x80, 0x59, 0x17, 0x96, 0x7f, 0x0e, 0xd9, 0x05, 0x46,
+  0x3f, 0x32, 0xe4, 0x38, 0x88, 0x62, 0xa7, 0xb2, 0x0d, 0xf3, 0x97, 0xf2, 0xc0, 0x38, 0x8e, 0x6c,
+  0x75, 0xfc, 0x82, 0x53, 0x45, 0xf4, 0xb4, 0x2b, 0xf4, 0x31, 0x8b, 0x37, 0xec, 0xab, 0x28, 0x1e,
+  0x1a, 0x55, 0x27, 0x21, 0xb3, 0x9a, 0x19, 0x7a, 0xa3, 0x2b, 0x8c, 0x54, 0x85, 0x00, 0x3c, 0x95,
+  0xd2, 0x20, 0x93, 0xfb, 0xf3, 0x92, 0x49, 0x51, 0x4a, 0xc0, 0xe8, 0xe9, 0x63, 0x85, 0xd2, 0xf3,
+  0x02, 0x2c, 0xc7, 0xf4, 0x57, 0x59, 0x24, 0xa9, 0x3e, 0x6d, 0x98, 0x38, 0x56, 0x1a, 0xe9, 0xbf,
+  0x1c, 0x64, 0xac, 0x04, 0x7b, 0x38, 0x00, 0xeb, 0x49, 0xc5, 0xd5, 0x7e, 0xc3, 0xe6, 0x00, 0x69,
+  0x42, 0x66, 0xf6, 0x41, 0x3a, 0xcc, 0x8a, 0x55, 0x99, 0xa7, 0xe2, 0x65, 0xc3, 0x2a, 0xb1, 0x4d,
+  0xa5, 0x17, 0xc9, 0x34, 0xc5, 0xa9, 0x30, 0xfe, 0x65, 0x3e, 0x83, 0x71, 0x3b, 0x6f, 0xf9, 0x1e,
+  0xa8, 0x48, 0x0b, 0x1a, 0xda, 0xac, 0x26, 0xce, 0x1b, 0x62, 0x10, 0x38, 0xe2, 0xa2, 0x21, 0xce,
+  0xb9, 0x23, 0x2e, 0x1b, 0xe2, 0xa2, 0x26, 0xae, 0x5a, 0xeb, 0x10, 0x11, 0x97, 0x2f, 0xf4, 0xe9,
+  0x0a, 0x5e, 0xe8, 0x0c, 0x5e, 0xe6, 0x22, 0x22, 0x07, 0xcc, 0x9c, 0x85, 0x2f, 0x63, 0x9c, 0x31,
+  0x65, 0xfe, 0xc9, 0x9b, 0x71, 0xde, 0x02, 0xc9, 0x8d, 0x44, 0x1f, 0xe3, 0x64, 0x93, 0xe8, 0xe8,
+  0x58, 0x4e, 0xd9, 0xbe, 0x40, 0x7b, 0x1d, 0xab, 0x54, 0x65, 0x72, 0x83, 0xf3, 0x5d, 0xfc, 0x94,
+  0x3a, 0x55, 0xb1, 0x75, 0x41, 0x1d, 0x41, 0x93, 0x7a, 0xfe, 0x94, 0x19, 0x53, 0xe7, 0x22, 0x8e,
+  0xdd, 0xf2, 0xc3, 0x93, 0x5b, 0x51, 0x09, 0xd3, 0x1b, 0xbf, 0x7b, 0x1d, 0x2f, 0x5b, 0xef, 0xef,
+  0x26, 0x21, 0x2c, 0x00, 0xc1, 0xb6, 0xd9, 0xa3, 0x13, 0xa7, 0x4c, 0x98, 0x0f, 0x08, 0x12, 0x15,
+  0xad, 0x40, 0x7f, 0x7f, 0x65, 0x50, 0x50, 0x78, 0x3d, 0x3b, 0x77, 0xae, 0x38, 0x02, 0xe8, 0xc2,
+  0x71, 0xd1, 0x67, 0xa2, 0x20, 0xd1, 0x59, 0x45, 0x03, 0x9f, 0x66, 0xfe, 0x8a, 0x89, 0x42, 0x09,
+  0xf2, 0xef, 0x7e, 0x06, 0x56, 0x08, 0xe0, 0x3d, 0x87, 0xf7, 0x02, 0xde, 0x4b, 0x78, 0xa3, 0x1f,
+  0x2c, 0x3f, 0x98, 0x10, 0x4d, 0xdb, 0xe2, 0xb7, 0x63, 0x18, 0xfa, 0x60, 0xb3, 0x00, 0x63, 0x1b,
+  0xdd, 0xb7, 0x0f, 0xfa, 0x03, 0x81, 0x1d, 0x98, 0xf7, 0x06, 0x2c, 0x79, 0xd1, 0x25, 0xcf, 0x6a,
+  0x41, 0xcb, 0xfe, 0x80, 0x9b, 0xb1, 0xea, 0x0d, 0x10, 0x79, 0x2c, 0x80, 0xda, 0x31, 0x66, 0xdb,
+  0x5f, 0xb4, 0x7d, 0x62, 0x19, 0xe9, 0x42, 0x98, 0x6d, 0x93, 0xe9, 0x4c, 0x92, 0x01, 0xc1, 0xca,
+  0x7e, 0x5e, 0x28, 0x30, 0xd2, 0x4b, 0x23, 0x80, 0x36, 0xfe, 0xc0, 0xee, 0x6c, 0x8b, 0x7c, 0x3d,
+  0x44, 0x2a, 0x88, 0x8f, 0x6a, 0x7f, 0x15, 0x1e, 0x84, 0x45, 0x00, 0x1b, 0xc0, 0x48, 0x65, 0x52,
+  0x85, 0x4d, 0xd6, 0xa8, 0x2a, 0x7d, 0xf8, 0x5e, 0xdc, 0x18, 0xbc, 0xc3, 0x12, 0x29, 0x29, 0x24,
+  0xba, 0x00, 0x01, 0xc7, 0x3c, 0x97, 0x45, 0x04, 0x39, 0x61, 0x48, 0x07, 0x93, 0xc3, 0xfa, 0x0a,
+  0xb8, 0xc0, 0xf0, 0x1f, 0x1b, 0x2f, 0x77, 0x43, 0xd3, 0x66, 0x45, 0x42, 0xa1, 0xb2, 0xfc, 0x08,
+  0x15, 0xe4, 0x66, 0x86, 0xba, 0x8c, 0x4b, 0x99, 0xca, 0xe8, 0x2d, 0x2c, 0x7f, 0xd7, 0x39, 0x7a,
+  0x84, 0x9d, 0x5f, 0xd9, 0x13, 0x34, 0xc5, 0x3f, 0xc8, 0xb2, 0x14, 0x3b, 0xe9, 0x89, 0x42, 0x82,
+  0xbf, 0x29, 0x08, 0x4e, 0x92, 0xb2, 0xfa, 0x56, 0xa7, 0x71, 0x68, 0x26, 0xde, 0xcd, 0x92, 0x59,
+  0x1c, 0xc5, 0x68, 0x2c, 0x11, 0x7b, 0x32, 0xab, 0x8a, 0x97, 0xb3, 0x35, 0xb1, 0x61, 0x28, 0x24,
+  0x0e, 0x8a, 0x08, 0xc2, 0x21, 0x86, 0xb5, 0xaf, 0x97, 0xa6, 0xfc, 0x6e, 0x3f, 0x62, 0x05, 0x89,
+  0x8e, 0x45, 0x09, 0x9f, 0x73, 0xad, 0xb2, 0x4a, 0x16, 0xa1, 0xb3, 0xfe, 0x6c, 0x9d, 0x3f, 0x87,
+  0x66, 0xe7, 0x51, 0x5a, 0xb1, 0x16, 0xa5, 0xd8, 0x6a, 0x79, 0x99, 0x9c, 0xec, 0xb2, 0x0b, 0x0f,
+  0x9b, 0xd0, 0x9d, 0x2d, 0x61, 0x7e, 0x2b, 0x99, 0xfb, 0x8b, 0xf2, 0xd2, 0xc0, 0xb2, 0x9b, 0x1f,
+  0x08, 0x95, 0xfa, 0x2a, 0x07, 0x40, 0x46, 0x51, 0xd4, 0x66, 0x17, 0x09, 0x60, 0x03, 0x83, 0x03,
+  0x44, 0xf0, 0xe4, 0xfd, 0x17, 0xce, 0x83, 0x5f, 0xef, 0x9d, 0x16, 0x8f, 0x8f, 0x8f, 0x61, 0xdb,
+  0x5c, 0x8f, 0x50, 0xff, 0xa0, 0x38, 0x88, 0x6a, 0x53, 0xe0, 0xf7, 0xd0, 0x24, 0x09, 0x0f, 0xa1,
+  0x6e, 0x00, 0xd5, 0xc5, 0xae, 0xda, 0x13, 0xfa, 0xee, 0x4b, 0x10, 0xcc, 0x82, 0x77, 0x17, 0x3f,
+  0x17, 0x99, 0x4c, 0xcf, 0xce, 0x0e, 0x90, 0x1b, 0xd0, 0x12, 0xaf, 0x7b, 0x10, 0x33, 0xd5, 0xde,
+  0x00, 0xe0, 0x61, 0x5d, 0x9f, 0xf6, 0x2a, 0x8e, 0x65, 0xd6, 0x36, 0x44, 0xc3, 0xc7, 0xfc, 0xc0,
+  0x96, 0x37, 0x30, 0x20, 0x38, 0xcd, 0x15, 0xe2, 0x23, 0x6c, 0x95, 0xec, 0x9c, 0x6b, 0x3b, 0x41,
+  0x6c, 0x21, 0x8a, 0x8f, 0x95, 0x0c, 0x49, 0x1b, 0xf0, 0x06, 0xc2, 0x69, 0x79, 0xe3, 0x16, 0xb4,
+  0x4e, 0x5d, 0x9f, 0xd8, 0x29, 0x5e, 0x21, 0x62, 0x75, 0x2c, 0x37, 0x0b, 0x10, 0xc2, 0xda, 0xe7,
+  0x20, 0x58, 0x1f, 0xca, 0x0e, 0x20, 0x13, 0xc0, 0x75, 0x1d, 0x7d, 0xce, 0x1c, 0x38, 0x0f, 0xcb,
+  0x0f, 0x8e, 0x9c, 0x5b, 0x71, 0x40, 0x04, 0x1c, 0x40, 0xd3, 0x39, 0xe4, 0xf0, 0x45, 0xa0, 0xa5,
+  0x81, 0xbe, 0x93, 0xa2, 0xb8, 0xa9, 0x52, 0x80, 0x2a, 0x55, 0x3a, 0x27, 0xdd, 0x80, 0x19, 0xaa,
+  0xc4, 0x1f, 0xd1, 0x77, 0x4c, 0xb0, 0xee, 0xf1, 0x67, 0x50, 0x39, 0x62, 0xe6, 0x5c, 0xe6, 0xe1,
+  0x08, 0x72, 0xb8, 0xef, 0x36, 0xf7, 0x18, 0x5e, 0xd2, 0x19, 0xce, 0x30, 0xec, 0x6c, 0x9d, 0xb5,
+  0x30, 0xf4, 0x3d, 0x84, 0xbf, 0xdd, 0x75, 0x65, 0xf5, 0x92, 0xca, 0x8d, 0xaa, 0x40, 0xb3, 0xa8,
+  0x15, 0xd1, 0xfe, 0xba, 0xa9, 0x38, 0x26, 0x98, 0x02, 0x07, 0xf7, 0x84, 0xf5, 0xab, 0x97, 0xa9,
+  0x88, 0x8a, 0x89, 0x0a, 0x38, 0x92, 0xd3, 0x31, 0x8f, 0x45, 0x45, 0xce, 0x18, 0xd8, 0xda, 0x57,
+  0x1e, 0xa4, 0x3c, 0xbb, 0x2b, 0x24, 0x44, 0x8e, 0x21, 0x6c, 0x53, 0x60, 0xc1, 0x1c, 0xa1, 0x63,
+  0x91, 0xfe, 0x06, 0xf3, 0x05, 0xec, 0xb7, 0xa2, 0x93, 0x2c, 0x57, 0xe8, 0xd1, 0x76, 0xfe, 0x8d,
+  0x24, 0x6d, 0x68, 0xe6, 0xa6, 0xb1, 0x73, 0x7d, 0xc0, 0x30, 0x15, 0xa2, 0x36, 0x2f, 0x4b, 0xd4,
+  0xb3, 0x84, 0x34, 0xf9, 0x0d, 0x62, 0x26, 0x96, 0xcf, 0x20, 0x2c, 0xa4, 0xec, 0x4d, 0xc7, 0x05,
+  0xb4, 0x26, 0xfe, 0xef, 0x9c, 0x31, 0xac, 0xed, 0xec, 0xb7, 0xfe, 0x69, 0xec, 0x3a, 0x22, 0xef,
+  0x16, 0x8f, 0x0b, 0xb9, 0xac, 0xc3, 0x88, 0x5c, 0x04, 0xe7, 0x1f, 0x80, 0xec, 0x8a, 0x3e, 0xf7,
+  0xd7, 0x0e, 0xa8, 0x67, 0x33, 0x21, 0x3b, 0xb7, 0xf2, 0x4f, 0x4b, 0x33, 0xab, 0x98, 0x11, 0x7d,
+  0xda, 0x2b, 0x88, 0x8b, 0xc6, 0x4b, 0x41, 0x30, 0xb4, 0x5b, 0xc9, 0x7e, 0x75, 0x10, 0x5b, 0xbf,
+  0x99, 0xc5, 0xec, 0xfe, 0x1f, 0x4a, 0xd2, 0x77, 0x89, 0xc4, 0x57, 0xe8, 0x4e, 0x19, 0xcb, 0xf7,
+  0xa4, 0x20, 0x1e, 0x06, 0x9d, 0xa6, 0xb6, 0xce, 0xcc, 0xf2, 0x67, 0x5b, 0xda, 0xee, 0xd6, 0xeb,
+  0x75, 0x6d, 0xac, 0xb5, 0x3d, 0x8f, 0x65, 0xdb, 0x4e, 0x80, 0x76, 0x02, 0x32, 0xd3, 0xe5, 0x1e,
+  0x8f, 0x7f, 0xce, 0x39, 0xe8, 0x1b, 0x0a, 0x2a, 0x81, 0xbc, 0x53, 0xf7, 0x61, 0xb3, 0x95, 0x10,
+  0x56, 0xb2, 0xd9, 0x13, 0xc6, 0x67, 0x14, 0xeb, 0x21, 0x39, 0x8b, 0x5f, 0x1c, 0xef, 0xd9, 0x39,
+  0xf2, 0xf3, 0xe7, 0xcf, 0xa1, 0x75, 0x15, 0x1e, 0x30, 0x0c, 0x2a, 0xfc, 0x54, 0x7b, 0x0c, 0xd7,
+  0x76, 0xfa, 0x91, 0x4a, 0x0e, 0x9b, 0xdd, 0x6a, 0x3c, 0xfc, 0xaa, 0x4a, 0xb5, 0x55, 0x29, 0xfa,
+  0xc8, 0x24, 0xb3, 0x4b, 0x1f, 0x52, 0x9d, 0x96, 0xef, 0x43, 0xa7, 0xc4, 0x36, 0xd5, 0x60, 0xef,
+  0x96, 0xfb, 0x2c, 0x0a, 0x53, 0x4a, 0x9a, 0xba, 0x8d, 0xd9, 0x08, 0x7c, 0xb0, 0xc3, 0xff, 0x20,
+  0xe2, 0xa1, 0xd8, 0x6d, 0xc5, 0x43, 0xc0, 0xa7, 0xe6, 0xd7, 0x5f, 0x4f, 0xa6, 0x44, 0xe1, 0x53,
+  0x7c, 0xc1, 0xd7, 0x49, 0x7b, 0x32, 0xec, 0xa1, 0xed, 0x93, 0xaa, 0xbc, 0x1f, 0x16, 0xd2, 0x68,
+  0x90, 0xe9, 0xea, 0x01, 0xd2, 0xd4, 0x7f, 0x8f, 0x0a, 0xea, 0xe6, 0x84, 0x76, 0xe6, 0x86, 0x7f,
+  0xe2, 0x4c, 0xd8, 0xe8, 0xa2, 0xed, 0x9c, 0x43, 0x45, 0xce, 0x2a, 0x13, 0x81, 0xe5, 0x5e, 0xc4,
+  0x60, 0xb6, 0xe1, 0xc4, 0xdb, 0xe6, 0xb6, 0x91, 0xc1, 0x6f, 0xad, 0xd5, 0x2f, 0x69, 0x7d, 0xdb,
+  0xb5, 0x2a, 0x29, 0x6f, 0x2a, 0x31, 0xb8, 0xce, 0x59, 0x12, 0x3e, 0xda, 0x5c, 0x84, 0x31, 0xe0,
+  0xd1, 0xd1, 0xd2, 0x59, 0x44, 0x64, 0x70, 0xe8, 0xa3, 0x28, 0x99, 0x2d, 0xf9, 0xa1, 0x64, 0x58,
+  0x9d, 0x45, 0xc1, 0x54, 0x96, 0xa8, 0x0c, 0xb6, 0x0b, 0x2b, 0x73, 0x95, 0x41, 0xfe, 0x08, 0xe1,
+  0x22, 0xfa, 0xed, 0x07, 0x98, 0xcb, 0x16, 0xaf, 0xa5, 0x32, 0x33, 0xa7, 0x66, 0x36, 0x93, 0x43,
+  0x4f, 0xbf, 0x59, 0xec, 0x5b, 0xf9, 0xba, 0xf5, 0xab, 0xa3, 0x2e, 0xdd, 0x52, 0x8d, 0x63, 0x8c,
+  0xef, 0x97, 0xcb, 0xa9, 0x7b, 0xfb, 0x8f, 0xcb, 0x89, 0x39, 0x78, 0x33, 0x8e, 0xaf, 0xe9, 0x2d,
+  0x0e, 0xbc, 0x02, 0x98, 0xbf, 0xb7, 0xb9, 0x78, 0x23, 0xe9, 0x06, 0x87, 0xf7, 0x36, 0x41, 0xde,
+  0xeb, 0x88, 0xac, 0x24, 0xef, 0x75, 0x4c, 0xde, 0x6b, 0xa0, 0xfa, 0x92, 0xc2, 0x9f, 0x06, 0xfb,
+  0x31, 0x83, 0x5d, 0x7e, 0x71, 0xa1, 0xf6, 0x24, 0x5f, 0x92, 0x42, 0x40, 0x81, 0x72, 0x71, 0x79,
+  0xe6, 0xef, 0xcf, 0x6e, 0xb0, 0x29, 0xfe, 0x85, 0xae, 0xa0, 0xdc, 0x3f, 0xf0, 0x89, 0xd9, 0x62,
+  0xc3, 0x03, 0xe5, 0x30, 0x5d, 0x0f, 0x92, 0x07, 0x68, 0x17, 0xcc, 0xa6, 0xb7, 0x17, 0x9f, 0xaf,
+  0x78, 0x2c, 0x77, 0xb7, 0x10, 0x34, 0xa3, 0xe5, 0x77, 0x06, 0xf5, 0xed, 0xb1, 0x5b, 0x03, 0x17,
+  0x30, 0x16, 0xae, 0xf8, 0xd3, 0x52, 0x6f, 0xb1, 0x94, 0xfe, 0x69, 0xa7, 0xb7, 0xd8, 0xe9, 0xa7,
+  0x91, 0x5e, 0x37, 0xd2, 0x78, 0xfc, 0xe9, 0x03, 0xfb, 0x55, 0x94, 0x2a, 0xc2, 0x06, 0x22, 0x8b,
+  0xea, 0x5b, 0x02, 0xde, 0x67, 0xe0, 0x00, 0xc2, 0x3e, 0x7c, 0x1a, 0x33, 0xfa, 0xc1, 0x9b, 0x5e,
+  0x49, 0x8d, 0x51, 0xf7, 0xd3, 0x3e, 0xdc, 0x5b, 0xb2, 0x91, 0xf7, 0x3b, 0x5c, 0x21, 0x19, 0xd6,
+  0x5c, 0xcd, 0xcc, 0xbd, 0xb4, 0x44, 0x31, 0x46, 0x00, 0x75, 0x4a, 0xfe, 0x5d, 0xbd, 0xe4, 0xf2,
+  0x6f, 0xef, 0x88, 0xe5, 0xdd, 0x7f, 0xda, 0x5d, 0x4c, 0xd7, 0x86, 0x42, 0x31, 0x7f, 0x01, 0xa0,
+  0x54, 0x6c, 0x65, 0xda, 0x9a, 0x4e, 0xdf, 0x2d, 0x8a, 0x7a, 0x92, 0xca, 0xb0, 0xfe, 0x7b, 0xe6,
+  0x0c, 0x44, 0x43, 0xcd, 0x0d, 0x07, 0xce, 0x41, 0x0c, 0xbb, 0x0a, 0x44, 0xb6, 0x6d, 0x0b, 0xe6,
+  0xfa, 0x16, 0x44, 0xb4, 0x07, 0x22, 0x73, 0x74, 0x85, 0xfc, 0xed, 0x98, 0x2d, 0xdd, 0x35, 0xa1,
+  0xf0, 0x40, 0x35, 0x36, 0xc0, 0x7e, 0xb3, 0xa7, 0x7f, 0x6a, 0xba, 0x58, 0x68, 0xcd, 0x95, 0xa0,
+  0x8b, 0x8d, 0x14, 0xea, 0x62, 0xa2, 0x9b, 0x2b, 0x91, 0x06, 0x6e, 0x02, 0x42, 0x08, 0x3b, 0xf6,
+  0x6a, 0xf3, 0xa0, 0x8d, 0xd2, 0x5c, 0xb8, 0x1a, 0x88, 0xff, 0xc4, 0xeb, 0x81, 0x83, 0x74, 0xda,
+  0xcb, 0x8c, 0xdc, 0xab, 0x60, 0x2b, 0x50, 0x93, 0x49, 0xc6, 0x88, 0xfb, 0x0e, 0x68, 0xb3, 0x4d,
+  0xb4, 0x97, 0xd1, 0x13, 0x10, 0xfe, 0x87, 0x1d, 0x6f, 0x9a, 0x30, 0x9b, 0xd2, 0x50, 0x30, 0x30,
+  0x14, 0xf4, 0xf5, 0xb3, 0x46, 0x77, 0x8e, 0xb7, 0xed, 0x3e, 0x66, 0xba, 0x25, 0xb4, 0xe8, 0xd5,
+  0x42, 0x1f, 0x8d, 0x17, 0xfb, 0x8b, 0x7c, 0xec, 0x38, 0xf7, 0x7b, 0x4f, 0x02, 0x5e, 0xb7, 0x5d,
+  0xb7, 0x7f, 0x68, 0x7c, 0x50, 0xfb, 0x2e, 0x51, 0xbb, 0xa3, 0x69, 0x7b, 0x82, 0x4f, 0xe0, 0xc6,
+  0x88, 0x00, 0x23, 0x24, 0x17, 0x07, 0xef, 0x54, 0x08, 0xec, 0x15, 0x4e, 0xd9, 0x5d, 0x59, 0xaa,
+  0xf8, 0x2f, 0xec, 0xa9, 0xff, 0xcb, 0x90, 0x00, 0xd7, 0xa8, 0x17, 0xf1, 0xed, 0xfb, 0xc9, 0x78,
+  0xd4, 0xbf, 0x19, 0x8f, 0x47, 0xf6, 0x16, 0x3c, 0x1e, 0xb9, 0x7b, 0xf1, 0x78, 0xd4, 0xdc, 0x96,
+  0x39, 0xfd, 0x00, 0xa9, 0xad, 0x29, 0x9d, 0x2c, 0x20, 0x40, 0x16, 0xd3, 0xd6, 0x1f, 0xee, 0xaf,
+  0x18, 0x28, 0x3d, 0xea, 0xc5, 0x14, 0xe8, 0x53, 0xc3, 0xa6, 0xde, 0x44, 0x8d, 0x6f, 0xce, 0x29,
+  0x12, 0x3a, 0x92, 0xcd, 0xa3, 0x9b, 0x11, 0x3e, 0xe9, 0x70, 0xf7, 0xf0, 0xc0, 0xb2, 0x35, 0xc0,
+  0xeb, 0x96, 0x89, 0xc5, 0xbe, 0x24, 0xc5, 0x0c, 0x7a, 0xf3, 0xd9, 0xdd, 0x6a, 0xf1, 0x19, 0x02,
+  0x18, 0x9e, 0xd3, 0xc1, 0x68, 0x69, 0x03, 0xda, 0x45, 0xf8, 0xd2, 0xc6, 0x61, 0x03, 0xcf, 0x66,
+  0x81, 0xf3, 0x8d, 0xc5, 0x3a, 0x76, 0x1d, 0x0d, 0xf4, 0x23, 0x40, 0x17, 0xb7, 0x0d, 0x3b, 0xe6,
+  0xec, 0x5d, 0x8e, 0xa9, 0xfb, 0x3b, 0xb8, 0xb2, 0xf9, 0x8f, 0x00, 0x6e, 0x64, 0x8d, 0x8e, 0xb1,
+  0xda, 0x77, 0xb2, 0xf1, 0xa8, 0xf3, 0xe4, 0x6f, 0xd4, 0x6b, 0xb4, 0x5b, 0x42, 0x22, 0x0e, 0x2a,
+  0x05, 0xa1, 0xf7, 0x7f, 0x8a, 0x4a, 0xdf, 0x4f, 0xd9, 0x3f, 0xb0, 0x63, 0x3c, 0x65, 0x25, 0xc8,
+  0xf1, 0x4a, 0x59, 0xa8, 0xc4, 0x31, 0xda, 0x16, 0x0e, 0xa3, 0x1e, 0x0e, 0xc8, 0xee, 0x67, 0xa4,
+  0xd1, 0xed, 0xde, 0x35, 0x1a, 0xc1, 0xc4, 0x7c, 0xe0, 0x62, 0xbe, 0xe5, 0x11, 0x70, 0x05, 0xdd,
+  0x6f, 0x6a, 0xa3, 0xe0, 0xa3, 0xb0, 0x15, 0x3d, 0xfd, 0x69, 0x0c, 0x1c, 0xf0, 0xbe, 0x6b, 0x4c,
+  0xef, 0x0e, 0x0d, 0x33, 0x68, 0xf6, 0x61, 0x6d, 0x7b, 0x4a, 0x38, 0x08, 0x81, 0x3d, 0x21, 0xdb,
+  0x93, 0x32, 0x86, 0x84, 0xb5, 0x9d, 0x69, 0xa5, 0xc0, 0xc2, 0xff, 0x07, 0xaa, 0x73, 0x56, 0x22,
+  0x6b, 0x1d, 0x00, 0x00,
+};
+
+// log.html: 3427 bytes, 1458 as sent
+static const uint8_t webAsset_log_html[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57, 0x6b, 0x6f, 0xdb, 0x36,
+  0x14, 0xfd, 0x9e, 0x5f, 0xc1, 0xa9, 0x05, 0x2c, 0xa3, 0x95, 0x2c, 0xbf, 0xdf, 0x1e, 0xda, 0x34,
+  0x45, 0x0b, 0xa4, 0x5d, 0xb7, 0x64, 0x18, 0xb6, 0x34, 0xdb, 0x68, 0x91, 0x92, 0xb8, 0x48, 0xa2,
+  0x40, 0xd1, 0x8f, 0x34, 0xcd, 0x7f, 0xdf, 0x25, 0x45, 0x59, 0x92, 0x9d, 0xa2, 0x28, 0x0c, 0xd8,
+  0xd4, 0xe5, 0x7d, 0x1c, 0x9e, 0xfb, 0xa0, 0xbc, 0xf8, 0xe9, 0xcd, 0x2f, 0xe7, 0xd7, 0x7f, 0x7e,
+  0xba, 0x40, 0x91, 0x4c, 0xe2, 0xd5, 0x42, 0x7f, 0x9f, 0x21, 0xb4, 0x88, 0x28, 0x26, 0x6a, 0x01,
+  0xcb, 0x84, 0x4a, 0x8c, 0x52, 0x9c, 0xd0, 0xa5, 0xb5, 0x65, 0x74, 0x97, 0x71, 0x21, 0x2d, 0xe4,
+  0xf3, 0x54, 0xd2, 0x54, 0x2e, 0xad, 0x1d, 0x23, 0x32, 0x5a, 0x12, 0xba, 0x65, 0x3e, 0x75, 0xf4,
+  0xc3, 0x4b, 0xc4, 0x52, 0x26, 0x19, 0x8e, 0x9d, 0xdc, 0xc7, 0x31, 0x5d, 0x76, 0x5d, 0xcf, 0x32,
+  0xae, 0x24, 0x93, 0x31, 0x5d, 0xfd, 0xfa, 0x81, 0xa5, 0x54, 0x2c, 0x3a, 0xc5, 0x53, 0xb1, 0x13,
+  0xb3, 0xf4, 0x0e, 0x09, 0x1a, 0x2f, 0xad, 0x5c, 0xde, 0xc7, 0x34, 0x8f, 0x28, 0x85, 0x28, 0x91,
+  0xa0, 0xc1, 0xd2, 0xea, 0x68, 0x91, 0xeb, 0xe7, 0xf9, 0xcf, 0xdb, 0xa5, 0xd7, 0x5f, 0x4f, 0xd7,
+  0x01, 0xe9, 0x0d, 0xe9, 0x74, 0x30, 0x99, 0x0e, 0x46, 0xd6, 0x89, 0x03, 0x06, 0xd8, 0x2c, 0x24,
+  0xef, 0x33, 0x00, 0xcc, 0x12, 0x1c, 0xd2, 0x4e, 0x96, 0x86, 0x16, 0xca, 0xd9, 0x17, 0x9a, 0x2f,
+  0xad, 0x7e, 0x6f, 0xdf, 0xef, 0x1d, 0x3c, 0x07, 0x78, 0xab, 0xd4, 0x5d, 0xd0, 0x00, 0xdf, 0xb8,
+  0x3f, 0x1e, 0x0d, 0xc6, 0x93, 0x29, 0x99, 0x0e, 0x7b, 0xa4, 0x3b, 0xa0, 0xa5, 0xef, 0xdc, 0x17,
+  0x2c, 0x93, 0x28, 0x17, 0x3e, 0x98, 0xf8, 0x3c, 0x49, 0xc0, 0xe2, 0x3f, 0x0d, 0x66, 0x40, 0xc7,
+  0x03, 0x32, 0xed, 0x8d, 0xba, 0xa3, 0xe1, 0x60, 0x10, 0x74, 0x2d, 0x44, 0x68, 0x40, 0xc5, 0x6a,
+  0xd1, 0x29, 0x4c, 0x34, 0x95, 0x9d, 0x82, 0xcb, 0xc5, 0x9a, 0x93, 0x7b, 0x2d, 0x30, 0x7b, 0x84,
+  0xfb, 0x9b, 0x04, 0x38, 0x74, 0xd5, 0x86, 0xeb, 0xc7, 0x38, 0xcf, 0x3f, 0x02, 0xcb, 0x68, 0x89,
+  0x62, 0x0e, 0xc4, 0x5d, 0x49, 0x2e, 0x00, 0xbc, 0x1b, 0x52, 0xf9, 0x5e, 0xd2, 0xc4, 0x6e, 0xc9,
+  0x88, 0x26, 0xb4, 0xd5, 0x46, 0x5f, 0xbf, 0xa2, 0x56, 0x6b, 0xde, 0x08, 0x41, 0xd8, 0x16, 0x69,
+  0x07, 0x4b, 0xcb, 0x2f, 0x41, 0xd7, 0x64, 0x82, 0xef, 0x14, 0x35, 0x66, 0xa7, 0xb9, 0xd7, 0xed,
+  0x41, 0x2e, 0xab, 0x2d, 0xd8, 0xc4, 0x25, 0x39, 0xd6, 0x6a, 0xc1, 0x92, 0xd0, 0x1c, 0x3b, 0xe6,
+  0x21, 0x37, 0x34, 0x8d, 0xbb, 0x41, 0x30, 0x9d, 0x8e, 0xbc, 0xf1, 0x38, 0x58, 0xaf, 0xa7, 0x63,
+  0x0c, 0x7a, 0x1d, 0x7c, 0xf0, 0xdd, 0x01, 0xe7, 0x8d, 0x40, 0x8c, 0x2c, 0x2d, 0xb0, 0x7e, 0xaf,
+  0xd3, 0x62, 0xa2, 0x9a, 0x67, 0x94, 0xf2, 0x3c, 0xe2, 0x3b, 0x70, 0x70, 0x08, 0x0a, 0x3b, 0xaa,
+  0xca, 0xa8, 0x30, 0xd1, 0x8b, 0xfa, 0xb2, 0x06, 0x13, 0xab, 0x02, 0xf2, 0x4f, 0x2d, 0x67, 0x5e,
+  0xd0, 0x1f, 0xfa, 0xfd, 0xc9, 0xa8, 0xef, 0x93, 0x7e, 0x7f, 0x82, 0xbd, 0x02, 0xcc, 0x29, 0x0a,
+  0x13, 0x38, 0xa4, 0x58, 0xd4, 0xc3, 0x81, 0xa3, 0x80, 0x85, 0xdf, 0x8a, 0xa5, 0xb4, 0x73, 0x13,
+  0x68, 0xb4, 0x1e, 0x4f, 0xba, 0x9e, 0xef, 0xe3, 0xfe, 0x88, 0xf4, 0xa0, 0x44, 0x4e, 0x02, 0xd5,
+  0x97, 0x4d, 0xf2, 0x41, 0x35, 0x12, 0x95, 0x6a, 0xb5, 0xd0, 0x85, 0xbd, 0x3a, 0xd3, 0x36, 0xae,
+  0x6a, 0x29, 0xac, 0x3a, 0x03, 0x3d, 0x18, 0xe0, 0x90, 0x18, 0x2e, 0x66, 0xe8, 0x19, 0x19, 0xa8,
+  0xcf, 0xdc, 0x48, 0x03, 0xd0, 0x73, 0x02, 0x9c, 0xb0, 0xf8, 0x7e, 0x86, 0x5a, 0xe7, 0x7c, 0x23,
+  0x18, 0xd8, 0x7c, 0xa4, 0xbb, 0xd6, 0x4b, 0x04, 0x95, 0xc9, 0xf3, 0x0c, 0xfb, 0xb4, 0x54, 0x5e,
+  0x63, 0xff, 0x2e, 0x14, 0x7c, 0x93, 0x12, 0xa7, 0xf4, 0xd6, 0xa5, 0xea, 0x53, 0x2a, 0xe8, 0x33,
+  0xcf, 0xd0, 0x64, 0xb8, 0xdd, 0x95, 0xa2, 0x04, 0xef, 0x1d, 0x23, 0x1e, 0x0e, 0x69, 0xa2, 0xa5,
+  0x8f, 0x06, 0x64, 0x2e, 0xb1, 0xdc, 0xe4, 0x07, 0x84, 0x09, 0x16, 0x21, 0x4b, 0x9d, 0x35, 0x97,
+  0x92, 0x27, 0x33, 0xd4, 0xf5, 0xb2, 0xfd, 0xfc, 0x08, 0x7c, 0x10, 0x78, 0xf3, 0x86, 0x0b, 0x48,
+  0xa0, 0x73, 0x7a, 0xd6, 0x0a, 0x28, 0xd8, 0x78, 0x9e, 0x77, 0xec, 0xc6, 0x0b, 0x0e, 0xa2, 0x35,
+  0x17, 0x84, 0x82, 0xac, 0x97, 0xed, 0x51, 0xce, 0x63, 0x46, 0xd0, 0xb3, 0xe1, 0x70, 0x58, 0xee,
+  0x66, 0x98, 0x10, 0x96, 0x86, 0x4d, 0x30, 0x9a, 0x33, 0x35, 0x01, 0x40, 0x3c, 0xa8, 0xc4, 0x7c,
+  0x4b, 0x45, 0x10, 0xf3, 0x9d, 0xb3, 0x9f, 0x21, 0x68, 0x27, 0x1e, 0xc7, 0xe5, 0x4e, 0x44, 0x59,
+  0x18, 0xc9, 0x19, 0x1a, 0x0f, 0xb6, 0x51, 0x9d, 0x97, 0x53, 0xb9, 0x39, 0xd6, 0x7a, 0x03, 0x14,
+  0xa4, 0xc7, 0xc4, 0x48, 0x9e, 0x35, 0x81, 0x1c, 0xd0, 0x4d, 0x00, 0x7c, 0x77, 0x58, 0x6d, 0x3c,
+  0x91, 0x28, 0xcf, 0x1b, 0xaf, 0x83, 0xe0, 0x94, 0xcf, 0xe0, 0x98, 0x88, 0x94, 0xa7, 0x87, 0x7c,
+  0xfa, 0x1b, 0x91, 0x2b, 0xbd, 0x8c, 0x33, 0x98, 0xd0, 0xe2, 0x09, 0x8c, 0xb3, 0x48, 0x1d, 0xfb,
+  0x09, 0xe2, 0x6b, 0x81, 0x87, 0xa3, 0x75, 0xbf, 0x34, 0x55, 0x05, 0x5b, 0x16, 0xea, 0xd1, 0xa4,
+  0x39, 0xa9, 0xf3, 0xe3, 0x61, 0x54, 0xa6, 0xf9, 0x89, 0xa1, 0x54, 0x54, 0x92, 0xa5, 0xc7, 0x83,
+  0x59, 0xaf, 0xce, 0x79, 0x9a, 0x52, 0x5f, 0x02, 0x41, 0xae, 0xeb, 0x7e, 0xa3, 0x9f, 0x1a, 0xe5,
+  0x63, 0x95, 0xd3, 0xc5, 0x6a, 0x74, 0xa2, 0x49, 0x06, 0x4f, 0xfd, 0x98, 0xf9, 0x77, 0x80, 0x23,
+  0x86, 0x46, 0xbe, 0xe4, 0xa1, 0xdd, 0x86, 0x18, 0x6a, 0x8d, 0xe0, 0x61, 0xd1, 0x29, 0xd4, 0x6a,
+  0x2d, 0x59, 0xfc, 0x98, 0x87, 0xb3, 0x45, 0x35, 0x61, 0x21, 0x60, 0x2e, 0x61, 0x2e, 0x87, 0xaf,
+  0xf9, 0x1e, 0x06, 0xf4, 0x61, 0x74, 0xc3, 0x70, 0xbe, 0x88, 0xa9, 0x5a, 0xbe, 0xbe, 0x7f, 0x4f,
+  0xec, 0x16, 0x68, 0xb4, 0xda, 0xf3, 0x83, 0x41, 0x71, 0xae, 0xef, 0xd8, 0x14, 0x4a, 0xca, 0xac,
+  0xb2, 0xe3, 0xfe, 0x1d, 0x95, 0x60, 0x94, 0xd2, 0x1d, 0xfa, 0x83, 0xae, 0xaf, 0xf4, 0xb3, 0xdd,
+  0xda, 0xe5, 0xb3, 0x4e, 0xa7, 0x85, 0x5e, 0x40, 0xd7, 0xa6, 0x84, 0xef, 0x5c, 0x75, 0x51, 0x48,
+  0x06, 0xb3, 0x30, 0xe2, 0xb9, 0x54, 0x57, 0x34, 0x6c, 0xb5, 0x66, 0x93, 0xae, 0x71, 0x56, 0xb8,
+  0x71, 0x61, 0x26, 0x64, 0x34, 0x05, 0x6f, 0x76, 0x1b, 0x2d, 0x57, 0x26, 0xf1, 0x07, 0x68, 0xae,
+  0xa4, 0x7b, 0x79, 0x5e, 0x5c, 0xe7, 0xa0, 0xd3, 0x32, 0x39, 0xa0, 0x04, 0x49, 0xae, 0x68, 0x42,
+  0x57, 0x54, 0x40, 0xbd, 0xb4, 0xe6, 0x47, 0x66, 0xe6, 0x52, 0x56, 0x25, 0xa3, 0xcc, 0x54, 0x83,
+  0x6a, 0x9d, 0xc7, 0x66, 0xe8, 0x84, 0xe6, 0x39, 0x5c, 0x63, 0x2a, 0x3a, 0xdd, 0x42, 0x88, 0x1a,
+  0x84, 0xe2, 0xac, 0x49, 0x1e, 0xc2, 0xa6, 0xde, 0x73, 0x09, 0x96, 0x78, 0x5e, 0xdb, 0x93, 0x0c,
+  0xcc, 0x25, 0x4e, 0x32, 0x43, 0xc5, 0x1b, 0x2c, 0xa9, 0xdd, 0x76, 0x25, 0xbf, 0x54, 0x37, 0x24,
+  0xbd, 0x86, 0xed, 0x2b, 0x29, 0xa0, 0x5c, 0xec, 0x76, 0x61, 0xa6, 0xbf, 0x3a, 0x1d, 0xf4, 0x09,
+  0xe6, 0x36, 0x2d, 0x5a, 0x06, 0x65, 0x30, 0xe9, 0xd9, 0x1e, 0xb1, 0x40, 0xad, 0x72, 0x08, 0x53,
+  0x0b, 0xa0, 0x35, 0x3e, 0x61, 0x09, 0x9d, 0xa2, 0x08, 0xea, 0xfc, 0xfd, 0xf9, 0xc6, 0x7e, 0x76,
+  0xe3, 0x39, 0xd3, 0x57, 0xce, 0x5b, 0xec, 0x04, 0xb7, 0x0f, 0xa3, 0xc7, 0xaf, 0x37, 0xd8, 0xf9,
+  0xf2, 0xca, 0xf9, 0xeb, 0xf6, 0x45, 0xfb, 0xf3, 0x6d, 0xa7, 0x8e, 0x2e, 0xc1, 0xd2, 0x8f, 0xc0,
+  0x0a, 0x4e, 0xe0, 0xea, 0xb5, 0x5d, 0x77, 0x57, 0xa4, 0x00, 0xa1, 0x98, 0x9a, 0x30, 0x15, 0x4b,
+  0x1a, 0xe2, 0x1b, 0x1a, 0xe0, 0x4d, 0x2c, 0x51, 0x28, 0x28, 0x4d, 0x0f, 0x9a, 0x15, 0x5d, 0xe0,
+  0xd5, 0x78, 0x00, 0xe4, 0xb6, 0xf6, 0xdf, 0x6e, 0xde, 0x0c, 0x4a, 0x49, 0x89, 0x6f, 0xba, 0xb7,
+  0x73, 0x73, 0xee, 0x8b, 0xbd, 0x14, 0xd8, 0x2f, 0x03, 0x06, 0x82, 0x27, 0xe6, 0xf8, 0xe5, 0x58,
+  0xaa, 0xbb, 0x77, 0x05, 0xcd, 0x62, 0xb8, 0x2b, 0x1a, 0xb0, 0x5f, 0xc2, 0xcb, 0x05, 0x30, 0x2c,
+  0x58, 0x02, 0x9c, 0x6a, 0x9f, 0xbf, 0xd1, 0x04, 0x06, 0x46, 0x83, 0xcc, 0xfa, 0x50, 0x01, 0x8d,
+  0x57, 0x04, 0x8a, 0x25, 0xa2, 0x07, 0xef, 0x3b, 0x26, 0x23, 0x2d, 0xd0, 0x36, 0x35, 0xc6, 0xa0,
+  0x3d, 0x2e, 0x52, 0x29, 0xee, 0xeb, 0xed, 0xe0, 0x0b, 0x0a, 0x59, 0x35, 0x1d, 0x61, 0xb7, 0xa0,
+  0xf5, 0x5a, 0x26, 0x99, 0xa5, 0xf6, 0x51, 0xa9, 0xe9, 0xdf, 0x23, 0x8d, 0x66, 0x0d, 0xff, 0x7b,
+  0xf3, 0xfc, 0xe1, 0x50, 0x3a, 0x8f, 0xb7, 0xe8, 0xf9, 0x83, 0x41, 0xf6, 0xf8, 0x6f, 0xad, 0x4c,
+  0x0a, 0x48, 0x84, 0x5f, 0xe9, 0xc1, 0x0f, 0x66, 0x1f, 0xb0, 0x8c, 0x5c, 0xbc, 0xce, 0xed, 0xa2,
+  0xcf, 0xdd, 0xe2, 0x46, 0x78, 0xa7, 0x27, 0x3e, 0x72, 0x50, 0x43, 0x7a, 0xcd, 0xb3, 0x4a, 0x04,
+  0x53, 0x06, 0x02, 0x17, 0x8a, 0x6d, 0xb4, 0x40, 0x7d, 0x75, 0x7d, 0x95, 0x00, 0x95, 0x02, 0xce,
+  0xa0, 0x01, 0xc9, 0x79, 0xc4, 0x62, 0x62, 0x97, 0x98, 0xcb, 0xfa, 0x50, 0xfc, 0x6d, 0x24, 0x77,
+  0x0a, 0xbf, 0xaa, 0xe9, 0x8a, 0xdb, 0xd4, 0xa4, 0xde, 0xae, 0x10, 0x56, 0xe9, 0x3f, 0x81, 0xb2,
+  0x44, 0x4f, 0x60, 0xae, 0x06, 0xb8, 0x3e, 0xf1, 0x51, 0x63, 0x52, 0x21, 0x34, 0x9d, 0xb6, 0x5e,
+  0xfc, 0xc0, 0x64, 0x80, 0x79, 0x83, 0x2e, 0x94, 0xcd, 0x77, 0x47, 0x42, 0xe0, 0x3d, 0x39, 0x12,
+  0xfc, 0x98, 0xe7, 0xf4, 0x07, 0xc7, 0x91, 0x0a, 0x7a, 0xae, 0xec, 0xc8, 0xf7, 0xa3, 0x36, 0x06,
+  0x51, 0xb0, 0x49, 0x0b, 0xeb, 0x0c, 0xf2, 0x7f, 0xc9, 0x31, 0x79, 0x6b, 0x04, 0x76, 0x49, 0x67,
+  0x0c, 0xc2, 0xdf, 0x59, 0x31, 0x41, 0x1e, 0x1b, 0x26, 0xd5, 0xb5, 0x71, 0x50, 0xd5, 0x24, 0x33,
+  0x80, 0x24, 0xde, 0x5d, 0x7f, 0xb8, 0x54, 0xf1, 0x8a, 0x58, 0x67, 0xd5, 0xfb, 0x38, 0xdc, 0x2b,
+  0xea, 0x4d, 0x1f, 0xde, 0xfb, 0xf5, 0x9f, 0xa9, 0xff, 0x01, 0xcc, 0x03, 0x21, 0x9c, 0x63, 0x0d,
+  0x00, 0x00,
+};
+
+// status.html: 3087 bytes, 1240 as sent
+static const uint8_t webAsset_status_html[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x56, 0xdb, 0x6e, 0xdb, 0x38,
+  0x10, 0x7d, 0xcf, 0x57, 0xb0, 0x7a, 0x91, 0x8d, 0x4d, 0x24, 0xdf, 0xe2, 0x4b, 0x6c, 0xb9, 0x68,
+  0xd3, 0x06, 0x49, 0xd0, 0xa4, 0x5d, 0x24, 0xc5, 0xa2, 0x4f, 0x0b, 0x4a, 0x1c, 0x59, 0xdc, 0x48,
+  0xa2, 0x57, 0xa4, 0xec, 0x7a, 0xdb, 0xfc, 0xfb, 0x0e, 0x29, 0xd9, 0xba, 0x24, 0xce, 0x8b, 0x20,
+  0xce, 0xe5, 0xcc, 0x70, 0xe6, 0x0c, 0xc9, 0xc5, 0xbb, 0x4f, 0x5f, 0x2f, 0x1f, 0x7f, 0x7c, 0xfb,
+  0x4c, 0x22, 0x95, 0xc4, 0xcb, 0x85, 0xf9, 0x9e, 0x10, 0xb2, 0x88, 0x80, 0x32, 0xfd, 0x83, 0xbf,
+  0x09, 0x28, 0x4a, 0x52, 0x9a, 0x80, 0x67, 0x6d, 0x38, 0x6c, 0xd7, 0x22, 0x53, 0x16, 0x09, 0x44,
+  0xaa, 0x20, 0x55, 0x9e, 0xb5, 0xe5, 0x4c, 0x45, 0x1e, 0x83, 0x0d, 0x0f, 0xe0, 0xcc, 0x2c, 0x4e,
+  0x09, 0x4f, 0xb9, 0xe2, 0x34, 0x3e, 0x93, 0x01, 0x8d, 0xc1, 0xeb, 0x3b, 0x3d, 0xab, 0x84, 0x52,
+  0x5c, 0xc5, 0xb0, 0xfc, 0xf3, 0x8e, 0xa7, 0x90, 0x2d, 0xdc, 0x62, 0x55, 0x68, 0x62, 0x9e, 0x3e,
+  0x91, 0x0c, 0x62, 0xcf, 0x92, 0x6a, 0x17, 0x83, 0x8c, 0x00, 0x30, 0x4a, 0x94, 0x41, 0xe8, 0x59,
+  0xae, 0x11, 0x39, 0x81, 0x94, 0xef, 0x37, 0x5e, 0x6f, 0xe8, 0xcf, 0xfc, 0x90, 0x0d, 0xce, 0x61,
+  0x36, 0x9a, 0xce, 0x46, 0x63, 0xeb, 0x05, 0x00, 0xc7, 0xdc, 0x2c, 0xa2, 0x76, 0x6b, 0x4c, 0x98,
+  0x27, 0x74, 0x05, 0xee, 0x3a, 0x5d, 0x59, 0x44, 0xf2, 0xff, 0x40, 0x7a, 0xd6, 0x70, 0xf0, 0x73,
+  0x38, 0x38, 0x20, 0x87, 0x74, 0xa3, 0xcd, 0x1d, 0xb4, 0x40, 0x6c, 0x3a, 0x9c, 0x8c, 0x47, 0x93,
+  0xe9, 0x8c, 0xcd, 0xce, 0x07, 0xac, 0x3f, 0x82, 0x3d, 0xb6, 0x0c, 0x32, 0xbe, 0x56, 0x44, 0x66,
+  0x01, 0xba, 0x04, 0x22, 0x49, 0xd0, 0xe3, 0x1f, 0x93, 0xcc, 0x08, 0x26, 0x23, 0x36, 0x1b, 0x8c,
+  0xfb, 0xe3, 0xf3, 0xd1, 0x28, 0xec, 0x5b, 0x84, 0x41, 0x08, 0xd9, 0x72, 0xe1, 0x16, 0x2e, 0xa6,
+  0x94, 0x6e, 0x51, 0xcb, 0x85, 0x2f, 0xd8, 0xce, 0x08, 0x4a, 0x1d, 0x13, 0x41, 0x9e, 0x60, 0x0d,
+  0x1d, 0xad, 0x70, 0x82, 0x98, 0x4a, 0x79, 0x8f, 0x55, 0x26, 0x1e, 0x89, 0x05, 0x16, 0xee, 0x41,
+  0x89, 0x0c, 0x93, 0x77, 0x56, 0xa0, 0x6e, 0x14, 0x24, 0x1d, 0x5b, 0x45, 0x90, 0x80, 0xdd, 0x25,
+  0xbf, 0x7f, 0x13, 0xdb, 0x9e, 0x37, 0x42, 0x30, 0xbe, 0x21, 0x06, 0xc0, 0xb3, 0x82, 0x7d, 0xd2,
+  0x35, 0x59, 0x26, 0xb6, 0xba, 0x34, 0xa5, 0xa6, 0xa9, 0xeb, 0x0f, 0xb0, 0x97, 0x95, 0x0a, 0x95,
+  0x74, 0x5f, 0x1c, 0x6b, 0xb9, 0xe0, 0xc9, 0xaa, 0xdc, 0x76, 0x2c, 0x56, 0xa2, 0x2c, 0xd3, 0xa4,
+  0x1f, 0x86, 0xb3, 0xd9, 0xb8, 0x37, 0x99, 0x84, 0xbe, 0x3f, 0x9b, 0x50, 0xb4, 0x73, 0xe9, 0x01,
+  0xdb, 0x45, 0xf0, 0x46, 0x20, 0xce, 0x3c, 0x0b, 0xbd, 0x6f, 0x4c, 0x5b, 0xca, 0xa8, 0xe5, 0x9a,
+  0xa4, 0x42, 0x46, 0x62, 0x8b, 0x00, 0x87, 0xa0, 0xa8, 0xd1, 0x2c, 0x83, 0xac, 0x8c, 0x5e, 0xf0,
+  0xcb, 0x1a, 0x4d, 0xad, 0x2a, 0x91, 0xbf, 0x6b, 0x3d, 0xeb, 0x85, 0xc3, 0xf3, 0x60, 0x38, 0x1d,
+  0x0f, 0x03, 0x36, 0x1c, 0x4e, 0x69, 0xaf, 0x48, 0xe6, 0x65, 0x16, 0x65, 0xe0, 0x15, 0xd0, 0xac,
+  0x1e, 0x0e, 0x81, 0x42, 0xbe, 0x3a, 0x16, 0x4b, 0x5b, 0xcb, 0x32, 0xd0, 0xd8, 0x9f, 0x4c, 0xfb,
+  0xbd, 0x20, 0xa0, 0xc3, 0x31, 0x1b, 0x20, 0x45, 0x5e, 0x04, 0xaa, 0xff, 0x36, 0x8b, 0x8f, 0xa6,
+  0x51, 0x56, 0x99, 0x96, 0x3f, 0x2f, 0xbb, 0xb6, 0x50, 0xd4, 0x8f, 0x61, 0x2f, 0xdb, 0x9e, 0xf5,
+  0x7b, 0xbd, 0x52, 0x7e, 0xe0, 0x8e, 0x42, 0x1c, 0xc5, 0x96, 0x38, 0x41, 0x3c, 0x5d, 0xe1, 0x08,
+  0x31, 0xbd, 0x34, 0x25, 0x4e, 0x8c, 0x48, 0x67, 0xa5, 0x85, 0x2e, 0x1a, 0xd6, 0xec, 0x3f, 0x22,
+  0xa5, 0x9e, 0xc8, 0x35, 0xf0, 0x55, 0xa4, 0x1a, 0x5e, 0xbe, 0x56, 0x14, 0xf2, 0x23, 0xae, 0x97,
+  0x79, 0x96, 0x21, 0x4b, 0xc9, 0x35, 0x95, 0x51, 0x46, 0x15, 0x34, 0xdc, 0xa3, 0xb5, 0x3c, 0xe2,
+  0xf6, 0x28, 0x14, 0x8d, 0x8d, 0x13, 0xc8, 0x86, 0x8b, 0xd2, 0x8a, 0x42, 0x7e, 0x2c, 0x59, 0x90,
+  0x8a, 0x7c, 0xe2, 0x61, 0xc8, 0x83, 0x3c, 0x56, 0xbb, 0x66, 0xbe, 0xa8, 0xab, 0x54, 0x6f, 0xc6,
+  0xfe, 0x26, 0x44, 0x4c, 0x6e, 0x85, 0xff, 0x4a, 0x78, 0x2d, 0x3d, 0xe2, 0x6b, 0xbc, 0x1e, 0x69,
+  0x86, 0x63, 0x27, 0xc9, 0x1d, 0x34, 0xab, 0xb5, 0x46, 0xe5, 0x43, 0xee, 0x27, 0x5c, 0x4a, 0x2e,
+  0xd2, 0x63, 0x10, 0xc3, 0xc1, 0x99, 0xcf, 0xd5, 0x51, 0x10, 0x53, 0x72, 0x89, 0x87, 0xd0, 0x1b,
+  0x09, 0x1c, 0xd9, 0xbd, 0x8e, 0xaf, 0x55, 0x6f, 0x75, 0x59, 0x92, 0x2b, 0x91, 0xa7, 0xac, 0xe1,
+  0xb7, 0xa1, 0x31, 0x67, 0x85, 0xf6, 0x8d, 0xa8, 0x0d, 0x97, 0xa0, 0x68, 0xbb, 0x96, 0x1f, 0x71,
+  0xb9, 0xfb, 0x70, 0x49, 0x3e, 0x30, 0x96, 0x81, 0x6c, 0x56, 0x38, 0xa1, 0x41, 0x29, 0x6e, 0x3b,
+  0xba, 0x86, 0xdf, 0xc8, 0xfc, 0x72, 0x00, 0xf6, 0x27, 0xd8, 0x86, 0x66, 0x24, 0x5f, 0x33, 0x24,
+  0xd7, 0x55, 0x06, 0xff, 0xe2, 0x01, 0x88, 0xc4, 0xef, 0xf5, 0xe6, 0x46, 0xbe, 0x16, 0x71, 0xfc,
+  0xc8, 0x13, 0xc8, 0x50, 0x9c, 0xe6, 0x71, 0x3c, 0x3f, 0x09, 0xf3, 0x34, 0x50, 0x58, 0x7e, 0x22,
+  0x41, 0x5d, 0x71, 0x88, 0x59, 0x87, 0xb3, 0x53, 0xb2, 0xe9, 0x92, 0x5f, 0x18, 0x83, 0x87, 0x1d,
+  0xb2, 0x21, 0xef, 0x3c, 0x8f, 0x60, 0x0d, 0x20, 0xc4, 0x8b, 0x86, 0x91, 0x2e, 0x39, 0x1c, 0xb5,
+  0xd8, 0x90, 0xcf, 0x31, 0xe8, 0xdf, 0x8f, 0xbb, 0x1b, 0xed, 0xd8, 0x75, 0x78, 0x8a, 0x97, 0xd1,
+  0xf5, 0xe3, 0xdd, 0x17, 0x0c, 0xb0, 0x99, 0x9f, 0x3c, 0xd7, 0xf0, 0xf1, 0x68, 0x7a, 0x50, 0x54,
+  0xe5, 0xb2, 0xc3, 0x2b, 0x74, 0xee, 0x14, 0x93, 0xf6, 0x22, 0xc8, 0x21, 0x1d, 0xbb, 0x30, 0xb0,
+  0x4f, 0x2b, 0xdb, 0xf7, 0xc4, 0xfe, 0x01, 0xd2, 0x26, 0x17, 0xc4, 0xbe, 0x17, 0x76, 0x77, 0x7e,
+  0xc0, 0xc2, 0x01, 0x7a, 0x03, 0x08, 0xb5, 0x06, 0x45, 0x5b, 0xfd, 0x41, 0x6c, 0xf2, 0x74, 0xed,
+  0xca, 0xc2, 0xbb, 0xb2, 0xa9, 0xcd, 0x93, 0xb1, 0xad, 0xad, 0x5b, 0x96, 0xcd, 0xd9, 0x31, 0xc6,
+  0x4d, 0xd1, 0x6b, 0xc8, 0x7a, 0x54, 0x2a, 0x5c, 0xbd, 0x6a, 0xa3, 0x96, 0x74, 0x2e, 0xf0, 0xca,
+  0x45, 0xcb, 0xa6, 0x35, 0x37, 0xc6, 0xb4, 0x25, 0x6b, 0x79, 0xd4, 0x18, 0x6b, 0xac, 0x6b, 0xeb,
+  0xd7, 0xe2, 0x17, 0x27, 0x58, 0x95, 0x42, 0xb1, 0x6e, 0x59, 0x56, 0xc4, 0x2c, 0x5a, 0x43, 0x83,
+  0x57, 0xd2, 0xd4, 0xd5, 0x38, 0xe4, 0x77, 0xb4, 0x34, 0xb5, 0xe9, 0x38, 0x18, 0x5f, 0x0b, 0xa9,
+  0x23, 0xd6, 0x08, 0xc4, 0xc4, 0x77, 0xc3, 0xea, 0x8e, 0x61, 0x4f, 0x08, 0x2a, 0x88, 0x3a, 0x36,
+  0xbe, 0x66, 0x34, 0xa5, 0x6e, 0xa5, 0x48, 0xed, 0xae, 0x83, 0x97, 0x7a, 0xda, 0xe1, 0xde, 0x92,
+  0xe3, 0x83, 0x42, 0xa4, 0x9d, 0x6e, 0x29, 0xa9, 0xa8, 0xa7, 0x03, 0xd7, 0x67, 0x00, 0x73, 0xd0,
+  0xbf, 0x22, 0x57, 0x9d, 0x3d, 0xfc, 0x69, 0x6d, 0x78, 0x9a, 0x09, 0xe0, 0xed, 0x96, 0x42, 0xa0,
+  0x4a, 0x12, 0x17, 0x1c, 0xd6, 0x43, 0xb5, 0x95, 0x7a, 0x9a, 0x60, 0x4b, 0xfe, 0x02, 0xff, 0x01,
+  0xcb, 0x05, 0xaa, 0x63, 0x6f, 0xe5, 0x85, 0xeb, 0xda, 0x48, 0xb3, 0x2d, 0x4f, 0x99, 0xd8, 0x3a,
+  0xfa, 0x11, 0xa2, 0x41, 0x9c, 0x08, 0xf7, 0xa5, 0x9f, 0x7f, 0x9a, 0x81, 0x17, 0xd3, 0x7e, 0xc1,
+  0xbf, 0xad, 0x74, 0x44, 0x2a, 0xd6, 0x90, 0x22, 0x10, 0x02, 0x7b, 0x4b, 0x83, 0x4d, 0xf0, 0xee,
+  0xc2, 0x2b, 0x73, 0x9f, 0xe0, 0x21, 0x6f, 0xe3, 0x42, 0x5e, 0x99, 0x65, 0x2d, 0x45, 0x28, 0x09,
+  0x29, 0x16, 0x35, 0x4f, 0x65, 0xee, 0xeb, 0x33, 0xc1, 0x07, 0x7c, 0x02, 0xad, 0xec, 0x6e, 0x4b,
+  0x5f, 0x69, 0x8b, 0x12, 0x16, 0x06, 0xcf, 0x87, 0x74, 0x12, 0xec, 0x2c, 0xbe, 0x98, 0x74, 0x46,
+  0x50, 0x4b, 0x49, 0x65, 0x3b, 0xf2, 0xcb, 0x6c, 0x3b, 0x41, 0xd5, 0xed, 0xc3, 0xd7, 0x7b, 0x67,
+  0x8d, 0xd7, 0x3a, 0x74, 0xc0, 0xc1, 0xaa, 0xd1, 0xee, 0xdc, 0x8c, 0x62, 0xe2, 0x14, 0xa0, 0x7a,
+  0xfe, 0xaa, 0xb9, 0xdf, 0x4b, 0xd1, 0xe8, 0x99, 0x60, 0x3d, 0xb0, 0x81, 0x3f, 0xb1, 0x8c, 0xcf,
+  0x8d, 0xb8, 0x41, 0x2c, 0x24, 0xb4, 0xea, 0xa0, 0x21, 0xdf, 0xd5, 0x36, 0xdc, 0xad, 0x91, 0xa1,
+  0xd8, 0x56, 0xad, 0x91, 0x8d, 0x36, 0xb5, 0xba, 0x69, 0x02, 0xd5, 0x5a, 0xba, 0xc6, 0x1d, 0x7e,
+  0x11, 0x94, 0x5d, 0x95, 0x82, 0xb2, 0xab, 0x31, 0x8a, 0xbe, 0xf3, 0x02, 0xbb, 0x19, 0xa9, 0xc5,
+  0x01, 0x0d, 0x56, 0xbd, 0x1d, 0x17, 0xae, 0x79, 0x59, 0xe0, 0x1b, 0xd5, 0x3c, 0xfc, 0xff, 0x07,
+  0xc2, 0xa4, 0x67, 0x4f, 0x0f, 0x0c, 0x00, 0x00,
+};
+
+const WebAsset webAssets[WEB_ASSET_COUNT] = {
+  { "/common.js", "application/javascript", webAsset_common_js, 511, true, false, "\"04e74d92616544f1\"" },
+  { "/config.js", "application/javascript", webAsset_config_js, 7893, true, false, "\"62ca07a9a682c728\"" },
+  { "/favicon.png", "image/png", webAsset_favicon_png, 1057, false, false, "\"a3764789d952d14e\"" },
+  { "/gears.png", "image/png", webAsset_gears_png, 5430, false, false, "\"6b7810cca36d29d9\"" },
+  { "/log_icon.png", "image/png", webAsset_log_icon_png, 1520, false, false, "\"0f35c3863cd338a0\"" },
+  { "/logo.png", "image/png", webAsset_logo_png, 24842, false, false, "\"71ff996077fbb97a\"" },
+  { "/style.css", "text/css", webAsset_style_css, 2148, true, false, "\"03b9bfd25e948946\"" },
+  { "/log.html", "text/html; charset=utf-8", webAsset_log_html, 1458, true, true, "\"812c249b3dc22207\"" },
+  { "/status.html", "text/html; charset=utf-8", webAsset_status_html, 1240, true, true, "\"5ff45cfc828d9cdf\"" },
+};
+
+const WebAsset* findWebAsset(const char* path) {
+  for( int i = 0; i < WEB_ASSET_COUNT; i++ ) {
+    if( strcmp(webAssets[i].path, path) == 0 ) {
+      return &webAssets[i];
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,33 @@
+// Generated by tools/build_web_assets.py from web/. Do not edit.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+typedef struct {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;
+  uint32_t length;
+  bool gzipped;
+  bool page;           // Served at a fixed URL, so revalidated rather than cached
+  const char* etag;    // Quoted, ready for the header
+} WebAsset;
+
+#define WEB_URL_COMMON_JS "/common.js?v=04e74d92616544f1"
+#define WEB_URL_CONFIG_JS "/config.js?v=62ca07a9a682c728"
+#define WEB_URL_FAVICON_PNG "/favicon.png?v=a3764789d952d14e"
+#define WEB_URL_GEARS_PNG "/gears.png?v=6b7810cca36d29d9"
+#define WEB_URL_LOG_ICON_PNG "/log_icon.png?v=0f35c3863cd338a0"
+#define WEB_URL_LOGO_PNG "/logo.png?v=71ff996077fbb97a"
+#define WEB_URL_STYLE_CSS "/style.css?v=03b9bfd25e948946"
+#define WEB_URL_LOG_HTML "/log.html?v=812c249b3dc22207"
+#define WEB_URL_STATUS_HTML "/status.html?v=5ff45cfc828d9cdf"
+
+#define WEB_ASSET_COUNT 9
+
+extern const WebAsset webAssets[WEB_ASSET_COUNT];
+
+const WebAsset* findWebAsset(const char* path);
+
+#endif
@@ -0,0 +1,273 @@
+// Generated by tools/build_web_assets.py from web/*.tmpl. Do not edit.
+#include <Arduino.h>
+#include "defines_n_types.h"
+#include "web_templates.h"
+
+const TemplateOp configTemplate[] = {
+  { TEMPLATE_TEXT, 0, 65, 0, 0, "<div class=\"c\"><div class=\"row\"><b>Configuration</b></div></div> " },
+  { TEMPLATE_IF, 0, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 46, 0, 0, " <div class=\"c\"><div class=\"row message-area\">" },
+  { TEMPLATE_RAW, 0, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 13, 0, 0, "</div></div> " },
+  { TEMPLATE_END, 0, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 229, 0, 0, " <div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">User Settings</button><div class=\"p"
+      "anel\"><form id=\"frmUser\"><div class=\"row\"> Username <input class=\"card w-100 lower\" id=\"user\" type=\""
+      "text\" name=\"username\" value=\"" },
+  { TEMPLATE_HTML, 1, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 1008, 0, 0, "\" autocorrect=\"off\" autocapitalize=\"none\"></div><div class=\"row\" style=\"position:relative\"> Password"
+      " <input class=\"card w-100 capsWatch\" id=\"password\" type=\"password\" name=\"password\" placeholder=\"Neve"
+      "r shown\" data-caps-indicator=\"capsInd1\"><div id=\"capsInd1\" style=\"position:absolute;right:30px;top:-"
+      "6px;color:red;display:none\">Caps Lock</div></div><div class=\"row hint\"> Password must be between eig"
+      "ht and 32 characters long and contain at least one number, one lowercase character, one uppercase ch"
+      "aracter, and one special character. </div><div class=\"row\" style=\"position:relative\"> Confirm Passwo"
+      "rd <input class=\"card w-100 capsWatch\" id=\"confirmPassword\" type=\"password\" name=\"confirmPassword\" d"
+      "ata-caps-indicator=\"capsInd3\"><div id=\"capsInd3\" style=\"position:absolute;right:30px;top:-6px;color:"
+      "red;display:none\">Caps Lock</div></div><div class=\"row\"><input id=\"btnUserUpdate\" class=\"btn\" type=\""
+      "button\" value=\"Update User\"></div></form></div><!--End panel//--></div><!--End row//--></div><!--End"
+      " c//--> " },
+  { TEMPLATE_IF, 2, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 243, 0, 0, " <div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">Network Settings</button><div class"
+      "=\"panel\"><form id=\"frmNetwork\"><div class=\"row\"> WiFi SSID <div class=\"rel\"><input class=\"card w-100"
+      "\" id=\"ssid\" type=\"text\" name=\"ssid\" value=\"" },
+  { TEMPLATE_HTML, 3, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 699, 0, 0, "\" autocorrect=\"off\" autocapitalize=\"none\"><input type=\"button\" id=\"btnScanNetworks\" class=\"btn insid"
+      "e-button\" value=\"Scan\"></div></div><div class=\"row\" style=\"position:relative\"> WiFi Password <input "
+      "class=\"card w-100 capsWatch\" id=\"ssidPassword\" type=\"password\" name=\"ssidPassword\" autocomplete=\"off"
+      "\" placeholder=\"Never shown\" data-caps-indicator=\"capsInd2\"><div id=\"capsInd2\" style=\"position:absolu"
+      "te;right:30px;top:-6px;color:red;display:none\">Caps Lock</div><input type=\"checkbox\" id=\"showWifiPas"
+      "sword\">&nbsp;<span style=\"font-size:.8em;margin-left:5px;\">Show Password</span></div><div class=\"row"
+      "\"> Static IP Address <select class=\"card w-100\" name=\"staticIp\" id=\"staticIp\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 4, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 4, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 162, 0, 0, ">Yes</option></select></div><div id=\"staticNetworkInfo\"><div class=\"row\"> IP Address <input class=\"c"
+      "ard w-100\" id=\"ipAddress\" type=\"text\" name=\"ipAddress\" value=\"" },
+  { TEMPLATE_IP, 5, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 107, 0, 0, "\"></div><div class=\"row\"> Gateway <input class=\"card w-100\" id=\"gateway\" type=\"text\" name=\"gateway\" "
+      "value=\"" },
+  { TEMPLATE_IP, 6, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 104, 0, 0, "\"></div><div class=\"row\"> Subnet <input class=\"card w-100\" id=\"subnet\" type=\"text\" name=\"subnet\" val"
+      "ue=\"" },
+  { TEMPLATE_IP, 7, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 117, 0, 0, "\"></div><div class=\"row\"> Primary DNS <input class=\"card w-100\" id=\"primaryDNS\" type=\"text\" name=\"pr"
+      "imaryDNS\" value=\"" },
+  { TEMPLATE_IP, 8, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 123, 0, 0, "\"></div><div class=\"row\"> Secondary DNS <input class=\"card w-100\" id=\"secondaryDNS\" type=\"text\" name"
+      "=\"secondaryDNS\" value=\"" },
+  { TEMPLATE_IP, 9, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 732, 0, 0, "\"></div></div><!--End static network section--><div class=\"row\"><input class=\"btn\" id=\"btnNetworkUpd"
+      "ate\" type=\"button\" value=\"Update Network Settings\"></div></form></div><!--End panel//--></div><!--En"
+      "d row//--></div><!--End c//--><div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">Mining"
+      " Settings</button><div class=\"panel\"><form id=\"frmMining\"><div class=\"tabs\"><input type=\"radio\" id=\""
+      "tab1\" name=\"tabs\" checked><label for=\"tab1\">Primary</label><input type=\"radio\" id=\"tab2\" name=\"tabs\""
+      "><label for=\"tab2\">Backup</label><div class=\"tab-content content1\"><div class=\"row tab-header\">Prima"
+      "ry Pool Settings</div><div class=\"row\"> Mining Pool Server <input class=\"card w-100\" id=\"poolUrl\" ty"
+      "pe=\"text\" name=\"poolUrl\" value=\"" },
+  { TEMPLATE_HTML, 10, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 118, 0, 0, "\"></div><div class=\"row\"> Mining Pool Port <input class=\"card w-100\" id=\"poolPort\" type=\"text\" name="
+      "\"poolPort\" value=\"" },
+  { TEMPLATE_INT, 11, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 110, 0, 0, "\"></div><div class=\"row\"> Use TLS <select class=\"card w-100\" name=\"poolTls\" id=\"poolTls\"><option val"
+      "ue=\"false\"" },
+  { TEMPLATE_SELECTED, 12, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 12, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 146, 0, 0, ">Yes</option></select></div><div class=\"row\"> TLS Key Pin (SHA-256, hex) <input class=\"card w-100\" i"
+      "d=\"poolPin\" type=\"text\" name=\"poolPin\" value=\"" },
+  { TEMPLATE_HTML, 13, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 130, 0, 0, "\"></div><div class=\"row\"> Mining Pool Password <input class=\"card w-100\" id=\"poolPassword\" type=\"tex"
+      "t\" name=\"poolPassword\" value=\"" },
+  { TEMPLATE_HTML, 14, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 129, 0, 0, "\"></div><div class=\"row\"> Wallet Address <div class=\"rel\"><input class=\"card w-100\" id=\"wallet\" type"
+      "=\"text\" name=\"wallet\" value=\"" },
+  { TEMPLATE_HTML, 15, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 335, 0, 0, "\"><input type=\"button\" id=\"btnValidateWallet\" class=\"btn inside-button\" value=\"Validate\"></div></div"
+      "></div><!--End tab 1//--><div class=\"tab-content content2\"><div class=\"row tab-header\">Backup Pool S"
+      "ettings</div><div class=\"row\"> Mining Pool Server <input class=\"card w-100\" id=\"backupPoolUrl\" type="
+      "\"text\" name=\"backupPoolUrl\" value=\"" },
+  { TEMPLATE_HTML, 16, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 130, 0, 0, "\"></div><div class=\"row\"> Mining Pool Port <input class=\"card w-100\" id=\"backupPoolPort\" type=\"text\""
+      " name=\"backupPoolPort\" value=\"" },
+  { TEMPLATE_INT, 17, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 122, 0, 0, "\"></div><div class=\"row\"> Use TLS <select class=\"card w-100\" name=\"backupPoolTls\" id=\"backupPoolTls\""
+      "><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 18, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 18, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 158, 0, 0, ">Yes</option></select></div><div class=\"row\"> TLS Key Pin (SHA-256, hex) <input class=\"card w-100\" i"
+      "d=\"backupPoolPin\" type=\"text\" name=\"backupPoolPin\" value=\"" },
+  { TEMPLATE_HTML, 19, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 142, 0, 0, "\"></div><div class=\"row\"> Mining Pool Password <input class=\"card w-100\" id=\"backupPoolPassword\" typ"
+      "e=\"text\" name=\"backupPoolPassword\" value=\"" },
+  { TEMPLATE_HTML, 20, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 141, 0, 0, "\"></div><div class=\"row\"> Wallet Address <div class=\"rel\"><input class=\"card w-100\" id=\"backupWallet"
+      "\" type=\"text\" name=\"backupWallet\" value=\"" },
+  { TEMPLATE_HTML, 21, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 297, 0, 0, "\"><input type=\"button\" id=\"btnValidateBackupWallet\" class=\"btn inside-button\" value=\"Validate\"></div"
+      "></div></div><!--End tab 2//--></div><!--End tabs//--><div class=\"row\"> Randomize Block Timestamps <"
+      "select class=\"card w-100\" name=\"randomizeTimestamp\" id=\"randomizeTimestamp\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 22, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 22, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 153, 0, 0, ">Yes</option></select></div><div class=\"row\"> Stratum Server <select class=\"card w-100\" name=\"stratu"
+      "mRepeater\" id=\"stratumRepeater\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 23, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 23, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 261, 0, 0, ">Yes</option></select></div><div class=\"row hint\"> Lets other miners on your network connect to this"
+      " one on port 3333 and share its pool connection. </div><div class=\"row\"> Cluster <select class=\"card"
+      " w-100\" name=\"clusterRole\" id=\"clusterRole\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 24, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 30, 0, 0, ">Off</option><option value=\"1\"" },
+  { TEMPLATE_SELECTED, 24, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 33, 0, 0, ">Leader</option><option value=\"2\"" },
+  { TEMPLATE_SELECTED, 24, 0, 2, 0, NULL },
+  { TEMPLATE_TEXT, 0, 146, 0, 0, ">Follower</option></select></div><div class=\"row\"> Cluster Link <select class=\"card w-100\" name=\"clu"
+      "sterUdp\" id=\"clusterUdp\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 25, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 37, 0, 0, ">ESP-NOW</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 25, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 152, 0, 0, ">UDP</option></select></div><div class=\"row\"> Cluster Key <input class=\"card w-100\" id=\"clusterKey\" "
+      "type=\"text\" name=\"clusterKey\" maxlength=\"32\" value=\"" },
+  { TEMPLATE_HTML, 26, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 438, 0, 0, "\"></div><div class=\"row hint\"> A leader shares its pool connection with followers on the same WiFi a"
+      "nd link. Followers leave their own pool and mine what the leader sends. Every miner in a cluster nee"
+      "ds the same key, and ignores miners with another. </div><div class=\"row\"><input class=\"btn\" id=\"btnM"
+      "iningUpdate\" type=\"button\" value=\"Update Mining Settings\"></div></form></div><!--End panel//--></div"
+      "><!--End row//--></div><!--End c//--> " },
+#if defined(ESP32_2432S028) || defined(ESP32_2432S024)
+  { TEMPLATE_TEXT, 0, 276, 0, 0, " <div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">Display Settings</button><div class"
+      "=\"panel\"><form id=\"frmDisplay\" onsubmit=\"return false;\"><div class=\"row\"> Screen Rotation <select cl"
+      "ass=\"card w-100\" name=\"screenRotation\" id=\"screenRotation\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 27, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 52, 0, 0, ">Portrait: Cable at bottom</option><option value=\"1\"" },
+  { TEMPLATE_SELECTED, 27, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 52, 0, 0, ">Landscape: Cable at right</option><option value=\"2\"" },
+  { TEMPLATE_SELECTED, 27, 0, 2, 0, NULL },
+  { TEMPLATE_TEXT, 0, 49, 0, 0, ">Portrait: Cable at top</option><option value=\"3\"" },
+  { TEMPLATE_SELECTED, 27, 0, 3, 0, NULL },
+  { TEMPLATE_TEXT, 0, 176, 0, 0, ">Landscape: Cable at left</option></select></div><div class=\"row\"> Screen Brightness <select class=\""
+      "card w-100\" name=\"screenBrightness\" id=\"screenBrightness\"><option value=\"24\"" },
+  { TEMPLATE_SELECTED, 28, 0, 24, 0, NULL },
+  { TEMPLATE_TEXT, 0, 31, 0, 0, ">10%</option><option value=\"64\"" },
+  { TEMPLATE_SELECTED, 28, 0, 64, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">25%</option><option value=\"128\"" },
+  { TEMPLATE_SELECTED, 28, 0, 128, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">50%</option><option value=\"192\"" },
+  { TEMPLATE_SELECTED, 28, 0, 192, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">75%</option><option value=\"255\"" },
+  { TEMPLATE_SELECTED, 28, 0, 255, 0, NULL },
+  { TEMPLATE_TEXT, 0, 159, 0, 0, ">100%</option></select></div><div class=\"row\"> Screen Inactivity Timer <select id=\"inactivityTimer\" "
+      "class=\"card w-100\" name=\"inactivityTimer\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 29, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 39, 0, 0, ">No timer</option><option value=\"30000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 30000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 41, 0, 0, ">30 seconds</option><option value=\"60000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 60000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 40, 0, 0, ">1 minute</option><option value=\"120000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 120000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 41, 0, 0, ">2 minutes</option><option value=\"300000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 300000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 41, 0, 0, ">5 minutes</option><option value=\"600000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 600000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 43, 0, 0, ">10 minutes</option><option value=\"1800000\"" },
+  { TEMPLATE_SELECTED, 29, 0, 1800000, 0, NULL },
+  { TEMPLATE_TEXT, 0, 180, 0, 0, ">30 minutes</option></select></div><div class=\"row\"> Screen Inactivity Brightness <select class=\"car"
+      "d w-100\" name=\"inactivityBrightness\" id=\"inactivityBrightness\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 30, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 38, 0, 0, ">Screen off</option><option value=\"24\"" },
+  { TEMPLATE_SELECTED, 30, 0, 24, 0, NULL },
+  { TEMPLATE_TEXT, 0, 31, 0, 0, ">10%</option><option value=\"64\"" },
+  { TEMPLATE_SELECTED, 30, 0, 64, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">25%</option><option value=\"128\"" },
+  { TEMPLATE_SELECTED, 30, 0, 128, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">50%</option><option value=\"192\"" },
+  { TEMPLATE_SELECTED, 30, 0, 192, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">75%</option><option value=\"255\"" },
+  { TEMPLATE_SELECTED, 30, 0, 255, 0, NULL },
+  { TEMPLATE_TEXT, 0, 158, 0, 0, ">100%</option></select></div><div class=\"row\"> Foreground Color <input class=\"w-100 colorbox\" id=\"fo"
+      "regroundColor\" type=\"color\" name=\"foregroundColor\" value=\"" },
+  { TEMPLATE_COLOR, 31, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 216, 0, 0, "\"><a href=\"#\" onclick=\"setDefaultForegroundColor();return false;\">Set default</a></div><div class=\"r"
+      "ow\"> Background Color <input class=\"w-100 colorbox\" id=\"backgroundColor\" type=\"color\" name=\"backgrou"
+      "ndColor\" value=\"" },
+  { TEMPLATE_COLOR, 32, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 205, 0, 0, "\"><a href=\"#\" onclick=\"setDefaultBackgroundColor();return false;\">Set default</a></div><div class=\"r"
+      "ow\"> Invert Colors <select class=\"card w-100\" name=\"invertColors\" id=\"invertColors\"><option value=\"f"
+      "alse\"" },
+  { TEMPLATE_SELECTED, 33, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 33, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 477, 0, 0, ">Yes</option></select></div><div class=\"row\"><input class=\"btn\" id=\"btnDisplayUpdate\" type=\"button\" "
+      "value=\"Update Display Settings\"></div></form></div><!--End panel//--></div><!--End row//--></div><!-"
+      "-End c//--><div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">LED Settings</button><div"
+      " class=\"panel\"><form id=\"frmLED\" onsubmit=\"return false;\"><div class=\"row\"> LED Red Level <input cla"
+      "ss=\"w-100\" id=\"led1red\" type=\"range\" name=\"led1red\" min=\"0\" max=\"255\" value=\"" },
+  { TEMPLATE_INT, 34, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 133, 0, 0, "\"></div><div class=\"row\"> LED Green Level <input class=\"w-100\" id=\"led1green\" type=\"range\" name=\"led"
+      "1green\" min=\"0\" max=\"255\" value=\"" },
+  { TEMPLATE_INT, 35, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 130, 0, 0, "\"></div><div class=\"row\"> LED Blue Level <input class=\"w-100\" id=\"led1blue\" type=\"range\" name=\"led1b"
+      "lue\" min=\"0\" max=\"255\" value=\"" },
+  { TEMPLATE_INT, 36, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 184, 0, 0, "\"></div><div class=\"row\"><input class=\"btn\" id=\"btnLEDUpdate\" type=\"button\" value=\"Update LED Settin"
+      "gs\"></div></form></div><!--End panel//--></div><!--End row//--></div><!--End c//--> " },
+#endif
+  { TEMPLATE_TEXT, 0, 258, 0, 0, " <div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">General Settings</button><div class"
+      "=\"panel\"><form id=\"frmGeneral\" onsubmit=\"return false;\"><div class=\"row\"> Web Theme <select class=\"c"
+      "ard w-100\" name=\"webTheme\" id=\"webTheme\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 37, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 35, 0, 0, ">Standard</option><option value=\"1\"" },
+  { TEMPLATE_SELECTED, 37, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 142, 0, 0, ">Dark</option></select></div><div class=\"row\"> Time Server (NTP) <input class=\"card w-100\" id=\"ntpSe"
+      "rver\" type=\"text\" name=\"ntpServer\" value=\"" },
+  { TEMPLATE_HTML, 38, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 181, 0, 0, "\" placeholder=\"Time server\"></div><div class=\"row\"><div class=\"w-100\">Timezone Offset</div><select c"
+      "lass=\"card\" name=\"utcOffsetHours\" id=\"utcOffsetHours\" style=\"margin-right:10px\"> " },
+  { TEMPLATE_OPTIONS, 39, 6, -11, 14, " hours" },
+  { TEMPLATE_TEXT, 0, 94, 0, 0, " </select><select class=\"card\" name=\"utcOffsetMinutes\" id=\"utcOffsetMinutes\"><option value=\"0\"" },
+  { TEMPLATE_SELECTED, 40, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 37, 0, 0, ">0 minutes</option><option value=\"30\"" },
+  { TEMPLATE_SELECTED, 40, 0, 30, 0, NULL },
+  { TEMPLATE_TEXT, 0, 38, 0, 0, ">30 minutes</option><option value=\"45\"" },
+  { TEMPLATE_SELECTED, 40, 0, 45, 0, NULL },
+  { TEMPLATE_TEXT, 0, 142, 0, 0, ">45 minutes</option></select></div><div class=\"row\"> Clock Format <select class=\"card w-100\" id=\"clo"
+      "ck24\" name=\"clock24\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 41, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 37, 0, 0, ">12-hour</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 41, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 373, 0, 0, ">24-hour</option></select></div><div class=\"row\"><input class=\"btn\" id=\"btnGeneralUpdate\" type=\"butt"
+      "on\" value=\"Update General Settings\"></div></form></div><!--End panel//--></div><!--End row//--></div"
+      "><!--End c//--><div class=\"c nbpad\"><div class=\"row\"><button class=\"accordion\">Advanced Settings</bu"
+      "tton><div class=\"panel\"><form id=\"frmAdvanced\" onsubmit=\"return false;\"> " },
+#ifndef SINGLE_CORE
+  { TEMPLATE_TEXT, 0, 136, 0, 0, " <div class=\"row\"> Reduce Mining CPU Load <select class=\"card w-100\" name=\"coreZeroDisabled\" id=\"cor"
+      "eZeroDisabled\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 42, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 42, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 170, 0, 0, ">Yes</option></select></div><div class=\"row hint\"> Reduces mining impact on the CPU, enabling better"
+      " performance for non-mining tasks at the expense of hash rate. </div> " },
+#endif
+  { TEMPLATE_TEXT, 0, 374, 0, 0, " <div class=\"row\"> Clear Statistics <input type=\"text\" maxlength=\"4\" class=\"card w-100\" name=\"clearS"
+      "tats\" id=\"clearStats\"></div><div class=\"row hint\"> To clear miner statistics, type \"YES\" in the box "
+      "above and update the advanced settings. </div><div class=\"row\"> Enable Log Viewer <select class=\"car"
+      "d w-100\" name=\"enableLogViewer\" id=\"enableLogViewer\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 43, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 43, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 285, 0, 0, ">Yes</option></select></div><div class=\"row hint\"> Allows you to see communication logs in in real t"
+      "ime. Logs may contain wallets and pool passwords. </div><div class=\"row\"> Capture Pool Traffic <sele"
+      "ct class=\"card w-100\" name=\"stratumCapture\" id=\"stratumCapture\"><option value=\"false\"" },
+  { TEMPLATE_SELECTED, 44, 0, 0, 0, NULL },
+  { TEMPLATE_TEXT, 0, 32, 0, 0, ">No</option><option value=\"true\"" },
+  { TEMPLATE_SELECTED, 44, 0, 1, 0, NULL },
+  { TEMPLATE_TEXT, 0, 532, 0, 0, ">Yes</option></select></div><div class=\"row hint\"> Records everything sent to and from the pool, for"
+      " tracking down pool problems. The last few minutes can be downloaded from <a href=\"/stratum.cap\">/st"
+      "ratum.cap</a>, and with an SD card it all goes to stratum.cap on the card as well. Captures contain "
+      "your wallet but not your pool password. </div><div class=\"row\"><input class=\"btn\" id=\"btnAdvancedUpd"
+      "ate\" type=\"button\" value=\"Update Advanced Settings\"></div></form></div><!--End panel//--></div><!--E"
+      "nd row//--></div><!--End c//--> " },
+  { TEMPLATE_END, 0, 0, 0, 0, NULL },
+};
+const size_t configTemplateLength = sizeof(configTemplate) / sizeof(TemplateOp);
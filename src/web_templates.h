@@ -0,0 +1,58 @@
+// Generated by tools/build_web_assets.py from web/*.tmpl. Do not edit.
+#ifndef WEB_TEMPLATES_H
+#define WEB_TEMPLATES_H
+
+#include "html_template.h"
+
+enum ConfigTemplateField : uint8_t {
+  CONFIG_FIELD_MESSAGES,
+  CONFIG_FIELD_USERNAME,
+  CONFIG_FIELD_PASSWORD_SET,
+  CONFIG_FIELD_SSID,
+  CONFIG_FIELD_STATIC_IP,
+  CONFIG_FIELD_IP_ADDRESS,
+  CONFIG_FIELD_GATEWAY,
+  CONFIG_FIELD_SUBNET,
+  CONFIG_FIELD_PRIMARY_DNS,
+  CONFIG_FIELD_SECONDARY_DNS,
+  CONFIG_FIELD_POOL_URL,
+  CONFIG_FIELD_POOL_PORT,
+  CONFIG_FIELD_POOL_TLS,
+  CONFIG_FIELD_POOL_PIN,
+  CONFIG_FIELD_POOL_PASSWORD,
+  CONFIG_FIELD_WALLET,
+  CONFIG_FIELD_BACKUP_POOL_URL,
+  CONFIG_FIELD_BACKUP_POOL_PORT,
+  CONFIG_FIELD_BACKUP_POOL_TLS,
+  CONFIG_FIELD_BACKUP_POOL_PIN,
+  CONFIG_FIELD_BACKUP_POOL_PASSWORD,
+  CONFIG_FIELD_BACKUP_WALLET,
+  CONFIG_FIELD_RANDOMIZE_TIMESTAMP,
+  CONFIG_FIELD_STRATUM_REPEATER,
+  CONFIG_FIELD_CLUSTER_ROLE,
+  CONFIG_FIELD_CLUSTER_UDP,
+  CONFIG_FIELD_CLUSTER_KEY,
+  CONFIG_FIELD_SCREEN_ROTATION,
+  CONFIG_FIELD_SCREEN_BRIGHTNESS,
+  CONFIG_FIELD_INACTIVITY_TIMER,
+  CONFIG_FIELD_INACTIVITY_BRIGHTNESS,
+  CONFIG_FIELD_FOREGROUND_COLOR,
+  CONFIG_FIELD_BACKGROUND_COLOR,
+  CONFIG_FIELD_INVERT_COLORS,
+  CONFIG_FIELD_LED1RED,
+  CONFIG_FIELD_LED1GREEN,
+  CONFIG_FIELD_LED1BLUE,
+  CONFIG_FIELD_WEB_THEME,
+  CONFIG_FIELD_NTP_SERVER,
+  CONFIG_FIELD_UTC_OFFSET_HOURS,
+  CONFIG_FIELD_UTC_OFFSET_MINUTES,
+  CONFIG_FIELD_CLOCK24,
+  CONFIG_FIELD_CORE_ZERO_DISABLED,
+  CONFIG_FIELD_ENABLE_LOG_VIEWER,
+  CONFIG_FIELD_STRATUM_CAPTURE,
+};
+
+extern const TemplateOp configTemplate[];
+extern const size_t configTemplateLength;
+
+#endif
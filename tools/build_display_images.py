@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Converts the PNGs in graphics/ into src/display_images.h and .cpp, so the
+# TFT screens copy pixels out of flash instead of inflating a PNG every time
+# a page is drawn.
+#
+# Each image is a stream of runs, none of which crosses the end of a row. A
+# run starts with one byte: the top two bits are the kind, the low six are
+# the length less one.
+#   CLEAR   fully transparent; the background shows through
+#   PIXELS  that many RGB565 pixels, high byte first as the panel takes them
+#   REPEAT  one RGB565 pixel, that many times
+#   BLEND   that many R, G, B, alpha quads for the anti-aliased edges, mixed
+#           with the background when drawn since the background is a setting
+#
+# Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+# can be run by hand. Output is only rewritten when something changed.
+
+import os
+import struct
+import sys
+import zlib
+
+RUN_CLEAR = 0x00
+RUN_PIXELS = 0x40
+RUN_REPEAT = 0x80
+RUN_BLEND = 0xc0
+RUN_MAX = 64
+
+# A repeat run costs three bytes, so it only wins from three pixels up
+REPEAT_MIN = 3
+
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+
+    pos = 8
+    idat = b""
+    palette = b""
+    palette_alpha = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += length + 12
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = body
+        elif kind == b"tRNS":
+            palette_alpha = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if depth != 8 or interlace or color_type not in CHANNELS:
+        raise ValueError("%s: only 8 bit, non-interlaced PNGs are supported" % path)
+
+    channels = CHANNELS[color_type]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    rows = []
+    prior = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = prior[i]
+            corner = prior[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xff
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else corner)
+                line[i] = (line[i] + predictor) & 0xff
+        prior = line
+
+        pixels = []
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                pixels.append((p[0], p[0], p[0], 255))
+            elif color_type == 2:
+                pixels.append((p[0], p[1], p[2], 255))
+            elif color_type == 3:
+                i = p[0]
+                alpha = palette_alpha[i] if i < len(palette_alpha) else 255
+                pixels.append((palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2], alpha))
+            elif color_type == 4:
+                pixels.append((p[0], p[0], p[0], p[1]))
+            else:
+                pixels.append((p[0], p[1], p[2], p[3]))
+        rows.append(pixels)
+
+    return width, height, rows
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def kind_of(pixel):
+    if pixel[3] == 0:
+        return RUN_CLEAR
+    if pixel[3] == 255:
+        return RUN_PIXELS
+    return RUN_BLEND
+
+
+def encode_row(pixels, out):
+    x = 0
+    while x < len(pixels):
+        kind = kind_of(pixels[x])
+        if kind == RUN_PIXELS:
+            color = rgb565(*pixels[x][:3])
+            same = 1
+            while x + same < len(pixels) and same < RUN_MAX and kind_of(pixels[x + same]) == RUN_PIXELS \
+                    and rgb565(*pixels[x + same][:3]) == color:
+                same += 1
+            if same >= REPEAT_MIN:
+                out += bytes([RUN_REPEAT | (same - 1), color >> 8, color & 0xff])
+                x += same
+                continue
+
+        # Gather the run, stopping a pixel run where a worthwhile repeat starts
+        count = 1
+        while x + count < len(pixels) and count < RUN_MAX and kind_of(pixels[x + count]) == kind:
+            if kind == RUN_PIXELS and x + count + REPEAT_MIN <= len(pixels):
+                c = rgb565(*pixels[x + count][:3])
+                if all(kind_of(p) == RUN_PIXELS and rgb565(*p[:3]) == c for p in pixels[x + count:x + count + REPEAT_MIN]):
+                    break
+            count += 1
+
+        out.append(kind | (count - 1))
+        for p in pixels[x:x + count]:
+            if kind == RUN_PIXELS:
+                color = rgb565(*p[:3])
+                out += bytes([color >> 8, color & 0xff])
+            elif kind == RUN_BLEND:
+                out += bytes(p)
+        x += count
+
+
+def symbol_for(name):
+    return "image" + "".join(part.capitalize() for part in name.split("_"))
+
+
+def build(project_dir):
+    graphics_dir = os.path.join(project_dir, "graphics")
+    images = []
+    for name in sorted(os.listdir(graphics_dir)):
+        if not name.endswith(".png"):
+            continue
+        path = os.path.join(graphics_dir, name)
+        width, height, rows = read_png(path)
+        data = bytearray()
+        for pixels in rows:
+            encode_row(pixels, data)
+        images.append({
+            "name": name[:-4],
+            "width": width,
+            "height": height,
+            "data": bytes(data),
+            "png": os.path.getsize(path),
+        })
+    return images
+
+
+def render_header(images):
+    out = []
+    out.append("// Generated by tools/build_display_images.py from graphics/. Do not edit.\n")
+    out.append("#ifndef DISPLAY_IMAGES_H\n#define DISPLAY_IMAGES_H\n\n#include <Arduino.h>\n\n")
+    out.append("// Run kinds, in the top two bits of each run's first byte\n")
+    out.append("#define IMAGE_RUN_CLEAR 0x%02x\n" % RUN_CLEAR)
+    out.append("#define IMAGE_RUN_PIXELS 0x%02x\n" % RUN_PIXELS)
+    out.append("#define IMAGE_RUN_REPEAT 0x%02x\n" % RUN_REPEAT)
+    out.append("#define IMAGE_RUN_BLEND 0x%02x\n\n" % RUN_BLEND)
+    out.append("typedef struct {\n")
+    out.append("  uint16_t width;\n")
+    out.append("  uint16_t height;\n")
+    out.append("  const uint8_t* data;\n")
+    out.append("  uint32_t length;\n")
+    out.append("} DisplayImage;\n\n")
+    for image in images:
+        out.append("extern const DisplayImage %s;\n" % symbol_for(image["name"]))
+    out.append("\n#endif\n")
+    return "".join(out)
+
+
+def render_source(images):
+    out = []
+    out.append("// Generated by tools/build_display_images.py from graphics/. Do not edit.\n")
+    out.append('#include "display_images.h"\n\n')
+    for image in images:
+        symbol = symbol_for(image["name"])
+        out.append("// %s.png: %dx%d, %d bytes as PNG, %d as runs\n" % (
+            image["name"], image["width"], image["height"], image["png"], len(image["data"])))
+        out.append("static const uint8_t %sData[] PROGMEM = {\n" % symbol)
+        data = image["data"]
+        for i in range(0, len(data), 16):
+            out.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        out.append("};\n")
+        out.append("const DisplayImage %s = { %d, %d, %sData, %d };\n\n" % (
+            symbol, image["width"], image["height"], symbol, len(data)))
+    return "".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def main(project_dir):
+    images = build(project_dir)
+    changed = write_if_changed(os.path.join(project_dir, "src", "display_images.h"), render_header(images))
+    changed |= write_if_changed(os.path.join(project_dir, "src", "display_images.cpp"), render_source(images))
+    png = sum(i["png"] for i in images)
+    runs = sum(len(i["data"]) for i in images)
+    print("display images: %d files, %d bytes as PNG -> %d%s" % (len(images), png, runs, "" if changed else " (unchanged)"))
+
+
+try:
+    Import("env")  # noqa: F821  (provided by PlatformIO)
+    main(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,364 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Packs the static files in web/ into src/web_assets.h and src/web_assets.cpp,
+# and compiles web/*.tmpl page templates into src/web_templates.h and .cpp.
+#
+# Text assets are gzipped once here so the miner never compresses anything
+# and every page load is a straight copy out of flash. Each asset gets a
+# strong ETag from its content hash, and every reference to another asset
+# inside a page is rewritten to carry that hash (/style.css?v=...), so the
+# browser can cache subresources forever and still see a new firmware.
+#
+# In web/ sources:
+#   <!--#include _file.html-->   pulls in a partial (files starting with _ aren't served)
+#   {{url:/style.css}}           the versioned URL of another asset
+#   {{MINING_HARDWARE_NAME}}     any string #define from defines_n_types.h
+#
+# Templates are for pages built per request. Markup is kept as literal text
+# and placeholders become typed operations for src/html_template.cpp:
+#   {{html:field}} {{raw:field}} {{int:field}} {{ip:field}} {{color:field}}
+#   {{selected:field=value}}           " SELECTED" when the field has that value
+#   {{options:field=min..max|suffix}}  a run of <option>s with one selected
+#   {{if:field}} ... {{end}}           only when the field is set
+#   {{#if EXPR}} / {{#ifndef X}} ... {{#endif}}   preprocessor conditionals
+# Each template gets an enum of its field names, which the page's resolver
+# switches on, so a renamed or missing field fails the build.
+#
+# Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+# can be run by hand. Output is only rewritten when something changed.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+CONTENT_TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".png": "image/png",
+    ".json": "application/json",
+}
+
+# Pages are fetched by their plain URL, so they revalidate with the ETag
+# instead of being cached outright.
+PAGE_EXTENSIONS = (".html",)
+
+
+def symbol_for(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def read_defines(project_dir):
+    defines = {}
+    path = os.path.join(project_dir, "src", "defines_n_types.h")
+    with open(path) as f:
+        for m in re.finditer(r'^#define\s+(\w+)\s+"([^"]*)"', f.read(), re.M):
+            defines[m.group(1)] = m.group(2)
+    return defines
+
+
+def expand(text, web_dir, urls, defines, depth=0):
+    if depth > 8:
+        raise RuntimeError("web assets: includes nested too deep")
+
+    def include(m):
+        with open(os.path.join(web_dir, m.group(1)), encoding="utf-8") as f:
+            return expand(f.read(), web_dir, urls, defines, depth + 1)
+
+    def token(m):
+        key = m.group(1)
+        if key.startswith("url:"):
+            if key[4:] not in urls:
+                raise RuntimeError("web assets: no asset for " + key)
+            return urls[key[4:]]
+        if key not in defines:
+            raise RuntimeError("web assets: unknown token " + key)
+        return defines[key]
+
+    text = re.sub(r"<!--#include\s+(\S+)\s*-->\n?", include, text)
+    return re.sub(r"\{\{([^}]+)\}\}", token, text)
+
+
+def expand_includes(text, web_dir, depth=0):
+    if depth > 8:
+        raise RuntimeError("web assets: includes nested too deep")
+
+    def include(m):
+        with open(os.path.join(web_dir, m.group(1)), encoding="utf-8") as f:
+            return expand_includes(f.read(), web_dir, depth + 1)
+
+    return re.sub(r"<!--#include\s+(\S+)\s*-->\n?", include, text)
+
+
+def minify_markup(text):
+    # Indentation is for people; newlines between tags go, others become a space
+    text = re.sub(r">\s*\n\s*<", "><", text)
+    return re.sub(r"\s*\n\s*", " ", text)
+
+
+def c_string(text):
+    # Split long literals so the generated file stays readable
+    parts = [text[i:i + 100] for i in range(0, len(text), 100)] or [""]
+    return "\n      ".join('"%s"' % p.replace("\\", "\\\\").replace('"', '\\"') for p in parts)
+
+
+def camel_to_upper(name):
+    return re.sub(r"(?<=[a-z0-9])([A-Z])", r"_\1", name).upper()
+
+
+TEMPLATE_TYPES = {
+    "html": "TEMPLATE_HTML",
+    "raw": "TEMPLATE_RAW",
+    "int": "TEMPLATE_INT",
+    "ip": "TEMPLATE_IP",
+    "color": "TEMPLATE_COLOR",
+    "selected": "TEMPLATE_SELECTED",
+    "options": "TEMPLATE_OPTIONS",
+    "if": "TEMPLATE_IF",
+}
+
+
+def compile_template(name, text, web_dir, urls, defines):
+    text = expand_includes(text, web_dir)
+    fields = []
+    entries = []        # ("op", fields...) or ("pp", line)
+    stack = []
+    pending = []
+
+    def field_id(field):
+        if field not in fields:
+            fields.append(field)
+        return fields.index(field)
+
+    def flush_text():
+        literal = minify_markup("".join(pending))
+        del pending[:]
+        if literal.strip():
+            entries.append(("op", "TEMPLATE_TEXT", 0, len(literal.encode("utf-8")), 0, 0, literal))
+
+    pos = 0
+    for m in re.finditer(r"\{\{([^}]+)\}\}", text):
+        pending.append(text[pos:m.start()])
+        pos = m.end()
+        token = m.group(1).strip()
+
+        if token.startswith("url:"):
+            pending.append(urls[token[4:]])
+            continue
+        if token in defines:
+            pending.append(defines[token])
+            continue
+
+        flush_text()
+        if token.startswith("#"):
+            directive = token[1:].split(None, 1)
+            if directive[0] in ("if", "ifdef", "ifndef"):
+                stack.append("#if")
+            elif directive[0] == "endif":
+                if not stack or stack.pop() != "#if":
+                    raise RuntimeError("%s: unbalanced {{#endif}}" % name)
+            entries.append(("pp", "#" + token[1:]))
+        elif token == "end":
+            if not stack or stack.pop() != "if":
+                raise RuntimeError("%s: unbalanced {{end}}" % name)
+            entries.append(("op", "TEMPLATE_END", 0, 0, 0, 0, None))
+        else:
+            kind, _, arg = token.partition(":")
+            if kind not in TEMPLATE_TYPES or not arg:
+                raise RuntimeError("%s: bad placeholder {{%s}}" % (name, token))
+            value = limit = 0
+            suffix = None
+            if kind == "selected":
+                arg, _, v = arg.partition("=")
+                value = int(v)
+            elif kind == "options":
+                arg, _, spec = arg.partition("=")
+                span, _, suffix = spec.partition("|")
+                lo, _, hi = span.partition("..")
+                value, limit = int(lo), int(hi)
+            elif kind == "if":
+                stack.append("if")
+            entries.append(("op", TEMPLATE_TYPES[kind], field_id(arg),
+                            len(suffix.encode("utf-8")) if suffix else 0, value, limit, suffix))
+    pending.append(text[pos:])
+    flush_text()
+    if stack:
+        raise RuntimeError("%s: unclosed %s" % (name, stack[-1]))
+
+    return {"name": name, "fields": fields, "entries": entries}
+
+
+def render_templates(templates):
+    header = ["// Generated by tools/build_web_assets.py from web/*.tmpl. Do not edit.\n",
+              "#ifndef WEB_TEMPLATES_H\n#define WEB_TEMPLATES_H\n\n#include \"html_template.h\"\n\n"]
+    source = ["// Generated by tools/build_web_assets.py from web/*.tmpl. Do not edit.\n",
+              "#include <Arduino.h>\n#include \"defines_n_types.h\"\n#include \"web_templates.h\"\n"]
+    for t in templates:
+        prefix = camel_to_upper(t["name"])
+        header.append("enum %sTemplateField : uint8_t {\n" % t["name"].capitalize())
+        for f in t["fields"]:
+            header.append("  %s_FIELD_%s,\n" % (prefix, camel_to_upper(f)))
+        header.append("};\n\n")
+        header.append("extern const TemplateOp %sTemplate[];\n" % t["name"])
+        header.append("extern const size_t %sTemplateLength;\n\n" % t["name"])
+
+        source.append("\nconst TemplateOp %sTemplate[] = {\n" % t["name"])
+        for e in t["entries"]:
+            if e[0] == "pp":
+                source.append(e[1] + "\n")
+                continue
+            _, kind, field, length, value, limit, text = e
+            source.append("  { %s, %d, %d, %d, %d, %s },\n" % (
+                kind, field, length, value, limit, c_string(text) if text is not None else "NULL"))
+        source.append("};\n")
+        source.append("const size_t %sTemplateLength = sizeof(%sTemplate) / sizeof(TemplateOp);\n" % (t["name"], t["name"]))
+    header.append("#endif\n")
+    return "".join(header), "".join(source)
+
+
+def pack(data, compressible):
+    if not compressible:
+        return data, False
+    packed = gzip.compress(data, compresslevel=9, mtime=0)
+    # Already compressed formats (PNG) don't get smaller, so leave them alone
+    if len(packed) < len(data) * 0.9:
+        return packed, True
+    return data, False
+
+
+def build(project_dir):
+    web_dir = os.path.join(project_dir, "web")
+    defines = read_defines(project_dir)
+
+    names = sorted(n for n in os.listdir(web_dir)
+                   if not n.startswith("_") and os.path.splitext(n)[1] in CONTENT_TYPES)
+
+    # Subresources first so pages can refer to their versioned URLs
+    ordered = [n for n in names if not n.endswith(PAGE_EXTENSIONS)] + \
+              [n for n in names if n.endswith(PAGE_EXTENSIONS)]
+
+    urls = {}
+    assets = []
+    for name in ordered:
+        ext = os.path.splitext(name)[1]
+        with open(os.path.join(web_dir, name), "rb") as f:
+            raw = f.read()
+        if ext != ".png":
+            raw = expand(raw.decode("utf-8"), web_dir, urls, defines).encode("utf-8")
+
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        data, gzipped = pack(raw, ext != ".png")
+        path = "/" + name
+        urls[path] = "%s?v=%s" % (path, etag)
+        assets.append({
+            "name": name,
+            "path": path,
+            "type": CONTENT_TYPES[ext],
+            "data": data,
+            "raw": len(raw),
+            "gzipped": gzipped,
+            "etag": etag,
+            "page": name.endswith(PAGE_EXTENSIONS),
+        })
+
+    templates = []
+    for name in sorted(os.listdir(web_dir)):
+        if name.endswith(".tmpl"):
+            with open(os.path.join(web_dir, name), encoding="utf-8") as f:
+                templates.append(compile_template(name[:-5], f.read(), web_dir, urls, defines))
+
+    return assets, urls, templates
+
+
+def render_header(assets, urls):
+    out = []
+    out.append("// Generated by tools/build_web_assets.py from web/. Do not edit.\n")
+    out.append("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n#include <Arduino.h>\n\n")
+    out.append("typedef struct {\n")
+    out.append("  const char* path;\n")
+    out.append("  const char* contentType;\n")
+    out.append("  const uint8_t* data;\n")
+    out.append("  uint32_t length;\n")
+    out.append("  bool gzipped;\n")
+    out.append("  bool page;           // Served at a fixed URL, so revalidated rather than cached\n")
+    out.append("  const char* etag;    // Quoted, ready for the header\n")
+    out.append("} WebAsset;\n\n")
+    for a in assets:
+        out.append('#define WEB_URL_%s "%s"\n' % (symbol_for(a["name"]), urls[a["path"]]))
+    out.append("\n#define WEB_ASSET_COUNT %d\n\n" % len(assets))
+    out.append("extern const WebAsset webAssets[WEB_ASSET_COUNT];\n\n")
+    out.append("const WebAsset* findWebAsset(const char* path);\n\n#endif\n")
+    return "".join(out)
+
+
+def render_source(assets):
+    out = []
+    out.append("// Generated by tools/build_web_assets.py from web/. Do not edit.\n")
+    out.append('#include "web_assets.h"\n\n')
+    for a in assets:
+        out.append("// %s: %d bytes, %d as sent\n" % (a["name"], a["raw"], len(a["data"])))
+        out.append("static const uint8_t webAsset_%s[] PROGMEM = {\n" % symbol_for(a["name"]).lower())
+        data = a["data"]
+        for i in range(0, len(data), 16):
+            out.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        out.append("};\n\n")
+    out.append("const WebAsset webAssets[WEB_ASSET_COUNT] = {\n")
+    for a in assets:
+        out.append('  { "%s", "%s", webAsset_%s, %d, %s, %s, "\\"%s\\"" },\n' % (
+            a["path"], a["type"], symbol_for(a["name"]).lower(), len(a["data"]),
+            "true" if a["gzipped"] else "false", "true" if a["page"] else "false", a["etag"]))
+    out.append("};\n\n")
+    out.append("const WebAsset* findWebAsset(const char* path) {\n")
+    out.append("  for( int i = 0; i < WEB_ASSET_COUNT; i++ ) {\n")
+    out.append("    if( strcmp(webAssets[i].path, path) == 0 ) {\n")
+    out.append("      return &webAssets[i];\n")
+    out.append("    }\n")
+    out.append("  }\n")
+    out.append("  return NULL;\n")
+    out.append("}\n")
+    return "".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def main(project_dir):
+    assets, urls, templates = build(project_dir)
+    changed = write_if_changed(os.path.join(project_dir, "src", "web_assets.h"), render_header(assets, urls))
+    changed |= write_if_changed(os.path.join(project_dir, "src", "web_assets.cpp"), render_source(assets))
+    template_header, template_source = render_templates(templates)
+    changed |= write_if_changed(os.path.join(project_dir, "src", "web_templates.h"), template_header)
+    changed |= write_if_changed(os.path.join(project_dir, "src", "web_templates.cpp"), template_source)
+    raw = sum(a["raw"] for a in assets)
+    sent = sum(len(a["data"]) for a in assets)
+    print("web assets: %d files, %d bytes -> %d%s" % (len(assets), raw, sent, "" if changed else " (unchanged)"))
+
+
+try:
+    Import("env")  # noqa: F821  (provided by PlatformIO)
+    main(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,390 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Host simulation of a mining cluster.
+//
+// Runs the firmware's ClusterLeader and a handful of ClusterFollowers in one
+// process, talking over UDP on loopback exactly as they would on a LAN. The
+// leader gets made-up pool jobs at a low difficulty; the followers hash them
+// with the firmware's midstate SHA-256, as minerTask does. Every share the
+// leader passes on is rebuilt from its job here and checked again, and the
+// followers are made to send a few bad and stale shares along the way,
+// which the leader has to catch. Some clean jobs come in while the leader
+// holds checked shares, which still have to come out.
+//
+// Two more leaders listen in on everything the followers send. One has the
+// same cluster key and keeps offering its own work, which the followers
+// have to ignore since they already have a leader. The other has a
+// different key and must not hear from anyone at all.
+//
+// From the repository root:
+//   g++ -O2 -DCLUSTER_HOST -DESP32_DEV_HEADLESS -Itools/host -Isrc
+//       tools/cluster_sim/cluster_sim.cpp tools/host/utils_host.cpp
+//       src/cluster.cpp src/clusterUdp.cpp src/jobTemplate.cpp src/MinerSha256.cpp
+//       -o cluster_sim && ./cluster_sim
+//
+//   ./cluster_sim --followers 8 --seconds 30 --difficulty 0.001 --job-ms 2000
+//
+// Exits non-zero if anything the leader let through doesn't check out.
+//
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "MinerSha256.h"
+#include "jobTemplate.h"
+#include "cluster.h"
+
+#define HASH_BATCH 4096           // Nonces each follower tries per pass
+#define LEADER_PORT 13335
+#define ROGUE_PORT 13336          // Same key, not the followers' leader
+#define OTHER_PORT 13337          // Another cluster's key
+#define FORGE_EVERY 4             // Every Nth real share is sent twice and followed by a made-up one
+
+static uint32_t nowMs() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (uint32_t) duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+// As miner.cpp's getDifficulty
+static double hashDifficulty(const miner_sha256_hash* ctx) {
+  static const double maxTarget = 26959535291011309493156476344723991336010898738574164086137773096960.0;
+  double value = 0.0;
+  for( int i = 31; i >= 0; i-- ) {
+    value = value * 256 + ctx->bytes[i];
+  }
+  return value > 0 ? maxTarget / value : INFINITY;
+}
+
+static std::string randomHex(size_t bytes) {
+  std::string s;
+  char b[3];
+  for( size_t i = 0; i < bytes; i++ ) {
+    snprintf(b, sizeof(b), "%02x", rand() & 0xff);
+    s += b;
+  }
+  return s;
+}
+
+// A pool job as parseMiningNotify would have it. The strings have to
+// outlive the JsonArray that points at them.
+struct PoolJob {
+  std::string jobId, prevHash, coinbase1, coinbase2, ntime;
+  std::string merkle[4];
+  JsonArray branch;
+  stratum_block sb;
+
+  PoolJob(uint32_t n) {
+    char id[16];
+    snprintf(id, sizeof(id), "%x", n);
+    jobId = id;
+    prevHash = randomHex(32);
+    coinbase1 = "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff" + randomHex(12);
+    coinbase2 = "ffffffff01" + randomHex(40) + "00000000";
+    char t[16];
+    snprintf(t, sizeof(t), "%08x", 1700000000 + n * 30);
+    ntime = t;
+    for( int i = 0; i < 4; i++ ) {
+      merkle[i] = randomHex(32);
+      branch.add(merkle[i].c_str());
+    }
+    sb.jobId = jobId.c_str();
+    sb.prevHash = prevHash.c_str();
+    sb.coinBase1 = coinbase1.c_str();
+    sb.coinBase2 = coinbase2.c_str();
+    sb.merkleBranch = branch;
+    sb.version = "20000000";
+    sb.difficulty = "17034219";
+    sb.nTime = ntime.c_str();
+    sb.cleanJobs = false;
+  }
+};
+
+static ClusterPeer loopback(uint16_t port) {
+  ClusterPeer p;
+  p.addr[0] = 127; p.addr[1] = 0; p.addr[2] = 0; p.addr[3] = 1;
+  p.addr[4] = port >> 8; p.addr[5] = port & 0xff;     // Network order, as clusterUdp.cpp keeps it
+  return p;
+}
+
+static void keyFor(const char* setting, uint8_t* key) {
+  char text[64];
+  miner_sha256_hash ctx;
+  snprintf(text, sizeof(text), "BitsyCluster:%s", setting);
+  sha256(&ctx, (unsigned char*) text, strlen(text));
+  memcpy(key, ctx.bytes, CLUSTER_KEY_SIZE);
+}
+
+// A follower's UDP, with a copy of everything it sends going to the other
+// two leaders as well
+class TapTransport : public ClusterTransport {
+public:
+    TapTransport() : udp(0, 0x7f000001, LEADER_PORT) {}
+    bool begin() { return udp.begin(); }
+    void end() { udp.end(); }
+    bool send(const ClusterPeer& to, const uint8_t* data, size_t len) { tap(data, len); return udp.send(to, data, len); }
+    bool broadcast(const uint8_t* data, size_t len) { tap(data, len); return udp.broadcast(data, len); }
+    size_t receive(ClusterPeer& from, uint8_t* data, size_t size) { return udp.receive(from, data, size); }
+
+private:
+    UdpTransport udp;
+    void tap(const uint8_t* data, size_t len) {
+      udp.send(loopback(ROGUE_PORT), data, len);
+      udp.send(loopback(OTHER_PORT), data, len);
+    }
+};
+
+struct SimFollower {
+  TapTransport transport;
+  ClusterFollower follower;
+  hash_block hb;
+  miner_sha256_hash midstate;
+  uint64_t hashes = 0;
+  uint32_t lastSeq = 0;
+  bool sentStale = false;
+};
+
+static int fail(const char* why) {
+  fprintf(stderr, "FAIL: %s\n", why);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  int followerCount = 4;
+  int seconds = 25;
+  double difficulty = 0.0005;
+  uint32_t jobMs = 3000;
+
+  for( int i = 1; i + 1 < argc; i += 2 ) {
+    if( ! strcmp(argv[i], "--followers") ) followerCount = atoi(argv[i + 1]);
+    else if( ! strcmp(argv[i], "--seconds") ) seconds = atoi(argv[i + 1]);
+    else if( ! strcmp(argv[i], "--difficulty") ) difficulty = atof(argv[i + 1]);
+    else if( ! strcmp(argv[i], "--job-ms") ) jobMs = atoi(argv[i + 1]);
+    else {
+      fprintf(stderr, "Unknown option %s\n", argv[i]);
+      return 2;
+    }
+  }
+  if( followerCount < 1 || followerCount > CLUSTER_MAX_FOLLOWERS ) {
+    return fail("followers has to be 1 to CLUSTER_MAX_FOLLOWERS");
+  }
+  srand(1);
+
+  uint8_t key[CLUSTER_KEY_SIZE], otherKey[CLUSTER_KEY_SIZE];
+  keyFor("sim", key);
+  keyFor("another cluster", otherKey);
+
+  UdpTransport leaderTransport(LEADER_PORT, 0x7f000001, LEADER_PORT);
+  UdpTransport rogueTransport(ROGUE_PORT, 0x7f000001, ROGUE_PORT);
+  UdpTransport otherTransport(OTHER_PORT, 0x7f000001, OTHER_PORT);
+  ClusterLeader leader, rogue, other;
+  if( ! leaderTransport.begin() || ! otherTransport.begin() ) {
+    return fail("leaders can't bind their ports");
+  }
+  leader.begin(&leaderTransport, key);
+  leader.setDifficulty(difficulty);
+  other.begin(&otherTransport, otherKey);
+  other.setDifficulty(difficulty);
+
+  std::vector<SimFollower*> followers;
+  for( int i = 0; i < followerCount; i++ ) {
+    SimFollower* f = new SimFollower();
+    if( ! f->transport.begin() ) {
+      return fail("follower can't open a socket");
+    }
+    f->follower.begin(&f->transport, key);
+    followers.push_back(f);
+  }
+
+  const char* extraNonce1 = "a1b2c3d4";
+  const int extraNonce2Size = 4;
+  std::map<std::string, JobTemplate> templates;
+  uint32_t jobCount = 0;
+  uint32_t lastJobAt = 0;
+  uint32_t checked = 0;
+  uint32_t bad = 0;
+  uint32_t found = 0;
+  uint32_t invalidSent = 0;
+  uint32_t staleSent = 0;
+  std::set<uint8_t> prefixes;
+  std::set<std::string> leaderPrevHashes;
+  uint32_t foreignJobs = 0;
+  bool rogueStarted = false;
+
+  uint32_t end = nowMs() + seconds * 1000;
+  while( nowMs() < end ) {
+    uint32_t now = nowMs();
+
+    // Once everyone's with the leader, the rogue starts taking notice
+    if( ! rogueStarted && leader.followers() == followerCount ) {
+      if( ! rogueTransport.begin() ) {
+        return fail("rogue leader can't bind its port");
+      }
+      rogue.begin(&rogueTransport, key);
+      rogue.setDifficulty(difficulty);
+      rogueStarted = true;
+    }
+
+    // Shares in first, so a clean job can come while they're queued
+    leader.poll(now);
+    rogue.poll(now);
+    other.poll(now);
+
+    // The pool: a new job every so often, every third one clean. The other
+    // two leaders get work of their own.
+    if( ! jobCount || now - lastJobAt >= jobMs ) {
+      PoolJob pj(++jobCount);
+      JobTemplate job;
+      if( ! jobTemplateDecode(&job, &pj.sb) ) {
+        return fail("job didn't decode");
+      }
+      templates[job.jobId] = job;
+      leaderPrevHashes.insert(std::string((const char*) job.prevHash, 32));
+      leader.setJob(&job, extraNonce1, extraNonce2Size, jobCount % 3 == 0);
+      lastJobAt = now;
+
+      PoolJob elsewhere(jobCount + 1000);
+      JobTemplate otherJob;
+      jobTemplateDecode(&otherJob, &elsewhere.sb);
+      rogue.setJob(&otherJob, extraNonce1, extraNonce2Size, true);
+      other.setJob(&otherJob, extraNonce1, extraNonce2Size, true);
+    }
+    ClusterShare ignored;
+    while( rogue.nextShare(ignored) || other.nextShare(ignored) );
+
+    // What the leader would put on the submit queue, checked from scratch
+    ClusterShare share;
+    while( leader.nextShare(share) ) {
+      checked++;
+      uint8_t extraNonce2[8];
+      hex2bin(extraNonce2, share.extraNonce2, strlen(share.extraNonce2));
+      uint8_t header[80], hash[32];
+      if( ! templates.count(share.jobId) || strlen(share.extraNonce2) != extraNonce2Size * 2 ||
+          ! jobTemplateHeader(&templates[share.jobId], extraNonce1, extraNonce2, extraNonce2Size, share.ntime, share.nonce, header) ||
+          jobTemplateHash(header, hash) < difficulty ) {
+        fprintf(stderr, "Bad share through the leader: job %s en2 %s nonce %08x\n", share.jobId, share.extraNonce2, share.nonce);
+        bad++;
+      }
+    }
+
+    for( SimFollower* f : followers ) {
+      f->follower.poll(now, f->hashes);
+      const ClusterJob* job = f->follower.job();
+      if( ! job ) {
+        continue;
+      }
+      if( ! leaderPrevHashes.count(std::string((const char*) &job->header[4], 32)) ) {
+        foreignJobs++;
+      }
+      if( job->seq != f->lastSeq ) {
+        // Once each, a share for a job the leader has long forgotten
+        if( f->lastSeq && ! f->sentStale ) {
+          f->follower.submit(f->lastSeq - CLUSTER_LEADER_JOBS, f->hb.timestamp, f->hb.nonce);
+          f->sentStale = true;
+          staleSent++;
+        }
+        memcpy(&f->hb, job->header, sizeof(hash_block));
+        sha256midstate(&f->midstate, &f->hb);
+        f->hb.nonce = rand();
+        f->lastSeq = job->seq;
+        prefixes.insert(job->prefix);
+      }
+
+      miner_sha256_hash ctx;
+      for( int n = 0; n < HASH_BATCH; n++ ) {
+        if( sha256header(&f->midstate, &ctx, &f->hb) && hashDifficulty(&ctx) >= job->difficulty ) {
+          f->follower.submit(job->seq, f->hb.timestamp, f->hb.nonce);
+          // Now and then the same one twice, or one that was never found
+          if( ++found % FORGE_EVERY == 0 ) {
+            f->follower.submit(job->seq, f->hb.timestamp, f->hb.nonce);
+            f->follower.submit(job->seq, f->hb.timestamp, f->hb.nonce ^ 0x5a5a5a5a);
+            invalidSent += 2;
+          }
+        }
+        f->hb.nonce++;
+      }
+      f->hashes += HASH_BATCH;
+    }
+  }
+
+  // Let the last packets land
+  for( int i = 0; i < 10; i++ ) {
+    leader.poll(nowMs());
+    ClusterShare share;
+    while( leader.nextShare(share) ) {
+      checked++;
+    }
+  }
+
+  uint64_t totalHashes = 0;
+  uint32_t received = 0, ignoredJobs = 0, sent = 0;
+  for( SimFollower* f : followers ) {
+    totalHashes += f->hashes;
+    received += f->follower.jobsReceived;
+    ignoredJobs += f->follower.jobsIgnored;
+    sent += f->follower.sharesSent;
+  }
+
+  printf("Followers:          %u of %d joined, %zu prefixes\n", leader.followers(), followerCount, prefixes.size());
+  printf("Pool jobs:          %u\n", jobCount);
+  printf("Cluster jobs:       %u sent, %u received, %u from the rogue ignored\n", leader.jobsSent, received, ignoredJobs);
+  printf("Shares:             %u found, %u sent, %u of them bad and %u stale on purpose\n", found, sent, invalidSent, staleSent);
+  printf("At the leader:      %u valid, %u invalid, %u stale\n", leader.sharesValid, leader.sharesInvalid, leader.sharesStale);
+  printf("Checked again here: %u, %u bad\n", checked, bad);
+  printf("Rogue leader:       %u jobs sent, %u mined by a follower\n", rogue.jobsSent, foreignJobs);
+  printf("Other cluster:      %u followers, %u packets rejected\n", other.followers(), other.packetsRejected);
+  printf("Hashrate:           %.0f H/s hashed, %.0f H/s as the leader heard it\n",
+      totalHashes / (double) seconds, leader.hashRate() * 1000.0);
+
+  if( bad ) {
+    return fail("the leader passed on shares that don't meet the difficulty");
+  }
+  if( checked != leader.sharesValid ) {
+    return fail("the leader lost shares it had already checked");
+  }
+  if( foreignJobs || ( rogue.jobsSent && ! ignoredJobs ) ) {
+    return fail("a follower took work from a leader it isn't following");
+  }
+  if( other.followers() || other.jobsSent || ! other.packetsRejected ) {
+    return fail("a leader with another key heard from the followers");
+  }
+  if( leader.followers() != followerCount || (int) prefixes.size() < followerCount ) {
+    return fail("not every follower joined with its own prefix");
+  }
+  // Nothing past here can be judged without shares and the rogue's work
+  if( ! found ) {
+    return fail("the run was too short for any follower to find a share; try more --seconds or a lower --difficulty");
+  }
+  if( ! rogue.jobsSent ) {
+    return fail("the run was too short for the rogue leader to offer any work; try more --seconds or a shorter --job-ms");
+  }
+  if( leader.sharesInvalid != invalidSent ) {
+    return fail("the leader didn't turn away exactly the bad shares");
+  }
+  // A real share can go stale too, if a clean job beats it to the leader
+  if( leader.sharesStale < staleSent || leader.sharesValid + leader.sharesStale - staleSent != found ) {
+    return fail("shares went missing between the followers and the leader");
+  }
+  if( ! leader.sharesValid ) {
+    return fail("no share made it through the leader");
+  }
+  printf("OK\n");
+  return 0;
+}
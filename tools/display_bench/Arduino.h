@@ -0,0 +1,128 @@
+// Enough of the Arduino core to build the display code on a PC.
+//
+// millis() and micros() read a simulated clock that only moves when the bench
+// or delay() moves it, so the same scene draws the same pixels every run.
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+typedef const char* PGM_P;
+typedef uint8_t byte;
+typedef int esp_err_t;
+#define ESP_OK 0
+
+#define ESP_ARDUINO_VERSION_VAL(major, minor, patch) ((major << 16) | (minor << 8) | (patch))
+#define ESP_ARDUINO_VERSION ESP_ARDUINO_VERSION_VAL(3, 0, 0)
+
+using std::min;
+using std::max;
+
+extern uint64_t hostMicros;
+inline unsigned long millis() { return hostMicros / 1000; }
+inline unsigned long micros() { return hostMicros; }
+inline void delay(uint32_t ms) { hostMicros += (uint64_t) ms * 1000; }
+
+#define portTICK_PERIOD_MS 1
+inline void vTaskDelay(uint32_t ticks) { delay(ticks); }
+
+#define INPUT 1
+#define OUTPUT 2
+#define INPUT_PULLUP 5
+#define FALLING 2
+#define CHANGE 3
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return 1; }
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline bool ledcAttach(uint8_t, uint32_t, uint8_t) { return true; }
+inline bool ledcWrite(uint8_t, uint32_t) { return true; }
+
+// newlib has it, glibc only recently
+inline size_t hostStrlcpy(char* dst, const char* src, size_t size) {
+  size_t len = strlen(src);
+  if( size ) {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+#define strlcpy hostStrlcpy
+
+class String {
+  public:
+    String() {}
+    String(const char* s) : s(s ? s : "") {}
+    String(const std::string& s) : s(s) {}
+    String(char c) : s(1, c) {}
+    String(int n) : s(std::to_string(n)) {}
+    String(unsigned int n) : s(std::to_string(n)) {}
+    String(long n) : s(std::to_string(n)) {}
+    String(unsigned long n) : s(std::to_string(n)) {}
+    String(double n, unsigned int decimals = 2) { char b[64]; snprintf(b, sizeof(b), "%.*f", decimals, n); s = b; }
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.length(); }
+    char charAt(unsigned int i) const { return i < s.length() ? s[i] : 0; }
+    String substring(unsigned int from) const { return from < s.length() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const { return from < to && from < s.length() ? String(s.substr(from, to - from)) : String(); }
+    double toDouble() const { return atof(s.c_str()); }
+    long toInt() const { return atol(s.c_str()); }
+    void trim() {
+      size_t a = s.find_first_not_of(" \t\r\n");
+      size_t b = s.find_last_not_of(" \t\r\n");
+      s = a == std::string::npos ? "" : s.substr(a, b - a + 1);
+    }
+    void replace(const String& from, const String& to) {
+      if( from.s.empty() ) {
+        return;
+      }
+      for( size_t at = s.find(from.s); at != std::string::npos; at = s.find(from.s, at + to.s.length()) ) {
+        s.replace(at, from.s.length(), to.s);
+      }
+    }
+
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator!=(const String& o) const { return s != o.s; }
+
+  private:
+    std::string s;
+};
+
+class IPAddress {
+  public:
+    IPAddress(uint32_t address = 0) : address(address) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t) d << 24) {}
+    operator uint32_t() const { return address; }
+    bool operator==(const IPAddress& o) const { return address == o.address; }
+    bool operator!=(const IPAddress& o) const { return address != o.address; }
+    String toString() const {
+      char b[16];
+      snprintf(b, sizeof(b), "%u.%u.%u.%u", address & 0xff, (address >> 8) & 0xff, (address >> 16) & 0xff, address >> 24);
+      return String(b);
+    }
+
+  private:
+    uint32_t address;
+};
+
+struct HostSerial {
+  template<typename... T> int printf(const char* format, T... args) { return fprintf(stderr, format, args...); }
+};
+static HostSerial Serial __attribute__((unused));
+
+#endif
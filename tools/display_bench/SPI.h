@@ -0,0 +1,15 @@
+// Host stand-in: the panels are framebuffers, so there's no bus to set up
+#ifndef SPI_H
+#define SPI_H
+
+#define VSPI 3
+#define HSPI 2
+
+class SPIClass {
+  public:
+    SPIClass(int bus = VSPI) { (void) bus; }
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) { (void) sck; (void) miso; (void) mosi; (void) ss; }
+};
+static SPIClass SPI __attribute__((unused));
+
+#endif
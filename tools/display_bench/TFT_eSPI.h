@@ -0,0 +1,108 @@
+// Host backend for the TFT: the parts of TFT_eSPI the screens use, drawing
+// into a Framebuffer instead of down the SPI bus.
+//
+// The numbered fonts live in the library, not this repository, so they're
+// stood in for by the nearest free font in my_fonts.h. Images match the
+// panel's layout rather than its exact glyphs.
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+#include <Arduino.h>
+#include "framebuffer.h"
+
+#ifndef TFT_WIDTH
+  #define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+  #define TFT_HEIGHT 320
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define PSRAM_ENABLE 3
+
+class TFT_eSPI {
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void init() {}
+    void setRotation(uint8_t r);
+    uint8_t getRotation() { return rotation; }
+    void invertDisplay(bool invert) { inverted = invert; }
+    int16_t width() { return rotation & 1 ? physHeight : physWidth; }
+    int16_t height() { return rotation & 1 ? physWidth : physHeight; }
+
+    void fillScreen(uint32_t color) { fillRect(0, 0, width(), height(), color); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+
+    void setTextColor(uint16_t fg) { textFg = textBg = fg; }
+    void setTextColor(uint16_t fg, uint16_t bg) { textFg = fg; textBg = bg; }
+    void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+    void setCursor(int16_t x, int16_t y, uint8_t font) { setTextFont(font); setCursor(x, y); }
+    void setTextFont(uint8_t font) { textFont = font; freeFont = NULL; }
+    void setFreeFont(const GFXfont* font) { freeFont = font; }
+
+    size_t print(const char* text);
+    size_t print(const String& text) { return print(text.c_str()); }
+    int16_t drawString(const char* text, int32_t x, int32_t y);
+    int16_t drawString(const String& text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+    int16_t textWidth(const char* text);
+    int16_t textWidth(const char* text, uint8_t font);
+    int16_t textWidth(const String& text) { return textWidth(text.c_str()); }
+    int16_t fontHeight();
+
+    void setSwapBytes(bool swap) { swapBytes = swap; }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+    void startWrite() {}
+    void endWrite() {}
+    bool initDMA(bool ctrlCS = false) { (void) ctrlCS; return true; }
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = NULL);
+    bool dmaBusy() { return false; }
+    void dmaWait() {}
+
+    // Host only
+    Framebuffer& frame() { return fb; }
+    uint32_t dmaTransfers;
+
+  protected:
+    void writePixel(int32_t x, int32_t y, uint16_t color);
+    void drawText(const char* text, int32_t x, int32_t y, bool topLeft, int32_t* endX);
+
+    Framebuffer fb;
+    int16_t physWidth;
+    int16_t physHeight;
+    uint8_t rotation;
+    bool inverted;
+    bool swapBytes;
+    uint16_t textFg;
+    uint16_t textBg;
+    int16_t cursorX;
+    int16_t cursorY;
+    uint8_t textFont;
+    const GFXfont* freeFont;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+  public:
+    TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), tft(tft) {}
+
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite() { fb.resize(0, 0); physWidth = physHeight = 0; }
+    bool created() { return physWidth > 0; }
+    void fillSprite(uint32_t color) { fillScreen(color); }
+    void pushSprite(int32_t x, int32_t y) { tft->pushImage(x, y, physWidth, physHeight, fb.data()); }
+    void* getPointer() { return fb.data(); }
+    void setAttribute(uint8_t id, uint8_t value) { (void) id; (void) value; }
+
+  private:
+    TFT_eSPI* tft;
+};
+
+#endif
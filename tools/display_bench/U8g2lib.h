@@ -0,0 +1,71 @@
+// Host backend for the OLED: the parts of U8g2 the screens use, drawing
+// into a 1 bit Framebuffer. sendBuffer() counts a full frame on the bus.
+//
+// U8g2's fonts aren't in this repository either; each is stood in for by a
+// free font from my_fonts.h of roughly the same size.
+#ifndef U8G2LIB_H
+#define U8G2LIB_H
+
+#include <Arduino.h>
+#include "framebuffer.h"
+
+#define U8G2_R0 0
+#define U8G2_R2 2
+#define U8X8_PIN_NONE 255
+
+extern const GFXfont* const u8g2HostFonts[3];
+#define u8g2_font_6x10_tf ((const uint8_t*) u8g2HostFonts[0])
+#define u8g2_font_profont12_tr ((const uint8_t*) u8g2HostFonts[0])
+#define u8g2_font_sirclive_tr ((const uint8_t*) u8g2HostFonts[0])
+#define u8g2_font_helvB12_tf ((const uint8_t*) u8g2HostFonts[1])
+#define u8g2_font_helvB18_tf ((const uint8_t*) u8g2HostFonts[2])
+#define u8g2_font_7_Seg_41x21_mn ((const uint8_t*) u8g2HostFonts[2])
+#define u8g2_font_freedoomr25_mn ((const uint8_t*) u8g2HostFonts[2])
+
+class U8G2 {
+  public:
+    U8G2() : fb(128, 64, false), sentFrames(0), font(NULL), cursorX(0), cursorY(0) { setMaxClipWindow(); }
+
+    bool begin() { return true; }
+    void clearBuffer();
+    void sendBuffer();
+    void setFont(const uint8_t* f) { font = (const GFXfont*) f; }
+    int16_t drawStr(int16_t x, int16_t y, const char* text);
+    int16_t getStrWidth(const char* text) { return font ? gfxTextWidth(font, text) : 0; }
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    void drawPixel(int16_t x, int16_t y);
+    void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+    size_t print(const char* text) { cursorX += drawStr(cursorX, cursorY, text); return strlen(text); }
+    size_t print(const String& text) { return print(text.c_str()); }
+    void setClipWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { clipX0 = x0; clipY0 = y0; clipX1 = x1; clipY1 = y1; }
+    void setMaxClipWindow() { setClipWindow(0, 0, 127, 63); }
+    void setDisplayRotation(uint8_t) {}
+
+    // Host only. The panel holds whatever was last sent.
+    Framebuffer& frame() { return panel; }
+    Framebuffer fb;
+    uint32_t sentFrames;
+
+  private:
+    Framebuffer panel = Framebuffer(128, 64, true);
+    const GFXfont* font;
+    int16_t cursorX;
+    int16_t cursorY;
+    int16_t clipX0, clipY0, clipX1, clipY1;
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(uint8_t rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE) {
+      (void) rotation; (void) reset; (void) clock; (void) data;
+    }
+};
+
+class U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI : public U8G2 {
+  public:
+    U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI(uint8_t rotation, uint8_t cs, uint8_t dc, uint8_t reset = U8X8_PIN_NONE) {
+      (void) rotation; (void) cs; (void) dc; (void) reset;
+    }
+};
+
+#endif
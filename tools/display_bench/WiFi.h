@@ -0,0 +1,32 @@
+// Host stand-in: a station that is never connected
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+typedef int WiFiEvent_t;
+typedef struct {} WiFiEventInfo_t;
+
+struct HostWiFi {
+  int status() { return WL_DISCONNECTED; }
+  bool isConnected() { return false; }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+  IPAddress dnsIP(uint8_t n = 0) { return n ? IPAddress(8, 8, 4, 4) : IPAddress(8, 8, 8, 8); }
+};
+static HostWiFi WiFi __attribute__((unused));
+
+class WiFiClient {
+  public:
+    bool connect(const char*, uint16_t) { return false; }
+    template<typename... T> int printf(const char*, T...) { return 0; }
+    size_t write(const uint8_t*, size_t len) { return len; }
+    int available() { return 0; }
+    int read() { return -1; }
+    void stop() {}
+};
+
+#endif
@@ -0,0 +1,10 @@
+// Host stand-in for the OLED's I2C bus
+#ifndef WIRE_H
+#define WIRE_H
+
+struct HostWire {
+  void begin(int sda = -1, int scl = -1) { (void) sda; (void) scl; }
+};
+static HostWire Wire __attribute__((unused));
+
+#endif
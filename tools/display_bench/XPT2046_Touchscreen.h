@@ -0,0 +1,16 @@
+// Host stand-in: nobody touches the screen during a bench run
+#ifndef XPT2046_TOUCHSCREEN_H
+#define XPT2046_TOUCHSCREEN_H
+
+#include <SPI.h>
+
+class XPT2046_Touchscreen {
+  public:
+    XPT2046_Touchscreen(uint8_t cs, uint8_t irq) { (void) cs; (void) irq; }
+    bool begin(SPIClass&) { return true; }
+    void setRotation(uint8_t) {}
+    bool touched() { return false; }
+    volatile bool isrWake = false;
+};
+
+#endif
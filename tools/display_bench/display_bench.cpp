@@ -0,0 +1,273 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Host bench for the screens.
+//
+// Builds the firmware's own display.cpp or OLEDdisplay.cpp against host
+// versions of TFT_eSPI and U8g2 that draw into a framebuffer. Each
+// scene is drawn from a fixed set of statistics and compared with the hash
+// recorded in golden_tft.txt or golden_oled.txt. The table shows how long a
+// frame takes on this machine, and how many pixels and DMA transfers it would
+// have sent to the panel, which is the part that costs on the device.
+//
+// From the repository root, for the 2.8" TFT:
+//   g++ -O2 -std=gnu++17 -DESP32_2432S028 -Itools/display_bench -Isrc
+//       tools/display_bench/*.cpp src/display.cpp src/display_images.cpp
+//       src/utils.cpp src/qrcode.cpp -o display_bench_tft && ./display_bench_tft
+//
+// and for the 128x64 OLED:
+//   g++ -O2 -std=gnu++17 -DESP32_SSD1306_128X64 -DOLED_SDA=23 -DOLED_SCL=22
+//       -Itools/display_bench -Isrc tools/display_bench/*.cpp src/OLEDdisplay.cpp
+//       src/utils.cpp -o display_bench_oled && ./display_bench_oled
+//
+// --update rewrites the golden file after an intended change to a screen.
+// --images DIR writes every scene out as a PPM or PGM to look at.
+//
+#include <Arduino.h>
+#include <chrono>
+#include <string>
+#include <map>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "utils.h"
+#include "MyWiFi.h"
+#include "fetchTask.h"
+
+#if defined(USE_OLED)
+  #include <U8g2lib.h>
+  #define GOLDEN_FILE "tools/display_bench/golden_oled.txt"
+#else
+  #include <TFT_eSPI.h>
+  #define GOLDEN_FILE "tools/display_bench/golden_tft.txt"
+#endif
+
+#define ITERATIONS 200
+
+uint64_t hostMicros = 1000000;
+
+SetupData settings;
+MonitorData monitorData;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// What the display code expects from the rest of the firmware
+//////////////////////////////////////////////////////////////////////////////////////////
+IPAddress MyWiFi::getIP() { return IPAddress(192, 168, 1, 77); }
+bool MyWiFi::isAccessPoint() { return false; }
+
+void notifyEventTaskFromISR(uint32_t bits) { (void) bits; }
+
+// Nothing is fetched on the host, so the screens show their fallbacks
+int8_t fetchRegister(const FetchSource* source) { (void) source; return 0; }
+bool fetchGet(int8_t id, void* value) { (void) id; (void) value; return false; }
+
+static uint32_t frameStart;
+uint32_t displayFrameStart() { return frameStart; }
+
+#if defined(USE_OLED)
+  #if defined(USE_OLED_SPI)
+    extern U8G2_SH1106_128X64_NONAME_F_4W_HW_SPI u8g2;
+  #else
+    extern U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2;
+  #endif
+  static Framebuffer& panel() { return u8g2.frame(); }
+  static uint32_t transfers() { return u8g2.sentFrames; }
+#else
+  extern TFT_eSPI tft;
+  static Framebuffer& panel() { return tft.frame(); }
+  static uint32_t transfers() { return tft.dmaTransfers; }
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Scenes
+//////////////////////////////////////////////////////////////////////////////////////////
+typedef struct {
+  const char* name;
+  void (*prepare)(int iteration);   // Set up the state; iteration 0 is the one compared
+  void (*draw)();
+} Scene;
+
+static void setStats(int variant) {
+  strcpy(monitorData.hashesPerSecondStr, variant & 1 ? "287.41" : "286.97");
+  strcpy(monitorData.totalHashesStr, variant & 1 ? "18.352G" : "18.351G");
+  strcpy(monitorData.bestDifficultyStr, "4.127M");
+  strcpy(monitorData.totalJobsStr, "1.284k");
+  strcpy(monitorData.poolSubmissionsStr, "312");
+  strcpy(monitorData.blocks32FoundStr, "4");
+  strcpy(monitorData.validBlocksFoundStr, "0");
+  monitorData.bestDifficulty = 4127000;
+  monitorData.isMining = true;
+  monitorData.wifiConnected = true;
+  monitorData.poolConnected = true;
+}
+
+static void nothing(int iteration) { (void) iteration; }
+// Iteration 0 differs from the defaults so the compared frame is a real update
+static void stats(int iteration) { setStats(iteration + 1); }
+static void clockTick(int iteration) { monitorData.currentTime = 1760000000 + ((iteration + 1) & 1) * 60; }
+
+static void draw() { refreshDisplay(); }
+
+#if defined(USE_OLED)
+
+static void mining() { setCurrentScreen(SCREEN_MINING); }
+static void clockScreen() { setCurrentScreen(3); }
+static void luck() { setCurrentScreen(4); }
+static void motivation() { setCurrentScreen(5); }
+static void blocks() { setCurrentScreen(6); }
+static void accessPoint() { setCurrentScreen(SCREEN_ACCESS_POINT); }
+
+static const Scene scenes[] = {
+  { "mining", nothing, mining },
+  { "mining-tick", stats, draw },
+  { "clock", clockTick, clockScreen },
+  { "luck", nothing, luck },
+  { "motivation", nothing, motivation },
+  { "blocks", nothing, blocks },
+  { "access-point", nothing, accessPoint },
+};
+
+#else
+
+static void landscape(int iteration) { (void) iteration; setRotation(1); }
+static void portrait(int iteration) { (void) iteration; setRotation(0); }
+
+static void mining() { setCurrentScreen(SCREEN_MINING); }
+static void clockScreen() { setCurrentScreen(SCREEN_CLOCK); }
+static void pageOne() { setCurrentScreen(SCREEN_ONE); }
+static void accessPoint() { setCurrentScreen(SCREEN_ACCESS_POINT); }
+static void firmware() { setCurrentScreen(SCREEN_FIRMWARE); }
+
+static const Scene scenes[] = {
+  { "mining-landscape", landscape, mining },
+  { "mining-idle", nothing, draw },
+  { "mining-tick", stats, draw },
+  { "mining-portrait", portrait, mining },
+  { "clock-landscape", landscape, clockScreen },
+  { "clock-tick", clockTick, draw },
+  { "page-one", nothing, pageOne },
+  { "firmware", nothing, firmware },
+  { "access-point", nothing, accessPoint },
+};
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Golden hashes
+//////////////////////////////////////////////////////////////////////////////////////////
+static std::map<std::string, uint32_t> loadGolden() {
+  std::map<std::string, uint32_t> golden;
+  FILE* f = fopen(GOLDEN_FILE, "r");
+  if( f ) {
+    char name[64];
+    unsigned int hash;
+    while( fscanf(f, "%63s %x", name, &hash) == 2 ) {
+      golden[name] = hash;
+    }
+    fclose(f);
+  }
+  return golden;
+}
+
+static bool saveGolden(const std::map<std::string, uint32_t>& golden) {
+  FILE* f = fopen(GOLDEN_FILE, "w");
+  if( ! f ) {
+    return false;
+  }
+  for( auto& g : golden ) {
+    fprintf(f, "%s %08x\n", g.first.c_str(), g.second);
+  }
+  fclose(f);
+  return true;
+}
+
+static void defaultSettings() {
+  memset(&settings, 0, sizeof(settings));
+  memset(&monitorData, 0, sizeof(monitorData));
+  settings.backgroundColor = 0x042045;
+  settings.foregroundColor = 0xffffff;
+  settings.screenRotation = 1;
+  settings.screenBrightness = 200;
+  settings.clock24 = false;
+  settings.utcOffset = -5 * 3600;
+  monitorData.currentTime = 1760000000;
+  setStats(0);
+}
+
+int main(int argc, char** argv) {
+  bool update = false;
+  const char* imageDir = NULL;
+  for( int i = 1; i < argc; i++ ) {
+    if( ! strcmp(argv[i], "--update") ) {
+      update = true;
+    } else if( ! strcmp(argv[i], "--images") && i + 1 < argc ) {
+      imageDir = argv[++i];
+    }
+  }
+
+  defaultSettings();
+  initializeDisplay(settings.screenRotation, settings.screenBrightness);
+
+  std::map<std::string, uint32_t> golden = loadGolden();
+  int failures = 0;
+
+  printf("%-18s %10s %12s %10s %10s\n", "scene", "host us", "panel px", "transfers", "hash");
+  for( const Scene& scene : scenes ) {
+
+    // The frame that's compared
+    scene.prepare(0);
+    uint64_t pixelsBefore = panel().written;
+    uint32_t transfersBefore = transfers();
+    frameStart = micros();
+    scene.draw();
+    uint64_t pixels = panel().written - pixelsBefore;
+    uint32_t sent = transfers() - transfersBefore;
+    uint32_t hash = panel().hash();
+
+    if( imageDir ) {
+      std::string path = std::string(imageDir) + "/" + scene.name + (panel().isMono() ? ".pgm" : ".ppm");
+      panel().writeImage(path.c_str());
+    }
+
+    // Then the same again to time it, finishing on the compared state
+    auto start = std::chrono::steady_clock::now();
+    for( int i = 1; i <= ITERATIONS; i++ ) {
+      scene.prepare(i);
+      frameStart = micros();
+      scene.draw();
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+    scene.prepare(0);
+    scene.draw();
+
+    const char* status = "ok";
+    auto g = golden.find(scene.name);
+    if( update ) {
+      golden[scene.name] = hash;
+      status = "updated";
+    } else if( g == golden.end() ) {
+      status = "new";
+    } else if( g->second != hash ) {
+      status = "DIFFERS";
+      failures++;
+    }
+    printf("%-18s %10.1f %12llu %10u   %08x %s\n", scene.name, us, (unsigned long long) pixels, sent, hash, status);
+  }
+
+  if( update && ! saveGolden(golden) ) {
+    printf("Couldn't write %s\n", GOLDEN_FILE);
+    return 1;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,13 @@
+// Host stand-in with a fixed MAC, so the access point page always looks the same
+#ifndef ESP_EFUSE_H
+#define ESP_EFUSE_H
+
+#include <Arduino.h>
+
+inline esp_err_t esp_efuse_mac_get_default(uint8_t* mac) {
+  static const uint8_t hostMac[6] = { 0x24, 0x0a, 0xc4, 0x12, 0x34, 0x56 };
+  memcpy(mac, hostMac, sizeof(hostMac));
+  return ESP_OK;
+}
+
+#endif
@@ -0,0 +1 @@
+// Nothing the display code needs from here on a PC
@@ -0,0 +1,84 @@
+#include "framebuffer.h"
+#include <stdio.h>
+
+Framebuffer::Framebuffer(int16_t width, int16_t height, bool mono) :
+  written(0), w(width), h(height), mono(mono), pixels((size_t) width * height, 0) {
+}
+
+void Framebuffer::set(int32_t x, int32_t y, uint16_t value) {
+  if( x < 0 || y < 0 || x >= w || y >= h ) {
+    return;
+  }
+  pixels[(size_t) y * w + x] = value;
+  written++;
+}
+
+uint16_t Framebuffer::get(int32_t x, int32_t y) const {
+  if( x < 0 || y < 0 || x >= w || y >= h ) {
+    return 0;
+  }
+  return pixels[(size_t) y * w + x];
+}
+
+void Framebuffer::resize(int16_t width, int16_t height) {
+  w = width;
+  h = height;
+  pixels.assign((size_t) w * h, 0);
+}
+
+// FNV-1a over the pixels and the size
+uint32_t Framebuffer::hash() const {
+  uint32_t hash = 2166136261u;
+  auto add = [&hash](uint16_t v) {
+    hash = (hash ^ (v & 0xff)) * 16777619u;
+    hash = (hash ^ (v >> 8)) * 16777619u;
+  };
+  add(w);
+  add(h);
+  for( uint16_t p : pixels ) {
+    add(p);
+  }
+  return hash;
+}
+
+bool Framebuffer::writeImage(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if( ! f ) {
+    return false;
+  }
+  fprintf(f, "%s\n%d %d\n255\n", mono ? "P5" : "P6", w, h);
+  for( uint16_t p : pixels ) {
+    if( mono ) {
+      fputc(p ? 255 : 0, f);
+    } else {
+      uint16_t c = (p >> 8) | (p << 8);
+      fputc(((c >> 11) & 0x1f) * 255 / 31, f);
+      fputc(((c >> 5) & 0x3f) * 255 / 63, f);
+      fputc((c & 0x1f) * 255 / 31, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+int16_t gfxTextWidth(const GFXfont* font, const char* text) {
+  int16_t width = 0;
+  for( ; *text; text++ ) {
+    uint8_t c = *text;
+    if( c >= font->first && c <= font->last ) {
+      width += font->glyph[c - font->first].xAdvance;
+    }
+  }
+  return width;
+}
+
+int16_t gfxAscent(const GFXfont* font) {
+  int16_t ascent = 0;
+  for( uint16_t c = font->first; c <= font->last; c++ ) {
+    int16_t a = -font->glyph[c - font->first].yOffset;
+    if( a > ascent ) {
+      ascent = a;
+    }
+  }
+  return ascent;
+}
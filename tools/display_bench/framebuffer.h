@@ -0,0 +1,76 @@
+// In-memory panel the host display backends draw into.
+//
+// Pixels are kept the way the panel would be sent them: RGB565 byte swapped
+// for the TFT, 0 or 1 for the OLED. Every pixel written is counted, which is
+// what a refresh would have cost on the bus.
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <vector>
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+class Framebuffer {
+  public:
+    Framebuffer(int16_t width, int16_t height, bool mono);
+
+    int16_t width() const { return w; }
+    int16_t height() const { return h; }
+    bool isMono() const { return mono; }
+
+    void set(int32_t x, int32_t y, uint16_t value);
+    uint16_t get(int32_t x, int32_t y) const;
+    void resize(int16_t width, int16_t height);
+    uint16_t* data() { return pixels.data(); }
+
+    uint32_t hash() const;
+    bool writeImage(const char* path) const;    // PPM for colour, PGM for mono
+
+    uint64_t written;
+
+  private:
+    int16_t w;
+    int16_t h;
+    bool mono;
+    std::vector<uint16_t> pixels;
+};
+
+// Adafruit GFX font rendering, shared by both backends. y is the baseline.
+// plot is called for each set pixel; returns the advance.
+template<typename Plot> int16_t drawGFXChar(const GFXfont* font, int32_t x, int32_t y, uint8_t c, Plot plot) {
+  if( c < font->first || c > font->last ) {
+    return 0;
+  }
+  const GFXglyph* g = &font->glyph[c - font->first];
+  const uint8_t* bits = font->bitmap + g->bitmapOffset;
+  uint32_t bit = 0;
+  for( int16_t row = 0; row < g->height; row++ ) {
+    for( int16_t col = 0; col < g->width; col++, bit++ ) {
+      if( bits[bit >> 3] & (0x80 >> (bit & 7)) ) {
+        plot(x + g->xOffset + col, y + g->yOffset + row);
+      }
+    }
+  }
+  return g->xAdvance;
+}
+
+int16_t gfxTextWidth(const GFXfont* font, const char* text);
+int16_t gfxAscent(const GFXfont* font);    // Tallest glyph above the baseline
+
+#endif
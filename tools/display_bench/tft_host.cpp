@@ -0,0 +1,154 @@
+#include "TFT_eSPI.h"
+#include "my_fonts.h"
+
+typedef struct {
+  const GFXfont* font;
+  uint8_t height;
+} NumberedFont;
+
+// Library fonts 1 to 8 by their nominal height, drawn with what we have
+static const NumberedFont numberedFonts[9] = {
+  { &overpass_mono_bold9pt7b, 8 },
+  { &overpass_mono_bold9pt7b, 8 },
+  { &overpass_mono_bold9pt7b, 16 },
+  { &overpass_mono_bold9pt7b, 16 },
+  { &FreeMonoBold10pt7b, 26 },
+  { &FreeMonoBold10pt7b, 26 },
+  { &overpass_mono_bold24pt7b, 48 },
+  { &overpass_mono_bold24pt7b, 48 },
+  { &overpass_mono_bold32pt7b, 75 },
+};
+
+static uint16_t swap16(uint16_t v) {
+  return (v >> 8) | (v << 8);
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) :
+  dmaTransfers(0), fb(w, h, false), physWidth(w), physHeight(h), rotation(0), inverted(false), swapBytes(false),
+  textFg(TFT_WHITE), textBg(TFT_WHITE), cursorX(0), cursorY(0), textFont(1), freeFont(NULL) {
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r & 3;
+}
+
+// Logical to panel coordinates, so what's drawn before a rotation stays put
+void TFT_eSPI::writePixel(int32_t x, int32_t y, uint16_t wire) {
+  if( x < 0 || y < 0 || x >= width() || y >= height() ) {
+    return;
+  }
+  switch( rotation ) {
+    case 0: fb.set(x, y, wire); break;
+    case 1: fb.set(physWidth - 1 - y, x, wire); break;
+    case 2: fb.set(physWidth - 1 - x, physHeight - 1 - y, wire); break;
+    case 3: fb.set(y, physHeight - 1 - x, wire); break;
+  }
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  writePixel(x, y, swap16(color));
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  uint16_t wire = swap16(color);
+  for( int32_t j = y; j < y + h; j++ ) {
+    for( int32_t i = x; i < x + w; i++ ) {
+      writePixel(i, j, wire);
+    }
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  uint16_t wire = swap16(color);
+  for( int32_t j = 0; j < h; j++ ) {
+    for( int32_t i = 0; i < w; i++ ) {
+      int32_t dx = i < r ? r - i : (i >= w - r ? i - (w - r - 1) : 0);
+      int32_t dy = j < r ? r - j : (j >= h - r ? j - (h - r - 1) : 0);
+      if( dx * dx + dy * dy <= r * r ) {
+        writePixel(x + i, y + j, wire);
+      }
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  for( int32_t j = 0; j < h; j++ ) {
+    for( int32_t i = 0; i < w; i++ ) {
+      uint16_t p = data[j * w + i];
+      writePixel(x + i, y + j, swapBytes ? swap16(p) : p);
+    }
+  }
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+  (void) buffer;
+  dmaTransfers++;
+  pushImage(x, y, w, h, data);
+}
+
+// Free fonts draw only their ink; numbered fonts fill their cell when given a background
+void TFT_eSPI::drawText(const char* text, int32_t x, int32_t y, bool topLeft, int32_t* endX) {
+  const GFXfont* font = freeFont;
+  int16_t cellHeight = 0;
+  if( ! font ) {
+    const NumberedFont& n = numberedFonts[textFont < 9 ? textFont : 1];
+    font = n.font;
+    cellHeight = n.height;
+    topLeft = true;
+  }
+
+  int32_t baseline = topLeft ? y + gfxAscent(font) : y;
+  uint16_t wire = swap16(textFg);
+  for( ; *text; text++ ) {
+    if( cellHeight && textBg != textFg ) {
+      uint8_t c = *text;
+      if( c >= font->first && c <= font->last ) {
+        fillRect(x, y, font->glyph[c - font->first].xAdvance, cellHeight, textBg);
+      }
+    }
+    x += drawGFXChar(font, x, baseline, *text, [this, wire](int32_t px, int32_t py) { writePixel(px, py, wire); });
+  }
+  if( endX ) {
+    *endX = x;
+  }
+}
+
+size_t TFT_eSPI::print(const char* text) {
+  int32_t x;
+  drawText(text, cursorX, cursorY, false, &x);
+  cursorX = x;
+  return strlen(text);
+}
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y) {
+  int32_t end;
+  drawText(text, x, y, true, &end);
+  return end - x;
+}
+
+int16_t TFT_eSPI::textWidth(const char* text) {
+  return freeFont ? gfxTextWidth(freeFont, text) : textWidth(text, textFont);
+}
+
+int16_t TFT_eSPI::textWidth(const char* text, uint8_t font) {
+  return gfxTextWidth(numberedFonts[font < 9 ? font : 1].font, text);
+}
+
+int16_t TFT_eSPI::fontHeight() {
+  return freeFont ? freeFont->yAdvance : numberedFonts[textFont < 9 ? textFont : 1].height;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  (void) frames;
+  physWidth = w;
+  physHeight = h;
+  fb.resize(w, h);
+  return fb.data();
+}
@@ -0,0 +1,54 @@
+#include "U8g2lib.h"
+#include "my_fonts.h"
+
+const GFXfont* const u8g2HostFonts[3] = { &WhiteRabbit_Regular10pt7b, &overpass_mono_bold9pt7b, &overpass_mono_bold24pt7b };
+
+void U8G2::clearBuffer() {
+  for( int16_t y = 0; y < 64; y++ ) {
+    for( int16_t x = 0; x < 128; x++ ) {
+      fb.set(x, y, 0);
+    }
+  }
+}
+
+// The whole buffer goes out every time, which is what a full buffer mode driver does
+void U8G2::sendBuffer() {
+  for( int16_t y = 0; y < 64; y++ ) {
+    for( int16_t x = 0; x < 128; x++ ) {
+      panel.set(x, y, fb.get(x, y));
+    }
+  }
+  sentFrames++;
+}
+
+void U8G2::drawPixel(int16_t x, int16_t y) {
+  if( x >= clipX0 && x <= clipX1 && y >= clipY0 && y <= clipY1 ) {
+    fb.set(x, y, 1);
+  }
+}
+
+int16_t U8G2::drawStr(int16_t x, int16_t y, const char* text) {
+  if( ! font ) {
+    return 0;
+  }
+  int16_t start = x;
+  for( ; *text; text++ ) {
+    x += drawGFXChar(font, x, y, *text, [this](int32_t px, int32_t py) { drawPixel(px, py); });
+  }
+  return x - start;
+}
+
+void U8G2::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  int16_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+  int16_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+  while( 1 ) {
+    drawPixel(x0, y0);
+    if( x0 == x1 && y0 == y1 ) {
+      break;
+    }
+    int16_t e2 = 2 * err;
+    if( e2 >= dy ) { err += dy; x0 += sx; }
+    if( e2 <= dx ) { err += dx; y0 += sy; }
+  }
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Local stand-in for the kontinyu API the OLED screens read, for trying the
+# background fetch task against a server that misbehaves on purpose.
+#
+# Point a build at it with a flag in platformio.ini:
+#   build_flags = ... -DKONTINYU_API_URL=\"http://192.168.1.10:8080/api.php\"
+#
+# then, for example:
+#   python3 tools/fetch_standin.py --delay 20            # slower than the miner's timeout
+#   python3 tools/fetch_standin.py --fail-every 2        # every other request is a 500
+#   python3 tools/fetch_standin.py --oversize            # longer than the miner will accept
+#
+# Each request is logged with the time since the one before, which shows
+# the TTL and the retry backoff at work. The screens should keep cycling
+# whatever this does; /metrics on the miner counts the outcomes.
+
+import argparse
+import json
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+MOTIVATION = "Every hash is a lottery ticket. Keep mining!"
+
+
+class Handler(BaseHTTPRequestHandler):
+    count = 0
+    last = None
+
+    def do_GET(self):
+        cls = type(self)
+        cls.count += 1
+        now = time.monotonic()
+        since = "" if cls.last is None else " (+%.1fs)" % (now - cls.last)
+        cls.last = now
+        args = self.server.args
+        sys.stderr.write("#%d %s %s%s\n" % (cls.count, self.command, self.path, since))
+
+        if self.path.split("?")[0] != "/api.php":
+            self.reply(404, b"not found", "text/plain")
+            return
+        if args.delay:
+            time.sleep(args.delay)
+        if args.status != 200:
+            self.reply(args.status, b"{}", "application/json")
+            return
+        if args.fail_every and cls.count % args.fail_every == 0:
+            self.reply(500, b"{}", "application/json")
+            return
+
+        doc = {
+            "btcPrice": "67,512",
+            "blockHeight": "915204",
+            "globalHashrate": "1.02 ZH/s",
+            "difficulty": "146.47 T",
+            "difficultyRaw": args.difficulty,
+            "minermotivation": args.motivation,
+        }
+        if args.oversize:
+            doc["padding"] = "x" * 2048
+        self.reply(200, json.dumps(doc).encode(), "application/json")
+
+    def reply(self, code, body, content_type):
+        self.send_response(code)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, format, *args):
+        pass
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stand-in for the API the OLED screens fetch")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--delay", type=float, default=0, help="seconds to wait before replying")
+    parser.add_argument("--status", type=int, default=200, help="reply with this status every time")
+    parser.add_argument("--fail-every", type=int, default=0, help="make every Nth request a 500")
+    parser.add_argument("--oversize", action="store_true", help="pad the reply past the miner's buffer")
+    parser.add_argument("--difficulty", type=float, default=146472570619930.8)
+    parser.add_argument("--motivation", default=MOTIVATION)
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("", args.port), Handler)
+    server.args = args
+    sys.stderr.write("Serving /api.php on port %d\n" % args.port)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,51 @@
+// Just enough of the Arduino core to build the firmware's job, cluster and pool transport code on a PC.
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <chrono>
+#include <random>
+#include <thread>
+
+#define PROGMEM
+#define IRAM_ATTR
+
+struct HostSerial {
+  template<typename... T> int printf(const char* format, T... args) { return ::fprintf(stderr, format, args...); }
+};
+static HostSerial Serial __attribute__((unused));
+
+static inline uint32_t millis() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (uint32_t) duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+// FreeRTOS, with a tick of a millisecond
+#define portTICK_PERIOD_MS 1
+static inline void vTaskDelay(uint32_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+static inline void esp_fill_random(void* buf, size_t len) {
+  static std::random_device rd;
+  for( size_t i = 0; i < len; i++ ) {
+    ((uint8_t*) buf)[i] = rd();
+  }
+}
+
+class String {
+  public:
+    String() {}
+    String(const char* s) : s(s ? s : "") {}
+    const char* c_str() const { return s.c_str(); }
+    size_t length() const { return s.length(); }
+  private:
+    std::string s;
+};
+
+#endif
@@ -0,0 +1,17 @@
+// Host stand-in: a merkle branch is all the job code reads from JSON
+#ifndef ARDUINOJSON_H
+#define ARDUINOJSON_H
+
+#include <Arduino.h>
+#include <vector>
+
+class JsonArray {
+  public:
+    void add(const char* s) { items.push_back(s); }
+    size_t size() const { return items.size(); }
+    const char* operator[](size_t i) const { return items[i]; }
+  private:
+    std::vector<const char*> items;
+};
+
+#endif
@@ -0,0 +1,149 @@
+// WiFiClient on POSIX sockets, for the firmware's pool transports on a PC.
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <errno.h>
+
+class IPAddress {
+  public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { bytes[0] = a; bytes[1] = b; bytes[2] = c; bytes[3] = d; }
+    uint8_t operator[](int i) const { return bytes[i]; }
+    bool fromString(const char* s) { return inet_pton(AF_INET, s, bytes) == 1; }
+  private:
+    uint8_t bytes[4] = {0, 0, 0, 0};
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t* buf, size_t size) = 0;
+    size_t write(const char* s) { return write((const uint8_t*) s, strlen(s)); }
+};
+
+class Client : public Print {
+  public:
+    virtual int connect(IPAddress ip, uint16_t port) = 0;
+    virtual int connect(const char* host, uint16_t port) = 0;
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int read(uint8_t* buf, size_t size) = 0;
+    virtual int peek() = 0;
+    virtual void flush() = 0;
+    virtual void stop() = 0;
+    virtual uint8_t connected() = 0;
+};
+
+// Reads never block, as with lwIP underneath the real one
+class WiFiClient : public Client {
+  public:
+    ~WiFiClient() { stop(); }
+
+    int connect(IPAddress ip, uint16_t port) {
+      stop();
+      fd = socket(AF_INET, SOCK_STREAM, 0);
+      sockaddr_in sa = {};
+      sa.sin_family = AF_INET;
+      sa.sin_port = htons(port);
+      for( int i = 0; i < 4; i++ ) {
+        ((uint8_t*) &sa.sin_addr)[i] = ip[i];
+      }
+      if( fd < 0 || ::connect(fd, (sockaddr*) &sa, sizeof(sa)) != 0 ) {
+        stop();
+        return 0;
+      }
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      open = true;
+      return 1;
+    }
+    int connect(const char* host, uint16_t port) {
+      IPAddress ip;
+      return ip.fromString(host) ? connect(ip, port) : 0;
+    }
+    void setNoDelay(bool on) {
+      int v = on;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v));
+    }
+
+    size_t write(uint8_t b) { return write(&b, 1); }
+    size_t write(const uint8_t* buf, size_t size) {
+      size_t sent = 0;
+      while( open && sent < size ) {
+        ssize_t n = send(fd, buf + sent, size - sent, MSG_NOSIGNAL);
+        if( n > 0 ) {
+          sent += n;
+        } else if( n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) ) {
+          vTaskDelay(1);
+        } else {
+          open = false;
+        }
+      }
+      return sent;
+    }
+    int available() {
+      fill();
+      return pending;
+    }
+    int read() {
+      uint8_t b;
+      return read(&b, 1) == 1 ? b : -1;
+    }
+    int read(uint8_t* buf, size_t size) {
+      fill();
+      if( ! pending ) {
+        return -1;
+      }
+      size_t n = size < (size_t) pending ? size : pending;
+      memcpy(buf, buffer + start, n);
+      start += n;
+      pending -= n;
+      return n;
+    }
+    int peek() {
+      fill();
+      return pending ? buffer[start] : -1;
+    }
+    void flush() {}
+    void stop() {
+      if( fd >= 0 ) {
+        close(fd);
+      }
+      fd = -1;
+      open = false;
+      pending = 0;
+    }
+    uint8_t connected() {
+      fill();
+      return open || pending > 0;
+    }
+
+  private:
+    int fd = -1;
+    bool open = false;
+    uint8_t buffer[4096];
+    size_t start = 0;
+    int pending = 0;
+
+    void fill() {
+      if( pending || ! open ) {
+        return;
+      }
+      ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+      if( n > 0 ) {
+        start = 0;
+        pending = n;
+      } else if( n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK) ) {
+        open = false;
+      }
+    }
+};
+
+#endif
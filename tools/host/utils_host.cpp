@@ -0,0 +1,49 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// The bits of src/utils.cpp the firmware's job and cluster code use on a
+// PC. The rest of that file needs a miner. Linked into each of the host
+// tools.
+//
+#include <Arduino.h>
+#include "utils.h"
+
+unsigned char decodeHexChar(char c) {
+  if( c >= '0' && c <= '9' ) return c - '0';
+  if( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+  if( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+  return 0;
+}
+
+void hex2bin(unsigned char *out, const char *in, size_t len) {
+  for( size_t i = 0; i < len; i += 2 ) {
+    *out++ = (decodeHexChar(in[i]) << 4) | decodeHexChar(in[i + 1]);
+  }
+}
+
+void bin2hex(char *out, unsigned char* in, size_t len) {
+  static const char tbl[] = "0123456789ABCDEF";
+  for( size_t i = 0; i < len; i++ ) {
+    *out++ = tbl[(in[i] >> 4) & 0x0f];
+    *out++ = tbl[in[i] & 0x0f];
+  }
+  *out = 0;
+}
+
+char *safeStrnCpy(char *dest, const char* src, size_t num) {
+  strncpy(dest, src, num);
+  dest[num - 1] = 0;
+  return dest;
+}
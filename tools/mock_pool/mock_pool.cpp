@@ -0,0 +1,992 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Mock stratum v1 pool, for running the miner's stratum task end to end
+// without a real pool.
+//
+// Jobs go out at a set cadence with whatever difficulty, extranonce sizes
+// and merkle depth are asked for. Every share is rebuilt into a header and
+// hashed with the firmware's own job template and SHA-256 code, then
+// accepted or turned away for the same reasons a pool would. It can also
+// misbehave on purpose: drop connections, dribble lines out slowly, send
+// broken JSON, and reject good shares. Every so often, and on the way out,
+// it prints share counts and latencies.
+//
+// From the repository root:
+//   g++ -O2 -DESP32_DEV_HEADLESS -Itools/host -Isrc
+//       tools/mock_pool/mock_pool.cpp tools/host/utils_host.cpp
+//       src/jobTemplate.cpp src/MinerSha256.cpp -o mock_pool && ./mock_pool
+//
+// then point the miner at this machine and port 3336. For example:
+//   ./mock_pool --difficulty 0.001 --job-seconds 10 --clean-every 2
+//   ./mock_pool --en1-size 8 --en2-size 2 --merkle-depth 12
+//   ./mock_pool --disconnect-every 120          # each connection dropped after 2 minutes
+//   ./mock_pool --slow-every 5 --slow-ms 3000   # every 5th line arrives in two halves
+//   ./mock_pool --malformed-every 3             # every 3rd job comes after a broken line
+//   ./mock_pool --reject-every 4                # every 4th good share rejected anyway
+//
+// tools/tls_pool_proxy.py in front of it gives a TLS pool.
+//
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "jobTemplate.h"
+
+#define LINE_MAX_LENGTH 4096
+#define JOBS_KEPT 8                   // Older jobs are unknown, clean or not
+#define MAX_CLIENTS 32
+#define ERROR_OTHER 20
+#define ERROR_JOB_NOT_FOUND 21
+#define ERROR_DUPLICATE 22
+#define ERROR_LOW_DIFFICULTY 23
+#define ERROR_UNAUTHORIZED 24
+
+static uint64_t nowMs() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+static uint64_t nowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string randomHex(size_t bytes) {
+  std::string s;
+  char b[3];
+  for( size_t i = 0; i < bytes; i++ ) {
+    snprintf(b, sizeof(b), "%02x", rand() & 0xff);
+    s += b;
+  }
+  return s;
+}
+
+static bool isHex(const std::string& s, size_t length) {
+  if( s.length() != length ) {
+    return false;
+  }
+  for( char c : s ) {
+    if( ! isxdigit((unsigned char) c) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Just enough JSON to read what a miner sends
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Json {
+  enum Type { NUL, BOOL, NUM, STR, ARR, OBJ } type = NUL;
+  bool b = false;
+  double n = 0;
+  std::string s;
+  std::vector<Json> items;
+  std::vector<std::string> keys;    // For OBJ, alongside items
+
+  const Json* get(const char* key) const {
+    for( size_t i = 0; i < keys.size(); i++ ) {
+      if( keys[i] == key ) {
+        return &items[i];
+      }
+    }
+    return NULL;
+  }
+  const Json* at(size_t i) const {
+    return type == ARR && i < items.size() ? &items[i] : NULL;
+  }
+};
+
+static void skipSpace(const char*& p) {
+  while( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' ) {
+    p++;
+  }
+}
+
+static bool parseString(const char*& p, std::string& out) {
+  if( *p++ != '"' ) {
+    return false;
+  }
+  while( *p && *p != '"' ) {
+    if( *p == '\\' ) {
+      p++;
+      switch( *p ) {
+        case 'n': out += '\n'; break;
+        case 't': out += '\t'; break;
+        case 'r': out += '\r'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'u':
+          for( int i = 1; i <= 4; i++ ) {
+            if( ! isxdigit((unsigned char) p[i]) ) {
+              return false;
+            }
+          }
+          out += '?';
+          p += 4;
+          break;
+        case 0: return false;
+        default: out += *p;
+      }
+      p++;
+    } else {
+      out += *p++;
+    }
+  }
+  if( *p != '"' ) {
+    return false;
+  }
+  p++;
+  return true;
+}
+
+static bool parseJson(const char*& p, Json& v, int depth = 0) {
+  if( depth > 8 ) {
+    return false;
+  }
+  skipSpace(p);
+  if( *p == '{' || *p == '[' ) {
+    bool object = *p == '{';
+    char close = object ? '}' : ']';
+    v.type = object ? Json::OBJ : Json::ARR;
+    p++;
+    skipSpace(p);
+    if( *p == close ) {
+      p++;
+      return true;
+    }
+    while( true ) {
+      if( object ) {
+        skipSpace(p);
+        std::string key;
+        if( ! parseString(p, key) ) {
+          return false;
+        }
+        skipSpace(p);
+        if( *p++ != ':' ) {
+          return false;
+        }
+        v.keys.push_back(key);
+      }
+      v.items.emplace_back();
+      if( ! parseJson(p, v.items.back(), depth + 1) ) {
+        return false;
+      }
+      skipSpace(p);
+      if( *p == ',' ) {
+        p++;
+      } else if( *p == close ) {
+        p++;
+        return true;
+      } else {
+        return false;
+      }
+    }
+  }
+  if( *p == '"' ) {
+    v.type = Json::STR;
+    return parseString(p, v.s);
+  }
+  if( ! strncmp(p, "true", 4) || ! strncmp(p, "false", 5) ) {
+    v.type = Json::BOOL;
+    v.b = *p == 't';
+    p += v.b ? 4 : 5;
+    return true;
+  }
+  if( ! strncmp(p, "null", 4) ) {
+    p += 4;
+    return true;
+  }
+  char* end;
+  v.n = strtod(p, &end);
+  if( end == p ) {
+    return false;
+  }
+  v.type = Json::NUM;
+  p = end;
+  return true;
+}
+
+static std::string quote(const std::string& s) {
+  std::string out = "\"";
+  for( char c : s ) {
+    if( c == '"' || c == '\\' ) {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+// The request id as it should go back: numbers and strings as sent
+static std::string idText(const Json* id) {
+  char b[32];
+  if( ! id || id->type == Json::NUL ) {
+    return "null";
+  }
+  if( id->type == Json::STR ) {
+    return quote(id->s);
+  }
+  snprintf(b, sizeof(b), "%.0f", id->n);
+  return b;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Settings and statistics
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+  uint16_t port = 3336;
+  double difficulty = 0.001;
+  bool honorSuggest = false;
+  uint32_t jobSeconds = 30;
+  uint32_t cleanEvery = 4;            // Every Nth job is clean; 1 makes them all clean
+  int en1Size = 4;
+  int en2Size = 4;
+  int merkleDepth = 6;
+  uint32_t versionMask = 0;           // Offered to mining.configure when set
+  uint32_t ntimeAhead = 600;          // Seconds past our clock a share may go
+  uint32_t disconnectEvery = 0;       // Seconds after connecting
+  uint32_t slowEvery = 0;
+  uint32_t slowMs = 2000;
+  uint32_t malformedEvery = 0;
+  uint32_t rejectEvery = 0;
+  bool noResume = false;
+  uint32_t reportSeconds = 60;
+  uint32_t duration = 0;
+  bool verbose = false;
+};
+
+static Options opt;
+
+// Milliseconds; sorted only when reported
+struct Samples {
+  std::vector<double> v;
+
+  void add(double x) { v.push_back(x); }
+  double pct(double p) {
+    if( v.empty() ) {
+      return 0;
+    }
+    std::sort(v.begin(), v.end());
+    return v[(size_t) (p * (v.size() - 1) + 0.5)];
+  }
+  void print(const char* name) {
+    if( v.empty() ) {
+      printf("  %-30s none\n", name);
+      return;
+    }
+    printf("  %-30s n=%-6zu p50 %-9.1f p90 %-9.1f p99 %-9.1f max %.1f\n", name, v.size(), pct(0.5), pct(0.9), pct(0.99), pct(1.0));
+  }
+};
+
+struct Stats {
+  uint32_t connections = 0;
+  uint32_t resumes = 0;
+  uint32_t jobs = 0;
+  uint32_t accepted = 0;
+  uint32_t stale = 0;
+  uint32_t duplicate = 0;
+  uint32_t lowDifficulty = 0;
+  uint32_t bad = 0;
+  uint32_t unauthorized = 0;
+  uint32_t injectedRejects = 0;
+  uint32_t injectedDisconnects = 0;
+  uint32_t slowLines = 0;
+  uint32_t malformedLines = 0;
+  uint32_t blocks = 0;
+  double acceptedDifficulty = 0;
+  Samples jobAge;             // Share arrival less when its job went out
+  Samples firstShare;         // First share on each job a miner was sent
+  Samples staleAfterClean;    // Shares for replaced work, less when the clean job went out
+  Samples verifyUs;           // Our own cost of checking one share
+  uint64_t since = 0;
+};
+
+static Stats stats;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Jobs
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Job {
+  std::string id;
+  JobTemplate tmpl;
+  std::string params;         // mining.notify params, less clean_jobs
+  bool clean;
+  uint64_t sentAt;
+  uint64_t replacedAt = 0;    // When a clean job made it stale
+  std::set<std::string> shares;
+};
+
+static std::deque<Job> jobs;
+static uint32_t jobCounter = 0;
+static uint32_t blockHeight = 900000;
+static std::string prevHash;
+
+// Builds a plausible job: a coinbase with a BIP34 height where the miner
+// looks for one, and a merkle branch of the requested depth
+static Job& newJob(uint64_t now) {
+  bool clean = jobs.empty() || (opt.cleanEvery && ++jobCounter % opt.cleanEvery == 0);
+  if( clean || prevHash.empty() ) {
+    prevHash = randomHex(32);
+    blockHeight++;
+  }
+
+  char id[16], ntime[16], height[16];
+  snprintf(id, sizeof(id), "%x", ++stats.jobs);
+  snprintf(ntime, sizeof(ntime), "%08lx", (unsigned long) time(NULL));
+  snprintf(height, sizeof(height), "%02x%02x%02x", blockHeight & 0xff, (blockHeight >> 8) & 0xff, (blockHeight >> 16) & 0xff);
+
+  std::string coinbase1 = "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff";
+  std::string script = std::string("03") + height + randomHex(8);
+  char scriptLength[4];
+  snprintf(scriptLength, sizeof(scriptLength), "%02zx", script.length() / 2 + opt.en1Size + opt.en2Size);
+  coinbase1 += scriptLength + script;
+  std::string coinbase2 = "ffffffff01" + randomHex(8) + "1976a914" + randomHex(20) + "88ac00000000";
+
+  std::vector<std::string> branch;
+  JsonArray merkle;
+  for( int i = 0; i < opt.merkleDepth; i++ ) {
+    branch.push_back(randomHex(32));
+  }
+  for( const std::string& b : branch ) {
+    merkle.add(b.c_str());
+  }
+
+  stratum_block sb;
+  sb.jobId = id;
+  sb.prevHash = prevHash.c_str();
+  sb.coinBase1 = coinbase1.c_str();
+  sb.coinBase2 = coinbase2.c_str();
+  sb.merkleBranch = merkle;
+  sb.version = "20000000";
+  sb.difficulty = "17034219";
+  sb.nTime = ntime;
+  sb.cleanJobs = clean;
+
+  if( clean ) {
+    for( Job& j : jobs ) {
+      if( ! j.replacedAt ) {
+        j.replacedAt = now;
+      }
+    }
+  }
+  jobs.emplace_back();
+  Job& job = jobs.back();
+  job.id = id;
+  job.clean = clean;
+  job.sentAt = now;
+  if( ! jobTemplateDecode(&job.tmpl, &sb) ) {
+    fprintf(stderr, "Job %s doesn't fit a JobTemplate; try a smaller merkle depth\n", id);
+    exit(2);
+  }
+
+  job.params = quote(id) + "," + quote(prevHash) + "," + quote(coinbase1) + "," + quote(coinbase2) + ",[";
+  for( size_t i = 0; i < branch.size(); i++ ) {
+    job.params += (i ? "," : "") + quote(branch[i]);
+  }
+  job.params += "]," + quote("20000000") + "," + quote("17034219") + "," + quote(ntime);
+
+  while( jobs.size() > JOBS_KEPT ) {
+    jobs.pop_front();
+  }
+  return job;
+}
+
+static Job* findJob(const std::string& id) {
+  for( Job& j : jobs ) {
+    if( j.id == id ) {
+      return &j;
+    }
+  }
+  return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Connections
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// Output waiting for its time; slow lines are split across two of these
+struct Pending {
+  std::string data;
+  uint64_t due;
+};
+
+struct Client {
+  int fd;
+  uint32_t number;
+  uint64_t connectedAt;
+  std::string in;
+  std::deque<Pending> out;
+  bool subscribed = false;
+  bool authorized = false;
+  std::string extraNonce1;
+  std::string sessionId;
+  double difficulty;
+  std::string worker;
+  uint32_t linesSent = 0;
+  uint32_t jobsSent = 0;
+  std::set<std::string> sharedOn;     // Jobs it's found a share for already
+  uint32_t accepted = 0;
+  uint32_t rejected = 0;
+};
+
+static std::vector<Client*> clients;
+static std::map<std::string, std::string> sessions;     // Session id to extranonce1
+static uint32_t connectionCounter = 0;
+static volatile bool stopping = false;
+
+static void sendLine(Client* c, const std::string& line, bool mayBreak) {
+  uint64_t due = c->out.empty() ? nowMs() : c->out.back().due;
+  std::string data = line + "\n";
+  c->linesSent++;
+
+  if( mayBreak && opt.malformedEvery && c->jobsSent % opt.malformedEvery == 0 ) {
+    c->out.push_back({ line.substr(0, line.length() / 2) + "\n", due });
+    stats.malformedLines++;
+  }
+  if( opt.slowEvery && c->linesSent % opt.slowEvery == 0 ) {
+    size_t half = data.length() / 2;
+    c->out.push_back({ data.substr(0, half), due });
+    c->out.push_back({ data.substr(half), due + opt.slowMs });
+    stats.slowLines++;
+  } else {
+    c->out.push_back({ data, due });
+  }
+  if( opt.verbose ) {
+    printf("#%u < %s\n", c->number, line.c_str());
+  }
+}
+
+static void reply(Client* c, const Json* id, const std::string& result) {
+  sendLine(c, "{\"id\":" + idText(id) + ",\"result\":" + result + ",\"error\":null}", false);
+}
+
+static void replyError(Client* c, const Json* id, int code, const char* message) {
+  char b[160];
+  snprintf(b, sizeof(b), ",\"result\":null,\"error\":[%d,%s,null]}", code, quote(message).c_str());
+  sendLine(c, "{\"id\":" + idText(id) + b, false);
+}
+
+static void sendDifficulty(Client* c) {
+  char b[96];
+  snprintf(b, sizeof(b), "{\"id\":null,\"method\":\"mining.set_difficulty\",\"params\":[%.10g]}", c->difficulty);
+  sendLine(c, b, false);
+}
+
+static void sendJob(Client* c, const Job& job, bool clean) {
+  c->jobsSent++;
+  sendLine(c, "{\"id\":null,\"method\":\"mining.notify\",\"params\":[" + job.params + (clean ? ",true]}" : ",false]}"), true);
+}
+
+static void closeClient(Client* c, const char* why) {
+  printf("#%u closed: %s (%u accepted, %u rejected)\n", c->number, why, c->accepted, c->rejected);
+  close(c->fd);
+  clients.erase(std::find(clients.begin(), clients.end(), c));
+  delete c;
+}
+
+static void handleSubscribe(Client* c, const Json* id, const Json* params) {
+  const Json* offered = params ? params->at(1) : NULL;
+  if( offered && offered->type == Json::STR && ! opt.noResume && sessions.count(offered->s) ) {
+    c->sessionId = offered->s;
+    c->extraNonce1 = sessions[offered->s];
+    stats.resumes++;
+    printf("#%u resumed session %s\n", c->number, c->sessionId.c_str());
+  } else {
+    c->sessionId = randomHex(8);
+    c->extraNonce1 = randomHex(opt.en1Size);
+    sessions[c->sessionId] = c->extraNonce1;
+  }
+  c->subscribed = true;
+
+  char b[256];
+  snprintf(b, sizeof(b), "[[[\"mining.set_difficulty\",%s],[\"mining.notify\",%s]],%s,%d]",
+      quote(c->sessionId).c_str(), quote(c->sessionId).c_str(), quote(c->extraNonce1).c_str(), opt.en2Size);
+  reply(c, id, b);
+}
+
+static void handleAuthorize(Client* c, const Json* id, const Json* params) {
+  const Json* user = params ? params->at(0) : NULL;
+  if( ! c->subscribed || ! user || user->type != Json::STR ) {
+    replyError(c, id, ERROR_UNAUTHORIZED, "Unauthorized worker");
+    return;
+  }
+  c->worker = user->s;
+  bool first = ! c->authorized;
+  c->authorized = true;
+  reply(c, id, "true");
+  printf("#%u authorized as %s\n", c->number, c->worker.c_str());
+
+  if( first && ! jobs.empty() ) {
+    sendDifficulty(c);
+    sendJob(c, jobs.back(), true);
+  }
+}
+
+static void handleConfigure(Client* c, const Json* id) {
+  char b[96];
+  if( opt.versionMask ) {
+    snprintf(b, sizeof(b), "{\"version-rolling\":true,\"version-rolling.mask\":\"%08x\"}", opt.versionMask);
+  } else {
+    snprintf(b, sizeof(b), "{\"version-rolling\":false}");
+  }
+  reply(c, id, b);
+}
+
+static void handleSuggest(Client* c, const Json* id, const Json* params) {
+  const Json* d = params ? params->at(0) : NULL;
+  reply(c, id, "true");
+  if( opt.honorSuggest && d && d->type == Json::NUM && d->n > 0 && d->n != c->difficulty ) {
+    c->difficulty = d->n;
+    sendDifficulty(c);
+  }
+}
+
+static std::string param(const Json* params, size_t i) {
+  const Json* p = params ? params->at(i) : NULL;
+  return p && p->type == Json::STR ? p->s : "";
+}
+
+static void handleSubmit(Client* c, const Json* id, const Json* params) {
+  uint64_t now = nowMs();
+  uint64_t start = nowUs();
+
+  if( ! c->authorized ) {
+    stats.unauthorized++;
+    c->rejected++;
+    replyError(c, id, ERROR_UNAUTHORIZED, "Unauthorized worker");
+    return;
+  }
+
+  std::string jobId = param(params, 1);
+  std::string en2 = param(params, 2);
+  std::string ntime = param(params, 3);
+  std::string nonce = param(params, 4);
+  std::string versionBits = param(params, 5);
+
+  Job* job = findJob(jobId);
+  if( ! job || job->replacedAt ) {
+    stats.stale++;
+    c->rejected++;
+    if( job ) {
+      stats.staleAfterClean.add(now - job->replacedAt);
+    }
+    replyError(c, id, ERROR_JOB_NOT_FOUND, "Job not found");
+    return;
+  }
+  if( ! isHex(en2, opt.en2Size * 2) || ! isHex(ntime, 8) || ! isHex(nonce, 8) ||
+      (! versionBits.empty() && ! isHex(versionBits, 8)) ) {
+    stats.bad++;
+    c->rejected++;
+    replyError(c, id, ERROR_OTHER, "Malformed submit");
+    return;
+  }
+
+  uint32_t shareTime = strtoul(ntime.c_str(), NULL, 16);
+  if( shareTime < job->tmpl.ntime || shareTime > (uint32_t) time(NULL) + opt.ntimeAhead ) {
+    stats.bad++;
+    c->rejected++;
+    replyError(c, id, ERROR_OTHER, "Time out of range");
+    return;
+  }
+
+  JobTemplate tmpl = job->tmpl;
+  if( ! versionBits.empty() ) {
+    uint32_t bits = strtoul(versionBits.c_str(), NULL, 16);
+    if( bits & ~opt.versionMask ) {
+      stats.bad++;
+      c->rejected++;
+      replyError(c, id, ERROR_OTHER, "Version bits outside the mask");
+      return;
+    }
+    tmpl.version = (tmpl.version & ~opt.versionMask) | bits;
+  }
+
+  uint8_t extraNonce2[16];
+  hex2bin(extraNonce2, en2.c_str(), en2.length());
+  uint8_t header[80], hash[32];
+  if( ! jobTemplateHeader(&tmpl, c->extraNonce1.c_str(), extraNonce2, opt.en2Size, shareTime, strtoul(nonce.c_str(), NULL, 16), header) ) {
+    stats.bad++;
+    c->rejected++;
+    replyError(c, id, ERROR_OTHER, "Extranonces too long");
+    return;
+  }
+  double difficulty = jobTemplateHash(header, hash);
+  stats.verifyUs.add(nowUs() - start);
+
+  std::string key((const char*) hash, 32);
+  if( job->shares.count(key) ) {
+    stats.duplicate++;
+    c->rejected++;
+    replyError(c, id, ERROR_DUPLICATE, "Duplicate share");
+    return;
+  }
+  job->shares.insert(key);
+
+  if( difficulty < c->difficulty ) {
+    stats.lowDifficulty++;
+    c->rejected++;
+    replyError(c, id, ERROR_LOW_DIFFICULTY, "Low difficulty share");
+    return;
+  }
+
+  stats.jobAge.add(now - job->sentAt);
+  if( ! c->sharedOn.count(jobId) ) {
+    c->sharedOn.insert(jobId);
+    stats.firstShare.add(now - job->sentAt);
+  }
+  if( difficulty >= jobTemplateNetworkDifficulty(&tmpl) ) {
+    stats.blocks++;
+    printf("#%u found a block on job %s\n", c->number, jobId.c_str());
+  }
+
+  if( opt.rejectEvery && (stats.accepted + stats.injectedRejects + 1) % opt.rejectEvery == 0 ) {
+    stats.injectedRejects++;
+    c->rejected++;
+    replyError(c, id, ERROR_OTHER, "Injected reject");
+    return;
+  }
+  stats.accepted++;
+  stats.acceptedDifficulty += c->difficulty;
+  c->accepted++;
+  reply(c, id, "true");
+}
+
+// False if the connection should be dropped
+static bool handleLine(Client* c, const std::string& line) {
+  if( opt.verbose ) {
+    printf("#%u > %s\n", c->number, line.c_str());
+  }
+  Json msg;
+  const char* p = line.c_str();
+  if( ! parseJson(p, msg) || msg.type != Json::OBJ ) {
+    printf("#%u sent something that isn't JSON: %.60s\n", c->number, line.c_str());
+    return false;
+  }
+
+  const Json* id = msg.get("id");
+  const Json* method = msg.get("method");
+  const Json* params = msg.get("params");
+  if( ! method || method->type != Json::STR ) {
+    return true;      // A reply to something we sent; we never send requests
+  }
+  if( method->s == "mining.subscribe" ) {
+    handleSubscribe(c, id, params);
+  } else if( method->s == "mining.authorize" ) {
+    handleAuthorize(c, id, params);
+  } else if( method->s == "mining.configure" ) {
+    handleConfigure(c, id);
+  } else if( method->s == "mining.suggest_difficulty" ) {
+    handleSuggest(c, id, params);
+  } else if( method->s == "mining.extranonce.subscribe" ) {
+    reply(c, id, "false");
+  } else if( method->s == "mining.submit" ) {
+    handleSubmit(c, id, params);
+  } else {
+    replyError(c, id, ERROR_OTHER, "Unknown method");
+  }
+  return true;
+}
+
+// False if the connection is gone
+static bool readClient(Client* c) {
+  char buffer[2048];
+  ssize_t n = recv(c->fd, buffer, sizeof(buffer), 0);
+  if( n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) ) {
+    closeClient(c, "miner hung up");
+    return false;
+  }
+  if( n < 0 ) {
+    return true;
+  }
+  c->in.append(buffer, n);
+
+  size_t eol;
+  while( (eol = c->in.find('\n')) != std::string::npos ) {
+    std::string line = c->in.substr(0, eol);
+    c->in.erase(0, eol + 1);
+    if( ! line.empty() && line.back() == '\r' ) {
+      line.pop_back();
+    }
+    if( ! line.empty() && ! handleLine(c, line) ) {
+      closeClient(c, "bad JSON");
+      return false;
+    }
+  }
+  if( c->in.length() > LINE_MAX_LENGTH ) {
+    closeClient(c, "line too long");
+    return false;
+  }
+  return true;
+}
+
+// False if the connection is gone
+static bool writeClient(Client* c, uint64_t now) {
+  while( ! c->out.empty() && c->out.front().due <= now ) {
+    Pending& p = c->out.front();
+    ssize_t n = send(c->fd, p.data.data(), p.data.length(), MSG_NOSIGNAL);
+    if( n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) ) {
+      return true;
+    }
+    if( n < 0 ) {
+      closeClient(c, "send failed");
+      return false;
+    }
+    p.data.erase(0, n);
+    if( ! p.data.empty() ) {
+      return true;
+    }
+    c->out.pop_front();
+  }
+  return true;
+}
+
+static void acceptClient(int listener) {
+  struct sockaddr_in sa;
+  socklen_t len = sizeof(sa);
+  int fd = accept(listener, (struct sockaddr*) &sa, &len);
+  if( fd < 0 ) {
+    return;
+  }
+  if( clients.size() >= MAX_CLIENTS ) {
+    close(fd);
+    return;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  int yes = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+  Client* c = new Client();
+  c->fd = fd;
+  c->number = ++connectionCounter;
+  c->connectedAt = nowMs();
+  c->difficulty = opt.difficulty;
+  clients.push_back(c);
+  stats.connections++;
+
+  uint32_t ip = ntohl(sa.sin_addr.s_addr);
+  printf("#%u connected from %u.%u.%u.%u\n", c->number, ip >> 24, (ip >> 16) & 0xff, (ip >> 8) & 0xff, ip & 0xff);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Main loop
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static void report() {
+  double seconds = (nowMs() - stats.since) / 1000.0;
+  uint32_t rejected = stats.stale + stats.duplicate + stats.lowDifficulty + stats.bad + stats.unauthorized + stats.injectedRejects;
+
+  printf("\n--- %.0f s, %zu connected, %u connections, %u resumed, %u jobs\n", seconds, clients.size(), stats.connections, stats.resumes, stats.jobs);
+  printf("Shares: %u accepted, %u rejected (stale %u, duplicate %u, low difficulty %u, malformed %u, unauthorized %u, injected %u), %u blocks\n",
+      stats.accepted, rejected, stats.stale, stats.duplicate, stats.lowDifficulty, stats.bad, stats.unauthorized, stats.injectedRejects, stats.blocks);
+  printf("Faults: %u disconnects, %u slow lines, %u malformed lines\n", stats.injectedDisconnects, stats.slowLines, stats.malformedLines);
+  if( seconds > 0 ) {
+    printf("Hashrate from accepted shares: %.0f H/s\n", stats.acceptedDifficulty * 4294967296.0 / seconds);
+  }
+  printf("Latency, ms:\n");
+  stats.jobAge.print("job age at share");
+  stats.firstShare.print("first share on a job");
+  stats.staleAfterClean.print("stale share after clean job");
+  printf("Share check, us:\n");
+  stats.verifyUs.print("header rebuild and hash");
+  fflush(stdout);
+}
+
+static void onSignal(int) {
+  stopping = true;
+}
+
+static void usage() {
+  printf(
+    "Usage: mock_pool [options]\n"
+    "  --port N               Listen here (3336)\n"
+    "  --difficulty D         Share difficulty (0.001)\n"
+    "  --honor-suggest        Take mining.suggest_difficulty from miners\n"
+    "  --job-seconds N        A new job this often (30)\n"
+    "  --clean-every N        Every Nth job is clean (4)\n"
+    "  --en1-size N           Extranonce1 bytes (4)\n"
+    "  --en2-size N           Extranonce2 bytes, 1 to 8 (4)\n"
+    "  --merkle-depth N       Merkle branches per job (6)\n"
+    "  --version-mask HEX     Offer version rolling with this mask\n"
+    "  --ntime-ahead N        Seconds past our clock a share's ntime may go (600)\n"
+    "  --disconnect-every N   Drop each connection after N seconds\n"
+    "  --slow-every N         Send every Nth line in two halves\n"
+    "  --slow-ms N            Gap between the halves (2000)\n"
+    "  --malformed-every N    Send a broken line before every Nth job\n"
+    "  --reject-every N       Reject every Nth good share anyway\n"
+    "  --no-resume            Ignore session ids in mining.subscribe\n"
+    "  --report-seconds N     Print counts this often, 0 for only at the end (60)\n"
+    "  --duration N           Stop after N seconds\n"
+    "  --verbose              Log every line in and out\n");
+}
+
+static bool parseOptions(int argc, char** argv) {
+  for( int i = 1; i < argc; i++ ) {
+    std::string a = argv[i];
+    const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+    bool used = true;
+
+    if( a == "--help" || a == "-h" ) { usage(); exit(0); }
+    else if( a == "--honor-suggest" ) { opt.honorSuggest = true; used = false; }
+    else if( a == "--no-resume" ) { opt.noResume = true; used = false; }
+    else if( a == "--verbose" ) { opt.verbose = true; used = false; }
+    else if( ! v ) { fprintf(stderr, "%s needs a value\n", a.c_str()); return false; }
+    else if( a == "--port" ) opt.port = atoi(v);
+    else if( a == "--difficulty" ) opt.difficulty = atof(v);
+    else if( a == "--job-seconds" ) opt.jobSeconds = atoi(v);
+    else if( a == "--clean-every" ) opt.cleanEvery = atoi(v);
+    else if( a == "--en1-size" ) opt.en1Size = atoi(v);
+    else if( a == "--en2-size" ) opt.en2Size = atoi(v);
+    else if( a == "--merkle-depth" ) opt.merkleDepth = atoi(v);
+    else if( a == "--version-mask" ) opt.versionMask = strtoul(v, NULL, 16);
+    else if( a == "--ntime-ahead" ) opt.ntimeAhead = atoi(v);
+    else if( a == "--disconnect-every" ) opt.disconnectEvery = atoi(v);
+    else if( a == "--slow-every" ) opt.slowEvery = atoi(v);
+    else if( a == "--slow-ms" ) opt.slowMs = atoi(v);
+    else if( a == "--malformed-every" ) opt.malformedEvery = atoi(v);
+    else if( a == "--reject-every" ) opt.rejectEvery = atoi(v);
+    else if( a == "--report-seconds" ) opt.reportSeconds = atoi(v);
+    else if( a == "--duration" ) opt.duration = atoi(v);
+    else { fprintf(stderr, "Unknown option %s\n", a.c_str()); return false; }
+
+    if( used ) {
+      i++;
+    }
+  }
+  if( opt.en1Size < 1 || opt.en2Size < 1 || opt.en2Size > 8 || opt.en1Size + opt.en2Size > JOB_TEMPLATE_EXTRANONCE_SIZE ) {
+    fprintf(stderr, "Extranonce sizes have to be 1 or more, extranonce2 at most 8, and %d together\n", JOB_TEMPLATE_EXTRANONCE_SIZE);
+    return false;
+  }
+  if( opt.merkleDepth < 0 || opt.merkleDepth > JOB_TEMPLATE_MERKLE_MAX ) {
+    fprintf(stderr, "Merkle depth has to be 0 to %d\n", JOB_TEMPLATE_MERKLE_MAX);
+    return false;
+  }
+  if( opt.difficulty <= 0 || ! opt.jobSeconds ) {
+    fprintf(stderr, "Difficulty and job seconds have to be more than 0\n");
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if( ! parseOptions(argc, argv) ) {
+    return 2;
+  }
+  srand(time(NULL));
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  int yes = 1;
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  struct sockaddr_in sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(INADDR_ANY);
+  sa.sin_port = htons(opt.port);
+  if( bind(listener, (struct sockaddr*) &sa, sizeof(sa)) < 0 || listen(listener, 8) < 0 ) {
+    perror("Can't listen");
+    return 1;
+  }
+  fcntl(listener, F_SETFL, fcntl(listener, F_GETFL) | O_NONBLOCK);
+  printf("Mock pool on port %u: difficulty %g, a job every %u s, extranonce %d+%d, merkle depth %d\n",
+      opt.port, opt.difficulty, opt.jobSeconds, opt.en1Size, opt.en2Size, opt.merkleDepth);
+
+  uint64_t start = nowMs();
+  stats.since = start;
+  newJob(start);
+  uint64_t lastJobAt = start;
+  uint64_t lastReportAt = start;
+
+  while( ! stopping && (! opt.duration || nowMs() - start < opt.duration * 1000ULL) ) {
+    std::vector<struct pollfd> fds;
+    fds.push_back({ listener, POLLIN, 0 });
+    uint64_t now = nowMs();
+    int timeout = 100;
+    for( Client* c : clients ) {
+      short events = POLLIN;
+      if( ! c->out.empty() ) {
+        if( c->out.front().due <= now ) {
+          events |= POLLOUT;
+        } else {
+          timeout = std::min<int>(timeout, c->out.front().due - now);
+        }
+      }
+      fds.push_back({ c->fd, events, 0 });
+    }
+    poll(fds.data(), fds.size(), timeout);
+
+    now = nowMs();
+    if( fds[0].revents & POLLIN ) {
+      acceptClient(listener);
+    }
+
+    // Clients can close while we go, so work from a copy
+    std::vector<Client*> current(clients.begin(), clients.begin() + (fds.size() - 1));
+    for( size_t i = 0; i < current.size(); i++ ) {
+      Client* c = current[i];
+      if( (fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) && ! readClient(c) ) {
+        continue;
+      }
+      if( ! writeClient(c, now) ) {
+        continue;
+      }
+      if( opt.disconnectEvery && now - c->connectedAt >= opt.disconnectEvery * 1000ULL ) {
+        stats.injectedDisconnects++;
+        closeClient(c, "injected disconnect");
+      }
+    }
+
+    if( now - lastJobAt >= opt.jobSeconds * 1000ULL ) {
+      Job& job = newJob(now);
+      for( Client* c : clients ) {
+        if( c->authorized ) {
+          sendJob(c, job, job.clean);
+        }
+      }
+      lastJobAt = now;
+    }
+
+    if( opt.reportSeconds && now - lastReportAt >= opt.reportSeconds * 1000ULL ) {
+      report();
+      lastReportAt = now;
+    }
+  }
+
+  report();
+  return 0;
+}
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# End to end check of tools/mock_pool, with a scripted miner in place of
+# the real one. Build the pool as its header says, then:
+#
+#   python3 tools/mock_pool_check.py --pool ./mock_pool
+#
+# It starts the pool on a spare port, subscribes, and mines real shares at a
+# tiny difficulty with hashlib. Every few shares it also sends a duplicate,
+# one with a wrong nonce and one for a job that doesn't exist. Good shares
+# have to be accepted and each bad one turned away with the right error.
+# Every job comes after a broken line, which has to be skipped.
+#
+# Exits 0 when everything came back as expected, 1 if not.
+
+import argparse
+import hashlib
+import json
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+ERROR_JOB_NOT_FOUND = 21
+ERROR_DUPLICATE = 22
+ERROR_LOW_DIFFICULTY = 23
+
+
+def dsha(data):
+    return hashlib.sha256(hashlib.sha256(data).digest()).digest()
+
+
+class Miner:
+    def __init__(self, port):
+        self.sock = socket.create_connection(("127.0.0.1", port), timeout=10)
+        self.lock = threading.Lock()
+        self.difficulty = 1.0
+        self.job = None
+        self.subscribed = None
+        self.answers = {}
+        self.malformed = 0
+        self.closed = False
+        self.next_id = 3
+        threading.Thread(target=self.reader, daemon=True).start()
+
+    def reader(self):
+        for line in self.sock.makefile("rb"):
+            try:
+                msg = json.loads(line)
+            except ValueError:
+                self.malformed += 1
+                continue
+            with self.lock:
+                if msg.get("method") == "mining.set_difficulty":
+                    self.difficulty = msg["params"][0]
+                elif msg.get("method") == "mining.notify":
+                    self.job = msg["params"]
+                elif msg.get("id") == 1:
+                    self.subscribed = msg["result"]
+                elif isinstance(msg.get("id"), int) and msg["id"] >= 3:
+                    error = msg.get("error")
+                    self.answers[msg["id"]] = error[0] if error else None
+        self.closed = True
+
+    def send(self, method, params):
+        with self.lock:
+            request_id = self.next_id
+            self.next_id += 1
+        self.sock.sendall((json.dumps({"id": request_id, "method": method, "params": params}) + "\n").encode())
+        return request_id
+
+    def submit(self, job_id, extranonce2, ntime, nonce):
+        return self.send("mining.submit", ["check", job_id, extranonce2, ntime, "%08x" % nonce])
+
+
+def header_for(job, extranonce1, extranonce2):
+    job_id, prev, cb1, cb2, branches, version, nbits, ntime, clean = job
+    root = dsha(bytes.fromhex(cb1 + extranonce1 + extranonce2 + cb2))
+    for branch in branches:
+        root = dsha(root + bytes.fromhex(branch))
+    prev = bytes.fromhex(prev)
+    prev = b"".join(prev[i:i + 4][::-1] for i in range(0, 32, 4))
+    return struct.pack("<I", int(version, 16)) + prev + root + struct.pack("<II", int(ntime, 16), int(nbits, 16))
+
+
+def run(args):
+    miner = Miner(args.port)
+    miner.sock.sendall(b'{"id": 1, "method": "mining.subscribe", "params": ["mock_pool_check/1"]}\n')
+    deadline = time.monotonic() + args.seconds
+    while miner.subscribed is None and time.monotonic() < deadline:
+        time.sleep(0.01)
+    if miner.subscribed is None:
+        print("No answer to mining.subscribe")
+        return False
+    extranonce1, extranonce2_size = miner.subscribed[1], miner.subscribed[2]
+    miner.sock.sendall(b'{"id": 2, "method": "mining.authorize", "params": ["check", "x"]}\n')
+
+    expected = {}
+    found = 0
+    current = None
+    nonce = 0
+    while found < args.shares and time.monotonic() < deadline and not miner.closed:
+        with miner.lock:
+            job, difficulty = miner.job, miner.difficulty
+        if job is None:
+            time.sleep(0.05)
+            continue
+        if job is not current:
+            current, nonce = job, 0
+            extranonce2 = ("%0*x" % (extranonce2_size * 2, found + 1))[-extranonce2_size * 2:]
+            header = header_for(job, extranonce1, extranonce2)
+        target = int(0xffff * 2 ** 208 / difficulty)
+        for n in range(nonce, nonce + 20000):
+            if int.from_bytes(dsha(header + struct.pack("<I", n)), "little") > target:
+                continue
+            found += 1
+            job_id, ntime = job[0], job[7]
+            expected[miner.submit(job_id, extranonce2, ntime, n)] = None
+            if found % 3 == 0:
+                expected[miner.submit(job_id, extranonce2, ntime, n)] = ERROR_DUPLICATE
+            if found % 3 == 1:
+                # Same header, another nonce: almost never good enough
+                bad = n ^ 0x80000000
+                if int.from_bytes(dsha(header + struct.pack("<I", bad)), "little") > target:
+                    expected[miner.submit(job_id, extranonce2, ntime, bad)] = ERROR_LOW_DIFFICULTY
+            if found % 3 == 2:
+                expected[miner.submit("no-such-job", extranonce2, ntime, n)] = ERROR_JOB_NOT_FOUND
+            nonce = n + 1
+            break
+        else:
+            nonce += 20000
+
+    while len(miner.answers) < len(expected) and time.monotonic() < deadline and not miner.closed:
+        time.sleep(0.05)
+
+    ok = found >= args.shares and miner.malformed > 0
+    for request_id, want in sorted(expected.items()):
+        got = miner.answers.get(request_id, "no answer")
+        if got != want:
+            print("Submit %d: expected %s, got %s" % (request_id, want or "accepted", got or "accepted"))
+            ok = False
+    print("%d shares, %d submits answered as expected, %d broken lines skipped"
+          % (found, sum(1 for i, w in expected.items() if miner.answers.get(i, "x") == w), miner.malformed))
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="End to end check of the mock stratum pool")
+    parser.add_argument("--pool", default="./mock_pool", help="mock_pool binary")
+    parser.add_argument("--port", type=int, default=3340)
+    parser.add_argument("--shares", type=int, default=9, help="good shares to find")
+    parser.add_argument("--seconds", type=int, default=60, help="give up after this long")
+    args = parser.parse_args()
+
+    pool = subprocess.Popen([args.pool, "--port", str(args.port), "--difficulty", "0.00002", "--job-seconds", "2",
+                             "--malformed-every", "1", "--report-seconds", "0", "--duration", str(args.seconds + 5)],
+                            stdout=subprocess.DEVNULL)
+    try:
+        for _ in range(50):
+            try:
+                socket.create_connection(("127.0.0.1", args.port), timeout=1).close()
+                break
+            except OSError:
+                time.sleep(0.1)
+        ok = run(args)
+    finally:
+        pool.terminate()
+        pool.wait()
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,718 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Replays a stratum capture from the miner on a PC.
+//
+// With "Capture Pool Traffic" on, the miner records every line to and from
+// the pool, and the header it built for each job (see src/stratumCapture.h).
+// Download the capture from /stratum.cap, or take stratum.cap off the SD card.
+//
+// Each line from the pool is handled the way the stratum task handles it.
+// The subscribe response sets the extranonces, and each mining.notify is
+// read into a stratum_block field for field as parseMiningNotify() does it.
+// The header is then built with the firmware's own job builder
+// (src/jobBuilder.cpp, the code startMiningJob() runs), for the extranonce2
+// the miner recorded. It has to come out byte for byte the same as the
+// miner's header, merkle root included. The same job also goes through the
+// job template that the stratum server and cluster leader use, which has to agree.
+//
+// Timing is reported per kind of message. By default the replay runs flat
+// out; --speed 1 keeps the capture's own pace and --speed 10 runs it ten
+// times as fast.
+//
+// From the repository root:
+//   g++ -O2 -DESP32_DEV_HEADLESS -Itools/host -Isrc
+//       tools/stratum_replay/stratum_replay.cpp tools/host/utils_host.cpp
+//       src/jobBuilder.cpp src/jobTemplate.cpp src/MinerSha256.cpp
+//       -o stratum_replay && ./stratum_replay stratum.cap
+//
+//   ./stratum_replay --speed 1 --verbose stratum.cap
+//
+// Exits 0 when every header matched, 1 on any difference, 2 if the capture
+// can't be read.
+//
+// tools/stratum_replay_check.py runs it over sample.cap, a short session
+// with tools/mock_pool, and over a copy of that with one header broken.
+//
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "defines_n_types.h"
+#include "utils.h"
+#include "jobBuilder.h"
+#include "jobTemplate.h"
+#include "stratumCapture.h"
+
+static uint64_t nowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static bool isHex(const std::string& s, size_t length) {
+  if( s.length() != length ) {
+    return false;
+  }
+  for( char c : s ) {
+    if( ! isxdigit((unsigned char) c) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::string toHex(const uint8_t* p, size_t len) {
+  std::string s;
+  char b[3];
+  for( size_t i = 0; i < len; i++ ) {
+    snprintf(b, sizeof(b), "%02x", p[i]);
+    s += b;
+  }
+  return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Just enough JSON to read what a pool sends
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Json {
+  enum Type { NUL, BOOL, NUM, STR, ARR, OBJ } type = NUL;
+  bool b = false;
+  double n = 0;
+  std::string s;
+  std::vector<Json> items;
+  std::vector<std::string> keys;    // For OBJ, alongside items
+
+  const Json* get(const char* key) const {
+    for( size_t i = 0; i < keys.size(); i++ ) {
+      if( keys[i] == key ) {
+        return &items[i];
+      }
+    }
+    return NULL;
+  }
+  const Json* at(size_t i) const {
+    return type == ARR && i < items.size() ? &items[i] : NULL;
+  }
+};
+
+static void skipSpace(const char*& p) {
+  while( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' ) {
+    p++;
+  }
+}
+
+static bool parseString(const char*& p, std::string& out) {
+  if( *p++ != '"' ) {
+    return false;
+  }
+  while( *p && *p != '"' ) {
+    if( *p == '\\' ) {
+      p++;
+      switch( *p ) {
+        case 'n': out += '\n'; break;
+        case 't': out += '\t'; break;
+        case 'r': out += '\r'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'u':
+          for( int i = 1; i <= 4; i++ ) {
+            if( ! isxdigit((unsigned char) p[i]) ) {
+              return false;
+            }
+          }
+          out += '?';
+          p += 4;
+          break;
+        case 0: return false;
+        default: out += *p;
+      }
+      p++;
+    } else {
+      out += *p++;
+    }
+  }
+  if( *p != '"' ) {
+    return false;
+  }
+  p++;
+  return true;
+}
+
+static bool parseJson(const char*& p, Json& v, int depth = 0) {
+  if( depth > 8 ) {
+    return false;
+  }
+  skipSpace(p);
+  if( *p == '{' || *p == '[' ) {
+    bool object = *p == '{';
+    char close = object ? '}' : ']';
+    v.type = object ? Json::OBJ : Json::ARR;
+    p++;
+    skipSpace(p);
+    if( *p == close ) {
+      p++;
+      return true;
+    }
+    while( true ) {
+      if( object ) {
+        skipSpace(p);
+        std::string key;
+        if( ! parseString(p, key) ) {
+          return false;
+        }
+        skipSpace(p);
+        if( *p++ != ':' ) {
+          return false;
+        }
+        v.keys.push_back(key);
+      }
+      v.items.emplace_back();
+      if( ! parseJson(p, v.items.back(), depth + 1) ) {
+        return false;
+      }
+      skipSpace(p);
+      if( *p == ',' ) {
+        p++;
+      } else if( *p == close ) {
+        p++;
+        return true;
+      } else {
+        return false;
+      }
+    }
+  }
+  if( *p == '"' ) {
+    v.type = Json::STR;
+    return parseString(p, v.s);
+  }
+  if( ! strncmp(p, "true", 4) || ! strncmp(p, "false", 5) ) {
+    v.type = Json::BOOL;
+    v.b = *p == 't';
+    p += v.b ? 4 : 5;
+    return true;
+  }
+  if( ! strncmp(p, "null", 4) ) {
+    p += 4;
+    return true;
+  }
+  char* end;
+  v.n = strtod(p, &end);
+  if( end == p ) {
+    return false;
+  }
+  v.type = Json::NUM;
+  p = end;
+  return true;
+}
+
+// What the firmware gets from (const char*) on a JSON value: strings, else nothing
+static std::string text(const Json* v) {
+  return v && v->type == Json::STR ? v->s : "";
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Settings and statistics
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+  double speed = 0;             // 0 for as fast as it goes
+  bool verbose = false;
+  const char* path = NULL;
+};
+
+static Options opt;
+
+// Microseconds; sorted only when reported
+struct Samples {
+  std::vector<double> v;
+
+  void add(double x) { v.push_back(x); }
+  double pct(double p) {
+    if( v.empty() ) {
+      return 0;
+    }
+    std::sort(v.begin(), v.end());
+    return v[(size_t) (p * (v.size() - 1) + 0.5)];
+  }
+  void print(const char* name) {
+    if( v.empty() ) {
+      printf("  %-30s none\n", name);
+      return;
+    }
+    printf("  %-30s n=%-6zu p50 %-9.1f p90 %-9.1f p99 %-9.1f max %.1f\n", name, v.size(), pct(0.5), pct(0.9), pct(0.99), pct(1.0));
+  }
+};
+
+struct Stats {
+  uint32_t records = 0;
+  uint32_t unreadable = 0;
+  uint32_t fromPool = 0;
+  uint32_t toPool = 0;
+  uint32_t connects = 0;
+  uint32_t malformed = 0;
+  uint32_t jobs = 0;
+  uint32_t matched = 0;
+  uint32_t differed = 0;
+  uint32_t notCompared = 0;       // No header from the miner to compare with
+  uint32_t unbuildable = 0;       // The miner would read past the end of these
+  uint32_t orphanJobs = 0;        // Header records whose notify was lost off the ring
+  uint32_t templateAgreed = 0;
+  uint32_t templateDiffered = 0;
+  uint32_t templateSkipped = 0;   // Too big for the template, as on the miner
+  uint32_t accepted = 0;
+  uint32_t rejected = 0;
+  uint32_t firstMs = 0;
+  uint32_t lastMs = 0;
+  Samples notifyUs;               // Parse, fill and build, as the stratum task would
+  Samples difficultyUs;
+  Samples subscribeUs;
+  Samples responseUs;
+  Samples otherUs;
+  Samples malformedUs;
+  Samples buildUs;                // jobBuildHeader() alone
+  Samples templateUs;             // Decode and header through the job template
+};
+
+static Stats stats;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// The capture
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct Record {
+  uint32_t line;
+  uint32_t ms;
+  char kind;
+  std::string text;
+};
+
+// One record is "<ms> <kind> <text>"; a torn first or last line is skipped
+static bool readCapture(const char* path, std::vector<Record>& records) {
+  FILE* f = fopen(path, "r");
+  if( ! f ) {
+    perror(path);
+    return false;
+  }
+
+  std::string line;
+  uint32_t number = 0;
+  int c;
+  do {
+    c = fgetc(f);
+    if( c != '\n' && c != EOF ) {
+      line += (char) c;
+      continue;
+    }
+    if( line.empty() ) {
+      continue;
+    }
+    number++;
+
+    char* end;
+    Record r;
+    r.line = number;
+    r.ms = strtoul(line.c_str(), &end, 10);
+    size_t at = end - line.c_str();
+    if( end == line.c_str() || at + 2 > line.length() || line[at] != ' ' || ! strchr("<>*J", line[at + 1]) ||
+        (at + 2 < line.length() && line[at + 2] != ' ') ) {
+      stats.unreadable++;
+    } else {
+      r.kind = line[at + 1];
+      r.text = at + 3 <= line.length() ? line.substr(at + 3) : "";
+      records.push_back(r);
+    }
+    line.clear();
+  } while( c != EOF );
+
+  fclose(f);
+  return true;
+}
+
+// A 'J' record: job id, extranonce1, extranonce2, header. Read from the
+// right, as the job id is the pool's and could be anything.
+struct MinerJob {
+  std::string jobId;
+  std::string extraNonce1;
+  std::string extraNonce2;
+  uint8_t header[sizeof(hash_block)];
+};
+
+static bool readMinerJob(const std::string& text, MinerJob& job) {
+  size_t h = text.rfind(' ');
+  if( h == std::string::npos || h == 0 ) {
+    return false;
+  }
+  size_t e2 = text.rfind(' ', h - 1);
+  if( e2 == std::string::npos || e2 == 0 ) {
+    return false;
+  }
+  size_t e1 = text.rfind(' ', e2 - 1);
+  if( e1 == std::string::npos ) {
+    return false;
+  }
+
+  std::string header = text.substr(h + 1);
+  job.jobId = text.substr(0, e1);
+  job.extraNonce1 = text.substr(e1 + 1, e2 - e1 - 1);
+  job.extraNonce2 = text.substr(e2 + 1, h - e2 - 1);
+  if( job.extraNonce1 == "-" ) {
+    job.extraNonce1 = "";
+  }
+  if( ! isHex(header, sizeof(hash_block) * 2) || (job.extraNonce2.length() & 1) || job.extraNonce2.length() > 16 ||
+      ! isHex(job.extraNonce2, job.extraNonce2.length()) ) {
+    return false;
+  }
+  hex2bin(job.header, header.c_str(), header.length());
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Replay
+//////////////////////////////////////////////////////////////////////////////////////////
+
+// What the stratum task knows of the session, from the subscribe response
+static std::string extraNonce1;
+static int extraNonce2Size = 0;
+static bool subscribed = false;
+
+static const struct {
+  const char* name;
+  size_t offset;
+  size_t size;
+} headerFields[] = {
+  { "version", offsetof(hash_block, version), 4 },
+  { "prev hash", offsetof(hash_block, prev_hash), 32 },
+  { "merkle root", offsetof(hash_block, merkle_root), 32 },
+  { "ntime", offsetof(hash_block, timestamp), 4 },
+  { "nbits", offsetof(hash_block, difficulty), 4 },
+  { "nonce", offsetof(hash_block, nonce), 4 },
+};
+
+static void printDifferences(const uint8_t* miner, const uint8_t* replay) {
+  for( auto& f : headerFields ) {
+    if( memcmp(miner + f.offset, replay + f.offset, f.size) ) {
+      printf("  %-12s miner  %s\n", f.name, toHex(miner + f.offset, f.size).c_str());
+      printf("  %-12s replay %s\n", "", toHex(replay + f.offset, f.size).c_str());
+    }
+  }
+}
+
+// The job as the stratum server and cluster leader would hand it on. It
+// doesn't have the extranonce2 clamp the miner's builder has, so those
+// jobs are left to the builder alone.
+static void checkTemplate(const Record& r, stratum_block* sb, const std::string& en2Hex, const hash_block* built) {
+  static JobTemplate job;
+  uint8_t en2[8];
+  uint8_t header[sizeof(hash_block)];
+
+  uint64_t start = nowUs();
+  hex2bin(en2, en2Hex.c_str(), en2Hex.length());
+  bool ok = (size_t) sb->extraNonce2Size == en2Hex.length() / 2 && jobTemplateDecode(&job, sb) &&
+      jobTemplateHeader(&job, sb->extraNonce1.c_str(), en2, en2Hex.length() / 2, built->timestamp, 0, header);
+  if( ! ok ) {
+    stats.templateSkipped++;
+    return;
+  }
+  stats.templateUs.add(nowUs() - start);
+
+  if( memcmp(header, built, sizeof(header)) == 0 ) {
+    stats.templateAgreed++;
+  } else {
+    stats.templateDiffered++;
+    printf("line %u: job %s from the job template differs from the miner's builder\n", r.line, sb->jobId.c_str());
+    printDifferences((const uint8_t*) built, header);
+  }
+}
+
+// parseMiningNotify() then startMiningJob(), less the waiting on the miners
+static void handleNotify(const Record& r, const Json* params, const Record* next, uint64_t start) {
+  std::vector<std::string> merkle;
+  std::string jobId = text(params ? params->at(0) : NULL);
+  std::string prevHash = text(params ? params->at(1) : NULL);
+  std::string coinBase1 = text(params ? params->at(2) : NULL);
+  std::string coinBase2 = text(params ? params->at(3) : NULL);
+  const Json* branch = params ? params->at(4) : NULL;
+  bool buildable = prevHash.length() == 64;
+  if( branch && branch->type == Json::ARR ) {
+    for( const Json& b : branch->items ) {
+      merkle.push_back(text(&b));
+      buildable = buildable && merkle.back().length() == 64;
+    }
+  }
+  const Json* clean = params ? params->at(8) : NULL;
+
+  // The header the miner recorded, if it's the next thing in the capture
+  MinerJob minerJob;
+  bool compare = next && next->kind == CAPTURE_JOB && readMinerJob(next->text, minerJob) && minerJob.jobId == jobId;
+  if( compare && ! subscribed ) {
+    // The subscribe has gone off the front of the ring; the miner's record says what it was
+    extraNonce1 = minerJob.extraNonce1;
+    extraNonce2Size = minerJob.extraNonce2.length() / 2;
+  }
+
+  stratum_block sb;
+  sb.jobId = String(jobId.c_str());
+  sb.prevHash = String(prevHash.c_str());
+  sb.coinBase1 = String(coinBase1.c_str());
+  sb.coinBase2 = String(coinBase2.c_str());
+  sb.extraNonce1 = String(extraNonce1.c_str());
+  sb.extraNonce2Size = extraNonce2Size;
+  for( const std::string& m : merkle ) {
+    sb.merkleBranch.add(m.c_str());
+  }
+  sb.version = String(text(params ? params->at(5) : NULL).c_str());
+  sb.difficulty = String(text(params ? params->at(6) : NULL).c_str());
+  sb.nTime = String(text(params ? params->at(7) : NULL).c_str());
+  sb.cleanJobs = clean && (clean->type == Json::BOOL ? clean->b : clean->n != 0);
+
+  stats.jobs++;
+  if( ! buildable ) {
+    // jobBuildHeader() takes the hex on trust and would read past the end
+    stats.unbuildable++;
+    printf("line %u: job %s has a previous hash or merkle branch that isn't 32 bytes of hex; the miner would build garbage\n",
+        r.line, jobId.c_str());
+    return;
+  }
+
+  unsigned long en2 = compare ? strtoull(minerJob.extraNonce2.c_str(), NULL, 16) : 0;
+  hash_block built;
+  memset(&built, 0, sizeof(built));
+  uint64_t buildStart = nowUs();
+  size_t en2Size = jobBuildHeader(&built, &sb, en2);
+  uint64_t end = nowUs();
+  stats.buildUs.add(end - buildStart);
+  stats.notifyUs.add(end - start);
+
+  char en2Hex[17];
+  encodeExtraNonce(en2Hex, en2Size, en2);
+
+  if( ! compare ) {
+    stats.notCompared++;
+  } else if( extraNonce1 != minerJob.extraNonce1 || std::string(en2Hex) != minerJob.extraNonce2 ) {
+    stats.differed++;
+    printf("line %u: job %s built with extranonces %s/%s, but the miner had %s/%s\n", r.line, jobId.c_str(),
+        extraNonce1.c_str(), en2Hex, minerJob.extraNonce1.c_str(), minerJob.extraNonce2.c_str());
+  } else if( memcmp(&built, minerJob.header, sizeof(built)) ) {
+    stats.differed++;
+    printf("line %u: job %s header differs from the miner's\n", r.line, jobId.c_str());
+    printDifferences(minerJob.header, (const uint8_t*) &built);
+  } else {
+    stats.matched++;
+  }
+  if( opt.verbose ) {
+    printf("%6u  job %s%s, merkle root %s\n", r.line, jobId.c_str(), sb.cleanJobs ? " (clean)" : "",
+        toHex(built.merkle_root, sizeof(built.merkle_root)).c_str());
+  }
+
+  checkTemplate(r, &sb, en2Hex, &built);
+}
+
+// handleServerMessage(), and the subscribe response subscribe() reads itself
+static void handleFromPool(const Record& r, const Record* next) {
+  uint64_t start = nowUs();
+  Json doc;
+  const char* p = r.text.c_str();
+  if( ! parseJson(p, doc) || doc.type != Json::OBJ ) {
+    stats.malformed++;
+    stats.malformedUs.add(nowUs() - start);
+    if( opt.verbose ) {
+      printf("%6u  malformed: %.60s\n", r.line, r.text.c_str());
+    }
+    return;
+  }
+
+  const Json* method = doc.get("method");
+  const Json* result = doc.get("result");
+  if( method && method->type == Json::STR ) {
+    const Json* params = doc.get("params");
+    if( method->s == "mining.notify" ) {
+      handleNotify(r, params, next, start);
+      return;
+    }
+    if( method->s == "mining.set_difficulty" ) {
+      const Json* d = params ? params->at(0) : NULL;
+      stats.difficultyUs.add(nowUs() - start);
+      if( opt.verbose ) {
+        printf("%6u  difficulty %g\n", r.line, d && d->type == Json::NUM ? d->n : 0.0);
+      }
+      return;
+    }
+    stats.otherUs.add(nowUs() - start);
+    if( opt.verbose ) {
+      printf("%6u  %s\n", r.line, method->s.c_str());
+    }
+    return;
+  }
+
+  // [[subscriptions], extranonce1, extranonce2 size]
+  const Json* en1 = result ? result->at(1) : NULL;
+  const Json* en2Size = result ? result->at(2) : NULL;
+  if( en1 && en1->type == Json::STR && en2Size && en2Size->type == Json::NUM ) {
+    extraNonce1 = en1->s;
+    extraNonce2Size = (int) en2Size->n;
+    subscribed = true;
+    stats.subscribeUs.add(nowUs() - start);
+    if( opt.verbose ) {
+      printf("%6u  subscribed, extranonce1 %s, extranonce2 %d bytes\n", r.line, extraNonce1.c_str(), extraNonce2Size);
+    }
+    return;
+  }
+
+  if( result && result->type == Json::BOOL ) {
+    if( result->b ) {
+      stats.accepted++;
+    } else {
+      stats.rejected++;
+    }
+  }
+  stats.responseUs.add(nowUs() - start);
+}
+
+// Sleeps until the record is due at the chosen speed. The miner's clock
+// starts over when it reboots, and so does the pacing.
+static void pace(const Record& r) {
+  static uint64_t baseUs = 0;
+  static uint32_t baseMs = 0;
+  static bool started = false;
+
+  if( opt.speed <= 0 ) {
+    return;
+  }
+  if( ! started || r.ms < baseMs ) {
+    baseUs = nowUs();
+    baseMs = r.ms;
+    started = true;
+    return;
+  }
+  uint64_t due = baseUs + (uint64_t) ((r.ms - baseMs) * 1000.0 / opt.speed);
+  uint64_t now = nowUs();
+  if( due > now ) {
+    std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+  }
+}
+
+static void replay(const std::vector<Record>& records) {
+  for( size_t i = 0; i < records.size(); i++ ) {
+    const Record& r = records[i];
+    const Record* next = i + 1 < records.size() ? &records[i + 1] : NULL;
+    pace(r);
+
+    if( ! stats.records++ ) {
+      stats.firstMs = r.ms;
+    }
+    stats.lastMs = r.ms;
+
+    switch( r.kind ) {
+      case CAPTURE_FROM_POOL:
+        stats.fromPool++;
+        handleFromPool(r, next);
+        break;
+      case CAPTURE_TO_POOL:
+        stats.toPool++;
+        if( opt.verbose ) {
+          printf("%6u  sent %.60s\n", r.line, r.text.c_str());
+        }
+        break;
+      case CAPTURE_EVENT:
+        // A new connection is a new session until its subscribe says otherwise
+        if( r.text.compare(0, 8, "connect ") == 0 ) {
+          stats.connects++;
+          subscribed = false;
+        }
+        if( opt.verbose ) {
+          printf("%6u  %s\n", r.line, r.text.c_str());
+        }
+        break;
+      case CAPTURE_JOB:
+        // Read with its notify, unless the notify went off the front of the ring
+        if( ! i || records[i - 1].kind != CAPTURE_FROM_POOL ) {
+          stats.orphanJobs++;
+        }
+        break;
+    }
+  }
+}
+
+static void report() {
+  printf("\n--- %s: %u records, %.1f s of capture, %u connections\n", opt.path, stats.records,
+      (stats.lastMs - stats.firstMs) / 1000.0, stats.connects);
+  printf("Lines: %u from the pool (%u malformed), %u to it; shares %u accepted, %u rejected\n",
+      stats.fromPool, stats.malformed, stats.toPool, stats.accepted, stats.rejected);
+  printf("Jobs: %u, %u matched the miner's header, %u differed, %u with no header to compare, %u unbuildable\n",
+      stats.jobs, stats.matched, stats.differed, stats.notCompared, stats.unbuildable);
+  printf("Job template: %u agreed, %u differed, %u not checked\n", stats.templateAgreed, stats.templateDiffered, stats.templateSkipped);
+  if( stats.unreadable || stats.orphanJobs ) {
+    printf("Skipped: %u unreadable lines, %u headers without their notify\n", stats.unreadable, stats.orphanJobs);
+  }
+  printf("Handling time, us:\n");
+  stats.notifyUs.print("mining.notify, parse and build");
+  stats.difficultyUs.print("mining.set_difficulty");
+  stats.subscribeUs.print("subscribe response");
+  stats.responseUs.print("other responses");
+  stats.otherUs.print("other methods");
+  stats.malformedUs.print("malformed lines");
+  stats.buildUs.print("header build");
+  stats.templateUs.print("job template header");
+}
+
+static bool parseOptions(int argc, char** argv) {
+  for( int i = 1; i < argc; i++ ) {
+    std::string a = argv[i];
+    const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+    if( a == "--verbose" ) { opt.verbose = true; continue; }
+    if( a.compare(0, 2, "--") ) {
+      if( opt.path ) {
+        fprintf(stderr, "One capture at a time\n");
+        return false;
+      }
+      opt.path = argv[i];
+      continue;
+    }
+    if( ! v ) { fprintf(stderr, "%s needs a value\n", a.c_str()); return false; }
+    else if( a == "--speed" ) opt.speed = atof(v);
+    else { fprintf(stderr, "Unknown option %s\n", a.c_str()); return false; }
+    i++;
+  }
+  if( ! opt.path ) {
+    fprintf(stderr, "Usage: stratum_replay [--speed N] [--verbose] stratum.cap\n");
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if( ! parseOptions(argc, argv) ) {
+    return 2;
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  std::vector<Record> records;
+  if( ! readCapture(opt.path, records) ) {
+    return 2;
+  }
+  if( records.empty() ) {
+    fprintf(stderr, "%s: nothing to replay\n", opt.path);
+    return 2;
+  }
+
+  replay(records);
+  report();
+  return stats.differed || stats.templateDiffered ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Checks tools/stratum_replay against the sample capture next to it. Build
+# the replay as its header says, then:
+#
+#   python3 tools/stratum_replay_check.py --replay ./stratum_replay
+#
+# The sample has to replay with every header matching. A copy with one hex
+# digit of a merkle root changed has to be reported as a difference.
+#
+# tools/stratum_replay/sample.cap came from tools/mock_pool, with a small
+# scripted client writing the capture the way the miner does. To make a
+# new one:
+#
+#   python3 tools/stratum_replay_check.py --record ./mock_pool
+#
+# Exits 0 when the replay behaved, 1 if not.
+
+import argparse
+import hashlib
+import json
+import os
+import random
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+SAMPLE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "stratum_replay", "sample.cap")
+
+
+def dsha(data):
+    return hashlib.sha256(hashlib.sha256(data).digest()).digest()
+
+
+# One session with the mock pool, written as the miner's capture would be:
+# milliseconds, a kind, and the text. The header for each job is built as
+# startMiningJob() builds it, from a random extranonce2 with a zero top byte.
+def record(pool, path, seconds):
+    port = 3342
+    proc = subprocess.Popen([pool, "--port", str(port), "--job-seconds", "1", "--en2-size", "4", "--merkle-depth", "6",
+                             "--malformed-every", "3", "--clean-every", "2", "--report-seconds", "0",
+                             "--duration", str(seconds + 2)], stdout=subprocess.DEVNULL)
+    try:
+        for _ in range(50):
+            try:
+                sock = socket.create_connection(("127.0.0.1", port), timeout=1)
+                break
+            except OSError:
+                time.sleep(0.1)
+        else:
+            print("The mock pool didn't start")
+            return False
+
+        start = time.monotonic()
+        with open(path, "w") as out:
+            def capture(kind, text):
+                out.write("%d %s %s\n" % (int((time.monotonic() - start) * 1000) + 1000, kind, text))
+
+            reader = sock.makefile("rb")
+            capture("*", "connect 127.0.0.1 %d" % port)
+            line = '{"id": 1, "method": "mining.subscribe", "params": ["BitsyMiner/1.0"]}'
+            sock.sendall((line + "\n").encode())
+            capture(">", line)
+            line = reader.readline().decode().strip()
+            capture("<", line)
+            extranonce1, extranonce2_size = json.loads(line)["result"][1:3]
+            line = '{"id": 2, "method": "mining.authorize", "params": ["wallet", "x"]}'
+            sock.sendall((line + "\n").encode())
+            capture(">", line)
+
+            sock.settimeout(0.2)
+            pending = b""
+            while time.monotonic() - start < seconds:
+                try:
+                    data = sock.recv(65536)
+                except socket.timeout:
+                    continue
+                if not data:
+                    break
+                pending += data
+                while b"\n" in pending:
+                    line, pending = pending.split(b"\n", 1)
+                    line = line.decode().strip()
+                    if not line:
+                        continue
+                    capture("<", line)
+                    try:
+                        msg = json.loads(line)
+                    except ValueError:
+                        continue
+                    if msg.get("method") != "mining.notify":
+                        continue
+                    job_id, prev, cb1, cb2, branches, version, nbits, ntime, clean = msg["params"]
+                    extranonce2 = random.getrandbits(32)
+                    if 2 <= extranonce2_size <= 4:
+                        extranonce2 &= 0xffffffff >> (8 * (5 - extranonce2_size))
+                    extranonce2 = ("%0*X" % (extranonce2_size * 2, extranonce2))[-extranonce2_size * 2:]
+                    root = dsha(bytes.fromhex(cb1 + extranonce1 + extranonce2 + cb2))
+                    for branch in branches:
+                        root = dsha(root + bytes.fromhex(branch))
+                    prev = bytes.fromhex(prev)
+                    prev = b"".join(prev[i:i + 4][::-1] for i in range(0, 32, 4))
+                    header = struct.pack("<I", int(version, 16)) + prev + root + \
+                        struct.pack("<III", int(ntime, 16), int(nbits, 16), 0)
+                    capture("J", "%s %s %s %s" % (job_id, extranonce1, extranonce2, header.hex().upper()))
+            capture("*", "closed")
+        sock.close()
+    finally:
+        proc.terminate()
+        proc.wait()
+    print("Recorded %s" % path)
+    return True
+
+
+# The first job's header, with a digit of its merkle root changed
+def corrupt(source, dest):
+    with open(source) as f:
+        lines = f.readlines()
+    for i, line in enumerate(lines):
+        fields = line.rstrip("\n").split(" ")
+        if len(fields) == 6 and fields[1] == "J":
+            header = fields[5]
+            digit = "0" if header[80] != "0" else "1"      # Byte 40, in the merkle root
+            fields[5] = header[:80] + digit + header[81:]
+            lines[i] = " ".join(fields) + "\n"
+            break
+    else:
+        return False
+    with open(dest, "w") as f:
+        f.writelines(lines)
+    return True
+
+
+def replay(binary, capture, want, label):
+    result = subprocess.run([binary, capture], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    ok = result.returncode == want
+    print("%-20s exit %d, expected %d: %s" % (label, result.returncode, want, "ok" if ok else "FAIL"))
+    if not ok:
+        sys.stdout.write(result.stdout.decode(errors="replace"))
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check the stratum replay against a sample capture")
+    parser.add_argument("--replay", default="./stratum_replay", help="stratum_replay binary")
+    parser.add_argument("--capture", default=SAMPLE, help="capture to check with")
+    parser.add_argument("--record", metavar="MOCK_POOL", help="record a new sample from this mock_pool binary instead")
+    parser.add_argument("--seconds", type=int, default=5, help="how long to record for")
+    args = parser.parse_args()
+
+    if args.record:
+        sys.exit(0 if record(args.record, args.capture, args.seconds) else 1)
+
+    ok = replay(args.replay, args.capture, 0, "sample")
+    with tempfile.TemporaryDirectory() as directory:
+        bad = os.path.join(directory, "corrupt.cap")
+        if corrupt(args.capture, bad):
+            ok = replay(args.replay, bad, 1, "corrupted merkle") and ok
+        else:
+            print("The capture has no job to corrupt")
+            ok = False
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
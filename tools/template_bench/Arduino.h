@@ -0,0 +1,19 @@
+// Just enough of the Arduino core to build the template renderer on a PC.
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+typedef const char* PGM_P;
+
+struct HostSerial {
+  template<typename... T> int printf(const char* format, T... args) { return ::printf(format, args...); }
+};
+static HostSerial Serial __attribute__((unused));
+
+#endif
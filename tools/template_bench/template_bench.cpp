@@ -0,0 +1,311 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Host benchmark for the config page template.
+//
+// Renders web/config.tmpl through the firmware's TemplateRenderer into the
+// same kind of segment sized buffer PlainWebServer uses, and counts how many
+// socket writes that turns into. For comparison it also renders the page the
+// way the old showConfigScreen did: every fragment handed over as its own
+// sendContent, with strings escaped into a fresh malloc each time.
+//
+// Both have to produce the same bytes before anything is timed. Allocations
+// are counted by wrapping malloc and operator new, not assumed.
+//
+// From the repository root:
+//   python3 tools/build_web_assets.py
+//   g++ -O2 -DESP32_DEV_HEADLESS -Itools/template_bench -Isrc -Wl,--wrap=malloc
+//       tools/template_bench/template_bench.cpp src/html_template.cpp src/chunkWriter.cpp
+//       src/web_templates.cpp -o template_bench && ./template_bench
+//
+// Exits 1 if the two pages differ.
+//
+#include <Arduino.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include "defines_n_types.h"
+#include "web_templates.h"
+
+#define ITERATIONS 5000
+#define SEGMENT_PAYLOAD (1460 - 6 - 7)   // PlainWebServer's buffer less chunk framing
+#define TEMP_BUFFER_SIZE 2048            // Same staging buffer as MyWebServer.cpp
+
+static SetupData settings;
+
+static char segment[SEGMENT_PAYLOAD];
+static size_t segmentLength;
+static uint32_t socketWrites;
+static uint32_t contentCalls;
+static size_t bytesOut;
+static std::string *captured;      // The page, when it's being kept
+
+// Every allocation made anywhere in the program goes through these
+static uint32_t allocations;
+
+extern "C" void* __real_malloc(size_t size);
+extern "C" void* __wrap_malloc(size_t size) {
+  allocations++;
+  return __real_malloc(size);
+}
+
+void* operator new(size_t size) {
+  allocations++;
+  void* p = __real_malloc(size ? size : 1);
+  if( ! p ) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// Stands in for PlainWebServer::sendContent: coalesce, send when full
+static void coalescingSink(const char* data, size_t len) {
+  contentCalls++;
+  bytesOut += len;
+  if( captured ) {
+    captured->append(data, len);
+  }
+  while( len ) {
+    size_t room = SEGMENT_PAYLOAD - segmentLength;
+    size_t n = len < room ? len : room;
+    memcpy(segment + segmentLength, data, n);
+    segmentLength += n;
+    data += n;
+    len -= n;
+    if( segmentLength == SEGMENT_PAYLOAD ) {
+      socketWrites++;
+      segmentLength = 0;
+    }
+  }
+}
+
+static void endResponse() {
+  if( segmentLength ) {
+    socketWrites++;
+    segmentLength = 0;
+  }
+}
+
+static bool benchValue(uint8_t field, TemplateValue& v) {
+  switch( field ) {
+    case CONFIG_FIELD_MESSAGES:           v.str = NULL; break;
+    case CONFIG_FIELD_USERNAME:           v.str = settings.htaccessUser; v.maxLength = sizeof(settings.htaccessUser); break;
+    case CONFIG_FIELD_PASSWORD_SET:       v.num = 1; break;
+    case CONFIG_FIELD_SSID:               v.str = settings.ssid; v.maxLength = sizeof(settings.ssid); break;
+    case CONFIG_FIELD_STATIC_IP:          v.num = settings.staticIp; break;
+    case CONFIG_FIELD_IP_ADDRESS:         v.num = settings.ipAddress; break;
+    case CONFIG_FIELD_GATEWAY:            v.num = settings.gateway; break;
+    case CONFIG_FIELD_SUBNET:             v.num = settings.subnet; break;
+    case CONFIG_FIELD_PRIMARY_DNS:        v.num = settings.primaryDNS; break;
+    case CONFIG_FIELD_SECONDARY_DNS:      v.num = settings.secondaryDNS; break;
+    case CONFIG_FIELD_POOL_URL:           v.str = settings.poolUrl; v.maxLength = sizeof(settings.poolUrl); break;
+    case CONFIG_FIELD_POOL_PORT:          v.num = settings.poolPort; break;
+    case CONFIG_FIELD_POOL_PASSWORD:      v.str = settings.poolPassword; v.maxLength = sizeof(settings.poolPassword); break;
+    case CONFIG_FIELD_WALLET:             v.str = settings.wallet; v.maxLength = sizeof(settings.wallet); break;
+    case CONFIG_FIELD_BACKUP_POOL_URL:    v.str = settings.backupPoolUrl; v.maxLength = sizeof(settings.backupPoolUrl); break;
+    case CONFIG_FIELD_BACKUP_POOL_PORT:   v.num = settings.backupPoolPort; break;
+    case CONFIG_FIELD_BACKUP_POOL_PASSWORD: v.str = settings.backupPoolPassword; v.maxLength = sizeof(settings.backupPoolPassword); break;
+    case CONFIG_FIELD_BACKUP_WALLET:      v.str = settings.backupWallet; v.maxLength = sizeof(settings.backupWallet); break;
+    case CONFIG_FIELD_NTP_SERVER:         v.str = settings.ntpServer; v.maxLength = sizeof(settings.ntpServer); break;
+    case CONFIG_FIELD_UTC_OFFSET_HOURS:   v.num = settings.utcOffset / 3600; break;
+    case CONFIG_FIELD_UTC_OFFSET_MINUTES: v.num = abs((settings.utcOffset % 3600) / 60); break;
+    default:                              v.num = 0; break;
+  }
+  return true;
+}
+
+// The old two pass escape, one malloc per field
+static char* legacyEscape(const char* input, size_t maxLength) {
+  size_t length = 0;
+  for( size_t i = 0; i < maxLength && input[i]; i++ ) {
+    switch( input[i] ) {
+      case '&': length += 5; break;
+      case '<': case '>': length += 4; break;
+      case '"': length += 6; break;
+      case '\'': length += 5; break;
+      default: length++; break;
+    }
+  }
+  char* out = (char*) malloc(length + 1);
+  char* d = out;
+  for( size_t i = 0; i < maxLength && input[i]; i++ ) {
+    switch( input[i] ) {
+      case '&': memcpy(d, "&amp;", 5); d += 5; break;
+      case '<': memcpy(d, "&lt;", 4); d += 4; break;
+      case '>': memcpy(d, "&gt;", 4); d += 4; break;
+      case '"': memcpy(d, "&quot;", 6); d += 6; break;
+      case '\'': memcpy(d, "&#39;", 5); d += 5; break;
+      default: *d++ = input[i]; break;
+    }
+  }
+  *d = '\0';
+  return out;
+}
+
+// One sendContent per op, like the old fragment-at-a-time code. Old
+// WebServer wrote each chunked sendContent as three socket writes.
+static void renderLegacy(char* temp) {
+  static const char hex[] = "0123456789ABCDEF";
+
+  for( size_t i = 0; i < configTemplateLength; i++ ) {
+    const TemplateOp& op = configTemplate[i];
+    TemplateValue v = { NULL, 0, 0 };
+    if( op.type != TEMPLATE_TEXT ) {
+      benchValue(op.field, v);
+    }
+    int n = 0;
+    switch( op.type ) {
+      case TEMPLATE_TEXT:
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "%.*s", (int) op.length, op.text);
+        break;
+      case TEMPLATE_HTML: {
+        if( ! v.str ) {
+          break;
+        }
+        char* e = legacyEscape(v.str, v.maxLength ? v.maxLength : SIZE_MAX);
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "%s", e);
+        free(e);
+        break;
+      }
+      case TEMPLATE_RAW:
+        if( v.str ) {
+          n = snprintf(temp, TEMP_BUFFER_SIZE, "%.*s", (int) (v.maxLength ? strnlen(v.str, v.maxLength) : strlen(v.str)), v.str);
+        }
+        break;
+      case TEMPLATE_INT:
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "%d", (int) v.num);
+        break;
+      case TEMPLATE_COLOR:
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "#%c%c%c%c%c%c", hex[(v.num >> 20) & 15], hex[(v.num >> 16) & 15],
+                     hex[(v.num >> 12) & 15], hex[(v.num >> 8) & 15], hex[(v.num >> 4) & 15], hex[v.num & 15]);
+        break;
+      case TEMPLATE_IP:
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "%d.%d.%d.%d", (int) (v.num & 0xff), (int) ((v.num >> 8) & 0xff),
+                     (int) ((v.num >> 16) & 0xff), (int) ((v.num >> 24) & 0xff));
+        break;
+      case TEMPLATE_OPTIONS:
+        for( int32_t h = op.value; h <= op.limit; h++ ) {
+          n = snprintf(temp, TEMP_BUFFER_SIZE, "<option value=\"%d\"%s>%d%.*s</option>", (int) h,
+                       h == v.num ? " SELECTED" : "", (int) h, (int) op.length, op.text);
+          coalescingSink(temp, n);
+          socketWrites += 3;
+        }
+        n = 0;
+        break;
+      case TEMPLATE_SELECTED:
+        n = snprintf(temp, TEMP_BUFFER_SIZE, "%s", v.num == op.value ? " SELECTED" : "");
+        break;
+      case TEMPLATE_IF:
+        // The old page left out a block with an if() around its sendContents
+        if( ! v.num && ! (v.str && v.str[0]) ) {
+          for( int depth = 1; depth && ++i < configTemplateLength; ) {
+            if( configTemplate[i].type == TEMPLATE_IF ) {
+              depth++;
+            } else if( configTemplate[i].type == TEMPLATE_END ) {
+              depth--;
+            }
+          }
+        }
+        break;
+      default:
+        break;
+    }
+    if( n > 0 ) {
+      coalescingSink(temp, n);
+      socketWrites += 3;
+    }
+  }
+  segmentLength = 0;
+}
+
+static void fillSettings() {
+  memset(&settings, 0, sizeof(settings));
+  strcpy(settings.htaccessUser, "admin");
+  strcpy(settings.ssid, "Kitchen & \"Garage\" <5G>");
+  strcpy(settings.poolUrl, "public-pool.io");
+  strcpy(settings.backupPoolUrl, "solo.ckpool.org");
+  strcpy(settings.ntpServer, "pool.ntp.org");
+  strcpy(settings.wallet, "bc1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh");
+  strcpy(settings.backupWallet, "bc1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh");
+  strcpy(settings.poolPassword, "x");
+  strcpy(settings.backupPoolPassword, "x");
+  settings.poolPort = 21496;
+  settings.backupPoolPort = 3333;
+  settings.ipAddress = 0x6401a8c0;
+  settings.gateway = 0x0101a8c0;
+  settings.subnet = 0x00ffffff;
+  settings.primaryDNS = 0x08080808;
+  settings.secondaryDNS = 0x04040808;
+  settings.utcOffset = -5 * 3600;
+}
+
+int main() {
+  static char temp[TEMP_BUFFER_SIZE];
+  fillSettings();
+  std::string templatePage, legacyPage;
+  templatePage.reserve(32768);
+  legacyPage.reserve(32768);
+
+  // One pass each to count and keep the page
+  captured = &templatePage;
+  allocations = 0;
+  TemplateRenderer r(temp, sizeof(temp), coalescingSink);
+  r.render(configTemplate, configTemplateLength, benchValue);
+  r.finish();
+  endResponse();
+  uint32_t templateAllocations = allocations;
+  printf("template: %u ops, %u bytes, %u sendContent calls, %u socket writes, %u allocations\n",
+         (unsigned) configTemplateLength, (unsigned) bytesOut, contentCalls, socketWrites, templateAllocations);
+
+  bytesOut = contentCalls = socketWrites = 0;
+  captured = &legacyPage;
+  allocations = 0;
+  renderLegacy(temp);
+  uint32_t legacyAllocations = allocations;
+  printf("legacy:   %u bytes, %u sendContent calls, ~%u socket writes, %u allocations\n",
+         (unsigned) bytesOut, contentCalls, socketWrites, legacyAllocations);
+  captured = NULL;
+
+  if( templatePage != legacyPage ) {
+    size_t at = 0;
+    while( at < templatePage.size() && at < legacyPage.size() && templatePage[at] == legacyPage[at] ) {
+      at++;
+    }
+    printf("The pages differ from byte %u:\n  template: %.60s\n  legacy:   %.60s\n", (unsigned) at,
+           templatePage.c_str() + at, legacyPage.c_str() + at);
+    return 1;
+  }
+  printf("Both pages are the same %u bytes\n", (unsigned) templatePage.size());
+
+  auto start = std::chrono::steady_clock::now();
+  for( int i = 0; i < ITERATIONS; i++ ) {
+    TemplateRenderer t(temp, sizeof(temp), coalescingSink);
+    t.render(configTemplate, configTemplateLength, benchValue);
+    t.finish();
+    endResponse();
+  }
+  double templateUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+
+  start = std::chrono::steady_clock::now();
+  for( int i = 0; i < ITERATIONS; i++ ) {
+    renderLegacy(temp);
+  }
+  double legacyUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+
+  printf("render time on this host: template %.2f us, legacy %.2f us (%d runs)\n", templateUs, legacyUs, ITERATIONS);
+  return 0;
+}
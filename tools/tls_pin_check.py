@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Checks the miner's TLS key pinning end to end. Build tools/tls_pin_check
+# as its header says, then:
+#
+#   python3 tools/tls_pin_check.py --check ./tls_pin_check
+#
+# It starts tools/tls_pool_proxy.py on a spare port with a fresh self-signed
+# certificate, reads the key pin it prints, and runs the check against it.
+# A pin that doesn't match has to be refused; the right one has to get in.
+# Only handshakes are tried, so nothing needs to be listening upstream.
+#
+# Exits 0 when the check passed, 1 if not.
+
+import argparse
+import os
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+PROXY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tls_pool_proxy.py")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check TLS key pinning against the TLS pool proxy")
+    parser.add_argument("--check", default="./tls_pin_check", help="tls_pin_check binary")
+    parser.add_argument("--port", type=int, default=3344)
+    args = parser.parse_args()
+
+    proxy = subprocess.Popen([sys.executable, PROXY, "--port", str(args.port), "--upstream", "127.0.0.1:9"],
+                             stderr=subprocess.PIPE, text=True)
+    ok = False
+    try:
+        pin = None
+        for line in proxy.stderr:
+            if line.startswith("Key pin:"):
+                pin = line.split()[-1]
+                break
+        if not pin:
+            print("The proxy didn't print a key pin")
+        else:
+            # Keep its log moving so it never blocks on a full pipe
+            threading.Thread(target=proxy.stderr.read, daemon=True).start()
+            for _ in range(50):
+                try:
+                    socket.create_connection(("127.0.0.1", args.port), timeout=1).close()
+                    break
+                except OSError:
+                    time.sleep(0.1)
+            result = subprocess.run([args.check, "--port", str(args.port), "--pin", pin], timeout=120)
+            ok = result.returncode == 0
+    finally:
+        proxy.terminate()
+        proxy.wait()
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,144 @@
+/*
+ * BitsyMiner Open Source
+ * Copyright (c) 2025 Justin Williams
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ */
+//
+// Checks the miner's TLS key pinning against tools/tls_pool_proxy.py.
+//
+// This is the firmware's own TlsTransport (src/stratumTransport.cpp) on a
+// PC, connecting to the proxy the way the stratum task would. Given the
+// proxy's real pin, it connects:
+//
+//   - with a pin one digit off, which has to be refused, twice over so a
+//     refused session can't have been kept and resumed;
+//   - with the right pin, which has to get in, and then again;
+//   - with the wrong pin once more, now that a good session is saved;
+//   - with no pin, which takes any key.
+//
+// Needs the mbedTLS 2.28 development headers (libmbedtls-dev). From the
+// repository root:
+//   g++ -O2 -DESP32_DEV_HEADLESS -Itools/host -Isrc
+//       tools/tls_pin_check/tls_pin_check.cpp tools/host/utils_host.cpp
+//       src/stratumTransport.cpp -lmbedtls -lmbedx509 -lmbedcrypto
+//       -o tls_pin_check
+//
+//   python3 tools/tls_pool_proxy.py --upstream 127.0.0.1:3333 &
+//   ./tls_pin_check --pin <the key pin the proxy printed>
+//
+// tools/tls_pin_check.py does both, with the proxy on a spare port.
+//
+// Exits 0 when every connect went as expected, 1 if not, 2 for bad options.
+//
+#include <Arduino.h>
+#include <WiFi.h>
+#include <string>
+#include "defines_n_types.h"
+#include "monitor.h"
+#include "dnsCache.h"
+#include "stratumTransport.h"
+
+MonitorData monitorData;
+
+// Only addresses; the proxy is always local
+bool dnsResolve(const char* host, IPAddress& ip) {
+  return ip.fromString(host);
+}
+
+static struct {
+  std::string host = "127.0.0.1";
+  uint16_t port = 3334;
+  std::string pin;
+} opt;
+
+static int failures = 0;
+
+static bool attempt(TlsTransport& t, const char* label, const std::string& pin, bool wantIn) {
+  IPAddress ip;
+  ip.fromString(opt.host.c_str());
+  t.setPin(pin.c_str());
+  uint32_t pinFailures = monitorData.tlsPinFailures;
+  bool in = t.open(opt.host.c_str(), ip, opt.port);
+  bool ok = in == wantIn;
+  if( in && ! pin.empty() && pin != t.peerPin() ) {
+    ok = false;     // Got in without the key matching
+  }
+  if( ! wantIn && monitorData.tlsPinFailures == pinFailures ) {
+    ok = false;     // Refused, but not for the key
+  }
+  printf("%-28s %-8s %-9s %s\n", label, in ? "in" : "refused", in ? (t.lastResumed() ? "resumed" : "full") : "", ok ? "ok" : "FAIL");
+  if( ! ok ) {
+    failures++;
+  }
+  t.stop();
+  return ok;
+}
+
+static void usage() {
+  printf("Usage: tls_pin_check [options] --pin HEX\n"
+         "  --host ADDRESS   where the proxy is (127.0.0.1)\n"
+         "  --port N         its TLS port (3334)\n"
+         "  --pin HEX        the key pin the proxy printed\n"
+         "  --help           this\n");
+}
+
+// 0 to carry on, otherwise the exit code
+static int parseOptions(int argc, char** argv) {
+  for( int i = 1; i < argc; i++ ) {
+    std::string a = argv[i];
+    if( a == "--help" || a == "-h" ) {
+      usage();
+      return 1;
+    }
+    if( i + 1 >= argc ) {
+      fprintf(stderr, "%s needs a value\n", a.c_str());
+      return 3;
+    }
+    const char* v = argv[++i];
+    if( a == "--host" ) {
+      opt.host = v;
+    } else if( a == "--port" ) {
+      opt.port = atoi(v);
+    } else if( a == "--pin" ) {
+      opt.pin = v;
+    } else {
+      fprintf(stderr, "Unknown option %s\n", a.c_str());
+      return 3;
+    }
+  }
+  if( opt.pin.length() != TLS_PIN_SIZE * 2 ) {
+    fprintf(stderr, "--pin needs the proxy's %d hex digit key pin\n", TLS_PIN_SIZE * 2);
+    return 3;
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  int parsed = parseOptions(argc, argv);
+  if( parsed ) {
+    return parsed - 1;
+  }
+
+  std::string wrong = opt.pin;
+  wrong.back() = wrong.back() == '0' ? '1' : '0';
+
+  TlsTransport t;
+  attempt(t, "wrong pin", wrong, false);
+  attempt(t, "wrong pin again", wrong, false);
+  attempt(t, "right pin", opt.pin, true);
+  attempt(t, "right pin again", opt.pin, true);
+  attempt(t, "wrong pin, good session kept", wrong, false);
+  attempt(t, "no pin", "", true);
+
+  printf("%s\n", failures ? "FAIL" : "OK");
+  return failures ? 1 : 0;
+}
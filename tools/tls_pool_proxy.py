@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# BitsyMiner Open Source
+# Copyright (c) 2025 Justin Williams
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# Local TLS stand-in for a pool, for trying the miner's TLS transport. It
+# takes TLS connections and passes the stratum inside them through to a
+# plain pool, so any pool without a TLS port will do:
+#
+#   python3 tools/tls_pool_proxy.py --upstream public-pool.io:21496
+#
+# With no --cert it makes a self-signed one with openssl. Either way it
+# prints the key pin to paste into the miner's pool settings. Then point the
+# miner at this machine and port 3334 with TLS on, and for example:
+#
+#   python3 tools/tls_pool_proxy.py ... --no-tickets      # every connect a full handshake
+#   python3 tools/tls_pool_proxy.py ... --drop-after 30   # close each connection after 30 s
+#
+# Each handshake is logged as full or resumed. /metrics on the miner has the
+# same counts, and how long each kind took.
+#
+# tools/tls_pin_check.py runs the miner's TLS code against it, to check a
+# pool whose key doesn't match the pin is refused.
+
+import argparse
+import os
+import socket
+import ssl
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+
+def make_cert(directory):
+    cert = os.path.join(directory, "pool.crt")
+    key = os.path.join(directory, "pool.key")
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1",
+                    "-nodes", "-days", "30", "-subj", "/CN=bitsy-test-pool", "-keyout", key, "-out", cert],
+                   check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return cert, key
+
+
+# SHA-256 of the certificate's public key, the way the miner works it out
+def key_pin(cert):
+    pub = subprocess.run(["openssl", "x509", "-in", cert, "-pubkey", "-noout"],
+                         check=True, capture_output=True).stdout
+    der = subprocess.run(["openssl", "pkey", "-pubin", "-outform", "der"],
+                         input=pub, check=True, capture_output=True).stdout
+    digest = subprocess.run(["openssl", "dgst", "-sha256", "-hex"],
+                            input=der, check=True, capture_output=True).stdout.decode()
+    return digest.strip().split()[-1]
+
+
+def pump(src, dst, label, verbose):
+    try:
+        while True:
+            data = src.recv(4096)
+            if not data:
+                break
+            if verbose:
+                sys.stderr.write("%s %s" % (label, data.decode(errors="replace")))
+            dst.sendall(data)
+    except OSError:
+        pass
+    for s in (src, dst):
+        try:
+            s.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+
+
+def serve(conn, addr, context, args):
+    start = time.monotonic()
+    try:
+        tls = context.wrap_socket(conn, server_side=True)
+    except (ssl.SSLError, OSError) as e:
+        sys.stderr.write("%s: handshake failed: %s\n" % (addr[0], e))
+        conn.close()
+        return
+    ms = (time.monotonic() - start) * 1000
+    sys.stderr.write("%s: %s handshake, %s, %.0f ms\n" % (
+        addr[0], "resumed" if tls.session_reused else "full", tls.cipher()[0], ms))
+
+    host, port = args.upstream.rsplit(":", 1)
+    try:
+        upstream = socket.create_connection((host, int(port)), timeout=10)
+        upstream.settimeout(None)
+    except OSError as e:
+        sys.stderr.write("%s: can't reach %s: %s\n" % (addr[0], args.upstream, e))
+        tls.close()
+        return
+
+    if args.drop_after:
+        threading.Timer(args.drop_after, pump_stop, (tls, upstream, addr)).start()
+    threading.Thread(target=pump, args=(upstream, tls, "<", args.verbose), daemon=True).start()
+    pump(tls, upstream, ">", args.verbose)
+    tls.close()
+    upstream.close()
+
+
+def pump_stop(tls, upstream, addr):
+    sys.stderr.write("%s: dropping the connection\n" % addr[0])
+    for s in (tls, upstream):
+        try:
+            s.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+
+
+def main():
+    parser = argparse.ArgumentParser(description="TLS stand-in for a stratum pool")
+    parser.add_argument("--port", type=int, default=3334)
+    parser.add_argument("--upstream", required=True, help="plain stratum pool, host:port")
+    parser.add_argument("--cert", help="PEM certificate; a self-signed one is made if left out")
+    parser.add_argument("--key", help="PEM private key for --cert")
+    parser.add_argument("--no-tickets", action="store_true", help="don't issue session tickets")
+    parser.add_argument("--drop-after", type=float, default=0, help="close each connection after this many seconds")
+    parser.add_argument("--verbose", action="store_true", help="print the stratum passing through")
+    args = parser.parse_args()
+
+    workdir = tempfile.mkdtemp(prefix="bitsy-tls-")
+    cert, key = (args.cert, args.key) if args.cert else make_cert(workdir)
+
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    # The miner's mbedTLS speaks TLS 1.2, where tickets come in the handshake itself
+    context.maximum_version = ssl.TLSVersion.TLSv1_2
+    context.load_cert_chain(cert, key)
+    if args.no_tickets:
+        context.options |= ssl.OP_NO_TICKET
+
+    sys.stderr.write("Key pin: %s\n" % key_pin(cert))
+    sys.stderr.write("TLS on port %d, passing through to %s%s\n" % (
+        args.port, args.upstream, ", no tickets" if args.no_tickets else ""))
+
+    listener = socket.create_server(("", args.port), reuse_port=False)
+    try:
+        while True:
+            conn, addr = listener.accept()
+            threading.Thread(target=serve, args=(conn, addr, context, args), daemon=True).start()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
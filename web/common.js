@@ -0,0 +1,36 @@
+Array.from(document.getElementsByClassName('capsWatch')).forEach( e => {
+  e.addEventListener('keyup', function(event) {
+    const x = document.getElementById(e.getAttribute('data-caps-indicator'));
+    if( x ) {        
+      if( event.getModifierState('CapsLock') ) {
+        x.style.display = 'block';
+      } else {
+        x.style.display = 'none';
+      }        
+    }
+  });
+  e.addEventListener('blur', function(event) {
+    const x = document.getElementById(e.getAttribute('data-caps-indicator'));
+    if( x ) {        
+     x.style.display = 'none';
+    }      
+  });
+});
+
+document.addEventListener("DOMContentLoaded", () => {
+  if(typeof pageLoadFunction === 'function') {
+  pageLoadFunction();
+  }
+});
+
+// Pages served as static files pick up their per-device settings here
+function loadUi() {
+  fetch('/uiJson').then(r => r.json()).then(ui => {
+    document.body.className = ui.theme;
+    localStorage.setItem('theme', ui.theme);
+    const logIcon = document.getElementById('logIcon');
+    if( logIcon ) {
+      logIcon.classList.toggle('noshow', ! ui.logViewer);
+    }
+  }).catch(() => {});
+}
@@ -0,0 +1,1040 @@
+//https://github.com/KaneCohen/modal-vanilla
+window.SHA256 = {
+	h: [0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19],
+	k: [0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	   0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	   0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	   0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	   0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	   0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	   0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2],
+	   
+	rotr: function(x, n) {
+		return (x >>> n) | (x << (32 - n));
+	},
+	
+	swap32: function(val) {
+		return ((val & 0xFF) << 24)
+           | ((val & 0xFF00) << 8)
+           | ((val >> 8) & 0xFF00)
+           | ((val >> 24) & 0xFF)
+	},
+	
+	transform: function(ctx, buf, offset) {
+
+		let wa = new ArrayBuffer(32);
+		let wa8 = new Uint8Array(wa);
+		let wa32 = new Uint32Array(wa);
+		let w = new ArrayBuffer(256);
+		let w8 = new Uint8Array(w);
+		let w32 = new Uint32Array(w);
+		let ctx8 = new Uint8Array(ctx);
+		let ctx32 = new Uint32Array(ctx);
+		let buf8 = new Uint8Array(buf);
+		
+		for(let i = 0; i < 8; i++) {
+			wa32[i] = ctx32[i];
+		}
+		
+		for(let i = 0, j = 0; i <16; i++, j += 4) {
+			w32[i] = (buf8[j + offset] << 24) | (buf8[j+1+offset]<<16) |
+				(buf8[j+2+offset]<<8) | (buf8[j+3+offset]);			
+		}
+	
+		for(let i = 16; i < 64; i++) {
+			let s0 = this.rotr(w32[i-15], 7) ^ this.rotr(w32[i-15], 18) ^ (w32[i-15] >>> 3);
+			let s1 = this.rotr(w32[i-2], 17) ^ this.rotr(w32[i-2], 19) ^ (w32[i-2] >>> 10);
+			w32[i] = (w32[i-16] + s0 + w32[i-7] + s1);
+		}
+		
+		for(let i = 0; i < 64; i++) {
+			let s1 = this.rotr(wa32[4], 6) ^ this.rotr(wa32[4], 11) ^ this.rotr(wa32[4], 25);
+			let ch = (wa32[4] & wa32[5]) ^ ((~wa32[4]) & wa32[6]);
+			let temp1 = wa32[7] + s1 + ch + this.k[i] + w32[i];
+			let s0 = this.rotr(wa32[0], 2) ^ this.rotr(wa32[0], 13) ^ this.rotr(wa32[0], 22);
+			let maj = (wa32[0] & wa32[1]) ^ (wa32[0] & wa32[2]) ^ (wa32[1] & wa32[2]);
+			let temp2 = s0 + maj;
+			wa32[7] = wa32[6]; wa32[6] = wa32[5]; wa32[5] = wa32[4]; wa32[4] = wa32[3] + temp1; 
+			wa32[3] = wa32[2]; wa32[2] = wa32[1]; wa32[1] = wa32[0]; wa32[0] = temp1 + temp2;
+		}
+	
+		for(let i = 0; i < 8; i++) {
+			ctx32[i] += wa32[i];
+		}
+		
+		return ctx;
+	},
+	
+	digest: function(buf, bytes) {
+		if(typeof bytes === 'undefined') {
+			bytes = buf.byteLength;
+		}
+		let buf8 = new Uint8Array(buf);
+		let remain = bytes % 64;
+		let totalLen = bytes - remain;
+		
+		let ctx = new ArrayBuffer(32);
+		let ctx32 = new Uint32Array(ctx);
+		
+		for(let i = 0; i < 8; i++) {	
+			ctx32[i] = this.h[i];
+		}
+
+		for(let i = 0; i < totalLen; i+= 64) {
+			this.transform(ctx, buf, i);
+		}
+		
+		let lm = new ArrayBuffer(64);
+		let lm8 = new Uint8Array(lm);
+		let j = 0;
+		for(let i = totalLen; i < bytes; i++, j++) {
+			lm8[j] = buf8[i];
+		}
+		lm8[j++] = 0x80;
+		
+		if(j > 56) {
+			this.transform(ctx, lm, 0);
+			lm8.fill(0);
+		}
+		
+		const l = BigInt(bytes * 8);
+		lm8[63] = Number(l & 0xffn);
+		lm8[62] = Number((l >> 8n) & 0xffn);
+		lm8[61] = Number((l >> 16n) & 0xffn);
+		lm8[60] = Number((l >> 24n) & 0xffn);
+		lm8[59] = Number((l >> 32n) & 0xffn);
+		lm8[58] = Number((l >> 40n) & 0xffn);
+		lm8[57] = Number((l >> 48n) & 0xffn);
+		lm8[56] = Number((l >> 56n) & 0xffn);
+		
+		this.transform(ctx, lm, 0);
+		
+		for(let i = 0; i < 8; i++) {
+			ctx32[i] = this.swap32(ctx32[i]);
+		}
+		
+		return ctx;
+	},
+	
+	doubleSha: function(buf, bytes) {
+		if(typeof bytes === 'undefined') {
+			bytes = buf.byteLength;
+		}
+		const ctx = this.digest(buf, bytes);		
+		const d = this.digest(ctx, 32);
+		return d;
+	},
+	
+	bin2Hex: function(buf, bytes) {
+		if(typeof bytes === 'undefined') {
+			bytes = buf.byteLength;
+		}
+		let s = '';
+		const b = new Uint8Array(buf);
+		for(let i = 0; i< 32;i++) {
+			s += (b[i]).toString(16).padStart(2, '0');
+		}
+		return s;
+	},
+	
+	hex2Bin: function(str) {
+		const len = str.length / 2;
+		const ab = new ArrayBuffer(len);
+		const ab8 = new Uint8Array(ab);
+		
+		for(let i = 0, j = 0; i < str.length; i+=2, j++) {
+			ab8[j] = parseInt(str.substr(i,2), 16);
+		}
+		return ab;
+	},
+	
+	
+	strToArrayBuff: function(str) {
+		let x = new ArrayBuffer(str.length);
+		let y = new Uint8Array(x);
+		
+		for(let i = 0; i < str.length; i++) {
+			y[i] = str.charCodeAt(i);
+		}
+		return x;
+	},
+	
+	midstate: function(block) {
+		const ctx = new ArrayBuffer(32);
+		const ctx32 = new Uint32Array(ctx);
+		
+		for(let i = 0; i < 8; i++) {	
+			ctx32[i] = this.h[i];
+		}
+		
+		this.transform(ctx, block, 0);
+		return ctx;
+	},
+	
+	completeHash: function(midstateCtx, block, nonce) {
+	
+		const ctx = new ArrayBuffer(midstateCtx.byteLength);
+		const ctx32 = new Uint32Array(ctx);
+		ctx32.set(new Uint32Array(midstateCtx));
+		
+		const block32 = new Uint32Array(block);
+		
+		let lm = new ArrayBuffer(64);
+		let lm8 = new Uint8Array(lm);
+		let lm32 = new Uint32Array(lm);
+
+		lm32[0] = block32[16];
+		lm32[1] = block32[17];
+		lm32[2] = block32[18];
+		lm32[3] = nonce;
+		lm32[4] = this.swap32(0x80000000);
+		lm32[15] = this.swap32(0x280);
+		
+		this.transform(ctx, lm, 0);
+				
+		for(let i = 0; i < 8; i++) {
+			ctx32[i] = this.swap32(ctx32[i]);
+		}
+			
+		const finalHash = this.digest(ctx, 32);		
+		const fh32 = new Uint32Array(finalHash);
+
+    if( ! (fh32[7] & 0xffff0000) ) {
+      return finalHash;
+    }
+		
+		return false;
+	}
+	
+	
+};
+
+var initialSSID = null;
+
+let ge = e => {return document.getElementById(e)};
+
+function versionToString(v) {
+  let s = 'v' + (v >> 16) + "." + ((v >> 8) & 0xff) + "." + (v & 0xff);
+  return s;
+}
+
+function showLoading() {
+  ge('loadingOverlay').style.visibility = 'visible';
+}
+
+function hideLoading() {
+  ge('loadingOverlay').style.visibility = 'hidden';
+}
+
+function trimAll() {
+  Array.from(document.querySelectorAll('input[type=text]')).forEach( e => {
+    e.value = e.value.trim();
+  });
+}
+
+function formSubmitter(form,section,action, timeoutAction) {
+  let data = new URLSearchParams(new FormData(form));
+  data.append('section', section);
+
+  showLoading();
+
+  let xhr = new XMLHttpRequest();
+  xhr.addEventListener('readystatechange', () => {
+    if(xhr.readyState == 4 && xhr.status == 200) {
+      let data = JSON.parse(xhr.responseText);
+      if( typeof action === 'function') {
+        action(data);
+      }
+    }
+  });
+
+  xhr.addEventListener('loadend', () => {
+    hideLoading();
+  });
+
+  xhr.addEventListener('timeout', () => {
+    if( typeof timeoutAction === 'function' ) {
+      timeoutAction();
+    }
+  });
+
+  xhr.addEventListener('error', () => {
+    console.log('error');
+  });
+
+  xhr.timeout = 3000; 
+  xhr.open('POST', '/config');
+  xhr.setRequestHeader('Accept', 'application/json');
+  xhr.send(data);  
+  
+}
+
+
+function userDataUpdated(data) {
+  if(typeof data === 'object' && 'error' in data && 'changesApplied' in data) {
+    if( ! data.error && data.changesApplied ) {
+      window.location.reload();
+    } else {
+      new ConfirmBox({text:data.message, hideCancel: true}); 
+    }
+  }
+}
+
+function userUpdateHandler(){
+  trimAll();
+  let pwRegex = /^(?=.*[a-z])(?=.*[A-Z])(?=.*\d)(?=.*[@.#$!%*?&])[A-Za-z\d@.#$!%*?&]{8,32}$/; 
+  let s = true;
+  let u = document.getElementById('user').value;
+  let p = document.getElementById('password').value;
+  let pc = document.getElementById('confirmPassword').value;
+  if( ! u.length || ! p.length ) {
+    new ConfirmBox({text:'Username and password are required.', hideCancel: true});    
+    s = false;
+  } else if( u.length && p.length ) {
+    if( p != pc ) {
+      new ConfirmBox({text:'Passwords do not match.', hideCancel: true});
+      s = false;
+    }
+  }
+
+  if( s && ! pwRegex.test(p) ) {
+    new ConfirmBox({text:'Password does not meet strength and/or length requirements.', hideCancel:true});
+    s = false;
+  }
+
+  if( s ) {
+    new ConfirmBox(
+      {
+        text: 'Are you sure you want to change your login information?',
+        ok: function() {formSubmitter(ge('frmUser'), 'user', userDataUpdated)}
+      }
+    );
+  }
+}
+
+function fullPageMessage(msg) {
+  let d = ge('fullModalMessage');
+  if( d ) {
+    d.remove();
+  }
+  d = document.createElement('div');
+  d.id = 'fullModalMessage';
+  d.classList.add('modal');
+  let e = document.createElement('div');
+  e.classList.add('modal-message');
+  e.innerHTML = msg;
+  d.appendChild(e);
+  document.body.appendChild(d);
+  d.style.display = 'block';
+}
+
+function postNetworkSubmit(data) {
+  if(document.location.href.includes('192.168.4.1')) {
+    doPing(null, function() {
+      fullPageMessage("The device is no longer available at this address.<br/><br/>Make sure you are on the same network as the device and use its new IP address to reconnect.");
+    });
+  }
+}
+
+function doNetworkChangeSubmit() {
+  formSubmitter(ge('frmNetwork'), 'network', function(d) {
+    if( 'error' in d && 'changesApplied' in d && 'message' in d) {
+      new ConfirmBox({
+        text: d.message,
+        hideCancel: true,
+        ok: function() {if(d.changesApplied) postNetworkSubmit(d);}
+      }); 
+    }
+  }, postNetworkSubmit);
+}
+
+function doPing(succeedAction, timeoutAction, failAction) {
+  let xhr = new XMLHttpRequest();
+  xhr.addEventListener('readystatechange', () => {
+    if(xhr.readyState == 4 && xhr.status == 200) {
+      let data = JSON.parse(xhr.responseText);
+      if( typeof succeedAction === 'function') {
+        succeedAction(data);
+      }
+    }
+  });
+
+  xhr.addEventListener('timeout', () => {
+    if(typeof timeoutAction === 'function') {
+      timeoutAction();
+    }
+  });
+
+  xhr.addEventListener('error', () => {
+    if(typeof failAction === 'function') {
+      failAction();
+    }
+  });
+
+  xhr.timeout = 750; 
+  xhr.open('GET', '/ping');
+  xhr.setRequestHeader('Accept', 'application/json');
+  xhr.send();  
+  
+}
+
+function confirmNetworkChange() {
+  new ConfirmBox({
+    text:'Are you ready to change the network settings?',
+    ok: doNetworkChangeSubmit
+  });
+}
+
+function networkUpdateHandler(){
+  trimAll();
+  let s = true;
+  let ssid = ge('ssid').value;
+  let p = ge('ssidPassword').value;
+  let sip = ge('staticIp').value;
+
+  if( ssid.length ) {
+    const ipr = /^(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$/;
+    const sipbr = /^(0|255)\./;
+    const siper = /\.(0|255)$/;
+    if(sip === 'true') {
+      const ip = ge('ipAddress').value;
+      const gw = ge('gateway').value;
+      const sn = ge('subnet').value;
+      const pdns = ge('primaryDNS').value;
+      const sdns = ge('secondaryDNS').value;
+
+      if( ! ipr.test(ge('ipAddress').value) || sipbr.test(ip) || siper.test(ip) ) {
+        new ConfirmBox({text:'Invalid IP address specified.', hideCancel: true});
+        s = false;
+      } else if( ! ipr.test(gw) || sipbr.test(ip) || siper.test(ip) ) {
+        new ConfirmBox({text:'Invalid gateway address specified.', hideCancel: true});
+        s = false;
+      } else if( ! ipr.test(sn) ) {
+        new ConfirmBox({text:'Invalid subnet address specified.', hideCancel: true});
+        s = false;
+      } else if( ! ipr.test(pdns) ) {
+        new ConfirmBox({text:'Invalid primary DNS address specified.', hideCancel: true});
+        s = false;
+      } else if( ! ipr.test(sdns) ) {
+        new ConfirmBox({text:'Invalid secondary DNS address specified.', hideCancel: true});
+        s = false;
+      }
+    }
+
+    if( s ) {
+      if( ! p.length && ssid != initialSSID ) {
+        new ConfirmBox({
+          text:'You did not specify a password. Are you sure you want to try to connect without a password?',
+          ok: confirmNetworkChange
+        });
+      } else {
+        confirmNetworkChange();
+      }
+    }
+  } else {
+    new ConfirmBox({text:'You must specify a WiFi SSID.', hideCancel: true});
+  }
+}
+
+function miningChangeSubmit() {
+  formSubmitter(ge('frmMining'), 'mining', 
+    function(d) {
+      if( 'error' in d && 'changesApplied' in d && 'message' in d) {
+        new ConfirmBox({
+          text: d.message,
+          hideCancel: true
+        }); 
+      }
+    }
+  );  
+}
+
+function validateWallet(e) {
+  if( ge('wallet').value.length > 0 ) {
+    let w = ge('wallet').value.split('.');
+  
+    if( BTCWalletValidator.validate(w[0]) ){
+      new ConfirmBox({text:'Your wallet is a valid Bitcoin wallet.', hideCancel:true});
+    } else {
+      new ConfirmBox({text:'Your wallet is an unknown format and may not be valid for Bitcoin mining.', hideCancel:true});
+    }
+  } else {
+    new ConfirmBox({text:'The wallet field is empty or invalid.', hideCancel:true});
+  }
+}
+
+function validateBackupWallet(e) {
+  if( ge('backupWallet').value.length > 0 ) {
+    let w = ge('backupWallet').value.split('.');
+  
+    if( BTCWalletValidator.validate(w[0]) ){
+      new ConfirmBox({text:'Your backup wallet is a valid Bitcoin wallet.', hideCancel:true});
+    } else {
+      new ConfirmBox({text:'Your backup wallet is an unknown format and may not be valid for Bitcoin mining.', hideCancel:true});
+    }
+  } else {
+    new ConfirmBox({text:'The backup wallet field is empty or invalid.', hideCancel:true});
+  }
+}
+
+function miningUpdateHandler(){
+  trimAll();
+  let s = true;
+  const hr = /^(?:(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$|^(([a-zA-Z0-9]|[a-zA-Z0-9][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)+([A-Za-z]|[A-Za-z][A-Za-z0-9\-]*[A-Za-z0-9])$/;
+  const p = /^[1-9]{1}[0-9]{0,4}$/;
+  if( ! ge('poolUrl').value.match(hr) ) {
+    new ConfirmBox({text:'Invalid pool server host name.', hideCancel: true});
+    s = false;
+  }
+  if(s) {
+    if( ge('poolPort').value.match(p) ) {
+      if( parseInt(ge('poolPort').value) > 65535 ) {
+        new ConfirmBox({text:'Pool port is out of range.', hideCancel: true});
+        s = false;
+      }
+    } else {
+      new ConfirmBox({text:'Invalid pool port.', hideCancel: true});
+      s = false;
+    }
+  }
+  if(s && document.getElementById('poolPassword').value.length == 0 ) {
+    new ConfirmBox({text:'A mining pool password is required. It may just be \"x\" in most cases.', hideCancel: true});
+    s = false;
+  }
+  if( s && ge('wallet').value.length == 0  ){
+    new ConfirmBox({text:'Your Bitcoin wallet is required for mining.', hideCancel:true});
+    s = false;
+  }
+
+  
+  if(s ) {
+    new ConfirmBox({
+      text:'Changes will take effect immediately. Do you wish to proceed?',
+      ok: miningChangeSubmit
+    });
+  }
+}
+function displayUpdateHandler(){
+
+  formSubmitter(ge('frmDisplay'), 'display', function(d) {
+    if('error' in d && 'message' in d) {
+      if(d.error) {
+        new ConfirmBox({
+          text: d.message,
+          hideCancel: true
+        }); 
+      }
+    }
+  });
+
+}
+
+function ledUpdateHandler(){
+
+  formSubmitter(ge('frmLED'), 'lighting', function(d) {
+    if('error' in d && 'message' in d) {
+      if(d.error) {
+        new ConfirmBox({
+          text: d.message,
+          hideCancel: true
+        }); 
+      }
+    }
+  });
+
+}
+
+function advancedUpdateHandler() {
+  formSubmitter(ge('frmAdvanced'), 'advanced', function(d) {
+    if('error' in d && 'message' in d) {
+      if(d.error) {
+        new ConfirmBox({
+          text: d.message,
+          hideCancel: true
+        }); 
+      } else if('changesApplied' in d && ! d.changesApplied) {
+        new ConfirmBox({text:d.message, hideCancel: true});
+      } else if('changesApplied' in d && d.changesApplied) {
+        new ConfirmBox({text: 'Changes applied.', hideCancel: true});
+        ge('clearStats').value = '';
+        if( ge('enableLogViewer').value == 'true' ) {
+          document.querySelector('.logIcon').classList.remove('noshow');
+        } else {
+          document.querySelector('.logIcon').classList.add('noshow');
+        }
+      }
+    }
+  });  
+}
+
+function generalUpdateHandler() {
+  let s = true;
+  const hr = /^(?:(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$|^(([a-zA-Z0-9]|[a-zA-Z0-9][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)+([A-Za-z]|[A-Za-z][A-Za-z0-9\-]*[A-Za-z0-9])$/;
+  const ntps = ge('ntpServer').value;
+  if( ntps.length && ! ntps.match(hr) ) {
+    new ConfirmBox({text:'Invalid time server host name.', hideCancel: true});
+    s = false;
+  }
+
+  if(s) {
+
+    formSubmitter(ge('frmGeneral'), 'general', function(d) {
+      if('error' in d && 'message' in d) {
+        if(d.error) {
+          new ConfirmBox({
+            text: d.message,
+            hideCancel: true
+          }); 
+        } else if('changesApplied' in d && ! d.changesApplied) {
+            new ConfirmBox({text:d.message, hideCancel: true});
+        } else if('changesApplied' in d && d.changesApplied) {
+          new ConfirmBox({text: 'Changes applied.', hideCancel: true});
+          
+          let wt = parseInt(ge('webTheme').value);
+          if( wt ) {
+            document.body.classList.add('dark-mode');
+          } else {
+            document.body.classList.remove('dark-mode');
+          }
+
+        }
+      }
+    });
+  }
+}
+
+function accordionSetup() {
+  var acc = document.getElementsByClassName("accordion");
+  var i;
+  for (i = 0; i < acc.length; i++) {
+    acc[i].addEventListener("click", function(e) {
+      e.preventDefault();
+      this.classList.toggle("active");
+      var panel = this.nextElementSibling;
+      if (panel.style.maxHeight) {
+        panel.style.maxHeight = null;
+      } else {
+        panel.style.maxHeight = panel.scrollHeight + "px";
+      }
+    });
+  }
+}
+function doNetworkScan(e){
+
+  showLoading();
+  fetch('/wifiScan', {method:'GET'})
+    .then(response => {
+      if( ! response.ok ) {
+        throw new Error('Scan error');
+      }
+      return response.json();
+    })
+    .then(data => {
+      if('error' in data && 'message' in data) {
+        new ConfirmBox({
+          text: d.message,
+          hideCancel: true
+        }); 
+      } else {
+        ScanResultBox.show().populate(data);
+      }
+      
+    })
+    .catch(error=> {
+        console.error(error);
+    })
+    .finally( () => {
+      hideLoading();
+    });
+}
+
+function staticIpHandler() {
+  const v = ge('staticIp').value;
+  if( v === 'true' ) {
+    Array.from(document.querySelectorAll('#staticNetworkInfo *')).forEach( e=>{e.removeAttribute('disabled')});
+  } else {
+    Array.from(document.querySelectorAll('#staticNetworkInfo *')).forEach( e=>{e.setAttribute('disabled', true)});
+  }
+  
+}
+
+function buttonSetup() {
+  ge('btnUserUpdate').addEventListener('click', e=>{ userUpdateHandler(e); });
+  if( ge('btnNetworkUpdate') ) {
+    ge('btnNetworkUpdate').addEventListener('click', e=>{ networkUpdateHandler(e); });
+    ge('btnMiningUpdate').addEventListener('click', e=>{ miningUpdateHandler(e); });    
+    ge('btnScanNetworks').addEventListener('click', e=>{doNetworkScan(e)});    
+    ge('staticIp').addEventListener('change', e => {
+      staticIpHandler();
+    });
+    staticIpHandler();
+    ge('ipAddress').addEventListener('change', e=> {
+      ipChangeHandler();
+    });
+  }
+
+  if( ge('btnMiningUpdate') ) {
+    ge('btnValidateWallet').addEventListener('click', e=> { validateWallet(e) });
+    ge('btnValidateBackupWallet').addEventListener('click', e=> { validateBackupWallet(e) });
+  }
+
+  
+
+  if( ge('btnDisplayUpdate') ) {
+    ge('btnDisplayUpdate').addEventListener('click', e=>{ displayUpdateHandler(e); });
+  }
+
+  if( ge('btnGeneralUpdate') ) {
+    ge('btnGeneralUpdate').addEventListener('click', e=>{ generalUpdateHandler(e)});
+  }
+
+  if( ge('btnAdvancedUpdate') ) {
+    ge('btnAdvancedUpdate').addEventListener('click', e=>{ advancedUpdateHandler(e)});
+  }
+
+  if( ge('btnLEDUpdate') ) {
+    ge('btnLEDUpdate').addEventListener('click', e=>{ ledUpdateHandler(e)});
+  }
+
+  if( ge('showWifiPassword') ) {
+    ge('showWifiPassword').addEventListener('change', e=>{
+      if(e.target.checked) {
+        ge('ssidPassword').type = 'text';
+      } else {
+        ge('ssidPassword').type = 'password';
+      }
+    });
+  }
+}
+
+function rememberSSID() {
+  if( ge('ssid') ) {
+    initialSSID = ge('ssid').value;
+  }
+}
+
+function ipChangeHandler() {
+  const ipr = /^(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$/;
+  const ip = ge('ipAddress').value;
+  if( (m = ip.match(ipr)) && parseInt(m[1]) > 0  ) {
+    ge('gateway').value = [m[1], m[2], m[3], '1'].join('.');
+    ge('subnet').value = '255.255.255.0';
+    ge('primaryDNS').value = [m[1], m[2], m[3], '1'].join('.');
+    ge('secondaryDNS').value = '4.4.4.4';
+  }
+}
+
+
+
+function pageLoadFunction() {
+  accordionSetup();
+  buttonSetup();
+  rememberSSID();
+}
+
+function setDefaultForegroundColor() {
+  ge('foregroundColor').value = '#ffffff';
+}
+
+function setDefaultBackgroundColor() {
+  ge('backgroundColor').value = '#042045';
+}
+
+  var ScanResultBox = {
+
+    show: function() {
+      const self = this;
+      let d = document.getElementById('ssidTableWrapper');
+      if( ! d ) {
+        d = document.createElement('div');
+        d.id = 'ssidTableWrapper';
+        const c1 = document.createElement('div');
+        c1.style.cssText = 'position:absolute;width:350px;height:300px;top:25%;left:50%;border:1px solid black;padding:5px;background-color:var(--bg-color);transform:translateX(-50%)';
+        
+        const td = document.createElement('div');
+        td.style.cssText = 'overflow-y:scroll;max-height:80%';
+        c1.appendChild(td);
+        
+        const h = document.createElement('div');
+        h.style.cssText = 'max-height:20%; text-align:center';
+        h.innerHTML = '<button class="btn" onclick="ScanResultBox.hide()">Cancel</button>';
+        c1.appendChild(h);
+
+        d.appendChild(c1);
+        document.body.appendChild(d);
+      }
+      d.style.display = 'block';
+      return self;
+    },
+
+    hide: function() {
+      const self = this;
+      const d = document.getElementById('ssidTableWrapper');
+      if( d ) {
+        d.style.display = 'none';
+      }
+      return self;
+    },
+
+    populate: function(d) {
+      const self = this;
+      const networks = d.networks;
+      let l = Array();
+      let html = '<table>';
+      networks.forEach( n => {
+        if( ! l.includes(n.ssid) ) {
+          html += '<tr><td>' + n.ssid + '</td><td><button class="btn ssidSelectButton" data-ssid="' + n.ssid + '">Select</td></tr>';
+        }
+        l.push(n.ssid);
+      });
+      html += '</table>';
+
+      const t = document.getElementById('ssidTableWrapper');
+      if( t ) {
+        t.firstChild.firstChild.innerHTML = html;
+        t.firstChild.firstChild.scrollTop = 0;
+      }
+
+      Array.from(document.getElementsByClassName('ssidSelectButton')).forEach( e => {
+        e.addEventListener('click', el => {
+          document.getElementById('ssid').value = el.target.getAttribute('data-ssid');
+          self.hide();
+        });
+      });
+
+      return self;
+    }
+  };
+
+	function ConfirmBox( params ) {    
+		this.params = typeof params !== 'undefined' ? params : {};
+    this.text = 'text' in this.params ? this.params.text : 'Are you sure?';
+		this.params.ok = typeof this.params.ok !== 'undefined' ? this.params.ok : function() {};
+    this.params.hideCancel = typeof this.params.hideCancel !== 'undefined' ? this.params.hideCancel : false;
+		this.params.cancel = typeof this.params.cancel !== 'undefined' ? this.params.cancel : function() {};
+		this.init();
+	}
+	
+	ConfirmBox.prototype = {
+		init: function() {
+			this.instance = null;
+			this.create();
+			this.layout();
+			this.actions();
+		},
+		create: function() {
+		  let w = document.querySelector( "#confirm-wrapper" );
+      if( ! w) {
+			  w = document.createElement( "div" );
+				w.id = "confirm-wrapper";
+				document.body.appendChild( w );
+		  }
+		  this.instance = w;
+      
+      let html = "<div id='confirm-box'><h2 id='confirm-header'></h2>";
+			html += "<div id='confirm-buttons'><button id='confirm-ok'>OK</button>";
+      if( ! this.params.hideCancel ) {
+         html += "<button type='button' id='confirm-cancel'>Cancel</button>";
+      }
+      html += "</div>";
+			html += "</div>";
+				
+			w.innerHTML = html;
+		},
+		layout: function() {
+			const wrapper = this.instance;
+			const winHeight = window.innerHeight || document.documentElement.clientHeight || document.body.clientHeight;
+			
+			wrapper.style.height = winHeight + "px";	
+		},
+		show: function( element ) {
+			element.style.display = "block";
+			element.style.opacity = 1;
+		},
+		hide: function( element ) {
+			element.style.opacity = 0;
+			setTimeout(function() {
+				element.style.display = "none";
+			}, 200);
+		},
+
+		actions: function() {
+			var self = this;
+			
+			self.instance.querySelector( "#confirm-ok" ).
+			onclick = function() {
+				self.hide( self.instance );
+				setTimeout(function() {
+					self.params.ok();
+				}, 200);
+			};
+		
+      if( ! this.params.hideCancel ) {
+        self.instance.querySelector( "#confirm-cancel" ).
+        onclick = function() {
+          self.hide( self.instance );
+          setTimeout(function() {
+            self.params.cancel();
+          }, 200);
+        };
+      }
+
+
+      self.instance.querySelector( "#confirm-header" ).innerHTML = self.text;
+      self.show( self.instance );
+		}
+	};
+
+
+var BTCWalletValidator = {
+	base58Regex: /^[13][a-km-zA-HJ-NP-Z1-9]{25,34}$/,
+	bech32Regex: /^(bc1)[0-9a-z]{39,59}$/,
+
+	base58Decode: function(str) {
+		const alphabet = '123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz';
+		const base = 58;
+
+		let decoded = BigInt(0);
+		let multiplier = BigInt(1);
+
+		for (let i = str.length - 1; i >= 0; i--) {
+			const char = str[i];
+			const charIndex = alphabet.indexOf(char);
+
+			if (charIndex === -1) {
+				throw new Error('Invalid Base58 character');
+			}
+
+			decoded += BigInt(charIndex) * multiplier;
+			multiplier *= BigInt(base);
+		}
+
+		// Convert decoded BigInt to byte array
+		const bytes = [];
+		while (decoded > 0) {
+			bytes.push(Number(decoded % BigInt(256)));
+			decoded /= BigInt(256);
+		}
+
+		// Reverse the byte array to get the correct order
+		bytes.reverse();
+
+		// Handle leading zeros in Base58 encoding
+		for (const char of str) {
+			if (char === '1') {
+				bytes.unshift(0);
+			} else {
+				break;
+			}
+		}
+
+		return new Uint8Array(bytes);
+	},
+
+	bech32Decode: function(str) {
+		const CHARSET = 'qpzry9x8gf2tvdw0s3jn54khce6mua7l';
+
+		const decode = (chars) => {
+			let result = 0;
+			for (let i = 0; i < chars.length; i++) {
+				const c = chars[i];
+				const idx = CHARSET.indexOf(c);
+				if (idx === -1) {
+					throw new Error('Invalid Bech32 character');
+				}
+				result = (result << 5) | idx;
+			}
+			return result;
+		};
+
+		const computeChecksum = (hrp, data) => {
+			const values = hrpExpand(hrp).concat(data);
+			return polymod(values);
+		};
+
+		const hrpExpand = (hrp) => {
+			const result = [];
+			for (let i = 0; i < hrp.length; i++) {
+				result.push(hrp.charCodeAt(i) >> 5);
+			}
+			result.push(0);
+			for (let i = 0; i < hrp.length; i++) {
+				result.push(hrp.charCodeAt(i) & 31);
+			}
+			return result;
+		};
+
+		const polymod = (values) => {
+			const GENERATOR = [0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3];
+			let chk = 1;
+			for (let p = 0; p < values.length; p++) {
+				const top = chk >> 25;
+				chk = (chk & 0x1ffffff) << 5 ^ values[p];
+				for (let i = 0; i < 5; i++) {
+					chk ^= ((top >> i) & 1) ? GENERATOR[i] : 0;
+				}
+			}
+			return chk;
+		};
+
+		const pos = str.lastIndexOf('1');
+		if (pos < 1 || pos + 7 > str.length || str.length > 90) {
+			throw new Error('Invalid Bech32 string');
+		}
+
+		const hrp = str.substring(0, pos);
+		const data = str.substring(pos + 1).split('').map(char => CHARSET.indexOf(char));
+
+		if (computeChecksum(hrp, data) !== 1) {
+			throw new Error('Invalid Bech32 checksum');
+		}
+
+		return {
+			hrp: hrp,
+			data: data.slice(0, -6),
+		};
+	},
+
+	validateBase58: function(wAddr) {
+
+		try {
+			const decoded = this.base58Decode(wAddr);
+			const checksum = decoded.slice(-4);
+			const body = decoded.slice(0, -4);
+
+      const hash2 = new Uint8Array(SHA256.doubleSha(body));
+
+			if (checksum.every((value, index) => value === hash2[index])) {
+				return true;
+			} else {
+				return false;
+			}
+		} catch (error) {
+			console.log(error);
+			return false;
+		}
+	},
+
+	validateBech32: function(wAddr) {
+		try {
+			const decoded = this.bech32Decode(wAddr);
+			return decoded.hrp === 'bc';
+		} catch (error) {
+			console.log(error);
+			return false;
+		}
+
+	},
+
+	validate: function(wAddr) {
+		if (this.base58Regex.test(wAddr)) {
+			return this.validateBase58(wAddr);
+		} else if (this.bech32Regex.test(wAddr)) {
+			return this.validateBech32(wAddr);
+		} else {
+			console.log("shouldn't be here");
+			return false;
+		}
+	}
+};